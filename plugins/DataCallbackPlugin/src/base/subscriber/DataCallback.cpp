@@ -30,6 +30,7 @@
 //------------------------------------------------------------------------------
 
 #include "DataCallback.hpp"
+#include "ParameterIndex.hpp"
 
 #include "MessageInterface.hpp"
 #include "Parameter.hpp"
@@ -257,11 +258,11 @@ std::string DataCallback::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer DataCallback::GetParameterID(const std::string &str) const
 {
-  for (Integer i = SubscriberParamCount; i < DataCallbackParamCount; i++)
-  {
-    if (str == PARAMETER_TEXT[i - SubscriberParamCount])
-      return i;
-  }
+  static const ParameterIndex parameterIndex("DataCallback", PARAMETER_TEXT,
+        SubscriberParamCount, DataCallbackParamCount);
+  Integer id = parameterIndex.Find(str);
+  if (id != -1)
+     return id;
 
   return Subscriber::GetParameterID(str);
 }
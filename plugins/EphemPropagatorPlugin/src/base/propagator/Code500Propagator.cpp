@@ -31,6 +31,7 @@
 
 
 #include "Code500Propagator.hpp"
+#include "ParameterIndex.hpp"
 #include "MessageInterface.hpp"
 #include "FileManager.hpp"
 #include "NotAKnotInterpolator.hpp"    // Only one supported for now
@@ -244,12 +245,12 @@ std::string Code500Propagator::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer Code500Propagator::GetParameterID(const std::string &str) const
 {
-   for (Integer i = EphemerisPropagatorParamCount;
-         i < Code500PropagatorParamCount; ++i)
-   {
-       if (str == PARAMETER_TEXT[i - EphemerisPropagatorParamCount])
-           return i;
-   }
+   static const ParameterIndex parameterIndex("Code500Propagator",
+         PARAMETER_TEXT, EphemerisPropagatorParamCount,
+         Code500PropagatorParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
 
    return EphemerisPropagator::GetParameterID(str);
 }
@@ -32,6 +32,7 @@
 #include <sstream>
 #include <cstdio>                   // for sprintf
 #include "EphemerisPropagator.hpp"
+#include "ParameterIndex.hpp"
 #include "MessageInterface.hpp"
 #include "TimeTypes.hpp"
 #include "TimeSystemConverter.hpp"
@@ -230,12 +231,11 @@ EphemerisPropagator& EphemerisPropagator::operator=(
 //------------------------------------------------------------------------------
 Integer EphemerisPropagator::GetParameterID(const std::string &str) const
 {
-   for (Integer i = PropagatorParamCount;
-         i < EphemerisPropagatorParamCount; ++i)
-   {
-      if (str == PARAMETER_TEXT[i - PropagatorParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("EphemerisPropagator",
+         PARAMETER_TEXT, PropagatorParamCount, EphemerisPropagatorParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
 
    return Propagator::GetParameterID(str);
 }
@@ -31,6 +31,7 @@
 
 
 #include "SPKPropagator.hpp"
+#include "ParameterIndex.hpp"
 #include "MessageInterface.hpp"
 #include "FileManager.hpp"
 #include <sstream>                 // for stringstream
@@ -194,12 +195,11 @@ std::string SPKPropagator::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer SPKPropagator::GetParameterID(const std::string &str) const
 {
-   for (Integer i = EphemerisPropagatorParamCount;
-         i < SPKPropagatorParamCount; ++i)
-   {
-       if (str == PARAMETER_TEXT[i - EphemerisPropagatorParamCount])
-           return i;
-   }
+   static const ParameterIndex parameterIndex("SPKPropagator", PARAMETER_TEXT,
+         EphemerisPropagatorParamCount, SPKPropagatorParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
 
    return EphemerisPropagator::GetParameterID(str);
 }
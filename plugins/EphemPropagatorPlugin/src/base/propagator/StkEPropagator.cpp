@@ -31,6 +31,7 @@
 
 
 #include "StkEPropagator.hpp"
+#include "ParameterIndex.hpp"
 #include "MessageInterface.hpp"
 #include "FileManager.hpp"
 #include "PropagatorException.hpp"
@@ -221,12 +222,11 @@ std::string StkEPropagator::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer StkEPropagator::GetParameterID(const std::string &str) const
 {
-   for (Integer i = EphemerisPropagatorParamCount;
-         i < StkEPropagatorParamCount; ++i)
-   {
-       if (str == PARAMETER_TEXT[i - EphemerisPropagatorParamCount])
-           return i;
-   }
+   static const ParameterIndex parameterIndex("StkEPropagator", PARAMETER_TEXT,
+         EphemerisPropagatorParamCount, StkEPropagatorParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
 
    return EphemerisPropagator::GetParameterID(str);
 }
@@ -21,6 +21,7 @@
 
 
 #include "ErrorModel.hpp"
+#include "ParameterIndex.hpp"
 #include "StringUtil.hpp"
 #include "GmatBase.hpp"
 #include "MeasurementException.hpp"
@@ -327,11 +328,11 @@ std::string ErrorModel::GetParameterUnit(const Integer id) const
 //------------------------------------------------------------------------------
 Integer ErrorModel::GetParameterID(const std::string &str) const
 {
-   for (Integer i = GmatBaseParamCount; i < ErrorModelParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatBaseParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("ErrorModel", PARAMETER_TEXT,
+         GmatBaseParamCount, ErrorModelParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
 
    return GmatBase::GetParameterID(str);
 }
@@ -30,14 +30,16 @@
 //------------------------------------------------------------------------------
 
 #include "BatchEstimator.hpp"
+#include "ParameterIndex.hpp"
 #include "MessageInterface.hpp"
 #include "EstimatorException.hpp"
 #include <sstream>
 #include "StringUtil.hpp"
 #include "DataWriter.hpp"
 #include "SchurFactorization.hpp"
-#include "CholeskyFactorization.hpp"
+#include "BlockCholeskyFactorization.hpp"
 #include "UtilityException.hpp"
+#include "WorkerPool.hpp"
 
 //#define DEBUG_ACCUMULATION
 //#define DEBUG_ACCUMULATION_RESULTS
@@ -64,6 +66,7 @@ BatchEstimator::PARAMETER_TEXT[] =
    "UseInnerLoopEditing",
    "ILSEMultiplicativeConstant",
    "ILSEMaximumIterations",
+   "ThreadCount",
 };
 
 const Gmat::ParameterType
@@ -76,8 +79,11 @@ BatchEstimator::PARAMETER_TYPE[] =
    Gmat::BOOLEAN_TYPE,
    Gmat::REAL_TYPE,
    Gmat::INTEGER_TYPE,
+   Gmat::INTEGER_TYPE,
 };
 
+const UnsignedInt BatchEstimator::ACCUMULATION_BLOCK_SIZE = 256;
+
 
 //------------------------------------------------------------------------------
 // BatchEstimator(const std::string &name)
@@ -98,7 +104,9 @@ BatchEstimator::BatchEstimator(const std::string &name):
    constMultIL              (3.0),
    maxIterationsIL          (15),
    iterationsTakenIL        (0),
-   estimationStatusIL       (IL_UNKNOWN)
+   estimationStatusIL       (IL_UNKNOWN),
+   threadCount              (1),
+   workerPool               (NULL)
 {
    objectTypeNames.push_back("BatchEstimator");
    parameterCount = BatchEstimatorParamCount;
@@ -114,6 +122,8 @@ BatchEstimator::BatchEstimator(const std::string &name):
 //------------------------------------------------------------------------------
 BatchEstimator::~BatchEstimator()
 {
+   if (workerPool)
+      delete workerPool;
 }
 
 
@@ -136,7 +146,9 @@ BatchEstimator::BatchEstimator(const BatchEstimator& est) :
    constMultIL              (est.constMultIL),
    maxIterationsIL          (est.maxIterationsIL),
    iterationsTakenIL        (est.iterationsTakenIL),
-   estimationStatusIL       (est.estimationStatusIL)
+   estimationStatusIL       (est.estimationStatusIL),
+   threadCount              (est.threadCount),
+   workerPool               (NULL)
 {
 
 }
@@ -168,6 +180,13 @@ BatchEstimator& BatchEstimator::operator=(const BatchEstimator& est)
       maxIterationsIL    = est.maxIterationsIL;
       iterationsTakenIL  = est.iterationsTakenIL;
       estimationStatusIL = est.estimationStatusIL;
+      threadCount        = est.threadCount;
+
+      if (workerPool)
+      {
+         delete workerPool;
+         workerPool = NULL;
+      }
    }
 
    return *this;
@@ -252,11 +271,11 @@ std::string BatchEstimator::GetParameterUnit(const Integer id) const
 //------------------------------------------------------------------------------
 Integer BatchEstimator::GetParameterID(const std::string &str) const
 {
-   for (Integer i = BatchEstimatorBaseParamCount; i < BatchEstimatorParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - BatchEstimatorBaseParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("BatchEstimator", PARAMETER_TEXT,
+         BatchEstimatorBaseParamCount, BatchEstimatorParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
 
    return BatchEstimatorBase::GetParameterID(str);
 }
@@ -299,6 +318,27 @@ std::string BatchEstimator::GetParameterTypeString(const Integer id) const
 }
 
 
+//---------------------------------------------------------------------------
+//  bool IsParameterReadOnly(const Integer id) const
+//---------------------------------------------------------------------------
+/**
+ * Checks to see if the requested parameter is read only.
+ *
+ * @param <id> Description for the parameter.
+ *
+ * @return true if the parameter is read only, false (the default) if not
+ */
+//---------------------------------------------------------------------------
+bool BatchEstimator::IsParameterReadOnly(const Integer id) const
+{
+   // ThreadCount is only written when it is not the default
+   if ((id == THREAD_COUNT) && (threadCount == 1))
+      return true;
+
+   return BatchEstimatorBase::IsParameterReadOnly(id);
+}
+
+
 //------------------------------------------------------------------------------
 //  Real GetRealParameter(const Integer id) const
 //------------------------------------------------------------------------------
@@ -431,6 +471,9 @@ Integer BatchEstimator::GetIntegerParameter(const Integer id) const
    if (id == MAX_ITERATIONS_ILSE)
       return maxIterationsIL;
 
+   if (id == THREAD_COUNT)
+      return threadCount;
+
    return BatchEstimatorBase::GetIntegerParameter(id);
 }
 
@@ -460,6 +503,17 @@ Integer BatchEstimator::SetIntegerParameter(const Integer id, const Integer valu
       return maxIterationsIL;
    }
 
+   if (id == THREAD_COUNT)
+   {
+      if (value >= 0)
+         threadCount = value;
+      else
+         throw SolverException(
+            "The value entered for the thread count on " + instanceName +
+            " is not an allowed value. The allowed value is: [Integer >= 0].");
+      return threadCount;
+   }
+
    return BatchEstimatorBase::SetIntegerParameter(id, value);
 }
 
@@ -571,6 +625,16 @@ void BatchEstimator::CompleteInitialization()
 
    iterationsTakenIL  = 0;
    estimationStatusIL = IL_UNKNOWN;
+
+   if (workerPool)
+   {
+      delete workerPool;
+      workerPool = NULL;
+   }
+   if (threadCount != 1)
+      workerPool = new WorkerPool(threadCount);
+
+   accumulator.SetSize(stateSize);
 }
 
 
@@ -883,28 +947,20 @@ void BatchEstimator::Accumulate()
 
       #endif
 
-      std::vector<RealArray> hMeas = measStat.hAccum;
-
-      for (UnsignedInt k = 0; k < measStat.residual.size(); ++k)
+      if ((measStat.editFlag == NORMAL_FLAG) && (threadCount == 1))
       {
-         Real ocDiff = measStat.residual[k];  // It is residual value = O - C
-         Real weight = measStat.weight[k];
-         
-         // Accummulate information matrix and residuals based on observation 
-         // data which is selected for estimation calculation
-         if (measStat.editFlag == NORMAL_FLAG)
-         {
-            for (UnsignedInt i = 0; i < stateSize; ++i)
-            {
-               for (UnsignedInt j = 0; j < stateSize; ++j)
-                  information(i, j) += hMeas[k][i] * hMeas[k][j] * weight;   // the first term in open-close square bracket of equation 8-57 in GTDS MathSpec
-                                                                              // this is actually hMeas[k][i] * weight * hMeas[k][j],
-                                                                              // but rearranged for numerical precision reasons
-                                                                              // to preserve the symmetry of the information matrix
-
-               residuals[i] += hMeas[k][i] * weight * ocDiff;               // the first term in open-close parenthesis of equation 8-57 in GTDS MathSpec
-            }
-         }
+         if (accumulator.GetSize() != (Integer)stateSize)
+            accumulator.SetSize(stateSize);
+
+         // Accummulate information matrix and residuals based on observation
+         // data which is selected for estimation calculation.  These are the
+         // first terms in the square bracket and parenthesis of equation 8-57
+         // in GTDS MathSpec; they are added to information and residuals in
+         // Estimate().  With more than one thread this is deferred to
+         // AccumulateInformation().
+         for (UnsignedInt k = 0; k < measStat.residual.size(); ++k)
+            accumulator.AddObservation(measStat.hAccum[k], measStat.weight[k],
+                  measStat.residual[k]);
       }
 
       #ifdef DEBUG_ACCUMULATION_RESULTS
@@ -1014,6 +1070,14 @@ void BatchEstimator::Estimate()
       MessageInterface::ShowMessage("BatchEstimator state is ESTIMATING\n");
    #endif
 
+   if (threadCount != 1)
+      AccumulateInformation();
+   else if (accumulator.GetSize() == (Integer)stateSize)
+   {
+      accumulator.AddTo(information, residuals);
+      accumulator.Reset();
+   }
+
    // Plot all residuals
    if (showAllResiduals)
       PlotResiduals();
@@ -1221,6 +1285,70 @@ void BatchEstimator::Estimate()
 }
 
 
+//------------------------------------------------------------------------------
+// void AccumulateInformation()
+//------------------------------------------------------------------------------
+/**
+ * Builds the information matrix and residual vector from the stored
+ * measurement statistics for the iteration.
+ *
+ * This is used in place of the accumulation in Accumulate() when ThreadCount
+ * is not 1.  The records are split into fixed blocks of
+ * ACCUMULATION_BLOCK_SIZE records that are summed in parallel into packed
+ * accumulators, and the block sums are added in block order, so the result
+ * does not depend on the number of threads.
+ */
+//------------------------------------------------------------------------------
+void BatchEstimator::AccumulateInformation()
+{
+   UnsignedInt recordCount = measStats.size();
+   Integer blockCount = (recordCount + ACCUMULATION_BLOCK_SIZE - 1) /
+                        ACCUMULATION_BLOCK_SIZE;
+
+   if (blockCount == 0)
+      return;
+
+   if (workerPool == NULL)
+      workerPool = new WorkerPool(threadCount);
+
+   std::vector<NormalEquationAccumulator> blockSums(blockCount);
+
+   workerPool->Run(blockCount, [&](Integer block, Integer)
+   {
+      NormalEquationAccumulator &sums = blockSums[block];
+      sums.SetSize(stateSize);
+
+      UnsignedInt first = block * ACCUMULATION_BLOCK_SIZE;
+      UnsignedInt last  = first + ACCUMULATION_BLOCK_SIZE;
+      if (last > recordCount)
+         last = recordCount;
+
+      // Same terms as Accumulate()
+      for (UnsignedInt index = first; index < last; ++index)
+      {
+         const MeasurementInfoType &measStat = measStats[index];
+         if (!measStat.isCalculated || (measStat.editFlag != NORMAL_FLAG))
+            continue;
+
+         for (UnsignedInt k = 0; k < measStat.residual.size(); ++k)
+            sums.AddObservation(measStat.hAccum[k], measStat.weight[k],
+                  measStat.residual[k]);
+      }
+      sums.Flush();
+   });
+
+   for (Integer block = 1; block < blockCount; ++block)
+      blockSums[0].Merge(blockSums[block]);
+   blockSums[0].AddTo(information, residuals);
+
+   #ifdef DEBUG_ACCUMULATION
+      MessageInterface::ShowMessage("BatchEstimator::AccumulateInformation() "
+            "summed %d records in %d blocks on %d threads\n", recordCount,
+            blockCount, workerPool->GetThreadCount());
+   #endif
+}
+
+
 //------------------------------------------------------------------------------
 //  Real CalculateWRMS(const UnsignedIntArray &measurementList) const
 //------------------------------------------------------------------------------
@@ -1279,17 +1407,54 @@ Real BatchEstimator::CalculateWRMS(const UnsignedIntArray &measurementList, cons
       count++;
    }
 
-   for (UnsignedInt ii = 0; ii < measurementList.size(); ii++)
+   if (workerPool && (measurementList.size() > ACCUMULATION_BLOCK_SIZE))
    {
-      MeasurementInfoType measStat = measStats[measurementList[ii]];
-      count += measStat.residual.size();
+      // Sum fixed blocks in parallel, then add the block sums in order
+      Integer blockCount = (measurementList.size() + ACCUMULATION_BLOCK_SIZE - 1) /
+                           ACCUMULATION_BLOCK_SIZE;
+      RealArray blockValue(blockCount, 0.0);
+      UnsignedIntArray blockCountN(blockCount, 0);
+
+      workerPool->Run(blockCount, [&](Integer block, Integer)
+      {
+         UnsignedInt first = block * ACCUMULATION_BLOCK_SIZE;
+         UnsignedInt last  = first + ACCUMULATION_BLOCK_SIZE;
+         if (last > measurementList.size())
+            last = measurementList.size();
+
+         for (UnsignedInt ii = first; ii < last; ii++)
+         {
+            const MeasurementInfoType &measStat = measStats[measurementList[ii]];
+            blockCountN[block] += measStat.residual.size();
 
-      for (UnsignedInt jj = 0; jj < measStat.hAccum.size(); jj++)
+            for (UnsignedInt jj = 0; jj < measStat.hAccum.size(); jj++)
+            {
+               Real residualChange = CalculateResidualChange(measStat.hAccum[jj], dx);
+               blockValue[block] += (measStat.residual[jj] - residualChange) * (measStat.residual[jj] - residualChange) * measStat.weight[jj];
+            }
+         }
+      });
+
+      for (Integer block = 0; block < blockCount; ++block)
+      {
+         value += blockValue[block];
+         count += blockCountN[block];
+      }
+   }
+   else
+   {
+      for (UnsignedInt ii = 0; ii < measurementList.size(); ii++)
       {
-         Real residualChange = CalculateResidualChange(measStat.hAccum[jj], dx);
+         const MeasurementInfoType &measStat = measStats[measurementList[ii]];
+         count += measStat.residual.size();
+
+         for (UnsignedInt jj = 0; jj < measStat.hAccum.size(); jj++)
+         {
+            Real residualChange = CalculateResidualChange(measStat.hAccum[jj], dx);
 
-         // The first term in equation 8-185 in GTDS MathSpec
-         value += (measStat.residual[jj] - residualChange) * (measStat.residual[jj] - residualChange) * measStat.weight[jj];
+            // The first term in equation 8-185 in GTDS MathSpec
+            value += (measStat.residual[jj] - residualChange) * (measStat.residual[jj] - residualChange) * measStat.weight[jj];
+         }
       }
    }
 
@@ -1346,6 +1511,7 @@ void BatchEstimator::InnerLoop()
 
       Rmatrix informationIL(stateSize,stateSize);
       Rvector residualsIL(stateSize);
+      NormalEquationAccumulator editedSums(stateSize);
       RealArray dxIL, dxILLast;
 
       // Initialize inner loop with values from outer loop
@@ -1406,11 +1572,12 @@ void BatchEstimator::InnerLoop()
 
             residualsIL[ii] = 0.0;
          }
+         editedSums.Reset();
 
          // Find change in residuals due to dxIL and determine if it should be edited by IL
          for (UnsignedInt ii = 0; ii < indexUsedRecordsOL.size(); ii++)
          {
-            MeasurementInfoType measStat = measStats[indexUsedRecordsOL[ii]];
+            const MeasurementInfoType &measStat = measStats[indexUsedRecordsOL[ii]];
             bool removed = false;
 
             for (UnsignedInt vIndex = 0; vIndex < measStat.hAccum.size(); vIndex++) // Index for each value
@@ -1430,15 +1597,8 @@ void BatchEstimator::InnerLoop()
 
                // Update IL information
                for (UnsignedInt vIndex = 0; vIndex < measStat.hAccum.size(); vIndex++)
-               {
-                  for (UnsignedInt i = 0; i < stateSize; ++i)
-                  {
-                     for (UnsignedInt j = 0; j < stateSize; ++j)
-                        informationIL(i, j) += measStat.hAccum[vIndex][i] * measStat.hAccum[vIndex][j] * measStat.weight[vIndex];
-
-                     residualsIL[i] += measStat.hAccum[vIndex][i] * measStat.weight[vIndex] * measStat.residual[vIndex];
-                  }
-               }
+                  editedSums.AddObservation(measStat.hAccum[vIndex],
+                        measStat.weight[vIndex], measStat.residual[vIndex]);
             }
             else
             {
@@ -1466,6 +1626,7 @@ void BatchEstimator::InnerLoop()
             MessageInterface::ShowMessage("   New Inner Loop RMS = %lf\n", newResidualRMSIL);
          #endif
 
+         editedSums.AddTo(informationIL, residualsIL);
          informationIL = information - informationIL;
          residualsIL = residuals - residualsIL;
 
@@ -1689,7 +1850,7 @@ void BatchEstimator::SolveNormalEquations(const Rmatrix &infMatrix, Rmatrix &cov
       // whereas Cholesky will throw an exception.  If the matrix is poorly conditioned, we want GMAT to stop, rather
       // than to continue processing and give the user a bad result
       Rmatrix testMatrix;
-      CholeskyFactorization cf;
+      BlockCholeskyFactorization cf;
       testMatrix = reducedInfMatrix;
       try {
          cf.Invert(testMatrix);
@@ -1707,7 +1868,7 @@ void BatchEstimator::SolveNormalEquations(const Rmatrix &infMatrix, Rmatrix &cov
    }
    else if (inversionType == "Cholesky")
    {
-      CholeskyFactorization cf;
+      BlockCholeskyFactorization cf;
 
       reducedCovMatrix = reducedInfMatrix;
 
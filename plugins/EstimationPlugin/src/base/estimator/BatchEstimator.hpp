@@ -35,6 +35,9 @@
 
 
 #include "BatchEstimatorBase.hpp"
+#include "NormalEquationAccumulator.hpp"
+
+class WorkerPool;
 //#include "PropSetup.hpp"
 //#include "MeasurementManager.hpp"
 
@@ -65,6 +68,7 @@ public:
    virtual Gmat::ParameterType
                         GetParameterType(const Integer id) const;
    virtual std::string  GetParameterTypeString(const Integer id) const;
+   virtual bool         IsParameterReadOnly(const Integer id) const;
 
    virtual Real         GetRealParameter(const Integer id) const;
    virtual Real         SetRealParameter(const Integer id,
@@ -95,6 +99,7 @@ protected:
       ENABLE_ILSE,
       CONSTANT_MULTIPLIER_ILSE,
       MAX_ITERATIONS_ILSE,
+      THREAD_COUNT,
       BatchEstimatorParamCount
    };
 
@@ -128,9 +133,21 @@ protected:
 
    InnerLoopStatus estimationStatusIL;
 
+   /// Number of threads used to accumulate the normal equations; 1 adds each
+   /// measurement as it is processed, 0 uses all hardware threads
+   Integer threadCount;
+   /// Threads used for deferred accumulation (NULL when threadCount is 1)
+   WorkerPool *workerPool;
+   /// Packed normal equations summed by Accumulate() when threadCount is 1
+   NormalEquationAccumulator accumulator;
+
+   /// Number of measurement records in each deferred accumulation block
+   static const UnsignedInt ACCUMULATION_BLOCK_SIZE;
+
    virtual void            CompleteInitialization();
    virtual void            Accumulate();
    virtual void            Estimate();
+   void                    AccumulateInformation();
    virtual void            InnerLoop();
    virtual void            SolveNormalEquations(const Rmatrix &infMatrix, Rmatrix &covMatrix);
 
@@ -31,6 +31,7 @@
 
 
 #include "BatchEstimatorBase.hpp"
+#include "ParameterIndex.hpp"
 //#include "GmatState.hpp"
 //#include "PropagationStateManager.hpp"
 //#include "EstimatorException.hpp"
@@ -279,11 +280,11 @@ std::string BatchEstimatorBase::GetParameterUnit(const Integer id) const
 //------------------------------------------------------------------------------
 Integer BatchEstimatorBase::GetParameterID(const std::string &str) const
 {
-   for (Integer i = EstimatorParamCount; i < BatchEstimatorBaseParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - EstimatorParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("BatchEstimatorBase",
+         PARAMETER_TEXT, EstimatorParamCount, BatchEstimatorBaseParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
 
    return Estimator::GetParameterID(str);
 }
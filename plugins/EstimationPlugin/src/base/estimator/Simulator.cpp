@@ -30,6 +30,7 @@
 //------------------------------------------------------------------------------
 
 #include "Simulator.hpp"
+#include "ParameterIndex.hpp"
 #include "EstimatorException.hpp"
 #include "GmatState.hpp"
 #include "PropagationStateManager.hpp"
@@ -521,11 +522,11 @@ Integer Simulator::GetParameterID(const std::string &str) const
    if ((str1 == "ShowProgress")||(str1 == "ReportFile")||(str1 == "ReportStyle")||(str1 == "MaximumIterations"))
       throw SolverException("Syntax error: simulator '" + GetName() + "' does not has parameter '" + str1 + "'.\n");
 
-   for (Integer i = SolverParamCount; i < SimulatorParamCount; i++)
-   {
-      if (str1 == PARAMETER_TEXT[i - SolverParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("Simulator", PARAMETER_TEXT,
+         SolverParamCount, SimulatorParamCount);
+   Integer id = parameterIndex.Find(str1);
+   if (id != -1)
+      return id;
 
    return Solver::GetParameterID(str);
 }
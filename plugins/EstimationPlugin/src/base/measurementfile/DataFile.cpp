@@ -32,6 +32,7 @@
 
 
 #include "DataFile.hpp"
+#include "ParameterIndex.hpp"
 #include "DateUtil.hpp"
 #include "GmatBase.hpp"
 #include "MessageInterface.hpp"
@@ -383,11 +384,11 @@ std::string DataFile::GetParameterUnit(const Integer id) const
 //------------------------------------------------------------------------------
 Integer DataFile::GetParameterID(const std::string &str) const
 {
-   for (Integer i = GmatBaseParamCount; i < DataFileParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatBaseParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("DataFile", PARAMETER_TEXT,
+         GmatBaseParamCount, DataFileParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
 
    return GmatBase::GetParameterID(str);
 }
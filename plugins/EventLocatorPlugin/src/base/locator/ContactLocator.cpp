@@ -43,6 +43,10 @@
 #include "EphemManager.hpp"
 #include "StringUtil.hpp"
 #include "ContactEvent.hpp"
+#include "WorkerPool.hpp"
+#include "GmatConstants.hpp"
+#include <cmath>
+#include <algorithm>
 
 //#define DEBUG_SET
 //#define DEBUG_SETREF
@@ -50,6 +54,7 @@
 //#define DEBUG_CONTACT_EVENTS
 //#define DEBUG_INIT_FINALIZE
 //#define DEBUG_CONTACTLOCATOR_INIT
+//#define DEBUG_CONTACT_SCREEN
 
 //------------------------------------------------------------------------------
 // Static data
@@ -74,6 +79,8 @@ const std::string ContactLocator::LT_DIRECTIONS[2] =
    "Receive",
 };
 
+const Integer ContactLocator::SCREEN_CHUNK_SIZE = 50000;
+
 
 //------------------------------------------------------------------------------
 // Public Methods
@@ -1149,48 +1156,65 @@ void ContactLocator::FindEvents()
 
    // Clear old events
    TakeAction("Clear", "Events");
+
    // @YRL
-   for (Integer j = 0; j < stations.size(); j++ )
-   {
-      // We want a ContactResult for each station whether or not there are events
-      ContactResult *evList = new ContactResult();
-      evList->SetObserverName(stations.at(j)->GetName());
+   Integer stationCount = stations.size();
+   StringArray observerIDs(stationCount), obsFrames(stationCount);
+   StringArray centralBodies(stationCount);
+   RealArray minElevations(stationCount);
+   std::vector<StringArray> bodiesToUse(stationCount);
 
-      starts.clear();
-      ends.clear();
+   for (Integer j = 0; j < stationCount; j++ )
+   {
       Integer obsNaifId = stations.at(j)->GetIntegerParameter(
                           stations.at(j)->GetParameterID("NAIFId"));
-      theObsrvr = GmatStringUtil::ToString(obsNaifId);
-      std::string obsFrame = stations.at(j)->GetStringParameter("SpiceFrameId");
-
-      Real  minElAngle  = stations.at(j)->GetRealParameter("MinimumElevationAngle");
+      observerIDs[j]   = GmatStringUtil::ToString(obsNaifId);
+      obsFrames[j]     = stations.at(j)->GetStringParameter("SpiceFrameId");
+      minElevations[j] = stations.at(j)->GetRealParameter("MinimumElevationAngle");
 
       // The ground station's central body should not be an occulting body
-      StringArray bodiesToUse;
       std::string currentBody;
       std::string centralBody = stations.at(j)->GetStringParameter(
                                 stations.at(j)->GetParameterID("CentralBody"));
+      centralBodies[j] = centralBody;
       for (unsigned int ii = 0; ii < occultingBodyNames.size(); ii++)
       {
          currentBody = occultingBodyNames.at(ii);
          if (currentBody == centralBody)
          {
-//            if (!centralBodyWarningWritten)
-//            {
-               MessageInterface::ShowMessage(
-                     "*** WARNING *** Body %s is the central body for "
-                     "GroundStation %s and so will not be considered an occulting body "
-                     "for contact location.\n", centralBody.c_str(),
-                     (stations.at(j)->GetName()).c_str());
-//               centralBodyWarningWritten = true;
-//            }
+            MessageInterface::ShowMessage(
+                  "*** WARNING *** Body %s is the central body for "
+                  "GroundStation %s and so will not be considered an occulting body "
+                  "for contact location.\n", centralBody.c_str(),
+                  (stations.at(j)->GetName()).c_str());
          }
          else
          {
-            bodiesToUse.push_back(currentBody);
+            bodiesToUse[j].push_back(currentBody);
          }
       }
+   }
+
+   // Coarse visibility screen; the fine search below only runs inside the
+   // candidate intervals it finds
+   std::vector<bool>      screened(stationCount, false);
+   std::vector<RealArray> candStarts(stationCount), candEnds(stationCount);
+   if (stationCount > 0)
+      ScreenStations(observerIDs, obsFrames, centralBodies, minElevations,
+                     screened, candStarts, candEnds);
+
+   // The CSPICE searches are not thread safe, so they run in station order
+   bool transmit = (GmatStringUtil::ToUpper(lightTimeDirection) == "TRANSMIT");
+   for (Integer j = 0; j < stationCount; j++ )
+   {
+      // We want a ContactResult for each station whether or not there are events
+      ContactResult *evList = new ContactResult();
+      evList->SetObserverName(stations.at(j)->GetName());
 
+      starts.clear();
+      ends.clear();
+      numContacts = 0;
+      theObsrvr = observerIDs[j];
 
       #ifdef DEBUG_CONTACT_EVENTS
          MessageInterface::ShowMessage("Calling GetContactIntervals with: \n");
@@ -1200,18 +1224,25 @@ void ContactLocator::FindEvents()
           for (Integer ii = 0; ii < occultingBodyNames.size(); ii++)
              MessageInterface::ShowMessage("      %d     %s\n", ii, occultingBodyNames.at(ii).c_str());
           MessageInterface::ShowMessage("   bodiesToUse   = \n");
-           for (Integer ii = 0; ii < bodiesToUse.size(); ii++)
-              MessageInterface::ShowMessage("      %d     %s\n", ii, bodiesToUse.at(ii).c_str());
+           for (Integer ii = 0; ii < bodiesToUse[j].size(); ii++)
+              MessageInterface::ShowMessage("      %d     %s\n", ii, bodiesToUse[j].at(ii).c_str());
          MessageInterface::ShowMessage("   theAbCorr         = %s\n", theAbCorr.c_str());
          MessageInterface::ShowMessage("   initialEp         = %12.10f\n", initialEp);
          MessageInterface::ShowMessage("   finalEp           = %12.10f\n", finalEp);
          MessageInterface::ShowMessage("   useEntireInterval = %s\n", (useEntireInterval? "true" : "false"));
          MessageInterface::ShowMessage("   stepSize          = %12.10f\n", stepSize);
+         MessageInterface::ShowMessage("   screened          = %s, %d candidates\n",
+               (screened[j] ? "true" : "false"), (Integer) candStarts[j].size());
       #endif
-      bool transmit = (GmatStringUtil::ToUpper(lightTimeDirection) == "TRANSMIT");
-      em -> GetContactIntervals(theObsrvr, minElAngle, obsFrame, bodiesToUse, theAbCorr,
-            initialEp, finalEp, useEntireInterval, useLightTimeDelay, transmit, stepSize, numContacts,
-            starts, ends);
+      if (!screened[j])
+         em -> GetContactIntervals(theObsrvr, minElevations[j], obsFrames[j],
+               bodiesToUse[j], theAbCorr, initialEp, finalEp, useEntireInterval,
+               useLightTimeDelay, transmit, stepSize, numContacts, starts, ends);
+      else if (!candStarts[j].empty())
+         em -> GetContactIntervals(theObsrvr, minElevations[j], obsFrames[j],
+               bodiesToUse[j], theAbCorr, initialEp, finalEp, useEntireInterval,
+               useLightTimeDelay, transmit, stepSize, candStarts[j], candEnds[j],
+               numContacts, starts, ends);
       #ifdef DEBUG_CONTACT_EVENTS
          MessageInterface::ShowMessage("After GetContactIntervals: \n");
          MessageInterface::ShowMessage("   numContacts       = %d\n", numContacts);
@@ -1256,3 +1287,188 @@ std::string ContactLocator::GetAbcorrString()
    return correction;
 }
 
+
+//------------------------------------------------------------------------------
+// void ScreenStations(const StringArray &observerIDs,
+//       const StringArray &obsFrames, const StringArray &centralBodies,
+//       const RealArray &minElevations, std::vector<bool> &screened,
+//       std::vector<RealArray> &candStarts, std::vector<RealArray> &candEnds)
+//------------------------------------------------------------------------------
+/**
+ * Finds, for each station, the intervals in which the target might be above
+ * the station's minimum elevation.
+ *
+ * The target position is sampled once per central body at the search step.
+ * Each station then bounds the elevation between consecutive samples by the
+ * mean of the end point elevations plus the angle the line of sight turns
+ * through.  For smooth motion over one step this is twice the margin needed,
+ * matching the assumption of the fine search that no event is shorter than
+ * the step.  Intervals that pass are padded by one step and the largest
+ * light time, and merged.  The station checks are pure geometry and run in
+ * parallel; each station writes only its own lists, so the results do not
+ * depend on the thread count.
+ *
+ * Stations whose geometry is not available are left unscreened, and are
+ * searched over the full window.
+ *
+ * @param observerIDs   NAIF IDs of the stations
+ * @param obsFrames     SPICE topocentric frame names of the stations
+ * @param centralBodies central bodies of the stations
+ * @param minElevations minimum elevation angles, degrees
+ * @param screened      true for each station that was screened (output)
+ * @param candStarts    candidate interval starts, A1Mjd (output)
+ * @param candEnds      candidate interval ends, A1Mjd (output)
+ */
+//------------------------------------------------------------------------------
+void ContactLocator::ScreenStations(const StringArray &observerIDs,
+                                    const StringArray &obsFrames,
+                                    const StringArray &centralBodies,
+                                    const RealArray &minElevations,
+                                    std::vector<bool> &screened,
+                                    std::vector<RealArray> &candStarts,
+                                    std::vector<RealArray> &candEnds)
+{
+   Real intvlStart, intvlStop, cvrStart, cvrStop;
+   if (!em->GetCoverage(initialEp, finalEp, useEntireInterval, true,
+                        intvlStart, intvlStop, cvrStart, cvrStop) ||
+       (intvlStop <= intvlStart) || (stepSize <= 0.0))
+      return;
+
+   Integer stationCount = observerIDs.size();
+   // Allowance for aberration corrections, in radians
+   const Real angleMargin = 1.0e-3;
+   const Real kmPerSec = GmatPhysicalConstants::SPEED_OF_LIGHT_VACUUM *
+                         GmatMathConstants::M_TO_KM;
+   const Real stepDays = stepSize / GmatTimeConstants::SECS_PER_DAY;
+
+   std::vector<Rvector3> locations(stationCount), zeniths(stationCount);
+   RealArray minElRad(stationCount);
+   for (Integer j = 0; j < stationCount; ++j)
+   {
+      screened[j] = em->GetObserverGeometry(observerIDs[j], obsFrames[j],
+            centralBodies[j], intvlStart, locations[j], zeniths[j]);
+      minElRad[j] = minElevations[j] * GmatMathConstants::RAD_PER_DEG;
+   }
+
+   WorkerPool pool;
+   RealArray epochs, positions;
+   Real chunkSpan = (SCREEN_CHUNK_SIZE - 1) * stepDays;
+
+   // Stations on the same body share the samples
+   StringArray bodiesDone;
+   for (Integer first = 0; first < stationCount; ++first)
+   {
+      if (!screened[first] ||
+          (find(bodiesDone.begin(), bodiesDone.end(), centralBodies[first]) !=
+           bodiesDone.end()))
+         continue;
+      const std::string &body = centralBodies[first];
+      bodiesDone.push_back(body);
+
+      IntegerArray group;
+      for (Integer j = first; j < stationCount; ++j)
+         if (screened[j] && (centralBodies[j] == body))
+            group.push_back(j);
+
+      for (Real chunkStart = intvlStart; chunkStart < intvlStop;
+           chunkStart += chunkSpan)
+      {
+         Real chunkEnd = chunkStart + chunkSpan;
+         if (chunkEnd > intvlStop)
+            chunkEnd = intvlStop;
+
+         if (!em->GetBodyFixedPositions(body, chunkStart, chunkEnd, stepSize,
+                                        epochs, positions))
+         {
+            for (UnsignedInt g = 0; g < group.size(); ++g)
+               screened[group[g]] = false;
+            break;
+         }
+
+         Integer sampleCount = epochs.size();
+         pool.Run(group.size(), [&](Integer task, Integer)
+         {
+            Integer j = group[task];
+            const Rvector3 &loc = locations[j];
+            const Rvector3 &up  = zeniths[j];
+            RealArray &starts = candStarts[j];
+            RealArray &ends   = candEnds[j];
+
+            Real lastEl = 0.0, lastRange = 0.0, lastLos[3] = {0.0, 0.0, 0.0};
+            bool lastValid = false;
+            for (Integer k = 0; k < sampleCount; ++k)
+            {
+               const Real *r = &positions[3*k];
+               Real los[3] = {r[0] - loc[0], r[1] - loc[1], r[2] - loc[2]};
+               Real range = std::sqrt(los[0]*los[0] + los[1]*los[1] +
+                                      los[2]*los[2]);
+               bool valid = (range > 0.0) && !std::isnan(range);
+               Real el = 0.0;
+               if (valid)
+               {
+                  for (Integer i = 0; i < 3; ++i)
+                     los[i] /= range;
+                  Real sinEl = los[0]*up[0] + los[1]*up[1] + los[2]*up[2];
+                  el = std::asin(sinEl > 1.0 ? 1.0 : (sinEl < -1.0 ? -1.0 : sinEl));
+               }
+
+               if (k > 0)
+               {
+                  bool candidate = true;
+                  if (valid && lastValid)
+                  {
+                     Real cross[3] = {lastLos[1]*los[2] - lastLos[2]*los[1],
+                                      lastLos[2]*los[0] - lastLos[0]*los[2],
+                                      lastLos[0]*los[1] - lastLos[1]*los[0]};
+                     Real turn = std::atan2(std::sqrt(cross[0]*cross[0] +
+                           cross[1]*cross[1] + cross[2]*cross[2]),
+                           lastLos[0]*los[0] + lastLos[1]*los[1] +
+                           lastLos[2]*los[2]);
+                     candidate = (0.5 * (lastEl + el) + turn + angleMargin >=
+                                  minElRad[j]);
+                  }
+
+                  if (candidate)
+                  {
+                     Real pad = stepDays;
+                     if (useLightTimeDelay)
+                     {
+                        Real maxRange = (range > lastRange ? range : lastRange);
+                        if (!valid || !lastValid)
+                           maxRange = 0.0;
+                        pad += maxRange / kmPerSec /
+                               GmatTimeConstants::SECS_PER_DAY;
+                     }
+                     Real s0 = epochs[k-1] - pad;
+                     Real e0 = epochs[k] + pad;
+                     if (!starts.empty() && (s0 <= ends.back()))
+                     {
+                        if (e0 > ends.back())
+                           ends.back() = e0;
+                     }
+                     else
+                     {
+                        starts.push_back(s0);
+                        ends.push_back(e0);
+                     }
+                  }
+               }
+
+               lastValid = valid;
+               lastEl    = el;
+               lastRange = range;
+               for (Integer i = 0; i < 3; ++i)
+                  lastLos[i] = los[i];
+            }
+         });
+      }
+   }
+
+   #ifdef DEBUG_CONTACT_SCREEN
+      for (Integer j = 0; j < stationCount; ++j)
+         MessageInterface::ShowMessage("ContactLocator::ScreenStations: "
+               "station %s %s, %d candidate intervals\n",
+               observerIDs[j].c_str(), (screened[j] ? "screened" :
+               "not screened"), (Integer) candStarts[j].size());
+   #endif
+}
@@ -163,8 +163,19 @@ protected:
 
     static const std::string LT_DIRECTIONS[2];
 
+    /// Number of samples requested from the EphemManager at a time when
+    /// screening for visibility
+    static const Integer SCREEN_CHUNK_SIZE;
+
     virtual void         FindEvents();
     virtual std::string  GetAbcorrString();
+    void                 ScreenStations(const StringArray &observerIDs,
+                                        const StringArray &obsFrames,
+                                        const StringArray &centralBodies,
+                                        const RealArray &minElevations,
+                                        std::vector<bool> &screened,
+                                        std::vector<RealArray> &candStarts,
+                                        std::vector<RealArray> &candEnds);
 };
 
 #endif /* ContactLocator_hpp */
@@ -33,6 +33,7 @@
 
 
 #include "EclipseLocator.hpp"
+#include "ParameterIndex.hpp"
 #include "SolarSystem.hpp"
 #include "CelestialBody.hpp"
 #include "Star.hpp"
@@ -249,11 +250,11 @@ std::string EclipseLocator::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer EclipseLocator::GetParameterID(const std::string &str) const
 {
-   for (Integer i = EventLocatorParamCount; i < EclipseLocatorParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - EventLocatorParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("EclipseLocator", PARAMETER_TEXT,
+         EventLocatorParamCount, EclipseLocatorParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
 
    return EventLocator::GetParameterID(str);
 }
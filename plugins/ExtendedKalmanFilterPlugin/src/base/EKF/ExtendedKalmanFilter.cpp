@@ -37,7 +37,6 @@
 #include "EstimatorException.hpp"
 #include "MessageInterface.hpp"
 #include "StringUtil.hpp"
-#include "UtilityException.hpp"
 #include <cmath>
 #include <limits>
 
@@ -56,8 +55,6 @@
 //------------------------------------------------------------------------------
 ExtendedKalmanFilter::ExtendedKalmanFilter(const std::string name) :
    SeqEstimator  ("ExtendedKalmanFilter", name),
-   cf(),
-   qr(false),
    calculatedMeas(0),
    currentObs(0)
 {
@@ -92,8 +89,7 @@ ExtendedKalmanFilter::~ExtendedKalmanFilter()
 //------------------------------------------------------------------------------
 ExtendedKalmanFilter::ExtendedKalmanFilter(const ExtendedKalmanFilter & ekf) :
    SeqEstimator  (ekf),
-   cf(),
-   qr(false),
+   kernel        (ekf.kernel),
    calculatedMeas(0),
    currentObs(0)
 {
@@ -118,8 +114,7 @@ ExtendedKalmanFilter& ExtendedKalmanFilter::operator=(const ExtendedKalmanFilter
       SeqEstimator::operator=(ekf);
       measSize = ekf.measSize;
 
-      cf = ekf.cf;
-      qr = ekf.qr;
+      kernel = ekf.kernel;
    }
 
    return *this;
@@ -185,9 +180,7 @@ void ExtendedKalmanFilter::CompleteInitialization()
 
    I = Rmatrix::Identity(stateSize);
 
-   sqrtP_T.SetSize(stateSize, stateSize);
-   sqrtPupdate_T.SetSize(stateSize, stateSize);
-   cf.Factor(*(stateCovariance->GetCovariance()), sqrtP_T);
+   kernel.Initialize(*(stateCovariance->GetCovariance()));
 
    currentObs =  measManager.GetObsData();
    prevUpdateEpochGT = currentEpochGT;
@@ -311,7 +304,7 @@ void ExtendedKalmanFilter::Estimate()
    updateStat.cov = informationInverse;
    updateStat.sigmaVNB = GetCovarianceVNB(informationInverse);
 
-   updateStats.push_back(updateStat);
+   AddUpdateStat(updateStat);
    BuildMeasurementLine(updateStat.measStat);
    WriteDataFile();
    AddMatlabData(updateStat.measStat);
@@ -348,6 +341,10 @@ void ExtendedKalmanFilter::Estimate()
  *
  * This method uses Cholesky factorization for covariance
  * This is based on section 5.7 of Brown and Hwang 4e
+ *
+ * The factor arithmetic is done by the SquareRootFilterKernel, which works
+ * in place and applies the solve-for conversion by triangular solves rather
+ * than an explicit inverse.
  */
  //------------------------------------------------------------------------------
 void ExtendedKalmanFilter::TimeUpdate()
@@ -373,12 +370,6 @@ void ExtendedKalmanFilter::TimeUpdate()
    // Calculate conversion derivative matrix [dS/dK] from solve-for state to Keplerian
    solv2KeplMatrix = esm.SolveForStateToKeplConversionDerivativeMatrix();
 
-   Rmatrix dX_dS = cart2SolvMatrixPrev;
-   Rmatrix dS_dX = cart2SolvMatrix.Inverse();
-
-   Rmatrix Q_S = dS_dX * Q * dS_dX.Transpose();
-   Rmatrix stm_S = dS_dX * (*stm) * dX_dS;
-
    // Update offset from reference trajectory
    if (esm.HasStateOffset())
    {
@@ -392,117 +383,16 @@ void ExtendedKalmanFilter::TimeUpdate()
          (*offsetState)[i] = xOffset[i];
    }
 
-   // Form C matrix and perform QR decomposition to calculate pBar
-
-   // C = [sqrt(P)^T * Phi^T;
-   //      sqrt(Q)^T];
-   Rmatrix C(2 * stateSize, stateSize);
-   Rmatrix C1 = sqrtP_T * stm_S.Transpose();
-
-   Rmatrix sqrtQ_T(stateSize, stateSize);
-
-   bool hasZeroDiag = false;
-   for (UnsignedInt ii = 0U; ii < stateSize; ii++)
-   {
-      if (Q_S(ii, ii) == 0U)
-      {
-         hasZeroDiag = true;
-         break;
-      }
-   }
-
-   if (!hasZeroDiag)
-   {
-      try
-      {
-         cf.Factor(Q_S, sqrtQ_T);
-      }
-      catch (UtilityException e)
-      {
-         throw EstimatorException("The process noise matrix is not positive definite!");
-      }
-   }
-   else
-   {
-      // Remove all zero rows/columns first
-      IntegerArray removedIndexes;
-      IntegerArray auxVector;
-      Integer numRemoved;
-      Rmatrix reducedQ_S = MatrixFactorization::CompressNormalMatrix(Q_S,
-         removedIndexes, auxVector, numRemoved);
-
-      Rmatrix reducedSqrtQ_T(stateSize - numRemoved, stateSize - numRemoved);
-      try
-      {
-         cf.Factor(reducedQ_S, reducedSqrtQ_T);
-      }
-      catch (UtilityException e)
-      {
-         throw EstimatorException("The process noise matrix is not positive definite!");
-      }
-
-      sqrtQ_T = MatrixFactorization::ExpandNormalMatrixInverse(reducedSqrtQ_T,
-         auxVector, numRemoved);
-   }
-
-   for (UnsignedInt ii = 0U; ii < stateSize; ii++)
-   {
-      for (UnsignedInt jj = 0U; jj < stateSize; jj++)
-      {
-         C(ii, jj) = C1(ii, jj);
-         C(ii + stateSize, jj) = sqrtQ_T(ii, jj);
-      }
-   }
-
-   #ifdef DEBUG_ESTIMATION
-      MessageInterface::ShowMessage("C = \n");
-      for (UnsignedInt i = 0; i < 2 * stateSize; ++i)
-      {
-         for (UnsignedInt j = 0; j < stateSize; ++j)
-         {
-            MessageInterface::ShowMessage("  %.12le", C(i,j));
-         }
-         MessageInterface::ShowMessage("\n");
-      }
-   #endif
-
-   Rmatrix Tc(2 * stateSize, 2 * stateSize);
-   Rmatrix Uc(2 * stateSize, stateSize);
-
-   // Perform QR factorization
-   qr.Factor(C, Uc, Tc);
-
-   #ifdef DEBUG_ESTIMATION
-      MessageInterface::ShowMessage("Uc = \n");
-      for (UnsignedInt i = 0; i < 2 * stateSize; ++i)
-      {
-         for (UnsignedInt j = 0; j < stateSize; ++j)
-         {
-            MessageInterface::ShowMessage("  %.12le", Uc(i,j));
-         }
-         MessageInterface::ShowMessage("\n");
-      }
-   #endif
-
-   // Get sqrt(PBar)^T from top haplf of Uc
-   for (UnsignedInt ii = 0U; ii < stateSize; ii++)
-      for (UnsignedInt jj = 0U; jj < stateSize; jj++)
-         sqrtP_T(ii, jj) = Uc(ii, jj);
+   // Triangularize C = [sqrt(P)^T * Phi^T; sqrt(Q)^T], with Phi and Q
+   // converted to the solve-for state; the top of the result is sqrt(PBar)^T
+   kernel.TimeUpdate(*stm, Q, cart2SolvMatrixPrev, cart2SolvMatrix);
 
    // Warn if covariance is not positive definite
-   for (UnsignedInt ii = 0U; ii < stateSize; ii++)
-   {
-      if (GmatMathUtil::Abs(sqrtP_T(ii, ii)) < 1e-16)
-      {
-         MessageInterface::ShowMessage("WARNING The covariance is no longer positive definite! Epoch = %s\n", currentEpochGT.ToString().c_str());
-         break;
-      }
-   }
-
-   pBar = sqrtP_T.Transpose() * sqrtP_T;
+   if (kernel.GetMinimumDiagonal() < 1e-16)
+      MessageInterface::ShowMessage("WARNING The covariance is no longer positive definite! Epoch = %s\n", currentEpochGT.ToString().c_str());
 
-   // make it symmetric!
-   Symmetrize(pBar);
+   // Symmetric by construction
+   kernel.GetCovariance(pBar);
 }
 
 //------------------------------------------------------------------------------
@@ -542,7 +432,10 @@ void ExtendedKalmanFilter::SetupMeas()
 
       H.SetSize(measSize, stateSize);
       yi.SetSize(measSize);
-      kalman.SetSize(stateSize, measSize);
+      // The gain is overwritten by each update, so keep its storage
+      if ((kalman.GetNumRows() != (Integer)stateSize) ||
+          (kalman.GetNumColumns() != (Integer)measSize))
+         kalman.SetSize(stateSize, measSize);
    }
 
    /// Calculate conversion derivative matrixes
@@ -592,17 +485,25 @@ void ExtendedKalmanFilter::ComputeObs(UpdateInfoType &updateStat)
       }
 
       // get scaled residuals
-      Rmatrix R = *(GetMeasurementCovariance()->GetCovariance());
+      const Rmatrix &R = *(GetMeasurementCovariance()->GetCovariance());
 
       // Keep this line for when we implement the scaled residual for the entire measurement
       // instead of for each element of the measurement:
       // measStat.scaledResid = GmatMathUtil::Sqrt(yi * (H * pBar * H.Transpose() + R).Inverse() * yi);
 
-      // The element-by-element scaled residual calculation:
+      // The element-by-element scaled residual calculation, using only the
+      // diagonal of H * pBar * H^T + R:
       for (UnsignedInt k = 0; k < measStat.residual.size(); ++k)
       {
-         Rmatrix Rbar = H * pBar * H.Transpose() + R;
-         Real sigmaVal = GmatMathUtil::Sqrt(Rbar(k, k));
+         Real variance = R(k, k);
+         for (UnsignedInt ii = 0U; ii < stateSize; ii++)
+         {
+            Real hP = 0.0;
+            for (UnsignedInt jj = 0U; jj < stateSize; jj++)
+               hP += H(k, jj) * pBar(jj, ii);
+            variance += hP * H(k, ii);
+         }
+         Real sigmaVal = GmatMathUtil::Sqrt(variance);
          Real scaledResid = measStat.residual[k] / sigmaVal;
          measStat.scaledResid.push_back(scaledResid);
       }
@@ -662,88 +563,20 @@ void ExtendedKalmanFilter::ComputeGain(UpdateInfoType &updateStat)
          MessageInterface::ShowMessage("Computing Kalman Gain\n");
       #endif
 
-      // Form A matrix and perform QR decomposition to calculate K and P
-      Rmatrix R = *(GetMeasurementCovariance()->GetCovariance());
-      Integer measSize = R.GetNumRows();
-
+      // Triangularize A to calculate K and sqrt(P)^T:
       // A = [sqrt(R)^T,        0;
       //      sqrt(PBar)^T*H^T, sqrt(PBar)^T];
-      Rmatrix A(measSize + stateSize, measSize + stateSize);
-
-      Rmatrix sqrtR_T(measSize, measSize);
-      cf.Factor(R, sqrtR_T);
-
-      Rmatrix A21 = sqrtP_T * H.Transpose();
-
-      // Populate A
-      // Top block
-      for (UnsignedInt ii = 0U; ii < measSize; ii++)
-         for (UnsignedInt jj = 0U; jj < measSize; jj++)
-            A(ii, jj) = sqrtR_T(ii, jj);
-
-      // Bottom block
-      for (UnsignedInt ii = 0U; ii < stateSize; ii++)
-      {
-         // Left block
-         for (UnsignedInt jj = 0U; jj < measSize; jj++)
-            A(measSize + ii, jj) = A21(ii, jj);
-
-         // Right block
-         for (UnsignedInt jj = 0U; jj < stateSize; jj++)
-            A(measSize + ii, measSize + jj) = sqrtP_T(ii, jj);
-      }
-
-      #ifdef DEBUG_ESTIMATION
-         MessageInterface::ShowMessage("A = \n");
-         for (UnsignedInt i = 0; i < measSize + stateSize; ++i)
-         {
-           for (UnsignedInt j = 0; j < measSize + stateSize; ++j)
-           {
-             MessageInterface::ShowMessage("  %.12le", A(i,j));
-           }
-           MessageInterface::ShowMessage("\n");
-         }
-      #endif
-
-      Rmatrix Ta(measSize + stateSize, measSize + stateSize);
-      Rmatrix Ua(measSize + stateSize, measSize + stateSize);
-
-      // Perform QR factorization
-      qr.Factor(A, Ua, Ta);
-
-      #ifdef DEBUG_ESTIMATION
-         MessageInterface::ShowMessage("Ua = \n");
-         for (UnsignedInt i = 0; i < measSize + stateSize; ++i)
-         {
-           for (UnsignedInt j = 0; j < measSize + stateSize; ++j)
-           {
-             MessageInterface::ShowMessage("  %.12le", Ua(i,j));
-           }
-           MessageInterface::ShowMessage("\n");
-         }
-      #endif
-
-      Rmatrix sqrtB_T(measSize, measSize);
-      Rmatrix W_T(measSize, stateSize);
-
-      // Populate result matricies
-      for (UnsignedInt ii = 0U; ii < measSize; ii++)
-         for (UnsignedInt jj = 0U; jj < measSize; jj++)
-            sqrtB_T(ii, jj) = Ua(ii, jj);
-
-      for (UnsignedInt ii = 0U; ii < measSize; ii++)
-         for (UnsignedInt jj = 0U; jj < stateSize; jj++)
-            W_T(ii, jj) = Ua(ii, measSize + jj);
-
-      for (UnsignedInt ii = 0U; ii < stateSize; ii++)
-         for (UnsignedInt jj = 0U; jj < stateSize; jj++)
-            sqrtPupdate_T(ii, jj) = Ua(measSize + ii, measSize + jj);
+      //
+      // The kernel zeroes the lower left block with Givens rotations, which
+      // take O(n^2) work for a scalar measurement, and finds the gain from
+      // the triangular result by back substitution.
+      kernel.MeasurementUpdate(H, *(GetMeasurementCovariance()->GetCovariance()));
 
       #ifdef DEBUG_ESTIMATION
          MessageInterface::ShowMessage("Calculating the Kalman gain\n");
       #endif
 
-      kalman = W_T.Transpose() * sqrtB_T.Transpose().Inverse();
+      kernel.GetGain(kalman);
       updateStat.measStat.kalmanGain.SetSize(kalman.GetNumRows(), kalman.GetNumColumns());
       updateStat.measStat.kalmanGain = kalman;
    }
@@ -768,7 +601,7 @@ void ExtendedKalmanFilter::UpdateElements(UpdateInfoType &updateStat)
 
    if (updateStat.measStat.editFlag == NORMAL_FLAG)
    {
-      dx = kalman * yi;
+      kernel.ApplyGain(yi, dx);
 
       if (esm.HasStateOffset())
       {
@@ -805,27 +638,19 @@ void ExtendedKalmanFilter::UpdateElements(UpdateInfoType &updateStat)
       // UpdateCovarianceSimple();
       // UpdateCovarianceJoseph();
 
-      Rmatrix P2 = sqrtPupdate_T.Transpose() * sqrtPupdate_T;
-      sqrtP_T = sqrtPupdate_T;
+      kernel.AcceptUpdate();
 
       // Warn if covariance is not positive definite
-      for (UnsignedInt ii = 0U; ii < stateSize; ii++)
-      {
-         if (GmatMathUtil::Abs(sqrtP_T(ii, ii)) < 1e-16)
-         {
-            MessageInterface::ShowMessage("WARNING The covariance is no longer positive definite! Epoch = %s\n", currentEpochGT.ToString().c_str());
-            break;
-         }
-      }
-
-      (*(stateCovariance->GetCovariance())) = P2;
+      if (kernel.GetMinimumDiagonal() < 1e-16)
+         MessageInterface::ShowMessage("WARNING The covariance is no longer positive definite! Epoch = %s\n", currentEpochGT.ToString().c_str());
    }
-   else
-      (*(stateCovariance->GetCovariance())) = sqrtP_T.Transpose() * sqrtP_T;
 
-   Symmetrize(*stateCovariance);
+   // P = sqrt(P)^T * sqrt(P) is symmetric by construction, and its inverse
+   // comes from the inverse of the triangular factor
+   kernel.GetCovariance(*(stateCovariance->GetCovariance()));
    informationInverse = (*(stateCovariance->GetCovariance()));
-   information = informationInverse.Inverse(COV_INV_TOL);
+   if (!kernel.GetInformation(information, COV_INV_TOL))
+      information = informationInverse.Inverse(COV_INV_TOL);
 }
 
 
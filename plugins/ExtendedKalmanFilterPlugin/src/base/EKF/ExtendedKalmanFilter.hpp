@@ -35,8 +35,7 @@
 
 #include "kalman_defs.hpp"
 #include "SeqEstimator.hpp"
-#include "CholeskyFactorization.hpp"
-#include "QRFactorization.hpp"
+#include "SquareRootFilterKernel.hpp"
 
 
 /**
@@ -75,13 +74,8 @@ protected:
    /// The Kalman gain
    Rmatrix                 kalman;
 
-   // Fatorization classes
-   CholeskyFactorization   cf;
-   QRFactorization         qr;
-
-   // Factorization variables
-   Rmatrix                 sqrtP_T;
-   Rmatrix                 sqrtPupdate_T;
+   /// The square root covariance factor and its update arithmetic
+   SquareRootFilterKernel  kernel;
 
    virtual void            CompleteInitialization();
    virtual void            Estimate();
@@ -0,0 +1,656 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                              FilterHistory
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/16
+//
+/**
+ * Implements FilterHistory, the store for the per-step records of a
+ * sequential estimator.
+ */
+//------------------------------------------------------------------------------
+
+#include "FilterHistory.hpp"
+#include "MemoryMappedFile.hpp"
+#include "EstimatorException.hpp"
+#include "MessageInterface.hpp"
+
+#include <cstring>
+
+//#define DEBUG_FILTER_HISTORY
+
+//------------------------------------------------------------------------------
+// FilterHistory()
+//------------------------------------------------------------------------------
+/**
+ * Default constructor; the history keeps every record in memory
+ */
+//------------------------------------------------------------------------------
+FilterHistory::FilterHistory() :
+   checkpointInterval   (1),
+   pageUsed             (0),
+   spillFileName        (""),
+   spillFile            (NULL),
+   spillUsed            (0),
+   spillMap             (new MemoryMappedFile()),
+   rebuildStart         (-1)
+{
+}
+
+
+//------------------------------------------------------------------------------
+// ~FilterHistory()
+//------------------------------------------------------------------------------
+/**
+ * Destructor; removes the spill file, if one was written
+ */
+//------------------------------------------------------------------------------
+FilterHistory::~FilterHistory()
+{
+   Clear();
+   delete spillMap;
+}
+
+
+//------------------------------------------------------------------------------
+// void SetCheckpointInterval(UnsignedInt interval)
+//------------------------------------------------------------------------------
+/**
+ * Sets how often a time update record keeps its covariance
+ *
+ * The interval applies to records added after the call.
+ *
+ * @param interval The number of records between stored covariances; 1 keeps
+ *                 every covariance
+ */
+//------------------------------------------------------------------------------
+void FilterHistory::SetCheckpointInterval(UnsignedInt interval)
+{
+   checkpointInterval = (interval < 1 ? 1 : interval);
+}
+
+
+//------------------------------------------------------------------------------
+// UnsignedInt GetCheckpointInterval() const
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the checkpoint interval
+ *
+ * @return The number of records between stored covariances
+ */
+//------------------------------------------------------------------------------
+UnsignedInt FilterHistory::GetCheckpointInterval() const
+{
+   return checkpointInterval;
+}
+
+
+//------------------------------------------------------------------------------
+// void SetSpillFile(const std::string &fileName)
+//------------------------------------------------------------------------------
+/**
+ * Sets the file that receives the matrix blocks
+ *
+ * The file is created when the first record is added, and removed when the
+ * history is cleared or destroyed.  Changing the file clears the history.
+ *
+ * @param fileName The file to write; an empty string keeps the blocks in
+ *                 memory
+ */
+//------------------------------------------------------------------------------
+void FilterHistory::SetSpillFile(const std::string &fileName)
+{
+   if (fileName != spillFileName)
+   {
+      Clear();
+      spillFileName = fileName;
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// const std::string& GetSpillFile() const
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the spill file name
+ *
+ * @return The file name, or an empty string if the blocks are in memory
+ */
+//------------------------------------------------------------------------------
+const std::string& FilterHistory::GetSpillFile() const
+{
+   return spillFileName;
+}
+
+
+//------------------------------------------------------------------------------
+// void Add(const SeqEstimator::UpdateInfoType &info, bool continuesChain)
+//------------------------------------------------------------------------------
+/**
+ * Appends a record
+ *
+ * @param info The record
+ * @param continuesChain true if the record's STM and process noise map the
+ *                       previous record's covariance to this record's prior
+ *                       covariance; false if the covariance was changed in
+ *                       between, so this record must be a checkpoint
+ */
+//------------------------------------------------------------------------------
+void FilterHistory::Add(const SeqEstimator::UpdateInfoType &info,
+      bool continuesChain)
+{
+   RecordLayout layout;
+   layout.covSize     = info.cov.GetNumRows();
+   layout.priorSize   = (info.isObs ? info.measStat.cov.GetNumRows() : 0);
+   layout.noiseSize   = info.processNoise.GetNumRows();
+   layout.noiseStored = 0;
+   layout.stmRows     = info.stm.GetNumRows();
+   layout.stmCols     = info.stm.GetNumColumns();
+   layout.gainRows    = info.measStat.kalmanGain.GetNumRows();
+   layout.gainCols    = info.measStat.kalmanGain.GetNumColumns();
+
+   // Trailing rows of zeros in the process noise are not stored
+   for (UnsignedInt i = layout.noiseSize; i > 0; --i)
+   {
+      for (UnsignedInt j = 0; j < layout.noiseSize; ++j)
+      {
+         if (info.processNoise(i-1, j) != 0.0)
+         {
+            layout.noiseStored = i;
+            break;
+         }
+      }
+      if (layout.noiseStored > 0)
+         break;
+   }
+
+   // The dropped matrices can only be rebuilt from a square STM and process
+   // noise that match the previous covariance
+   bool canRebuild = continuesChain && (checkpointInterval > 1) &&
+         !layouts.empty() && (layouts.back().covSize == layout.covSize) &&
+         (layout.stmRows == layout.covSize) &&
+         (layout.stmCols == layout.covSize) &&
+         ((layout.noiseSize == 0) || (layout.noiseSize == layout.covSize));
+
+   layout.hasCov = !canRebuild || info.isObs ||
+         (summaries.size() % checkpointInterval == 0);
+   layout.hasPrior = (layout.priorSize > 0) && !canRebuild;
+
+   RealArray block;
+   block.reserve((layout.hasCov ? PackedSize(layout.covSize) : 0) +
+         (layout.hasPrior ? PackedSize(layout.priorSize) : 0) +
+         PackedSize(layout.noiseStored) + layout.stmRows * layout.stmCols +
+         layout.gainRows * layout.gainCols);
+   if (layout.hasCov)
+      Pack(info.cov, layout.covSize, block);
+   if (layout.hasPrior)
+      Pack(info.measStat.cov, layout.priorSize, block);
+   Pack(info.processNoise, layout.noiseStored, block);
+   Copy(info.stm, block);
+   Copy(info.measStat.kalmanGain, block);
+
+   Store(block, layout);
+   layouts.push_back(layout);
+
+   // The summary keeps everything but the matrices
+   summaries.push_back(SeqEstimator::UpdateInfoType());
+   SeqEstimator::UpdateInfoType &summary = summaries.back();
+   summary.epoch    = info.epoch;
+   summary.isObs    = info.isObs;
+   summary.measStat = info.measStat;
+   summary.measStat.cov.SetSize(0, 0);
+   summary.measStat.kalmanGain.SetSize(0, 0);
+   summary.state    = info.state;
+   summary.sigmaVNB = info.sigmaVNB;
+
+   #ifdef DEBUG_FILTER_HISTORY
+      MessageInterface::ShowMessage("FilterHistory::Add record %d: %d values, "
+            "cov %s, prior %s\n", (Integer)(summaries.size() - 1),
+            (Integer)block.size(), (layout.hasCov ? "stored" : "dropped"),
+            (layout.hasPrior ? "stored" : "dropped"));
+   #endif
+}
+
+
+//------------------------------------------------------------------------------
+// void Clear()
+//------------------------------------------------------------------------------
+/**
+ * Removes all records, releasing their memory and the spill file
+ */
+//------------------------------------------------------------------------------
+void FilterHistory::Clear()
+{
+   std::vector<SeqEstimator::UpdateInfoType>().swap(summaries);
+   std::vector<RecordLayout>().swap(layouts);
+   std::vector<RealArray>().swap(pages);
+   pageUsed = 0;
+
+   CloseSpillFile();
+   spillMap->Close();
+   if (spillUsed > 0)
+      std::remove(spillFileName.c_str());
+   spillUsed = 0;
+
+   rebuildStart = -1;
+   std::vector<Rmatrix>().swap(rebuilt);
+}
+
+
+//------------------------------------------------------------------------------
+// UnsignedInt GetSize() const
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the number of records
+ *
+ * @return The record count
+ */
+//------------------------------------------------------------------------------
+UnsignedInt FilterHistory::GetSize() const
+{
+   return summaries.size();
+}
+
+
+//------------------------------------------------------------------------------
+// bool IsEmpty() const
+//------------------------------------------------------------------------------
+/**
+ * Checks for an empty history
+ *
+ * @return true if there are no records
+ */
+//------------------------------------------------------------------------------
+bool FilterHistory::IsEmpty() const
+{
+   return summaries.empty();
+}
+
+
+//------------------------------------------------------------------------------
+// const SeqEstimator::UpdateInfoType& GetSummary(UnsignedInt index) const
+//------------------------------------------------------------------------------
+/**
+ * Retrieves a record without its matrices
+ *
+ * The covariance, process noise and STM of the returned record, and the
+ * covariance and Kalman gain of its measurement statistics, are empty.
+ *
+ * @param index The record index
+ *
+ * @return The record summary
+ */
+//------------------------------------------------------------------------------
+const SeqEstimator::UpdateInfoType& FilterHistory::GetSummary(
+      UnsignedInt index) const
+{
+   if (index >= summaries.size())
+      throw EstimatorException("Filter history record index out of range");
+   return summaries[index];
+}
+
+
+//------------------------------------------------------------------------------
+// void Get(UnsignedInt index, SeqEstimator::UpdateInfoType &info)
+//------------------------------------------------------------------------------
+/**
+ * Retrieves a complete record
+ *
+ * @param index The record index
+ * @param info  The record, with all of its matrices
+ */
+//------------------------------------------------------------------------------
+void FilterHistory::Get(UnsignedInt index, SeqEstimator::UpdateInfoType &info)
+{
+   const SeqEstimator::UpdateInfoType &summary = GetSummary(index);
+   const RecordLayout &layout = layouts[index];
+
+   info.epoch    = summary.epoch;
+   info.isObs    = summary.isObs;
+   info.measStat = summary.measStat;
+   info.state    = summary.state;
+   info.sigmaVNB = summary.sigmaVNB;
+
+   // Rebuilt matrices first; rebuilding can remap the spill file
+   if (!layout.hasCov)
+   {
+      info.cov.SetSize(layout.covSize, layout.covSize);
+      info.cov = GetRebuilt(index);
+   }
+   if (!layout.hasPrior)
+   {
+      info.measStat.cov.SetSize(layout.priorSize, layout.priorSize);
+      if (layout.priorSize > 0)
+         info.measStat.cov = GetRebuilt(index);
+   }
+
+   const Real *values = GetBlock(layout);
+   if (layout.hasCov)
+   {
+      Unpack(values, layout.covSize, layout.covSize, info.cov);
+      values += PackedSize(layout.covSize);
+   }
+   if (layout.hasPrior)
+   {
+      Unpack(values, layout.priorSize, layout.priorSize, info.measStat.cov);
+      values += PackedSize(layout.priorSize);
+   }
+   Unpack(values, layout.noiseSize, layout.noiseStored, info.processNoise);
+   values += PackedSize(layout.noiseStored);
+   Copy(values, layout.stmRows, layout.stmCols, info.stm);
+   values += layout.stmRows * layout.stmCols;
+   Copy(values, layout.gainRows, layout.gainCols, info.measStat.kalmanGain);
+}
+
+
+//------------------------------------------------------------------------------
+// std::size_t PackedSize(UnsignedInt n)
+//------------------------------------------------------------------------------
+/**
+ * Number of values in the upper triangle of an n x n matrix
+ */
+//------------------------------------------------------------------------------
+std::size_t FilterHistory::PackedSize(UnsignedInt n)
+{
+   return (std::size_t)n * (n + 1) / 2;
+}
+
+
+//------------------------------------------------------------------------------
+// void Pack(const Rmatrix &mat, UnsignedInt rows, RealArray &block)
+//------------------------------------------------------------------------------
+/**
+ * Appends the upper triangle of the leading rows x rows block of a symmetric
+ * matrix, row by row
+ */
+//------------------------------------------------------------------------------
+void FilterHistory::Pack(const Rmatrix &mat, UnsignedInt rows,
+      RealArray &block)
+{
+   for (UnsignedInt i = 0; i < rows; ++i)
+      for (UnsignedInt j = i; j < rows; ++j)
+         block.push_back(mat(i, j));
+}
+
+
+//------------------------------------------------------------------------------
+// void Unpack(const Real *values, UnsignedInt n, UnsignedInt rows,
+//             Rmatrix &mat)
+//------------------------------------------------------------------------------
+/**
+ * Fills an n x n symmetric matrix from packed values that cover its leading
+ * rows x rows block; the other elements are zero
+ */
+//------------------------------------------------------------------------------
+void FilterHistory::Unpack(const Real *values, UnsignedInt n,
+      UnsignedInt rows, Rmatrix &mat)
+{
+   mat.SetSize(n, n);
+   for (UnsignedInt i = 0; i < rows; ++i)
+   {
+      for (UnsignedInt j = i; j < rows; ++j)
+      {
+         mat(i, j) = *values;
+         mat(j, i) = *values;
+         ++values;
+      }
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void Copy(const Rmatrix &mat, RealArray &block)
+//------------------------------------------------------------------------------
+/**
+ * Appends a matrix, row by row
+ */
+//------------------------------------------------------------------------------
+void FilterHistory::Copy(const Rmatrix &mat, RealArray &block)
+{
+   Integer rows = mat.GetNumRows(), cols = mat.GetNumColumns();
+   for (Integer i = 0; i < rows; ++i)
+      for (Integer j = 0; j < cols; ++j)
+         block.push_back(mat(i, j));
+}
+
+
+//------------------------------------------------------------------------------
+// void Copy(const Real *values, UnsignedInt rows, UnsignedInt cols,
+//           Rmatrix &mat)
+//------------------------------------------------------------------------------
+/**
+ * Fills a matrix from values stored row by row
+ */
+//------------------------------------------------------------------------------
+void FilterHistory::Copy(const Real *values, UnsignedInt rows,
+      UnsignedInt cols, Rmatrix &mat)
+{
+   mat.SetSize(rows, cols);
+   for (UnsignedInt i = 0; i < rows; ++i)
+      for (UnsignedInt j = 0; j < cols; ++j)
+         mat(i, j) = *(values++);
+}
+
+
+//------------------------------------------------------------------------------
+// void Store(const RealArray &block, RecordLayout &layout)
+//------------------------------------------------------------------------------
+/**
+ * Saves a record's block in the pages or the spill file, and sets its
+ * location in the layout
+ */
+//------------------------------------------------------------------------------
+void FilterHistory::Store(const RealArray &block, RecordLayout &layout)
+{
+   layout.page = 0;
+
+   if (spillFileName == "")
+   {
+      if (pages.empty() || (pageUsed + block.size() > pages.back().size()))
+      {
+         pages.push_back(RealArray(block.size() > PAGE_SIZE ?
+               block.size() : PAGE_SIZE));
+         pageUsed = 0;
+      }
+
+      layout.page = pages.size() - 1;
+      layout.offset = pageUsed;
+      if (!block.empty())
+         memcpy(&pages.back()[pageUsed], &block[0],
+               block.size() * sizeof(Real));
+      pageUsed += block.size();
+      return;
+   }
+
+   if (spillFile == NULL)
+   {
+      // The mapping must be released before the file can grow on Windows
+      spillMap->Close();
+      spillFile = fopen(spillFileName.c_str(), (spillUsed == 0 ? "wb" : "ab"));
+      if (spillFile == NULL)
+         throw EstimatorException("Unable to open the filter history file " +
+               spillFileName);
+   }
+
+   layout.offset = spillUsed;
+   if (!block.empty())
+   {
+      if (fwrite(&block[0], sizeof(Real), block.size(), spillFile) !=
+            block.size())
+         throw EstimatorException("Unable to write to the filter history "
+               "file " + spillFileName);
+   }
+   spillUsed += block.size();
+}
+
+
+//------------------------------------------------------------------------------
+// const Real* GetBlock(const RecordLayout &layout)
+//------------------------------------------------------------------------------
+/**
+ * Locates a record's block
+ *
+ * For spill files, the pointer is valid until the next call, which may remap
+ * the file.
+ *
+ * @return A pointer to the first value of the block
+ */
+//------------------------------------------------------------------------------
+const Real* FilterHistory::GetBlock(const RecordLayout &layout)
+{
+   if (spillFileName == "")
+      return (pages.empty() ? NULL : &pages[layout.page][0] + layout.offset);
+
+   std::size_t end = layout.offset + PackedSize(layout.noiseStored) +
+         (layout.hasCov ? PackedSize(layout.covSize) : 0) +
+         (layout.hasPrior ? PackedSize(layout.priorSize) : 0) +
+         layout.stmRows * layout.stmCols + layout.gainRows * layout.gainCols;
+
+   if (!spillMap->IsOpen() || (end * sizeof(Real) > spillMap->GetSize()))
+   {
+      // Flush the pending writes, then map everything written so far
+      CloseSpillFile();
+      spillMap->Close();
+      if ((spillUsed > 0) && !spillMap->Open(spillFileName))
+         throw EstimatorException("Unable to read the filter history file " +
+               spillFileName);
+
+      #ifdef DEBUG_FILTER_HISTORY
+         MessageInterface::ShowMessage("FilterHistory mapped %d bytes of %s\n",
+               (Integer)spillMap->GetSize(), spillFileName.c_str());
+      #endif
+   }
+
+   if (!spillMap->IsOpen())
+      return NULL;
+   return (const Real*)spillMap->GetData() + layout.offset;
+}
+
+
+//------------------------------------------------------------------------------
+// void CloseSpillFile()
+//------------------------------------------------------------------------------
+/**
+ * Closes the spill file output stream, if it is open
+ */
+//------------------------------------------------------------------------------
+void FilterHistory::CloseSpillFile()
+{
+   if (spillFile != NULL)
+   {
+      fclose(spillFile);
+      spillFile = NULL;
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void Rebuild(UnsignedInt index)
+//------------------------------------------------------------------------------
+/**
+ * Rebuilds the dropped covariances of the run of records containing index
+ *
+ * The run starts after the last record before index that stored its
+ * covariance, and ends at the next record that stored its covariance.  Each
+ * record's prior covariance is Phi P Phi^T + Q, where P is the previous
+ * record's covariance; for time updates the prior is also the covariance.
+ *
+ * @param index The record that needs a rebuilt covariance
+ */
+//------------------------------------------------------------------------------
+void FilterHistory::Rebuild(UnsignedInt index)
+{
+   // Record 0 is always a checkpoint
+   UnsignedInt anchor = index - 1;
+   while ((anchor > 0) && !layouts[anchor].hasCov)
+      --anchor;
+
+   Rmatrix cov;
+   Unpack(GetBlock(layouts[anchor]), layouts[anchor].covSize,
+         layouts[anchor].covSize, cov);
+
+   rebuilt.clear();
+   rebuildStart = anchor + 1;
+
+   Rmatrix noise, stm;
+   for (UnsignedInt i = anchor + 1; i < layouts.size(); ++i)
+   {
+      const RecordLayout &layout = layouts[i];
+
+      // A checkpoint that also kept its prior ends the run
+      if (layout.hasCov && (layout.hasPrior || (layout.priorSize == 0)))
+         break;
+
+      const Real *values = GetBlock(layout);
+      if (layout.hasCov)
+         values += PackedSize(layout.covSize);
+      if (layout.hasPrior)
+         values += PackedSize(layout.priorSize);
+      Unpack(values, layout.noiseSize, layout.noiseStored, noise);
+      values += PackedSize(layout.noiseStored);
+      Copy(values, layout.stmRows, layout.stmCols, stm);
+
+      Rmatrix prior = stm * cov * stm.Transpose();
+      if (layout.noiseSize > 0)
+         prior += noise;
+
+      // Symmetrize, as the filter does
+      for (UnsignedInt r = 0; r < layout.covSize; ++r)
+      {
+         for (UnsignedInt c = r + 1; c < layout.covSize; ++c)
+         {
+            Real value = 0.5 * (prior(r, c) + prior(c, r));
+            prior(r, c) = value;
+            prior(c, r) = value;
+         }
+      }
+
+      rebuilt.push_back(prior);
+      if (layout.hasCov)
+         break;
+      cov = prior;
+   }
+
+   #ifdef DEBUG_FILTER_HISTORY
+      MessageInterface::ShowMessage("FilterHistory rebuilt records %d to %d\n",
+            rebuildStart, rebuildStart + (Integer)rebuilt.size() - 1);
+   #endif
+}
+
+
+//------------------------------------------------------------------------------
+// const Rmatrix& GetRebuilt(UnsignedInt index)
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the rebuilt covariance of a record, rebuilding its run if needed
+ *
+ * @param index The record index
+ *
+ * @return The covariance for time updates, the prior covariance for
+ *         measurements
+ */
+//------------------------------------------------------------------------------
+const Rmatrix& FilterHistory::GetRebuilt(UnsignedInt index)
+{
+   if ((rebuildStart < 0) || ((Integer)index < rebuildStart) ||
+       ((Integer)index >= rebuildStart + (Integer)rebuilt.size()))
+      Rebuild(index);
+   return rebuilt[index - rebuildStart];
+}
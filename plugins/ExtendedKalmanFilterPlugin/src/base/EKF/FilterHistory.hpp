@@ -0,0 +1,164 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                              FilterHistory
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/16
+//
+/**
+ * Declares FilterHistory, the store for the per-step records of a sequential
+ * estimator that the smoother reads back.
+ */
+//------------------------------------------------------------------------------
+
+#ifndef FilterHistory_hpp
+#define FilterHistory_hpp
+
+#include "kalman_defs.hpp"
+#include "SeqEstimator.hpp"
+#include <cstdio>
+
+class MemoryMappedFile;
+
+/**
+ * Compact storage for the SeqEstimator::UpdateInfoType records of a filter run
+ *
+ * Each record is split in two.  The summary (epoch, measurement statistics,
+ * state and VNB sigmas) is kept in memory, so scans over epochs and record
+ * numbers cost no matrix traffic.  The matrices are written to a block of
+ * values: the covariance, the measurement prior covariance and the process
+ * noise in packed upper triangular form, the process noise trimmed to its
+ * last nonzero row, and the STM and Kalman gain in full.  Blocks live in
+ * fixed size in-memory pages, or, when a spill file is set, are appended to
+ * that file and read back through a memory mapping so that the operating
+ * system pages them in and out as the smoother walks the history.
+ *
+ * With a checkpoint interval k > 1, only every k-th time update record keeps
+ * its covariance, and measurement records keep only their updated
+ * covariance.  The dropped matrices are rebuilt from the last stored
+ * covariance as P = Phi P Phi^T + Q, using the STM and process noise stored
+ * with every record.  A rebuild fills the whole run of records back to the
+ * stored covariance, so walking the history forwards or backwards costs one
+ * propagation per record and holds at most k matrices.  The rebuild only
+ * reproduces the filter when its STM and process noise are expressed in the
+ * solve-for coordinates; the estimator only enables checkpoints in that case.
+ */
+class KALMAN_API FilterHistory
+{
+public:
+   FilterHistory();
+   ~FilterHistory();
+
+   void                 SetCheckpointInterval(UnsignedInt interval);
+   UnsignedInt          GetCheckpointInterval() const;
+   void                 SetSpillFile(const std::string &fileName);
+   const std::string&   GetSpillFile() const;
+
+   void                 Add(const SeqEstimator::UpdateInfoType &info,
+                            bool continuesChain = true);
+   void                 Clear();
+
+   UnsignedInt          GetSize() const;
+   bool                 IsEmpty() const;
+   const SeqEstimator::UpdateInfoType&
+                        GetSummary(UnsignedInt index) const;
+   void                 Get(UnsignedInt index,
+                            SeqEstimator::UpdateInfoType &info);
+
+protected:
+   /// Where a record's matrices are stored, and which were kept
+   struct RecordLayout
+   {
+      /// Page holding the block; unused for spill files
+      std::size_t       page;
+      /// Offset of the block in the page or the spill file, in values
+      std::size_t       offset;
+      /// Dimension of the covariance
+      UnsignedInt       covSize;
+      /// Dimension of the measurement prior covariance, 0 if none
+      UnsignedInt       priorSize;
+      /// Dimension of the process noise, 0 if none
+      UnsignedInt       noiseSize;
+      /// Number of process noise rows stored, the rest are zero
+      UnsignedInt       noiseStored;
+      UnsignedInt       stmRows;
+      UnsignedInt       stmCols;
+      UnsignedInt       gainRows;
+      UnsignedInt       gainCols;
+      /// True if the covariance is in the block
+      bool              hasCov;
+      /// True if the measurement prior covariance is in the block
+      bool              hasPrior;
+   };
+
+   /// Number of records between stored covariances
+   UnsignedInt          checkpointInterval;
+   /// The records without their matrices
+   std::vector<SeqEstimator::UpdateInfoType>
+                        summaries;
+   /// Block locations, one per record
+   std::vector<RecordLayout>
+                        layouts;
+
+   /// In-memory pages of matrix values
+   std::vector<RealArray>
+                        pages;
+   /// Number of values used in the last page
+   std::size_t          pageUsed;
+
+   /// The spill file name; empty to keep the blocks in memory
+   std::string          spillFileName;
+   /// Output stream for the spill file
+   FILE                 *spillFile;
+   /// Number of values written to the spill file
+   std::size_t          spillUsed;
+   /// Read-only mapping of the spill file
+   MemoryMappedFile     *spillMap;
+
+   /// First record covered by the rebuilt covariances, or -1 if none
+   Integer              rebuildStart;
+   /// Covariances (posterior for time updates, prior for measurements)
+   /// rebuilt for records rebuildStart, rebuildStart + 1, ...
+   std::vector<Rmatrix> rebuilt;
+
+   /// Number of values in a page
+   static const std::size_t PAGE_SIZE = 1048576;
+
+   static std::size_t   PackedSize(UnsignedInt n);
+   static void          Pack(const Rmatrix &mat, UnsignedInt rows,
+                             RealArray &block);
+   static void          Unpack(const Real *values, UnsignedInt n,
+                               UnsignedInt rows, Rmatrix &mat);
+   static void          Copy(const Rmatrix &mat, RealArray &block);
+   static void          Copy(const Real *values, UnsignedInt rows,
+                             UnsignedInt cols, Rmatrix &mat);
+
+   void                 Store(const RealArray &block, RecordLayout &layout);
+   const Real*          GetBlock(const RecordLayout &layout);
+   void                 CloseSpillFile();
+   void                 Rebuild(UnsignedInt index);
+   const Rmatrix&       GetRebuilt(UnsignedInt index);
+
+private:
+   // Histories are shared by pointer; copies are not allowed
+   FilterHistory(const FilterHistory &fh);
+   FilterHistory& operator=(const FilterHistory &fh);
+};
+
+#endif // FilterHistory_hpp
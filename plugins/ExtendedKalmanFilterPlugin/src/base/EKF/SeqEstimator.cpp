@@ -30,6 +30,8 @@
 //------------------------------------------------------------------------------
 
 #include "SeqEstimator.hpp"
+#include "FilterHistory.hpp"
+#include "ParameterIndex.hpp"
 
 #include "GmatConstants.hpp"
 #include "FileUtil.hpp"
@@ -88,6 +90,8 @@ SeqEstimator::PARAMETER_TEXT[] =
    "WarmStartEpochFormat",          // The epoch format used by WarmStartEpoch
    "WarmStartEpoch",                // The epoch to initialize the SeqEstimator from based on the InputWarmStartFile
    "OutputWarmStartFile",           // The file to write SeqEstimator data to
+   "FilterHistoryCheckpointInterval", // Records between stored covariances in the filter history
+   "FilterHistoryFile",             // The file the filter history is written to
 };
 
 const Gmat::ParameterType
@@ -100,6 +104,8 @@ SeqEstimator::PARAMETER_TYPE[] =
    Gmat::STRING_TYPE,
    Gmat::STRING_TYPE,
    Gmat::STRING_TYPE,
+   Gmat::INTEGER_TYPE,
+   Gmat::STRING_TYPE,
 };
 // End EKF mod
 
@@ -128,7 +134,11 @@ SeqEstimator::SeqEstimator(const std::string &type,
    restartEpochFormat      ("TAIModJulian"),
    restartEpoch            ("FirstMeasurement"),
    outputDataFile          (""),
-   vnbFrame                (NULL)
+   historyCheckpoint       (1),
+   historyFile             (""),
+   vnbFrame                (NULL),
+   updateStats             (new FilterHistory()),
+   historyChainBroken      (false)
 // End EKF mod
 {
    //hiLowData.push_back(&sigma);
@@ -178,7 +188,11 @@ SeqEstimator::SeqEstimator(const SeqEstimator & se) :
    restartEpochFormat      (se.restartEpochFormat),
    restartEpoch            (se.restartEpoch),
    outputDataFile          (se.outputDataFile),
-   vnbFrame                (NULL)
+   historyCheckpoint       (se.historyCheckpoint),
+   historyFile             (se.historyFile),
+   vnbFrame                (NULL),
+   updateStats             (new FilterHistory()),
+   historyChainBroken      (false)
 // End EKF mod
 {
    hiLowData.push_back(&sigma);
@@ -212,6 +226,8 @@ SeqEstimator& SeqEstimator::operator=(
       restartEpochFormat = se.restartEpochFormat;
       restartEpoch = se.restartEpoch;
       outputDataFile = se.outputDataFile;
+      historyCheckpoint = se.historyCheckpoint;
+      historyFile = se.historyFile;
       vnbFrame = NULL;
    }
    return *this;
@@ -271,11 +287,11 @@ Integer SeqEstimator::GetParameterID(const std::string &str) const
    if (str == "MaximumIterations")
       throw SolverException("Syntax error: Sequential Estimator '" + GetName() + "' does not has parameter '" + str + "'.\n");
 
-   for (Integer i = EstimatorParamCount; i < SeqEstimatorParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - EstimatorParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("SeqEstimator", PARAMETER_TEXT,
+         EstimatorParamCount, SeqEstimatorParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
 
    return Estimator::GetParameterID(str);
 }
@@ -467,6 +483,92 @@ Real SeqEstimator::SetRealParameter(const std::string &label, const Real value)
 }
 
 
+//------------------------------------------------------------------------------
+//  Integer GetIntegerParameter(const Integer id) const
+//------------------------------------------------------------------------------
+/**
+ * This method returns the Integer parameter value, given the input parameter
+ * ID.
+ *
+ * @param id ID for the requested parameter value.
+ *
+ * @return  Integer value of the requested parameter.
+ */
+//------------------------------------------------------------------------------
+Integer SeqEstimator::GetIntegerParameter(const Integer id) const
+{
+   if (id == FILTER_HISTORY_CHECKPOINT)
+      return historyCheckpoint;
+
+   return Estimator::GetIntegerParameter(id);
+}
+
+
+//------------------------------------------------------------------------------
+//  Integer SetIntegerParameter(const Integer id, const Integer value)
+//------------------------------------------------------------------------------
+/**
+ * This method sets the Integer parameter value, given the input parameter ID.
+ *
+ * @param id ID for the parameter whose value to change.
+ * @param value Value for the parameter.
+ *
+ * @return  Integer value of the requested parameter.
+ */
+//------------------------------------------------------------------------------
+Integer SeqEstimator::SetIntegerParameter(const Integer id, const Integer value)
+{
+   if (id == FILTER_HISTORY_CHECKPOINT)
+   {
+      if (value >= 1)
+         historyCheckpoint = value;
+      else
+         throw EstimatorException("Error: " + GetName() + "." + GetParameterText(id) + " parameter is not a positive integer\n");
+
+      return historyCheckpoint;
+   }
+
+   return Estimator::SetIntegerParameter(id, value);
+}
+
+
+//------------------------------------------------------------------------------
+//  Integer GetIntegerParameter(const std::string &label) const
+//------------------------------------------------------------------------------
+/**
+* This method gets value of an integer parameter specified by parameter name.
+*
+* @param label    name of parameter.
+*
+* @return         value of an integer parameter.
+*/
+//------------------------------------------------------------------------------
+Integer SeqEstimator::GetIntegerParameter(const std::string &label) const
+{
+   return GetIntegerParameter(GetParameterID(label));
+}
+
+
+//------------------------------------------------------------------------------
+//  Integer SetIntegerParameter(const std::string &label, const Integer value)
+//------------------------------------------------------------------------------
+/**
+* This method sets value to an integer parameter specified by the input
+* parameter name.
+*
+* @param label    name for the requested parameter.
+* @param value    integer value used to set to the request parameter.
+*
+* @return value set to the requested parameter.
+*/
+//------------------------------------------------------------------------------
+Integer SeqEstimator::SetIntegerParameter(const std::string &label,
+      const Integer value)
+{
+   return SetIntegerParameter(GetParameterID(label), value);
+}
+
+
 //------------------------------------------------------------------------------
 //  std::string GetStringParameter(const Integer id) const
 //------------------------------------------------------------------------------
@@ -493,6 +595,9 @@ std::string SeqEstimator::GetStringParameter(const Integer id) const
    if (id == OUTPUT_DATA_FILE)
       return outputDataFile;
 
+   if (id == FILTER_HISTORY_FILE)
+      return historyFile;
+
    return Estimator::GetStringParameter(id);
 }
 
@@ -571,6 +676,20 @@ bool SeqEstimator::SetStringParameter(const Integer id, const std::string &value
       return true;
    }
 
+   if (id == FILTER_HISTORY_FILE)
+   {
+      // verify a valid file name
+      if (value != "")
+      {
+         Integer error;
+         if (!GmatStringUtil::IsValidFullFileName(value, error))
+            throw EstimatorException("Error: '" + value + "' set to " + GetName() + ".FilterHistoryFile is an invalid file name.\n");
+      }
+
+      historyFile = value;
+      return true;
+   }
+
    return Estimator::SetStringParameter(id, value);
 }
 
@@ -888,15 +1007,18 @@ bool SeqEstimator::IsFinalPass()
 
 
 //------------------------------------------------------------------------------
-// std::vector<SeqEstimator::UpdateInfoType> GetUpdateStats()
+// std::shared_ptr<FilterHistory> GetUpdateStats()
 //------------------------------------------------------------------------------
 /**
- * This returns the vector of UpdateInfoType
+ * This returns the history of UpdateInfoType records
+ *
+ * The history is not copied.  The estimator starts a new history when it is
+ * run again, so the caller can keep the returned one.
  *
- * @return the vector of UpdateInfoType
+ * @return the filter history
  */
  //------------------------------------------------------------------------------
-std::vector<SeqEstimator::UpdateInfoType> SeqEstimator::GetUpdateStats()
+std::shared_ptr<FilterHistory> SeqEstimator::GetUpdateStats()
 {
    return updateStats;
 }
@@ -1125,7 +1247,11 @@ void SeqEstimator::CompleteInitialization()
    solv2KeplMatrixPrev = solv2KeplMatrix;
 
    measStats.clear();
-   updateStats.clear();
+   ResetUpdateStats();
+   if ((historyCheckpoint > 1) && (updateStats->GetCheckpointInterval() == 1))
+      MessageInterface::ShowMessage("Warning: %s.FilterHistoryCheckpointInterval "
+            "is ignored because the solve-for state is not Cartesian; every "
+            "covariance is kept\n", GetName().c_str());
    isInitialized = true;
 
 // EKF mod 12/16
@@ -1226,7 +1352,7 @@ void SeqEstimator::CompleteInitialization()
 
       WriteDataFile();
       AddMatlabFilterData(updateStat);
-      updateStats.push_back(updateStat);
+      AddUpdateStat(updateStat);
 }
 
 //------------------------------------------------------------------------------
@@ -1698,8 +1824,10 @@ void SeqEstimator::FilterUpdate()
       {
          WriteDataFile();
          AddMatlabFilterData(updateStat);
-         updateStats.push_back(updateStat);
+         AddUpdateStat(updateStat);
       }
+      else
+         historyChainBroken = true;
 
       // Reset the STM
       PrepareForStep();
@@ -1710,6 +1838,64 @@ void SeqEstimator::FilterUpdate()
    }
 }
 
+//------------------------------------------------------------------------------
+// void ResetUpdateStats()
+//------------------------------------------------------------------------------
+/**
+ * Starts a new filter history
+ *
+ * The previous history is released, or left to the smoother that holds it.
+ * Checkpoints are only used when the solve-for state is Cartesian: the STM
+ * and process noise in the records are Cartesian, and only rebuild the
+ * solve-for covariance when the conversion between the two is the identity.
+ */
+//------------------------------------------------------------------------------
+void SeqEstimator::ResetUpdateStats()
+{
+   // Sequence number that keeps the spill files of each history apart
+   static Integer historyFileCount = 0;
+
+   updateStats.reset(new FilterHistory());
+   historyChainBroken = false;
+
+   if (historyFile != "")
+   {
+      std::stringstream fileName;
+      fileName << historyFile << "." << ++historyFileCount;
+      updateStats->SetSpillFile(fileName.str());
+   }
+
+   if (historyCheckpoint > 1)
+   {
+      bool isCartesian = (cart2SolvMatrix.GetNumRows() == (Integer)stateSize) &&
+            (cart2SolvMatrix.GetNumColumns() == (Integer)stateSize);
+      for (UnsignedInt ii = 0U; isCartesian && (ii < stateSize); ii++)
+         for (UnsignedInt jj = 0U; jj < stateSize; jj++)
+            if (cart2SolvMatrix(ii, jj) != (ii == jj ? 1.0 : 0.0))
+               isCartesian = false;
+
+      if (isCartesian)
+         updateStats->SetCheckpointInterval(historyCheckpoint);
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void AddUpdateStat(const UpdateInfoType &updateStat)
+//------------------------------------------------------------------------------
+/**
+ * Adds a record to the filter history
+ *
+ * @param updateStat The record
+ */
+//------------------------------------------------------------------------------
+void SeqEstimator::AddUpdateStat(const UpdateInfoType &updateStat)
+{
+   updateStats->Add(updateStat, !historyChainBroken);
+   historyChainBroken = false;
+}
+
+
 //------------------------------------------------------------------------------
 //  std::string GetProgressString()
 //------------------------------------------------------------------------------
@@ -2248,11 +2434,11 @@ void SeqEstimator::WriteReportFileSummaryPart5(Solver::SolverState sState)
    textFile5 << "******************************************************************  FILTER COVARIANCE REPORT  ******************************************************************\n";
    textFile5 << "\n";
 
-   for (UnsignedInt ii = 0U; ii < updateStats.size(); ii++)
+   for (UnsignedInt ii = 0U; ii < updateStats->GetSize(); ii++)
    {
       if (GmatMathUtil::Mod(ii, 80) < 0.001)
          WriteCovariancePageHeader();
-      BuildCovarianceLine(updateStats[ii]);
+      BuildCovarianceLine(updateStats->GetSummary(ii));
    }
    textFile5 << "\n";
    textFile5 << "***********************************************************************  END OF REPORT  ************************************************************************\n";
@@ -2784,6 +2970,7 @@ bool SeqEstimator::RestartFromDataFile(const GmatTime &epoch, bool onlyPriorEpoc
    esm.MapVectorToObjects();
    PropagationStateManager *psm = propagators[0]->GetPropStateManager();
    psm->MapObjectsToVector();
+   historyChainBroken = true;
    return true;
 }
 
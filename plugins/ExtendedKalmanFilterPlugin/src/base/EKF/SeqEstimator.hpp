@@ -36,6 +36,9 @@
 #include "kalman_defs.hpp"
 #include "Estimator.hpp"
 #include "ProcessNoiseModel.hpp"
+#include <memory>
+
+class FilterHistory;
 
 /**
  * Provides core functionality used in sequential estimation.
@@ -78,6 +81,13 @@ public:
    virtual Real         SetRealParameter(const std::string &label,
                                         const Real value);
 
+   virtual Integer      GetIntegerParameter(const Integer id) const;
+   virtual Integer      SetIntegerParameter(const Integer id,
+                                            const Integer value);
+   virtual Integer      GetIntegerParameter(const std::string &label) const;
+   virtual Integer      SetIntegerParameter(const std::string &label,
+                                            const Integer value);
+
    virtual std::string  GetStringParameter(const Integer id) const;
    virtual bool         SetStringParameter(const Integer id,
                                            const std::string &value);
@@ -149,7 +159,7 @@ public:
    };
 
    // Functions added for smoothing
-   virtual std::vector<UpdateInfoType> GetUpdateStats();
+   virtual std::shared_ptr<FilterHistory> GetUpdateStats();
    virtual void         SetAnchorEpoch(const GmatTime& epoch, bool noiseBetween);
    virtual bool         UpdateInitialConditions();
 
@@ -190,6 +200,10 @@ protected:
    std::string outputDataFile;
    /// The output data file
    std::ofstream dataFile;
+   /// Number of records between stored covariances in the filter history
+   Integer     historyCheckpoint;
+   /// Base name of the filter history spill file; empty to keep it in memory
+   std::string historyFile;
 
    /// Changes in the state vector
    Rvector                 dx;
@@ -242,6 +256,8 @@ protected:
       RESTART_EPOCH_FORMAT,
       RESTART_EPOCH,
       OUTPUT_DATA_FILE,
+      FILTER_HISTORY_CHECKPOINT,
+      FILTER_HISTORY_FILE,
 
       SeqEstimatorParamCount
    };
@@ -297,7 +313,14 @@ protected:
 
    virtual void           WriteCovariancePageHeader();
 
-   std::vector<UpdateInfoType> updateStats;
+   /// The filter records; a new history is started for each run, so
+   /// smoothers can keep the one they were given
+   std::shared_ptr<FilterHistory> updateStats;
+   /// True when the covariance changed since the last record was added
+   bool                   historyChainBroken;
+
+   void                   ResetUpdateStats();
+   void                   AddUpdateStat(const UpdateInfoType &updateStat);
 
    virtual void           BuildCovarianceLine(const UpdateInfoType &updateStat);
 
@@ -0,0 +1,984 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                           SquareRootFilterKernel
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/16
+//
+/**
+ * Implements SquareRootFilterKernel, the covariance factor arithmetic of the
+ * square root extended Kalman filter.
+ */
+//------------------------------------------------------------------------------
+
+#include "SquareRootFilterKernel.hpp"
+#include "EstimatorException.hpp"
+#include "MessageInterface.hpp"
+#include "RealUtilities.hpp"
+#include <utility>
+
+//#define DEBUG_KERNEL
+
+
+//------------------------------------------------------------------------------
+// SquareRootFilterKernel()
+//------------------------------------------------------------------------------
+/**
+ * Constructor
+ */
+//------------------------------------------------------------------------------
+SquareRootFilterKernel::SquareRootFilterKernel() :
+   stateSize      (0U),
+   measSize       (0U),
+   hasUpdate      (false)
+{
+}
+
+
+//------------------------------------------------------------------------------
+// ~SquareRootFilterKernel()
+//------------------------------------------------------------------------------
+/**
+ * Destructor
+ */
+//------------------------------------------------------------------------------
+SquareRootFilterKernel::~SquareRootFilterKernel()
+{
+}
+
+
+//------------------------------------------------------------------------------
+// SquareRootFilterKernel(const SquareRootFilterKernel &kernel)
+//------------------------------------------------------------------------------
+/**
+ * Copy constructor
+ *
+ * @param kernel The kernel copied to this one
+ */
+//------------------------------------------------------------------------------
+SquareRootFilterKernel::SquareRootFilterKernel(
+      const SquareRootFilterKernel &kernel) :
+   stateSize      (kernel.stateSize),
+   measSize       (kernel.measSize),
+   hasUpdate      (kernel.hasUpdate),
+   sqrtP          (kernel.sqrtP),
+   sqrtPUpdate    (kernel.sqrtPUpdate),
+   gain           (kernel.gain),
+   timeArray      (kernel.timeArray),
+   measArray      (kernel.measArray),
+   phi            (kernel.phi),
+   noiseS         (kernel.noiseS),
+   scratch        (kernel.scratch),
+   lu             (kernel.lu),
+   pivots         (kernel.pivots),
+   work           (kernel.work)
+{
+}
+
+
+//------------------------------------------------------------------------------
+// SquareRootFilterKernel& operator=(const SquareRootFilterKernel &kernel)
+//------------------------------------------------------------------------------
+/**
+ * Assignment operator
+ *
+ * @param kernel The kernel copied to this one
+ *
+ * @return This kernel, configured to match kernel
+ */
+//------------------------------------------------------------------------------
+SquareRootFilterKernel& SquareRootFilterKernel::operator=(
+      const SquareRootFilterKernel &kernel)
+{
+   if (this != &kernel)
+   {
+      stateSize   = kernel.stateSize;
+      measSize    = kernel.measSize;
+      hasUpdate   = kernel.hasUpdate;
+      sqrtP       = kernel.sqrtP;
+      sqrtPUpdate = kernel.sqrtPUpdate;
+      gain        = kernel.gain;
+      timeArray   = kernel.timeArray;
+      measArray   = kernel.measArray;
+      phi         = kernel.phi;
+      noiseS      = kernel.noiseS;
+      scratch     = kernel.scratch;
+      lu          = kernel.lu;
+      pivots      = kernel.pivots;
+      work        = kernel.work;
+   }
+
+   return *this;
+}
+
+
+//------------------------------------------------------------------------------
+// void Initialize(const Rmatrix &cov)
+//------------------------------------------------------------------------------
+/**
+ * Sizes the workspaces and factors the initial covariance
+ *
+ * @param cov The initial state error covariance
+ */
+//------------------------------------------------------------------------------
+void SquareRootFilterKernel::Initialize(const Rmatrix &cov)
+{
+   stateSize = cov.GetNumRows();
+   measSize = 0U;
+   hasUpdate = false;
+
+   UnsignedInt n = stateSize;
+   sqrtPUpdate.assign(n * n, 0.0);
+   timeArray.assign(2 * n * n, 0.0);
+   phi.assign(n * n, 0.0);
+   noiseS.assign(n * n, 0.0);
+   scratch.assign(n * n, 0.0);
+   lu.assign(n * n, 0.0);
+   pivots.assign(n, 0U);
+   work.assign(n, 0.0);
+   gain.assign(n, 0.0);
+
+   Load(cov, sqrtP);
+   if (!Cholesky(&sqrtP[0], n, n, false))
+      throw EstimatorException("The initial covariance matrix is not "
+            "positive definite!");
+}
+
+
+//------------------------------------------------------------------------------
+// UnsignedInt GetStateSize() const
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the dimension of the factored covariance
+ *
+ * @return The state size
+ */
+//------------------------------------------------------------------------------
+UnsignedInt SquareRootFilterKernel::GetStateSize() const
+{
+   return stateSize;
+}
+
+
+//------------------------------------------------------------------------------
+// void TimeUpdate(const Rmatrix &stm, const Rmatrix &noise,
+//       const Rmatrix &dX_dSPrev, const Rmatrix &dX_dS)
+//------------------------------------------------------------------------------
+/**
+ * Propagates the covariance factor across a step
+ *
+ * The STM and process noise are converted to solve-for coordinates,
+ *
+ *    Phi_S = [dX/dS]^-1 Phi [dX/dS]prev,   Q_S = [dX/dS]^-1 Q [dX/dS]^-T
+ *
+ * and the factor is replaced by the triangular factor of Phi_S P Phi_S^T +
+ * Q_S.  Process noise with zero diagonal elements is factored on its nonzero
+ * rows and columns only.
+ *
+ * @param stm The state transition matrix for the step
+ * @param noise The process noise accumulated over the step
+ * @param dX_dSPrev The conversion matrix at the start of the step
+ * @param dX_dS The conversion matrix at the end of the step
+ */
+//------------------------------------------------------------------------------
+void SquareRootFilterKernel::TimeUpdate(const Rmatrix &stm,
+      const Rmatrix &noise, const Rmatrix &dX_dSPrev, const Rmatrix &dX_dS)
+{
+   UnsignedInt n = stateSize;
+
+   Load(stm, phi);
+   if (!IsIdentity(dX_dSPrev))
+      Multiply(phi, dX_dSPrev);
+
+   bool convert = !IsIdentity(dX_dS);
+   if (convert)
+   {
+      FactorConversion(dX_dS);
+      SolveConversion(phi);
+   }
+
+   bool hasNoise = false;
+   for (UnsignedInt i = 0U; (i < n) && !hasNoise; ++i)
+      if (noise(i, i) != 0.0)
+         hasNoise = true;
+
+   if (hasNoise)
+   {
+      Load(noise, noiseS);
+      if (convert)
+      {
+         // Q_S = (M^-1 (M^-1 Q)^T)^T
+         SolveConversion(noiseS);
+         Transpose(noiseS);
+         SolveConversion(noiseS);
+         Transpose(noiseS);
+      }
+   }
+
+   // Top block: S Phi_S^T, using the zeros below the diagonal of S
+   Real *c = &timeArray[0];
+   const Real *s = &sqrtP[0];
+   for (UnsignedInt i = 0U; i < n; ++i)
+   {
+      for (UnsignedInt j = 0U; j < n; ++j)
+      {
+         const Real *p = &phi[j * n];
+         Real sum = 0.0;
+         for (UnsignedInt k = i; k < n; ++k)
+            sum += s[i * n + k] * p[k];
+         c[i * n + j] = sum;
+      }
+   }
+
+   // Bottom block: sqrt(Q_S)^T
+   if (hasNoise)
+   {
+      Real *q = c + n * n;
+      for (UnsignedInt i = 0U; i < n; ++i)
+         for (UnsignedInt j = 0U; j < n; ++j)
+            q[i * n + j] = (j < i ? 0.0 : noiseS[i * n + j]);
+
+      if (!Cholesky(q, n, n, true))
+         throw EstimatorException("The process noise matrix is not positive "
+               "definite!");
+   }
+
+   TriangularizeTimeArray(hasNoise);
+   hasUpdate = false;
+
+   Real *out = &sqrtP[0];
+   for (UnsignedInt i = 0U; i < n; ++i)
+      for (UnsignedInt j = 0U; j < n; ++j)
+         out[i * n + j] = (j < i ? 0.0 : c[i * n + j]);
+}
+
+
+//------------------------------------------------------------------------------
+// void MeasurementUpdate(const Rmatrix &H, const Rmatrix &R)
+//------------------------------------------------------------------------------
+/**
+ * Computes the Kalman gain and the measurement updated covariance factor
+ *
+ * The updated factor is held until AcceptUpdate() is called, so a measurement
+ * that is edited out leaves the factor unchanged.
+ *
+ * @param H The measurement sensitivity matrix, measSize x stateSize
+ * @param R The measurement noise covariance
+ */
+//------------------------------------------------------------------------------
+void SquareRootFilterKernel::MeasurementUpdate(const Rmatrix &H,
+      const Rmatrix &R)
+{
+   UnsignedInt n = stateSize;
+   UnsignedInt m = H.GetNumRows();
+   measSize = m;
+
+   // Sensitivities, row major; capacity is kept between measurements
+   work.resize(m * n);
+   for (UnsignedInt j = 0U; j < m; ++j)
+      for (UnsignedInt k = 0U; k < n; ++k)
+         work[j * n + k] = H(j, k);
+   gain.resize(n * m);
+   hasUpdate = true;
+
+   if (m == 1U)
+   {
+      ScalarUpdate(R(0, 0));
+      return;
+   }
+
+   // A = [sqrt(R)^T, 0; S H^T, S]
+   UnsignedInt size = m + n;
+   measArray.resize(size * size);
+   Real *a = &measArray[0];
+   const Real *s = &sqrtP[0];
+   const Real *h = &work[0];
+
+   for (UnsignedInt i = 0U; i < m; ++i)
+      for (UnsignedInt j = 0U; j < size; ++j)
+         a[i * size + j] = ((j < i) || (j >= m) ? 0.0 : R(i, j));
+   if (!Cholesky(a, m, size, false))
+      throw EstimatorException("The measurement noise covariance is not "
+            "positive definite!");
+
+   for (UnsignedInt i = 0U; i < n; ++i)
+   {
+      Real *row = a + (m + i) * size;
+      for (UnsignedInt j = 0U; j < m; ++j)
+      {
+         Real sum = 0.0;
+         for (UnsignedInt k = i; k < n; ++k)
+            sum += s[i * n + k] * h[j * n + k];
+         row[j] = sum;
+      }
+      for (UnsignedInt k = 0U; k < n; ++k)
+         row[m + k] = (k < i ? 0.0 : s[i * n + k]);
+   }
+
+   // Zero the S H^T block a column at a time, rotating each state row into
+   // the measurement row from the bottom up.  State row i is nonzero in
+   // columns col..m-1 and m+i..; the measurement row only picks up columns
+   // past m+i from the rows already rotated, so those are the only columns
+   // touched.
+   for (UnsignedInt col = 0U; col < m; ++col)
+   {
+      Real *top = a + col * size;
+      for (UnsignedInt i = n; i-- > 0U; )
+      {
+         Real *row = a + (m + i) * size;
+         Real y = row[col];
+         if (y == 0.0)
+            continue;
+
+         Real x = top[col];
+         Real r = GmatMathUtil::Sqrt(x * x + y * y);
+         Real cs = x / r;
+         Real sn = y / r;
+
+         top[col] = r;
+         row[col] = 0.0;
+         for (UnsignedInt j = col + 1U; j < m; ++j)
+         {
+            Real u = top[j], v = row[j];
+            top[j] = cs * u + sn * v;
+            row[j] = cs * v - sn * u;
+         }
+         for (UnsignedInt j = m + i; j < size; ++j)
+         {
+            Real u = top[j], v = row[j];
+            top[j] = cs * u + sn * v;
+            row[j] = cs * v - sn * u;
+         }
+      }
+   }
+
+   Real *update = &sqrtPUpdate[0];
+   for (UnsignedInt i = 0U; i < n; ++i)
+      for (UnsignedInt k = 0U; k < n; ++k)
+         update[i * n + k] = (k < i ? 0.0 : a[(m + i) * size + m + k]);
+
+   // K = W^T sqrt(B)^-T: solve sqrt(B) K^T = W by back substitution
+   for (UnsignedInt l = 0U; l < n; ++l)
+   {
+      Real *k = &gain[l * m];
+      for (UnsignedInt i = m; i-- > 0U; )
+      {
+         const Real *b = a + i * size;
+         Real sum = b[m + l];
+         for (UnsignedInt j = i + 1U; j < m; ++j)
+            sum -= b[j] * k[j];
+         k[i] = sum / b[i];
+      }
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void AcceptUpdate()
+//------------------------------------------------------------------------------
+/**
+ * Replaces the covariance factor with the measurement updated factor
+ *
+ * Does nothing if there has been no measurement update since the last call.
+ */
+//------------------------------------------------------------------------------
+void SquareRootFilterKernel::AcceptUpdate()
+{
+   if (hasUpdate)
+   {
+      sqrtP.swap(sqrtPUpdate);
+      hasUpdate = false;
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// Real GetMinimumDiagonal() const
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the smallest diagonal element of the covariance factor
+ *
+ * @return The smallest diagonal magnitude; 0 for an empty kernel
+ */
+//------------------------------------------------------------------------------
+Real SquareRootFilterKernel::GetMinimumDiagonal() const
+{
+   if (stateSize == 0U)
+      return 0.0;
+
+   Real minimum = GmatMathUtil::Abs(sqrtP[0]);
+   for (UnsignedInt i = 1U; i < stateSize; ++i)
+   {
+      Real d = GmatMathUtil::Abs(sqrtP[i * stateSize + i]);
+      if (d < minimum)
+         minimum = d;
+   }
+   return minimum;
+}
+
+
+//------------------------------------------------------------------------------
+// void GetFactor(Rmatrix &sqrtP_T) const
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the covariance factor
+ *
+ * @param sqrtP_T The upper triangular S, with P = S^T S
+ */
+//------------------------------------------------------------------------------
+void SquareRootFilterKernel::GetFactor(Rmatrix &sqrtP_T) const
+{
+   Integer n = stateSize;
+   if ((sqrtP_T.GetNumRows() != n) || (sqrtP_T.GetNumColumns() != n))
+      sqrtP_T.SetSize(n, n);
+
+   for (Integer i = 0; i < n; ++i)
+      for (Integer j = 0; j < n; ++j)
+         sqrtP_T(i, j) = sqrtP[i * n + j];
+}
+
+
+//------------------------------------------------------------------------------
+// void GetCovariance(Rmatrix &cov) const
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the covariance S^T S
+ *
+ * The result is symmetric by construction.
+ *
+ * @param cov The matrix that receives the covariance
+ */
+//------------------------------------------------------------------------------
+void SquareRootFilterKernel::GetCovariance(Rmatrix &cov) const
+{
+   Integer n = stateSize;
+   if ((cov.GetNumRows() != n) || (cov.GetNumColumns() != n))
+      cov.SetSize(n, n);
+
+   const Real *s = &sqrtP[0];
+   for (Integer i = 0; i < n; ++i)
+   {
+      for (Integer j = i; j < n; ++j)
+      {
+         Real sum = 0.0;
+         for (Integer k = 0; k <= i; ++k)
+            sum += s[k * n + i] * s[k * n + j];
+         cov(i, j) = sum;
+         cov(j, i) = sum;
+      }
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void GetGain(Rmatrix &kalman) const
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the Kalman gain from the last measurement update
+ *
+ * @param kalman The matrix that receives the gain, stateSize x measSize
+ */
+//------------------------------------------------------------------------------
+void SquareRootFilterKernel::GetGain(Rmatrix &kalman) const
+{
+   Integer n = stateSize;
+   Integer m = measSize;
+   if ((kalman.GetNumRows() != n) || (kalman.GetNumColumns() != m))
+      kalman.SetSize(n, m);
+
+   for (Integer i = 0; i < n; ++i)
+      for (Integer j = 0; j < m; ++j)
+         kalman(i, j) = gain[i * m + j];
+}
+
+
+//------------------------------------------------------------------------------
+// void ApplyGain(const Rvector &residual, Rvector &dx) const
+//------------------------------------------------------------------------------
+/**
+ * Computes the state correction K y
+ *
+ * @param residual The measurement residuals y
+ * @param dx The vector that receives the correction
+ */
+//------------------------------------------------------------------------------
+void SquareRootFilterKernel::ApplyGain(const Rvector &residual,
+      Rvector &dx) const
+{
+   Integer n = stateSize;
+   Integer m = measSize;
+   if (dx.GetSize() != n)
+      dx.SetSize(n);
+
+   for (Integer i = 0; i < n; ++i)
+   {
+      Real sum = 0.0;
+      for (Integer j = 0; j < m; ++j)
+         sum += gain[i * m + j] * residual[j];
+      dx[i] = sum;
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// bool GetInformation(Rmatrix &info, Real tolerance)
+//------------------------------------------------------------------------------
+/**
+ * Computes the information matrix P^-1 = S^-1 S^-T
+ *
+ * @param info The matrix that receives the information matrix
+ * @param tolerance Smallest squared diagonal element of S accepted
+ *
+ * @return false, leaving info unchanged, if a squared diagonal element of S
+ *         is not above tolerance
+ */
+//------------------------------------------------------------------------------
+bool SquareRootFilterKernel::GetInformation(Rmatrix &info, Real tolerance)
+{
+   Integer n = stateSize;
+   const Real *s = &sqrtP[0];
+
+   for (Integer i = 0; i < n; ++i)
+      if (s[i * n + i] * s[i * n + i] <= tolerance)
+         return false;
+
+   // Invert S in place in scratch space, bottom row first
+   Real *t = &scratch[0];
+   for (Integer i = n - 1; i >= 0; --i)
+   {
+      t[i * n + i] = 1.0 / s[i * n + i];
+      for (Integer j = i + 1; j < n; ++j)
+      {
+         Real sum = 0.0;
+         for (Integer k = i + 1; k <= j; ++k)
+            sum += s[i * n + k] * t[k * n + j];
+         t[i * n + j] = -sum * t[i * n + i];
+      }
+   }
+
+   if ((info.GetNumRows() != n) || (info.GetNumColumns() != n))
+      info.SetSize(n, n);
+
+   for (Integer i = 0; i < n; ++i)
+   {
+      for (Integer j = i; j < n; ++j)
+      {
+         Real sum = 0.0;
+         for (Integer k = j; k < n; ++k)
+            sum += t[i * n + k] * t[j * n + k];
+         info(i, j) = sum;
+         info(j, i) = sum;
+      }
+   }
+
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// bool IsIdentity(const Rmatrix &mat)
+//------------------------------------------------------------------------------
+/**
+ * Checks for an exact identity matrix
+ *
+ * Cartesian solve-for states produce an exact identity conversion, which
+ * lets the updates skip the conversion entirely.
+ *
+ * @param mat The matrix checked
+ *
+ * @return true if mat is square with ones on the diagonal and zeros elsewhere
+ */
+//------------------------------------------------------------------------------
+bool SquareRootFilterKernel::IsIdentity(const Rmatrix &mat)
+{
+   Integer n = mat.GetNumRows();
+   if (n != mat.GetNumColumns())
+      return false;
+
+   for (Integer i = 0; i < n; ++i)
+      for (Integer j = 0; j < n; ++j)
+         if (mat(i, j) != (i == j ? 1.0 : 0.0))
+            return false;
+
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// void Load(const Rmatrix &mat, RealArray &values) const
+//------------------------------------------------------------------------------
+/**
+ * Copies a matrix into a row major array
+ *
+ * @param mat The matrix copied
+ * @param values The array that receives the elements
+ */
+//------------------------------------------------------------------------------
+void SquareRootFilterKernel::Load(const Rmatrix &mat, RealArray &values) const
+{
+   Integer rows = mat.GetNumRows();
+   Integer cols = mat.GetNumColumns();
+   values.resize(rows * cols);
+
+   for (Integer i = 0; i < rows; ++i)
+      for (Integer j = 0; j < cols; ++j)
+         values[i * cols + j] = mat(i, j);
+}
+
+
+//------------------------------------------------------------------------------
+// void Multiply(RealArray &a, const Rmatrix &b)
+//------------------------------------------------------------------------------
+/**
+ * Replaces the square row major array a with a b
+ *
+ * @param a The left factor, which receives the product
+ * @param b The right factor
+ */
+//------------------------------------------------------------------------------
+void SquareRootFilterKernel::Multiply(RealArray &a, const Rmatrix &b)
+{
+   UnsignedInt n = stateSize;
+   Load(b, scratch);
+   work.resize(n);
+
+   for (UnsignedInt i = 0U; i < n; ++i)
+   {
+      Real *row = &a[i * n];
+      for (UnsignedInt j = 0U; j < n; ++j)
+      {
+         Real sum = 0.0;
+         for (UnsignedInt k = 0U; k < n; ++k)
+            sum += row[k] * scratch[k * n + j];
+         work[j] = sum;
+      }
+      for (UnsignedInt j = 0U; j < n; ++j)
+         row[j] = work[j];
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void FactorConversion(const Rmatrix &dX_dS)
+//------------------------------------------------------------------------------
+/**
+ * LU factors the conversion matrix with partial pivoting
+ *
+ * @param dX_dS The Cartesian to solve-for conversion matrix
+ */
+//------------------------------------------------------------------------------
+void SquareRootFilterKernel::FactorConversion(const Rmatrix &dX_dS)
+{
+   UnsignedInt n = stateSize;
+   Load(dX_dS, lu);
+   Real *f = &lu[0];
+
+   for (UnsignedInt k = 0U; k < n; ++k)
+   {
+      UnsignedInt p = k;
+      Real big = GmatMathUtil::Abs(f[k * n + k]);
+      for (UnsignedInt i = k + 1U; i < n; ++i)
+      {
+         if (GmatMathUtil::Abs(f[i * n + k]) > big)
+         {
+            big = GmatMathUtil::Abs(f[i * n + k]);
+            p = i;
+         }
+      }
+
+      if (big == 0.0)
+         throw EstimatorException("The Cartesian to solve-for state "
+               "conversion matrix is singular");
+
+      pivots[k] = p;
+      if (p != k)
+         for (UnsignedInt j = 0U; j < n; ++j)
+            std::swap(f[k * n + j], f[p * n + j]);
+
+      for (UnsignedInt i = k + 1U; i < n; ++i)
+      {
+         Real l = f[i * n + k] / f[k * n + k];
+         f[i * n + k] = l;
+         if (l != 0.0)
+            for (UnsignedInt j = k + 1U; j < n; ++j)
+               f[i * n + j] -= l * f[k * n + j];
+      }
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void SolveConversion(RealArray &values)
+//------------------------------------------------------------------------------
+/**
+ * Replaces the square row major array X with [dX/dS]^-1 X
+ *
+ * The solve works a row at a time, so every column is handled in one sweep.
+ *
+ * @param values The array X
+ */
+//------------------------------------------------------------------------------
+void SquareRootFilterKernel::SolveConversion(RealArray &values)
+{
+   UnsignedInt n = stateSize;
+   const Real *f = &lu[0];
+   Real *x = &values[0];
+
+   for (UnsignedInt k = 0U; k < n; ++k)
+      if (pivots[k] != k)
+         for (UnsignedInt j = 0U; j < n; ++j)
+            std::swap(x[k * n + j], x[pivots[k] * n + j]);
+
+   for (UnsignedInt i = 1U; i < n; ++i)
+      for (UnsignedInt k = 0U; k < i; ++k)
+      {
+         Real l = f[i * n + k];
+         if (l != 0.0)
+            for (UnsignedInt j = 0U; j < n; ++j)
+               x[i * n + j] -= l * x[k * n + j];
+      }
+
+   for (UnsignedInt i = n; i-- > 0U; )
+   {
+      for (UnsignedInt k = i + 1U; k < n; ++k)
+      {
+         Real u = f[i * n + k];
+         if (u != 0.0)
+            for (UnsignedInt j = 0U; j < n; ++j)
+               x[i * n + j] -= u * x[k * n + j];
+      }
+      Real d = 1.0 / f[i * n + i];
+      for (UnsignedInt j = 0U; j < n; ++j)
+         x[i * n + j] *= d;
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void Transpose(RealArray &values) const
+//------------------------------------------------------------------------------
+/**
+ * Transposes a square row major array in place
+ *
+ * @param values The array
+ */
+//------------------------------------------------------------------------------
+void SquareRootFilterKernel::Transpose(RealArray &values) const
+{
+   UnsignedInt n = stateSize;
+   for (UnsignedInt i = 0U; i < n; ++i)
+      for (UnsignedInt j = i + 1U; j < n; ++j)
+         std::swap(values[i * n + j], values[j * n + i]);
+}
+
+
+//------------------------------------------------------------------------------
+// void TriangularizeTimeArray(bool hasNoise)
+//------------------------------------------------------------------------------
+/**
+ * Reduces the time update array to upper triangular form in place
+ *
+ * Column j is reflected onto the diagonal with a Householder reflection
+ * over rows j..n-1 of the top block and, when there is process noise, rows
+ * 0..j of the triangular bottom block; the other rows of the column are
+ * already zero.  The reflection is chosen so the diagonal is nonnegative.
+ *
+ * @param hasNoise true if the bottom block holds a process noise factor
+ */
+//------------------------------------------------------------------------------
+void SquareRootFilterKernel::TriangularizeTimeArray(bool hasNoise)
+{
+   UnsignedInt n = stateSize;
+   Real *c = &timeArray[0];
+   Real *q = c + n * n;
+
+   for (UnsignedInt j = 0U; j < n; ++j)
+   {
+      Real x0 = c[j * n + j];
+      Real sigma = 0.0;
+      for (UnsignedInt i = j + 1U; i < n; ++i)
+         sigma += c[i * n + j] * c[i * n + j];
+      if (hasNoise)
+         for (UnsignedInt i = 0U; i <= j; ++i)
+            sigma += q[i * n + j] * q[i * n + j];
+
+      if (sigma == 0.0)
+      {
+         if (x0 < 0.0)
+            for (UnsignedInt k = j; k < n; ++k)
+               c[j * n + k] = -c[j * n + k];
+         continue;
+      }
+
+      // v = x - |x| e1, with the leading element formed without cancellation
+      Real norm = GmatMathUtil::Sqrt(x0 * x0 + sigma);
+      Real v0 = (x0 <= 0.0 ? x0 - norm : -sigma / (x0 + norm));
+      Real tau = 2.0 / (v0 * v0 + sigma);
+
+      for (UnsignedInt k = j + 1U; k < n; ++k)
+      {
+         Real dot = v0 * c[j * n + k];
+         for (UnsignedInt i = j + 1U; i < n; ++i)
+            dot += c[i * n + j] * c[i * n + k];
+         if (hasNoise)
+            for (UnsignedInt i = 0U; i <= j; ++i)
+               dot += q[i * n + j] * q[i * n + k];
+
+         dot *= tau;
+         c[j * n + k] -= dot * v0;
+         for (UnsignedInt i = j + 1U; i < n; ++i)
+            c[i * n + k] -= dot * c[i * n + j];
+         if (hasNoise)
+            for (UnsignedInt i = 0U; i <= j; ++i)
+               q[i * n + k] -= dot * q[i * n + j];
+      }
+
+      c[j * n + j] = norm;
+      for (UnsignedInt i = j + 1U; i < n; ++i)
+         c[i * n + j] = 0.0;
+      if (hasNoise)
+         for (UnsignedInt i = 0U; i <= j; ++i)
+            q[i * n + j] = 0.0;
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void ScalarUpdate(Real r)
+//------------------------------------------------------------------------------
+/**
+ * Measurement update for a single measurement
+ *
+ * The array [sqrt(r), 0; S h^T, S] is reduced with one Givens rotation per
+ * state row, working on the measurement row (sqrt(b), w) as a scalar and a
+ * vector and on the updated factor directly, for O(n^2) work.  The gain is
+ * w^T / sqrt(b).
+ *
+ * @param r The measurement noise variance
+ */
+//------------------------------------------------------------------------------
+void SquareRootFilterKernel::ScalarUpdate(Real r)
+{
+   if (r <= 0.0)
+      throw EstimatorException("The measurement noise covariance is not "
+            "positive definite!");
+
+   UnsignedInt n = stateSize;
+   const Real *h = &work[0];
+   Real *update = &sqrtPUpdate[0];
+   Real *w = &gain[0];
+
+   for (UnsignedInt k = 0U; k < n * n; ++k)
+      update[k] = sqrtP[k];
+
+   Real b = GmatMathUtil::Sqrt(r);
+   for (UnsignedInt k = 0U; k < n; ++k)
+      w[k] = 0.0;
+
+   // Row i is untouched until its own rotation, so S h^T is formed as needed
+   for (UnsignedInt i = n; i-- > 0U; )
+   {
+      Real *row = update + i * n;
+      Real y = 0.0;
+      for (UnsignedInt k = i; k < n; ++k)
+         y += row[k] * h[k];
+      if (y == 0.0)
+         continue;
+
+      Real rr = GmatMathUtil::Sqrt(b * b + y * y);
+      Real cs = b / rr;
+      Real sn = y / rr;
+      b = rr;
+
+      for (UnsignedInt k = i; k < n; ++k)
+      {
+         Real u = w[k], v = row[k];
+         w[k] = cs * u + sn * v;
+         row[k] = cs * v - sn * u;
+      }
+   }
+
+   for (UnsignedInt k = 0U; k < n; ++k)
+      w[k] /= b;
+}
+
+
+//------------------------------------------------------------------------------
+// bool Cholesky(Real *values, UnsignedInt size, UnsignedInt ld,
+//       bool skipZeroDiagonal)
+//------------------------------------------------------------------------------
+/**
+ * Factors a symmetric matrix in place as U^T U, with U upper triangular
+ *
+ * Only the upper triangle is read; the lower triangle is set to zero.
+ *
+ * @param values The row major matrix, replaced by U
+ * @param size The dimension of the matrix
+ * @param ld The distance between rows in values
+ * @param skipZeroDiagonal true to give rows and columns with a zero diagonal
+ *                         element a zero row in U instead of failing
+ *
+ * @return false if the matrix is not positive definite
+ */
+//------------------------------------------------------------------------------
+bool SquareRootFilterKernel::Cholesky(Real *values, UnsignedInt size,
+      UnsignedInt ld, bool skipZeroDiagonal)
+{
+   for (UnsignedInt k = 0U; k < size; ++k)
+   {
+      Real *rowK = values + k * ld;
+      for (UnsignedInt j = 0U; j < k; ++j)
+         rowK[j] = 0.0;
+
+      if (skipZeroDiagonal && (rowK[k] == 0.0))
+      {
+         for (UnsignedInt j = k + 1U; j < size; ++j)
+            rowK[j] = 0.0;
+         continue;
+      }
+
+      Real d = rowK[k];
+      for (UnsignedInt i = 0U; i < k; ++i)
+         d -= values[i * ld + k] * values[i * ld + k];
+      if (d <= 0.0)
+         return false;
+
+      d = GmatMathUtil::Sqrt(d);
+      rowK[k] = d;
+      for (UnsignedInt j = k + 1U; j < size; ++j)
+      {
+         Real sum = rowK[j];
+         for (UnsignedInt i = 0U; i < k; ++i)
+            sum -= values[i * ld + k] * values[i * ld + j];
+         rowK[j] = sum / d;
+      }
+   }
+
+   #ifdef DEBUG_KERNEL
+      MessageInterface::ShowMessage("Cholesky factor:\n");
+      for (UnsignedInt i = 0U; i < size; ++i)
+      {
+         for (UnsignedInt j = 0U; j < size; ++j)
+            MessageInterface::ShowMessage("  %.12le", values[i * ld + j]);
+         MessageInterface::ShowMessage("\n");
+      }
+   #endif
+
+   return true;
+}
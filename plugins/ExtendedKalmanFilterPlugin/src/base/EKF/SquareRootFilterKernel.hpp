@@ -0,0 +1,136 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                           SquareRootFilterKernel
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/16
+//
+/**
+ * Declares SquareRootFilterKernel, the covariance factor arithmetic of the
+ * square root extended Kalman filter.
+ */
+//------------------------------------------------------------------------------
+
+#ifndef SquareRootFilterKernel_hpp
+#define SquareRootFilterKernel_hpp
+
+#include "kalman_defs.hpp"
+#include "Rmatrix.hpp"
+#include "Rvector.hpp"
+
+/**
+ * Time and measurement updates of an upper triangular covariance factor S,
+ * with P = S^T S
+ *
+ * The time update forms C = [S Phi^T; sqrt(Q)^T] and reduces it to upper
+ * triangular form with Householder reflections, in place.  The process
+ * noise factor is triangular, so each reflection only touches the rows that
+ * can be nonzero.  The Cartesian to solve-for conversion is applied with an
+ * LU factorization and triangular solves, and skipped when the conversion
+ * matrix is the identity.
+ *
+ * The measurement update reduces the array
+ *
+ *    A = [sqrt(R)^T,   0;
+ *         S H^T,       S]
+ *
+ * to upper triangular form with Givens rotations, which keep the triangular
+ * blocks triangular and cost O(m n (m + n)) for m measurements instead of
+ * the O((m + n)^3) of a full QR factorization.  The gain is found by a
+ * triangular solve.  Scalar measurements take a dedicated path that works
+ * on vectors and the factor directly.
+ *
+ * All work is done in row major arrays sized on first use and reused for
+ * every later update, so a filter step makes no heap allocations once the
+ * largest measurement has been seen.  The factors are returned with
+ * nonnegative diagonals.
+ */
+class KALMAN_API SquareRootFilterKernel
+{
+public:
+   SquareRootFilterKernel();
+   ~SquareRootFilterKernel();
+   SquareRootFilterKernel(const SquareRootFilterKernel &kernel);
+   SquareRootFilterKernel& operator=(const SquareRootFilterKernel &kernel);
+
+   void                 Initialize(const Rmatrix &cov);
+   UnsignedInt          GetStateSize() const;
+
+   void                 TimeUpdate(const Rmatrix &stm, const Rmatrix &noise,
+                                   const Rmatrix &dX_dSPrev,
+                                   const Rmatrix &dX_dS);
+   void                 MeasurementUpdate(const Rmatrix &H,
+                                          const Rmatrix &R);
+   void                 AcceptUpdate();
+
+   Real                 GetMinimumDiagonal() const;
+   void                 GetFactor(Rmatrix &sqrtP_T) const;
+   void                 GetCovariance(Rmatrix &cov) const;
+   void                 GetGain(Rmatrix &gain) const;
+   void                 ApplyGain(const Rvector &residual, Rvector &dx) const;
+   bool                 GetInformation(Rmatrix &info, Real tolerance);
+
+   static bool          IsIdentity(const Rmatrix &mat);
+
+protected:
+   /// Dimension of the state
+   UnsignedInt          stateSize;
+   /// Dimension of the last measurement
+   UnsignedInt          measSize;
+   /// True if sqrtPUpdate holds an update that has not been accepted
+   bool                 hasUpdate;
+
+   /// The covariance factor S, upper triangular, row major
+   RealArray            sqrtP;
+   /// The measurement updated factor, valid after MeasurementUpdate()
+   RealArray            sqrtPUpdate;
+   /// The Kalman gain, stateSize x measSize, row major
+   RealArray            gain;
+
+   /// Time update array, 2 stateSize x stateSize
+   RealArray            timeArray;
+   /// Measurement update array, (measSize + stateSize) squared
+   RealArray            measArray;
+   /// The STM in solve-for coordinates
+   RealArray            phi;
+   /// The process noise in solve-for coordinates
+   RealArray            noiseS;
+   /// Matrix product scratch space
+   RealArray            scratch;
+   /// LU factors of the conversion matrix
+   RealArray            lu;
+   /// Row permutation of the LU factors
+   std::vector<UnsignedInt>
+                        pivots;
+   /// Measurement sensitivities, or a row of a matrix product
+   RealArray            work;
+
+   void                 Load(const Rmatrix &mat, RealArray &values) const;
+   void                 Multiply(RealArray &a, const Rmatrix &b);
+   void                 FactorConversion(const Rmatrix &dX_dS);
+   void                 SolveConversion(RealArray &values);
+   void                 Transpose(RealArray &values) const;
+   void                 TriangularizeTimeArray(bool hasNoise);
+   void                 ScalarUpdate(Real r);
+
+   static bool          Cholesky(Real *values, UnsignedInt size,
+                                 UnsignedInt ld, bool skipZeroDiagonal);
+};
+
+#endif // SquareRootFilterKernel_hpp
@@ -29,6 +29,7 @@
 //------------------------------------------------------------------------------
 
 #include "LinearProcessNoise.hpp"
+#include "ParameterIndex.hpp"
 #include "NoiseException.hpp"
 #include "StringUtil.hpp"
 
@@ -213,11 +214,12 @@ std::string LinearProcessNoise::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer LinearProcessNoise::GetParameterID(const std::string &str) const
 {
-   for (int i=ProcessNoiseBaseParamCount; i<LinearProcessNoiseParamCount; i++)
-   {
-      if (str == LinearProcessNoise::PARAMETER_TEXT[i - ProcessNoiseBaseParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("LinearProcessNoise",
+         LinearProcessNoise::PARAMETER_TEXT, ProcessNoiseBaseParamCount,
+         LinearProcessNoiseParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
    
    return ProcessNoiseBase::GetParameterID(str);
 }
@@ -29,6 +29,7 @@
 //------------------------------------------------------------------------------
 
 #include "ProcessNoiseBase.hpp"
+#include "ParameterIndex.hpp"
 #include "NoiseException.hpp"
 #include "CoordinateConverter.hpp"
 #include "MessageInterface.hpp"
@@ -343,11 +344,12 @@ std::string ProcessNoiseBase::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer ProcessNoiseBase::GetParameterID(const std::string &str) const
 {
-   for (int i=GmatBaseParamCount; i<ProcessNoiseBaseParamCount; i++)
-   {
-      if (str == ProcessNoiseBase::PARAMETER_TEXT[i - GmatBaseParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("ProcessNoiseBase",
+         ProcessNoiseBase::PARAMETER_TEXT, GmatBaseParamCount,
+         ProcessNoiseBaseParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
    
    return GmatBase::GetParameterID(str);
 }
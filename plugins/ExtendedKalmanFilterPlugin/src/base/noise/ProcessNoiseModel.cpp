@@ -29,6 +29,7 @@
 //------------------------------------------------------------------------------
 
 #include "ProcessNoiseModel.hpp"
+#include "ParameterIndex.hpp"
 #include "NoiseException.hpp"
 #include "SNCProcessNoise.hpp"
 #include "StringUtil.hpp"
@@ -541,11 +542,12 @@ std::string ProcessNoiseModel::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer ProcessNoiseModel::GetParameterID(const std::string &str) const
 {
-   for (int i=GmatBaseParamCount; i<ProcessNoiseModelParamCount; i++)
-   {
-      if (str == ProcessNoiseModel::PARAMETER_TEXT[i - GmatBaseParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("ProcessNoiseModel",
+         ProcessNoiseModel::PARAMETER_TEXT, GmatBaseParamCount,
+         ProcessNoiseModelParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
    
    return GmatBase::GetParameterID(str);
 }
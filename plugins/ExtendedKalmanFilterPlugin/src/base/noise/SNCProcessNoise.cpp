@@ -29,6 +29,7 @@
 //------------------------------------------------------------------------------
 
 #include "SNCProcessNoise.hpp"
+#include "ParameterIndex.hpp"
 #include "NoiseException.hpp"
 #include "StringUtil.hpp"
 
@@ -221,11 +222,12 @@ std::string SNCProcessNoise::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer SNCProcessNoise::GetParameterID(const std::string &str) const
 {
-   for (int i=ProcessNoiseBaseParamCount; i<SNCProcessNoiseParamCount; i++)
-   {
-      if (str == SNCProcessNoise::PARAMETER_TEXT[i - ProcessNoiseBaseParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("SNCProcessNoise",
+         SNCProcessNoise::PARAMETER_TEXT, ProcessNoiseBaseParamCount,
+         SNCProcessNoiseParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
    
    return ProcessNoiseBase::GetParameterID(str);
 }
@@ -154,25 +154,29 @@ void  Smoother::Copy(const GmatBase* orig)
  //------------------------------------------------------------------------------
 void Smoother::SmoothState(SmootherInfoType &smootherStat, bool includeUpdate)
 {
-   UnsignedInt backFilterIndex = FindIndex(forwardFilterInfo[filterIndex],
-                                           backwardFilterInfo);
+   UnsignedInt backFilterIndex = FindIndex(forwardFilterInfo->GetSummary(filterIndex),
+                                           *backwardFilterInfo);
 
-   Rvector forwardState = forwardFilterInfo[filterIndex].state;
-   Rvector backwardState = backwardFilterInfo[backFilterIndex].state;
+   SeqEstimator::UpdateInfoType forwardInfo, backwardInfo;
+   forwardFilterInfo->Get(filterIndex, forwardInfo);
+   backwardFilterInfo->Get(backFilterIndex, backwardInfo);
 
-   Rmatrix forwardCov = forwardFilterInfo[filterIndex].cov;
-   Rmatrix backwardCov = backwardFilterInfo[backFilterIndex].cov;
+   Rvector forwardState = forwardInfo.state;
+   Rvector backwardState = backwardInfo.state;
 
-   smootherStat.epoch = forwardFilterInfo[filterIndex].epoch;
-   smootherStat.isObs = forwardFilterInfo[filterIndex].isObs;
+   Rmatrix forwardCov = forwardInfo.cov;
+   Rmatrix backwardCov = backwardInfo.cov;
+
+   smootherStat.epoch = forwardInfo.epoch;
+   smootherStat.isObs = forwardInfo.isObs;
 
    if (smootherStat.isObs && includeUpdate)
    {
-      Rvector forwardAprioriState = forwardFilterInfo[filterIndex].measStat.state;
-      Rvector backwardAprioriState = backwardFilterInfo[backFilterIndex].measStat.state;
+      Rvector forwardAprioriState = forwardInfo.measStat.state;
+      Rvector backwardAprioriState = backwardInfo.measStat.state;
 
-      Rmatrix forwardAprioriCov = forwardFilterInfo[filterIndex].measStat.cov;
-      Rmatrix backwardAprioriCov = backwardFilterInfo[backFilterIndex].measStat.cov;
+      Rmatrix forwardAprioriCov = forwardInfo.measStat.cov;
+      Rmatrix backwardAprioriCov = backwardInfo.measStat.cov;
 
       Rmatrix weight1, weight2;
 
@@ -207,8 +211,8 @@ void Smoother::SmoothState(SmootherInfoType &smootherStat, bool includeUpdate)
       if (smootherStat.isObs)
       {
          // Replace forward state & cov with pre-update values
-         forwardState = forwardFilterInfo[filterIndex].measStat.state;
-         forwardCov = forwardFilterInfo[filterIndex].measStat.cov;
+         forwardState = forwardInfo.measStat.state;
+         forwardCov = forwardInfo.measStat.cov;
       }
 
       Rmatrix weight;
@@ -236,48 +240,67 @@ void Smoother::SmoothState(SmootherInfoType &smootherStat, bool includeUpdate)
 
 
 //------------------------------------------------------------------------------
-// UnsignedInt FindIndex(SeqEstimator::UpdateInfoType &filterInfo,
-//                       std::vector<SeqEstimator::UpdateInfoType> &filterInfoVector)
+// UnsignedInt FindIndex(const SeqEstimator::UpdateInfoType &filterInfo,
+//                       const FilterHistory &filterHistory)
 //------------------------------------------------------------------------------
 /**
  * Find the index of a filter info struct that matches the provied struct
+ *
+ * The backward filter history runs in reverse time order, so as the forward
+ * records advance, their matches move toward the start of the history.  The
+ * search starts at backFilterCursor and leaves it past the records at the
+ * matched epoch, so a pass over the forward history reads the summaries of
+ * the backward history once.
  */
  //------------------------------------------------------------------------------
-UnsignedInt Smoother::FindIndex(SeqEstimator::UpdateInfoType &filterInfo,
-                                std::vector<SeqEstimator::UpdateInfoType> &filterInfoVector)
+UnsignedInt Smoother::FindIndex(const SeqEstimator::UpdateInfoType &filterInfo,
+                                const FilterHistory &filterHistory)
 {
-   bool found = false;
-   UnsignedInt searchIndex = 0;
+   if (backFilterCursor > filterHistory.GetSize())
+      backFilterCursor = filterHistory.GetSize();
+
+   // Skip the records before this epoch
+   UnsignedInt last = backFilterCursor;
+   while ((last > 0U) &&
+          !GmatMathUtil::IsEqual(filterInfo.epoch, filterHistory.GetSummary(last - 1).epoch, ESTTIME_ROUNDOFF) &&
+          (filterHistory.GetSummary(last - 1).epoch < filterInfo.epoch))
+      --last;
+
+   // Find the records at this epoch
+   UnsignedInt first = last;
+   while ((first > 0U) &&
+          GmatMathUtil::IsEqual(filterInfo.epoch, filterHistory.GetSummary(first - 1).epoch, ESTTIME_ROUNDOFF))
+      --first;
+
+   if (first == last)
+      throw EstimatorException("Unable to find a matching epoch between the forward and backward filter data while smoothing");
+
+   backFilterCursor = last;
 
-   for (UnsignedInt ii = 0U; ii < filterInfoVector.size(); ii++)
+   UnsignedInt searchIndex = last - 1;
+   for (UnsignedInt ii = first; ii < last; ii++)
    {
-      if (GmatMathUtil::IsEqual(filterInfo.epoch, filterInfoVector[ii].epoch, ESTTIME_ROUNDOFF))
+      if (ObsMatch(filterInfo, filterHistory.GetSummary(ii)))
       {
-         found = true;
          searchIndex = ii;
-
-         if (ObsMatch(filterInfo, filterInfoVector[ii]))
-            break;
+         break;
       }
    }
 
-   if (!found)
-      throw EstimatorException("Unable to find a matching epoch between the forward and backward filter data while smoothing");
-
    return searchIndex;
 }
 
 
 //------------------------------------------------------------------------------
-// bool ObsMatch(SeqEstimator::UpdateInfoType &filterInfo1,
-//               SeqEstimator::UpdateInfoType &filterInfo2)
+// bool ObsMatch(const SeqEstimator::UpdateInfoType &filterInfo1,
+//               const SeqEstimator::UpdateInfoType &filterInfo2)
 //------------------------------------------------------------------------------
 /**
  * Find if the two filter info struct correspond to the same measurement(s)
  */
  //------------------------------------------------------------------------------
-bool Smoother::ObsMatch(SeqEstimator::UpdateInfoType &filterInfo1,
-                               SeqEstimator::UpdateInfoType &filterInfo2)
+bool Smoother::ObsMatch(const SeqEstimator::UpdateInfoType &filterInfo1,
+                        const SeqEstimator::UpdateInfoType &filterInfo2)
 {
    // See if one has a measurement while the other doesn't
    if (filterInfo1.isObs != filterInfo2.isObs)
@@ -319,12 +342,14 @@ bool Smoother::WriteAdditionalMatData()
    matBackFilter.SetInitialRealValue(NAN);
 
    // populate backwards filter mat data
-   for (UnsignedInt ii = 0U; ii < backwardFilterInfo.size(); ii++)
+   SeqEstimator::UpdateInfoType backwardInfo;
+   for (UnsignedInt ii = 0U; ii < backwardFilterInfo->GetSize(); ii++)
    {
-      AddMatlabFilterData(backwardFilterInfo[ii], matBackFilter, matBackFilterIndex);
+      backwardFilterInfo->Get(ii, backwardInfo);
+      AddMatlabFilterData(backwardInfo, matBackFilter, matBackFilterIndex);
 
-      if (backwardFilterInfo[ii].isObs)
-         AddMatlabData(backwardFilterInfo[ii].measStat, matBackComputed, matBackComputedIndex);
+      if (backwardInfo.isObs)
+         AddMatlabData(backwardInfo.measStat, matBackComputed, matBackComputedIndex);
    }
 
    // Add backward filter computed data
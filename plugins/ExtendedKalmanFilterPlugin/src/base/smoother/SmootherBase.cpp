@@ -27,6 +27,7 @@
 //------------------------------------------------------------------------------
 
 #include "SmootherBase.hpp"
+#include "ParameterIndex.hpp"
 
 #include "GmatConstants.hpp"
 #include <sstream>
@@ -90,6 +91,7 @@ SmootherBase::SmootherBase(const std::string &type, const std::string &name) :
    filter                  (NULL),
    filterName              (""),
    filterIndex             (0),
+   backFilterCursor        (0),
    delayFilterRectifySpan  (0.0),
    smootherState           (FILTERING),
    vnbFrame                (NULL)
@@ -130,6 +132,7 @@ SmootherBase::SmootherBase(const SmootherBase & sb) :
    filter                  (sb.filter),
    filterName              (sb.filterName),
    filterIndex             (sb.filterIndex),
+   backFilterCursor        (sb.backFilterCursor),
    delayFilterRectifySpan  (sb.delayFilterRectifySpan),
    smootherState           (sb.smootherState),
    vnbFrame                (NULL)
@@ -166,6 +169,7 @@ SmootherBase& SmootherBase::operator=(
 
       filterName        = sb.filterName;
       filterIndex       = sb.filterIndex;
+      backFilterCursor  = sb.backFilterCursor;
       delayFilterRectifySpan = sb.delayFilterRectifySpan;
       smootherState     = sb.smootherState;
       vnbFrame          = NULL;
@@ -227,11 +231,11 @@ Integer SmootherBase::GetParameterID(const std::string &str) const
    if (str == "MaximumIterations")
       throw SolverException("Syntax error: '" + GetName() + "' does not has parameter '" + str + "'.\n");
 
-   for (Integer i = EstimatorParamCount; i < SmootherBaseParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - EstimatorParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("SmootherBase", PARAMETER_TEXT,
+         EstimatorParamCount, SmootherBaseParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
 
    return Estimator::GetParameterID(str);
 }
@@ -805,7 +809,7 @@ void SmootherBase::StateCleanUp()
          BeginPredicting(predictTimeSpan);
          filter->TakeAction("RunForwards");
          filter->UpdateCurrentEpoch(currentEpochGT);
-         filter->SetAnchorEpoch(forwardFilterInfo[0].epoch, false);
+         filter->SetAnchorEpoch(forwardFilterInfo->GetSummary(0).epoch, false);
          filter->BeginPredicting(predictTimeSpan);
          currentState = PROPAGATING;
          smootherState = PREDICTING;
@@ -887,7 +891,8 @@ void SmootherBase::PrepareFilter()
    GmatState estimationStateFilterS = esmFilter->GetEstimationState();
 
    // Reset state to estimation epoch
-   SeqEstimator::UpdateInfoType lastState = forwardFilterInfo.back();
+   const SeqEstimator::UpdateInfoType &lastState =
+         forwardFilterInfo->GetSummary(forwardFilterInfo->GetSize() - 1);
 
    estimationEpochGT = lastState.epoch;
    currentEpochGT = lastState.epoch;
@@ -910,15 +915,17 @@ void SmootherBase::PrepareFilter()
 
 
 //------------------------------------------------------------------------------
-//  void SetForwardFilterInfo(std::vector<SeqEstimator::UpdateInfoType> filterInfo)
+//  void SetForwardFilterInfo(const std::shared_ptr<FilterHistory> &filterInfo)
 //------------------------------------------------------------------------------
 /**
  * Passes the filter info from the forward filter pass to the smoother
  *
+ * The history is shared, not copied.
+ *
  * @param filterInfo The filter info to set
  */
  //------------------------------------------------------------------------------
-void SmootherBase::SetForwardFilterInfo(std::vector<SeqEstimator::UpdateInfoType> filterInfo)
+void SmootherBase::SetForwardFilterInfo(const std::shared_ptr<FilterHistory> &filterInfo)
 {
    forwardFilterInfo = filterInfo;
 }
@@ -1268,6 +1275,10 @@ void SmootherBase::CompleteInitialization()
    vnbFrame = CoordinateSystem::CreateLocalCoordinateSystem("VNB", "VNB", body, body,
       (SpacePoint*)satArray[0], body->GetJ2000Body(), solarSystem);
 
+   if (!forwardFilterInfo || forwardFilterInfo->IsEmpty())
+      throw EstimatorException("The smoother " + instanceName + " does not "
+            "have any forward filter data to smooth");
+
    // Trim observations prior to start epoch
    bool obsAtFirstEpoch = false;
    bool atFirstEpoch = true;
@@ -1275,20 +1286,20 @@ void SmootherBase::CompleteInitialization()
 
    while (atFirstEpoch)
    {
-      obsAtFirstEpoch = obsAtFirstEpoch || forwardFilterInfo[ii].isObs;
+      obsAtFirstEpoch = obsAtFirstEpoch || forwardFilterInfo->GetSummary(ii).isObs;
 
       if (obsAtFirstEpoch)
          break; // Don't need to keep checking
 
       ii++; // Go to next item
 
-      if (ii == forwardFilterInfo.size())
+      if (ii == forwardFilterInfo->GetSize())
          break; // Exit, we've reached the end of the vector
 
-      atFirstEpoch = GmatMathUtil::IsEqual(forwardFilterInfo[0].epoch, forwardFilterInfo[ii].epoch, ESTTIME_ROUNDOFF);
+      atFirstEpoch = GmatMathUtil::IsEqual(forwardFilterInfo->GetSummary(0).epoch, forwardFilterInfo->GetSummary(ii).epoch, ESTTIME_ROUNDOFF);
    }
 
-   TrimObsByEpoch(forwardFilterInfo[0].epoch, !obsAtFirstEpoch);
+   TrimObsByEpoch(forwardFilterInfo->GetSummary(0).epoch, !obsAtFirstEpoch);
 
    esm.MapObjectsToVector();
 
@@ -1316,13 +1327,14 @@ void SmootherBase::CompleteInitialization()
    filter->SetRealParameter("DelayRectifyTimeSpan", delayFilterRectifySpan);
 
    // Use edit flags from forward filter for backward filter and smoother
-   for (UnsignedInt ii = 0U; ii < forwardFilterInfo.size(); ii++)
+   for (UnsignedInt ii = 0U; ii < forwardFilterInfo->GetSize(); ii++)
    {
-      if (forwardFilterInfo[ii].isObs)
+      const SeqEstimator::UpdateInfoType &forwardInfo = forwardFilterInfo->GetSummary(ii);
+      if (forwardInfo.isObs)
       {
-         Integer recNum = forwardFilterInfo[ii].measStat.recNum;
-         Integer editFlag = forwardFilterInfo[ii].measStat.editFlag;
-         std::string removedReason = forwardFilterInfo[ii].measStat.removedReason;
+         Integer recNum = forwardInfo.measStat.recNum;
+         Integer editFlag = forwardInfo.measStat.editFlag;
+         std::string removedReason = forwardInfo.measStat.removedReason;
 
          filter->GetMeasurementManager()->GetObsDataObject(recNum)->inUsed = (editFlag == NORMAL_FLAG);
          filter->GetMeasurementManager()->GetObsDataObject(recNum)->removedReason = removedReason;
@@ -1334,12 +1346,14 @@ void SmootherBase::CompleteInitialization()
 
    // Set initial covariance for backwards filter
    Real covarianceIncrease = 1e10;
-   *(filter->GetEstimationStateManager()->GetCovariance()->GetCovariance()) = forwardFilterInfo.back().cov * covarianceIncrease;
+   SeqEstimator::UpdateInfoType lastInfo;
+   forwardFilterInfo->Get(forwardFilterInfo->GetSize() - 1, lastInfo);
+   *(filter->GetEstimationStateManager()->GetCovariance()->GetCovariance()) = lastInfo.cov * covarianceIncrease;
 
    // Complete initialization of backwards filter
    filter->CompleteInitialization();
-   filter->SetAnchorEpoch(forwardFilterInfo[0].epoch, true);
-   filter->TrimObsByEpoch(forwardFilterInfo[0].epoch, false);
+   filter->SetAnchorEpoch(forwardFilterInfo->GetSummary(0).epoch, true);
+   filter->TrimObsByEpoch(forwardFilterInfo->GetSummary(0).epoch, false);
    filter->StateCleanUp();
    currentState = filter->GetState();
 }
@@ -1366,29 +1380,29 @@ void SmootherBase::FindTimeStep()
    }
    else
    {
-      if (filterIndex == forwardFilterInfo.size())
+      if (filterIndex == forwardFilterInfo->GetSize())
       {
          currentState = CHECKINGRUN;
          return;
       }
 
-      if (currentEpochGT == forwardFilterInfo[filterIndex].epoch)
+      if (currentEpochGT == forwardFilterInfo->GetSummary(filterIndex).epoch)
       {
          timeStep = 0;
 
-         if (forwardFilterInfo[filterIndex].isObs)
+         if (forwardFilterInfo->GetSummary(filterIndex).isObs)
             currentState = CALCULATING;
          else
          {
             SmootherUpdate();
             filterIndex++;
-            timeStep = (forwardFilterInfo[filterIndex].epoch - currentEpochGT).GetTimeInSec();
+            timeStep = (forwardFilterInfo->GetSummary(filterIndex).epoch - currentEpochGT).GetTimeInSec();
             currentState = PROPAGATING;
          }
       }
       else
       {
-         timeStep = (forwardFilterInfo[filterIndex].epoch - currentEpochGT).GetTimeInSec();
+         timeStep = (forwardFilterInfo->GetSummary(filterIndex).epoch - currentEpochGT).GetTimeInSec();
          currentState = PROPAGATING;
       }
    }
@@ -1560,9 +1574,13 @@ void SmootherBase::CheckCompletion()
          filter->RunComplete();
          filter->StateCleanUp();
 
+         // Keep the backward history; the filter records its predictions
+         // in a new one
          backwardFilterInfo = filter->GetUpdateStats();
+         filter->ResetUpdateStats();
 
          filterIndex = 0;
+         backFilterCursor = backwardFilterInfo->GetSize();
          MoveToNext(false);
 
          smootherState = SMOOTHING;
@@ -1704,7 +1722,7 @@ void SmootherBase::AdvanceEpoch()
    filterIndex++;
    resetState = true;
 
-   if (filterIndex == forwardFilterInfo.size())
+   if (filterIndex == forwardFilterInfo->GetSize())
    {
       currentState = CHECKINGRUN;
       return;
@@ -33,6 +33,7 @@
 #include "kalman_defs.hpp"
 #include "Estimator.hpp"
 #include "SeqEstimator.hpp"
+#include "FilterHistory.hpp"
 
 /**
  * Provides core functionality used in smoothing.
@@ -120,7 +121,7 @@ public:
 
    SeqEstimator*        GetFilter();
    void                 PrepareFilter();
-   void                 SetForwardFilterInfo(std::vector<SeqEstimator::UpdateInfoType> filterInfo);
+   void                 SetForwardFilterInfo(const std::shared_ptr<FilterHistory> &filterInfo);
 
    virtual bool         ResetState();
    virtual void         MoveToNext(bool includeUpdate);
@@ -135,12 +136,14 @@ protected:
    SeqEstimator *filter;
    std::string  filterName;
 
-   // Filter info
-   std::vector<SeqEstimator::UpdateInfoType> forwardFilterInfo;
-   std::vector<SeqEstimator::UpdateInfoType> backwardFilterInfo;
+   // Filter info, shared with the filters that produced it
+   std::shared_ptr<FilterHistory> forwardFilterInfo;
+   std::shared_ptr<FilterHistory> backwardFilterInfo;
 
    // Filter info index
    UnsignedInt filterIndex;
+   // Backward filter info index past the records matched so far
+   UnsignedInt backFilterCursor;
 
    /// The time duration to delay rectifying the reference trajectory in the filter
    Real delayFilterRectifySpan;
@@ -57,6 +57,7 @@
 // **************************************************************************
 
 #include "BulirschStoer.hpp"
+#include "ParameterIndex.hpp"
 #include "MessageInterface.hpp"
 
 //---------------------------------
@@ -1174,11 +1175,11 @@ std::string BulirschStoer::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer BulirschStoer::GetParameterID(const std::string &str) const
 {
-    for (Integer i = MINIMUM_REDUCTION; i < BulirschStoerParamCount; i++)
-    {
-        if (str == PARAMETER_TEXT[i - IntegratorParamCount])
-            return i;
-    }
+    static const ParameterIndex parameterIndex("BulirschStoer", PARAMETER_TEXT,
+          IntegratorParamCount, BulirschStoerParamCount);
+    Integer id = parameterIndex.Find(str);
+    if (id != -1)
+       return id;
 
     return Integrator::GetParameterID(str);
 }
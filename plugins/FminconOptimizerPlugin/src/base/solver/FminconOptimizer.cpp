@@ -33,6 +33,7 @@
 #include <sstream>                 // for stringstream, istringstream
 #include <stdlib.h>                // for atoi atof, etc.
 #include "FminconOptimizer.hpp"
+#include "ParameterIndex.hpp"
 #include "SolverException.hpp"
 #include "StringUtil.hpp"
 #include "FileManager.hpp"         // for GetAllMatlabFunctionPaths()
@@ -609,11 +610,12 @@ Integer FminconOptimizer::GetParameterID(const std::string &str) const
    }
 
    // part 2:
-   for (Integer i = ExternalOptimizerParamCount; i < FminconOptimizerParamCount; ++i)
-   {
-      if (str == PARAMETER_TEXT[i - ExternalOptimizerParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("FminconOptimizer",
+         PARAMETER_TEXT, ExternalOptimizerParamCount,
+         FminconOptimizerParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
    for (Integer j =0; j < NUM_MATLAB_OPTIONS; j++)
       if (str == ALLOWED_OPTIONS[j])
          return (MATLAB_OPTIONS_OFFSET + j);
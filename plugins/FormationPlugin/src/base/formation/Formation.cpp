@@ -35,6 +35,7 @@
 
 
 #include "Formation.hpp"
+#include "ParameterIndex.hpp"
 #include "StringUtil.hpp"
 #include <algorithm>          // for find()
 #include <stdio.h>            // for sprintf()
@@ -364,11 +365,11 @@ std::string Formation::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer Formation::GetParameterID(const std::string &str) const
 {
-   for (Integer i = SpaceObjectParamCount; i < FormationParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - SpaceObjectParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("Formation", PARAMETER_TEXT,
+         SpaceObjectParamCount, FormationParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
    
    return FormationInterface::GetParameterID(str);
 }
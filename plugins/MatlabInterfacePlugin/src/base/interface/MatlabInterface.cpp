@@ -47,6 +47,7 @@
 #endif
 
 #include "MatlabInterface.hpp"
+#include "ParameterIndex.hpp"
 #include "InterfaceException.hpp"
 #include "GmatGlobal.hpp"          // for IsMatlabDebugOn()
 #include "StringUtil.hpp"          // for DecomposeBy()
@@ -1278,11 +1279,11 @@ int MatlabInterface::CloseSingleEngine(const std::string &name)
 //------------------------------------------------------------------------------
 Integer MatlabInterface::GetParameterID(const std::string &str) const
 {
-   for (Integer i = InterfaceParamCount; i < MatlabInterfaceParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - InterfaceParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("MatlabInterface", PARAMETER_TEXT,
+         InterfaceParamCount, MatlabInterfaceParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
    
    return Interface::GetParameterID(str);
 }
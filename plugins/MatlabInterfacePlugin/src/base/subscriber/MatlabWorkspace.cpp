@@ -31,6 +31,7 @@
 //------------------------------------------------------------------------------
 
 #include "MatlabWorkspace.hpp"
+#include "ParameterIndex.hpp"
 #include "SubscriberException.hpp"
 #include "Parameter.hpp"
 #include "StringUtil.hpp"          // for ToString()
@@ -277,11 +278,11 @@ std::string MatlabWorkspace::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer MatlabWorkspace::GetParameterID(const std::string &str) const
 {
-    for (Integer i = SubscriberParamCount; i < MatlabWorkspaceParamCount; i++)
-    {
-        if (str == PARAMETER_TEXT[i - SubscriberParamCount])
-            return i;
-    }
+    static const ParameterIndex parameterIndex("MatlabWorkspace",
+          PARAMETER_TEXT, SubscriberParamCount, MatlabWorkspaceParamCount);
+    Integer id = parameterIndex.Find(str);
+    if (id != -1)
+       return id;
 
     return Subscriber::GetParameterID(str);
 }
@@ -13,6 +13,7 @@
 #include "MessageInterface.hpp"
 
 #include "PolyhedronGravityModel.hpp"
+#include "ParameterIndex.hpp"
 #include "Rmatrix33.hpp"
 #include "Rmatrix66.hpp"
 
@@ -716,13 +717,12 @@ Integer PolyhedronGravityModel::GetParameterID(const std::string &str) const
    if (alias == "Gravity")
       alias = "PrimaryBodies";
 
-   for (int i = GravityBaseParamCount; i < PolyhedronGravityModelParamCount; i++)
-   {
-      if (alias == PARAMETER_TEXT[i - GravityBaseParamCount])
-      {
-         return i;
-      }
-   }
+   static const ParameterIndex parameterIndex("PolyhedronGravityModel",
+         PARAMETER_TEXT, GravityBaseParamCount,
+         PolyhedronGravityModelParamCount);
+   Integer id = parameterIndex.Find(alias);
+   if (id != -1)
+      return id;
 
    return GravityBase::GetParameterID(str);
 }
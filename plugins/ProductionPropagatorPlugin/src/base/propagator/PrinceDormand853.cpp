@@ -30,6 +30,73 @@
 #include "gmatdefs.hpp"
 #include "PrinceDormand853.hpp"
 
+//---------------------------------
+// static data
+//---------------------------------
+
+namespace
+{
+   // Dense output coefficients from Hairer, Norsett and Wanner (DOP853).  The
+   // continuous extension uses the 12 stages of the step, the derivative at
+   // the end of the step (stage 13 below), and three more stages.
+
+   /// Time fractions of the three extra stages
+   const Real DENSE_AI[3] = { 0.1, 0.2, 0.777777777777777 };
+
+   /// Coefficients of the extra stages, indexed by stage 0 - 14
+   const Real DENSE_BIJ[3][15] =
+   {
+      {  0.05616750228304790000, 0.0, 0.0, 0.0, 0.0, 0.0,
+         0.25350021021662400000, -0.24623903747080200000,
+        -0.12419142326381600000,  0.15329179827876500000,
+         0.00820105229563468000,  0.00756789766054569000,
+        -0.00829800000000000000, 0.0, 0.0 },
+      {  0.03183464816350210000, 0.0, 0.0, 0.0, 0.0,
+         0.02830090967236670000,  0.05354198830743850000,
+        -0.05492374857139090000, 0.0, 0.0,
+        -0.00010834732869724900,  0.00038257109083565800,
+        -0.00034046500868740400,  0.14131244367463200000, 0.0 },
+      { -0.42889630158379100000, 0.0, 0.0, 0.0, 0.0,
+        -4.69762141536116000000,  7.68342119606259000000,
+         4.06898981839711000000,  0.35672718745528100000, 0.0, 0.0, 0.0,
+        -0.00139902416515901000,  2.94751478915277000000,
+        -9.15095847217987000000 }
+   };
+
+   /// Weights of the four highest order terms of the interpolant, by stage
+   const Real DENSE_D[4][16] =
+   {
+      { -8.4289382761090128651, 0.0, 0.0, 0.0, 0.0,
+         0.56671495351937776963, -3.0689499459498916913,
+         2.3846676565120698288,   2.1170345824450282767,
+        -0.87139158377797299207,  2.2404374302607882759,
+         0.63157877876946881816, -0.088990336451333310821,
+        18.148505520854727257,   -9.1946323924783554000,
+        -4.4360363875948939664 },
+      { 10.427508642579134603, 0.0, 0.0, 0.0, 0.0,
+       242.28349177525818288,   165.20045171727028199,
+      -374.54675472269020280,   -22.113666853125306036,
+         7.7334326684722638390, -30.674084731089398182,
+        -9.3321305264302278730,  15.697238121770843886,
+       -31.139403219565177677,   -9.3529243588444783866,
+        35.816841486394083752 },
+      { 19.985053242002433821, 0.0, 0.0, 0.0, 0.0,
+      -387.03730874935176555,  -189.17813819516756883,
+       527.80815920542364901,   -11.573902539959630126,
+         6.8812326946963000170,  -1.0006050966910838403,
+         0.77771377980534432093, -2.7782057523535084066,
+       -60.196695231264120758,   84.320405506677161018,
+        11.992291136182789328 },
+      { -25.693933462703749003, 0.0, 0.0, 0.0, 0.0,
+      -154.18974869023643374,  -231.52937917604549568,
+       357.63911791061412378,    93.405324183624310004,
+       -37.458323136451633157,  104.09964950896230045,
+        29.840293426660503124,  -43.533456590011143754,
+        96.324553959188282949,  -39.177261675615439165,
+      -149.72683625798562581 }
+   };
+}
+
 //---------------------------------
 // public
 //---------------------------------
@@ -42,7 +109,6 @@
  */
 //------------------------------------------------------------------------------
 PrinceDormand853::PrinceDormand853(const std::string &nomme) :
-//   RungeKutta      (16, 8, "PrinceDormand853", nomme)
    RungeKutta      (12, 8, "PrinceDormand853", nomme)
 {
 }
@@ -85,6 +151,7 @@ PrinceDormand853 & PrinceDormand853::operator=(const PrinceDormand853& rk)
         return *this;
 
     RungeKutta::operator=(rk);
+    denseTerms.clear();
 
     return *this;
 }
@@ -102,10 +169,118 @@ Propagator* PrinceDormand853::Clone() const
     return new PrinceDormand853(*this);
 }
 
+//------------------------------------------------------------------------------
+// bool GetDenseState(Real atTime, Real *state)
+//------------------------------------------------------------------------------
+/**
+ * Evaluates the seventh order continuous extension of the last step.
+ *
+ * The first query of a step evaluates the end derivative and the three extra
+ * stages; later queries of the same step only evaluate the polynomial.
+ *
+ * @param atTime The elapsed time of the requested state
+ * @param state  The interpolated state (output)
+ *
+ * @return true on success, false if there is no dense output
+ */
+//------------------------------------------------------------------------------
+bool PrinceDormand853::GetDenseState(Real atTime, Real *state)
+{
+   if (!denseOutputValid || (denseStepSize == 0.0))
+      return false;
+
+   if (!denseEndDerivativeValid)
+      if (!CompleteDenseStep())
+         return false;
+
+   Real s  = (atTime - denseStartTime) / denseStepSize;
+   Real s1 = 1.0 - s;
+   const Real *r = &denseTerms[0];
+   for (Integer i = 0; i < dimension; ++i)
+   {
+      Real conv = r[4*dimension+i] + s * (r[5*dimension+i] +
+                  s1 * (r[6*dimension+i] + s * r[7*dimension+i]));
+      state[i] = r[i] + s * (r[dimension+i] + s1 * (r[2*dimension+i] +
+                 s * (r[3*dimension+i] + s1 * conv)));
+   }
+
+   return true;
+}
+
 //---------------------------------
 // protected
 //---------------------------------
 
+//------------------------------------------------------------------------------
+// bool CompleteDenseStep()
+//------------------------------------------------------------------------------
+/**
+ * Evaluates the end derivative and the extra stages of the last step, and
+ * builds the terms of its interpolating polynomial.
+ *
+ * @return true on success
+ */
+//------------------------------------------------------------------------------
+bool PrinceDormand853::CompleteDenseStep()
+{
+   if (!RungeKutta::CompleteDenseStep())
+      return false;
+
+   Real h = denseStepSize;
+
+   // Stages 12 (the end derivative) through 15, scaled by the step like ki
+   std::vector<RealArray> extra(4, RealArray(dimension));
+   for (Integer j = 0; j < dimension; ++j)
+      extra[0][j] = h * denseEndDerivative[j];
+
+   RealArray stage(dimension);
+   for (Integer s = 0; s < 3; ++s)
+   {
+      for (Integer j = 0; j < dimension; ++j)
+      {
+         Real sum = 0.0;
+         for (Integer k = 0; k < 12; ++k)
+            sum += DENSE_BIJ[s][k] * ki[k][j];
+         for (Integer k = 12; k < 13 + s; ++k)
+            sum += DENSE_BIJ[s][k] * extra[k-12][j];
+         stage[j] = denseStartState[j] + sum;
+      }
+
+      if (!EvaluateDenseDerivative(&stage[0],
+            denseStartTime + DENSE_AI[s] * h, &extra[s+1][0]))
+      {
+         denseEndDerivativeValid = false;
+         return false;
+      }
+      for (Integer j = 0; j < dimension; ++j)
+         extra[s+1][j] *= h;
+   }
+
+   denseTerms.resize(8 * dimension);
+   for (Integer j = 0; j < dimension; ++j)
+   {
+      Real ydiff = denseEndState[j] - denseStartState[j];
+      Real bspl  = ki[0][j] - ydiff;
+
+      denseTerms[j]               = denseStartState[j];
+      denseTerms[dimension+j]     = ydiff;
+      denseTerms[2*dimension+j]   = bspl;
+      denseTerms[3*dimension+j]   = ydiff - extra[0][j] - bspl;
+
+      for (Integer t = 0; t < 4; ++t)
+      {
+         Real sum = 0.0;
+         for (Integer k = 0; k < 12; ++k)
+            sum += DENSE_D[t][k] * ki[k][j];
+         for (Integer k = 12; k < 16; ++k)
+            sum += DENSE_D[t][k] * extra[k-12][j];
+         denseTerms[(4+t)*dimension+j] = sum;
+      }
+   }
+
+   return true;
+}
+
 
 //------------------------------------------------------------------------------
 // void SetCoefficients()
@@ -135,14 +310,6 @@ void PrinceDormand853::SetCoefficients()
     ai[11] = 1.0; //0.0;      // Per Hairer, Norsett and Wanner, ai[11] = 1.0
                               // (eq 5.25b; their C_12 is GMAT's ai[11])
 
-    if (stages == 16)         // Coefficients 12-15 are used in dense output
-    {
-       ai[12] =  0.0;
-       ai[13] =  0.1;
-       ai[14] =  0.2;
-       ai[15] =  0.777777777777777;
-    }
-
     bij[0][0] = 0.0;
 
     bij[1][0] = 0.0526001519587677;
@@ -221,68 +388,7 @@ void PrinceDormand853::SetCoefficients()
     bij[11][8] = -8.87285693353062000000;
     bij[11][9] = 12.36056717579430000000;
     bij[11][10] = 0.64339274601576300000;
-            
-    if (stages == 16)
-    {
-       bij[12][0] = 0.0;
-       bij[12][1] = 0.0;
-       bij[12][2] = 0.0;
-       bij[12][3] = 0.0;
-       bij[12][4] = 0.0;
-       bij[12][5] = 0.0;
-       bij[12][6] = 0.0;
-       bij[12][7] = 0.0;
-       bij[12][8] = 0.0;
-       bij[12][9] = 0.0;
-       bij[12][10] = 0.0;
-       bij[12][11] = 0.0;
-
-       bij[13][0] = 0.05616750228304790000;
-       bij[13][1] = 0.0;
-       bij[13][2] = 0.0;
-       bij[13][3] = 0.0;
-       bij[13][4] = 0.0;
-       bij[13][5] = 0.0;
-       bij[13][6] = 0.25350021021662400000;
-       bij[13][7] = -0.24623903747080200000;
-       bij[13][8] = -0.12419142326381600000;
-       bij[13][9] = 0.15329179827876500000;
-       bij[13][10] = 0.00820105229563468000;
-       bij[13][11] = 0.00756789766054569000;
-       bij[13][12] = -0.00829800000000000000;
-
-       bij[14][0] = 0.03183464816350210000;
-       bij[14][1] = 0.0;
-       bij[14][2] = 0.0;
-       bij[14][3] = 0.0;
-       bij[14][4] = 0.0;
-       bij[14][5] = 0.02830090967236670000;
-       bij[14][6] = 0.05354198830743850000;
-       bij[14][7] = -0.05492374857139090000;
-       bij[14][8] = 0.0;
-       bij[14][9] = 0.0;
-       bij[14][10] = -0.00010834732869724900;
-       bij[14][11] = 0.00038257109083565800;
-       bij[14][12] = -0.00034046500868740400;
-       bij[14][13] = 0.14131244367463200000;
-
-       bij[15][0] = -0.42889630158379100000;
-       bij[15][1] = 0.0;
-       bij[15][2] = 0.0;
-       bij[15][3] = 0.0;
-       bij[15][4] = 0.0;
-       bij[15][5] = -4.69762141536116000000;
-       bij[15][6] = 7.68342119606259000000;
-       bij[15][7] = 4.06898981839711000000;
-       bij[15][8] = 0.35672718745528100000;
-       bij[15][9] = 0.0;
-       bij[15][10] = 0.0;
-       bij[15][11] = 0.0;
-       bij[15][12] = -0.00139902416515901000;
-       bij[15][13] = 2.94751478915277000000;
-       bij[15][14] = -9.15095847217987000000;
-    }
-	
+
     cj[0] = 0.05429373411656870000;
     cj[1] =  0.0;
     cj[2] =  0.0;
@@ -296,12 +402,6 @@ void PrinceDormand853::SetCoefficients()
     cj[10] = 0.20136540080403000000;
     cj[11] = 0.04471061572777250000;
 
-    if (stages == 16)
-    {
-       // Zero remaining coefficients
-       cj[12] = cj[13] = cj[14] = cj[15] = 0.0;
-    }
-
     ee[0] = 0.01312004499419480000;
     ee[1] =  0.0;
     ee[2] =  0.0;
@@ -314,10 +414,4 @@ void PrinceDormand853::SetCoefficients()
     ee[9] = 0.33417911871301700000;
     ee[10] = 0.08192320648511570000;
     ee[11] = -0.02235530786388620000;
-
-    if (stages == 16)
-    {
-       // Zero remaining coefficients
-       ee[12] = ee[13] = ee[14] = ee[15] = 0.0;
-    }
 }
@@ -48,8 +48,13 @@ public:
     PrinceDormand853 & operator=(const PrinceDormand853&);
 
     virtual Propagator* Clone() const;
+    virtual bool                GetDenseState(Real atTime, Real *state);
 protected:
+    /// Terms of the interpolating polynomial of the last step, 8 per element
+    RealArray                   denseTerms;
+
     void                        SetCoefficients();
+    virtual bool                CompleteDenseStep();
 
 };
 
@@ -30,6 +30,7 @@
 //------------------------------------------------------------------------------
 
 #include "Save.hpp"
+#include "ParameterIndex.hpp"
 #include "FileManager.hpp"      // for GetPathname()
 #include "MessageInterface.hpp"
 #include "GmatGlobal.hpp"       // for GetDataPrecision()
@@ -154,11 +155,11 @@ std::string Save::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer Save::GetParameterID(const std::string &str) const
 {
-   for (int i=GmatCommandParamCount; i<SaveParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatCommandParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("Save", PARAMETER_TEXT,
+         GmatCommandParamCount, SaveParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
    
    return GmatCommand::GetParameterID(str);
 }
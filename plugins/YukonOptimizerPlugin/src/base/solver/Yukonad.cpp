@@ -27,6 +27,7 @@
 
 #include <sstream>
 #include "Yukonad.hpp"
+#include "ParameterIndex.hpp"
 #include "MessageInterface.hpp"
 
 //#define DEBUG_Yukonad
@@ -48,7 +49,8 @@ Yukonad::PARAMETER_TEXT[YukonadParamCount - OptimizerParamCount] =
    "MaximumFunctionEvals",
    "OptimalityTolerance",
    "FunctionTolerance",
-   "MaximumElasticWeight"
+   "MaximumElasticWeight",
+   "PerturbationWorkers"
 };
 
 const Gmat::ParameterType
@@ -61,6 +63,7 @@ Yukonad::PARAMETER_TYPE[YukonadParamCount - OptimizerParamCount] =
    Gmat::INTEGER_TYPE,
    Gmat::REAL_TYPE,
    Gmat::REAL_TYPE,
+   Gmat::INTEGER_TYPE,
    Gmat::INTEGER_TYPE
 };
 
@@ -246,6 +249,9 @@ bool Yukonad::IsParameterReadOnly(const Integer id) const
       return true;
    if (id == OPTIMIZER_TOLERANCE)
       return true;
+   // Only written when concurrent perturbation passes are requested
+   if ((id == perturbationWorkersID) && (perturbationWorkers == 1))
+      return true;
 
    return InternalOptimizer::IsParameterReadOnly(id);
 }
@@ -342,11 +348,11 @@ std::string Yukonad::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer Yukonad::GetParameterID(const std::string &str) const
 {
-   for (Integer i = InternalOptimizerParamCount; i < YukonadParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - InternalOptimizerParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("Yukonad", PARAMETER_TEXT,
+         InternalOptimizerParamCount, YukonadParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
 
    return InternalOptimizer::GetParameterID(str);
 }
@@ -680,6 +686,10 @@ Integer Yukonad::GetIntegerParameter(const Integer id) const
    {
       return maximumElasticWeight;
    }
+   if (id == perturbationWorkersID)
+   {
+      return perturbationWorkers;
+   }
 
    return Solver::GetIntegerParameter(id);
 }
@@ -735,6 +745,23 @@ Integer Yukonad::SetIntegerParameter(const Integer id,
       return maximumElasticWeight;
    }
 
+   if (id == perturbationWorkersID)
+   {
+      if (value > 0)
+         perturbationWorkers = value;
+      else
+      {
+         char msg[512];
+         std::stringstream val;
+         val << value;
+         std::sprintf(msg, errorMessageFormat.c_str(), val.str().c_str(),
+            PARAMETER_TEXT[id - InternalOptimizerParamCount].c_str(),
+            "Integer > 0");
+         throw SolverException(msg);
+      }
+      return perturbationWorkers;
+   }
+
    return InternalOptimizer::SetIntegerParameter(id, value);
 }
 
@@ -1043,6 +1070,9 @@ void Yukonad::SetResultValue(Integer id, Real value,
       "value = %.12f\n", id, resultType.c_str(), value);
 #endif
 
+   if (RecordResult(id, value, resultType))
+      return;
+
    bool plusEffect = true;
    if (useCentralDifferences && (currentPertState == -1))
       plusEffect = false;
@@ -1244,9 +1274,6 @@ void Yukonad::RunPerturbation()
          return;
       }
 
-      lastUnperturbedValue = variable.at(pertNumber);
-      variable.at(pertNumber) += perturbation.at(pertNumber);
-      pertDirection.at(pertNumber) = 1.0;
    }
    else
    {
@@ -1284,20 +1311,9 @@ void Yukonad::RunPerturbation()
          return;
       }
 
-      lastUnperturbedValue = variable.at(pertNumber);
-      if (currentPertState == 1)
-      {
-         variable.at(pertNumber) += perturbation.at(pertNumber);
-         pertDirection.at(pertNumber) = 1.0;
-      }
-
-      if (currentPertState == -1)
-      {
-         variable.at(pertNumber) -= perturbation.at(pertNumber);
-         pertDirection.at(pertNumber) = 1.0;
-      }
    }
 
+   ApplyPerturbation();
    WriteToTextFile();
 
 #ifdef DEBUG_YUKON_PERT
@@ -1307,6 +1323,103 @@ void Yukonad::RunPerturbation()
 }
 
 
+//------------------------------------------------------------------------------
+// void ApplyPerturbation()
+//------------------------------------------------------------------------------
+/**
+* Perturbs the variable indexed by pertNumber, in the direction given by
+* currentPertState when central differencing
+*/
+//------------------------------------------------------------------------------
+void Yukonad::ApplyPerturbation()
+{
+   lastUnperturbedValue = variable.at(pertNumber);
+   if (useCentralDifferences && (currentPertState == -1))
+      variable.at(pertNumber) -= perturbation.at(pertNumber);
+   else
+      variable.at(pertNumber) += perturbation.at(pertNumber);
+   pertDirection.at(pertNumber) = 1.0;
+}
+
+
+//------------------------------------------------------------------------------
+// Integer GetPerturbationPassCount()
+//------------------------------------------------------------------------------
+/**
+* Returns the number of perturbation passes used to build the gradient and
+* constraint Jacobian
+*
+* The passes are reported only when the first perturbation of a set has just
+* been applied.  With central differencing, pass 2i is the forward
+* perturbation of variable i and pass 2i+1 its backward perturbation.
+*
+* @return The number of passes, or 0 if the set is not at its start
+*/
+//------------------------------------------------------------------------------
+Integer Yukonad::GetPerturbationPassCount()
+{
+   if ((currentState != PERTURBING) || (pertNumber != 0))
+      return 0;
+   if (useCentralDifferences && (currentPertState != 1))
+      return 0;
+
+   return (useCentralDifferences ? 2 * variableCount : variableCount);
+}
+
+
+//------------------------------------------------------------------------------
+// bool SetPerturbationPass(Integer pass)
+//------------------------------------------------------------------------------
+/**
+* Backs out the current perturbation and applies the one for a pass
+*
+* @param pass The pass; see GetPerturbationPassCount()
+*
+* @return true if the pass was applied
+*/
+//------------------------------------------------------------------------------
+bool Yukonad::SetPerturbationPass(Integer pass)
+{
+   Integer passCount = (useCentralDifferences ? 2 * variableCount :
+      variableCount);
+   if ((currentState != PERTURBING) || (pass < 0) || (pass >= passCount))
+      return false;
+
+   if (pertNumber != -1)
+      variable.at(pertNumber) = lastUnperturbedValue;
+
+   if (useCentralDifferences)
+   {
+      pertNumber = pass / 2;
+      currentPertState = (pass % 2 == 0 ? 1 : -1);
+   }
+   else
+      pertNumber = pass;
+
+   ApplyPerturbation();
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// void CompletePerturbationPasses()
+//------------------------------------------------------------------------------
+/**
+* Backs out the last perturbation and moves the state machine on to the
+* parameter calculation
+*/
+//------------------------------------------------------------------------------
+void Yukonad::CompletePerturbationPasses()
+{
+   if (pertNumber != -1)
+      variable.at(pertNumber) = lastUnperturbedValue;
+
+   pertNumber = -1;
+   currentPertState = 0;
+   currentState = CALCULATING;
+}
+
+
 //------------------------------------------------------------------------------
 // void CalculateParameters()
 //------------------------------------------------------------------------------
@@ -115,6 +115,9 @@ public:
       const std::string &type = "");
    virtual void         SetResultValue(Integer id, Real value,
       const std::string &resultType = "");
+   virtual Integer      GetPerturbationPassCount();
+   virtual bool         SetPerturbationPass(Integer pass);
+   virtual void         CompletePerturbationPasses();
    virtual GmatBase*    Clone() const;
    virtual bool         TakeAction(const std::string &action,
       const std::string &actionData = "");
@@ -136,6 +139,7 @@ public:
       optimalityToleranceID,
       functionToleranceID,
       maximumElasticWeightID,
+      perturbationWorkersID,
       YukonadParamCount
    };
 
@@ -176,6 +180,7 @@ protected:
    // State machine methods
    virtual void                  RunNominal();
    virtual void                  RunPerturbation();
+   void                          ApplyPerturbation();
    virtual void                  CalculateParameters();
    virtual void                  CheckCompletion();
    virtual void                  RunComplete();
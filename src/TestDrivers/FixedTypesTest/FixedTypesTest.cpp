@@ -0,0 +1,345 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                               FixedTypesTest
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/16
+//
+/**
+ * Test of the FixedVector and FixedMatrix types.
+ *
+ * Every operation is compared with the same operation on Rvector3 and
+ * Rmatrix33, and the Rvector and Rmatrix conversions are checked for their
+ * size checks.  The global operator new is replaced by a counting one, so
+ * that the test can check that the fixed types do not touch the heap, and
+ * that the state conversions built on them allocate only their result.
+ *
+ * The program returns 0 when every check passes.
+ */
+//------------------------------------------------------------------------------
+
+#include "FixedVector.hpp"
+#include "FixedMatrix.hpp"
+#include "Rvector3.hpp"
+#include "Rvector6.hpp"
+#include "Rmatrix33.hpp"
+#include "StateConversionUtil.hpp"
+#include "TestHarness.hpp"
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+
+namespace
+{
+   /// Number of calls to the global operator new since the last reset
+   Integer allocations = 0;
+
+   bool Near(Real a, Real b, Real tol = 1.0e-14)
+   {
+      return std::fabs(a - b) <= tol * (1.0 + std::fabs(b));
+   }
+
+   template <Integer N>
+   bool Near(const FixedVector<N> &a, const Rvector &b, Real tol = 1.0e-14)
+   {
+      if (b.GetSize() != N)
+         return false;
+      for (Integer i = 0; i < N; ++i)
+         if (!Near(a[i], b[i], tol))
+            return false;
+      return true;
+   }
+
+   bool Near(const FixedMatrix33 &a, const Rmatrix33 &b)
+   {
+      for (Integer i = 0; i < 3; ++i)
+         for (Integer j = 0; j < 3; ++j)
+            if (!Near(a(i,j), b(i,j)))
+               return false;
+      return true;
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// Counting replacements of the global allocation functions
+//------------------------------------------------------------------------------
+void* operator new(std::size_t size)
+{
+   ++allocations;
+   void *p = std::malloc(size == 0 ? 1 : size);
+   if (p == NULL)
+      throw std::bad_alloc();
+   return p;
+}
+
+void* operator new[](std::size_t size)
+{
+   return operator new(size);
+}
+
+void operator delete(void *p) noexcept
+{
+   std::free(p);
+}
+
+void operator delete[](void *p) noexcept
+{
+   std::free(p);
+}
+
+void operator delete(void *p, std::size_t /*size*/) noexcept
+{
+   std::free(p);
+}
+
+void operator delete[](void *p, std::size_t /*size*/) noexcept
+{
+   std::free(p);
+}
+
+
+//------------------------------------------------------------------------------
+// void TestVector()
+//------------------------------------------------------------------------------
+/**
+ * Checks the FixedVector operations against Rvector3.
+ */
+//------------------------------------------------------------------------------
+void TestVector()
+{
+   Rvector3 ra(1.5, -2.0, 0.25), rb(-0.75, 3.0, 4.0);
+   FixedVector<3> a(ra), b(rb);
+
+   Check(Near(a, ra) && Near(b, rb), "vector from Rvector3");
+   Check(Near(FixedVector<3>(ra.GetDataVector()), ra), "vector from array");
+   Check(Near(FixedVector<3>(), Rvector3(0.0, 0.0, 0.0)), "zero vector");
+   Check(Near(-a, -ra), "vector negation");
+   Check(Near(a + b, ra + rb), "vector sum");
+   Check(Near(a - b, ra - rb), "vector difference");
+   Check(Near(a * 2.5, ra * 2.5), "vector times scalar");
+   Check(Near(2.5 * a, 2.5 * ra), "scalar times vector");
+   Check(Near(a / 4.0, ra / 4.0), "vector over scalar");
+   Check(Near(a * b, ra * rb), "dot product");
+   Check(Near(Cross(a, b), Cross(ra, rb)), "cross product");
+   Check(Near(a.GetMagnitude(), ra.GetMagnitude()), "magnitude");
+   Check(Near(a.GetUnitVector(), ra.GetUnitVector()), "unit vector");
+
+   FixedVector<3> c = a;
+   c += b;
+   Check(Near(c, ra + rb), "vector +=");
+   c -= b;
+   c -= b;
+   Check(Near(c, ra - rb), "vector -=");
+   c *= 3.0;
+   Check(Near(c, (ra - rb) * 3.0), "vector *=");
+   c /= 3.0;
+   Check(Near(c, ra - rb), "vector /=");
+   c.Normalize();
+   Check(Near(c, (ra - rb).GetUnitVector()), "vector Normalize");
+
+   bool threw = false;
+   try
+   {
+      FixedVector<3>().GetUnitVector();
+   }
+   catch (Rvector::ZeroVector &)
+   {
+      threw = true;
+   }
+   Check(threw, "unit vector of zero throws ZeroVector");
+
+   // Conversions check the size
+   Rvector6 r6(7000.0, 100.0, -50.0, 0.1, 7.5, 1.2);
+   FixedVector<6> f6(r6);
+   Check(Near(f6, r6), "vector from Rvector6");
+   Rvector6 back;
+   f6.CopyTo(back);
+   Check(Near(f6, back), "vector CopyTo");
+
+   threw = false;
+   try
+   {
+      FixedVector<3> wrong(r6);
+   }
+   catch (ArrayTemplateExceptions::DimensionError &)
+   {
+      threw = true;
+   }
+   Check(threw, "vector from a wrong sized Rvector throws");
+
+   threw = false;
+   try
+   {
+      a.CopyTo(back);
+   }
+   catch (ArrayTemplateExceptions::DimensionError &)
+   {
+      threw = true;
+   }
+   Check(threw, "vector CopyTo a wrong sized Rvector throws");
+}
+
+
+//------------------------------------------------------------------------------
+// void TestMatrix()
+//------------------------------------------------------------------------------
+/**
+ * Checks the FixedMatrix operations against Rmatrix33.
+ */
+//------------------------------------------------------------------------------
+void TestMatrix()
+{
+   Rmatrix33 ra(2.0, -1.0, 0.5,  0.25, 3.0, -2.0,  1.0, 0.0, 4.0);
+   Rmatrix33 rb(-1.0, 0.5, 2.0,  3.0, 1.5, -0.5,  0.0, 2.0, 1.0);
+   Rvector3  rv(0.3, -1.2, 2.2);
+   FixedMatrix33 a(ra), b(rb);
+   FixedVector<3> v(rv);
+
+   Check(Near(a, ra) && Near(b, rb), "matrix from Rmatrix33");
+   Check(Near(FixedMatrix33(ra.GetDataVector()), ra), "matrix from array");
+   Check(Near(FixedMatrix33(2.0, -1.0, 0.5,  0.25, 3.0, -2.0,  1.0, 0.0, 4.0),
+         ra), "matrix from elements");
+   Check(Near(FixedMatrix33(), Rmatrix33(true)), "identity matrix");
+   Check(Near(FixedMatrix33(false), Rmatrix33(false)), "zero matrix");
+   Check(Near(a.Transpose(), ra.Transpose()), "matrix transpose");
+   Check(Near(a + b, ra + rb), "matrix sum");
+   Check(Near(a - b, ra - rb), "matrix difference");
+   Check(Near(a * 1.5, ra * 1.5), "matrix times scalar");
+   Check(Near(1.5 * a, 1.5 * ra), "scalar times matrix");
+   Check(Near(a * b, ra * rb), "matrix product");
+   Check(Near(a * v, ra * rv), "matrix times vector");
+   Check(Near(a.TransposeTimes(v), ra.Transpose() * rv),
+         "transpose times vector");
+
+   FixedMatrix33 c = a;
+   c += b;
+   Check(Near(c, ra + rb), "matrix +=");
+   c -= b;
+   c -= b;
+   Check(Near(c, ra - rb), "matrix -=");
+   c *= 2.0;
+   Check(Near(c, (ra - rb) * 2.0), "matrix *=");
+
+   Rmatrix33 back(false);
+   a.CopyTo(back);
+   Check(Near(a, back), "matrix CopyTo");
+
+   bool threw = false;
+   try
+   {
+      FixedMatrix33 wrong(Rmatrix(2, 3));
+   }
+   catch (TableTemplateExceptions::DimensionError &)
+   {
+      threw = true;
+   }
+   Check(threw, "matrix from a wrong sized Rmatrix throws");
+
+   threw = false;
+   try
+   {
+      Rmatrix wrong(3, 2);
+      a.CopyTo(wrong);
+   }
+   catch (TableTemplateExceptions::DimensionError &)
+   {
+      threw = true;
+   }
+   Check(threw, "matrix CopyTo a wrong sized Rmatrix throws");
+}
+
+
+//------------------------------------------------------------------------------
+// void TestAllocations()
+//------------------------------------------------------------------------------
+/**
+ * Checks that the fixed types stay off the heap, and counts the allocations
+ * of the state conversions that use them.
+ */
+//------------------------------------------------------------------------------
+void TestAllocations()
+{
+   FixedVector<3> a(1.5, -2.0, 0.25), b(-0.75, 3.0, 4.0);
+   FixedMatrix33 m(2.0, -1.0, 0.5,  0.25, 3.0, -2.0,  1.0, 0.0, 4.0);
+
+   allocations = 0;
+   FixedVector<3> u = Cross(a, b).GetUnitVector() * (a * b) - a / 3.0;
+   FixedMatrix33 p = m * m.Transpose() + 2.0 * m;
+   FixedVector<3> w = p * u + m.TransposeTimes(b);
+   Integer fixedCount = allocations;
+   Check(fixedCount == 0, "fixed type arithmetic allocates nothing");
+   Check(w.GetMagnitude() > 0.0, "fixed type arithmetic result");
+
+   const Real mu = 398600.4415;
+   Rvector6 cart(7100.0, 1200.0, -1300.0, 0.5, 7.0, 1.5);
+
+   allocations = 0;
+   Rvector6 equi = StateConversionUtil::CartesianToEquinoctial(cart, mu);
+   Integer toEquiCount = allocations;
+
+   allocations = 0;
+   Rvector6 cart2 = StateConversionUtil::EquinoctialToCartesian(equi, mu);
+   Integer fromEquiCount = allocations;
+
+   allocations = 0;
+   Rvector6 kep = StateConversionUtil::CartesianToKeplerian(mu, cart,
+         StateConversionUtil::TA);
+   Integer toKepCount = allocations;
+
+   std::cout << "Heap allocations per call: fixed type arithmetic "
+             << fixedCount << ", CartesianToEquinoctial " << toEquiCount
+             << ", EquinoctialToCartesian " << fromEquiCount
+             << ", CartesianToKeplerian(Rvector6) " << toKepCount << "\n";
+
+   // Only the returned Rvector6 is allocated
+   Check(toEquiCount == 1, "CartesianToEquinoctial allocates its result only");
+   Check(fromEquiCount == 1, "EquinoctialToCartesian allocates its result only");
+   Check(toKepCount == 1, "CartesianToKeplerian allocates its result only");
+
+   FixedVector<6> round(cart2);
+   Check(Near(round, cart, 1.0e-12), "equinoctial round trip");
+
+   Rvector6 cart3 = StateConversionUtil::KeplerianToCartesian(mu, kep,
+         StateConversionUtil::TA);
+   Check(Near(FixedVector<6>(cart3), cart, 1.0e-12), "Keplerian round trip");
+}
+
+
+//------------------------------------------------------------------------------
+// int main()
+//------------------------------------------------------------------------------
+int main()
+{
+   try
+   {
+      TestVector();
+      TestMatrix();
+      TestAllocations();
+   }
+   catch (BaseException &ex)
+   {
+      Check(false, ex.GetFullMessage());
+   }
+
+   return TestHarness::Finish("Fixed-size types");
+}
@@ -0,0 +1,273 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                           GaussJacksonBenchmark
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/16
+//
+/**
+ * Benchmark comparing the GaussJackson integrator with PrinceDormand78 on a
+ * long LEO propagation under point mass plus J2 gravity.
+ *
+ * Each integrator runs at a range of Accuracy settings; the report gives the
+ * force model evaluation count, the wall time and the final position error
+ * against a tight RungeKutta89 reference, so the evaluation counts can be
+ * compared at equal accuracy.  The state is requested every OutputInterval
+ * seconds through Step(dt), as Propagate does for fixed-interval output.
+ *
+ * At every Accuracy setting, GaussJackson must finish with fewer evaluations
+ * and no larger position error than PrinceDormand78; the program returns 1
+ * when it does not.
+ *
+ * Usage: GaussJacksonBenchmark [days] [output interval, s]
+ */
+//------------------------------------------------------------------------------
+
+#include "gmatdefs.hpp"
+#include "PhysicalModel.hpp"
+#include "GaussJackson.hpp"
+#include "PrinceDormand78.hpp"
+#include "RungeKutta89.hpp"
+#include "BaseException.hpp"
+#include "TestHarness.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+namespace
+{
+   const Real MU = 398600.4415;
+   const Real RE = 6378.1363;
+   const Real J2 = 1.0826269e-3;
+
+   /// LEO state: 500 km altitude, slightly eccentric, 51.6 degree inclination
+   const Real INITIAL_STATE[6] =
+   {
+      6878.1363, 0.0, 0.0, 0.0, 4.7319, 5.9715
+   };
+}
+
+/**
+ * Point mass plus J2 gravity, counting the derivative evaluations
+ */
+class J2Gravity : public PhysicalModel
+{
+public:
+   J2Gravity() :
+      PhysicalModel  (Gmat::PHYSICAL_MODEL, "J2Gravity", "J2Gravity"),
+      evaluations    (0)
+   {
+      dimension = 6;
+   }
+
+   virtual GmatBase* Clone() const
+   {
+      return new J2Gravity(*this);
+   }
+
+   virtual bool GetDerivatives(Real *state, Real /*dt*/ = 0.0,
+                               Integer /*order*/ = 1,
+                               const Integer /*id*/ = -1)
+   {
+      ++evaluations;
+
+      Real x = state[0], y = state[1], z = state[2];
+      Real r2 = x*x + y*y + z*z;
+      Real r = sqrt(r2);
+      Real mur3 = MU / (r2 * r);
+      Real k = 1.5 * J2 * RE * RE / r2;
+      Real zz = 5.0 * z * z / r2;
+
+      deriv[0] = state[3];
+      deriv[1] = state[4];
+      deriv[2] = state[5];
+      deriv[3] = -mur3 * x * (1.0 + k * (1.0 - zz));
+      deriv[4] = -mur3 * y * (1.0 + k * (1.0 - zz));
+      deriv[5] = -mur3 * z * (1.0 + k * (3.0 - zz));
+
+      return true;
+   }
+
+   /// Number of calls to GetDerivatives()
+   Integer evaluations;
+
+   DEFAULT_TO_NO_CLONES
+   DEFAULT_TO_NO_REFOBJECTS
+};
+
+//------------------------------------------------------------------------------
+// bool Propagate(Integrator *integrator, Real accuracy, Real days,
+//                Real interval, Real *finalState, Integer &evaluations,
+//                double &seconds)
+//------------------------------------------------------------------------------
+/**
+ * Propagates the initial state with one integrator.
+ *
+ * @return true if the propagation succeeded
+ */
+//------------------------------------------------------------------------------
+bool Propagate(Integrator *integrator, Real accuracy, Real days, Real interval,
+               Real *finalState, Integer &evaluations, double &seconds)
+{
+   J2Gravity model;
+   model.Initialize();
+
+   integrator->SetRealParameter("Accuracy", accuracy);
+   integrator->SetRealParameter("InitialStepSize", 60.0);
+   integrator->SetRealParameter("MinStep", 1.0e-3);
+   integrator->SetRealParameter("MaxStep", 2700.0);
+   if (integrator->IsOfType("PredictorCorrector"))
+   {
+      integrator->SetRealParameter("TargetError", accuracy * 0.1);
+      integrator->SetRealParameter("LowerError", accuracy * 1.0e-3);
+   }
+   integrator->SetPhysicalModel(&model);
+   if (!integrator->Initialize())
+      return false;
+
+   // Initialization reallocates the model state
+   model.SetState(INITIAL_STATE);
+   model.SetTime(0.0);
+   model.evaluations = 0;
+
+   Integer outputs = (Integer)(days * 86400.0 / interval + 0.5);
+   std::chrono::steady_clock::time_point start =
+         std::chrono::steady_clock::now();
+   for (Integer i = 0; i < outputs; ++i)
+      if (!integrator->Step(interval))
+         return false;
+   std::chrono::steady_clock::time_point stop =
+         std::chrono::steady_clock::now();
+
+   seconds = std::chrono::duration<double>(stop - start).count();
+   evaluations = model.evaluations;
+   for (Integer i = 0; i < 6; ++i)
+      finalState[i] = model.GetState()[i];
+
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// int main(int argc, char *argv[])
+//------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   Real days = 10.0;
+   Real interval = 600.0;
+   if (argc > 1)
+      days = std::atof(argv[1]);
+   if (argc > 2)
+      interval = std::atof(argv[2]);
+
+   const Real accuracies[] = { 1.0e-9, 1.0e-10, 1.0e-11, 1.0e-12 };
+   const Integer accuracyCount = sizeof(accuracies) / sizeof(Real);
+
+   try
+   {
+      Real reference[6], state[6];
+      Integer evaluations;
+      double seconds;
+
+      RungeKutta89 referenceIntegrator("Reference");
+      if (!Propagate(&referenceIntegrator, 1.0e-13, days, interval,
+            reference, evaluations, seconds))
+      {
+         std::cout << "The reference propagation failed\n";
+         return 1;
+      }
+
+      std::cout << days << " days of point mass + J2 LEO propagation, "
+                << "output every " << interval << " s\n\n"
+                << std::left << std::setw(18) << "Integrator"
+                << std::right << std::setw(10) << "Accuracy"
+                << std::setw(12) << "Evals" << std::setw(12) << "Time, ms"
+                << std::setw(16) << "Pos error, m" << "\n";
+
+      for (Integer a = 0; a < accuracyCount; ++a)
+      {
+         // The PrinceDormand78 results at this accuracy
+         Integer pdEvaluations = 0;
+         Real pdError = 0.0;
+
+         for (Integer which = 0; which < 2; ++which)
+         {
+            Integrator *integrator;
+            if (which == 0)
+               integrator = new PrinceDormand78("PD78");
+            else
+               integrator = new GaussJackson("GJ8");
+
+            bool ok = Propagate(integrator, accuracies[a], days, interval,
+                  state, evaluations, seconds);
+
+            Real error = 0.0;
+            for (Integer i = 0; i < 3; ++i)
+               error += (state[i] - reference[i]) * (state[i] - reference[i]);
+            error = sqrt(error);
+
+            std::cout << std::left << std::setw(18)
+                      << integrator->GetTypeName() << std::right
+                      << std::setw(10) << std::setprecision(0)
+                      << std::scientific << accuracies[a];
+            if (ok)
+               std::cout << std::setw(12) << evaluations << std::fixed
+                         << std::setprecision(2) << std::setw(12)
+                         << seconds * 1000.0 << std::scientific
+                         << std::setprecision(3) << std::setw(16)
+                         << error * 1000.0 << "\n";
+            else
+               std::cout << "   failed\n";
+
+            std::stringstream label;
+            label << integrator->GetTypeName() << " at Accuracy "
+                  << accuracies[a];
+            if (which == 0)
+            {
+               // The baseline; a failed PrinceDormand78 run leaves nothing to compare
+               pdEvaluations = (ok ? evaluations : 0);
+               pdError = error;
+            }
+            else
+            {
+               Check(ok, label.str() + " finishes");
+               if (ok && (pdEvaluations > 0))
+               {
+                  Check(evaluations < pdEvaluations,
+                        label.str() + " needs fewer evaluations than "
+                        "PrinceDormand78");
+                  Check(error <= pdError, label.str() + " is as accurate as "
+                        "PrinceDormand78");
+               }
+            }
+
+            delete integrator;
+         }
+      }
+   }
+   catch (BaseException &ex)
+   {
+      Check(false, ex.GetFullMessage());
+   }
+
+   return TestHarness::Finish("Gauss-Jackson benchmark");
+}
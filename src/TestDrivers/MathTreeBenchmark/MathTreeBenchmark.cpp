@@ -0,0 +1,192 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                            MathTreeBenchmark
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/16
+//
+/**
+ * Micro-benchmark comparing MathTree evaluation by walking the MathNode tree
+ * with the CompiledExpression form used by MathTree::Evaluate().
+ *
+ * Usage: MathTreeBenchmark [startup file] [evaluation count]
+ */
+//------------------------------------------------------------------------------
+
+#include "gmatdefs.hpp"
+#include "Moderator.hpp"
+#include "MathParser.hpp"
+#include "MathTree.hpp"
+#include "MathNode.hpp"
+#include "CompiledExpression.hpp"
+#include "Variable.hpp"
+#include "VariableWrapper.hpp"
+#include "BaseException.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+
+namespace
+{
+   /// Equations typical of While loops and optimizer cost functions
+   const char *EQUATIONS[] =
+   {
+      "x + y * 2 - z / 4",
+      "sqrt(x^2 + y^2 + z^2)",
+      "sin(x)*cos(y) + sin(x)*cos(z) - 2*3.141592653589793/3*sin(x)",
+      "atan2(y, x) * 180/3.141592653589793 + abs(z - x)^1.5 - exp(-y/10)",
+      "(x - 7000)^2/1000 + (y - 0.01)^2*1e4 + (z - 28.5)^2 + (x - 7000)^2/1000"
+   };
+
+   const char *VARIABLES[] = { "x", "y", "z" };
+}
+
+//------------------------------------------------------------------------------
+// double TimeLoop(Integer count, bool compiled, MathTree *tree,
+//                 Variable **vars, Real &checksum)
+//------------------------------------------------------------------------------
+/**
+ * Times count evaluations, changing the inputs every pass.
+ *
+ * @return Nanoseconds per evaluation
+ */
+//------------------------------------------------------------------------------
+double TimeLoop(Integer count, bool compiled, MathTree *tree, Variable **vars,
+                Real &checksum)
+{
+   MathNode *topNode = tree->GetTopNode();
+   checksum = 0.0;
+
+   std::chrono::steady_clock::time_point start =
+         std::chrono::steady_clock::now();
+   for (Integer i = 0; i < count; ++i)
+   {
+      vars[0]->SetReal(7000.0 + 1.0e-3 * i);
+      vars[1]->SetReal(0.01 + 1.0e-9 * i);
+      vars[2]->SetReal(28.5 - 1.0e-6 * i);
+      checksum += (compiled ? tree->Evaluate() : topNode->Evaluate());
+   }
+   std::chrono::steady_clock::time_point stop =
+         std::chrono::steady_clock::now();
+
+   return std::chrono::duration<double, std::nano>(stop - start).count() /
+          count;
+}
+
+//------------------------------------------------------------------------------
+// int main(int argc, char *argv[])
+//------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   std::string startupFile = "../../../../application/bin/gmat_startup_file.txt";
+   Integer count = 1000000;
+   if (argc > 1)
+      startupFile = argv[1];
+   if (argc > 2)
+      count = std::atoi(argv[2]);
+
+   // The parser creates its nodes through the Moderator's factories
+   Moderator *mod = Moderator::Instance();
+   if (!mod->Initialize(startupFile))
+   {
+      std::cout << "Cannot initialize GMAT with " << startupFile << "\n";
+      return 1;
+   }
+
+   ObjectMap objectMap, globalObjectMap;
+   WrapperMap wrapperMap;
+   Variable *vars[3];
+   for (Integer i = 0; i < 3; ++i)
+   {
+      vars[i] = new Variable(VARIABLES[i]);
+      objectMap[VARIABLES[i]] = vars[i];
+      VariableWrapper *wrapper = new VariableWrapper();
+      wrapper->SetDescription(VARIABLES[i]);
+      wrapper->SetRefObject(vars[i]);
+      wrapperMap[VARIABLES[i]] = wrapper;
+   }
+
+   std::cout << "MathTree evaluation, " << count << " evaluations per "
+             << "equation\n\n"
+             << std::left << std::setw(40) << "Equation"
+             << std::right << std::setw(8) << "Instr"
+             << std::setw(8) << "Folded" << std::setw(8) << "Reused"
+             << std::setw(12) << "Tree ns" << std::setw(12) << "Flat ns"
+             << std::setw(9) << "Speedup" << "\n";
+
+   int retval = 0;
+   const Integer equationCount = sizeof(EQUATIONS) / sizeof(const char*);
+   for (Integer e = 0; e < equationCount; ++e)
+   {
+      try
+      {
+         MathParser parser(&objectMap);
+         MathTree tree("MathTree", EQUATIONS[e]);
+         tree.SetTopNode(parser.Parse(EQUATIONS[e]));
+         tree.Initialize(&objectMap, &globalObjectMap);
+         tree.SetMathWrappers(&wrapperMap);
+         tree.GetTopNode()->ValidateInputs();
+
+         CompiledExpression flat;
+         if (!flat.Compile(tree.GetTopNode()))
+         {
+            std::cout << EQUATIONS[e] << ": not compiled\n";
+            retval = 1;
+            continue;
+         }
+
+         Real treeSum, flatSum;
+         double treeTime = TimeLoop(count, false, &tree, vars, treeSum);
+         double flatTime = TimeLoop(count, true, &tree, vars, flatSum);
+
+         std::string label = EQUATIONS[e];
+         if (label.length() > 38)
+            label = label.substr(0, 35) + "...";
+         std::cout << std::left << std::setw(40) << label << std::right
+                   << std::setw(8) << flat.GetInstructionCount()
+                   << std::setw(8) << flat.GetFoldedCount()
+                   << std::setw(8) << flat.GetReusedCount()
+                   << std::fixed << std::setprecision(1)
+                   << std::setw(12) << treeTime << std::setw(12) << flatTime
+                   << std::setw(8) << treeTime / flatTime << "x";
+         if (treeSum != flatSum)
+         {
+            std::cout << "  MISMATCH (" << std::setprecision(17) << treeSum
+                      << " vs " << flatSum << ")";
+            retval = 1;
+         }
+         std::cout << "\n";
+      }
+      catch (BaseException &be)
+      {
+         std::cout << EQUATIONS[e] << ": " << be.GetFullMessage() << "\n";
+         retval = 1;
+      }
+   }
+
+   for (WrapperMap::iterator i = wrapperMap.begin(); i != wrapperMap.end(); ++i)
+      delete i->second;
+   for (Integer i = 0; i < 3; ++i)
+      delete vars[i];
+
+   return retval;
+}
@@ -0,0 +1,357 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                          PathFunctionJacobianTest
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/16
+//
+/**
+ * Tests of the finite-difference Jacobians and the threaded point evaluation
+ * of UserPathFunctionManager.
+ *
+ * Two path functions are used: a chain of weakly coupled states with no
+ * analytic Jacobians, so that every Jacobian is finite differenced with
+ * column groups of several variables, and the phase 2 Goddard rocket
+ * function of the CSALT tester, whose path constraint has no analytic
+ * Jacobian.  For each one the test checks that
+ *
+ *  - the Jacobians built from the column groups match those built by
+ *    perturbing one variable at a time, and
+ *  - EvaluatePoints() gives the same values and Jacobians with 1 and 4
+ *    workers, which requires UserPathFunction::Clone().
+ *
+ * The program returns 0 when every check passes.
+ */
+//------------------------------------------------------------------------------
+
+#include "csaltdefs.hpp"
+#include "UserPathFunction.hpp"
+#include "UserPathFunctionManager.hpp"
+#include "FunctionInputData.hpp"
+#include "PathFunctionContainer.hpp"
+#include "BoundData.hpp"
+#include "BaseException.hpp"
+#include "GoddardRocketThreePhasePathObject.hpp"
+#include "TestHarness.hpp"
+
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+   /// Largest difference between two matrices; huge if the sizes differ
+   Real MaxDifference(const Rmatrix &a, const Rmatrix &b)
+   {
+      Integer ra, ca, rb, cb;
+      a.GetSize(ra, ca);
+      b.GetSize(rb, cb);
+      if ((ra != rb) || (ca != cb))
+         return 1.0e100;
+
+      Real diff = 0.0;
+      for (Integer rr = 0; rr < ra; ++rr)
+         for (Integer cc = 0; cc < ca; ++cc)
+            diff = std::max(diff, std::fabs(a(rr, cc) - b(rr, cc)));
+      return diff;
+   }
+
+   /// Largest difference between two vectors; huge if the sizes differ
+   Real MaxDifference(const Rvector &a, const Rvector &b)
+   {
+      if (a.GetSize() != b.GetSize())
+         return 1.0e100;
+
+      Real diff = 0.0;
+      for (Integer ii = 0; ii < a.GetSize(); ++ii)
+         diff = std::max(diff, std::fabs(a(ii) - b(ii)));
+      return diff;
+   }
+}
+
+
+/**
+ * Path function with banded dynamics and no analytic Jacobians
+ *
+ * Each state rate depends on its own state, the state before it and one of
+ * the two controls, and the other functions use only a few of the states, so
+ * the state Jacobian columns fall into a few groups.
+ */
+class ChainPathFunction : public UserPathFunction
+{
+public:
+   static const Integer NUM_STATES   = 8;
+   static const Integer NUM_CONTROLS = 2;
+
+   UserPathFunction* Clone() const
+   {
+      return new ChainPathFunction(*this);
+   }
+
+   void EvaluateFunctions()
+   {
+      Rvector x = GetStateVector();
+      Rvector u = GetControlVector();
+      Real    t = GetTime();
+
+      Rvector dyn(NUM_STATES);
+      for (Integer ii = 0; ii < NUM_STATES; ++ii)
+      {
+         dyn(ii) = std::sin(x(ii)) * u(ii % NUM_CONTROLS) + t * x(ii);
+         if (ii > 0)
+            dyn(ii) += 0.1 * x(ii - 1) * x(ii - 1);
+      }
+      SetFunctions(DYNAMICS, dyn);
+
+      Rvector alg(2, x(0) * x(NUM_STATES - 1), u(0) * u(1) + x(2));
+      Rvector upper(2, 10.0, 10.0);
+      Rvector lower(2, -10.0, -10.0);
+      SetFunctions(ALGEBRAIC, alg);
+      SetFunctionBounds(ALGEBRAIC, UPPER, upper);
+      SetFunctionBounds(ALGEBRAIC, LOWER, lower);
+
+      SetFunctions(COST, Rvector(1, x(0) * x(0) * u(0)));
+   }
+
+   void EvaluateJacobians()
+   {
+   }
+};
+
+
+/**
+ * Manager that can switch the column groups off, so that the Jacobians are
+ * finite differenced one variable at a time
+ */
+class TestPathFunctionManager : public UserPathFunctionManager
+{
+public:
+   void UseColumnGroups(bool useGroups)
+   {
+      if (useGroups)
+      {
+         if (columnGroups.empty())
+            columnGroups = savedGroups;
+      }
+      else if (!columnGroups.empty())
+      {
+         savedGroups = columnGroups;
+         columnGroups.clear();
+      }
+   }
+
+   /// Number of evaluations for the state Jacobian of all function types
+   Integer GetStateGroupCount()
+   {
+      if ((Integer) columnGroups.size() <= UserFunction::ALLFUNCTIONS)
+         return -1;
+      return (Integer)
+            columnGroups[UserFunction::ALLFUNCTIONS][UserFunction::STATE].size();
+   }
+
+   /// Number of user function copies made for the extra workers
+   Integer GetWorkerCopyCount()
+   {
+      return (Integer) workerFunctions.size();
+   }
+
+protected:
+   std::vector<std::vector<std::vector<IntegerArray>>> savedGroups;
+};
+
+
+/**
+ * Problem set up the way Phase sets up its path function manager
+ */
+struct PathProblem
+{
+   Rvector                 lowerState, upperState;
+   Rvector                 lowerControl, upperControl;
+   Real                    lowerTime, upperTime;
+   FunctionInputData       input;
+   BoundData               bounds;
+   PathFunctionContainer   container;
+   TestPathFunctionManager manager;
+
+   PathProblem(UserPathFunction *func, Integer phase, const Rvector &xLower,
+               const Rvector &xUpper, const Rvector &uLower,
+               const Rvector &uUpper, Real tLower, Real tUpper) :
+      lowerState     (xLower),
+      upperState     (xUpper),
+      lowerControl   (uLower),
+      upperControl   (uUpper),
+      lowerTime      (tLower),
+      upperTime      (tUpper)
+   {
+      input.Initialize(lowerState.GetSize(), lowerControl.GetSize(), 0);
+      input.SetStateVector(upperState);
+      input.SetControlVector(upperControl);
+      input.SetTime(upperTime);
+      input.SetPhaseNum(phase);
+
+      bounds.SetStateLowerBound(lowerState);
+      bounds.SetStateUpperBound(upperState);
+      bounds.SetControlLowerBound(lowerControl);
+      bounds.SetControlUpperBound(upperControl);
+      bounds.SetTimeLowerBound(Rvector(1, lowerTime));
+      bounds.SetTimeUpperBound(Rvector(1, upperTime));
+
+      container.Initialize();
+      manager.Initialize(func, &input, &container, &bounds);
+   }
+
+   /// Sets the input data for point pt of numPoints, spread through the bounds
+   void SetPoint(Integer pt, Integer numPoints, FunctionInputData *data) const
+   {
+      Real frac = (pt + 0.5) / numPoints;
+      Rvector x(lowerState.GetSize()), u(lowerControl.GetSize());
+      for (Integer ii = 0; ii < x.GetSize(); ++ii)
+         x(ii) = lowerState(ii) + (upperState(ii) - lowerState(ii)) *
+               std::fmod(frac + 0.13 * ii, 1.0);
+      for (Integer ii = 0; ii < u.GetSize(); ++ii)
+         u(ii) = lowerControl(ii) + (upperControl(ii) - lowerControl(ii)) *
+               std::fmod(frac + 0.29 * ii, 1.0);
+      data->SetStateVector(x);
+      data->SetControlVector(u);
+      data->SetTime(lowerTime + (upperTime - lowerTime) * frac);
+   }
+};
+
+
+//------------------------------------------------------------------------------
+// void TestProblem(...)
+//------------------------------------------------------------------------------
+/**
+ * Runs the checks for one path function.
+ */
+//------------------------------------------------------------------------------
+void TestProblem(const std::string &name, UserPathFunction *func,
+                 Integer phase, const Rvector &lowerState,
+                 const Rvector &upperState, const Rvector &lowerControl,
+                 const Rvector &upperControl, Real lowerTime, Real upperTime)
+{
+   const Integer numPoints = 40;
+   PathProblem problem(func, phase, lowerState, upperState, lowerControl,
+                       upperControl, lowerTime, upperTime);
+
+   Integer groupCount = problem.manager.GetStateGroupCount();
+   std::cout << name << ": " << groupCount << " evaluations for "
+             << lowerState.GetSize() << " state columns\n";
+   Check(groupCount > 0, name + " column groups built");
+
+   auto setup = [&](Integer pt, FunctionInputData *data)
+   {
+      problem.SetPoint(pt, numPoints, data);
+   };
+
+   // Results for each configuration: 1 worker with and without the groups,
+   // and 4 workers with the groups
+   std::vector<std::vector<PathFunctionContainer*> > results(3);
+   for (Integer run = 0; run < 3; ++run)
+   {
+      problem.manager.UseColumnGroups(run != 1);
+      problem.manager.SetNumWorkers(run == 2 ? 4 : 1);
+      for (Integer pt = 0; pt < numPoints; ++pt)
+      {
+         results[run].push_back(new PathFunctionContainer());
+         results[run].back()->Initialize();
+      }
+      problem.manager.EvaluatePoints(numPoints, &problem.input, setup,
+                                     results[run]);
+   }
+   problem.manager.UseColumnGroups(true);
+   Check(problem.manager.GetWorkerCopyCount() == 3,
+         name + " path function copied for the workers");
+
+   Real groupDiff = 0.0, workerDiff = 0.0;
+   for (Integer pt = 0; pt < numPoints; ++pt)
+   {
+      for (Integer ft = UserFunction::DYNAMICS; ft < UserFunction::ALLFUNCTIONS;
+           ++ft)
+      {
+         UserFunction::FunctionType fType =
+               static_cast<UserFunction::FunctionType>(ft);
+         FunctionOutputData *colored   = results[0][pt]->GetData(fType);
+         FunctionOutputData *single    = results[1][pt]->GetData(fType);
+         FunctionOutputData *threaded  = results[2][pt]->GetData(fType);
+         if (!colored->HasUserFunction())
+            continue;
+
+         workerDiff = std::max(workerDiff, MaxDifference(
+               colored->GetFunctionValues(), threaded->GetFunctionValues()));
+         for (Integer jt = UserFunction::STATE; jt <= UserFunction::TIME; ++jt)
+         {
+            UserFunction::JacobianType jType =
+                  static_cast<UserFunction::JacobianType>(jt);
+            groupDiff = std::max(groupDiff, MaxDifference(
+                  colored->GetJacobian(jType), single->GetJacobian(jType)));
+            workerDiff = std::max(workerDiff, MaxDifference(
+                  colored->GetJacobian(jType), threaded->GetJacobian(jType)));
+         }
+      }
+   }
+
+   std::cout << name << ": grouped vs single column difference "
+             << groupDiff << ", 1 vs 4 worker difference " << workerDiff
+             << "\n";
+
+   // Each function in a group sees only one of the perturbed variables, so
+   // the differences are taken from the same function values
+   Check(groupDiff < 1.0e-10, name + " grouped Jacobians match");
+   // The same arithmetic runs on every worker
+   Check(workerDiff == 0.0, name + " worker results match");
+
+   for (UnsignedInt run = 0; run < results.size(); ++run)
+      for (UnsignedInt pt = 0; pt < results[run].size(); ++pt)
+         delete results[run][pt];
+}
+
+
+//------------------------------------------------------------------------------
+// int main()
+//------------------------------------------------------------------------------
+int main()
+{
+   try
+   {
+      const Integer ns = ChainPathFunction::NUM_STATES;
+      Rvector lowerState(ns), upperState(ns);
+      for (Integer ii = 0; ii < ns; ++ii)
+      {
+         lowerState(ii) = -1.0 - 0.1 * ii;
+         upperState(ii) =  1.0 + 0.2 * ii;
+      }
+      ChainPathFunction chain;
+      TestProblem("Chain", &chain, 0, lowerState, upperState,
+                  Rvector(2, -1.0, 0.5), Rvector(2, 1.0, 2.0), 0.0, 2.0);
+
+      // Phase 2 of the Goddard rocket, which has the singular arc constraint
+      GoddardRocketThreePhasePathObject goddard;
+      TestProblem("Goddard", &goddard, 1, Rvector(3, 100.0, 100.0, 1.0),
+                  Rvector(3, 15000.0, 800.0, 3.0), Rvector(1, 0.0),
+                  Rvector(1, 193.0), 10.0, 40.0);
+   }
+   catch (BaseException &ex)
+   {
+      Check(false, ex.GetFullMessage());
+   }
+
+   return TestHarness::Finish("Path function Jacobian");
+}
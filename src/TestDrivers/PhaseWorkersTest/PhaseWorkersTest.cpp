@@ -0,0 +1,258 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                              PhaseWorkersTest
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/16
+//
+/**
+ * Test of the concurrent phase evaluation of Trajectory.
+ *
+ * The three phase Goddard rocket problem of the CSALT tester is set up with
+ * 1 and 3 phase workers, each with 1 and 2 path function workers per phase.
+ * The constraint and cost functions and the Jacobian are evaluated at the
+ * initial guess and at a perturbed decision vector, and must be identical
+ * for every setting.  With 3 phase workers the later phases must run on
+ * their own copies of the path function, configured with the phase scaling
+ * utilities.
+ *
+ * The optimizer is not initialized; only the problem functions are
+ * evaluated.  The program returns 0 when every check passes.
+ */
+//------------------------------------------------------------------------------
+
+#include "csalt.hpp"
+#include "ConsoleMessageReceiver.hpp"
+#include "GoddardRocketThreePhaseDriver.hpp"
+#include "GoddardRocketThreePhasePathObject.hpp"
+#include "TestHarness.hpp"
+
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <vector>
+
+
+/**
+ * Goddard rocket path function that records which object was given the
+ * scaling utilities.  A copy made after the path function was configured
+ * only reports itself once it has been configured on its own.
+ */
+class ScaleCheckingPathObject : public GoddardRocketThreePhasePathObject
+{
+public:
+   ScaleCheckingPathObject() :
+      configuredObject  (NULL)
+   {
+   }
+
+   UserPathFunction* Clone() const
+   {
+      return new ScaleCheckingPathObject(*this);
+   }
+
+   void SetPhaseScaleUtilList(std::vector<ScalingUtility*> scalingList)
+   {
+      GoddardRocketThreePhasePathObject::SetPhaseScaleUtilList(scalingList);
+      configuredObject = this;
+   }
+
+   bool IsConfigured(UnsignedInt numScaleUtils) const
+   {
+      return (configuredObject == this) &&
+             (phaseScaleUtilList.size() == numScaleUtils);
+   }
+
+private:
+   /// The object that SetPhaseScaleUtilList() was called on
+   const ScaleCheckingPathObject *configuredObject;
+};
+
+
+/**
+ * Trajectory set up without an optimizer
+ */
+class PhaseWorkersTrajectory : public Trajectory
+{
+public:
+   /// Trajectory::Initialize() up to the creation of the optimizer
+   void Initialize()
+   {
+      for (UnsignedInt phaseIdx = 0; phaseIdx < phaseList.size(); phaseIdx++)
+         phaseList.at(phaseIdx)->SetPhaseNumber(phaseIdx);
+
+      InitializePhases();
+      InitializePointFunctions();
+      numBoundFunctions = pointFunctionManager->GetNumberBoundaryFunctions();
+      SetBounds();
+      SetInitialGuess();
+      PrepareToOptimize();
+   }
+
+   /// Checks that the later phases have configured path function copies
+   bool HasConfiguredCopies()
+   {
+      if (!hasIndependentPhases ||
+          ((Integer) phasePathFunctions.size() != numPhases - 1))
+         return false;
+      for (UnsignedInt ii = 0; ii < phasePathFunctions.size(); ++ii)
+      {
+         ScaleCheckingPathObject *copy =
+               dynamic_cast<ScaleCheckingPathObject*>(phasePathFunctions[ii]);
+         if ((copy == NULL) || (phasePathFunctions[ii] == pathFunction) ||
+             !copy->IsConfigured(numPhases))
+            return false;
+      }
+      return true;
+   }
+};
+
+
+/**
+ * The Goddard rocket driver, run up to the optimization
+ */
+class PhaseWorkersDriver : public GoddardRocketThreePhaseDriver
+{
+public:
+   /// Values computed for one setting of the workers
+   struct Result
+   {
+      Rvector              functions;
+      RSMatrix             jacobian;
+      bool                 hasCopies;
+   };
+
+   Result Evaluate(Integer phaseWorkers, Integer pathWorkers,
+                   const Rvector &offset)
+   {
+      PhaseWorkersTrajectory *trajectory = new PhaseWorkersTrajectory();
+      traj = trajectory;
+      SetPointPathAndProperties();
+      delete pathObject;
+      pathObject = new ScaleCheckingPathObject();
+      traj->SetUserPathFunction(pathObject);
+      traj->SetUserPointFunction(pointObject);
+      traj->SetNumPhaseWorkers(phaseWorkers);
+      SetupPhases();
+      for (UnsignedInt ii = 0; ii < phaseList.size(); ++ii)
+         phaseList[ii]->SetPathFunctionWorkers(pathWorkers);
+      traj->SetPhaseList(phaseList);
+      traj->Initialize();
+
+      Result result;
+      result.hasCopies = trajectory->HasConfiguredCopies();
+
+      // Move away from the guess so that no two phases are alike
+      Rvector decVec = traj->GetDecisionVector();
+      for (Integer ii = 0; ii < decVec.GetSize(); ++ii)
+         decVec(ii) += offset(ii % offset.GetSize());
+      traj->SetDecisionVector(decVec);
+      result.functions = traj->GetCostConstraintFunctions();
+      result.jacobian  = traj->GetJacobian();
+      return result;
+   }
+
+   void SetupPhases()
+   {
+      GoddardRocketThreePhaseDriver::SetupPhases();
+   }
+
+   void SetPointPathAndProperties()
+   {
+      GoddardRocketThreePhaseDriver::SetPointPathAndProperties();
+   }
+};
+
+
+//------------------------------------------------------------------------------
+// bool Matches(const PhaseWorkersDriver::Result &a,
+//              const PhaseWorkersDriver::Result &b)
+//------------------------------------------------------------------------------
+/**
+ * Compares two results entry by entry.
+ */
+//------------------------------------------------------------------------------
+bool Matches(const PhaseWorkersDriver::Result &a,
+             const PhaseWorkersDriver::Result &b)
+{
+   if ((a.functions.GetSize() != b.functions.GetSize()) ||
+       (a.jacobian.size1() != b.jacobian.size1()) ||
+       (a.jacobian.size2() != b.jacobian.size2()))
+      return false;
+
+   for (Integer ii = 0; ii < a.functions.GetSize(); ++ii)
+      if (a.functions(ii) != b.functions(ii))
+         return false;
+
+   for (UnsignedInt rr = 0; rr < a.jacobian.size1(); ++rr)
+      for (UnsignedInt cc = 0; cc < a.jacobian.size2(); ++cc)
+         if (a.jacobian(rr, cc) != b.jacobian(rr, cc))
+            return false;
+
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// int main()
+//------------------------------------------------------------------------------
+int main()
+{
+   ConsoleMessageReceiver *consoleMsg = ConsoleMessageReceiver::Instance();
+   MessageInterface::SetMessageReceiver(consoleMsg);
+
+   try
+   {
+      std::vector<Rvector> offsets;
+      offsets.push_back(Rvector(3, 0.0, 0.0, 0.0));
+      offsets.push_back(Rvector(3, 0.01, -0.02, 0.005));
+
+      for (UnsignedInt oo = 0; oo < offsets.size(); ++oo)
+      {
+         std::string at = (oo == 0 ? " at the guess" : " off the guess");
+
+         PhaseWorkersDriver serialDriver;
+         PhaseWorkersDriver::Result serial =
+               serialDriver.Evaluate(1, 1, offsets[oo]);
+         Check(!serial.hasCopies, "no copies with one phase worker");
+
+         const Integer settings[3][2] = { {3, 1}, {3, 2}, {1, 2} };
+         for (Integer ss = 0; ss < 3; ++ss)
+         {
+            std::string name = std::to_string(settings[ss][0]) +
+                  " phase workers, " + std::to_string(settings[ss][1]) +
+                  " path workers";
+
+            PhaseWorkersDriver driver;
+            PhaseWorkersDriver::Result result = driver.Evaluate(
+                  settings[ss][0], settings[ss][1], offsets[oo]);
+
+            Check(Matches(serial, result), name + " match serial" + at);
+            if (settings[ss][0] > 1)
+               Check(result.hasCopies, name + " use configured copies");
+         }
+      }
+   }
+   catch (BaseException &ex)
+   {
+      Check(false, ex.GetFullMessage());
+   }
+
+   return TestHarness::Finish("Phase workers");
+}
@@ -0,0 +1,247 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                            PropagateEnsembleTest
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/16
+//
+/**
+ * Test that PropagateEnsemble picks up spacecraft changes between executions.
+ *
+ * A For loop runs the same PropagateEnsemble twice on two threads, changing
+ * the drag coefficient and mass of the spacecraft after the first run.  The
+ * ensemble left by the second run must match a single run that starts with
+ * the changed values, and differ from a run with the original values.
+ *
+ * Usage: PropagateEnsembleTest [startup file]
+ *
+ * The program returns 0 when every check passes.
+ */
+//------------------------------------------------------------------------------
+
+#include "gmatdefs.hpp"
+#include "Moderator.hpp"
+#include "GmatCommand.hpp"
+#include "PropagateEnsemble.hpp"
+#include "EnsembleState.hpp"
+#include "BaseException.hpp"
+#include "TestHarness.hpp"
+
+#include <cmath>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+   /// Resources shared by the scripts; each script adds its drag settings
+   const char *RESOURCES =
+      "Create Spacecraft Sat;\n"
+      "Sat.DateFormat = UTCGregorian;\n"
+      "Sat.Epoch = '01 Jan 2000 11:59:28.000';\n"
+      "Sat.CoordinateSystem = EarthMJ2000Eq;\n"
+      "Sat.DisplayStateType = Cartesian;\n"
+      "Sat.X = 6678.14;\n"
+      "Sat.Y = 0;\n"
+      "Sat.Z = 0;\n"
+      "Sat.VX = 0;\n"
+      "Sat.VY = 7.7258;\n"
+      "Sat.VZ = 0;\n"
+      "Sat.DragArea = 10;\n"
+      "\n"
+      "Create ForceModel LeoForces;\n"
+      "LeoForces.CentralBody = Earth;\n"
+      "LeoForces.PrimaryBodies = {Earth};\n"
+      "LeoForces.GravityField.Earth.Degree = 4;\n"
+      "LeoForces.GravityField.Earth.Order = 4;\n"
+      "LeoForces.GravityField.Earth.PotentialFile = 'JGM2.cof';\n"
+      "LeoForces.Drag.AtmosphereModel = Exponential;\n"
+      "\n"
+      "Create Propagator Prop;\n"
+      "Prop.FM = LeoForces;\n"
+      "Prop.Type = RungeKutta89;\n"
+      "Prop.InitialStepSize = 60;\n"
+      "Prop.Accuracy = 1e-12;\n"
+      "Prop.MinStep = 0.001;\n"
+      "Prop.MaxStep = 300;\n"
+      "\n"
+      "Create Variable I;\n";
+
+   const char *ENSEMBLE =
+      "PropagateEnsemble Prop(Sat) {Members = 8, Duration = 3600, "
+      "PositionSigma = 0.1, VelocitySigma = 1e-4, Seed = 7, "
+      "ThreadCount = 2};\n";
+
+   /// Drag settings before and after the change made in the loop
+   const char *ORIGINAL_DRAG = "Sat.Cd = 2.2;\nSat.DryMass = 500;\n";
+   const char *CHANGED_DRAG  = "Sat.Cd = 20;\nSat.DryMass = 200;\n";
+}
+
+
+//------------------------------------------------------------------------------
+// PropagateEnsemble* FindEnsemble(GmatCommand *cmd)
+//------------------------------------------------------------------------------
+/**
+ * Finds the first PropagateEnsemble command in a sequence, looking inside
+ * branch commands.
+ */
+//------------------------------------------------------------------------------
+PropagateEnsemble* FindEnsemble(GmatCommand *cmd)
+{
+   for (; cmd != NULL; cmd = cmd->GetNext())
+   {
+      if (cmd->GetTypeName() == "PropagateEnsemble")
+         return (PropagateEnsemble*)cmd;
+
+      GmatCommand *child = cmd->GetChildCommand(0);
+      // Branch bodies end by pointing back at their branch command
+      if ((child != NULL) && (child != cmd))
+      {
+         for (GmatCommand *inner = child; (inner != NULL) && (inner != cmd);
+              inner = inner->GetNext())
+         {
+            if (inner->GetTypeName() == "PropagateEnsemble")
+               return (PropagateEnsemble*)inner;
+         }
+      }
+   }
+   return NULL;
+}
+
+
+//------------------------------------------------------------------------------
+// bool RunEnsemble(const std::string &sequence, const std::string &drag,
+//                  std::vector<Real> &states)
+//------------------------------------------------------------------------------
+/**
+ * Runs a script and collects the member states of its PropagateEnsemble.
+ *
+ * @param sequence The mission sequence
+ * @param drag     The spacecraft drag settings
+ * @param states   The member states, 6 per member
+ *
+ * @return true if the script ran and every member finished
+ */
+//------------------------------------------------------------------------------
+bool RunEnsemble(const std::string &sequence, const std::string &drag,
+                 std::vector<Real> &states)
+{
+   Moderator *mod = Moderator::Instance();
+   std::istringstream script(std::string(RESOURCES) + drag +
+         "\nBeginMissionSequence;\n" + sequence);
+
+   states.clear();
+   if (!mod->InterpretScript(&script, true))
+      return false;
+   if (mod->RunScript() != 1)
+      return false;
+
+   PropagateEnsemble *cmd = FindEnsemble(mod->GetFirstCommand());
+   if (cmd == NULL)
+      return false;
+
+   const EnsembleState &ensemble = cmd->GetEnsemble();
+   if (ensemble.GetStatusCount(EnsembleState::FAILED) != 0)
+      return false;
+
+   states.resize(6 * ensemble.GetSize());
+   for (Integer m = 0; m < ensemble.GetSize(); ++m)
+      ensemble.GetMember(m, &states[6 * m]);
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// Real PositionDifference(const std::vector<Real> &a,
+//                         const std::vector<Real> &b)
+//------------------------------------------------------------------------------
+/**
+ * Returns the largest member position difference, in km.
+ */
+//------------------------------------------------------------------------------
+Real PositionDifference(const std::vector<Real> &a, const std::vector<Real> &b)
+{
+   Real largest = 0.0;
+   for (UnsignedInt m = 0; 6 * m < a.size(); ++m)
+   {
+      Real d2 = 0.0;
+      for (UnsignedInt i = 0; i < 3; ++i)
+         d2 += (a[6*m+i] - b[6*m+i]) * (a[6*m+i] - b[6*m+i]);
+      if (std::sqrt(d2) > largest)
+         largest = std::sqrt(d2);
+   }
+   return largest;
+}
+
+
+//------------------------------------------------------------------------------
+// int main(int argc, char *argv[])
+//------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   std::string startupFile = "gmat_startup_file.txt";
+   if (argc > 1)
+      startupFile = argv[1];
+
+   Moderator *mod = Moderator::Instance();
+   if (!mod->Initialize(startupFile))
+   {
+      std::cout << "Cannot initialize GMAT with " << startupFile << "\n";
+      return 1;
+   }
+
+   try
+   {
+      std::string loop = std::string("For I = 1:2\n") + ENSEMBLE +
+            CHANGED_DRAG + "EndFor;\n";
+      std::vector<Real> looped, changed, original;
+
+      Check(RunEnsemble(loop, ORIGINAL_DRAG, looped),
+            "ensemble run twice in a loop");
+      Check(RunEnsemble(ENSEMBLE, CHANGED_DRAG, changed),
+            "ensemble with the changed drag");
+      Check(RunEnsemble(ENSEMBLE, ORIGINAL_DRAG, original),
+            "ensemble with the original drag");
+
+      if ((looped.size() == changed.size()) &&
+          (changed.size() == original.size()) && !looped.empty())
+      {
+         Real loopError = PositionDifference(looped, changed);
+         Real dragEffect = PositionDifference(changed, original);
+         std::cout << "Second loop run vs changed drag: " << loopError
+                   << " km; changed vs original drag: " << dragEffect
+                   << " km\n";
+
+         // The drag change moves the members, so a stale worker spacecraft
+         // shows up as a large difference
+         Check(dragEffect > 1.0e-3, "drag change moves the members");
+         Check(loopError < 1.0e-9,
+               "second execution uses the changed spacecraft");
+      }
+      else
+         Check(false, "ensembles have the same size");
+   }
+   catch (BaseException &ex)
+   {
+      Check(false, ex.GetFullMessage());
+   }
+
+   return TestHarness::Finish("PropagateEnsemble");
+}
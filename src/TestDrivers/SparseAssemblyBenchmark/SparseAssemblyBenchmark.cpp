@@ -0,0 +1,264 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                           SparseAssemblyBenchmark
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/16
+//
+/**
+ * Benchmark of the defect constraint Jacobian assembly for a large Radau
+ * phase.
+ *
+ * The phase has 7 states and 3 controls, like a low thrust orbit transfer in
+ * modified equinoctial elements with mass.  Random dynamics values and
+ * Jacobians are set at every point, then the defect Jacobian is built
+ * repeatedly two ways: element by element into a new partial Q matrix
+ * followed by a sparse matrix product (the previous code path), and on the
+ * preallocated SparseAssembler patterns used by ComputeDefectFunAndJac.
+ * The report gives the time per assembly and the largest difference between
+ * the two Jacobians.
+ *
+ * Usage: SparseAssemblyBenchmark [mesh intervals] [points per interval]
+ *                                [repetitions]
+ */
+//------------------------------------------------------------------------------
+
+#include "csaltdefs.hpp"
+#include "NLPFuncUtilRadau.hpp"
+#include "ProblemCharacteristics.hpp"
+#include "DecVecTypeBetts.hpp"
+#include "FunctionOutputData.hpp"
+#include "UserFunctionProperties.hpp"
+#include "SparseMatrixUtil.hpp"
+#include "BaseException.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+
+namespace
+{
+   const Integer NUM_STATES   = 7;
+   const Integer NUM_CONTROLS = 3;
+}
+
+/**
+ * Radau utility that also exposes the element by element assembly
+ */
+class BenchmarkRadau : public NLPFuncUtilRadau
+{
+public:
+   /// Builds the defect Jacobian the way it was built before the assemblers
+   void ElementwiseJacobian(const std::vector<FunctionOutputData*> &funcData,
+                            RSMatrix &jacobian)
+   {
+      Rvector  qVector;
+      RSMatrix parQMatrix;
+      FillDynamicDefectConMatrices(funcData, qVector, parQMatrix);
+      DefectNLPData.ComputeJacobian(&parQMatrix, jacobian);
+   }
+};
+
+//------------------------------------------------------------------------------
+// Real MaxDifference(const RSMatrix &a, const RSMatrix &b)
+//------------------------------------------------------------------------------
+/**
+ * Returns the largest absolute difference between the stored elements of a
+ * and the corresponding elements of b.
+ */
+//------------------------------------------------------------------------------
+Real MaxDifference(const RSMatrix &a, const RSMatrix &b)
+{
+   Real maxDiff = 0.0;
+   for (RSMatrix::const_iterator1 i1 = a.begin1(); i1 != a.end1(); ++i1)
+      for (RSMatrix::const_iterator2 i2 = i1.begin(); i2 != i1.end(); ++i2)
+         maxDiff = std::max(maxDiff,
+               std::fabs(*i2 - b(i2.index1(), i2.index2())));
+   return maxDiff;
+}
+
+//------------------------------------------------------------------------------
+// int main(int argc, char *argv[])
+//------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   Integer intervals   = 200;
+   Integer numPoints   = 8;
+   Integer repetitions = 50;
+   if (argc > 1)
+      intervals = std::atoi(argv[1]);
+   if (argc > 2)
+      numPoints = std::atoi(argv[2]);
+   if (argc > 3)
+      repetitions = std::atoi(argv[3]);
+
+   try
+   {
+      // Mesh and problem dimensions
+      Rvector fractions(intervals + 1);
+      IntegerArray meshPoints;
+      for (Integer i = 0; i <= intervals; ++i)
+         fractions(i) = -1.0 + 2.0 * i / intervals;
+      for (Integer i = 0; i < intervals; ++i)
+         meshPoints.push_back(numPoints);
+
+      ProblemCharacteristics config;
+      config.SetNumStateVars(NUM_STATES);
+      config.SetNumControlVars(NUM_CONTROLS);
+      config.SetMeshIntervalFractions(fractions);
+      config.SetMeshIntervalNumPoints(meshPoints);
+      config.SetHasDefectCons(true);
+
+      BenchmarkRadau util;
+      util.Initialize(&config);
+      util.SetTimeVector(0.0, 86400.0);
+
+      DecVecTypeBetts decVector;
+      decVector.Initialize(NUM_STATES, NUM_CONTROLS, 0, 0,
+                           util.GetNumStatePoints(),
+                           util.GetNumControlPoints(),
+                           util.GetNumStateStagePointsPerMesh(),
+                           util.GetNumControlStagePointsPerMesh());
+
+      // Dynamics depend on every state; the thrust acceleration enters the
+      // rate equations and the mass flow
+      Rmatrix timePattern(NUM_STATES, 1);
+      Rmatrix statePattern(NUM_STATES, NUM_STATES);
+      Rmatrix controlPattern(NUM_STATES, NUM_CONTROLS);
+      for (Integer r = 0; r < NUM_STATES; ++r)
+      {
+         timePattern(r, 0) = 1.0;
+         for (Integer c = 0; c < NUM_STATES; ++c)
+            statePattern(r, c) = 1.0;
+         for (Integer c = 0; c < NUM_CONTROLS; ++c)
+            controlPattern(r, c) = (r == 0 ? 0.0 : 1.0);
+      }
+      UserFunctionProperties props;
+      props.SetNumberOfFunctions(NUM_STATES);
+      props.SetJacobianPattern(UserFunction::TIME, timePattern);
+      props.SetJacobianPattern(UserFunction::STATE, statePattern);
+      props.SetJacobianPattern(UserFunction::CONTROL, controlPattern);
+      props.SetHasVars(UserFunction::STATE, true);
+      props.SetHasVars(UserFunction::CONTROL, true);
+
+      // Random function values and Jacobians on the pattern
+      std::mt19937 generator(12345);
+      std::uniform_real_distribution<Real> uniform(-1.0, 1.0);
+      Integer numTimePts = util.GetNumTimePoints();
+      std::vector<FunctionOutputData*> funcData;
+      IntegerArray staticIdxs;
+      for (Integer pt = 0; pt < numTimePts; ++pt)
+      {
+         Integer meshIdx  = util.GetMeshIndex(pt);
+         Integer stageIdx = util.GetStageIndex(pt);
+
+         Rvector values(NUM_STATES);
+         Rmatrix timeJac(NUM_STATES, 1), stateJac(NUM_STATES, NUM_STATES),
+                 controlJac(NUM_STATES, NUM_CONTROLS),
+                 staticJac(NUM_STATES, 0);
+         for (Integer r = 0; r < NUM_STATES; ++r)
+         {
+            values(r) = uniform(generator);
+            timeJac(r, 0) = uniform(generator);
+            for (Integer c = 0; c < NUM_STATES; ++c)
+               stateJac(r, c) = uniform(generator);
+            for (Integer c = 0; c < NUM_CONTROLS; ++c)
+               controlJac(r, c) = controlPattern(r, c) * uniform(generator);
+         }
+
+         FunctionOutputData *data = new FunctionOutputData();
+         data->SetFunctionValues(NUM_STATES, values);
+         data->SetJacobian(UserFunction::TIME, timeJac);
+         data->SetJacobian(UserFunction::STATE, stateJac);
+         data->SetJacobian(UserFunction::CONTROL, controlJac);
+         data->SetJacobian(UserFunction::STATIC, staticJac);
+         data->SetNLPData(meshIdx, stageIdx,
+               decVector.GetStateIdxsAtMeshPoint(meshIdx, stageIdx),
+               decVector.GetControlIdxsAtMeshPoint(meshIdx, stageIdx),
+               staticIdxs);
+         funcData.push_back(data);
+      }
+
+      Rvector decisionVector(config.GetNumDecisionVarsNLP());
+      for (Integer i = 0; i < decisionVector.GetSize(); ++i)
+         decisionVector(i) = uniform(generator);
+      decVector.SetDecisionVector(decisionVector);
+
+      util.PrepareToOptimize(props, funcData);
+
+      Rvector  funcValues;
+      RSMatrix elementwise, assembled;
+
+      // Warm up both paths; the first assembly sets up the patterns
+      util.ElementwiseJacobian(funcData, elementwise);
+      util.ComputeDefectFunAndJac(funcData, &decVector, funcValues, assembled);
+
+      std::chrono::steady_clock::time_point start =
+            std::chrono::steady_clock::now();
+      for (Integer i = 0; i < repetitions; ++i)
+         util.ElementwiseJacobian(funcData, elementwise);
+      std::chrono::steady_clock::time_point mid =
+            std::chrono::steady_clock::now();
+      for (Integer i = 0; i < repetitions; ++i)
+         util.ComputeDefectFunAndJac(funcData, &decVector, funcValues,
+                                     assembled);
+      std::chrono::steady_clock::time_point stop =
+            std::chrono::steady_clock::now();
+
+      double oldMs = std::chrono::duration<double, std::milli>
+            (mid - start).count() / repetitions;
+      double newMs = std::chrono::duration<double, std::milli>
+            (stop - mid).count() / repetitions;
+
+      std::cout << "Radau phase: " << intervals << " intervals x "
+                << numPoints << " points, " << NUM_STATES << " states, "
+                << NUM_CONTROLS << " controls\n"
+                << "Defect Jacobian: " << elementwise.size1() << " x "
+                << elementwise.size2() << ", "
+                << SparseMatrixUtil::GetNumNonZeroElements(&elementwise)
+                << " nonzeros (" << assembled.nnz() << " in the pattern)\n\n"
+                << std::left << std::setw(34) << "Assembly"
+                << std::right << std::setw(14) << "ms per call" << "\n"
+                << std::left << std::setw(34) << "Element by element + product"
+                << std::right << std::setw(14) << std::fixed
+                << std::setprecision(3) << oldMs << "\n"
+                << std::left << std::setw(34) << "Preallocated pattern"
+                << std::right << std::setw(14) << newMs << "\n\n"
+                << "Speedup: " << std::setprecision(1) << oldMs / newMs
+                << "x\n"
+                << "Max difference: " << std::scientific
+                << std::setprecision(3)
+                << std::max(MaxDifference(elementwise, assembled),
+                            MaxDifference(assembled, elementwise))
+                << "\n";
+
+      for (UnsignedInt i = 0; i < funcData.size(); ++i)
+         delete funcData[i];
+   }
+   catch (BaseException &be)
+   {
+      std::cout << "Error: " << be.GetFullMessage() << "\n";
+      return 1;
+   }
+
+   return 0;
+}
@@ -0,0 +1,377 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                          SquareRootFilterKernelTest
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/16
+//
+/**
+ * Test of the SquareRootFilterKernel of the ExtendedKalmanFilter.
+ *
+ * A sequence of time and measurement updates is run through the kernel and
+ * through the Rmatrix formulation the filter used before, with
+ * CholeskyFactorization and QRFactorization.  The sequence has process noise
+ * with and without zero diagonal entries, identity and general solve-for
+ * conversions, and scalar and vector measurements.  After each update the
+ * covariances, gains, state corrections and information matrices must agree
+ * to within roundoff.
+ *
+ * The program returns 0 when every check passes.
+ */
+//------------------------------------------------------------------------------
+
+#include "SquareRootFilterKernel.hpp"
+#include "CholeskyFactorization.hpp"
+#include "QRFactorization.hpp"
+#include "BaseException.hpp"
+#include "TestHarness.hpp"
+
+#include <cmath>
+#include <iostream>
+#include <string>
+
+namespace
+{
+   const Integer STATE_SIZE = 6;
+}
+
+
+//------------------------------------------------------------------------------
+// Real MaxElement(const Rmatrix &a)
+//------------------------------------------------------------------------------
+/**
+ * Returns the largest absolute value of the elements of a matrix.
+ */
+//------------------------------------------------------------------------------
+Real MaxElement(const Rmatrix &a)
+{
+   Real largest = 0.0;
+   for (Integer i = 0; i < a.GetNumRows(); ++i)
+      for (Integer j = 0; j < a.GetNumColumns(); ++j)
+         largest = std::max(largest, std::fabs(a(i, j)));
+   return largest;
+}
+
+
+//------------------------------------------------------------------------------
+// bool Matches(const Rmatrix &a, const Rmatrix &b, Real tolerance)
+//------------------------------------------------------------------------------
+/**
+ * Compares two matrices relative to the largest element of the first.
+ */
+//------------------------------------------------------------------------------
+bool Matches(const Rmatrix &a, const Rmatrix &b, Real tolerance = 1.0e-11)
+{
+   if ((a.GetNumRows() != b.GetNumRows()) ||
+       (a.GetNumColumns() != b.GetNumColumns()))
+      return false;
+
+   return MaxElement(a - b) <= tolerance * MaxElement(a);
+}
+
+
+//------------------------------------------------------------------------------
+// void ReferenceTimeUpdate(Rmatrix &sqrtP_T, const Rmatrix &stm,
+//       const Rmatrix &Q, const Rmatrix &dX_dSPrev, const Rmatrix &dX_dS)
+//------------------------------------------------------------------------------
+/**
+ * The time update of ExtendedKalmanFilter before the kernel was added.
+ */
+//------------------------------------------------------------------------------
+void ReferenceTimeUpdate(Rmatrix &sqrtP_T, const Rmatrix &stm,
+      const Rmatrix &Q, const Rmatrix &dX_dSPrev, const Rmatrix &dX_dS)
+{
+   Integer stateSize = sqrtP_T.GetNumRows();
+   CholeskyFactorization cf;
+   QRFactorization qr(false);
+
+   Rmatrix dS_dX = dX_dS.Inverse();
+   Rmatrix Q_S = dS_dX * Q * dS_dX.Transpose();
+   Rmatrix stm_S = dS_dX * stm * dX_dSPrev;
+
+   Rmatrix C(2 * stateSize, stateSize);
+   Rmatrix C1 = sqrtP_T * stm_S.Transpose();
+   Rmatrix sqrtQ_T(stateSize, stateSize);
+
+   bool hasZeroDiag = false;
+   for (Integer ii = 0; ii < stateSize; ii++)
+      if (Q_S(ii, ii) == 0.0)
+         hasZeroDiag = true;
+
+   if (!hasZeroDiag)
+      cf.Factor(Q_S, sqrtQ_T);
+   else
+   {
+      IntegerArray removedIndexes;
+      IntegerArray auxVector;
+      Integer numRemoved;
+      Rmatrix reducedQ_S = MatrixFactorization::CompressNormalMatrix(Q_S,
+            removedIndexes, auxVector, numRemoved);
+      Rmatrix reducedSqrtQ_T(stateSize - numRemoved, stateSize - numRemoved);
+      cf.Factor(reducedQ_S, reducedSqrtQ_T);
+      sqrtQ_T = MatrixFactorization::ExpandNormalMatrixInverse(reducedSqrtQ_T,
+            auxVector, numRemoved);
+   }
+
+   for (Integer ii = 0; ii < stateSize; ii++)
+   {
+      for (Integer jj = 0; jj < stateSize; jj++)
+      {
+         C(ii, jj) = C1(ii, jj);
+         C(ii + stateSize, jj) = sqrtQ_T(ii, jj);
+      }
+   }
+
+   Rmatrix Tc(2 * stateSize, 2 * stateSize);
+   Rmatrix Uc(2 * stateSize, stateSize);
+   qr.Factor(C, Uc, Tc);
+
+   for (Integer ii = 0; ii < stateSize; ii++)
+      for (Integer jj = 0; jj < stateSize; jj++)
+         sqrtP_T(ii, jj) = Uc(ii, jj);
+}
+
+
+//------------------------------------------------------------------------------
+// void ReferenceMeasurementUpdate(Rmatrix &sqrtP_T, Rmatrix &kalman,
+//       const Rmatrix &H, const Rmatrix &R)
+//------------------------------------------------------------------------------
+/**
+ * The gain and covariance update of ExtendedKalmanFilter before the kernel
+ * was added.
+ */
+//------------------------------------------------------------------------------
+void ReferenceMeasurementUpdate(Rmatrix &sqrtP_T, Rmatrix &kalman,
+      const Rmatrix &H, const Rmatrix &R)
+{
+   Integer stateSize = sqrtP_T.GetNumRows();
+   Integer measSize = R.GetNumRows();
+   CholeskyFactorization cf;
+   QRFactorization qr(false);
+
+   Rmatrix A(measSize + stateSize, measSize + stateSize);
+   Rmatrix sqrtR_T(measSize, measSize);
+   cf.Factor(R, sqrtR_T);
+   Rmatrix A21 = sqrtP_T * H.Transpose();
+
+   for (Integer ii = 0; ii < measSize; ii++)
+      for (Integer jj = 0; jj < measSize; jj++)
+         A(ii, jj) = sqrtR_T(ii, jj);
+   for (Integer ii = 0; ii < stateSize; ii++)
+   {
+      for (Integer jj = 0; jj < measSize; jj++)
+         A(measSize + ii, jj) = A21(ii, jj);
+      for (Integer jj = 0; jj < stateSize; jj++)
+         A(measSize + ii, measSize + jj) = sqrtP_T(ii, jj);
+   }
+
+   Rmatrix Ta(measSize + stateSize, measSize + stateSize);
+   Rmatrix Ua(measSize + stateSize, measSize + stateSize);
+   qr.Factor(A, Ua, Ta);
+
+   Rmatrix sqrtB_T(measSize, measSize);
+   Rmatrix W_T(measSize, stateSize);
+   for (Integer ii = 0; ii < measSize; ii++)
+      for (Integer jj = 0; jj < measSize; jj++)
+         sqrtB_T(ii, jj) = Ua(ii, jj);
+   for (Integer ii = 0; ii < measSize; ii++)
+      for (Integer jj = 0; jj < stateSize; jj++)
+         W_T(ii, jj) = Ua(ii, measSize + jj);
+   for (Integer ii = 0; ii < stateSize; ii++)
+      for (Integer jj = 0; jj < stateSize; jj++)
+         sqrtP_T(ii, jj) = Ua(measSize + ii, measSize + jj);
+
+   kalman = W_T.Transpose() * sqrtB_T.Transpose().Inverse();
+}
+
+
+/**
+ * Runs the kernel and the reference side by side
+ */
+class KernelComparison
+{
+public:
+   KernelComparison(const Rmatrix &cov) :
+      referenceFactor   (cov.GetNumRows(), cov.GetNumColumns())
+   {
+      CholeskyFactorization cf;
+      cf.Factor(cov, referenceFactor);
+      kernel.Initialize(cov);
+      CompareCovariance("initial covariance");
+   }
+
+   void TimeUpdate(const Rmatrix &stm, const Rmatrix &Q,
+                   const Rmatrix &dX_dSPrev, const Rmatrix &dX_dS,
+                   const std::string &what)
+   {
+      ReferenceTimeUpdate(referenceFactor, stm, Q, dX_dSPrev, dX_dS);
+      kernel.TimeUpdate(stm, Q, dX_dSPrev, dX_dS);
+      CompareCovariance(what);
+   }
+
+   void MeasurementUpdate(const Rmatrix &H, const Rmatrix &R,
+                          const Rvector &residual, const std::string &what)
+   {
+      Rmatrix referenceGain;
+      ReferenceMeasurementUpdate(referenceFactor, referenceGain, H, R);
+      kernel.MeasurementUpdate(H, R);
+
+      Rmatrix gain;
+      kernel.GetGain(gain);
+      Check(Matches(referenceGain, gain), what + ": gain");
+
+      Rvector dx(STATE_SIZE);
+      kernel.ApplyGain(residual, dx);
+      Rvector referenceDx = referenceGain * residual;
+      Rmatrix dxColumn(STATE_SIZE, 1), referenceDxColumn(STATE_SIZE, 1);
+      for (Integer i = 0; i < STATE_SIZE; ++i)
+      {
+         dxColumn(i, 0) = dx[i];
+         referenceDxColumn(i, 0) = referenceDx[i];
+      }
+      Check(Matches(referenceDxColumn, dxColumn), what + ": state correction");
+
+      kernel.AcceptUpdate();
+      CompareCovariance(what);
+   }
+
+protected:
+   SquareRootFilterKernel  kernel;
+   /// sqrt(P)^T as the reference formulation keeps it
+   Rmatrix                 referenceFactor;
+
+   void CompareCovariance(const std::string &what)
+   {
+      Rmatrix referenceCov = referenceFactor.Transpose() * referenceFactor;
+      Rmatrix cov;
+      kernel.GetCovariance(cov);
+      Check(Matches(referenceCov, cov), what + ": covariance");
+
+      // The filter inverted P directly before; that inverse is only good to
+      // about the condition number of P times the roundoff
+      Rmatrix referenceInfo = referenceCov.Inverse();
+      Real condition = STATE_SIZE * MaxElement(referenceCov) *
+            MaxElement(referenceInfo);
+      Rmatrix info;
+      Check(kernel.GetInformation(info, 1.0e-30), what + ": information "
+            "available");
+      Check(Matches(referenceInfo, info, 1.0e-14 * condition),
+            what + ": information");
+   }
+};
+
+
+//------------------------------------------------------------------------------
+// int main()
+//------------------------------------------------------------------------------
+int main()
+{
+   try
+   {
+      // Position and velocity covariance, km and km/s, with correlations
+      Rmatrix P0(STATE_SIZE, STATE_SIZE);
+      const Real sigma[STATE_SIZE] = { 1.0, 1.2, 0.8, 1.0e-3, 1.5e-3, 9.0e-4 };
+      for (Integer i = 0; i < STATE_SIZE; ++i)
+         for (Integer j = 0; j < STATE_SIZE; ++j)
+            P0(i, j) = sigma[i] * sigma[j] *
+                  (i == j ? 1.0 : 0.3 / (1.0 + std::abs(i - j)));
+
+      // Two body like STM over 60 s
+      Rmatrix stm = Rmatrix::Identity(STATE_SIZE);
+      for (Integer i = 0; i < 3; ++i)
+      {
+         stm(i, i + 3) = 60.0;
+         for (Integer j = 0; j < 3; ++j)
+         {
+            stm(i + 3, j) += -1.0e-6 * (i == j ? 1.0 : 0.1);
+            stm(i, j) += -1.8e-3 * (i == j ? 1.0 : 0.1);
+         }
+      }
+
+      // Full process noise
+      Rmatrix fullQ(STATE_SIZE, STATE_SIZE);
+      for (Integer i = 0; i < STATE_SIZE; ++i)
+         for (Integer j = 0; j < STATE_SIZE; ++j)
+            fullQ(i, j) = 1.0e-10 * (i == j ? 2.0 : 0.5 / (1.0 + i + j));
+
+      // Velocity only process noise: zero position diagonal entries
+      Rmatrix velocityQ(STATE_SIZE, STATE_SIZE);
+      for (Integer i = 3; i < STATE_SIZE; ++i)
+         for (Integer j = 3; j < STATE_SIZE; ++j)
+            velocityQ(i, j) = 1.0e-12 * (i == j ? 1.0 : 0.2);
+
+      // Solve-for conversions: identity, and two general ones
+      Rmatrix identity = Rmatrix::Identity(STATE_SIZE);
+      Rmatrix conversionPrev = Rmatrix::Identity(STATE_SIZE);
+      Rmatrix conversion = Rmatrix::Identity(STATE_SIZE);
+      for (Integer i = 0; i < STATE_SIZE; ++i)
+      {
+         for (Integer j = 0; j < STATE_SIZE; ++j)
+         {
+            conversionPrev(i, j) += 0.05 * std::sin(1.0 + i + 2.0 * j);
+            conversion(i, j) += 0.05 * std::cos(2.0 + i - j);
+         }
+      }
+
+      // Range like scalar measurement
+      Rmatrix scalarH(1, STATE_SIZE);
+      Real direction[3] = { 0.6, -0.48, 0.64 };
+      for (Integer i = 0; i < 3; ++i)
+         scalarH(0, i) = direction[i];
+      Rmatrix scalarR(1, 1);
+      scalarR(0, 0) = 1.0e-4;
+      Rvector scalarResidual(1, 0.02);
+
+      // Angles and range rate like vector measurement with correlated noise
+      Rmatrix vectorH(3, STATE_SIZE);
+      for (Integer i = 0; i < 3; ++i)
+         for (Integer j = 0; j < STATE_SIZE; ++j)
+            vectorH(i, j) = std::sin(0.7 * (i + 1) + 1.3 * j) *
+                  (j < 3 ? 1.0e-3 : 1.0);
+      Rmatrix vectorR(3, 3);
+      for (Integer i = 0; i < 3; ++i)
+         for (Integer j = 0; j < 3; ++j)
+            vectorR(i, j) = 1.0e-8 * (i == j ? 1.0 : 0.25);
+      Rvector vectorResidual(3, 2.0e-4, -1.0e-4, 5.0e-5);
+
+      KernelComparison compare(P0);
+      compare.TimeUpdate(stm, fullQ, identity, identity,
+            "time update, full noise");
+      compare.MeasurementUpdate(scalarH, scalarR, scalarResidual,
+            "scalar measurement");
+      compare.TimeUpdate(stm, velocityQ, identity, identity,
+            "time update, zero noise diagonals");
+      compare.MeasurementUpdate(vectorH, vectorR, vectorResidual,
+            "vector measurement");
+      compare.TimeUpdate(stm, fullQ, conversionPrev, conversion,
+            "time update, full noise, converted");
+      compare.MeasurementUpdate(vectorH, vectorR, vectorResidual,
+            "vector measurement after conversion");
+      compare.TimeUpdate(stm, fullQ, conversion, conversionPrev,
+            "time update, full noise, converted back");
+      compare.MeasurementUpdate(scalarH, scalarR, scalarResidual,
+            "scalar measurement after conversion");
+   }
+   catch (BaseException &ex)
+   {
+      Check(false, ex.GetFullMessage());
+   }
+
+   return TestHarness::Finish("Square root filter kernel");
+}
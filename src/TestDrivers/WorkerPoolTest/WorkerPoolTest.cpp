@@ -0,0 +1,242 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                               WorkerPoolTest
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/16
+//
+/**
+ * Tests of the WorkerPool class.
+ *
+ * Checks that every task runs once, that worker indices stay inside the
+ * pool, that the lowest numbered exception is rethrown, and that a Run()
+ * made from a task of a larger pool runs serially as worker 0 of the inner
+ * pool, the way the per-worker scratch data of GravityField and the CSALT
+ * path function managers is indexed.  A pool inherited by a forked child,
+ * as in the concurrent perturbation passes of the solvers, must still run.
+ *
+ * The program returns 0 when every check passes.
+ */
+//------------------------------------------------------------------------------
+
+#include "WorkerPool.hpp"
+#include "TestHarness.hpp"
+
+#include <atomic>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+   #include <sys/wait.h>
+   #include <unistd.h>
+#endif
+
+
+//------------------------------------------------------------------------------
+// void TestRun()
+//------------------------------------------------------------------------------
+/**
+ * Every task runs exactly once, on a worker of the pool.
+ */
+//------------------------------------------------------------------------------
+void TestRun()
+{
+   WorkerPool pool(4);
+   Check(pool.GetThreadCount() == 4, "thread count");
+
+   for (Integer rep = 0; rep < 50; ++rep)
+   {
+      std::vector<std::atomic<Integer> > runs(101);
+      std::atomic<Integer> badWorker(0);
+      pool.Run(101, [&](Integer task, Integer worker)
+      {
+         ++runs[task];
+         if ((worker < 0) || (worker >= 4))
+            ++badWorker;
+      });
+
+      bool once = true;
+      for (UnsignedInt i = 0; i < runs.size(); ++i)
+         once = once && (runs[i] == 1);
+      Check(once, "each task runs once");
+      Check(badWorker == 0, "worker index inside the pool");
+   }
+   Check(!WorkerPool::IsInTask(), "IsInTask outside a task");
+}
+
+//------------------------------------------------------------------------------
+// void TestExceptions()
+//------------------------------------------------------------------------------
+/**
+ * The exception of the lowest numbered failing task is rethrown, and the
+ * pool can be used again afterwards.
+ */
+//------------------------------------------------------------------------------
+void TestExceptions()
+{
+   WorkerPool pool(4);
+   std::string caught;
+   try
+   {
+      pool.Run(40, [&](Integer task, Integer)
+      {
+         if ((task == 7) || (task == 23) || (task == 31))
+            throw std::runtime_error(std::to_string(task));
+      });
+   }
+   catch (std::exception &ex)
+   {
+      caught = ex.what();
+   }
+   Check(caught == "7", "lowest task exception rethrown");
+
+   std::atomic<Integer> count(0);
+   pool.Run(40, [&](Integer, Integer) { ++count; });
+   Check(count == 40, "pool usable after an exception");
+}
+
+//------------------------------------------------------------------------------
+// void TestNested()
+//------------------------------------------------------------------------------
+/**
+ * A Run() on a small pool from the tasks of a larger one is serial and uses
+ * worker 0 of the small pool.  The inner tasks index per-worker scratch data
+ * sized for the inner pool; an outer worker index would overrun it.
+ */
+//------------------------------------------------------------------------------
+void TestNested()
+{
+   const Integer outerCount = 8;
+   const Integer innerCount = 2;
+   WorkerPool outer(outerCount);
+
+   // One inner pool and scratch array per outer task, like the force models
+   // of the PropagateEnsemble workers or the phases of a CSALT Trajectory
+   std::vector<WorkerPool*> inner;
+   std::vector<std::vector<Integer> > scratch;
+   for (Integer i = 0; i < outerCount; ++i)
+   {
+      inner.push_back(new WorkerPool(innerCount));
+      scratch.push_back(std::vector<Integer>(innerCount, 0));
+   }
+
+   std::atomic<Integer> badWorker(0), notInTask(0), total(0);
+   for (Integer rep = 0; rep < 20; ++rep)
+   {
+      outer.Run(outerCount, [&](Integer task, Integer)
+      {
+         if (!WorkerPool::IsInTask())
+            ++notInTask;
+         inner[task]->Run(16, [&](Integer, Integer worker)
+         {
+            if ((worker < 0) || (worker >= innerCount))
+               ++badWorker;
+            else
+               ++scratch[task][worker];
+            ++total;
+         });
+      });
+   }
+
+   Check(notInTask == 0, "IsInTask inside a task");
+   Check(badWorker == 0, "nested worker index inside the inner pool");
+   Check(total == 20 * outerCount * 16, "every nested task runs");
+   bool serial = true;
+   for (Integer i = 0; i < outerCount; ++i)
+      serial = serial && (scratch[i][0] == 20 * 16);
+   Check(serial, "nested tasks run serially as worker 0");
+
+   for (Integer i = 0; i < outerCount; ++i)
+      delete inner[i];
+
+   // The inner pool works normally again once outside the outer pool
+   WorkerPool single(innerCount);
+   std::atomic<Integer> count(0);
+   outer.Run(4, [&](Integer, Integer) {});
+   single.Run(10, [&](Integer, Integer worker)
+   {
+      if ((worker >= 0) && (worker < innerCount))
+         ++count;
+   });
+   Check(count == 10, "pool usable after nested use");
+}
+
+//------------------------------------------------------------------------------
+// void TestFork()
+//------------------------------------------------------------------------------
+/**
+ * A forked child has none of the pool threads; Run() and the destructor must
+ * still complete there.  The child is given a few seconds before it is
+ * treated as hung.
+ */
+//------------------------------------------------------------------------------
+void TestFork()
+{
+   #ifndef _WIN32
+      WorkerPool *pool = new WorkerPool(4);
+
+      // Start the threads and leave them waiting for work
+      std::atomic<Integer> count(0);
+      pool->Run(8, [&](Integer, Integer) { ++count; });
+
+      pid_t pid = fork();
+      if (pid == 0)
+      {
+         alarm(10);
+         Integer sum = 0, badWorker = 0;
+         pool->Run(100, [&](Integer task, Integer worker)
+         {
+            sum += task;
+            if (worker != 0)
+               ++badWorker;
+         });
+         delete pool;
+         _exit(((sum == 4950) && (badWorker == 0)) ? 0 : 1);
+      }
+
+      Check(pid > 0, "fork");
+      if (pid > 0)
+      {
+         int status = 0;
+         waitpid(pid, &status, 0);
+         Check(WIFEXITED(status) && (WEXITSTATUS(status) == 0),
+               "pool runs in a forked child");
+      }
+
+      // The parent's threads are unaffected
+      pool->Run(8, [&](Integer, Integer) { ++count; });
+      Check(count == 16, "pool runs in the parent after a fork");
+      delete pool;
+   #endif
+}
+
+//------------------------------------------------------------------------------
+// int main()
+//------------------------------------------------------------------------------
+int main()
+{
+   TestRun();
+   TestExceptions();
+   TestNested();
+   TestFork();
+
+   return TestHarness::Finish("WorkerPool");
+}
@@ -0,0 +1,69 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                                TestHarness
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/16
+//
+/**
+ * The checks shared by the test drivers.
+ *
+ * A driver calls Check() for each condition it tests, and returns the value
+ * of Finish() from main(), so ctest sees a nonzero exit code when any check
+ * failed.
+ */
+//------------------------------------------------------------------------------
+#ifndef TestHarness_hpp
+#define TestHarness_hpp
+
+#include "utildefs.hpp"
+#include <iostream>
+#include <string>
+
+namespace TestHarness
+{
+   /// Number of failed checks in this program
+   inline Integer& Failures()
+   {
+      static Integer failures = 0;
+      return failures;
+   }
+
+   /// Reports a failed check
+   inline void Check(bool condition, const std::string &what)
+   {
+      if (!condition)
+      {
+         std::cout << "FAILED: " << what << "\n";
+         ++Failures();
+      }
+   }
+
+   /// Reports the outcome; returns the exit code for main()
+   inline int Finish(const std::string &suite)
+   {
+      if (Failures() == 0)
+         std::cout << suite << " tests passed\n";
+      return (Failures() == 0 ? 0 : 1);
+   }
+}
+
+using TestHarness::Check;
+
+#endif // TestHarness_hpp
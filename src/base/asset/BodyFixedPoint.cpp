@@ -48,6 +48,7 @@
 #include <fstream>
 #include <sstream>
 #include "BodyFixedPoint.hpp"
+#include "ParameterIndex.hpp"
 #include "AssetException.hpp"
 #include "MessageInterface.hpp"
 #include "RealUtilities.hpp"
@@ -549,11 +550,11 @@ Integer BodyFixedPoint::GetParameterID(const std::string &str) const
    if (str == locationLabels[2])
       return LOCATION_3;
 
-   for (Integer i = SpacePointParamCount; i < BodyFixedPointParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - SpacePointParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("BodyFixedPoint", PARAMETER_TEXT,
+         SpacePointParamCount, BodyFixedPointParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
 
    return SpacePoint::GetParameterID(str);
 }
@@ -45,6 +45,7 @@
 #include <sstream>
 #include <iomanip>
 #include "Attitude.hpp"
+#include "ParameterIndex.hpp"
 #include "AttitudeException.hpp"
 #include "RealUtilities.hpp"
 #include "MessageInterface.hpp"
@@ -1447,17 +1448,17 @@ std::string Attitude::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer Attitude::GetParameterID(const std::string &str) const
 {
-   for (Integer i = GmatBaseParamCount; i < AttitudeParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatBaseParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("Attitude", PARAMETER_TEXT,
+         GmatBaseParamCount, AttitudeParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
    // otherwise, check for other reps
-   for (Integer i = OTHER_REPS_OFFSET; i < EndOtherReps; i++)
-   {
-      if (str == OTHER_REP_TEXT[i - OTHER_REPS_OFFSET])
-         return i;
-   }
+   static const ParameterIndex otherRepIndex("Attitude", OTHER_REP_TEXT,
+         OTHER_REPS_OFFSET, EndOtherReps);
+   id = otherRepIndex.Find(str);
+   if (id != -1)
+      return id;
    
    return GmatBase::GetParameterID(str);
 }
@@ -35,6 +35,7 @@
 #include "Attitude.hpp"
 #include "AttitudeException.hpp"
 #include "SpiceAttitude.hpp"
+#include "ParameterIndex.hpp"
 #include "MessageInterface.hpp"
 #include "AttitudeConversionUtility.hpp"
 
@@ -504,11 +505,11 @@ std::string SpiceAttitude::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer SpiceAttitude::GetParameterID(const std::string &str) const
 {
-   for (Integer i = AttitudeParamCount; i < SpiceAttitudeParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - AttitudeParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("SpiceAttitude", PARAMETER_TEXT,
+         AttitudeParamCount, SpiceAttitudeParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
 
    return Attitude::GetParameterID(str);
 }
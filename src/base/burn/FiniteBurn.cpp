@@ -31,6 +31,7 @@
 
 
 #include "FiniteBurn.hpp"
+#include "ParameterIndex.hpp"
 #include "BurnException.hpp"
 #include "StringUtil.hpp"          // for ToString()
 #include "MessageInterface.hpp"
@@ -526,11 +527,11 @@ Integer FiniteBurn::GetParameterID(const std::string &str) const
       return BURNAXES;
    }
    
-   for (Integer i = BurnParamCount; i < FiniteBurnParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - BurnParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("FiniteBurn", PARAMETER_TEXT,
+         BurnParamCount, FiniteBurnParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
    
    return Burn::GetParameterID(str);
 }
@@ -31,6 +31,7 @@
 
 
 #include "ImpulsiveBurn.hpp"
+#include "ParameterIndex.hpp"
 #include "BurnException.hpp"
 #include "MessageInterface.hpp"
 #include "StringUtil.hpp"
@@ -617,11 +618,11 @@ std::string ImpulsiveBurn::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer ImpulsiveBurn::GetParameterID(const std::string &str) const
 {
-   for (Integer i = BurnParamCount; i < ImpulsiveBurnParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - BurnParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("ImpulsiveBurn", PARAMETER_TEXT,
+         BurnParamCount, ImpulsiveBurnParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
    
    return Burn::GetParameterID(str);
 }
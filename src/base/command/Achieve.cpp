@@ -31,6 +31,7 @@
 
 
 #include "Achieve.hpp"
+#include "ParameterIndex.hpp"
 #include "StringUtil.hpp"  // for ToReal()
 #include <sstream>
 #include "MessageInterface.hpp"
@@ -324,11 +325,11 @@ std::string Achieve::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer Achieve::GetParameterID(const std::string &str) const
 {
-   for (Integer i = SolverSequenceCommandParamCount; i < AchieveParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - SolverSequenceCommandParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("Achieve", PARAMETER_TEXT,
+         SolverSequenceCommandParamCount, AchieveParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
 
    return SolverSequenceCommand::GetParameterID(str);
 }
@@ -29,6 +29,7 @@
  */
 //------------------------------------------------------------------------------
 #include "CallFunction.hpp"
+#include "ParameterIndex.hpp"
 #include "BeginFunction.hpp"
 #include "StringTokenizer.hpp"
 #include "StringUtil.hpp"          // for Replace()
@@ -565,11 +566,11 @@ Integer CallFunction::GetParameterID(const std::string &str) const
       MessageInterface::ShowMessage("CallFunction::GetParameterID \n");
    #endif
 
-   for (int i=GmatCommandParamCount; i<CallFunctionParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatCommandParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("CallFunction", PARAMETER_TEXT,
+         GmatCommandParamCount, CallFunctionParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
    
    return GmatCommand::GetParameterID(str);
 }
@@ -33,6 +33,7 @@
 #include <ctype.h>                // for isalpha
 #include "gmatdefs.hpp"
 #include "ConditionalBranch.hpp"
+#include "ParameterIndex.hpp"
 #include "Parameter.hpp"
 #include "StringUtil.hpp"         // for GetArrayIndex()
 #include "MessageInterface.hpp"
@@ -780,11 +781,11 @@ std::string ConditionalBranch::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer ConditionalBranch::GetParameterID(const std::string &str) const
 {
-   for (Integer i = BranchCommandParamCount; i < ConditionalBranchParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - BranchCommandParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("ConditionalBranch",
+         PARAMETER_TEXT, BranchCommandParamCount, ConditionalBranchParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
    
    return BranchCommand::GetParameterID(str);
 }
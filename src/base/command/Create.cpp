@@ -31,6 +31,7 @@
 
 
 #include "Create.hpp"
+#include "ParameterIndex.hpp"
 #include "MessageInterface.hpp"
 #include "CommandException.hpp"
 #include "StringUtil.hpp"
@@ -167,11 +168,11 @@ std::string Create::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer Create::GetParameterID(const std::string &str) const
 {
-   for (Integer i = ManageObjectParamCount; i < CreateParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - ManageObjectParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("Create", PARAMETER_TEXT,
+         ManageObjectParamCount, CreateParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
    
    return ManageObject::GetParameterID(str);
 }
@@ -367,6 +368,11 @@ bool Create::Initialize()
       if (refObj->IsOfType(Gmat::CELESTIAL_BODY))
          continue;
       
+      // Skip objects already in the LOS, such as the locals a FunctionManager
+      // keeps between calls; InsertIntoLOS() would discard the clone anyway
+      if (IsInLOS(useNames.at(jj), jj))
+         continue;
+      
       GmatBase *newObj = refObj->Clone();
       #ifdef DEBUG_MEMORY
       MemoryTracker::Instance()->Add
@@ -458,6 +464,47 @@ void Create::SetArrayInfo()
    }
 }
 
+//------------------------------------------------------------------------------
+// bool IsInLOS(const std::string &withName, Integer index)
+//------------------------------------------------------------------------------
+/**
+ * Checks for an object that InsertIntoLOS() would keep in place of a new clone.
+ *
+ * @param withName The name of the object
+ * @param index    The index of the name, used for the Array dimensions
+ *
+ * @return true if the LOS already holds a usable object with that name
+ */
+//------------------------------------------------------------------------------
+bool Create::IsInLOS(const std::string &withName, Integer index)
+{
+   if ((objectMap == NULL) || refObj->IsGlobal() ||
+       refObj->IsOfType(Gmat::ODE_MODEL))
+      return false;
+   
+   ObjectMap::iterator mapi = objectMap->find(withName);
+   if ((mapi == objectMap->end()) || (mapi->second == NULL))
+      return false;
+   
+   // Mismatches go through InsertIntoLOS() to report the error
+   GmatBase *mapObj = mapi->second;
+   if (!mapObj->IsOfType(objType))
+      return false;
+   if (objType == "Array")
+   {
+      Integer r, c;
+      ((Array*) mapObj)->GetSize(r, c);
+      if ((r != rows.at(index)) || (c != columns.at(index)))
+         return false;
+   }
+   
+   #ifdef DEBUG_CREATE_INIT
+   MessageInterface::ShowMessage
+      ("   IsInLOS: '%s' <%p> is already in the LOS\n", withName.c_str(), mapObj);
+   #endif
+   return true;
+}
+
 //------------------------------------------------------------------------------
 // bool InsertIntoLOS(GmatBase *obj, const std::string &withName)
 //------------------------------------------------------------------------------
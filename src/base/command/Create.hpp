@@ -90,6 +90,7 @@ protected:
    IntegerArray columns;
    
    void SetArrayInfo();
+   bool IsInLOS(const std::string &withName, Integer index);
    bool InsertIntoLOS(GmatBase *obj, const std::string &withName);
    bool InsertIntoObjectStore(GmatBase *obj, const std::string &withName);
 };
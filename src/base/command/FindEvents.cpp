@@ -28,6 +28,7 @@
 //------------------------------------------------------------------------------
 
 #include "FindEvents.hpp"
+#include "ParameterIndex.hpp"
 
 
 //#define DEBUG_FIND_EVENTS
@@ -182,11 +183,11 @@ std::string FindEvents::GetParameterText(const Integer id) const
 //---------------------------------------------------------------------------
 Integer FindEvents::GetParameterID(const std::string &str) const
 {
-   for (Integer i = GmatCommandParamCount; i < FindEventsParamCount; ++i)
-   {
-      if (str == PARAMETER_TEXT[i - GmatCommandParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("FindEvents", PARAMETER_TEXT,
+         GmatCommandParamCount, FindEventsParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
 
    return GmatCommand::GetParameterID(str);
 }
@@ -32,6 +32,7 @@
 #include <sstream>               // for std::stringstream, used to make generating string
 #include "gmatdefs.hpp"
 #include "For.hpp"
+#include "ParameterIndex.hpp"
 #include "BranchCommand.hpp"
 #include "CommandException.hpp"
 #include "FunctionManager.hpp"   // for GetFunctionPathAndName()
@@ -644,11 +645,11 @@ std::string For::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer For::GetParameterID(const std::string &str) const
 {
-   for (Integer i = BranchCommandParamCount; i < ForParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - BranchCommandParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("For", PARAMETER_TEXT,
+         BranchCommandParamCount, ForParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
    
    return BranchCommand::GetParameterID(str);
 }
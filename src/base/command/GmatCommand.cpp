@@ -31,6 +31,7 @@
 
 
 #include "GmatCommand.hpp"       // class's header file
+#include "ParameterIndex.hpp"
 #include "CommandException.hpp"
 #include "Parameter.hpp"
 #include "CoordinateConverter.hpp"
@@ -1201,11 +1202,11 @@ std::string GmatCommand::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer GmatCommand::GetParameterID(const std::string &str) const
 {
-   for (Integer i = GmatBaseParamCount; i < GmatCommandParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatBaseParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("GmatCommand", PARAMETER_TEXT,
+         GmatBaseParamCount, GmatCommandParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
 
    return GmatBase::GetParameterID(str);
 }
@@ -32,6 +32,7 @@
 #include <sstream>
 #include "gmatdefs.hpp"
 #include "If.hpp"
+#include "ParameterIndex.hpp"
 #include "Parameter.hpp"
 #include "MessageInterface.hpp"
 
@@ -291,11 +292,11 @@ std::string If::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer If::GetParameterID(const std::string &str) const
 {
-   for (Integer i = ConditionalBranchParamCount; i < IfParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - ConditionalBranchParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("If", PARAMETER_TEXT,
+         ConditionalBranchParamCount, IfParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
    
    return ConditionalBranch::GetParameterID(str);
 }
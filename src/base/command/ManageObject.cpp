@@ -31,6 +31,7 @@
 
 
 #include "ManageObject.hpp"
+#include "ParameterIndex.hpp"
 #include "MessageInterface.hpp"
 #include "CommandException.hpp"
 #include "Array.hpp"
@@ -132,11 +133,11 @@ std::string ManageObject::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer ManageObject::GetParameterID(const std::string &str) const
 {
-   for (Integer i = GmatCommandParamCount; i < ManageObjectParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatCommandParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("ManageObject", PARAMETER_TEXT,
+         GmatCommandParamCount, ManageObjectParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
    
    return GmatCommand::GetParameterID(str);
 }
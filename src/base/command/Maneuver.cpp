@@ -31,6 +31,7 @@
 
 
 #include "Maneuver.hpp"
+#include "ParameterIndex.hpp"
 #include "MessageInterface.hpp"
 #include <sstream>                 // for <<
 #include "StringUtil.hpp"
@@ -407,11 +408,11 @@ std::string Maneuver::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer Maneuver::GetParameterID(const std::string &str) const
 {
-   for (Integer i = GmatCommandParamCount; i < ManeuverCommandParamCount; ++i)
-   {
-      if (str == PARAMETER_TEXT[i - GmatCommandParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("Maneuver", PARAMETER_TEXT,
+         GmatCommandParamCount, ManeuverCommandParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
 
    return GmatCommand::GetParameterID(str);
 }
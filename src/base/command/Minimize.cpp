@@ -31,6 +31,7 @@
 
 
 #include "Minimize.hpp"
+#include "ParameterIndex.hpp"
 #include "StringUtil.hpp"          // for ToDouble()
 #include "MessageInterface.hpp"
 #include <sstream>                 // for stringstream
@@ -327,11 +328,11 @@ std::string Minimize::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer Minimize::GetParameterID(const std::string &str) const
 {
-   for (Integer i = SolverSequenceCommandParamCount; i < MinimizeParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - SolverSequenceCommandParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("Minimize", PARAMETER_TEXT,
+         SolverSequenceCommandParamCount, MinimizeParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
 
    return SolverSequenceCommand::GetParameterID(str);
 }
@@ -30,6 +30,7 @@
 //------------------------------------------------------------------------------
 
 #include "NonlinearConstraint.hpp"
+#include "ParameterIndex.hpp"
 #include "StringUtil.hpp"  // for ToReal()
 #include "MessageInterface.hpp"
 #include "Optimizer.hpp"
@@ -339,11 +340,12 @@ std::string NonlinearConstraint::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer NonlinearConstraint::GetParameterID(const std::string &str) const
 {
-   for (Integer i = SolverSequenceCommandParamCount; i < NonlinearConstraintParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - SolverSequenceCommandParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("NonlinearConstraint",
+         PARAMETER_TEXT, SolverSequenceCommandParamCount,
+         NonlinearConstraintParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
 
    return SolverSequenceCommand::GetParameterID(str);
 }
@@ -31,6 +31,7 @@
 
 #include <sstream>
 #include "Optimize.hpp"
+#include "ParameterIndex.hpp"
 #include "MessageInterface.hpp"
 
 //Added __USE_EXTERNAL_OPTIMIZER__ so that header will not be compiled
@@ -277,11 +278,11 @@ std::string Optimize::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer Optimize::GetParameterID(const std::string &str) const
 {
-   for (Integer i = SolverBranchCommandParamCount; i < OptimizeParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - SolverBranchCommandParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("Optimize", PARAMETER_TEXT,
+         SolverBranchCommandParamCount, OptimizeParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
     
    return SolverBranchCommand::GetParameterID(str);
 }
@@ -1154,6 +1155,11 @@ bool Optimize::RunInternalSolver(Solver::SolverState state)
                      "THROUGH THE INTERNAL SOLVER CONTROL SEQUENCE\n\n\n");
             #endif
 
+            // Run the perturbations concurrently when the solver allows it;
+            // the solver then moves on to CALCULATING
+            if (RunPerturbationPasses())
+               break;
+
             branchExecuting = true;
             ApplySubscriberBreakpoint();
             ResetLoopData();
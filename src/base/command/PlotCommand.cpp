@@ -31,6 +31,7 @@
 
 
 #include "PlotCommand.hpp"
+#include "ParameterIndex.hpp"
 #include "MessageInterface.hpp"
 #include "StringUtil.hpp"
 
@@ -241,11 +242,11 @@ std::string PlotCommand::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer PlotCommand::GetParameterID(const std::string &str) const
 {
-   for (Integer i = GmatCommandParamCount; i < PlotCommandParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatCommandParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("PlotCommand", PARAMETER_TEXT,
+         GmatCommandParamCount, PlotCommandParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
    
    return GmatCommand::GetParameterID(str);
 }
@@ -30,8 +30,10 @@
 //------------------------------------------------------------------------------
 
 #include "Propagate.hpp"
+#include "ParameterIndex.hpp"
 
 #include "Propagator.hpp"
+#include "Integrator.hpp"
 #include "ODEModel.hpp"
 
 #include "Publisher.hpp"
@@ -978,11 +980,11 @@ std::string Propagate::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer Propagate::GetParameterID(const std::string &str) const
 {
-   for (Integer i = GmatCommandParamCount; i < PropagateCommandParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatCommandParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("Propagate", PARAMETER_TEXT,
+         GmatCommandParamCount, PropagateCommandParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
 
    return PropagationEnabledCommand::GetParameterID(str);
 }
@@ -5564,6 +5566,41 @@ Real Propagate::InterpolateToStop(StopCondition *sc)
    bool stopIsBracketed = false;
    Real elapsedSeconds = 0.0;
 
+   // When the integrators can interpolate across the step that passed the
+   // stop, fill the ring buffer from their dense output instead of stepping
+   Real denseSpan = GetDenseOutputSpan();
+   if ((denseSpan != 0.0) && (stopInterval * denseSpan > 0.0) &&
+       (fabs(stopInterval) <= fabs(denseSpan)))
+   {
+      while ((!stopIsBracketed) && (ringStepsTaken < 4))
+      {
+         elapsedSeconds += ringStep;
+         MoveToDenseState(elapsedSeconds);
+
+         sc->SetRealParameter(stopCondEpochID, elapsedSeconds);
+         stopIsBracketed = sc->AddToBuffer(firstRingStep);
+
+         ++ringStepsTaken;
+         firstRingStep = false;
+         #ifdef DEBUG_STOPPING_CONDITIONS
+            MessageInterface::ShowMessage("   dense step = %.12lf, value = "
+                  "%.12lf\n", elapsedSeconds, sc->GetStopValue());
+         #endif
+      }
+      RestoreFromDenseState();
+
+      if (stopIsBracketed)
+      {
+         stopEpoch = sc->GetStopEpoch();
+         return stopEpoch;
+      }
+
+      // Not bracketed inside the step; fall back to stepping
+      ringStepsTaken = 0;
+      firstRingStep = true;
+      elapsedSeconds = 0.0;
+   }
+
    while ((!stopIsBracketed) && (ringStepsTaken < 8))
    {
       #ifdef DEBUG_STOPPING_CONDITIONS
@@ -5813,6 +5850,12 @@ Real Propagate::RefineFinalStep(Real secsToStep, StopCondition *stopper)
    }
    else
    {
+      // Start the secants from the stop found on the dense output of the
+      // interpolated step, when there is one
+      Real denseSecsToStep;
+      if (SolveStopWithDenseOutput(stopper, denseSecsToStep))
+         secsToStep = denseSecsToStep;
+
       // Handle non-time based stopping condition refinement
       while (!closeEnough && (attempts < 50))
       {
@@ -7121,6 +7164,202 @@ GmatBase* Propagate::GetClone(Integer cloneIndex)
 //
 //
 
+//------------------------------------------------------------------------------
+// Real GetDenseOutputSpan()
+//------------------------------------------------------------------------------
+/**
+ * Finds the interval ahead of the current state that all of the propagators
+ * can interpolate across without stepping.
+ *
+ * That is the case when every propagator is an integrator with dense output
+ * whose last accepted step starts at the current elapsed time; this holds
+ * after a step has been backed out.
+ *
+ * @return The signed interval covered by every propagator, or 0.0 if any of
+ *         them has no dense output for it
+ */
+//------------------------------------------------------------------------------
+Real Propagate::GetDenseOutputSpan()
+{
+   Real span = 0.0;
+
+   for (UnsignedInt i = 0; i < p.size(); ++i)
+   {
+      if (!p[i]->IsOfType("Integrator"))
+         return 0.0;
+
+      Integrator *integrator = (Integrator*)p[i];
+      if (!integrator->HasDenseOutput())
+         return 0.0;
+
+      Real now = (fm[i] ? fm[i]->GetTime() : p[i]->GetTime());
+      Real start = integrator->GetDenseStepStart();
+      if (fabs(start - now) > 1.0e-12 * (1.0 + fabs(now)))
+         return 0.0;
+
+      Real size = integrator->GetDenseStepSize();
+      if (i == 0)
+         span = size;
+      else if (span * size <= 0.0)
+         return 0.0;
+      else if (fabs(size) < fabs(span))
+         span = size;
+   }
+
+   return span;
+}
+
+//------------------------------------------------------------------------------
+// void MoveToDenseState(Real secsFromStart)
+//------------------------------------------------------------------------------
+/**
+ * Sets the spacecraft to the interpolated states a time after the current
+ * state, without moving the propagators.
+ *
+ * The spacecraft must be buffered before calling this method, and restored
+ * with RestoreFromDenseState() afterwards.
+ *
+ * @param secsFromStart The offset from the current elapsed time; it must be
+ *                      inside the span reported by GetDenseOutputSpan()
+ */
+//------------------------------------------------------------------------------
+void Propagate::MoveToDenseState(Real secsFromStart)
+{
+   for (UnsignedInt i = 0; i < p.size(); ++i)
+   {
+      Integrator *integrator = (Integrator*)p[i];
+      Real now = (fm[i] ? fm[i]->GetTime() : p[i]->GetTime());
+      integrator->GetDenseState(now + secsFromStart, p[i]->GetState());
+
+      if (fm[i])
+      {
+         if (fm[i]->HasPrecisionTime())
+         {
+            GmatTime gt = baseEpochGT[i]; gt.AddSeconds(now + secsFromStart);
+            fm[i]->UpdateSpaceObjectGT(gt);
+         }
+         else
+            fm[i]->UpdateSpaceObject(baseEpoch[i] + (now + secsFromStart) /
+                  GmatTimeConstants::SECS_PER_DAY);
+      }
+      else
+      {
+         if (p[i]->HasPrecisionTime())
+         {
+            GmatTime gt = baseEpochGT[i]; gt.AddSeconds(now + secsFromStart);
+            p[i]->UpdateSpaceObjectGT(gt);
+         }
+         else
+            p[i]->UpdateSpaceObject(baseEpoch[i] + (now + secsFromStart) /
+                  GmatTimeConstants::SECS_PER_DAY);
+      }
+   }
+}
+
+//------------------------------------------------------------------------------
+// void RestoreFromDenseState()
+//------------------------------------------------------------------------------
+/**
+ * Restores the buffered spacecraft and the propagator states after calls to
+ * MoveToDenseState().
+ */
+//------------------------------------------------------------------------------
+void Propagate::RestoreFromDenseState()
+{
+   BufferSatelliteStates(false);
+   for (UnsignedInt i = 0; i < fm.size(); ++i)
+   {
+      if (fm[i])
+         fm[i]->UpdateFromSpaceObject();
+      else
+         p[i]->UpdateFromSpaceObject();
+   }
+}
+
+//------------------------------------------------------------------------------
+// bool SolveStopWithDenseOutput(StopCondition *stopper, Real &secsToStep)
+//------------------------------------------------------------------------------
+/**
+ * Solves for the stop on the dense output of the step ahead of the current
+ * state, using the Illinois variant of regula falsi.
+ *
+ * No force model evaluations are made beyond those the integrators need to
+ * complete their interpolants.  The result is an estimate accurate to the
+ * interpolant; callers still propagate to it and check the stop.
+ *
+ * @param stopper    The stopping condition
+ * @param secsToStep The estimated time to the stop (output)
+ *
+ * @return true if the stop was bracketed by the dense output
+ */
+//------------------------------------------------------------------------------
+bool Propagate::SolveStopWithDenseOutput(StopCondition *stopper,
+                                         Real &secsToStep)
+{
+   Real span = GetDenseOutputSpan();
+   if (span == 0.0)
+      return false;
+
+   Parameter *stopParam = stopper->GetStopParameter();
+   Real target = stopper->GetStopGoal();
+   bool cyclic = stopper->IsCyclicParameter();
+
+   Real value = stopParam->EvaluateReal();
+   Real a = 0.0, fa = (cyclic ? GetRangedAngle(value, target) : value) - target;
+
+   MoveToDenseState(span);
+   value = stopParam->EvaluateReal();
+   Real b = span, fb = (cyclic ? GetRangedAngle(value, target) : value) - target;
+
+   if (fa * fb > 0.0)
+   {
+      RestoreFromDenseState();
+      return false;
+   }
+
+   Real c = b;
+   Integer side = 0;
+   for (Integer attempt = 0; (attempt < 30) && (fb != fa); ++attempt)
+   {
+      c = (a * fb - b * fa) / (fb - fa);
+      MoveToDenseState(c);
+      value = stopParam->EvaluateReal();
+      Real fc = (cyclic ? GetRangedAngle(value, target) : value) - target;
+
+      if (fabs(fc) < stopAccuracy)
+         break;
+
+      if (fc * fb > 0.0)
+      {
+         b = c;
+         fb = fc;
+         if (side == -1)
+            fa *= 0.5;
+         side = -1;
+      }
+      else if (fa * fc > 0.0)
+      {
+         a = c;
+         fa = fc;
+         if (side == 1)
+            fb *= 0.5;
+         side = 1;
+      }
+      else
+         break;
+   }
+
+   RestoreFromDenseState();
+
+   #ifdef DEBUG_STOPPING_CONDITIONS
+      MessageInterface::ShowMessage("   Dense output stop estimate: %.12lf "
+            "secs in a %.12lf sec span\n", c, span);
+   #endif
+
+   secsToStep = c;
+   return true;
+}
+
 //------------------------------------------------------------------------------
 // Real GetRangedAngle(const Real angle, const Real midpt)
 //------------------------------------------------------------------------------
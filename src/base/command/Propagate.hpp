@@ -359,6 +359,12 @@ protected:
    Real                    BisectFinalStep(StopCondition *stopper);
    Real                    BisectToStop(StopCondition *stopper);
    
+   Real                    GetDenseOutputSpan();
+   void                    MoveToDenseState(Real secsFromStart);
+   void                    RestoreFromDenseState();
+   bool                    SolveStopWithDenseOutput(StopCondition *stopper,
+                                                    Real &secsToStep);
+
    Real                    GetRangedAngle(const Real angle, const Real midpt);
       
 private:
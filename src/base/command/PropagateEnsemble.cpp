@@ -0,0 +1,1082 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                            PropagateEnsemble
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/16
+//
+/**
+ * Implementation for the PropagateEnsemble command.
+ */
+//------------------------------------------------------------------------------
+
+#include "PropagateEnsemble.hpp"
+#include "ParameterIndex.hpp"
+#include "ODEModel.hpp"
+#include "Propagator.hpp"
+#include "PropagationStateManager.hpp"
+#include "SolarSystem.hpp"
+#include "WorkerPool.hpp"
+#include "GmatConstants.hpp"
+#include "GmatTime.hpp"
+#include "Publisher.hpp"
+#include "MessageInterface.hpp"
+#include "CommandException.hpp"
+#include "PropagatorException.hpp"
+#include "StringUtil.hpp"
+#include <cmath>
+#include <sstream>
+
+//#define DEBUG_PROPAGATE_ENSEMBLE
+
+//------------------------------------------------------------------------------
+//  static data
+//------------------------------------------------------------------------------
+const std::string PropagateEnsemble::PARAMETER_TEXT[
+      PropagateEnsembleParamCount - GmatCommandParamCount] =
+{
+   "Propagator",
+   "Spacecraft",
+   "Members",
+   "Duration",
+   "PositionSigma",
+   "VelocitySigma",
+   "Seed",
+   "ThreadCount",
+   "BatchSize",
+};
+
+const Gmat::ParameterType PropagateEnsemble::PARAMETER_TYPE[
+      PropagateEnsembleParamCount - GmatCommandParamCount] =
+{
+   Gmat::OBJECT_TYPE,
+   Gmat::OBJECT_TYPE,
+   Gmat::INTEGER_TYPE,
+   Gmat::REAL_TYPE,
+   Gmat::REAL_TYPE,
+   Gmat::REAL_TYPE,
+   Gmat::INTEGER_TYPE,
+   Gmat::INTEGER_TYPE,
+   Gmat::INTEGER_TYPE,
+};
+
+//------------------------------------------------------------------------------
+// PropagateEnsemble()
+//------------------------------------------------------------------------------
+/**
+ * Default constructor.
+ */
+//------------------------------------------------------------------------------
+PropagateEnsemble::PropagateEnsemble() :
+   GmatCommand        ("PropagateEnsemble"),
+   propName           (""),
+   satName            (""),
+   memberCount        (100),
+   duration           (86400.0),
+   positionSigma      (0.0),
+   velocitySigma      (0.0),
+   seed               (1),
+   threadCount        (1),
+   batchSize          (1),
+   prop               (NULL),
+   sat                (NULL),
+   serialWarningShown (false)
+{
+   objectTypeNames.push_back("PropagateEnsemble");
+   physicsBasedCommand = true;
+}
+
+
+//------------------------------------------------------------------------------
+// ~PropagateEnsemble()
+//------------------------------------------------------------------------------
+/**
+ * Destructor.
+ */
+//------------------------------------------------------------------------------
+PropagateEnsemble::~PropagateEnsemble()
+{
+   ClearWorkers();
+}
+
+
+//------------------------------------------------------------------------------
+// PropagateEnsemble(const PropagateEnsemble& pe)
+//------------------------------------------------------------------------------
+/**
+ * Copy constructor.  The worker objects are not copied; they are rebuilt
+ * when the copy executes.
+ *
+ * @param pe The command that gets copied.
+ */
+//------------------------------------------------------------------------------
+PropagateEnsemble::PropagateEnsemble(const PropagateEnsemble& pe) :
+   GmatCommand        (pe),
+   propName           (pe.propName),
+   satName            (pe.satName),
+   memberCount        (pe.memberCount),
+   duration           (pe.duration),
+   positionSigma      (pe.positionSigma),
+   velocitySigma      (pe.velocitySigma),
+   seed               (pe.seed),
+   threadCount        (pe.threadCount),
+   batchSize          (pe.batchSize),
+   prop               (NULL),
+   sat                (NULL),
+   ensemble           (pe.ensemble),
+   serialWarningShown (false)
+{
+}
+
+
+//------------------------------------------------------------------------------
+// PropagateEnsemble& operator=(const PropagateEnsemble& pe)
+//------------------------------------------------------------------------------
+/**
+ * Assignment operator.
+ *
+ * @param pe The command that gets copied.
+ *
+ * @return this instance, with internal data structures set to match the input
+ *         instance.
+ */
+//------------------------------------------------------------------------------
+PropagateEnsemble& PropagateEnsemble::operator=(const PropagateEnsemble& pe)
+{
+   if (&pe != this)
+   {
+      GmatCommand::operator=(pe);
+      ClearWorkers();
+      propName      = pe.propName;
+      satName       = pe.satName;
+      memberCount   = pe.memberCount;
+      duration      = pe.duration;
+      positionSigma = pe.positionSigma;
+      velocitySigma = pe.velocitySigma;
+      seed          = pe.seed;
+      threadCount   = pe.threadCount;
+      batchSize     = pe.batchSize;
+      prop          = NULL;
+      sat           = NULL;
+      ensemble      = pe.ensemble;
+      serialWarningShown = false;
+   }
+
+   return *this;
+}
+
+
+//---------------------------------------------------------------------------
+// std::string GetParameterText(const Integer id) const
+//---------------------------------------------------------------------------
+std::string PropagateEnsemble::GetParameterText(const Integer id) const
+{
+   if ((id >= GmatCommandParamCount) && (id < PropagateEnsembleParamCount))
+      return PARAMETER_TEXT[id - GmatCommandParamCount];
+
+   return GmatCommand::GetParameterText(id);
+}
+
+
+//---------------------------------------------------------------------------
+// Integer GetParameterID(const std::string &str) const
+//---------------------------------------------------------------------------
+Integer PropagateEnsemble::GetParameterID(const std::string &str) const
+{
+   static const ParameterIndex parameterIndex("PropagateEnsemble",
+         PARAMETER_TEXT, GmatCommandParamCount, PropagateEnsembleParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
+
+   return GmatCommand::GetParameterID(str);
+}
+
+
+//---------------------------------------------------------------------------
+// Gmat::ParameterType GetParameterType(const Integer id) const
+//---------------------------------------------------------------------------
+Gmat::ParameterType PropagateEnsemble::GetParameterType(const Integer id) const
+{
+   if ((id >= GmatCommandParamCount) && (id < PropagateEnsembleParamCount))
+      return PARAMETER_TYPE[id - GmatCommandParamCount];
+
+   return GmatCommand::GetParameterType(id);
+}
+
+
+//---------------------------------------------------------------------------
+// std::string GetParameterTypeString(const Integer id) const
+//---------------------------------------------------------------------------
+std::string PropagateEnsemble::GetParameterTypeString(const Integer id) const
+{
+   return GmatCommand::PARAM_TYPE_STRING[GetParameterType(id)];
+}
+
+
+//---------------------------------------------------------------------------
+// std::string GetStringParameter(const Integer id) const
+//---------------------------------------------------------------------------
+std::string PropagateEnsemble::GetStringParameter(const Integer id) const
+{
+   if (id == PROPAGATOR)
+      return propName;
+   if (id == SPACECRAFT)
+      return satName;
+
+   return GmatCommand::GetStringParameter(id);
+}
+
+
+//---------------------------------------------------------------------------
+// std::string GetStringParameter(const std::string &label) const
+//---------------------------------------------------------------------------
+std::string PropagateEnsemble::GetStringParameter(
+      const std::string &label) const
+{
+   return GetStringParameter(GetParameterID(label));
+}
+
+
+//---------------------------------------------------------------------------
+// bool SetStringParameter(const Integer id, const std::string &value)
+//---------------------------------------------------------------------------
+bool PropagateEnsemble::SetStringParameter(const Integer id,
+                                           const std::string &value)
+{
+   if (id == PROPAGATOR)
+   {
+      propName = value;
+      return true;
+   }
+   if (id == SPACECRAFT)
+   {
+      satName = value;
+      return true;
+   }
+
+   return GmatCommand::SetStringParameter(id, value);
+}
+
+
+//---------------------------------------------------------------------------
+// bool SetStringParameter(const std::string &label, const std::string &value)
+//---------------------------------------------------------------------------
+bool PropagateEnsemble::SetStringParameter(const std::string &label,
+                                           const std::string &value)
+{
+   return SetStringParameter(GetParameterID(label), value);
+}
+
+
+//---------------------------------------------------------------------------
+// Integer GetIntegerParameter(const Integer id) const
+//---------------------------------------------------------------------------
+Integer PropagateEnsemble::GetIntegerParameter(const Integer id) const
+{
+   switch (id)
+   {
+      case MEMBERS:
+         return memberCount;
+      case SEED:
+         return seed;
+      case THREAD_COUNT:
+         return threadCount;
+      case BATCH_SIZE:
+         return batchSize;
+      default:
+         break;
+   }
+
+   return GmatCommand::GetIntegerParameter(id);
+}
+
+
+//---------------------------------------------------------------------------
+// Integer GetIntegerParameter(const std::string &label) const
+//---------------------------------------------------------------------------
+Integer PropagateEnsemble::GetIntegerParameter(const std::string &label) const
+{
+   return GetIntegerParameter(GetParameterID(label));
+}
+
+
+//---------------------------------------------------------------------------
+// Integer SetIntegerParameter(const Integer id, const Integer value)
+//---------------------------------------------------------------------------
+Integer PropagateEnsemble::SetIntegerParameter(const Integer id,
+                                               const Integer value)
+{
+   switch (id)
+   {
+      case MEMBERS:
+         if (value < 1)
+            throw CommandException("The PropagateEnsemble Members value "
+                  "must be a positive integer");
+         memberCount = value;
+         return memberCount;
+
+      case SEED:
+         seed = value;
+         return seed;
+
+      case THREAD_COUNT:
+         if (value < 0)
+            throw CommandException("The PropagateEnsemble ThreadCount value "
+                  "must be 0 (all hardware threads) or a positive integer");
+         threadCount = value;
+         return threadCount;
+
+      case BATCH_SIZE:
+         if (value < 1)
+            throw CommandException("The PropagateEnsemble BatchSize value "
+                  "must be a positive integer");
+         batchSize = value;
+         return batchSize;
+
+      default:
+         break;
+   }
+
+   return GmatCommand::SetIntegerParameter(id, value);
+}
+
+
+//---------------------------------------------------------------------------
+// Integer SetIntegerParameter(const std::string &label, const Integer value)
+//---------------------------------------------------------------------------
+Integer PropagateEnsemble::SetIntegerParameter(const std::string &label,
+                                               const Integer value)
+{
+   return SetIntegerParameter(GetParameterID(label), value);
+}
+
+
+//---------------------------------------------------------------------------
+// Real GetRealParameter(const Integer id) const
+//---------------------------------------------------------------------------
+Real PropagateEnsemble::GetRealParameter(const Integer id) const
+{
+   switch (id)
+   {
+      case DURATION:
+         return duration;
+      case POSITION_SIGMA:
+         return positionSigma;
+      case VELOCITY_SIGMA:
+         return velocitySigma;
+      default:
+         break;
+   }
+
+   return GmatCommand::GetRealParameter(id);
+}
+
+
+//---------------------------------------------------------------------------
+// Real GetRealParameter(const std::string &label) const
+//---------------------------------------------------------------------------
+Real PropagateEnsemble::GetRealParameter(const std::string &label) const
+{
+   return GetRealParameter(GetParameterID(label));
+}
+
+
+//---------------------------------------------------------------------------
+// Real SetRealParameter(const Integer id, const Real value)
+//---------------------------------------------------------------------------
+Real PropagateEnsemble::SetRealParameter(const Integer id, const Real value)
+{
+   switch (id)
+   {
+      case DURATION:
+         duration = value;
+         return duration;
+
+      case POSITION_SIGMA:
+      case VELOCITY_SIGMA:
+         if (value < 0.0)
+            throw CommandException("The PropagateEnsemble " +
+                  GetParameterText(id) + " value must not be negative");
+         if (id == POSITION_SIGMA)
+            positionSigma = value;
+         else
+            velocitySigma = value;
+         return value;
+
+      default:
+         break;
+   }
+
+   return GmatCommand::SetRealParameter(id, value);
+}
+
+
+//---------------------------------------------------------------------------
+// Real SetRealParameter(const std::string &label, const Real value)
+//---------------------------------------------------------------------------
+Real PropagateEnsemble::SetRealParameter(const std::string &label,
+                                         const Real value)
+{
+   return SetRealParameter(GetParameterID(label), value);
+}
+
+
+//------------------------------------------------------------------------------
+// const ObjectTypeArray& GetRefObjectTypeArray()
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the list of ref object types used by the command.
+ *
+ * @return the list of object types.
+ */
+//------------------------------------------------------------------------------
+const ObjectTypeArray& PropagateEnsemble::GetRefObjectTypeArray()
+{
+   refObjectTypes.clear();
+   refObjectTypes.push_back(Gmat::PROP_SETUP);
+   refObjectTypes.push_back(Gmat::SPACECRAFT);
+   return refObjectTypes;
+}
+
+
+//------------------------------------------------------------------------------
+// const StringArray& GetRefObjectNameArray(const UnsignedInt type)
+//------------------------------------------------------------------------------
+/**
+ * Accesses arrays of names for referenced objects.
+ *
+ * @param type Type of object requested.
+ *
+ * @return the StringArray containing the referenced object names.
+ */
+//------------------------------------------------------------------------------
+const StringArray& PropagateEnsemble::GetRefObjectNameArray(
+      const UnsignedInt type)
+{
+   refObjectNames.clear();
+
+   if ((type == Gmat::UNKNOWN_OBJECT) || (type == Gmat::PROP_SETUP))
+      refObjectNames.push_back(propName);
+   if ((type == Gmat::UNKNOWN_OBJECT) || (type == Gmat::SPACECRAFT))
+      refObjectNames.push_back(satName);
+
+   return refObjectNames;
+}
+
+
+//------------------------------------------------------------------------------
+//  bool RenameRefObject(const UnsignedInt type,
+//                       const std::string &oldName, const std::string &newName)
+//------------------------------------------------------------------------------
+/**
+ * Renames referenced objects.
+ *
+ * @param type Type of the object that is renamed.
+ * @param oldName The current name for the object.
+ * @param newName The name the object has when this operation is complete.
+ *
+ * @return true on success.
+ */
+//------------------------------------------------------------------------------
+bool PropagateEnsemble::RenameRefObject(const UnsignedInt type,
+                                        const std::string &oldName,
+                                        const std::string &newName)
+{
+   if ((type == Gmat::PROP_SETUP) && (propName == oldName))
+      propName = newName;
+   if ((type == Gmat::SPACECRAFT) && (satName == oldName))
+      satName = newName;
+
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+//  GmatBase* Clone() const
+//------------------------------------------------------------------------------
+/**
+ * This method returns a clone of the PropagateEnsemble command.
+ *
+ * @return clone of the command.
+ */
+//------------------------------------------------------------------------------
+GmatBase* PropagateEnsemble::Clone() const
+{
+   return new PropagateEnsemble(*this);
+}
+
+
+//------------------------------------------------------------------------------
+//  const std::string GetGeneratingString()
+//------------------------------------------------------------------------------
+/**
+ * Method used to retrieve the string that was parsed to build this GmatCommand.
+ *
+ * @param mode    Specifies the type of serialization requested.
+ * @param prefix  Optional prefix appended to the object's name. (Used for
+ *                indentation)
+ * @param useName Name that replaces the object's name (Not yet used
+ *                in commands).
+ *
+ * @return The script line that defines this GmatCommand.
+ */
+//------------------------------------------------------------------------------
+const std::string& PropagateEnsemble::GetGeneratingString(Gmat::WriteMode mode,
+      const std::string &prefix, const std::string &useName)
+{
+   std::stringstream gen;
+   gen.precision(16);
+   gen << prefix << "PropagateEnsemble " << propName << "(" << satName
+       << ") {Members = " << memberCount << ", Duration = " << duration
+       << ", PositionSigma = " << positionSigma << ", VelocitySigma = "
+       << velocitySigma << ", Seed = " << seed << ", ThreadCount = "
+       << threadCount << ", BatchSize = " << batchSize << "};";
+   generatingString = gen.str();
+
+   return GmatCommand::GetGeneratingString(mode, prefix, useName);
+}
+
+
+//------------------------------------------------------------------------------
+// bool InterpretAction()
+//------------------------------------------------------------------------------
+/**
+ * Parses the command string and builds the corresponding command structures.
+ *
+ * The PropagateEnsemble command has the following syntax:
+ *
+ *     PropagateEnsemble Prop(Sat) {Members = 1000, Duration = 86400, ...};
+ *
+ * where Prop is a PropSetup that uses an ODE model and Sat is the spacecraft
+ * that supplies the nominal state.  The options are all optional.
+ *
+ * @return true on successful parsing of the command.
+ */
+//------------------------------------------------------------------------------
+bool PropagateEnsemble::InterpretAction()
+{
+   StringArray blocks = parser.DecomposeBlock(generatingString);
+   StringArray chunks = parser.SeparateBrackets(blocks[0], "{}", " ", false);
+
+   #ifdef DEBUG_PROPAGATE_ENSEMBLE
+      MessageInterface::ShowMessage("Chunks from \"%s\":\n",
+            blocks[0].c_str());
+      for (StringArray::iterator i = chunks.begin(); i != chunks.end(); ++i)
+         MessageInterface::ShowMessage("   \"%s\"\n", i->c_str());
+   #endif
+
+   if ((chunks.size() < 2) || (chunks.size() > 3) || (chunks[0] != typeName))
+      throw CommandException(typeName + " command is malformed; expecting "
+            "\"PropagateEnsemble PropSetupName(SpacecraftName) "
+            "{options}\" in line\n" + generatingString);
+
+   StringArray propChunks = parser.Decompose(chunks[1], "()", false);
+   if (propChunks.size() < 2)
+      throw CommandException(typeName + " is missing the spacecraft; "
+            "expecting \"PropSetupName(SpacecraftName)\" in line\n" +
+            generatingString);
+   propName = propChunks[0];
+
+   StringArray satChunks = parser.SeparateBrackets(propChunks[1], "()", ",");
+   if (satChunks.size() != 1)
+      throw CommandException(typeName + " propagates exactly one spacecraft "
+            "in line\n" + generatingString);
+   satName = satChunks[0];
+
+   if (chunks.size() == 3)
+      CheckForOptions(chunks[2]);
+
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+//  bool Initialize()
+//------------------------------------------------------------------------------
+/**
+ * Looks up the PropSetup and spacecraft at the start of a run.
+ *
+ * @return true if the GmatCommand is initialized, false if an error occurs.
+ */
+//------------------------------------------------------------------------------
+bool PropagateEnsemble::Initialize()
+{
+   bool retval = GmatCommand::Initialize();
+
+   if (retval)
+   {
+      GmatBase *mapObj = FindObject(propName);
+      if ((mapObj == NULL) || !mapObj->IsOfType(Gmat::PROP_SETUP))
+         throw CommandException(typeName + ": \"" + propName +
+               "\" is not a Propagator");
+      prop = (PropSetup*)mapObj;
+      if (prop->GetODEModel() == NULL)
+         throw CommandException(typeName + ": the Propagator \"" + propName +
+               "\" does not use a force model; ensembles need an integrator");
+
+      mapObj = FindObject(satName);
+      if ((mapObj == NULL) || !mapObj->IsOfType(Gmat::SPACECRAFT))
+         throw CommandException(typeName + ": \"" + satName +
+               "\" is not a Spacecraft");
+      sat = (Spacecraft*)mapObj;
+
+      if (solarSys == NULL)
+         throw CommandException(typeName + ": the solar system is not set");
+
+      ClearWorkers();
+      serialWarningShown = false;
+   }
+
+   isInitialized = retval;
+   return isInitialized;
+}
+
+
+//------------------------------------------------------------------------------
+// bool Execute()
+//------------------------------------------------------------------------------
+/**
+ * Disperses the spacecraft state and propagates every member.
+ *
+ * Batches of members are handed to a WorkerPool; each worker propagates its
+ * batches with its own objects.  Several threads are used only when every
+ * force in the worker's ODE model supports concurrent copies and no body is
+ * read through SPICE; otherwise the members run on one thread.  A member
+ * whose propagation throws is marked FAILED and the others continue.
+ *
+ * @return true if the GmatCommand runs to completion
+ */
+//------------------------------------------------------------------------------
+bool PropagateEnsemble::Execute()
+{
+   Real sigma[6] = { positionSigma, positionSigma, positionSigma,
+                     velocitySigma, velocitySigma, velocitySigma };
+   ensemble.SetSize(memberCount);
+   ensemble.Disperse(sat->GetEpoch(), sat->GetState().GetState(), sigma,
+                     (UnsignedInt)seed);
+
+   Integer batchCount = (memberCount + batchSize - 1) / batchSize;
+
+   // Worker objects are cloned serially; cloning the solar system opens
+   // ephemeris sources that are not safe to open concurrently.  The first
+   // worker's initialized ODE model tells whether more threads may be used.
+   if (workers.empty())
+   {
+      workers.resize(1);
+      BuildWorker(workers[0]);
+   }
+
+   Integer threads = threadCount;
+   if ((threads != 1) && !CanRunConcurrently())
+   {
+      if (!serialWarningShown)
+      {
+         MessageInterface::ShowMessage("*** WARNING *** PropagateEnsemble "
+               "propagates the members of %s on one thread: the Propagator "
+               "%s uses models that cannot run on several threads at once, "
+               "such as MSISE90 or Jacchia-Roberts drag, or SPICE "
+               "ephemerides\n", satName.c_str(), propName.c_str());
+         serialWarningShown = true;
+      }
+      threads = 1;
+   }
+
+   WorkerPool pool(threads);
+   while ((Integer)workers.size() < pool.GetThreadCount())
+   {
+      workers.push_back(EnsembleWorker());
+      BuildWorker(workers.back());
+   }
+   RefreshWorkers();
+
+   StringArray errors(batchCount);
+   pool.Run(batchCount, [&](Integer task, Integer worker)
+   {
+      Integer first = task * batchSize;
+      Integer count = (memberCount - first < batchSize ?
+                       memberCount - first : batchSize);
+      try
+      {
+         PropagateBatch(workers[worker], first, count);
+      }
+      catch (BaseException &be)
+      {
+         for (Integer m = first; m < first + count; ++m)
+            ensemble.SetResult(m, EnsembleState::FAILED);
+         errors[task] = be.GetFullMessage();
+      }
+   });
+
+   Integer failed = ensemble.GetStatusCount(EnsembleState::FAILED);
+   if (failed > 0)
+   {
+      for (UnsignedInt i = 0; i < errors.size(); ++i)
+      {
+         if (errors[i] != "")
+         {
+            MessageInterface::ShowMessage("*** WARNING *** %d of %d "
+                  "PropagateEnsemble members failed; the first failure "
+                  "was:\n%s\n", failed, memberCount, errors[i].c_str());
+            break;
+         }
+      }
+   }
+
+   #ifdef DEBUG_PROPAGATE_ENSEMBLE
+      MessageInterface::ShowMessage("PropagateEnsemble: %d members, %d "
+            "batches on %d threads, %d failed\n", memberCount, batchCount,
+            pool.GetThreadCount(), failed);
+   #endif
+
+   PublishEnsemble();
+   BuildCommandSummary(true);
+
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// void RunComplete()
+//------------------------------------------------------------------------------
+/**
+ * Releases the worker objects at the end of a run.
+ */
+//------------------------------------------------------------------------------
+void PropagateEnsemble::RunComplete()
+{
+   ClearWorkers();
+   GmatCommand::RunComplete();
+}
+
+
+//------------------------------------------------------------------------------
+// const EnsembleState& GetEnsemble() const
+//------------------------------------------------------------------------------
+/**
+ * @return The member states from the last execution
+ */
+//------------------------------------------------------------------------------
+const EnsembleState& PropagateEnsemble::GetEnsemble() const
+{
+   return ensemble;
+}
+
+
+//------------------------------------------------------------------------------
+// protected methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// void CheckForOptions(std::string &opts)
+//------------------------------------------------------------------------------
+/**
+ * Parses the {Option = value, ...} block of the command
+ *
+ * @param opts The option block
+ */
+//------------------------------------------------------------------------------
+void PropagateEnsemble::CheckForOptions(std::string &opts)
+{
+   StringArray chunks = parser.SeparateBrackets(opts, "{}", ", ", true);
+
+   for (StringArray::iterator i = chunks.begin(); i != chunks.end(); ++i)
+   {
+      StringArray option = parser.SeparateBy(*i, "= ");
+
+      if (option.size() != 2)
+         throw CommandException(typeName + " option is not in the form "
+               "option = value in line\n" + generatingString);
+
+      Integer id = -1;
+      for (Integer j = MEMBERS; j < PropagateEnsembleParamCount; ++j)
+         if (PARAMETER_TEXT[j - GmatCommandParamCount] == option[0])
+            id = j;
+
+      if (id == -1)
+         throw CommandException(typeName + " option " + option[0] +
+               " is not a recognized option on line\n" + generatingString +
+               "\nAllowed options are Members, Duration, PositionSigma, "
+               "VelocitySigma, Seed, ThreadCount and BatchSize\n");
+
+      if (PARAMETER_TYPE[id - GmatCommandParamCount] == Gmat::INTEGER_TYPE)
+      {
+         Integer value;
+         if (!GmatStringUtil::ToInteger(option[1], value))
+            throw CommandException(typeName + " option " + option[0] +
+                  " requires an integer value on line\n" + generatingString);
+         SetIntegerParameter(id, value);
+      }
+      else
+      {
+         Real value;
+         if (!GmatStringUtil::ToReal(option[1], value))
+            throw CommandException(typeName + " option " + option[0] +
+                  " requires a real value on line\n" + generatingString);
+         SetRealParameter(id, value);
+      }
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void BuildWorker(EnsembleWorker &worker)
+//------------------------------------------------------------------------------
+/**
+ * Clones the propagation objects used by one worker thread and assembles the
+ * ODE model for BatchSize spacecraft.
+ *
+ * @param worker The worker that receives the objects
+ */
+//------------------------------------------------------------------------------
+void PropagateEnsemble::BuildWorker(EnsembleWorker &worker)
+{
+   worker.solarSystem = (SolarSystem*)solarSys->Clone();
+   worker.propSetup = (PropSetup*)prop->Clone();
+   worker.propSetup->TakeAction("PrepareForRun");
+
+   for (Integer i = 0; i < batchSize; ++i)
+   {
+      Spacecraft *member = (Spacecraft*)sat->Clone();
+      member->SetName(satName + "_Member" + GmatStringUtil::ToString(i, 1));
+      worker.sats.push_back(member);
+      worker.satObjects.push_back(member);
+   }
+
+   Propagator *p = worker.propSetup->GetPropagator();
+   ODEModel *ode = worker.propSetup->GetODEModel();
+   PropagationStateManager *psm = worker.propSetup->GetPropStateManager();
+
+   Real initialStep = fabs(p->GetRealParameter("InitialStepSize"));
+   p->SetRealParameter("InitialStepSize",
+         (duration < 0.0 ? -initialStep : initialStep));
+
+   for (UnsignedInt i = 0; i < worker.sats.size(); ++i)
+      psm->SetObject(worker.sats[i]);
+   if (!psm->BuildState() || !psm->MapObjectsToVector())
+      throw CommandException(typeName + ": could not build the ensemble "
+            "state for " + satName);
+
+   ode->SetState(psm->GetState());
+   ode->SetSolarSystem(worker.solarSystem);
+   p->SetPhysicalModel(ode);
+   p->Initialize();
+   if (ode->SetupSpacecraftData(&worker.satObjects, 0) <= 0)
+      throw PropagatorException(typeName + ": the ODE model cannot set "
+            "spacecraft parameters");
+
+   ode->SetPropStateManager(psm);
+   if (!ode->BuildModelFromMap())
+      throw CommandException(typeName + ": unable to assemble the ODE "
+            "model for " + propName);
+}
+
+
+//------------------------------------------------------------------------------
+// void ClearWorkers()
+//------------------------------------------------------------------------------
+/**
+ * Deletes the worker objects
+ */
+//------------------------------------------------------------------------------
+void PropagateEnsemble::ClearWorkers()
+{
+   for (UnsignedInt i = 0; i < workers.size(); ++i)
+   {
+      // The PropSetup references the spacecraft and solar system, so it goes
+      // first
+      delete workers[i].propSetup;
+      for (UnsignedInt j = 0; j < workers[i].sats.size(); ++j)
+         delete workers[i].sats[j];
+      delete workers[i].solarSystem;
+   }
+   workers.clear();
+}
+
+
+//------------------------------------------------------------------------------
+// bool CanRunConcurrently()
+//------------------------------------------------------------------------------
+/**
+ * Checks whether the workers may propagate at the same time.
+ *
+ * Separate clones are not enough on their own: some force models call code
+ * with process-wide state, such as the f2c MSISE90 model or CSPICE.
+ *
+ * @return true if every force of the first worker's ODE model supports
+ *         concurrent copies and no body in use is read through SPICE
+ */
+//------------------------------------------------------------------------------
+bool PropagateEnsemble::CanRunConcurrently()
+{
+   EnsembleWorker &worker = workers[0];
+   if (!worker.propSetup->GetODEModel()->SupportsConcurrentCopies())
+      return false;
+
+   const StringArray &bodies = worker.solarSystem->GetBodiesInUse();
+   for (UnsignedInt i = 0; i < bodies.size(); ++i)
+   {
+      CelestialBody *body = worker.solarSystem->GetBody(bodies[i]);
+      if ((body != NULL) && (body->GetPosVelSource() == Gmat::SPICE))
+         return false;
+   }
+
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// void RefreshWorkers()
+//------------------------------------------------------------------------------
+/**
+ * Copies the scripted spacecraft into every worker spacecraft, so that
+ * changes made since the workers were built (mass, drag and SRP
+ * coefficients, areas, attached hardware) are used.  The member epochs and
+ * states are set later, batch by batch.
+ */
+//------------------------------------------------------------------------------
+void PropagateEnsemble::RefreshWorkers()
+{
+   for (UnsignedInt i = 0; i < workers.size(); ++i)
+      for (UnsignedInt j = 0; j < workers[i].sats.size(); ++j)
+         workers[i].sats[j]->Copy(sat);
+}
+
+
+//------------------------------------------------------------------------------
+// void PropagateBatch(EnsembleWorker &worker, Integer firstMember,
+//                     Integer count)
+//------------------------------------------------------------------------------
+/**
+ * Propagates a batch of members for the full duration.
+ *
+ * The integrator takes its own adaptive steps until the next planned step
+ * would pass the end of the span, then steps exactly to the end.  A batch
+ * smaller than BatchSize is padded with copies of its last member, whose
+ * results are discarded.
+ *
+ * @param worker      The worker whose objects are used
+ * @param firstMember Index of the first member in the batch
+ * @param count       Number of members in the batch
+ */
+//------------------------------------------------------------------------------
+void PropagateEnsemble::PropagateBatch(EnsembleWorker &worker,
+                                       Integer firstMember, Integer count)
+{
+   Propagator *p = worker.propSetup->GetPropagator();
+   ODEModel *ode = worker.propSetup->GetODEModel();
+
+   GmatEpoch startEpoch = ensemble.GetEpoch(firstMember);
+   Real state[6];
+   for (UnsignedInt i = 0; i < worker.sats.size(); ++i)
+   {
+      Integer member = firstMember + ((Integer)i < count ? i : count - 1);
+      ensemble.GetMember(member, state);
+      worker.sats[i]->SetEpochGT(GmatTime(startEpoch));
+      worker.sats[i]->SetState(Rvector6(state));
+   }
+
+   ode->SetTime(0.0);
+   ode->UpdateInitialData();
+   p->ResetInitialData();
+   p->Initialize();
+   p->Update(duration >= 0.0);
+
+   Integer steps = 0;
+   Real lastStep = 0.0;
+   Real remaining = duration;
+   while (remaining != 0.0)
+   {
+      Real before = ode->GetTime();
+      bool finalStep = (fabs(p->GetStepSize()) >= fabs(remaining));
+
+      ode->BufferState();
+      if (!(finalStep ? p->Step(remaining) : p->Step()))
+         throw PropagatorException(typeName + ": the propagator failed to "
+               "take a step for member " +
+               GmatStringUtil::ToString(firstMember, 1));
+
+      Real taken = ode->GetTime() - before;
+      if ((taken == 0.0) && !finalStep)
+         throw PropagatorException(typeName + ": the propagator stalled for "
+               "member " + GmatStringUtil::ToString(firstMember, 1));
+
+      ++steps;
+      lastStep = taken;
+      remaining = (finalStep ? 0.0 : duration - ode->GetTime());
+   }
+
+   GmatEpoch endEpoch = startEpoch + duration / GmatTimeConstants::SECS_PER_DAY;
+   if (ode->HasPrecisionTime())
+   {
+      GmatTime endEpochGT(startEpoch);
+      endEpochGT.AddSeconds(duration);
+      ode->UpdateSpaceObjectGT(endEpochGT);
+   }
+   else
+      ode->UpdateSpaceObject(endEpoch);
+
+   for (Integer i = 0; i < count; ++i)
+   {
+      ensemble.SetMember(firstMember + i, worker.sats[i]->GetState().GetState());
+      ensemble.SetEpoch(firstMember + i, endEpoch);
+      ensemble.SetResult(firstMember + i, EnsembleState::PROPAGATED, steps,
+                         lastStep);
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void PublishEnsemble()
+//------------------------------------------------------------------------------
+/**
+ * Sends one record per member to the Publisher: epoch, member index, the
+ * Cartesian state, the step count and the MemberStatus.
+ */
+//------------------------------------------------------------------------------
+void PropagateEnsemble::PublishEnsemble()
+{
+   if (publisher == NULL)
+      return;
+
+   static const char *LABELS[] = { ".EnsembleMember", ".X", ".Y", ".Z",
+                                   ".VX", ".VY", ".VZ", ".Steps", ".Status" };
+   StringArray owners, elements;
+   owners.push_back("All");
+   elements.push_back("All.epoch");
+   for (Integer i = 0; i < 9; ++i)
+   {
+      owners.push_back(satName);
+      elements.push_back(satName + LABELS[i]);
+   }
+   streamID = publisher->RegisterPublishedData(this, streamID, owners,
+                                               elements);
+
+   Real data[10];
+   Real direction = (duration < 0.0 ? -1.0 : 1.0);
+   for (Integer m = 0; m < memberCount; ++m)
+   {
+      data[0] = ensemble.GetEpoch(m);
+      data[1] = m;
+      ensemble.GetMember(m, &data[2]);
+      data[8] = ensemble.GetStepCount(m);
+      data[9] = ensemble.GetStatus(m);
+      publisher->Publish(this, streamID, data, 10, direction);
+   }
+}
@@ -0,0 +1,183 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                            PropagateEnsemble
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/16
+//
+/**
+ * Definition for the PropagateEnsemble command, which propagates a set of
+ * dispersed copies of a spacecraft for Monte Carlo studies.
+ *
+ * Script syntax:
+ *
+ *    PropagateEnsemble Prop(Sat) {Members = 1000, Duration = 86400,
+ *       PositionSigma = 0.1, VelocitySigma = 1e-4, Seed = 1,
+ *       ThreadCount = 0, BatchSize = 1}
+ *
+ * The member states live in an EnsembleState.  Each worker thread owns
+ * clones of the solar system, the PropSetup and the spacecraft, so members
+ * are propagated independently, each with its own step size control.  The
+ * worker spacecraft are refreshed from the scripted spacecraft on every
+ * execution.  ThreadCount is honored only when the force model can run on
+ * several threads at once; otherwise the members run on one thread.  With
+ * BatchSize > 1 a worker loads that many members into one ODEModel state and
+ * integrates them together, so each force evaluation covers the whole batch
+ * and the batch shares one step sequence.  The final state of every member is
+ * published when the run finishes; the scripted spacecraft is not changed.
+ */
+//------------------------------------------------------------------------------
+#ifndef PropagateEnsemble_hpp
+#define PropagateEnsemble_hpp
+
+#include "GmatCommand.hpp"
+#include "EnsembleState.hpp"
+#include "PropSetup.hpp"
+#include "Spacecraft.hpp"
+
+class GMAT_API PropagateEnsemble : public GmatCommand
+{
+public:
+   PropagateEnsemble();
+   virtual ~PropagateEnsemble();
+   PropagateEnsemble(const PropagateEnsemble& pe);
+   PropagateEnsemble&   operator=(const PropagateEnsemble& pe);
+
+   // Parameter accessors
+   virtual std::string  GetParameterText(const Integer id) const;
+   virtual Integer      GetParameterID(const std::string &str) const;
+   virtual Gmat::ParameterType
+                        GetParameterType(const Integer id) const;
+   virtual std::string  GetParameterTypeString(const Integer id) const;
+
+   virtual std::string  GetStringParameter(const Integer id) const;
+   virtual std::string  GetStringParameter(const std::string &label) const;
+   virtual bool         SetStringParameter(const Integer id,
+                                           const std::string &value);
+   virtual bool         SetStringParameter(const std::string &label,
+                                           const std::string &value);
+   virtual Integer      GetIntegerParameter(const Integer id) const;
+   virtual Integer      GetIntegerParameter(const std::string &label) const;
+   virtual Integer      SetIntegerParameter(const Integer id,
+                                            const Integer value);
+   virtual Integer      SetIntegerParameter(const std::string &label,
+                                            const Integer value);
+   virtual Real         GetRealParameter(const Integer id) const;
+   virtual Real         GetRealParameter(const std::string &label) const;
+   virtual Real         SetRealParameter(const Integer id,
+                                         const Real value);
+   virtual Real         SetRealParameter(const std::string &label,
+                                         const Real value);
+
+   virtual const ObjectTypeArray&
+                        GetRefObjectTypeArray();
+   virtual const StringArray&
+                        GetRefObjectNameArray(const UnsignedInt type);
+   virtual bool         RenameRefObject(const UnsignedInt type,
+                                        const std::string &oldName,
+                                        const std::string &newName);
+
+   virtual GmatBase*    Clone() const;
+   virtual const std::string&
+                        GetGeneratingString(
+                                        Gmat::WriteMode mode = Gmat::SCRIPTING,
+                                        const std::string &prefix = "",
+                                        const std::string &useName = "");
+
+   virtual bool         InterpretAction();
+   virtual bool         Initialize();
+   virtual bool         Execute();
+   virtual void         RunComplete();
+
+   const EnsembleState& GetEnsemble() const;
+
+   DEFAULT_TO_NO_CLONES
+
+protected:
+   // Parameter IDs
+   enum
+   {
+      PROPAGATOR = GmatCommandParamCount,
+      SPACECRAFT,
+      MEMBERS,
+      DURATION,
+      POSITION_SIGMA,
+      VELOCITY_SIGMA,
+      SEED,
+      THREAD_COUNT,
+      BATCH_SIZE,
+      PropagateEnsembleParamCount
+   };
+
+   static const std::string    PARAMETER_TEXT[PropagateEnsembleParamCount -
+                                              GmatCommandParamCount];
+   static const Gmat::ParameterType
+                               PARAMETER_TYPE[PropagateEnsembleParamCount -
+                                              GmatCommandParamCount];
+
+   /// The propagation objects owned by one worker thread
+   struct EnsembleWorker
+   {
+      SolarSystem             *solarSystem;
+      PropSetup               *propSetup;
+      std::vector<Spacecraft*> sats;
+      ObjectArray             satObjects;
+   };
+
+   /// Name of the PropSetup used
+   std::string                   propName;
+   /// Name of the dispersed spacecraft
+   std::string                   satName;
+   /// Number of ensemble members
+   Integer                       memberCount;
+   /// Propagation span, in seconds; negative values propagate backwards
+   Real                          duration;
+   /// 1-sigma position dispersion, in km
+   Real                          positionSigma;
+   /// 1-sigma velocity dispersion, in km/s
+   Real                          velocitySigma;
+   /// Random number seed for the dispersions
+   Integer                       seed;
+   /// Number of worker threads; 0 uses all hardware threads
+   Integer                       threadCount;
+   /// Number of members integrated together in one ODEModel state
+   Integer                       batchSize;
+
+   /// The PropSetup from the object map
+   PropSetup                     *prop;
+   /// The spacecraft from the object map
+   Spacecraft                    *sat;
+   /// The member states
+   EnsembleState                 ensemble;
+   /// Per-thread propagation objects, built for the first execution of a run
+   std::vector<EnsembleWorker>   workers;
+   /// Set once the fall back to one thread has been reported in this run
+   bool                          serialWarningShown;
+
+   void                 CheckForOptions(std::string &opts);
+   void                 BuildWorker(EnsembleWorker &worker);
+   void                 ClearWorkers();
+   bool                 CanRunConcurrently();
+   void                 RefreshWorkers();
+   void                 PropagateBatch(EnsembleWorker &worker,
+                                       Integer firstMember, Integer count);
+   void                 PublishEnsemble();
+};
+
+#endif // PropagateEnsemble_hpp
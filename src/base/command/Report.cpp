@@ -31,6 +31,7 @@
 
 
 #include "Report.hpp"
+#include "ParameterIndex.hpp"
 #include "MessageInterface.hpp"
 #include "StringUtil.hpp"       // for GetArrayIndex()
 #include <sstream>
@@ -170,11 +171,11 @@ Report& Report::operator=(const Report &rep)
 //------------------------------------------------------------------------------
 Integer Report::GetParameterID(const std::string &str) const
 {
-   for (Integer i = GmatCommandParamCount; i < ReportParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatCommandParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("Report", PARAMETER_TEXT,
+         GmatCommandParamCount, ReportParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
    
    return GmatCommand::GetParameterID(str);
 }
@@ -30,6 +30,7 @@
 //------------------------------------------------------------------------------
 
 #include "SaveMission.hpp"
+#include "ParameterIndex.hpp"
 #include "CommandUtil.hpp"         // for GetLastCommand()
 #include "FileManager.hpp"         // for GetPathname()
 #include "FileUtil.hpp"            // for ParseFileExtension()
@@ -263,11 +264,11 @@ std::string SaveMission::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer SaveMission::GetParameterID(const std::string &str) const
 {
-   for (int i=GmatCommandParamCount; i<SaveMissionParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatCommandParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("SaveMission", PARAMETER_TEXT,
+         GmatCommandParamCount, SaveMissionParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
    
    return GmatCommand::GetParameterID(str);
 }
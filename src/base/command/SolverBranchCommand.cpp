@@ -42,9 +42,18 @@
 
 #include <sstream>                 // for <<
 
+#ifndef _WIN32
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <unistd.h>
+#include <sys/wait.h>
+#endif
+
 //#define DEBUG_PARSING
 //#define DEBUG_OPTIONS
 //#define DEBUG_SOLVERBRANCHCOMMAND_INIT
+//#define DEBUG_PERTURBATION_PASSES
 //#ifndef DEBUG_MEMORY
 //#define DEBUG_MEMORY
 //#endif
@@ -1145,6 +1154,232 @@ void SolverBranchCommand::ApplySolution()
 }
 
 
+//------------------------------------------------------------------------------
+// bool RunPerturbationPasses()
+//------------------------------------------------------------------------------
+/**
+ * Runs the perturbation passes of a solver iteration concurrently.
+ *
+ * Each pass runs the solver control sequence in a child process forked from
+ * this one, so every pass works on its own copy of the objects in the loop
+ * (and of the Publisher, the SolarSystem and the SPICE kernel pool, none of
+ * which can be shared between threads).  Up to the solver's
+ * PerturbationWorkers passes run at once.  The children send back the
+ * results they report to the solver; once all passes are in, the results
+ * are passed to the solver in pass order, exactly as a serial run would.
+ *
+ * The children do not publish data, so perturbation passes are not drawn or
+ * reported when they run this way.
+ *
+ * @return true if the passes were run; false if the caller should run them
+ *         serially
+ */
+//------------------------------------------------------------------------------
+bool SolverBranchCommand::RunPerturbationPasses()
+{
+   #ifdef _WIN32
+      return false;
+   #else
+   Integer workers = theSolver->GetPerturbationWorkerCount();
+   Integer passCount = theSolver->GetPerturbationPassCount();
+   if ((workers < 2) || (passCount < 2))
+      return false;
+
+   #ifdef DEBUG_PERTURBATION_PASSES
+      MessageInterface::ShowMessage("%s running %d perturbation passes with "
+            "%d workers\n", typeName.c_str(), passCount, workers);
+   #endif
+
+   std::vector<std::vector<Solver::RecordedResult> > results(passCount);
+   bool succeeded = true;
+
+   for (Integer first = 0; (first < passCount) && succeeded; first += workers)
+   {
+      Integer last = (first + workers < passCount ? first + workers :
+            passCount);
+      std::vector<pid_t> children;
+      std::vector<int>   pipes;
+
+      for (Integer pass = first; pass < last; ++pass)
+      {
+         int fd[2];
+         theSolver->SetPerturbationPass(pass);
+         ResetLoopData();
+
+         // Don't let the child inherit unwritten output
+         fflush(NULL);
+
+         if (pipe(fd) != 0)
+         {
+            succeeded = false;
+            break;
+         }
+
+         pid_t pid = fork();
+         if (pid == 0)
+         {
+            close(fd[0]);
+            _exit(RunPerturbationPass(fd[1]));
+         }
+
+         close(fd[1]);
+         if (pid < 0)
+         {
+            close(fd[0]);
+            succeeded = false;
+            break;
+         }
+         children.push_back(pid);
+         pipes.push_back(fd[0]);
+      }
+
+      // The results are small, so the pipes are drained in order
+      for (UnsignedInt i = 0; i < children.size(); ++i)
+      {
+         char buffer[4096];
+         ssize_t count;
+         std::string data;
+         while ((count = read(pipes[i], buffer, sizeof(buffer))) != 0)
+         {
+            if (count < 0)
+            {
+               if (errno == EINTR)
+                  continue;
+               break;
+            }
+            data.append(buffer, count);
+         }
+         close(pipes[i]);
+
+         int waitStatus = 0;
+         while ((waitpid(children[i], &waitStatus, 0) < 0) && (errno == EINTR))
+            ;
+         if (!WIFEXITED(waitStatus) || (WEXITSTATUS(waitStatus) != 0))
+            succeeded = false;
+
+         // Each line is "id value type"; anything unreadable fails the set
+         std::istringstream lines(data);
+         Solver::RecordedResult result;
+         while (lines >> result.id >> result.value >> result.type)
+         {
+            if (result.type == "-")
+               result.type = "";
+            results[first + i].push_back(result);
+         }
+         if (!lines.eof())
+            succeeded = false;
+      }
+   }
+
+   if (!succeeded)
+   {
+      MessageInterface::ShowMessage("*** WARNING *** The perturbation passes "
+            "for %s \"%s\" could not be run concurrently; running them "
+            "serially\n", typeName.c_str(), solverName.c_str());
+      theSolver->SetPerturbationPass(0);
+      return false;
+   }
+
+   // Hand the results to the solver as if the passes had run in order
+   for (Integer pass = 0; pass < passCount; ++pass)
+   {
+      theSolver->SetPerturbationPass(pass);
+      for (UnsignedInt i = 0; i < results[pass].size(); ++i)
+         theSolver->SetResultValue(results[pass][i].id,
+               results[pass][i].value, results[pass][i].type);
+   }
+   theSolver->CompletePerturbationPasses();
+   ResetLoopData();
+
+   return true;
+   #endif
+}
+
+
+//------------------------------------------------------------------------------
+// int RunPerturbationPass(int output)
+//------------------------------------------------------------------------------
+/**
+ * Runs one perturbation pass in a child process.
+ *
+ * The solver records the results reported by the commands in the loop, and
+ * they are written to the output descriptor as "id value type" lines.
+ *
+ * @param output The write end of the pipe back to the parent
+ *
+ * @return The exit status for the child: 0 on success
+ */
+//------------------------------------------------------------------------------
+int SolverBranchCommand::RunPerturbationPass(int output)
+{
+   #ifdef _WIN32
+      return 1;
+   #else
+   int retval = 1;
+
+   try
+   {
+      // Nothing from the child reaches the plots, reports or solver window
+      ClearListeners();
+      const std::list<Subscriber*> subscribers = publisher->GetSubscriberList();
+      for (std::list<Subscriber*>::const_iterator i = subscribers.begin();
+           i != subscribers.end(); ++i)
+         publisher->Unsubscribe(*i);
+
+      theSolver->RecordResults(true);
+      branchExecuting = true;
+      bool ran = true;
+      while (branchExecuting && ran)
+         ran = ExecuteBranch();
+
+      if (ran)
+      {
+         std::ostringstream data;
+         data.precision(17);
+         const std::vector<Solver::RecordedResult> &recorded =
+               theSolver->GetRecordedResults();
+         for (UnsignedInt i = 0; i < recorded.size(); ++i)
+            data << recorded[i].id << " " << recorded[i].value << " "
+                 << (recorded[i].type == "" ? "-" : recorded[i].type) << "\n";
+
+         std::string text = data.str();
+         const char *buffer = text.c_str();
+         size_t remaining = text.size();
+         retval = 0;
+         while (remaining > 0)
+         {
+            ssize_t count = write(output, buffer, remaining);
+            if (count < 0)
+            {
+               if (errno == EINTR)
+                  continue;
+               retval = 1;
+               break;
+            }
+            buffer += count;
+            remaining -= count;
+         }
+      }
+   }
+   catch (BaseException &ex)
+   {
+      #ifdef DEBUG_PERTURBATION_PASSES
+         MessageInterface::ShowMessage("Perturbation pass failed: %s\n",
+               ex.GetFullMessage().c_str());
+      #endif
+      retval = 1;
+   }
+   catch (...)
+   {
+      retval = 1;
+   }
+
+   close(output);
+   return retval;
+   #endif
+}
+
+
 //------------------------------------------------------------------------------
 // void GetActiveSubscribers()
 //------------------------------------------------------------------------------
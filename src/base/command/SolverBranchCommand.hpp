@@ -153,6 +153,10 @@ protected:
    virtual void        FreeLoopData();
    
    virtual void        ApplySolution();
+
+   // Concurrent perturbation passes
+   bool                RunPerturbationPasses();
+   int                 RunPerturbationPass(int output);
    
    virtual void        GetActiveSubscribers();
    virtual void        PenUpSubscribers();
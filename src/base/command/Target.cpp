@@ -827,6 +827,10 @@ bool Target::Execute()
                   break;
          
                case Solver::PERTURBING:
+                  // Run the perturbations concurrently when the solver
+                  // allows it; the solver then moves on to CALCULATING
+                  if (RunPerturbationPasses())
+                     break;
                   branchExecuting = true;
                   ApplySubscriberBreakpoint();
                   PenDownSubscribers();
@@ -28,6 +28,7 @@
 */
 //------------------------------------------------------------------------------
 #include "UpdateDynamicData.hpp"
+#include "ParameterIndex.hpp"
 
 //---------------------------------
 // static data
@@ -255,11 +256,11 @@ const StringArray& UpdateDynamicData::GetRefObjectNameArray(const UnsignedInt ty
 //------------------------------------------------------------------------------
 Integer UpdateDynamicData::GetParameterID(const std::string &str) const
 {
-   for (Integer i = GmatCommandParamCount; i < UpdateDynamicDataParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatCommandParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("UpdateDynamicData",
+         PARAMETER_TEXT, GmatCommandParamCount, UpdateDynamicDataParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
 
    return GmatCommand::GetParameterID(str);
 }
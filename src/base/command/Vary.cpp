@@ -31,6 +31,7 @@
 
 
 #include "Vary.hpp"
+#include "ParameterIndex.hpp"
 #include "ParameterException.hpp"
 #include "DifferentialCorrector.hpp"
 #include "Parameter.hpp"
@@ -546,11 +547,11 @@ std::string Vary::GetParameterText(const Integer id) const
 //---------------------------------------------------------------------------
 Integer Vary::GetParameterID(const std::string &str) const
 {
-   for (Integer i = SolverSequenceCommandParamCount; i < VaryParamCount; ++i)
-   {
-      if (str == PARAMETER_TEXT[i - SolverSequenceCommandParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("Vary", PARAMETER_TEXT,
+         SolverSequenceCommandParamCount, VaryParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
 
    return SolverSequenceCommand::GetParameterID(str);
 }
@@ -31,6 +31,7 @@
 #include <sstream>
 #include "gmatdefs.hpp"
 #include "While.hpp"
+#include "ParameterIndex.hpp"
 #include "Parameter.hpp"
 #include "MessageInterface.hpp"
 #include "TimeReal.hpp"          // For the Elapsed time hack in Execute
@@ -427,11 +428,11 @@ std::string While::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer While::GetParameterID(const std::string &str) const
 {
-   for (Integer i = ConditionalBranchParamCount; i < WhileParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - ConditionalBranchParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("While", PARAMETER_TEXT,
+         ConditionalBranchParamCount, WhileParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
    
    return ConditionalBranch::GetParameterID(str);
 }
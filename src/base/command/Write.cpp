@@ -31,6 +31,7 @@
 
 
 #include "Write.hpp"
+#include "ParameterIndex.hpp"
 #include "MessageInterface.hpp"
 #include "StringUtil.hpp"       // for GetArrayIndex()
 #include <sstream>
@@ -795,11 +796,11 @@ GmatBase* Write::Clone() const
 //------------------------------------------------------------------------------
 Integer Write::GetParameterID(const std::string &str) const
 {
-   for (Integer i = GmatCommandParamCount; i < WriteParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatCommandParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("Write", PARAMETER_TEXT,
+         GmatCommandParamCount, WriteParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
    
    return GmatCommand::GetParameterID(str);
 }
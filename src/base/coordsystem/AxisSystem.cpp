@@ -34,6 +34,8 @@
 #include "gmatdefs.hpp"
 #include "GmatBase.hpp"
 #include "AxisSystem.hpp"
+#include "ParameterIndex.hpp"
+#include "RotationDataCache.hpp"
 #include "CoordinateBase.hpp"
 #include "Rmatrix33.hpp"
 #include "RealUtilities.hpp"
@@ -41,11 +43,13 @@
 #include "Linear.hpp"
 #include "GmatConstants.hpp"
 #include "Rvector3.hpp"
+#include "FixedVector.hpp"
 #include "MessageInterface.hpp"
 #include "CoordinateSystemException.hpp"
 #include "SolarSystem.hpp"
 
 #include <iostream>
+#include <sstream>
 
 
 using namespace GmatMathUtil;           // for trig functions, etc.
@@ -142,6 +146,7 @@ nutationSrc      (GmatItrf::NUTATION_1980),
 planetarySrc     (GmatItrf::PLANETARY_1980),
 aVals            (NULL), 
 apVals           (NULL),
+nutationCache    (NULL),
 precData         (NULL),
 nutData          (NULL),
 stData           (NULL),
@@ -202,6 +207,7 @@ nutationSrc       (GmatItrf::NUTATION_1980),
 planetarySrc      (GmatItrf::PLANETARY_1980),
 aVals            (NULL), 
 apVals           (NULL),
+nutationCache    (NULL),
 precData         (NULL),
 nutData          (NULL),
 stData           (NULL),
@@ -269,6 +275,7 @@ const AxisSystem& AxisSystem::operator=(const AxisSystem &axisSys)
    
    aVals             = NULL; 
    apVals            = NULL;
+   nutationCache     = NULL;
    precData          = NULL;
    nutData           = NULL;
    stData            = NULL;
@@ -1508,14 +1515,13 @@ bool AxisSystem::RotateFromBaseSystem(const GmatTime &epoch,
 //------------------------------------------------------------------------------
 bool AxisSystem::CompleteRotateToBase(const Rvector &inState, Rvector &outState)
 {
-   static Rvector3 tmpPosVecTo;
-   static Rvector3 tmpVelVecTo;
-   static const Real  *tmpPosTo = tmpPosVecTo.GetDataVector();
-   static const Real  *tmpVelTo = tmpVelVecTo.GetDataVector();
-   
+   // Stack temporaries: no allocation, and safe when several threads rotate
+   // states through their own axis systems
    // *********** assuming only one 6-vector for now - UPDATE LATER!!!!!!
-   tmpPosVecTo.Set(inState[0],inState[1], inState[2]);
-   tmpVelVecTo.Set(inState[3],inState[4], inState[5]);
+   const FixedVector3 tmpPosVecTo(inState[0],inState[1], inState[2]);
+   const FixedVector3 tmpVelVecTo(inState[3],inState[4], inState[5]);
+   const Real  *tmpPosTo = tmpPosVecTo.GetDataVector();
+   const Real  *tmpVelTo = tmpVelVecTo.GetDataVector();
    
    #ifdef DEBUG_CALCS
       MessageInterface::ShowMessage(
@@ -1637,14 +1643,13 @@ bool AxisSystem::CompleteRotateToBase(const Real *inState, Real *outState)
 //------------------------------------------------------------------------------
 bool AxisSystem::CompleteRotateFromBase(const Rvector &inState, Rvector &outState)
 {
-   static Rvector3 tmpPosVec;
-   static Rvector3 tmpVelVec;
-   static const Real  *tmpPos = tmpPosVec.GetDataVector();
-   static const Real  *tmpVel = tmpVelVec.GetDataVector();
-   
+   // Stack temporaries: no allocation, and safe when several threads rotate
+   // states through their own axis systems
    // *********** assuming only one 6-vector for now - UPDATE LATER!!!!!!
-   tmpPosVec.Set(inState[0],inState[1], inState[2]);
-   tmpVelVec.Set(inState[3],inState[4], inState[5]);
+   const FixedVector3 tmpPosVec(inState[0],inState[1], inState[2]);
+   const FixedVector3 tmpVelVec(inState[3],inState[4], inState[5]);
+   const Real  *tmpPos = tmpPosVec.GetDataVector();
+   const Real  *tmpVel = tmpVelVec.GetDataVector();
 
    #ifdef DEBUG_CALCS
       MessageInterface::ShowMessage(
@@ -1797,11 +1802,11 @@ std::string AxisSystem::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer AxisSystem::GetParameterID(const std::string &str) const
 {
-   for (Integer i = CoordinateBaseParamCount; i < AxisSystemParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - CoordinateBaseParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("AxisSystem", PARAMETER_TEXT,
+         CoordinateBaseParamCount, AxisSystemParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
    
    return CoordinateBase::GetParameterID(str);
 }
@@ -2193,6 +2198,15 @@ void AxisSystem::InitializeFK5()
    BpVals = Bp.GetDataVector();
    CpVals = Cp.GetDataVector();
          DpVals = Dp.GetDataVector();
+
+   // Nutation angles are shared by every axis system that uses the same
+   // terms; fit them in one-day segments (in Julian centuries of TDB)
+   std::stringstream cacheKey;
+   cacheKey << "FK5Nutation:" << (Integer) nutationSrc << ":"
+            << (Integer) planetarySrc << ":" << itrf->GetNutationFileName()
+            << ":" << itrf->GetPlanetaryFileName();
+   nutationCache = RotationDataCache::GetSharedCache(cacheKey.str(), 2, 0.0,
+         1.0 / GmatTimeConstants::DAYS_PER_JULIAN_CENTURY, 12);
 }   
 
 //------------------------------------------------------------------------------
@@ -2298,23 +2312,11 @@ void AxisSystem::ComputeNutationMatrix(const Real tTDB, A1Mjd atEpoch,
    
    // Updated coefficients for GMT-4295.  Vallado's text is incorrect 
    // and updated based on Supplement to the Astronomical Almanac. - TDN 
-   Real const125, const134, const357, const93, const297;
+   Real const125;
    if (nutationSrc == GmatItrf::NUTATION_1980)
-   {
       const125 = 125.04452222*RAD_PER_DEG;
-      const134 = 134.96298139*RAD_PER_DEG;
-      const357 = 357.52772333*RAD_PER_DEG;
-      const93  =  93.27191028*RAD_PER_DEG;
-      const297 = 297.85036306*RAD_PER_DEG;
-   }
    else if (nutationSrc == GmatItrf::NUTATION_1996)
-   {
       const125 = 125.04455501*RAD_PER_DEG;
-      const134 = 134.96340251*RAD_PER_DEG;
-      const357 = 357.52910918*RAD_PER_DEG;
-      const93  =  93.27209062*RAD_PER_DEG;
-      const297 = 297.85019547*RAD_PER_DEG;
-   }
    else
    {
       throw CoordinateSystemException("Error: code to calculate nutation matrix for the current nutation source is not implemented\n"); 
@@ -2324,10 +2326,6 @@ void AxisSystem::ComputeNutationMatrix(const Real tTDB, A1Mjd atEpoch,
    #ifdef DEBUG_UPDATE
       MessageInterface::ShowMessage("consts computed ... \n");
       MessageInterface::ShowMessage("  const125 = %12.10f\n", const125);
-      MessageInterface::ShowMessage("  const134 = %12.10f\n", const134);
-      MessageInterface::ShowMessage("  const357 = %12.10f\n", const357);
-      MessageInterface::ShowMessage("  const93  = %12.10f\n", const93);
-      MessageInterface::ShowMessage("  const297 = %12.10f\n", const297);
    #endif
 
    Real tTDB2   = tTDB  * tTDB;
@@ -2401,9 +2399,141 @@ void AxisSystem::ComputeNutationMatrix(const Real tTDB, A1Mjd atEpoch,
       MessageInterface::ShowMessage("----> Computing NEW NUT matrix at time %12.10f\n",
          atEpoch.Get());
    #endif
-   // otherwise, need to recompute all the nutation data
-   dPsi      = 0.0;
+   // otherwise, need to recompute all the nutation data; the series are
+   // fitted once per day into the shared cache and interpolated from there
    Real dEps = 0.0;
+   if (nutationCache != NULL)
+   {
+      Real angles[2];
+      nutationCache->Evaluate(tTDB, angles,
+            [this](Real t, Real *values)
+            {
+               ComputeNutationAngles(t, values[0], values[1]);
+            });
+      dPsi = angles[0];
+      dEps = angles[1];
+   }
+   else
+      ComputeNutationAngles(tTDB, dPsi, dEps);
+
+    
+   #ifdef DEBUG_FIRST_CALL
+      if (!firstCallFired)
+         MessageInterface::ShowMessage(
+            "      dPsi(0)           = %.13lf\n"
+            "      dEps(0)           = %.13lf\n",
+            dPsi, dEps);
+   #endif
+    
+   // FOR NOW, SQ's code to approximate GSRF frame
+   // NOTE - do we delete this when we put in the planetary stuff above?
+   // offset and rate correction to approximate GCRF, Ref.[1], Eq (3-63)  - SQ
+   // This is Vallado Eq. 3-62 - WCS
+   
+   #ifdef DEBUG_FIRST_CALL
+      if (!firstCallFired)
+         MessageInterface::ShowMessage(
+            "      dPsi(1)           = %.13lf\n"
+            "      dEps(1)           = %.13lf\n",
+            dPsi, dEps);
+   #endif
+    
+   // Compute obliquity of the ecliptic (Vallado Eq. 3-52 & Eq. 3-63)
+   Real TrueOoE = Epsbar + dEps;
+   
+   // Compute useful trigonometric quantities
+   Real cosdPsi   = cos(dPsi);
+   Real cosTEoE   = cos(TrueOoE);
+   Real sindPsi   = sin(dPsi);
+   Real sinEpsbar = sin(Epsbar);
+   Real sinTEoE   = sin(TrueOoE);   
+   
+   // Compute Rotation matrix for transformations from MOD to TOD
+   // (Vallado Eq. 3-64)
+   NUT.Set( cosdPsi,
+           -sindPsi*cosEpsbar,
+           -sindPsi*sinEpsbar,
+            sindPsi*cosTEoE, 
+            cosTEoE*cosdPsi*cosEpsbar + sinTEoE*sinEpsbar,
+            sinEpsbar*cosTEoE*cosdPsi - sinTEoE*cosEpsbar,
+            sinTEoE*sindPsi,
+            sinTEoE*cosdPsi*cosEpsbar - sinEpsbar*cosTEoE,
+            sinTEoE*sinEpsbar*cosdPsi + cosTEoE*cosEpsbar);
+   
+   lastNUTEpoch = atEpoch;
+   lastNUT      = NUT;
+   lastDPsi     = dPsi; 
+   
+   #ifdef DEBUG_ROT_MATRIX
+      MessageInterface::ShowMessage("At end of ComputeNutationmatrix ...\n");
+      MessageInterface::ShowMessage("   atEpoch   = %.15lf\n", atEpoch.Get());
+      MessageInterface::ShowMessage("   longAscNodeLunar   = %.15lf\n", longAscNodeLunar);
+      MessageInterface::ShowMessage("   cosEpsbar   = %.15lf\n", cosEpsbar);
+      MessageInterface::ShowMessage("   dPsi   = %.15lf\n", dPsi);
+	  MessageInterface::ShowMessage("   dEps   = %.15lf\n", dEps);
+	  MessageInterface::ShowMessage("   TrueOoE   = %.15lf\n", TrueOoE);
+   #endif
+//   return NUT;
+}
+
+//------------------------------------------------------------------------------
+//  void ComputeNutationAngles(const Real tTDB, Real &dPsi, Real &dEps)
+//------------------------------------------------------------------------------
+/**
+ * This method evaluates the nutation series (and the planetary terms, for the
+ * 1996 theory) for the nutation in longitude and in obliquity.
+ *
+ * @param tTDB  TDB time, in Julian centuries from J2000
+ * @param dPsi  nutation in longitude, in radians (output)
+ * @param dEps  nutation in obliquity, in radians (output)
+ */
+//------------------------------------------------------------------------------
+void AxisSystem::ComputeNutationAngles(const Real tTDB, Real &dPsi, Real &dEps)
+{
+   // Updated coefficients for GMT-4295.  Vallado's text is incorrect 
+   // and updated based on Supplement to the Astronomical Almanac. - TDN 
+   Real const125, const134, const357, const93, const297;
+   if (nutationSrc == GmatItrf::NUTATION_1980)
+   {
+      const125 = 125.04452222*RAD_PER_DEG;
+      const134 = 134.96298139*RAD_PER_DEG;
+      const357 = 357.52772333*RAD_PER_DEG;
+      const93  =  93.27191028*RAD_PER_DEG;
+      const297 = 297.85036306*RAD_PER_DEG;
+   }
+   else if (nutationSrc == GmatItrf::NUTATION_1996)
+   {
+      const125 = 125.04455501*RAD_PER_DEG;
+      const134 = 134.96340251*RAD_PER_DEG;
+      const357 = 357.52910918*RAD_PER_DEG;
+      const93  =  93.27209062*RAD_PER_DEG;
+      const297 = 297.85019547*RAD_PER_DEG;
+   }
+   else
+   {
+      throw CoordinateSystemException("Error: code to calculate nutation matrix for the current nutation source is not implemented\n"); 
+   }
+
+   Real tTDB2   = tTDB  * tTDB;
+   Real tTDB3   = tTDB2 * tTDB;
+   Real tTDB4   = tTDB3 * tTDB;
+
+   Real longAscNodeLunar = 0.0;
+   // Updated coefficients for GMT-4295.  Vallado's text is incorrect 
+   // and updated based on Supplement to the Astronomical Almanac. - TDN 
+   if (nutationSrc == GmatItrf::NUTATION_1980)
+      longAscNodeLunar  = const125 + (  -6962890.5390*tTDB
+                       + 7.455*tTDB2 + 0.008*tTDB3)
+                       * RAD_PER_ARCSEC;
+   else if (nutationSrc == GmatItrf::NUTATION_1996)
+      longAscNodeLunar  = const125 + (  -6962890.2665*tTDB
+                       + 7.4722*tTDB2 + 0.007702*tTDB3 - 0.00005939*tTDB4)
+                       * RAD_PER_ARCSEC;
+
+   longAscNodeLunar = longAscNodeLunar - ((int)(longAscNodeLunar/(2*GmatMathConstants::PI)))*2*GmatMathConstants::PI;	
+
+   dPsi = 0.0;
+   dEps = 0.0;
    // First, compute useful angles (Vallado Eq. 3-54)
    // NOTE - taken from Steve Queen's code - he has apparently converted
    // the values in degrees (from Vallado Eq. 3-54) to arcsec before
@@ -2459,13 +2589,12 @@ void AxisSystem::ComputeNutationMatrix(const Real tTDB, A1Mjd atEpoch,
             "      argLatitudeMoon   = %.13lf\n"
             "      meanElongationSun = %.13lf\n"
             "      longAscNodeLunar  = %.13lf\n"
-            "      cosEpsbar         = %.13lf\n"
             "      tTDB              = %.13le\n"
             "      tTDB2             = %.13le\n"
             "      tTDB3             = %.13le\n"
             "      tTDB4             = %.13le\n",
             nut, meanAnomalyMoon, meanAnomalySun, argLatitudeMoon,
-            meanElongationSun, longAscNodeLunar, cosEpsbar, tTDB, tTDB2, tTDB3,
+            meanElongationSun, longAscNodeLunar, tTDB, tTDB2, tTDB3,
             tTDB4);
 
       if (!firstCallFired) 
@@ -2664,64 +2793,6 @@ void AxisSystem::ComputeNutationMatrix(const Real tTDB, A1Mjd atEpoch,
    
     dPsi += dPsiAddend * RAD_PER_ARCSEC;
     dEps += dEpsAddend * RAD_PER_ARCSEC;
-    
-   #ifdef DEBUG_FIRST_CALL
-      if (!firstCallFired)
-         MessageInterface::ShowMessage(
-            "      dPsi(0)           = %.13lf\n"
-            "      dEps(0)           = %.13lf\n",
-            dPsi, dEps);
-   #endif
-    
-   // FOR NOW, SQ's code to approximate GSRF frame
-   // NOTE - do we delete this when we put in the planetary stuff above?
-   // offset and rate correction to approximate GCRF, Ref.[1], Eq (3-63)  - SQ
-   // This is Vallado Eq. 3-62 - WCS
-   
-   #ifdef DEBUG_FIRST_CALL
-      if (!firstCallFired)
-         MessageInterface::ShowMessage(
-            "      dPsi(1)           = %.13lf\n"
-            "      dEps(1)           = %.13lf\n",
-            dPsi, dEps);
-   #endif
-    
-   // Compute obliquity of the ecliptic (Vallado Eq. 3-52 & Eq. 3-63)
-   Real TrueOoE = Epsbar + dEps;
-   
-   // Compute useful trigonometric quantities
-   Real cosdPsi   = cos(dPsi);
-   Real cosTEoE   = cos(TrueOoE);
-   Real sindPsi   = sin(dPsi);
-   Real sinEpsbar = sin(Epsbar);
-   Real sinTEoE   = sin(TrueOoE);   
-   
-   // Compute Rotation matrix for transformations from MOD to TOD
-   // (Vallado Eq. 3-64)
-   NUT.Set( cosdPsi,
-           -sindPsi*cosEpsbar,
-           -sindPsi*sinEpsbar,
-            sindPsi*cosTEoE, 
-            cosTEoE*cosdPsi*cosEpsbar + sinTEoE*sinEpsbar,
-            sinEpsbar*cosTEoE*cosdPsi - sinTEoE*cosEpsbar,
-            sinTEoE*sindPsi,
-            sinTEoE*cosdPsi*cosEpsbar - sinEpsbar*cosTEoE,
-            sinTEoE*sinEpsbar*cosdPsi + cosTEoE*cosEpsbar);
-   
-   lastNUTEpoch = atEpoch;
-   lastNUT      = NUT;
-   lastDPsi     = dPsi; 
-   
-   #ifdef DEBUG_ROT_MATRIX
-      MessageInterface::ShowMessage("At end of ComputeNutationmatrix ...\n");
-      MessageInterface::ShowMessage("   atEpoch   = %.15lf\n", atEpoch.Get());
-      MessageInterface::ShowMessage("   longAscNodeLunar   = %.15lf\n", longAscNodeLunar);
-      MessageInterface::ShowMessage("   cosEpsbar   = %.15lf\n", cosEpsbar);
-      MessageInterface::ShowMessage("   dPsi   = %.15lf\n", dPsi);
-	  MessageInterface::ShowMessage("   dEps   = %.15lf\n", dEps);
-	  MessageInterface::ShowMessage("   TrueOoE   = %.15lf\n", TrueOoE);
-   #endif
-//   return NUT;
 }
 
 //------------------------------------------------------------------------------
@@ -42,6 +42,8 @@
 #include "EopFile.hpp"
 #include "ItrfCoefficientsFile.hpp"
 
+class RotationDataCache;
+
 class GMAT_API AxisSystem : public CoordinateBase
 {
 public:
@@ -280,6 +282,8 @@ protected:
    
    Integer                   *aVals;
    Integer                   *apVals;
+   /// Shared fits of the nutation angles; not owned
+   RotationDataCache         *nutationCache;
    
    // Performance enhancements
    Rmatrix33 PREC;
@@ -317,6 +321,8 @@ protected:
                                            Real &longAscNodeLunar,
                                            Real &cosEpsbar,
                                            bool forceComputation = false);
+   virtual void ComputeNutationAngles(const Real tTDB, Real &dPsi,
+                                      Real &dEps);
    virtual void ComputeSiderealTimeRotation(const Real jdTT,
                                                  const GmatTime &mjdUT1,
                                                  Real dPsi,
@@ -34,6 +34,7 @@
 #include "gmatdefs.hpp"
 #include "GmatBase.hpp"
 #include "CoordinateBase.hpp"
+#include "ParameterIndex.hpp"
 #include "CoordinateSystemException.hpp"
 #include "SolarSystem.hpp"
 #include "SpacePoint.hpp"
@@ -536,11 +537,11 @@ std::string CoordinateBase::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer CoordinateBase::GetParameterID(const std::string &str) const
 {
-   for (Integer i = GmatBaseParamCount; i < CoordinateBaseParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatBaseParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("CoordinateBase", PARAMETER_TEXT,
+         GmatBaseParamCount, CoordinateBaseParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
 
    return GmatBase::GetParameterID(str);
 }
@@ -38,6 +38,7 @@
 #include "CoordinateSystem.hpp"
 #include "CoordinateSystemException.hpp"
 #include "Rvector.hpp"
+#include "FixedVector.hpp"
 #include "TimeTypes.hpp"
 #include "ICRFFile.hpp"
 #include "MessageInterface.hpp"
@@ -62,6 +63,25 @@
 //---------------------------------
 // none at this time
 
+//------------------------------------------------------------------------------
+// static void CopyConvertedState(const Real *state, Rvector &outState)
+//------------------------------------------------------------------------------
+/**
+ * Copies a 6-element converted state into an Rvector.  Only the elements the
+ * conversion produced are written, so a longer outState keeps its trailing
+ * elements.
+ *
+ * @param state    The converted state
+ * @param outState The vector receiving the state
+ */
+//------------------------------------------------------------------------------
+static void CopyConvertedState(const Real *state, Rvector &outState)
+{
+   Integer count = (outState.GetSize() < 6 ? outState.GetSize() : 6);
+   for (Integer i = 0; i < count; ++i)
+      outState[i] = state[i];
+}
+
 //------------------------------------------------------------------------------
 // public methods
 //------------------------------------------------------------------------------
@@ -182,8 +202,11 @@ bool CoordinateConverter::Convert(const A1Mjd &epoch, const Rvector &inState,
                           CoordinateSystem *outCoord, 
                           bool forceComputation, bool omitTranslation)
 {
+   // The Real* conversions work on 6-element states; the result is built on
+   // the stack rather than in a heap buffer sized to outState
    const Real *in = inState.GetDataVector();
-   Real *out = new Real[outState.GetSize()];
+   FixedVector6 outVec;
+   Real *out = outVec.GetDataVector();
 
    #ifdef DEBUG_TO_FROM
    MessageInterface::ShowMessage("in: %f %f %f %f %f %f\n", in[0], in[1], in[2], in[3], in[4], in[5]);
@@ -192,12 +215,10 @@ bool CoordinateConverter::Convert(const A1Mjd &epoch, const Rvector &inState,
    
    if (Convert(epoch, in, inCoord, out, outCoord, forceComputation, omitTranslation))
    {
-      outState.Set(out);
-      delete [] out;
+      CopyConvertedState(out, outState);
       return true;
    }
    
-   delete [] out;
    return false;
 
 }
@@ -208,8 +229,11 @@ bool CoordinateConverter::Convert(const GmatTime &epoch, const Rvector &inState,
    CoordinateSystem *outCoord,
    bool forceComputation, bool omitTranslation)
 {
+   // The Real* conversions work on 6-element states; the result is built on
+   // the stack rather than in a heap buffer sized to outState
    const Real *in = inState.GetDataVector();
-   Real *out = new Real[outState.GetSize()];
+   FixedVector6 outVec;
+   Real *out = outVec.GetDataVector();
 
 #ifdef DEBUG_TO_FROM
    MessageInterface::ShowMessage("in: %f %f %f %f %f %f\n", in[0], in[1], in[2], in[3], in[4], in[5]);
@@ -218,12 +242,10 @@ bool CoordinateConverter::Convert(const GmatTime &epoch, const Rvector &inState,
 
    if (Convert(epoch, in, inCoord, out, outCoord, forceComputation, omitTranslation))
    {
-      outState.Set(out);
-      delete[] out;
+      CopyConvertedState(out, outState);
       return true;
    }
 
-   delete[] out;
    return false;
 
 }
@@ -811,16 +833,15 @@ bool CoordinateConverter::ConvertFromBaseToBase(const A1Mjd &epoch,
       return true;
    }
    const Real *in  = inBaseState.GetDataVector();
-   Real       *out = new Real[outBaseState.GetSize()];
+   FixedVector6 outVec;
+   Real       *out = outVec.GetDataVector();
 
    if (ConvertFromBaseToBase(epoch, solarSystem, inBase, outBase, in, out))
    {
-      outBaseState.Set(out);
-      delete [] out;
+      CopyConvertedState(out, outBaseState);
       return true;
    }
 
-   delete [] out;
    return false;
 }
 
@@ -849,16 +870,15 @@ bool CoordinateConverter::ConvertFromBaseToBase(const GmatTime &epoch,
       return true;
    }
    const Real *in = inBaseState.GetDataVector();
-   Real       *out = new Real[outBaseState.GetSize()];
+   FixedVector6 outVec;
+   Real       *out = outVec.GetDataVector();
 
    if (ConvertFromBaseToBase(epoch, solarSystem, inBase, outBase, in, out))
    {
-      outBaseState.Set(out);
-      delete[] out;
+      CopyConvertedState(out, outBaseState);
       return true;
    }
 
-   delete[] out;
    return false;
 }
 
@@ -36,6 +36,7 @@
 #include "gmatdefs.hpp"
 #include "GmatBase.hpp"
 #include "CoordinateSystem.hpp"
+#include "ParameterIndex.hpp"
 #include "CoordinateSystemException.hpp"
 #include "CoordinateBase.hpp"
 #include "ObjectReferencedAxes.hpp"
@@ -1782,11 +1783,11 @@ std::string CoordinateSystem::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer CoordinateSystem::GetParameterID(const std::string &str) const
 {
-   for (Integer i = CoordinateBaseParamCount; i < CoordinateSystemParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - CoordinateBaseParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("CoordinateSystem",
+         PARAMETER_TEXT, CoordinateBaseParamCount, CoordinateSystemParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
    
    return CoordinateBase::GetParameterID(str);
 }
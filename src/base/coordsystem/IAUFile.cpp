@@ -34,6 +34,7 @@
 #include "RealUtilities.hpp"
 #include "FileManager.hpp"
 #include "LagrangeInterpolator.hpp"
+#include "RotationDataCache.hpp"
 #include "MessageInterface.hpp"
 #include "GmatBaseException.hpp"
 
@@ -80,6 +81,8 @@ void IAUFile::Initialize()
    
 	// Allocate buffer to store IAU2000/2006 data:
 	AllocateArrays();
+	if (dataCache != NULL)
+		dataCache->Clear();
    
    // Use FileManager::FindPath() for new file path implementation (LOJ: 2014.07.01)
    
@@ -193,6 +196,57 @@ bool IAUFile::GetIAUData(Real ind, Real* iau_data, Integer dim, Integer order)
 		}
 	}
 
+	// Within each table interval the interpolation uses a fixed set of
+	// points, so it is a polynomial of degree order there; a Chebyshev fit of
+	// that degree over the interval reproduces it and is cheaper to evaluate
+	if (ind < independence[pointsCount-1])
+	{
+		if ((dataCache != NULL) && ((dataCache->GetDimension() != dim) ||
+		    (dataCache->GetDegree() != order)))
+		{
+			delete dataCache;
+			dataCache = NULL;
+		}
+		if (dataCache == NULL)
+			dataCache = new RotationDataCache(dim, independence[0], 1.0, order);
+
+		bool fitted = true;
+		dataCache->Evaluate(ind, iau_data,
+			[this, dim, order, &fitted](Real t, Real *values)
+			{
+				if (!InterpolateIAUData(t, values, dim, order))
+					fitted = false;
+			});
+		if (fitted)
+			return true;
+
+		dataCache->Clear();
+	}
+
+	return InterpolateIAUData(ind, iau_data, dim, order);
+}
+
+//------------------------------------------------------------------------------
+//  protected methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// bool InterpolateIAUData(Real ind, Real* iau_data, Integer dim, Integer order)
+//------------------------------------------------------------------------------
+/*
+ * Interpolates the IAU2000 table directly, without the segment cache.
+ *
+ * @param ind          independent variable (TT Julian date)
+ * @param iau_data     interpolated X, Y and s (output)
+ * @param dim          number of dependent values interpolated
+ * @param order        order of the Lagrange interpolation
+ *
+ * @return success flag
+ */
+//------------------------------------------------------------------------------
+bool IAUFile::InterpolateIAUData(Real ind, Real* iau_data, Integer dim,
+                                 Integer order)
+{
 	// Specify beginning index and ending index in order to run interpolation:
 	Real stepsize = 1.0;
     Integer midpoint = (ind-independence[0])/(Integer)GmatMathUtil::NearestInt(stepsize);
@@ -218,10 +272,6 @@ bool IAUFile::GetIAUData(Real ind, Real* iau_data, Integer dim, Integer order)
 	return returnval;
 }
 
-//------------------------------------------------------------------------------
-//  protected methods
-//------------------------------------------------------------------------------
-
 //------------------------------------------------------------------------------
 //  void AllocateArrays()
 //------------------------------------------------------------------------------
@@ -250,6 +300,12 @@ void IAUFile::AllocateArrays()
 //------------------------------------------------------------------------------
 void IAUFile::CleanupArrays()
 {
+   if (dataCache != NULL)
+   {
+      delete dataCache;
+      dataCache = NULL;
+   }
+
    if (independence != NULL)
    {
 	  // clean up the array of independent variable
@@ -292,6 +348,7 @@ IAUFile::IAUFile(const std::string &fileName, Integer dim) :
    dimension      (dim),
    tableSz        (MAX_TABLE_SIZE),
    pointsCount    (0),
+   dataCache      (NULL),
    isInitialized  (false)
 {
 }
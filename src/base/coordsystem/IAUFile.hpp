@@ -36,6 +36,8 @@
 
 #include "gmatdefs.hpp"
 
+class RotationDataCache;
+
 class GMAT_API IAUFile
 {
 public:
@@ -67,12 +69,16 @@ protected:
    Integer          tableSz;
    /// number of data points
    Integer          pointsCount;
+   /// Chebyshev fits of the interpolated data, one table interval each
+   RotationDataCache *dataCache;
 
    /// specify whether the object is initialized or not
    bool isInitialized;
 
    void AllocateArrays();
    void CleanupArrays();
+   bool InterpolateIAUData(Real ind, Real* iau_data, Integer dim,
+                           Integer order);
 
 private:
    // default constructor
@@ -35,6 +35,7 @@
 #include "gmatdefs.hpp"
 #include "GmatBase.hpp"
 #include "LocalAlignedConstrainedAxes.hpp"
+#include "ParameterIndex.hpp"
 #include "DynamicAxes.hpp"
 #include "CoordinateSystem.hpp"
 #include "CoordinateSystemException.hpp"
@@ -408,12 +409,12 @@ std::string LocalAlignedConstrainedAxes::GetParameterText(const Integer id) cons
 //------------------------------------------------------------------------------
 Integer LocalAlignedConstrainedAxes::GetParameterID(const std::string &str) const
 {
-   for (Integer i = DynamicAxesParamCount;
-        i < LocalAlignedConstrainedAxesParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - DynamicAxesParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("LocalAlignedConstrainedAxes",
+         PARAMETER_TEXT, DynamicAxesParamCount,
+         LocalAlignedConstrainedAxesParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
 
    return DynamicAxes::GetParameterID(str);
 }
@@ -35,6 +35,7 @@
 #include "gmatdefs.hpp"
 #include "GmatBase.hpp"
 #include "ObjectReferencedAxes.hpp"
+#include "ParameterIndex.hpp"
 #include "DynamicAxes.hpp"
 #include "CoordinateSystemException.hpp"
 
@@ -567,11 +568,11 @@ std::string ObjectReferencedAxes::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer ObjectReferencedAxes::GetParameterID(const std::string &str) const
 {
-   for (Integer i = DynamicAxesParamCount; i < ObjectReferencedAxesParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - DynamicAxesParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("ObjectReferencedAxes",
+         PARAMETER_TEXT, DynamicAxesParamCount, ObjectReferencedAxesParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
 
    return DynamicAxes::GetParameterID(str);
 }
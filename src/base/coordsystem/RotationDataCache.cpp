@@ -0,0 +1,272 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                             RotationDataCache
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/16
+//
+/**
+ * Implements the RotationDataCache class.
+ */
+//------------------------------------------------------------------------------
+#include "RotationDataCache.hpp"
+#include "GmatConstants.hpp"
+#include "MessageInterface.hpp"
+#include <cmath>
+
+//#define DEBUG_ROTATION_DATA_CACHE
+
+namespace
+{
+   /// The shared caches, by key
+   std::map<std::string, RotationDataCache*> sharedCaches;
+   std::mutex                                sharedCacheMutex;
+}
+
+//------------------------------------------------------------------------------
+// RotationDataCache(Integer dimension, Real origin, Real segmentLength,
+//                   Integer degree)
+//------------------------------------------------------------------------------
+/**
+ * Constructor
+ *
+ * @param dimension     Number of angles fitted
+ * @param origin        Start of segment 0
+ * @param segmentLength Length of each segment
+ * @param degree        Degree of the Chebyshev fits
+ */
+//------------------------------------------------------------------------------
+RotationDataCache::RotationDataCache(Integer dimension, Real origin,
+                                     Real segmentLength, Integer degree) :
+   dimension         (dimension),
+   origin            (origin),
+   segmentLength     (segmentLength),
+   degree            (degree > 0 ? degree : 1),
+   lastIndex         (0),
+   lastCoefficients  (NULL)
+{
+}
+
+//------------------------------------------------------------------------------
+// ~RotationDataCache()
+//------------------------------------------------------------------------------
+RotationDataCache::~RotationDataCache()
+{
+}
+
+//------------------------------------------------------------------------------
+// void Evaluate(Real atTime, Real *values, const Evaluator &evaluator)
+//------------------------------------------------------------------------------
+/**
+ * Returns the fitted angles at a time, fitting its segment first if needed.
+ *
+ * @param atTime    The time of the evaluation
+ * @param values    The angles (output, dimension of them)
+ * @param evaluator The full series, used to fit a new segment
+ */
+//------------------------------------------------------------------------------
+void RotationDataCache::Evaluate(Real atTime, Real *values,
+                                 const Evaluator &evaluator)
+{
+   Real position = (atTime - origin) / segmentLength;
+   Integer index = (Integer)std::floor(position);
+
+   std::lock_guard<std::mutex> lock(cacheMutex);
+
+   const Real *coeff = lastCoefficients;
+   if ((coeff == NULL) || (index != lastIndex))
+   {
+      std::map<Integer, RealArray>::iterator i = segments.find(index);
+      if (i != segments.end())
+         coeff = &(i->second[0]);
+      else
+         coeff = FitSegment(index, evaluator);
+      lastIndex = index;
+      lastCoefficients = coeff;
+   }
+
+   // Clenshaw summation on [-1, 1]
+   Real x  = 2.0 * (position - index) - 1.0;
+   Real x2 = 2.0 * x;
+   Integer n = degree + 1;
+   for (Integer d = 0; d < dimension; ++d)
+   {
+      const Real *c = coeff + d * n;
+      Real b1 = 0.0, b2 = 0.0;
+      for (Integer j = degree; j >= 1; --j)
+      {
+         Real b0 = x2 * b1 - b2 + c[j];
+         b2 = b1;
+         b1 = b0;
+      }
+      values[d] = x * b1 - b2 + c[0];
+   }
+}
+
+//------------------------------------------------------------------------------
+// void Clear()
+//------------------------------------------------------------------------------
+/**
+ * Drops all fitted segments.
+ */
+//------------------------------------------------------------------------------
+void RotationDataCache::Clear()
+{
+   std::lock_guard<std::mutex> lock(cacheMutex);
+   segments.clear();
+   lastCoefficients = NULL;
+}
+
+//------------------------------------------------------------------------------
+// Integer GetDimension() const
+//------------------------------------------------------------------------------
+Integer RotationDataCache::GetDimension() const
+{
+   return dimension;
+}
+
+//------------------------------------------------------------------------------
+// Integer GetDegree() const
+//------------------------------------------------------------------------------
+Integer RotationDataCache::GetDegree() const
+{
+   return degree;
+}
+
+//------------------------------------------------------------------------------
+// Integer GetSegmentCount()
+//------------------------------------------------------------------------------
+/**
+ * @return The number of segments fitted so far
+ */
+//------------------------------------------------------------------------------
+Integer RotationDataCache::GetSegmentCount()
+{
+   std::lock_guard<std::mutex> lock(cacheMutex);
+   return (Integer)segments.size();
+}
+
+//------------------------------------------------------------------------------
+// RotationDataCache* GetSharedCache(const std::string &key, Integer dimension,
+//       Real origin, Real segmentLength, Integer degree)
+//------------------------------------------------------------------------------
+/**
+ * Returns the cache registered under a key, creating it if needed.
+ *
+ * The key must identify everything the fitted series depend on (for
+ * example the theory and the coefficient file).  The caches live until
+ * ClearSharedCaches() is called.
+ *
+ * @param key           Identifier of the fitted data
+ * @param dimension     Number of angles fitted
+ * @param origin        Start of segment 0
+ * @param segmentLength Length of each segment
+ * @param degree        Degree of the Chebyshev fits
+ *
+ * @return The shared cache
+ */
+//------------------------------------------------------------------------------
+RotationDataCache* RotationDataCache::GetSharedCache(const std::string &key,
+      Integer dimension, Real origin, Real segmentLength, Integer degree)
+{
+   std::lock_guard<std::mutex> lock(sharedCacheMutex);
+
+   std::map<std::string, RotationDataCache*>::iterator i =
+         sharedCaches.find(key);
+   if (i != sharedCaches.end())
+      return i->second;
+
+   RotationDataCache *cache = new RotationDataCache(dimension, origin,
+         segmentLength, degree);
+   sharedCaches[key] = cache;
+
+   #ifdef DEBUG_ROTATION_DATA_CACHE
+      MessageInterface::ShowMessage("RotationDataCache: created shared cache "
+            "\"%s\" <%p>\n", key.c_str(), cache);
+   #endif
+
+   return cache;
+}
+
+//------------------------------------------------------------------------------
+// void ClearSharedCaches()
+//------------------------------------------------------------------------------
+/**
+ * Drops the fitted segments of all shared caches, for example when the data
+ * files they were built from are replaced.  The cache objects themselves
+ * stay valid.
+ */
+//------------------------------------------------------------------------------
+void RotationDataCache::ClearSharedCaches()
+{
+   std::lock_guard<std::mutex> lock(sharedCacheMutex);
+   for (std::map<std::string, RotationDataCache*>::iterator i =
+         sharedCaches.begin(); i != sharedCaches.end(); ++i)
+      i->second->Clear();
+}
+
+//------------------------------------------------------------------------------
+// const Real* FitSegment(Integer index, const Evaluator &evaluator)
+//------------------------------------------------------------------------------
+/**
+ * Fits a segment by evaluating the series at the Chebyshev nodes.
+ *
+ * Called with the cache locked.
+ *
+ * @param index     The segment index
+ * @param evaluator The full series
+ *
+ * @return The coefficients of the segment
+ */
+//------------------------------------------------------------------------------
+const Real* RotationDataCache::FitSegment(Integer index,
+                                          const Evaluator &evaluator)
+{
+   Integer n = degree + 1;
+   Real start = origin + index * segmentLength;
+
+   RealArray nodeValues(n * dimension);
+   for (Integer k = 0; k < n; ++k)
+   {
+      Real x = std::cos(GmatMathConstants::PI * (k + 0.5) / n);
+      evaluator(start + 0.5 * (x + 1.0) * segmentLength,
+                &nodeValues[k * dimension]);
+   }
+
+   RealArray &coeff = segments[index];
+   coeff.assign(n * dimension, 0.0);
+   for (Integer d = 0; d < dimension; ++d)
+   {
+      for (Integer j = 0; j < n; ++j)
+      {
+         Real sum = 0.0;
+         for (Integer k = 0; k < n; ++k)
+            sum += nodeValues[k * dimension + d] *
+                   std::cos(GmatMathConstants::PI * j * (k + 0.5) / n);
+         coeff[d * n + j] = (j == 0 ? 1.0 : 2.0) * sum / n;
+      }
+   }
+
+   #ifdef DEBUG_ROTATION_DATA_CACHE
+      MessageInterface::ShowMessage("RotationDataCache <%p>: fitted segment "
+            "%d starting at %.12lf\n", this, index, start);
+   #endif
+
+   return &coeff[0];
+}
@@ -0,0 +1,95 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                             RotationDataCache
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/16
+//
+/**
+ * Declares the RotationDataCache class, a time-indexed cache of Chebyshev
+ * fits to the angles used in Earth orientation (nutation in longitude and
+ * obliquity, IAU 2000 X, Y and s, ...).
+ *
+ * Time is split into fixed-length segments.  The first request that falls in
+ * a segment evaluates the full series at the Chebyshev nodes of the segment
+ * and stores the fit; later requests in the segment cost one Chebyshev sum
+ * per angle.  Segments are filled on demand, so the cache covers the span
+ * the mission actually uses.  Shared caches, keyed by the data they fit, let
+ * every coordinate system that uses the same axes reuse the same segments.
+ * Access is serialized, so a cache may be used from several threads.
+ */
+//------------------------------------------------------------------------------
+#ifndef RotationDataCache_hpp
+#define RotationDataCache_hpp
+
+#include "gmatdefs.hpp"
+#include <functional>
+#include <map>
+#include <mutex>
+
+class GMAT_API RotationDataCache
+{
+public:
+   /// Evaluates the full series: time, output values (dimension of them)
+   typedef std::function<void(Real, Real*)> Evaluator;
+
+   RotationDataCache(Integer dimension, Real origin, Real segmentLength,
+                     Integer degree);
+   virtual ~RotationDataCache();
+
+   void                 Evaluate(Real atTime, Real *values,
+                                 const Evaluator &evaluator);
+   void                 Clear();
+   Integer              GetDimension() const;
+   Integer              GetDegree() const;
+   Integer              GetSegmentCount();
+
+   static RotationDataCache*
+                        GetSharedCache(const std::string &key,
+                                       Integer dimension, Real origin,
+                                       Real segmentLength, Integer degree);
+   static void          ClearSharedCaches();
+
+protected:
+   /// Number of angles fitted
+   Integer              dimension;
+   /// Start of segment 0
+   Real                 origin;
+   /// Length of each segment, in the units of the time argument
+   Real                 segmentLength;
+   /// Degree of the Chebyshev fits
+   Integer              degree;
+   /// Fit coefficients by segment index; dimension * (degree+1) per segment
+   std::map<Integer, RealArray>
+                        segments;
+   /// The last segment used, to skip the map search
+   Integer              lastIndex;
+   const Real           *lastCoefficients;
+   /// Serializes access to the segments
+   std::mutex           cacheMutex;
+
+   const Real*          FitSegment(Integer index, const Evaluator &evaluator);
+
+private:
+   // The caches are shared by pointer; copies are not allowed
+   RotationDataCache(const RotationDataCache &rdc);
+   RotationDataCache& operator=(const RotationDataCache &rdc);
+};
+
+#endif // RotationDataCache_hpp
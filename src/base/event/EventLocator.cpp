@@ -33,6 +33,7 @@
 #include <iostream>
 
 #include "EventLocator.hpp"
+#include "ParameterIndex.hpp"
 #include "EventException.hpp"
 #include "Spacecraft.hpp"
 #include "FileManager.hpp"      // for GetPathname()
@@ -366,11 +367,11 @@ std::string EventLocator::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer EventLocator::GetParameterID(const std::string &str) const
 {
-   for (Integer i = GmatBaseParamCount; i < EventLocatorParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatBaseParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("EventLocator", PARAMETER_TEXT,
+         GmatBaseParamCount, EventLocatorParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
 
    return GmatBase::GetParameterID(str);
 }
@@ -75,6 +75,9 @@
 #include "ICRFAxes.hpp"
 #include "ObjectReferencedAxes.hpp"
 #include "ParameterInfo.hpp"        // for ParameterInfo
+#include "ParameterIndex.hpp"       // for lookup statistics
+#include "FunctionManager.hpp"      // for function call statistics
+#include "EnvironmentContext.hpp"   // for the shared force model geometry
 #include "MessageInterface.hpp"
 #include "CommandUtil.hpp"          // for GetCommandSeq()
 #include "StringTokenizer.hpp"      // for StringTokenizer
@@ -7201,6 +7204,22 @@ Integer Moderator::RunMission(Integer sandboxNum)
    //MessageInterface::ShowMessage("Moderator::RunMission() entered\n");
    MessageInterface::ShowMessage("Running mission...\n");
    Integer status = 1;
+   
+   // Count string parameter lookups when DEBUG_PARAMETER_LOOKUP is on
+   bool writeLookupStats =
+         GmatGlobal::Instance()->IsWritingParameterLookupStats();
+   ParameterIndex::SetStatisticsEnabled(writeLookupStats);
+   if (writeLookupStats)
+      ParameterIndex::ResetStatistics();
+   
+   // Time GMAT function calls when DEBUG_FUNCTION_CALLS is on
+   bool writeCallStats = GmatGlobal::Instance()->IsWritingFunctionCallStats();
+   FunctionManager::SetStatisticsEnabled(writeCallStats);
+   if (writeCallStats)
+      FunctionManager::ResetStatistics();
+   
+   // Ephemeris settings may have changed since the last run
+   EnvironmentContext::ClearContexts();
    // Set to 1 to always run the mission and get the sandbox error message
    // Changed this code while looking at Bug 1532 (LOJ: 2009.11.13)
    isRunReady = true;
@@ -7420,6 +7439,18 @@ Integer Moderator::RunMission(Integer sandboxNum)
    
    MessageInterface::ShowMessage
       ("===> Total Run Time: %.3lf seconds\n", (ms/1000));
+   
+   if (writeLookupStats)
+   {
+      MessageInterface::ShowMessage(ParameterIndex::GetStatisticsReport());
+      ParameterIndex::SetStatisticsEnabled(false);
+   }
+   
+   if (writeCallStats)
+   {
+      MessageInterface::ShowMessage(FunctionManager::GetStatisticsReport());
+      FunctionManager::SetStatisticsEnabled(false);
+   }
 
    #ifdef DEBUG_MEMORY
    StringArray tracks = MemoryTracker::Instance()->GetTracks(false, false);
@@ -54,6 +54,7 @@
 #include "SaveMission.hpp"    // for SaveMission command  
 #include "Stop.hpp"           // for Stop command
 #include "FindEvents.hpp"     // forFindEvents command
+#include "PropagateEnsemble.hpp" // for PropagateEnsemble command
 //#include "CallGmatFunction.hpp"   // for CallGmatFunction command
 #include "CallBuiltinGmatFunction.hpp"
 #include "BeginFiniteBurn.hpp"// for BeginFiniteBurn command
@@ -190,6 +191,8 @@ GmatCommand* CommandFactory::CreateCommand(const std::string &ofType,
         return new Stop;
     else if (ofType == "FindEvents")
         return new FindEvents;
+    else if (ofType == "PropagateEnsemble")
+        return new PropagateEnsemble;
     else if (ofType == "Optimize")
         return new Optimize;
     else if (ofType == "EndOptimize")
@@ -274,6 +277,7 @@ CommandFactory::CommandFactory() :
       creatables.push_back("PenUp");
       creatables.push_back("PenDown");
       creatables.push_back("Propagate");
+      creatables.push_back("PropagateEnsemble");
       creatables.push_back("Report");
       creatables.push_back("SaveMission");
       creatables.push_back("ScriptEvent");
@@ -304,6 +308,9 @@ CommandFactory::CommandFactory() :
       // These commands only works in object setup mode and inside a GmatFunction
       unviewables.push_back("Create");
 
+      // Script-only commands without a GUI panel
+      unviewables.push_back("PropagateEnsemble");
+
       // Commented out. If this breaks lots of GUI testing uncomment this
       //unviewables.push_back("Write");
       
@@ -38,6 +38,7 @@
 #include "PrinceDormand45.hpp" 
 #include "PrinceDormand78.hpp" 
 #include "AdamsBashforthMoulton.hpp"
+#include "GaussJackson.hpp"
 
 // Ephemeris propagators
 //#ifdef __USE_SPICE__
@@ -99,6 +100,8 @@ Propagator* PropagatorFactory::CreatePropagator(const std::string &ofType,
       return new RungeKuttaFehlberg56(withName);
    if (ofType == "AdamsBashforthMoulton")
       return new AdamsBashforthMoulton(withName);
+   if (ofType == "GaussJackson")
+      return new GaussJackson(withName);
 //   if (ofType == "Cowell")
 //      return new Cowell(withName);
    // Add others here as needed
@@ -130,6 +133,7 @@ PropagatorFactory::PropagatorFactory()
 //      creatables.push_back("RungeKuttaFehlberg56");
       creatables.push_back("RungeKutta56");
       creatables.push_back("AdamsBashforthMoulton");
+      creatables.push_back("GaussJackson");
 //      creatables.push_back("Cowell");
    }
 
@@ -31,6 +31,7 @@
 
 
 #include "DragForce.hpp"
+#include "ParameterIndex.hpp"
 #include "StringUtil.hpp"     // for ToString()
 #include "ODEModelException.hpp"
 #include "MessageInterface.hpp"
@@ -38,6 +39,7 @@
 #include "TimeTypes.hpp"
 #include "FileManager.hpp"    // for flux files
 #include "PropagationStateManager.hpp"
+#include "EnvironmentContext.hpp"
 
 #include <sstream>                 // for <<
 #include <cmath>
@@ -1935,6 +1937,22 @@ Rvector6 DragForce::GetDerivativesForSpacecraft(Spacecraft* sc)
 }
 
 
+//------------------------------------------------------------------------------
+// bool SupportsConcurrentCopies()
+//------------------------------------------------------------------------------
+/**
+ * Drag is as reentrant as its atmosphere model.  The MSISE90 and
+ * Jacchia-Roberts models keep their state in process-wide data, for example.
+ *
+ * @return true if the atmosphere model in use supports concurrent copies
+ */
+//------------------------------------------------------------------------------
+bool DragForce::SupportsConcurrentCopies()
+{
+   return ((atmos != NULL) && atmos->SupportsConcurrentCopies());
+}
+
+
 //------------------------------------------------------------------------------
 // std::string GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
@@ -1968,11 +1986,11 @@ std::string DragForce::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer DragForce::GetParameterID(const std::string &str) const
 {
-   for (int i = PhysicalModelParamCount; i < DragForceParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - PhysicalModelParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("DragForce", PARAMETER_TEXT,
+         PhysicalModelParamCount, DragForceParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
    
    return PhysicalModel::GetParameterID(str);
 }
@@ -3185,16 +3203,17 @@ Real DragForce::GetDensity(Real *state, Real when, Integer count)
       //{
          if (sun && centralBody)
          {
-            // Update the Sun vector
-            Rvector sunV = sun->GetState(when);
-            Rvector cbV  = centralBody->GetState(when);
-                
-            sunLoc[0] = sunV[0];
-            sunLoc[1] = sunV[1];
-            sunLoc[2] = sunV[2];
-            cbLoc[0]  = cbV[0];
-            cbLoc[1]  = cbV[1];
-            cbLoc[2]  = cbV[2];
+            // Update the Sun vector from the geometry shared with the other
+            // environment models at this epoch
+            EnvironmentContext context;
+            EnvironmentContext::GetContext(sun, centralBody, when, context);
+
+            sunLoc[0] = context.sunState[0];
+            sunLoc[1] = context.sunState[1];
+            sunLoc[2] = context.sunState[2];
+            cbLoc[0]  = context.bodyState[0];
+            cbLoc[1]  = context.bodyState[1];
+            cbLoc[2]  = context.bodyState[2];
          }
       //}
 
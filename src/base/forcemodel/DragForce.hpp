@@ -78,6 +78,7 @@ public:
                                        Integer order = 1, 
                                        const Integer id = -1);
    virtual Rvector6     GetDerivativesForSpacecraft(Spacecraft *sc);
+   virtual bool         SupportsConcurrentCopies();
 
    // inherited from GmatBase
    virtual GmatBase*    Clone() const;
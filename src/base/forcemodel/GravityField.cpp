@@ -71,6 +71,7 @@
 #include "RealUtilities.hpp"
 #include "MessageInterface.hpp"
 #include "Rvector.hpp"
+#include "FixedMatrix.hpp"
 #include "TimeTypes.hpp"
 #include "CoordinateConverter.hpp"
 #include "StringUtil.hpp"
@@ -79,6 +80,7 @@
 #include "UtilityException.hpp"
 #include "FileManager.hpp"
 #include <sstream>                 // for <<
+#include <mutex>
 
 //#define DEBUG_GRAVITY_FIELD
 //#define DEBUG_GRAVITY_FIELD_DETAILS
@@ -104,6 +106,9 @@ using namespace GmatMathUtil;
    static bool firstCallFired = false;
 #endif
 
+/// Serializes warnings posted while spacecraft are evaluated in parallel
+static std::mutex messageMutex;
+
 const std::string
 GravityField::PARAMETER_TEXT[GravityFieldParamCount - HarmonicFieldParamCount] =
 {
@@ -169,7 +174,10 @@ GravityField::GravityField(const std::string &name, const std::string &forBodyNa
    orderTruncateReported  (false),
    degreeTruncateReported (false),
    gravityModel           (NULL),
-   j2k                    (NULL)
+   j2k                    (NULL),
+   batchC                 (NULL),
+   batchS                 (NULL),
+   batchGradient          (false)
 {
    objectTypeNames.push_back("GravityField");
    bodyName = forBodyName;
@@ -228,7 +236,10 @@ GravityField::GravityField(const GravityField &gf) :
     frv                    (gf.frv),
     trv                    (gf.trv),
     now                    (gf.now),
-    nowGT                  (gf.nowGT)
+    nowGT                  (gf.nowGT),
+    batchC                 (NULL),
+    batchS                 (NULL),
+    batchGradient          (false)
 {
    objectTypeNames.push_back("GravityField");
    bodyName = gf.bodyName;
@@ -447,6 +458,83 @@ bool GravityField::GetDerivatives(Real * state, Real dt, Integer dvorder,
       }
    #endif
 
+   if (!PrepareDerivatives(state, dt, dvorder, 1))
+      return false;
+   if (!GetSpacecraftDerivatives(state, dt, dvorder, 0, cartesianCount, 0))
+      return false;
+
+   #ifdef DEBUG_FIRST_CALL
+      if (firstCallFired == false)
+      {
+         if (body->GetName() == "Mars")
+         {
+         MessageInterface::ShowMessage(
+            "   GravityField[%s <> %s] --> mu = %lf, origin = %s, [%.10lf %.10lf "
+            "%.10lf %.16lf %.16lf %.16lf]\n",
+            instanceName.c_str(), body->GetName().c_str(), mu,
+            targetCS->GetOriginName().c_str(),
+            deriv[0], deriv[1], deriv[2], deriv[3], deriv[4], deriv[5]);
+         firstCallFired = true;
+         }
+      }
+   #endif
+
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// bool SupportsSpacecraftPartition()
+//------------------------------------------------------------------------------
+/**
+ * The field for each spacecraft depends only on that spacecraft's state once
+ * the epoch data is set, so the work can be split across spacecraft.
+ *
+ * @return true
+ */
+//------------------------------------------------------------------------------
+bool GravityField::SupportsSpacecraftPartition()
+{
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// bool SupportsConcurrentCopies()
+//------------------------------------------------------------------------------
+/**
+ * Each copy has its own workspaces; the coefficient tables shared through the
+ * gravity file cache are only read after loading.
+ *
+ * @return true
+ */
+//------------------------------------------------------------------------------
+bool GravityField::SupportsConcurrentCopies()
+{
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// bool PrepareDerivatives(Real *state, Real dt, Integer dvorder,
+//                         Integer workerCount)
+//------------------------------------------------------------------------------
+/**
+ * Performs the serial part of the derivative calculation: frame rotation,
+ * tides, polar motion, the origin offset, and the STM/A-matrix layout.
+ *
+ * @param state       The state vector
+ * @param dt          Time offset from the current epoch, in seconds
+ * @param dvorder     Order of the derivative
+ * @param workerCount Number of workers that will call
+ *                    GetSpacecraftDerivatives()
+ *
+ * @return true on success, false if the order is not supported
+ */
+//------------------------------------------------------------------------------
+bool GravityField::PrepareDerivatives(Real *state, Real dt, Integer dvorder,
+      Integer workerCount)
+{
    // We may want to do this down the road:
 //   if (fabs(state[0]) + fabs(state[1]) + fabs(state[2]) < minimumDistance)
 //      throw ODEModelException("A harmonic gravity field is being computed "
@@ -479,9 +567,6 @@ bool GravityField::GetDerivatives(Real * state, Real dt, Integer dvorder,
    // are copied into the position derivatives for first order integrators, so
    // when the GravityField is set to work at non-central bodies, the detection
    // will need to happen in initialization.
-   Real satState[6];
-   Integer nOffset;
-
    if (hasPrecisionTime)
    {
       nowGT = epochGT;
@@ -526,227 +611,164 @@ bool GravityField::GetDerivatives(Real * state, Real dt, Integer dvorder,
       {
          throw ODEModelException("GetDerivatives: cartesianCount < stmCount or aMatrixCount\n");
       }
-      Real originacc[3] = { 0.0,0.0,0.0 };  // JPD code
-      Rmatrix33 origingrad (0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0);
-      Rmatrix33 emptyGradient(0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0);
-      Rmatrix33 gradnew (0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0);
+
+      for (Integer i = 0; i < 3; ++i)
+         originAcc[i] = 0.0;
+      for (Integer i = 0; i < 3; ++i)
+         for (Integer j = 0; j < 3; ++j)
+            originGrad(i,j) = 0.0;
       if (body != forceOrigin)
       {
          Real originstate[6] = { 0.0,0.0,0.0,0.0,0.0,0.0 };
-         Calculate(dt,originstate,originacc,origingrad);
+         Calculate(dt,originstate,originAcc,originGrad);
 #ifdef DEBUG_DERIVATIVES
-      MessageInterface::ShowMessage("---------> origingrad = %s\n", origingrad.ToString().c_str());
+      MessageInterface::ShowMessage("---------> origingrad = %s\n", originGrad.ToString().c_str());
 #endif
       }
 
+      // Evaluate the epoch dependent data once for all of the spacecraft
+      PrepareBatch(dt, cartesianCount, &state[cartesianStart], stateSize,
+            workerCount);
 
-		Integer i6 = (fillSTM ? stmStart : aMatrixStart);
+      // Locate each spacecraft's STM and A-matrix; their sizes can differ
+      stmOffset.assign(cartesianCount, -1);
+      aMatrixOffset.assign(cartesianCount, -1);
+      matrixRows.assign(cartesianCount, 0);
+      Integer i6 = (fillSTM ? stmStart : aMatrixStart);
       for (Integer n = 0; n < cartesianCount; ++n)
       {
-         nOffset = cartesianStart + n * stateSize;
-         for (Integer i = 0; i < 6; ++i)
-            satState[i] = state[i+nOffset];
-
-         Real accnew[3];  // JPD code
-         gradnew = emptyGradient;
-         Calculate(dt,satState,accnew,gradnew);
-         if (body != forceOrigin)
+         // @todo Add the use of the GetAssociateIndex() method here to get index into state array
+         //       (See assumption 1, above)
+         if ((fillSTM && (n <= stmCount)) || (fillAMatrix && (n <= aMatrixCount)))
          {
-            for (Integer i=0;  i<=2;  ++i)
-               accnew[i] -= originacc[i];
-            gradnew -= origingrad;
-#ifdef DEBUG_DERIVATIVES
-      MessageInterface::ShowMessage("---------> body not equal to forceOrigin\n");
-#endif
+            Spacecraft* sc = (Spacecraft*)scObjs[n];
+            stmRowCount = sc->GetIntegerParameter("FullSTMRowCount");
+            matrixRows[n] = stmRowCount;
          }
-#ifdef DEBUG_DERIVATIVES
-      MessageInterface::ShowMessage("---------> gradnew (%d) = %s\n", n, gradnew.ToString().c_str());
-#endif
-         
-         // Fill Derivatives
-         switch (dvorder)
+         if (fillSTM && (n <= stmCount))
          {
-            case 1:
-               deriv[0+nOffset] = satState[3];
-               deriv[1+nOffset] = satState[4];
-               deriv[2+nOffset] = satState[5];
-               deriv[3+nOffset] = accnew[0];
-               deriv[4+nOffset] = accnew[1];
-               deriv[5+nOffset] = accnew[2];
-               break;
-
-            case 2:
-               deriv[0+nOffset] = accnew[0];
-               deriv[1+nOffset] = accnew[1];
-               deriv[2+nOffset] = accnew[2];
-               deriv[3+nOffset] = 0.0;
-               deriv[4+nOffset] = 0.0;
-               deriv[5+nOffset] = 0.0;
-               break;
+            stmOffset[n] = i6;
+            i6 += matrixRows[n] * matrixRows[n];
+         }
+         if (fillAMatrix && (n <= aMatrixCount))
+         {
+            aMatrixOffset[n] = i6;
+            i6 += matrixRows[n] * matrixRows[n];
          }
+      }
+   }
 
-         for (Integer index = 0; index < 6; ++index)                                                        // made changes by TUAN NGUYEN
-         {                                                                                                  // made changes by TUAN NGUYEN
+   return true;
+}
 
-            // This message needs to show up when the derivative is NaN                                     // made changes by TUAN NGUYEN
-            if (GmatMathUtil::IsNaN(deriv[nOffset + index]))                                                // made changes by TUAN NGUYEN
-            {                                                                                               // made changes by TUAN NGUYEN
-               std::string derivName = "acceleration";                                                      // made changes by TUAN NGUYEN
-               if ((dvorder == 1)&& (index < 3))                                                            // made changes by TUAN NGUYEN
-                  derivName = "velocity";                                                                   // made changes by TUAN NGUYEN
 
-               MessageInterface::ShowMessage("The force model \"%s\" "                                      // made changes by TUAN NGUYEN
-                  "returns a disallowed value for spacecraft \"%s\". "                                      // made changes by TUAN NGUYEN
-                  "The %s value is %lf for the position vector "                                            // made changes by TUAN NGUYEN
-                  "[%.12lf  %.12lf  %.12lf]km at epoch %.12lf A1Mjd.\n",                                    // made changes by TUAN NGUYEN
-                  GetTypeName().c_str(), scObjs[n]->GetName().c_str(),                                      // made changes by TUAN NGUYEN
-                  derivName.c_str(), deriv[nOffset + index],                                                // made changes by TUAN NGUYEN
-                  satState[0], satState[1], satState[2], (hasPrecisionTime ? epochGT.GetMjd() : epoch));    // made changes by TUAN NGUYEN
-            }                                                                                               // made changes by TUAN NGUYEN
-         }                                                                                                  // made changes by TUAN NGUYEN
+//------------------------------------------------------------------------------
+// bool GetSpacecraftDerivatives(Real *state, Real dt, Integer dvorder,
+//                               Integer first, Integer last, Integer worker)
+//------------------------------------------------------------------------------
+/**
+ * Fills the derivatives of spacecraft first through last-1, using the data
+ * set up in PrepareDerivatives().
+ *
+ * Only the derivative elements of the listed spacecraft are written, and all
+ * scratch data is selected by worker, so calls with disjoint ranges and
+ * different workers can run at the same time.
+ *
+ * @param state   The state vector
+ * @param dt      Time offset from the current epoch, in seconds
+ * @param dvorder Order of the derivative
+ * @param first   Index of the first spacecraft
+ * @param last    One past the index of the last spacecraft
+ * @param worker  Index of the calling worker
+ *
+ * @return true on success
+ */
+//------------------------------------------------------------------------------
+bool GravityField::GetSpacecraftDerivatives(Real *state, Real /*dt*/,
+      Integer dvorder, Integer first, Integer last, Integer worker)
+{
+   if (!(fillCartesian || fillAMatrix || fillSTM))
+      return true;
+
+   Real satState[6];
+   Integer nOffset;
+   Rmatrix33 gradnew;
 
+   for (Integer n = first; n < last; ++n)
+   {
+      nOffset = cartesianStart + n * stateSize;
+      for (Integer i = 0; i < 6; ++i)
+         satState[i] = state[i+nOffset];
 
+      Real accnew[3];  // JPD code
+      EvaluateBatchMember(n, accnew, gradnew, worker);
+      if (body != forceOrigin)
+      {
+         for (Integer i=0;  i<=2;  ++i)
+            accnew[i] -= originAcc[i];
+         gradnew -= originGrad;
 #ifdef DEBUG_DERIVATIVES
-         for (Integer ii = 0 + nOffset; ii < 6+nOffset; ii++)
-                     MessageInterface::ShowMessage("------ deriv[%d] = %12.10f\n", ii, deriv[ii]);
+      MessageInterface::ShowMessage("---------> body not equal to forceOrigin\n");
 #endif
-         if (fillSTM)
-         {
-            Integer element;
-            // @todo Add the use of the GetAssociateIndex() method here to get index into state array
-            //       (See assumption 1, above)
-            if (n <= stmCount)
-            {
-               //Integer ix, i6 = stmStart + n * stmRowCount * stmRowCount;         // made changes by TUAN NGUYEN
-					Integer ix;                                                          // made changes by TUAN NGUYEN
-
-					// Get spacecraft object                                             // made changes by TUAN NGUYEN
-					Spacecraft* sc = (Spacecraft*)scObjs[n];                             // made changes by TUAN NGUYEN
-
-					//Create aTilde                                                      // made changes by TUAN NGUYEN
-					stmRowCount = sc->GetIntegerParameter("FullSTMRowCount");    // made changes by TUAN NGUYEN
-					Integer stmSize = stmRowCount * stmRowCount;                         // made changes by TUAN NGUYEN
-					Real *aTilde;                                                        // made changes by TUAN NGUYEN
-					aTilde = new Real[stmSize];                                          // made changes by TUAN NGUYEN
-               for (Integer i = 0; i < stmRowCount; ++i)
-               {
-                  ix = i * stmRowCount;
-                  for (Integer j = 0; j < stmRowCount; ++j)
-                     aTilde[ix+j] = 0.0;
-               }
-
-					// Calculate A-tilde
-					// fill in the lower left quadrant of the upper 6x6 with the calculated gradient values
-               ix = stmRowCount * 3;
-               aTilde[ix]   = gradnew(0,0);
-               aTilde[ix+1] = gradnew(0,1);
-               aTilde[ix+2] = gradnew(0,2);
-               ix = stmRowCount * 4;
-               aTilde[ix]   = gradnew(1,0);
-               aTilde[ix+1] = gradnew(1,1);
-               aTilde[ix+2] = gradnew(1,2);
-               ix = stmRowCount * 5;
-               aTilde[ix]   = gradnew(2,0);
-               aTilde[ix+1] = gradnew(2,1);
-               aTilde[ix+2] = gradnew(2,2);
-
-               for (Integer j = 0; j < stmRowCount; j++)
-               {
-                  for (Integer k = 0; k < stmRowCount; k++)
-                  {
-                     element = j * stmRowCount + k;
+      }
 #ifdef DEBUG_DERIVATIVES
-                     MessageInterface::ShowMessage("------ deriv[%d] = %12.10f\n", (i6+element), aTilde[element]);
+      MessageInterface::ShowMessage("---------> gradnew (%d) = %s\n", n, gradnew.ToString().c_str());
 #endif
-                     deriv[i6+element] = aTilde[element];
-                  }
-               }
+      
+      // Fill Derivatives
+      switch (dvorder)
+      {
+         case 1:
+            deriv[0+nOffset] = satState[3];
+            deriv[1+nOffset] = satState[4];
+            deriv[2+nOffset] = satState[5];
+            deriv[3+nOffset] = accnew[0];
+            deriv[4+nOffset] = accnew[1];
+            deriv[5+nOffset] = accnew[2];
+            break;
+
+         case 2:
+            deriv[0+nOffset] = accnew[0];
+            deriv[1+nOffset] = accnew[1];
+            deriv[2+nOffset] = accnew[2];
+            deriv[3+nOffset] = 0.0;
+            deriv[4+nOffset] = 0.0;
+            deriv[5+nOffset] = 0.0;
+            break;
+      }
 
-					delete[] aTilde;                             // made changes by TUAN NGUYEN
-					i6 = i6 + stmSize;                           // made changes by TUAN NGUYEN
-            }
+      for (Integer index = 0; index < 6; ++index)                                                        // made changes by TUAN NGUYEN
+      {                                                                                                  // made changes by TUAN NGUYEN
 
-			   //delete [] aTilde;                             // made changes by TUAN NGUYEN
-         }
+         // This message needs to show up when the derivative is NaN                                     // made changes by TUAN NGUYEN
+         if (GmatMathUtil::IsNaN(deriv[nOffset + index]))                                                // made changes by TUAN NGUYEN
+         {                                                                                               // made changes by TUAN NGUYEN
+            std::lock_guard<std::mutex> lock(messageMutex);
+            std::string derivName = "acceleration";                                                      // made changes by TUAN NGUYEN
+            if ((dvorder == 1)&& (index < 3))                                                            // made changes by TUAN NGUYEN
+               derivName = "velocity";                                                                   // made changes by TUAN NGUYEN
+
+            MessageInterface::ShowMessage("The force model \"%s\" "                                      // made changes by TUAN NGUYEN
+               "returns a disallowed value for spacecraft \"%s\". "                                      // made changes by TUAN NGUYEN
+               "The %s value is %lf for the position vector "                                            // made changes by TUAN NGUYEN
+               "[%.12lf  %.12lf  %.12lf]km at epoch %.12lf A1Mjd.\n",                                    // made changes by TUAN NGUYEN
+               GetTypeName().c_str(), scObjs[n]->GetName().c_str(),                                      // made changes by TUAN NGUYEN
+               derivName.c_str(), deriv[nOffset + index],                                                // made changes by TUAN NGUYEN
+               satState[0], satState[1], satState[2], (hasPrecisionTime ? epochGT.GetMjd() : epoch));    // made changes by TUAN NGUYEN
+         }                                                                                               // made changes by TUAN NGUYEN
+      }                                                                                                  // made changes by TUAN NGUYEN
 
-         if (fillAMatrix)
-         {
-            Integer element;
-            // @todo Add the use of the GetAssociateIndex() method here to get index into state array
-            //       (See assumption 1, above)
-            if (n <= aMatrixCount)
-            {
-               // Integer ix, i6 = aMatrixStart + n * stmRowCount * stmRowCount;    // made changes by TUAN NGUYEN
-					Integer ix;                                                          // made changes by TUAN NGUYEN
-
-					// Get spacecraft object                                             // made changes by TUAN NGUYEN
-					Spacecraft* sc = (Spacecraft*)scObjs[n];                             // made changes by TUAN NGUYEN
-
-					//Create aTilde                                                      // made changes by TUAN NGUYEN
-					stmRowCount = sc->GetIntegerParameter("FullSTMRowCount");    // made changes by TUAN NGUYEN
-					Integer stmSize = stmRowCount * stmRowCount;                         // made changes by TUAN NGUYEN
-					Real *aTilde;                                                        // made changes by TUAN NGUYEN
-					aTilde = new Real[stmSize];                                          // made changes by TUAN NGUYEN
-               for (Integer i = 0; i < stmRowCount; ++i)
-               {
-                  ix = i * stmRowCount;
-                  for (Integer j = 0; j < stmRowCount; ++j)
-                     aTilde[ix+j] = 0.0;
-               }
 
-					// Calculate A-tilde
-					// fill in the lower left quadrant of the upper 6x6 with the calculated gradient values
-               ix = stmRowCount * 3;
-               aTilde[ix]   = gradnew(0,0);
-               aTilde[ix+1] = gradnew(0,1);
-               aTilde[ix+2] = gradnew(0,2);
-               ix = stmRowCount * 4;
-               aTilde[ix]   = gradnew(1,0);
-               aTilde[ix+1] = gradnew(1,1);
-               aTilde[ix+2] = gradnew(1,2);
-               ix = stmRowCount * 5;
-               aTilde[ix]   = gradnew(2,0);
-               aTilde[ix+1] = gradnew(2,1);
-               aTilde[ix+2] = gradnew(2,2);
-
-               for (Integer j = 0; j < stmRowCount; j++)
-               {
-                  for (Integer k = 0; k < stmRowCount; k++)
-                  {
-                     element = j * stmRowCount + k;
 #ifdef DEBUG_DERIVATIVES
-                     MessageInterface::ShowMessage("------ deriv[%d] = %12.10f\n", (i6+element), aTilde[element]);
+      for (Integer ii = 0 + nOffset; ii < 6+nOffset; ii++)
+                  MessageInterface::ShowMessage("------ deriv[%d] = %12.10f\n", ii, deriv[ii]);
 #endif
-                     deriv[i6+element] = aTilde[element];
-                  }
-               }
-
-					delete[] aTilde;                               // made changes by TUAN NGUYEN
-					i6 = i6 + stmSize;                             // made changes by TUAN NGUYEN
-				}
-
-			   //delete [] aTilde;                               // made changes by TUAN NGUYEN
-         }
-
-      }  // end for
+      if (stmOffset[n] >= 0)
+         FillMatrixDerivatives(stmOffset[n], matrixRows[n], gradnew);
+      if (aMatrixOffset[n] >= 0)
+         FillMatrixDerivatives(aMatrixOffset[n], matrixRows[n], gradnew);
    }
 
-   #ifdef DEBUG_FIRST_CALL
-      if (firstCallFired == false)
-      {
-         if (body->GetName() == "Mars")
-         {
-         MessageInterface::ShowMessage(
-            "   GravityField[%s <> %s] --> mu = %lf, origin = %s, [%.10lf %.10lf "
-            "%.10lf %.16lf %.16lf %.16lf]\n",
-            instanceName.c_str(), body->GetName().c_str(), mu,
-            targetCS->GetOriginName().c_str(),
-            deriv[0], deriv[1], deriv[2], deriv[3], deriv[4], deriv[5]);
-         firstCallFired = true;
-         }
-      }
-   #endif
-
    return true;
 }
 
@@ -1418,12 +1440,61 @@ void GravityField::GetTideData (Real dt, const std::string bodyname,
 //------------------------------------------------------------------------------
 void GravityField::Calculate (Real dt, Real state[6], 
                               Real acc[3], Rmatrix33& grad)
+{
+   CalculateBatch(dt, 1, state, acc, &grad);
+}
+
+
+//------------------------------------------------------------------------------
+// void CalculateBatch(Real dt, Integer count, Real *states, Real *acc,
+//                     Rmatrix33 *grad)
+//------------------------------------------------------------------------------
+/**
+ * Computes the field for count states (6 elements each) at the same epoch.
+ *
+ * @param dt     Time offset from the current epoch, in seconds
+ * @param count  Number of states
+ * @param states The input states, 6*count elements
+ * @param acc    The accelerations, 3*count elements
+ * @param grad   The acceleration gradients, count matrices
+ */
+//------------------------------------------------------------------------------
+void GravityField::CalculateBatch (Real dt, Integer count, Real *states,
+                                   Real *acc, Rmatrix33 *grad)
+{
+   PrepareBatch(dt, count, states, 6, 1);
+   for (Integer k = 0; k < count; ++k)
+      EvaluateBatchMember(k, &acc[3*k], grad[k], 0);
+}
+
+
+//------------------------------------------------------------------------------
+// void PrepareBatch(Real dt, Integer count, Real *states, Integer stride,
+//                   Integer workerCount)
+//------------------------------------------------------------------------------
+/**
+ * Sets up a batch of states for evaluation with EvaluateBatchMember().
+ *
+ * The epoch dependent data (frame rotation, tide body positions, polar
+ * motion, and the tide corrections to the coefficients) are computed once for
+ * the whole batch, and the states are converted to the body-fixed frame.
+ *
+ * @param dt          Time offset from the current epoch, in seconds
+ * @param count       Number of states
+ * @param states      The input states; state k starts at states[k*stride]
+ * @param stride      Distance between consecutive states
+ * @param workerCount Number of workers that will evaluate the batch
+ */
+//------------------------------------------------------------------------------
+void GravityField::PrepareBatch (Real dt, Integer count, Real *states,
+                                 Integer stride, Integer workerCount)
 {
    #ifdef DEBUG_CALCULATE
       MessageInterface::ShowMessage(
-            "Entering Calculate with dt = %12.10f, state = %12.10f  %12.10f  %12.10f  %12.10f  %12.10f  %12.10f\n",
-            dt, state[0], state[1], state[2], state[3], state[4], state[5]);
-      MessageInterface::ShowMessage("   acc = %12.10f  %12.10f  %12.10f\n", acc[0], acc[1], acc[2]);
+            "Entering PrepareBatch with dt = %12.10f, count = %d, state[0] = "
+            "%12.10f  %12.10f  %12.10f  %12.10f  %12.10f  %12.10f\n",
+            dt, count, states[0], states[1], states[2], states[3], states[4],
+            states[5]);
    #endif
    
    Real jday, now;
@@ -1444,31 +1515,37 @@ void GravityField::Calculate (Real dt, Real state[6],
       nowGT = now;
    }
 
+   batchFixedPos.resize(count * 3);
+
    // convert to body fixed coordinate system
    Real tmpState[6];
 //   CoordinateConverter cc; - move back to class, for performance
-   if (hasPrecisionTime)
-      cc.Convert(nowGT, state, inputCS, tmpState, fixedCS);  // which CSs to use here???
-   else
-      cc.Convert(now, state, inputCS, tmpState, fixedCS);  // which CSs to use here???
+   for (Integer k = 0; k < count; ++k)
+   {
+      if (hasPrecisionTime)
+         cc.Convert(nowGT, &states[stride*k], inputCS, tmpState, fixedCS);  // which CSs to use here???
+      else
+         cc.Convert(now, &states[stride*k], inputCS, tmpState, fixedCS);  // which CSs to use here???
 
-   #ifdef DEBUG_CALCULATE
-      MessageInterface::ShowMessage(
-            "After Convert, jday = %s, now = %s, and tmpState = %12.10f  %12.10f  %12.10f  %12.10f  %12.10f  %12.10f\n",
-            jdayGT.ToString().c_str(), nowGT.ToString().c_str(), tmpState[0], tmpState[1], tmpState[2], tmpState[3], tmpState[4], tmpState[5]);
-   #endif
-   Rmatrix33 rotMatrix = cc.GetLastRotationMatrix();
+      for (Integer i = 0; i < 3; ++i)
+         batchFixedPos[3*k+i] = tmpState[i];
+
+      #ifdef DEBUG_CALCULATE
+         MessageInterface::ShowMessage(
+               "After Convert, jday = %s, now = %s, and tmpState = %12.10f  %12.10f  %12.10f  %12.10f  %12.10f  %12.10f\n",
+               jdayGT.ToString().c_str(), nowGT.ToString().c_str(), tmpState[0], tmpState[1], tmpState[2], tmpState[3], tmpState[4], tmpState[5]);
+      #endif
+   }
+   // All states share the epoch, so they share the rotation as well
+   batchRotation = cc.GetLastRotationMatrix();
    #ifdef DEBUG_DERIVATIVES
-      MessageInterface::ShowMessage("---->>>> rotMatrix = %s\n", rotMatrix.ToString().c_str());
+      MessageInterface::ShowMessage("---->>>> rotMatrix = %s\n", batchRotation.ToString().c_str());
    #endif
    // tide body pos and mu
    Real sunpos[3]   = {0.0,0.0,0.0};
    Real otherpos[3] = {0.0,0.0,0.0};
    Real sunmukm     = 0.0;
    Real othermukm   = 0.0; 
-   // Acceleration
-   Real      rotacc[3];
-   Rmatrix33 rotgrad;
    Integer   tideLevel = -1;
    if (gravityModel != NULL)
       {
@@ -1512,40 +1589,116 @@ void GravityField::Calculate (Real dt, Real state[6],
       eop->GetPolarMotionAndLod(utcmjd, xp, yp, lod);
    }
 
-   bool computeMatrix = fillAMatrix || fillSTM;
+   batchGradient = fillAMatrix || fillSTM;
+   Real batchJday = (hasPrecisionTime ? jdayGT.GetMjd() : jday);
+   gravityModel->PrepareFullField(batchJday, degree, order, tideLevel,
+         sunpos, sunmukm, otherpos, othermukm, xp, yp,
+         batchGradient, stmLimit, batchC, batchS);
+
+   // Each worker needs its own kernel scratch space
+   if (workerCount < 1)
+      workerCount = 1;
+   Integer workspaceSize = gravityModel->GetWorkspaceSize();
+   if ((Integer)fieldWorkspace.size() < workerCount)
+      fieldWorkspace.resize(workerCount);
+   if ((Integer)fieldGradient.size() < workerCount)
+      fieldGradient.resize(workerCount);
+   for (Integer w = 0; w < workerCount; ++w)
+   {
+      if ((Integer)fieldWorkspace[w].size() != workspaceSize)
+      {
+         fieldWorkspace[w].resize(workspaceSize);
+         gravityModel->InitializeWorkspace(&fieldWorkspace[w][0]);
+      }
+   }
+}
 
-   if (hasPrecisionTime)
-      gravityModel->CalculateFullField(jdayGT.GetMjd(), tmpState, degree, order, tideLevel,
-         sunpos, sunmukm, otherpos, othermukm,
-         xp, yp, computeMatrix, stmLimit, rotacc, rotgrad);
-   else
-      gravityModel->CalculateFullField (jday, tmpState, degree, order, tideLevel, 
-         sunpos, sunmukm, otherpos, othermukm,
-         xp, yp, computeMatrix, stmLimit, rotacc, rotgrad);
 
+//------------------------------------------------------------------------------
+// void EvaluateBatchMember(Integer k, Real acc[3], Rmatrix33 &grad,
+//                          Integer worker)
+//------------------------------------------------------------------------------
+/**
+ * Computes the field for state k of the batch set up by PrepareBatch().
+ *
+ * This method only reads the batch data and writes worker's scratch space, so
+ * different workers may evaluate different states concurrently.
+ *
+ * @param k      Index of the state in the batch
+ * @param acc    The acceleration in the input frame
+ * @param grad   The acceleration gradient in the input frame
+ * @param worker Index of the calling worker
+ */
+//------------------------------------------------------------------------------
+void GravityField::EvaluateBatchMember (Integer k, Real acc[3],
+                                        Rmatrix33& grad, Integer worker)
+{
+   // Acceleration
+   Real      rotacc[3];
+   Rmatrix33 &rotgrad = fieldGradient[worker];
+   gravityModel->EvaluateFullField(batchC, batchS, &batchFixedPos[3*k],
+         degree, order, batchGradient, stmLimit, rotacc, rotgrad,
+         &fieldWorkspace[worker][0]);
    #ifdef DEBUG_DERIVATIVES
-      MessageInterface::ShowMessage("after CalculateFullField, rotgrad = %s\n", rotgrad.ToString().c_str());
+      MessageInterface::ShowMessage("after EvaluateFullField, rotgrad = %s\n", rotgrad.ToString().c_str());
    #endif
-   /*
-    MessageInterface::ShowMessage
-    ("HarmonicField::Calculate pos= %20.14f %20.14f %20.14f\n",
-    tmpState[0],tmpState[1],tmpState[2]);
-    MessageInterface::ShowMessage
-    ("HarmonicField::Calculate grad= %20.14e %20.14e %20.14e\n",
-    rotgrad(0,0),rotgrad(0,1),rotgrad(0,2));
-    MessageInterface::ShowMessage
-    ("HarmonicField::Calculate grad= %20.14e %20.14e %20.14e\n",
-    rotgrad(1,0),rotgrad(1,1),rotgrad(1,2));
-    MessageInterface::ShowMessage
-    ("HarmonicField::Calculate grad= %20.14e %20.14e %20.14e\n",
-    rotgrad(2,0),rotgrad(2,1),rotgrad(2,2));
-    */
-   
+
    // Convert back to target CS
-   InverseRotate (rotMatrix,rotacc,acc);
-   grad = rotMatrix.Transpose() * rotgrad * rotMatrix;
+   InverseRotate (batchRotation,rotacc,acc);
+   // The rotation is done in fixed-size matrices so that no temporaries are
+   // allocated for each spacecraft
+   if (batchGradient)
+   {
+      FixedMatrix33 rot(batchRotation.GetDataVector());
+      FixedMatrix33 fixedGrad(rotgrad.GetDataVector());
+      FixedMatrix33 result = rot.Transpose() * fixedGrad * rot;
+      for (Integer i = 0; i < 3; ++i)
+         for (Integer j = 0; j < 3; ++j)
+            grad(i,j) = result(i,j);
+   }
+   else
+   {
+      for (Integer i = 0; i < 3; ++i)
+         for (Integer j = 0; j < 3; ++j)
+            grad(i,j) = 0.0;
+   }
+   #ifdef DEBUG_DERIVATIVES
+      MessageInterface::ShowMessage("at end of EvaluateBatchMember, after rotation, grad = %s\n", grad.ToString().c_str());
+   #endif
+}
+
+
+//------------------------------------------------------------------------------
+// void FillMatrixDerivatives(Integer offset, Integer rows,
+//                            const Rmatrix33 &grad)
+//------------------------------------------------------------------------------
+/**
+ * Writes the A-tilde matrix for one spacecraft into the derivative vector:
+ * the gradient fills the lower left quadrant of the upper 6x6 block, and all
+ * other elements are zero.
+ *
+ * @param offset Index of the first matrix element in the derivative vector
+ * @param rows   Number of rows (and columns) of the matrix
+ * @param grad   The acceleration gradient
+ */
+//------------------------------------------------------------------------------
+void GravityField::FillMatrixDerivatives (Integer offset, Integer rows,
+                                          const Rmatrix33& grad)
+{
+   Real *aTilde = &deriv[offset];
+   for (Integer i = 0; i < rows * rows; ++i)
+      aTilde[i] = 0.0;
+
+   for (Integer i = 0; i < 3; ++i)
+   {
+      Integer ix = rows * (i + 3);
+      aTilde[ix]   = grad(i,0);
+      aTilde[ix+1] = grad(i,1);
+      aTilde[ix+2] = grad(i,2);
+   }
    #ifdef DEBUG_DERIVATIVES
-      MessageInterface::ShowMessage("at end of Calculate, after rotation, grad = %s\n", grad.ToString().c_str());
+      for (Integer element = 0; element < rows * rows; ++element)
+         MessageInterface::ShowMessage("------ deriv[%d] = %12.10f\n", (offset+element), aTilde[element]);
    #endif
 }
 //------------------------------------------------------------------------------
@@ -1678,7 +1831,11 @@ HarmonicGravity* GravityField::GetHarmonicGravity
    const bool& loadCoefficients)
    {
    HarmonicGravity* hg = new HarmonicGravity (filename,tideFilename,radius,mukm,bodyname,loadCoefficients);
-   if (hg->GetNN() == 0) return NULL;
+   if (hg->GetNN() == 0)
+      {
+      delete hg;
+      return NULL;
+      }
    return hg;
    }
 //------------------------------------------------------------------------------
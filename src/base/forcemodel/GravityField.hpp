@@ -109,6 +109,15 @@ public:
                                   const Integer id = -1);
    virtual Rvector6 GetDerivativesForSpacecraft(Spacecraft *sc);
 
+   // Spacecraft-partitioned evaluation, used by the ODEModel's parallel mode
+   virtual bool    SupportsSpacecraftPartition();
+   virtual bool    PrepareDerivatives(Real *state, Real dt, Integer order,
+                                      Integer workerCount);
+   virtual bool    GetSpacecraftDerivatives(Real *state, Real dt,
+                                            Integer order, Integer first,
+                                            Integer last, Integer worker);
+   virtual bool    SupportsConcurrentCopies();
+
    virtual bool    GetBodyAndMu(std::string &itsName, Real &itsMu);
 
    // inherited from GmatBase
@@ -238,11 +247,44 @@ protected:
    CoordinateConverter cc;
    CoordinateSystem    *j2k;
 
+   // Batched evaluation: epoch dependent data set by PrepareBatch() and read,
+   // one state at a time, by EvaluateBatchMember()
+   /// Body-fixed positions of the states in the batch
+   RealArray              batchFixedPos;
+   /// Rotation from the input frame to the body-fixed frame
+   Rmatrix33              batchRotation;
+   /// Coefficients (including tides) used for the batch
+   const Real             *batchC;
+   const Real             *batchS;
+   /// Flag indicating that gradients are computed for the batch
+   bool                   batchGradient;
+   /// Field kernel scratch space, one per worker
+   std::vector<RealArray> fieldWorkspace;
+   /// Body-fixed gradient scratch matrix, one per worker
+   std::vector<Rmatrix33> fieldGradient;
+
+   /// Acceleration and gradient at the force origin, when it is not the body
+   Real                   originAcc[3];
+   Rmatrix33              originGrad;
+   /// Derivative vector index of each spacecraft's STM and A-matrix (or -1)
+   IntegerArray           stmOffset;
+   IntegerArray           aMatrixOffset;
+   /// Row count of each spacecraft's STM and A-matrix
+   IntegerArray           matrixRows;
+
    //  JPD added these ...............
    void GetTideData (Real dt, const std::string bodyname, 
       Real pos[3], Real& mukm);
    void Calculate (Real dt, Real state[6],
       Real force[3], Rmatrix33& grad);
+   void CalculateBatch (Real dt, Integer count, Real *states,
+      Real *force, Rmatrix33 *grad);
+   void PrepareBatch (Real dt, Integer count, Real *states, Integer stride,
+      Integer workerCount);
+   void EvaluateBatchMember (Integer k, Real force[3], Rmatrix33& grad,
+      Integer worker);
+   void FillMatrixDerivatives (Integer offset, Integer rows,
+      const Rmatrix33& grad);
    void InverseRotate(Rmatrix33& rot, const Real in[3], Real out[3]);
    
 };
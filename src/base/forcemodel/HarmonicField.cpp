@@ -60,6 +60,7 @@
 // **************************************************************************
 
 #include "HarmonicField.hpp"
+#include "ParameterIndex.hpp"
 
 #include "GravityBase.hpp"
 #include "ODEModelException.hpp"
@@ -517,11 +518,11 @@ Integer HarmonicField::GetParameterID(const std::string &str) const
    if (useStr == "Model")
       useStr = "PotentialFile";
  
-   for (Integer i = GravityBaseParamCount; i < HarmonicFieldParamCount; i++)
-   {
-      if (useStr == PARAMETER_TEXT[i - GravityBaseParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("HarmonicField", PARAMETER_TEXT,
+         GravityBaseParamCount, HarmonicFieldParamCount);
+   Integer id = parameterIndex.Find(useStr);
+   if (id != -1)
+      return id;
    return GravityBase::GetParameterID(str);
 }
 
@@ -61,7 +61,9 @@
 // ***************************************************************************
 
 #include "ODEModel.hpp"
+#include "ParameterIndex.hpp"
 #include "MessageInterface.hpp"
+#include "WorkerPool.hpp"
 #include "PropagationStateManager.hpp"
 #include "TimeTypes.hpp"
 
@@ -164,7 +166,9 @@ ODEModel::PARAMETER_TEXT[ODEModelParamCount - PhysicalModelParamCount] =
    "ShapeFileName",
    "BodyDensity",
 
-   "UserDefined"
+   "UserDefined",
+
+   "ThreadCount"
 };
 
 
@@ -194,6 +198,8 @@ ODEModel::PARAMETER_TYPE[ODEModelParamCount - PhysicalModelParamCount] =
 
    // plugin forces in the style of the solar sail plugin
    Gmat::OBJECTARRAY_TYPE,  // "UserDefined",
+
+   Gmat::INTEGER_TYPE,      // "ThreadCount",
 };
 
 
@@ -294,7 +300,9 @@ ODEModel::ODEModel(const std::string &modelName, const std::string typeName) :
    j2kBody           (NULL),
    transientCount    (0),
    finiteDifferencingTimeJac (false),
-   nonAnalyticTimeDerivs (NULL)
+   nonAnalyticTimeDerivs (NULL),
+   threadCount       (1),
+   workerPool        (NULL)
 {
    #ifdef DEBUG_ODEMODEL
       MessageInterface::ShowMessage("ODEModel default construction <'%s',%p>\n",
@@ -342,6 +350,9 @@ ODEModel::~ODEModel()
 
    if (nonAnalyticTimeDerivs)
       delete [] nonAnalyticTimeDerivs;
+
+   if (workerPool)
+      delete workerPool;
    
    // Delete the owned objects
    ClearForceList();
@@ -399,7 +410,9 @@ ODEModel::ODEModel(const ODEModel& fdf) :
    j2kBody                    (fdf.j2kBody),
    transientCount             (fdf.transientCount),
    finiteDifferencingTimeJac  (fdf.finiteDifferencingTimeJac),
-   nonAnalyticTimeDerivs      (NULL)
+   nonAnalyticTimeDerivs      (NULL),
+   threadCount                (fdf.threadCount),
+   workerPool                 (NULL)
 {
    #ifdef DEBUG_ODEMODEL
    MessageInterface::ShowMessage("ODEModel copy constructor (from <'%s',%p> to <'%s',%p>) entered\n", fdf.GetName().c_str(), &fdf, GetName().c_str(), &(*this));
@@ -534,6 +547,13 @@ ODEModel& ODEModel::operator=(const ODEModel& fdf)
 
    finiteDifferencingTimeJac = fdf.finiteDifferencingTimeJac;
 
+   threadCount         = fdf.threadCount;
+   if (workerPool)
+   {
+      delete workerPool;
+      workerPool = NULL;
+   }
+
    // Clear owned objects before clone
    ClearForceList();
    ClearInternalCoordinateSystems();
@@ -3064,6 +3084,10 @@ bool ODEModel::GetDerivatives(Real * state, Real dt, Integer order,
    PrepareDerivativeArray();
    const Real* ddt;
 
+   // Workers for the parallel mode are built on first use
+   if ((threadCount != 1) && (cartesianCount > 1) && (workerPool == NULL))
+      workerPool = new WorkerPool(threadCount);
+
    #ifdef DEBUG_ODEMODEL_EXE
       MessageInterface::ShowMessage("Looping through %d PhysicalModels\n",
             forceList.size());
@@ -3090,7 +3114,13 @@ bool ODEModel::GetDerivatives(Real * state, Real dt, Integer order,
       #endif
 
       ddt = (*i)->GetDerivativeArray();
-      if (!(*i)->GetDerivatives(state, dt, order))
+      bool derivativesSet;
+      if ((workerPool != NULL) && (cartesianCount > 1) &&
+          (*i)->SupportsSpacecraftPartition())
+         derivativesSet = GetPartitionedDerivatives(*i, state, dt, order);
+      else
+         derivativesSet = (*i)->GetDerivatives(state, dt, order);
+      if (!derivativesSet)
       {
          #ifdef DEBUG_ODEMODEL_EXE
             MessageInterface::ShowMessage("Derivative %s failed\n",
@@ -3312,6 +3342,52 @@ bool ODEModel::GetDerivatives(Real * state, Real dt, Integer order,
 }
 
 
+//------------------------------------------------------------------------------
+// bool GetPartitionedDerivatives(PhysicalModel *pm, Real *state, Real dt,
+//       Integer order)
+//------------------------------------------------------------------------------
+/**
+ * Computes the derivatives for one force, splitting the spacecraft into
+ * contiguous ranges that are evaluated by the worker pool.
+ *
+ * Each spacecraft is evaluated by the same code as in the serial mode and the
+ * ranges write disjoint parts of the force's derivative array, so the results
+ * match the serial results exactly.
+ *
+ * @param pm    The force; it must support spacecraft partitioning
+ * @param state The state vector
+ * @param dt    Time offset from the current epoch, in seconds
+ * @param order The order of the derivative
+ *
+ * @return true on success, false if the force failed for any range
+ */
+//------------------------------------------------------------------------------
+bool ODEModel::GetPartitionedDerivatives(PhysicalModel *pm, Real *state,
+      Real dt, Integer order)
+{
+   Integer workers = workerPool->GetThreadCount();
+   if (!pm->PrepareDerivatives(state, dt, order, workers))
+      return false;
+
+   Integer parts = (cartesianCount < workers ? cartesianCount : workers);
+   IntegerArray succeeded(parts, 0);
+
+   workerPool->Run(parts, [&](Integer part, Integer worker)
+   {
+      Integer first, last;
+      WorkerPool::Partition(cartesianCount, parts, part, first, last);
+      if (pm->GetSpacecraftDerivatives(state, dt, order, first, last, worker))
+         succeeded[part] = 1;
+   });
+
+   for (Integer i = 0; i < parts; ++i)
+      if (succeeded[i] == 0)
+         return false;
+
+   return true;
+}
+
+
 //------------------------------------------------------------------------------
 // bool PrepareDerivativeArray()
 //------------------------------------------------------------------------------
@@ -3520,6 +3596,46 @@ void ODEModel::FiniteDiffTimeJacobian(Real * state, Real dt, Integer order)
       deriv[j] = nomDerivs[j];
 }
 
+//------------------------------------------------------------------------------
+// bool GetComponentMap(Integer * map, Integer order, Integer id) const
+//------------------------------------------------------------------------------
+/**
+ * Maps derivative components to their base components
+ *
+ * With id set to Gmat::CARTESIAN_STATE only the Cartesian states are mapped,
+ * so that the positions are found even when the state also holds an STM or
+ * other integrable data; every other element is set to -1.  Other ids use the
+ * PhysicalModel mapping.
+ *
+ * @param map   Array that receives the mapping (dimension elements)
+ * @param order The order of the mapping
+ * @param id    The set of derivatives requested
+ *
+ * @return true if a mapping was made
+ */
+//------------------------------------------------------------------------------
+bool ODEModel::GetComponentMap(Integer * map, Integer order, Integer id) const
+{
+   if (id != Gmat::CARTESIAN_STATE)
+      return PhysicalModel::GetComponentMap(map, order, id);
+
+   for (Integer i = 0; i < dimension; ++i)
+      map[i] = -1;
+
+   if (order == 1)
+   {
+      for (Integer i = 0; i < cartesianCount; ++i)
+      {
+         Integer i6 = cartesianStart + i * 6;
+         map[ i6 ] = i6 + 3;
+         map[i6+1] = i6 + 4;
+         map[i6+2] = i6 + 5;
+      }
+   }
+
+   return true;
+}
+
 //------------------------------------------------------------------------------
 // Real ODEModel::EstimateError(Real *diffs, Real *answer) const
 //------------------------------------------------------------------------------
@@ -3840,10 +3956,15 @@ Rvector6 ODEModel::GetDerivativesForSpacecraft(Spacecraft *sc)
       isInitializedForParameters = true;
    }
 
+   // The velocity IDs are the same for every Spacecraft; look them up once
+   static const Integer vxId = sc->GetParameterID("CartesianVX");
+   static const Integer vyId = sc->GetParameterID("CartesianVY");
+   static const Integer vzId = sc->GetParameterID("CartesianVZ");
+
    Rvector6 dv, component;
-   dv[0] = sc->GetRealParameter("CartesianVX");
-   dv[1] = sc->GetRealParameter("CartesianVY");
-   dv[2] = sc->GetRealParameter("CartesianVZ");
+   dv[0] = sc->GetRealParameter(vxId);
+   dv[1] = sc->GetRealParameter(vyId);
+   dv[2] = sc->GetRealParameter(vzId);
    dv[3] = dv[4] = dv[5] = 0.0;
 
    // Apply superposition of forces/derivatives
@@ -3910,6 +4031,25 @@ Rvector6 ODEModel::GetDerivativesForSpacecraft(Spacecraft *sc)
    return dv;
 }
 
+
+//------------------------------------------------------------------------------
+// bool SupportsConcurrentCopies()
+//------------------------------------------------------------------------------
+/**
+ * Copies of the ODE model can run concurrently when every force can.
+ *
+ * @return true if all of the forces support concurrent copies
+ */
+//------------------------------------------------------------------------------
+bool ODEModel::SupportsConcurrentCopies()
+{
+   for (std::vector<PhysicalModel*>::iterator i = forceList.begin();
+        i != forceList.end(); ++i)
+      if (!(*i)->SupportsConcurrentCopies())
+         return false;
+   return true;
+}
+
 //------------------------------------------------------------------------------
 // PhysicalModel* GetForceOfType(const std::string& forceType,
 //       const std::string& forBody = "Earth");
@@ -4338,13 +4478,11 @@ Integer ODEModel::GetParameterID(const std::string &str) const
    if (alias == "Gravity")
       alias = "PrimaryBodies";
    
-   for (int i = PhysicalModelParamCount; i < ODEModelParamCount; i++)
-   {
-      if (alias == PARAMETER_TEXT[i - PhysicalModelParamCount])
-      {
-         return i;
-      }
-   }
+   static const ParameterIndex parameterIndex("ODEModel", PARAMETER_TEXT,
+         PhysicalModelParamCount, ODEModelParamCount);
+   Integer id = parameterIndex.Find(alias);
+   if (id != -1)
+      return id;
    
    if (std::find(solveForNames.begin(), solveForNames.end(), str) != solveForNames.end())
       for (UnsignedInt i = 0; i < solveForNames.size(); ++i)
@@ -4402,6 +4540,10 @@ bool ODEModel::IsParameterReadOnly(const Integer id) const
        id == POTENTIAL_FILE || id == POLYHEDRAL_BODY || id == SHAPE_FILE_NAME ||
        id == BODY_DENSITY)
       return true;
+
+   // Only written when parallel evaluation is requested
+   if ((id == THREAD_COUNT) && (threadCount == 1))
+      return true;
    
    return PhysicalModel::IsParameterReadOnly(id);
 }
@@ -5062,6 +5204,8 @@ Integer ODEModel::GetIntegerParameter(const Integer id) const
             Integer actualId = GetOwnedObjectId(id, &owner);
             return owner->GetIntegerParameter(actualId);
          }
+      case THREAD_COUNT:
+         return threadCount;
    default:
       return PhysicalModel::GetIntegerParameter(id);
    }
@@ -5103,6 +5247,23 @@ Integer ODEModel::SetIntegerParameter(const Integer id, const Integer value)
          Integer outval = owner->SetIntegerParameter(actualId, value);
          return outval;
       }
+   case THREAD_COUNT:
+      if (value < 0)
+      {
+         char msg[1024];
+         std::stringstream val;
+         val << value;
+         sprintf(msg, errorMessageFormat.c_str(), val.str().c_str(),
+               "ThreadCount", "Integer >= 0");
+         throw ODEModelException(msg);
+      }
+      if ((value != threadCount) && (workerPool != NULL))
+      {
+         delete workerPool;
+         workerPool = NULL;
+      }
+      threadCount = value;
+      return threadCount;
    default:
       return GmatBase::SetIntegerParameter(id, value);
    }
@@ -80,6 +80,8 @@
 
 #include <fstream>            // Used for streams in debugging methods
 
+class WorkerPool;
+
 
 /**
  * ODEModel is a container class for ordinary differential equations
@@ -125,6 +127,9 @@ public:
    virtual bool GetDerivatives(Real * state, Real dt = 0.0, Integer order = 1, 
          const Integer id = -1);
    virtual Real EstimateError(Real *diffs, Real *answer) const;
+   virtual bool GetComponentMap(Integer * map, Integer order = 1,
+         Integer id = -1) const;
+   virtual bool SupportsConcurrentCopies();
 
    // Methods used for parameter access
    virtual Rvector6 GetDerivativesForSpacecraft(Spacecraft *sc);
@@ -378,6 +383,12 @@ protected:
    bool finiteDifferencingTimeJac;
    /// Array containing the most recent derivative calculation, when needed
    Real * nonAnalyticTimeDerivs;
+
+   /// Number of threads used to evaluate forces across spacecraft; 1 is
+   /// serial, 0 uses all hardware threads
+   Integer threadCount;
+   /// Workers for the parallel mode, built on first use
+   WorkerPool *workerPool;
    
    const StringArray&  BuildBodyList(std::string type) const;
    const StringArray&  BuildCoordinateList() const;
@@ -447,6 +458,9 @@ protected:
                                                Integer objectCount,
                                                Integer totalSize);                     // made changes by TUAN NGUYEN
    bool                      PrepareDerivativeArray();
+   bool                      GetPartitionedDerivatives(PhysicalModel *pm,
+                                               Real *state, Real dt,
+                                               Integer order);
    bool                      CompleteDerivativeCalculations(Real *state);
 
    void                      FiniteDiffTimeJacobian(Real * state, Real dt, Integer order);
@@ -484,6 +498,9 @@ protected:
 
       // Plug-in forces not otherwise handled
       USER_DEFINED,
+
+      // Parallel evaluation across spacecraft
+      THREAD_COUNT,
       ODEModelParamCount
    };
    
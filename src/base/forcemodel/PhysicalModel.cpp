@@ -98,6 +98,7 @@
 // **************************************************************************
 
 #include "PhysicalModel.hpp"
+#include "ParameterIndex.hpp"
 #include "gmatdefs.hpp"
 #include "GmatBase.hpp"
 #include "CelestialBody.hpp"
@@ -1119,6 +1120,98 @@ bool PhysicalModel::GetDerivatives(Real * state, Real dt, Integer order,
    return false;
 }
 
+//------------------------------------------------------------------------------
+// bool SupportsSpacecraftPartition()
+//------------------------------------------------------------------------------
+/**
+ * Reports whether the derivatives can be computed in spacecraft ranges.
+ *
+ * Models that return true implement PrepareDerivatives() and
+ * GetSpacecraftDerivatives().  The ODEModel calls PrepareDerivatives() once,
+ * from a single thread, and then calls GetSpacecraftDerivatives() for
+ * disjoint ranges of spacecraft, possibly from several threads at once.  Each
+ * range must produce exactly the values GetDerivatives() would produce for
+ * those spacecraft.
+ *
+ * @return true if the spacecraft can be partitioned; this default returns
+ *         false.
+ */
+//------------------------------------------------------------------------------
+bool PhysicalModel::SupportsSpacecraftPartition()
+{
+   return false;
+}
+
+//------------------------------------------------------------------------------
+// bool PrepareDerivatives(Real * state, Real dt, Integer order,
+//       Integer workerCount)
+//------------------------------------------------------------------------------
+/**
+ * Performs the part of the derivative calculation that is shared by all of
+ * the spacecraft (body positions, frame rotations, and so on).
+ *
+ * @param state       Pointer to the current state data
+ * @param dt          Additional time increment for the derivative calculation
+ * @param order       The order of the derivative to be taken
+ * @param workerCount The number of workers that will call
+ *                    GetSpacecraftDerivatives(); models size their per-worker
+ *                    scratch data from this value
+ *
+ * @return true if the call succeeds; this default returns false.
+ */
+//------------------------------------------------------------------------------
+bool PhysicalModel::PrepareDerivatives(Real * /*state*/, Real /*dt*/,
+      Integer /*order*/, Integer /*workerCount*/)
+{
+   return false;
+}
+
+//------------------------------------------------------------------------------
+// bool GetSpacecraftDerivatives(Real * state, Real dt, Integer order,
+//       Integer first, Integer last, Integer worker)
+//------------------------------------------------------------------------------
+/**
+ * Fills the derivative data for spacecraft first through last-1.
+ *
+ * Implementations write only the derivative elements of those spacecraft and
+ * use only the scratch data belonging to worker.
+ *
+ * @param state  Pointer to the current state data
+ * @param dt     Additional time increment for the derivative calculation
+ * @param order  The order of the derivative to be taken
+ * @param first  Index of the first spacecraft
+ * @param last   One past the index of the last spacecraft
+ * @param worker Index of the calling worker
+ *
+ * @return true if the call succeeds; this default returns false.
+ */
+//------------------------------------------------------------------------------
+bool PhysicalModel::GetSpacecraftDerivatives(Real * /*state*/, Real /*dt*/,
+      Integer /*order*/, Integer /*first*/, Integer /*last*/,
+      Integer /*worker*/)
+{
+   return false;
+}
+
+//------------------------------------------------------------------------------
+// bool SupportsConcurrentCopies()
+//------------------------------------------------------------------------------
+/**
+ * Reports whether separate copies of the model may be evaluated on different
+ * threads at the same time.
+ *
+ * This holds when each copy keeps all of its evaluation data in its own
+ * members (or in data that is shared under a lock), and does not call code
+ * with process-wide state such as the f2c atmosphere models or CSPICE.
+ *
+ * @return true if copies can run concurrently; this default returns false.
+ */
+//------------------------------------------------------------------------------
+bool PhysicalModel::SupportsConcurrentCopies()
+{
+   return false;
+}
+
 //------------------------------------------------------------------------------
 // Rvector6 GetDerivativesForSpacecraft(Spacecraft *sc)
 //------------------------------------------------------------------------------
@@ -1706,11 +1799,11 @@ std::string PhysicalModel::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer PhysicalModel::GetParameterID(const std::string &str) const
 {
-   for (int i = GmatBaseParamCount; i < PhysicalModelParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatBaseParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("PhysicalModel", PARAMETER_TEXT,
+         GmatBaseParamCount, PhysicalModelParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
    return GmatBase::GetParameterID(str);
 }
 
@@ -181,6 +181,15 @@ public:
    virtual bool GetDerivatives(Real * state, Real dt = 0.0, Integer order = 1, 
          const Integer id = -1);
    virtual Rvector6 GetDerivativesForSpacecraft(Spacecraft *sc);
+
+   // Spacecraft-partitioned derivatives, used by the ODEModel's parallel mode
+   virtual bool SupportsSpacecraftPartition();
+   virtual bool PrepareDerivatives(Real * state, Real dt, Integer order,
+         Integer workerCount);
+   virtual bool GetSpacecraftDerivatives(Real * state, Real dt, Integer order,
+         Integer first, Integer last, Integer worker);
+   // Separate copies of the model run on different threads by PropagateEnsemble
+   virtual bool SupportsConcurrentCopies();
    virtual Real EstimateError(Real * diffs, Real * answer) const;
    virtual bool GetComponentMap(Integer * map, Integer order = 1, 
          Integer id = -1) const;
@@ -71,9 +71,11 @@
 // **************************************************************************
 
 #include "PointMassForce.hpp"
+#include "ParameterIndex.hpp"
 #include "MessageInterface.hpp"
 #include "SolarSystem.hpp"
 #include "Rvector6.hpp"
+#include "FixedMatrix.hpp"
 #include "GmatDefaults.hpp"
 #include "ODEModelException.hpp"
 #include "TimeTypes.hpp"
@@ -325,7 +327,7 @@ bool PointMassForce::GetDerivatives(Real * state, Real dt, Integer order,
          "satCount = %d, epoch = %le\n", state, dt, order, id, satCount, epoch);
    #endif
    
-   Integer i6, s6, a6, ix;                             // made changes by TUAN NGUYEN
+   Integer i6, s6, a6;                                 // made changes by TUAN NGUYEN
 
    if (fillCartesian || fillSTM || fillAMatrix)
    {
@@ -596,45 +598,22 @@ bool PointMassForce::GetDerivatives(Real * state, Real dt, Integer order,
 				// Create aTilde matrix                                               // made changes by TUAN NGUYEN
 				stmRowCount = sc->GetIntegerParameter("FullSTMRowCount");     // made changes by TUAN NGUYEN
 				Integer stmSize = stmRowCount * stmRowCount;                          // made changes by TUAN NGUYEN
-				Real *aTilde = new Real[stmSize];                                     // made changes by TUAN NGUYEN
-            for (Integer i = 0; i < stmRowCount; ++i)
+
+				// Calculate A-tilde; only its lower left 3x3 block is nonzero, so
+				// that block is built on the stack and written straight into the
+				// derivative vector
+            // Math spec, equ 6.69, broken into separate pieces
+            FixedMatrix33 gradient(false);
+            for (Integer r = 0; r < 3; ++r)
             {
-               ix = i * stmRowCount;
-               for (Integer j = 0; j < stmRowCount; ++j)
-                  aTilde[ix+j] = 0.0;
+               for (Integer c = 0; c < 3; ++c)
+               {
+                  gradient(r,c) = 3.0 * mu_r / (radius*radius) *
+                                  relativePosition[r] * relativePosition[c];
+                  if (r == c)
+                     gradient(r,c) += - mu_r;
+               }
             }
-            
-				// Calculate A-tilde
-            // Math spec, equ 6.69, broken into separate pieces
-            ix = stmRowCount * 3;
-            aTilde[ix] = - mu_r + 3.0 * mu_r / (radius*radius) *
-                             relativePosition[0] * relativePosition[0];
-            
-            aTilde[ix+1] = 3.0 * mu_r / (radius*radius) *
-                             relativePosition[0] * relativePosition[1];
-            
-            aTilde[ix+2] = 3.0 * mu_r / (radius*radius) *
-                             relativePosition[0] * relativePosition[2];
-            
-            ix = stmRowCount * 4;
-            aTilde[ix] = 3.0 * mu_r / (radius*radius) *
-                             relativePosition[1] * relativePosition[0];
-            
-            aTilde[ix+1] = - mu_r + 3.0 * mu_r / (radius*radius) *
-                             relativePosition[1] * relativePosition[1];
-            
-            aTilde[ix+2] = 3.0 * mu_r / (radius*radius) *
-                             relativePosition[1] * relativePosition[2];
-            
-            ix = stmRowCount * 5;
-            aTilde[ix] = 3.0 * mu_r / (radius*radius) *
-                             relativePosition[2] * relativePosition[0];
-            
-            aTilde[ix+1] = 3.0 * mu_r / (radius*radius) *
-                             relativePosition[2] * relativePosition[1];
-            
-            aTilde[ix+2] = - mu_r + 3.0 * mu_r / (radius*radius) *
-                             relativePosition[2] * relativePosition[2];
 
 // Moved to ODEModel so upper half of STM and A-Matrix are correctly managed
 //            // Now Phi_dot = A_tilde Phi
@@ -658,15 +637,16 @@ bool PointMassForce::GetDerivatives(Real * state, Real dt, Integer order,
                for (Integer k = 0; k < stmRowCount; ++k)
                {
                   element = j * stmRowCount + k;
+                  Real aTilde = (((j >= 3) && (j < 6) && (k < 3)) ?
+                        gradient(j-3,k) : 0.0);
                   if (fillSTM)
                      //deriv[i6+element] = aTilde[element];
-						   deriv[s6 + element] = aTilde[element];
+						   deriv[s6 + element] = aTilde;
                   if (fillAMatrix)
-                     deriv[a6 + element] = aTilde[element];
+                     deriv[a6 + element] = aTilde;
                }
             }
 
-				delete[] aTilde;                             // made changes by TUAN NGUYEN
 				if (fillSTM)                                 // made changes by TUAN NGUYEN
 					s6 = s6 + stmSize;                        // made changes by TUAN NGUYEN
 				if (fillAMatrix)                             // made changes by TUAN NGUYEN
@@ -885,6 +865,22 @@ Rvector6 PointMassForce::GetDerivativesForSpacecraft(Spacecraft *sc)
    return dv;
 }
 
+
+//------------------------------------------------------------------------------
+// bool SupportsConcurrentCopies()
+//------------------------------------------------------------------------------
+/**
+ * The point mass field needs only the body state, read through the copy's
+ * own body pointer.
+ *
+ * @return true
+ */
+//------------------------------------------------------------------------------
+bool PointMassForce::SupportsConcurrentCopies()
+{
+   return true;
+}
+
 //---------------------------------
 // inherited methods from GmatBase
 //---------------------------------
@@ -926,11 +922,11 @@ std::string PointMassForce::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer PointMassForce::GetParameterID(const std::string &str) const
 {
-   for (Integer i = PhysicalModelParamCount; i < PointMassParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - PhysicalModelParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("PointMassForce", PARAMETER_TEXT,
+         PhysicalModelParamCount, PointMassParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
    return PhysicalModel::GetParameterID(str);
 }
 
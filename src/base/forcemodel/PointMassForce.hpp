@@ -90,6 +90,7 @@ public:
    bool Initialize();
    virtual Real EstimateError(Real *diffs, Real *answer) const;
    virtual Rvector6 GetDerivativesForSpacecraft(Spacecraft *sc);
+   virtual bool SupportsConcurrentCopies();
 
    //CelestialBody* GetBody();  // wcs: 2004/06/21 moved to PhysicalModel
    //std::string GetBodyName(); //loj: 5/7/04 added
@@ -39,6 +39,7 @@
 #include "CoordinateSystem.hpp"
 #include "CoordinateConverter.hpp"
 #include "RelativisticCorrection.hpp"
+#include "ParameterIndex.hpp"
 #include "TimeSystemConverter.hpp"
 #include "MessageInterface.hpp"
 
@@ -775,11 +776,12 @@ std::string RelativisticCorrection::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer RelativisticCorrection::GetParameterID(const std::string &str) const
 {
-   for (Integer i = PhysicalModelParamCount; i < RelativisticCorrectionParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - PhysicalModelParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("RelativisticCorrection",
+         PARAMETER_TEXT, PhysicalModelParamCount,
+         RelativisticCorrectionParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
    return PhysicalModel::GetParameterID(str);
 }
 
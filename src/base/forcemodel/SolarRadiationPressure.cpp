@@ -56,11 +56,13 @@
 // **************************************************************************
 
 #include "SolarRadiationPressure.hpp"
+#include "ParameterIndex.hpp"
 #include <sstream>                      // For stringstream
 #include "MessageInterface.hpp"
 #include "GmatConstants.hpp"
 #include "GmatDefaults.hpp"
 #include "PropagationStateManager.hpp"
+#include "EnvironmentContext.hpp"
 
 #define NPLATE_ANALYTICAL_SOLUTION                    // made changes by TUAN NGUYEN
 
@@ -362,11 +364,12 @@ std::string SolarRadiationPressure::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer SolarRadiationPressure::GetParameterID(const std::string &str) const
 {
-   for (int i = USE_ANALYTIC; i < SRPParamCount; i++)
-   {
-      if (str == SolarRadiationPressure::PARAMETER_TEXT[i - PhysicalModelParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("SolarRadiationPressure",
+         SolarRadiationPressure::PARAMETER_TEXT, PhysicalModelParamCount,
+         SRPParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
    return PhysicalModel::GetParameterID(str);
 }
 
@@ -885,16 +888,21 @@ bool SolarRadiationPressure::GetDerivatives(Real *state, Real dt, Integer order,
    bool inSunlight = true, inShadow = false;
 
    Real ep = epoch + (elapsedTime + dt) / GmatTimeConstants::SECS_PER_DAY;
-   sunrv = theSun->GetState(ep);
+
+   // The Sun and body states are shared with the other environment models
+   // evaluated at this epoch
+   EnvironmentContext context;
+   EnvironmentContext::GetContext(theSun, body, ep, context);
+   sunrv.Set(context.sunState);
    
    // Rvector6 is initialized to all 0.0's; only change it if the body is not 
    // the Sun
    if (!bodyIsTheSun)
    {
-      cbrv = body->GetState(ep);
-      cbSunVector[0] = sunrv[0] - cbrv[0];
-      cbSunVector[1] = sunrv[1] - cbrv[1];
-      cbSunVector[2] = sunrv[2] - cbrv[2];
+      cbrv.Set(context.bodyState);
+      cbSunVector[0] = context.bodyToSun[0];
+      cbSunVector[1] = context.bodyToSun[1];
+      cbSunVector[2] = context.bodyToSun[2];
    }
    else
    {
@@ -2326,6 +2334,24 @@ Rvector6 SolarRadiationPressure::GetDerivativesForSpacecraft(Spacecraft *sc)
 }
 
 
+//------------------------------------------------------------------------------
+// bool SupportsConcurrentCopies()
+//------------------------------------------------------------------------------
+/**
+ * The spherical model uses only the copy's own shadow and flux data and the
+ * shared, locked Sun geometry.  The SPAD and N-plate models read spacecraft
+ * attitude, which may come from non-reentrant sources, so they are treated
+ * as serial.
+ *
+ * @return true for the spherical model
+ */
+//------------------------------------------------------------------------------
+bool SolarRadiationPressure::SupportsConcurrentCopies()
+{
+   return (srpShapeModel == "Spherical");
+}
+
+
 ////------------------------------------------------------------------------------
 //// void FindShadowState(bool &lit, bool &dark, Real *state)
 ////------------------------------------------------------------------------------
@@ -94,6 +94,7 @@ public:
    virtual bool GetDerivatives(Real *state, Real dt = 0.0, Integer order = 1, 
                                const Integer id = -1);
    virtual Rvector6 GetDerivativesForSpacecraft(Spacecraft *sc);
+   virtual bool SupportsConcurrentCopies();
 
    // inherited from GmatBase
    virtual GmatBase* Clone() const;
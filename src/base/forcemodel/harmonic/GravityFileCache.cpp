@@ -0,0 +1,606 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                              GravityFileCache
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/16
+//
+/**
+ * Implements the GravityFieldData and GravityFileCache classes.
+ *
+ * Cache file layout (native byte order, every field a multiple of 8 bytes so
+ * the coefficient arrays are aligned in the mapping):
+ *
+ *    header:  "GMATGRAV", version (int32), byte order mark (uint32),
+ *             source size, modification time and status change time
+ *             (int64, times in nanoseconds where the platform has them),
+ *             payload size and FNV-1a checksum of the payload (uint64)
+ *    payload: the metadata, which is the radius, mu and body name the file
+ *             was loaded with, the model name, the scalar load results, the
+ *             Love numbers and the zero tide values; then the packed C and S
+ *             tables
+ *
+ * The checksum covers the tables as well as the metadata, so a cache whose
+ * coefficients were damaged after it was written is rejected and rebuilt
+ * from the source file.  Checking it reads every page of the mapping once,
+ * which is still much faster than parsing the text file.
+ */
+//------------------------------------------------------------------------------
+#include "GravityFileCache.hpp"
+#include "MessageInterface.hpp"
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <sys/stat.h>
+
+//#define DEBUG_GRAVITY_FILE_CACHE
+
+namespace
+{
+   /// The fields in use, by key.  The registry does not keep a field alive;
+   /// it is released with its last HarmonicGravity.
+   std::map<std::string, std::weak_ptr<const GravityFieldData> >
+                        sharedFields;
+   std::mutex           sharedFieldMutex;
+
+   const char           CACHE_MAGIC[8] = { 'G','M','A','T','G','R','A','V' };
+   const std::uint32_t  BYTE_ORDER_MARK = 0x01020304;
+   const std::size_t    HEADER_SIZE = 56;
+
+   const std::uint64_t  FNV_OFFSET = 14695981039346656037ULL;
+   const std::uint64_t  FNV_PRIME  = 1099511628211ULL;
+
+   //---------------------------------------------------------------------------
+   // Continues an FNV-1a hash over size bytes.  The payload fields are all
+   // multiples of 8 bytes, so the hash takes 8 bytes per step; that keeps the
+   // check of a high degree field to a few milliseconds.
+   //---------------------------------------------------------------------------
+   std::uint64_t Checksum(std::uint64_t hash, const char *data,
+                          std::size_t size)
+   {
+      std::size_t words = size / 8;
+      for (std::size_t i = 0; i < words; ++i)
+      {
+         std::uint64_t word;
+         memcpy(&word, data + 8 * i, 8);
+         hash ^= word;
+         hash *= FNV_PRIME;
+      }
+
+      const unsigned char *bytes = (const unsigned char*)data;
+      for (std::size_t i = 8 * words; i < size; ++i)
+      {
+         hash ^= bytes[i];
+         hash *= FNV_PRIME;
+      }
+      return hash;
+   }
+
+   /// What identifies a version of a source file
+   struct FileStamp
+   {
+      std::int64_t      size;
+      std::int64_t      modified;
+      std::int64_t      changed;
+   };
+
+   //---------------------------------------------------------------------------
+   // Reads the stamp of a file; false if it is missing.  The times are in
+   // nanoseconds where the platform reports them, so that a file rewritten
+   // with the same size within one second is still seen as changed.  The
+   // status change time is included because it cannot be set back the way
+   // the modification time can.
+   //---------------------------------------------------------------------------
+   bool GetFileStamp(const std::string &fileName, FileStamp &stamp)
+   {
+      struct stat fileStat;
+      if (stat(fileName.c_str(), &fileStat) != 0)
+         return false;
+      stamp.size = (std::int64_t)fileStat.st_size;
+      #if defined(__APPLE__)
+         stamp.modified = (std::int64_t)fileStat.st_mtimespec.tv_sec *
+               1000000000 + fileStat.st_mtimespec.tv_nsec;
+         stamp.changed = (std::int64_t)fileStat.st_ctimespec.tv_sec *
+               1000000000 + fileStat.st_ctimespec.tv_nsec;
+      #elif defined(_WIN32)
+         stamp.modified = (std::int64_t)fileStat.st_mtime * 1000000000;
+         stamp.changed = (std::int64_t)fileStat.st_ctime * 1000000000;
+      #else
+         stamp.modified = (std::int64_t)fileStat.st_mtim.tv_sec *
+               1000000000 + fileStat.st_mtim.tv_nsec;
+         stamp.changed = (std::int64_t)fileStat.st_ctim.tv_sec *
+               1000000000 + fileStat.st_ctim.tv_nsec;
+      #endif
+      return true;
+   }
+
+   void AppendInteger(std::string &buffer, std::int64_t value)
+   {
+      buffer.append((const char*)&value, sizeof(value));
+   }
+
+   void AppendReal(std::string &buffer, Real value)
+   {
+      buffer.append((const char*)&value, sizeof(value));
+   }
+
+   /// Length, then the characters padded to a multiple of 8 bytes
+   void AppendString(std::string &buffer, const std::string &value)
+   {
+      AppendInteger(buffer, (std::int64_t)value.size());
+      buffer.append(value);
+      buffer.append((8 - value.size() % 8) % 8, '\0');
+   }
+
+   /// Sequential reader over the mapped payload; ok turns false on overrun
+   struct PayloadReader
+   {
+      PayloadReader(const char *start, std::size_t size) :
+         current  (start),
+         end      (start + size),
+         ok       (true)
+      {
+      }
+
+      const char* Take(std::size_t size)
+      {
+         if (!ok || (std::size_t)(end - current) < size)
+         {
+            ok = false;
+            return NULL;
+         }
+         const char *taken = current;
+         current += size;
+         return taken;
+      }
+
+      std::int64_t Integer64()
+      {
+         std::int64_t value = 0;
+         const char *bytes = Take(sizeof(value));
+         if (bytes)
+            memcpy(&value, bytes, sizeof(value));
+         return value;
+      }
+
+      Real RealValue()
+      {
+         Real value = 0.0;
+         const char *bytes = Take(sizeof(value));
+         if (bytes)
+            memcpy(&value, bytes, sizeof(value));
+         return value;
+      }
+
+      std::string String()
+      {
+         std::int64_t length = Integer64();
+         if (length < 0)
+         {
+            ok = false;
+            return "";
+         }
+         const char *bytes = Take((std::size_t)length +
+               (8 - (std::size_t)length % 8) % 8);
+         return (bytes ? std::string(bytes, (std::size_t)length) : "");
+      }
+
+      const Real* Array(std::size_t count)
+      {
+         return (const Real*)Take(count * sizeof(Real));
+      }
+
+      const char  *current;
+      const char  *end;
+      bool        ok;
+   };
+}
+
+//------------------------------------------------------------------------------
+// GravityFieldData()
+//------------------------------------------------------------------------------
+GravityFieldData::GravityFieldData() :
+   NN                (0),
+   MM                (0),
+   FieldRadius       (0.0),
+   Factor            (0.0),
+   Normalized        (true),
+   HaveZeroTide      (false),
+   HaveTideFree      (true),
+   HaveLoveNumbers   (false),
+   ModelName         (""),
+   ZeroTideMax       (0),
+   CP                (NULL),
+   SP                (NULL),
+   mappedFile        (NULL)
+{
+   for (Integer i = 0; i <= LoveMax; ++i)
+   {
+      for (Integer j = 0; j <= LoveMax; ++j)
+         K[i][j] = 0.0;
+      KPlus[i] = 0.0;
+   }
+}
+
+//------------------------------------------------------------------------------
+// ~GravityFieldData()
+//------------------------------------------------------------------------------
+GravityFieldData::~GravityFieldData()
+{
+   if (mappedFile)
+      delete mappedFile;
+}
+
+//------------------------------------------------------------------------------
+// std::string MakeKey(const std::string &filename,
+//       const std::string &tideFilename, const std::string &bodyName,
+//       Real radius, Real mukm)
+//------------------------------------------------------------------------------
+/**
+ * Builds the registry key for a HarmonicGravity load.
+ *
+ * The key holds every input of the load, including the stamps (size,
+ * modification and status change times) of both files, so an edited file is
+ * read again.
+ *
+ * @return The key, or an empty string if the gravity file does not exist
+ */
+//------------------------------------------------------------------------------
+std::string GravityFileCache::MakeKey(const std::string &filename,
+      const std::string &tideFilename, const std::string &bodyName,
+      Real radius, Real mukm)
+{
+   FileStamp stamp;
+   if (!GetFileStamp(filename, stamp))
+      return "";
+
+   std::stringstream key;
+   key.precision(17);
+   key << filename << "|" << stamp.size << "|" << stamp.modified << "|"
+       << stamp.changed << "|" << tideFilename;
+   if (GetFileStamp(tideFilename, stamp))
+      key << "|" << stamp.size << "|" << stamp.modified << "|"
+          << stamp.changed;
+   key << "|" << bodyName << "|" << radius << "|" << mukm;
+
+   return key.str();
+}
+
+//------------------------------------------------------------------------------
+// std::shared_ptr<const GravityFieldData> Find(const std::string &key,
+//       bool needCoefficients)
+//------------------------------------------------------------------------------
+/**
+ * Looks up a registered field.
+ *
+ * @param key              Key from MakeKey()
+ * @param needCoefficients true if the caller evaluates the field; entries
+ *                         loaded for the header only are then skipped
+ *
+ * @return The shared data, or an empty pointer
+ */
+//------------------------------------------------------------------------------
+std::shared_ptr<const GravityFieldData> GravityFileCache::Find(
+      const std::string &key, bool needCoefficients)
+{
+   std::shared_ptr<const GravityFieldData> data;
+   if (key == "")
+      return data;
+
+   std::lock_guard<std::mutex> lock(sharedFieldMutex);
+   std::map<std::string, std::weak_ptr<const GravityFieldData> >::iterator
+         i = sharedFields.find(key);
+   if (i != sharedFields.end())
+   {
+      data = i->second.lock();
+      if (data && needCoefficients && (data->CP == NULL))
+         data.reset();
+   }
+
+   return data;
+}
+
+//------------------------------------------------------------------------------
+// std::shared_ptr<const GravityFieldData> Add(const std::string &key,
+//       const std::shared_ptr<const GravityFieldData> &data)
+//------------------------------------------------------------------------------
+/**
+ * Registers a loaded field.
+ *
+ * If another caller registered a field with coefficients under the same key
+ * first, and it is still in use, that one is kept and returned, so all users
+ * share one copy.  Entries of fields that are no longer used are dropped.
+ *
+ * @return The registered data
+ */
+//------------------------------------------------------------------------------
+std::shared_ptr<const GravityFieldData> GravityFileCache::Add(
+      const std::string &key,
+      const std::shared_ptr<const GravityFieldData> &data)
+{
+   if (key == "")
+      return data;
+
+   std::lock_guard<std::mutex> lock(sharedFieldMutex);
+   std::map<std::string, std::weak_ptr<const GravityFieldData> >::iterator
+         i = sharedFields.begin();
+   while (i != sharedFields.end())
+   {
+      if (i->second.expired())
+         i = sharedFields.erase(i);
+      else
+         ++i;
+   }
+
+   std::weak_ptr<const GravityFieldData> &entry = sharedFields[key];
+   std::shared_ptr<const GravityFieldData> registered = entry.lock();
+   if (!registered || ((registered->CP == NULL) && (data->CP != NULL)))
+   {
+      entry = data;
+      registered = data;
+   }
+
+   #ifdef DEBUG_GRAVITY_FILE_CACHE
+      MessageInterface::ShowMessage("GravityFileCache: registered \"%s\" "
+            "<%p>\n", key.c_str(), registered.get());
+   #endif
+
+   return registered;
+}
+
+//------------------------------------------------------------------------------
+// std::string GetCacheFileName(const std::string &sourceFile)
+//------------------------------------------------------------------------------
+std::string GravityFileCache::GetCacheFileName(const std::string &sourceFile)
+{
+   return sourceFile + ".gcache";
+}
+
+//------------------------------------------------------------------------------
+// GravityFieldData* ReadCacheFile(const std::string &sourceFile,
+//       const std::string &bodyName, Real radius, Real mukm)
+//------------------------------------------------------------------------------
+/**
+ * Maps the binary cache of a gravity file.
+ *
+ * The cache is used only if its version, byte order, source stamp, payload
+ * size, payload checksum and load inputs all match.  The returned data owns
+ * the mapping, and its coefficient tables point into it.
+ *
+ * @return The data read, or NULL if there is no usable cache file
+ */
+//------------------------------------------------------------------------------
+GravityFieldData* GravityFileCache::ReadCacheFile(
+      const std::string &sourceFile, const std::string &bodyName,
+      Real radius, Real mukm)
+{
+   FileStamp source;
+   if (!GetFileStamp(sourceFile, source))
+      return NULL;
+
+   MemoryMappedFile *mmf = new MemoryMappedFile();
+   if (!mmf->Open(GetCacheFileName(sourceFile)) ||
+       (mmf->GetSize() < HEADER_SIZE))
+   {
+      delete mmf;
+      return NULL;
+   }
+
+   const char *bytes = mmf->GetData();
+   std::int32_t version;
+   std::uint32_t byteOrder;
+   FileStamp cached;
+   std::uint64_t payloadSize, checksum;
+   memcpy(&version,         bytes +  8, 4);
+   memcpy(&byteOrder,       bytes + 12, 4);
+   memcpy(&cached.size,     bytes + 16, 8);
+   memcpy(&cached.modified, bytes + 24, 8);
+   memcpy(&cached.changed,  bytes + 32, 8);
+   memcpy(&payloadSize,     bytes + 40, 8);
+   memcpy(&checksum,        bytes + 48, 8);
+
+   bool valid = (memcmp(bytes, CACHE_MAGIC, 8) == 0) &&
+         (version == CACHE_FILE_VERSION) && (byteOrder == BYTE_ORDER_MARK) &&
+         (cached.size == source.size) &&
+         (cached.modified == source.modified) &&
+         (cached.changed == source.changed) &&
+         (payloadSize == mmf->GetSize() - HEADER_SIZE) &&
+         (Checksum(FNV_OFFSET, bytes + HEADER_SIZE, (std::size_t)payloadSize) ==
+          checksum);
+
+   GravityFieldData *data = NULL;
+   if (valid)
+   {
+      PayloadReader reader(bytes + HEADER_SIZE, (std::size_t)payloadSize);
+      Real cachedRadius = reader.RealValue();
+      Real cachedMu = reader.RealValue();
+      std::string cachedBody = reader.String();
+
+      if (reader.ok && (cachedRadius == radius) && (cachedMu == mukm) &&
+          (cachedBody == bodyName))
+      {
+         data = new GravityFieldData();
+         data->ModelName       = reader.String();
+         data->NN              = (Integer)reader.Integer64();
+         data->MM              = (Integer)reader.Integer64();
+         data->Normalized      = (reader.Integer64() != 0);
+         data->HaveZeroTide    = (reader.Integer64() != 0);
+         data->HaveTideFree    = (reader.Integer64() != 0);
+         data->HaveLoveNumbers = (reader.Integer64() != 0);
+         data->FieldRadius     = reader.RealValue();
+         data->Factor          = reader.RealValue();
+         for (Integer i = 0; i <= LoveMax; ++i)
+            for (Integer j = 0; j <= LoveMax; ++j)
+               data->K[i][j] = reader.RealValue();
+         for (Integer i = 0; i <= LoveMax; ++i)
+            data->KPlus[i] = reader.RealValue();
+
+         data->ZeroTideMax = (Integer)reader.Integer64();
+         std::int64_t zeroTideCount = reader.Integer64();
+         for (std::int64_t i = 0; reader.ok && (i < zeroTideCount); ++i)
+         {
+            Integer n = (Integer)reader.Integer64();
+            Integer m = (Integer)reader.Integer64();
+            Real c = reader.RealValue();
+            Real s = reader.RealValue();
+            data->ZeroTideValues.push_back(HarmonicValue(n, m, c, s));
+         }
+
+         // The metadata ends here; the tables follow
+         if (reader.ok && (data->NN > 0))
+         {
+            std::size_t count =
+                  (std::size_t)Harmonic::PackedIndex(data->NN + 1, 0);
+            data->CP = reader.Array(count);
+            data->SP = reader.Array(count);
+         }
+
+         if (!reader.ok || (data->CP == NULL) || (data->SP == NULL) ||
+             (reader.current != reader.end))
+         {
+            delete data;
+            data = NULL;
+         }
+      }
+   }
+
+   #ifdef DEBUG_GRAVITY_FILE_CACHE
+      MessageInterface::ShowMessage("GravityFileCache: cache file for \"%s\" "
+            "%s\n", sourceFile.c_str(), (data ? "mapped" : "rejected"));
+   #endif
+
+   if (data)
+      data->mappedFile = mmf;
+   else
+      delete mmf;
+
+   return data;
+}
+
+//------------------------------------------------------------------------------
+// bool WriteCacheFile(const std::string &sourceFile,
+//       const std::string &bodyName, Real radius, Real mukm,
+//       const GravityFieldData &data)
+//------------------------------------------------------------------------------
+/**
+ * Writes the binary cache of a parsed gravity file.
+ *
+ * The file is written under a temporary name and then renamed, so readers
+ * never see a partial cache.  Failure to write (for example in a read-only
+ * data directory) is not an error; the text file is parsed next time.
+ *
+ * @param sourceFile The gravity file that was parsed
+ * @param bodyName   Body name the file was loaded for
+ * @param radius     Field radius the load started from
+ * @param mukm       Mu the load started from
+ * @param data       The values parsed from the file, before any tide file
+ *
+ * @return true if the cache file was written
+ */
+//------------------------------------------------------------------------------
+bool GravityFileCache::WriteCacheFile(const std::string &sourceFile,
+      const std::string &bodyName, Real radius, Real mukm,
+      const GravityFieldData &data)
+{
+   FileStamp source;
+   if ((data.NN <= 0) || (data.CP == NULL) || (data.SP == NULL) ||
+       !GetFileStamp(sourceFile, source))
+      return false;
+
+   std::string meta;
+   AppendReal(meta, radius);
+   AppendReal(meta, mukm);
+   AppendString(meta, bodyName);
+   AppendString(meta, data.ModelName);
+   AppendInteger(meta, data.NN);
+   AppendInteger(meta, data.MM);
+   AppendInteger(meta, data.Normalized ? 1 : 0);
+   AppendInteger(meta, data.HaveZeroTide ? 1 : 0);
+   AppendInteger(meta, data.HaveTideFree ? 1 : 0);
+   AppendInteger(meta, data.HaveLoveNumbers ? 1 : 0);
+   AppendReal(meta, data.FieldRadius);
+   AppendReal(meta, data.Factor);
+   for (Integer i = 0; i <= LoveMax; ++i)
+      for (Integer j = 0; j <= LoveMax; ++j)
+         AppendReal(meta, data.K[i][j]);
+   for (Integer i = 0; i <= LoveMax; ++i)
+      AppendReal(meta, data.KPlus[i]);
+   AppendInteger(meta, data.ZeroTideMax);
+   AppendInteger(meta, (std::int64_t)data.ZeroTideValues.size());
+   for (UnsignedInt i = 0; i < data.ZeroTideValues.size(); ++i)
+   {
+      AppendInteger(meta, data.ZeroTideValues[i].N);
+      AppendInteger(meta, data.ZeroTideValues[i].M);
+      AppendReal(meta, data.ZeroTideValues[i].C);
+      AppendReal(meta, data.ZeroTideValues[i].S);
+   }
+
+   std::size_t tableBytes =
+         (std::size_t)Harmonic::PackedIndex(data.NN + 1, 0) * sizeof(Real);
+   std::uint64_t payloadSize = meta.size() + 2 * tableBytes;
+   std::uint64_t checksum = Checksum(FNV_OFFSET, meta.data(), meta.size());
+   checksum = Checksum(checksum, (const char*)data.CP, tableBytes);
+   checksum = Checksum(checksum, (const char*)data.SP, tableBytes);
+
+   std::string header(CACHE_MAGIC, 8);
+   std::int32_t version = CACHE_FILE_VERSION;
+   header.append((const char*)&version, 4);
+   header.append((const char*)&BYTE_ORDER_MARK, 4);
+   header.append((const char*)&source.size, 8);
+   header.append((const char*)&source.modified, 8);
+   header.append((const char*)&source.changed, 8);
+   header.append((const char*)&payloadSize, 8);
+   header.append((const char*)&checksum, 8);
+
+   std::string cacheName = GetCacheFileName(sourceFile);
+   std::stringstream tempName;
+   tempName << cacheName << ".tmp"
+            << std::chrono::steady_clock::now().time_since_epoch().count();
+
+   std::ofstream out(tempName.str().c_str(), std::ios::binary);
+   if (!out.good())
+      return false;
+   out.write(header.data(), header.size());
+   out.write(meta.data(), meta.size());
+   out.write((const char*)data.CP, tableBytes);
+   out.write((const char*)data.SP, tableBytes);
+   out.close();
+
+   bool written = !out.fail();
+   if (written)
+   {
+      // rename() does not replace an existing file on every platform
+      std::remove(cacheName.c_str());
+      written = (std::rename(tempName.str().c_str(), cacheName.c_str()) == 0);
+   }
+   if (!written)
+      std::remove(tempName.str().c_str());
+
+   #ifdef DEBUG_GRAVITY_FILE_CACHE
+      MessageInterface::ShowMessage("GravityFileCache: %s cache file \"%s\"\n",
+            (written ? "wrote" : "could not write"), cacheName.c_str());
+   #endif
+
+   return written;
+}
@@ -0,0 +1,125 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                              GravityFileCache
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/16
+//
+/**
+ * Declares GravityFieldData, the read-only contents of a loaded gravity file,
+ * and GravityFileCache, which shares that data across the process and keeps
+ * a binary copy of each parsed file next to the source.
+ *
+ * Parsing a high degree text file (EGM2008, GRGM1200A, ...) takes seconds.
+ * The first load writes the parsed values to "<source file>.gcache"; later
+ * loads, in this or any other process, map that file and point the
+ * coefficient tables straight into the mapping.  The binary file carries a
+ * format version, the size and modification and status change times of the
+ * source file, and a checksum of its contents; a file that fails any check is
+ * ignored and rewritten.  Within a process, every HarmonicGravity built from
+ * the same files shares one GravityFieldData while any of them exists, so
+ * clones of a GravityField reuse the coefficients without reading anything.
+ */
+//------------------------------------------------------------------------------
+#ifndef GravityFileCache_hpp
+#define GravityFileCache_hpp
+
+#include "gmatdefs.hpp"
+#include "HarmonicGravity.hpp"
+#include "MemoryMappedFile.hpp"
+#include <memory>
+
+/**
+ * The values read from a gravity file and its tide file
+ *
+ * The members mirror the HarmonicGravity load results.  CP and SP hold the
+ * normalized coefficients, triangular-packed (see Harmonic::PackedIndex);
+ * they point into CStorage and SStorage, into a mapped cache file, or are
+ * NULL when only the file header was read.  The data is not changed once it
+ * is registered with the GravityFileCache.
+ */
+class GMAT_API GravityFieldData
+{
+public:
+   GravityFieldData();
+   ~GravityFieldData();
+
+   Integer              NN;
+   Integer              MM;
+   Real                 FieldRadius;
+   Real                 Factor;
+   bool                 Normalized;
+   bool                 HaveZeroTide;
+   bool                 HaveTideFree;
+   bool                 HaveLoveNumbers;
+   std::string          ModelName;
+   Integer              ZeroTideMax;
+   std::vector<HarmonicValue>
+                        ZeroTideValues;
+   Real                 K[LoveMax+1][LoveMax+1];
+   Real                 KPlus[LoveMax+1];
+
+   /// Packed C coefficients, PackedIndex(NN+1,0) of them, or NULL
+   const Real           *CP;
+   /// Packed S coefficients, PackedIndex(NN+1,0) of them, or NULL
+   const Real           *SP;
+   /// Coefficient storage when the data was parsed from the text file
+   RealArray            CStorage;
+   /// Coefficient storage when the data was parsed from the text file
+   RealArray            SStorage;
+   /// The cache file the coefficients point into, if they were mapped
+   MemoryMappedFile     *mappedFile;
+
+private:
+   // Shared by pointer; copies are not allowed
+   GravityFieldData(const GravityFieldData &gfd);
+   GravityFieldData& operator=(const GravityFieldData &gfd);
+};
+
+/**
+ * Process-wide registry of loaded gravity fields, and the binary file cache
+ */
+class GMAT_API GravityFileCache
+{
+public:
+   static std::string   MakeKey(const std::string &filename,
+                                const std::string &tideFilename,
+                                const std::string &bodyName, Real radius,
+                                Real mukm);
+   static std::shared_ptr<const GravityFieldData>
+                        Find(const std::string &key, bool needCoefficients);
+   static std::shared_ptr<const GravityFieldData>
+                        Add(const std::string &key,
+                            const std::shared_ptr<const GravityFieldData> &data);
+
+   static std::string   GetCacheFileName(const std::string &sourceFile);
+   static GravityFieldData*
+                        ReadCacheFile(const std::string &sourceFile,
+                                      const std::string &bodyName,
+                                      Real radius, Real mukm);
+   static bool          WriteCacheFile(const std::string &sourceFile,
+                                       const std::string &bodyName,
+                                       Real radius, Real mukm,
+                                       const GravityFieldData &data);
+
+   /// Version of the binary cache file layout
+   static const Integer CACHE_FILE_VERSION = 3;
+};
+
+#endif // GravityFileCache_hpp
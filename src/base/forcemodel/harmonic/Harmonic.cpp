@@ -46,12 +46,14 @@ Harmonic::Harmonic ()
      MM         (0),
      FieldRadius(0.0),
      Factor     (0.0),
-     C          (NULL),
-     S          (NULL),
-     A          (NULL),
      V          (NULL),
-     Re         (NULL),
-     Im         (NULL),
+     CP         (NULL),
+     SP         (NULL),
+     CEff       (NULL),
+     SEff       (NULL),
+     A          (NULL),
+     ReBuf      (NULL),
+     ImBuf      (NULL),
      N1         (NULL),
      N2         (NULL),
      VR01       (NULL),
@@ -92,6 +94,74 @@ void Harmonic::CalculateField (const Real& jday, const Real pos[3],
    const Integer& nn, const Integer& mm, const bool& fillgradient,
    const Integer& gradientlimit, Real acc[3], Rmatrix33& gradient) const
    {
+   const Real *cp = NULL;
+   const Real *sp = NULL;
+   PrepareCoefficients (jday,nn,mm,cp,sp);
+   CheckGradientTruncation (nn,fillgradient,gradientlimit);
+   EvaluateField (cp,sp,pos,nn,mm,fillgradient,gradientlimit,acc,gradient);
+   }
+//------------------------------------------------------------------------------
+// Size, in Reals, of the scratch space used by one field evaluation.  Callers
+// that evaluate the field from several threads give each thread its own
+// workspace (see EvaluateField).
+//------------------------------------------------------------------------------
+Integer Harmonic::GetWorkspaceSize() const
+   {
+   return APackedIndex(NN+4,0) + 2*(NN+6);
+   }
+//------------------------------------------------------------------------------
+// Sets up a workspace of GetWorkspaceSize() Reals: the constant diagonal of
+// A is copied in and the power buffers are cleared.
+//------------------------------------------------------------------------------
+void Harmonic::InitializeWorkspace (Real* workspace) const
+   {
+   Integer aSize = APackedIndex(NN+4,0);
+   for (Integer i=0;  i<aSize;  ++i)
+      workspace[i] = A[i];
+   for (Integer i=aSize;  i<aSize+2*(NN+6);  ++i)
+      workspace[i] = 0.0;
+   }
+//------------------------------------------------------------------------------
+// Posts the (one time) warning that the gradient is truncated at
+// gradientlimit.  This is the case whenever a degree above the limit is summed.
+//------------------------------------------------------------------------------
+void Harmonic::CheckGradientTruncation (const Integer& nn,
+   const bool& fillgradient, const Integer& gradientlimit) const
+   {
+   Integer nMax = (nn < NN ? nn : NN);
+   if (fillgradient && (nMax >= 1) && (nMax > gradientlimit) &&
+       (matrixTruncationWasPosted == false))
+      {
+      MessageInterface::ShowMessage("*** WARNING *** Gradient data "
+            "for the state transition matrix and A-matrix "
+            "computations are truncated at degree and order "
+            "<= %d.\n", gradientlimit);
+      matrixTruncationWasPosted = true;
+      }
+   }
+//------------------------------------------------------------------------------
+// Field kernel.  All tables are contiguous and the coefficients are passed in
+// already resolved, so the inner loops contain no virtual calls or branches.
+//
+// The kernel writes only to its workspace (A and the Re/Im power buffers), so
+// concurrent calls are safe when each passes its own workspace, set up by
+// InitializeWorkspace.  A NULL workspace uses the member tables.
+//------------------------------------------------------------------------------
+void Harmonic::EvaluateField (const Real* cp, const Real* sp,
+   const Real pos[3], const Integer& nn, const Integer& mm,
+   const bool& fillgradient, const Integer& gradientlimit, Real acc[3],
+   Rmatrix33& gradient, Real* workspace) const
+   {
+   Real *A     = this->A;
+   Real *ReBuf = this->ReBuf;
+   Real *ImBuf = this->ImBuf;
+   if (workspace != NULL)
+      {
+      A     = workspace;
+      ReBuf = workspace + APackedIndex(NN+4,0);
+      ImBuf = ReBuf + (NN+6);
+      }
+
    Integer XS = fillgradient ? 2 : 1;
    // calculate vector components ----------------------------------
    Real r = sqrt (pos[0]*pos[0] + pos[1]*pos[1] + pos[2]*pos[2]);    // Naming scheme from ref [3]
@@ -99,17 +169,23 @@ void Harmonic::CalculateField (const Real& jday, const Real pos[3],
    Real t = pos[1]/r;
    Real u = pos[2]/r; // sin(phi), phi = geocentric latitude
 
+   // The buffers carry two leading zeros, so Re[m-1] and Re[m-2] (and Im)
+   // vanish for m = 0 and 1 without special cases in the loops below
+   Real *Re = ReBuf + 2;
+   Real *Im = ImBuf + 2;
+
    // Calculate values for A -----------------------------------------
    // generate the off-diagonal elements
-   A[1][0] = u*sqrt(Real(3.0));
+   A[APackedIndex(1,0)] = u*sqrt(Real(3.0));
    for (Integer n=1;  n<=NN+XS && n<=nn+XS;  ++n)
-      A[n+1][n] = u*sqrt(Real(2*n+3))*A[n][n];
+      A[APackedIndex(n+1,n)] = u*sqrt(Real(2*n+3))*A[APackedIndex(n,n)];
 
    // apply column-fill recursion formula (Table 2, Row I, Ref.[1])
    for (Integer m=0;  m<=MM+XS && m<=mm+XS;  ++m)
       {
       for (Integer n=m+2;  n<=NN+XS && n<=nn+XS;  ++n)
-         A[n][m] = u * N1[n][m] * A[n-1][m] - N2[n][m] * A[n-2][m];
+         A[APackedIndex(n,m)] = u * N1[PackedIndex(n,m)] * A[APackedIndex(n-1,m)]
+                                  - N2[PackedIndex(n,m)] * A[APackedIndex(n-2,m)];
       // Ref.[3], Eq.(24)
       Re[m] = m==0 ? 1 : s*Re[m-1] - t*Im[m-1]; // real part of (s + i*t)^m
       Im[m] = m==0 ? 0 : s*Im[m-1] + t*Re[m-1]; // imaginary part of (s + i*t)^m
@@ -152,63 +228,82 @@ void Harmonic::CalculateField (const Real& jday, const Real pos[3],
       Real sum34 = 0;
       Real sum44 = 0;
 
-      for (Integer m=0;  m <= n && m<=MM && m<=mm;  ++m) // wcs - removed "m<=n"
+      Integer mMax = n;
+      if (mMax > MM) mMax = MM;
+      if (mMax > mm) mMax = mm;
+
+      // Row pointers into the packed tables for this degree
+      const Real *Cn    = cp   + PackedIndex(n,0);
+      const Real *Sn    = sp   + PackedIndex(n,0);
+      const Real *vr01  = VR01 + PackedIndex(n,0);
+      const Real *vr11  = VR11 + PackedIndex(n,0);
+      const Real *An0   = A    + APackedIndex(n,0);
+      const Real *An1   = A    + APackedIndex(n+1,0);
+
+      for (Integer m=0;  m<=mMax;  ++m)
          {
-         Real Cval = Cnm (jday,n,m);
-         Real Sval = Snm (jday,n,m);
+         Real Cval = Cn[m];
+         Real Sval = Sn[m];
          // Pines Equation 27 (Part of)
-         Real D =            (Cval*Re[m]   + Sval*Im[m]) * sqrt2;
-         Real E = m==0 ? 0 : (Cval*Re[m-1] + Sval*Im[m-1]) * sqrt2;
-         Real F = m==0 ? 0 : (Sval*Re[m-1] - Cval*Im[m-1]) * sqrt2;
+         Real D = (Cval*Re[m]   + Sval*Im[m]) * sqrt2;
+         Real E = (Cval*Re[m-1] + Sval*Im[m-1]) * sqrt2;
+         Real F = (Sval*Re[m-1] - Cval*Im[m-1]) * sqrt2;
          // Correct for normalization
-         Real Avv00 = A[n][m];
-         Real Avv01 = VR01[n][m] * A[n][m+1];
-         Real Avv11 = VR11[n][m] * A[n+1][m+1];
+         Real Avv00 = An0[m];
+         Real Avv01 = vr01[m] * An0[m+1];
+         Real Avv11 = vr11[m] * An1[m+1];
          // Pines Equation 30 and 30b (Part of)
          sum1 += m * Avv00 * E;
          sum2 += m * Avv00 * F;
          sum3 +=     Avv01 * D;
          sum4 +=     Avv11 * D;
+         }
+
+      // Truncate the gradient at GRADIENT_MAX x GRADIENT_MAX
+      if (fillgradient)
+         {
+         Integer mGrad = -1;
+         if (n <= gradientlimit)
+            mGrad = (mMax < gradientlimit ? mMax : gradientlimit);
 
-         // Truncate the gradient at GRADIENT_MAX x GRADIENT_MAX
-         if (fillgradient)
+         const Real *vr02  = VR02 + PackedIndex(n,0);
+         const Real *vr12  = VR12 + PackedIndex(n,0);
+         const Real *vr22  = VR22 + PackedIndex(n,0);
+         const Real *An2   = A    + APackedIndex(n+2,0);
+
+         for (Integer m=0;  m<=mGrad;  ++m)
             {
-            if ((m <= gradientlimit) && (n <= gradientlimit))
-               {
-               // Pines Equation 27 (Part of)
-               // 2015.09.18 GMT-5295 m<=2  -> m<=1
-               Real G = m<=1 ? 0 : (Cval*Re[m-2] + Sval*Im[m-2]) * sqrt2;
-               Real H = m<=1 ? 0 : (Sval*Re[m-2] - Cval*Im[m-2]) * sqrt2;
-               // Correct for normalization
-               Real Avv02 = VR02[n][m] * A[n][m+2];
-               Real Avv12 = VR12[n][m] * A[n+1][m+2];
-               Real Avv22 = VR22[n][m] * A[n+2][m+2];
-               if (GmatMathUtil::IsNaN(Avv02) || GmatMathUtil::IsInf(Avv02))
-                  Avv02 = 0.0;  // ************** wcs added ****
+            Real Cval = Cn[m];
+            Real Sval = Sn[m];
+            // Pines Equation 27 (Part of)
+            // 2015.09.18 GMT-5295 m<=2  -> m<=1
+            Real D = (Cval*Re[m]   + Sval*Im[m]) * sqrt2;
+            Real E = (Cval*Re[m-1] + Sval*Im[m-1]) * sqrt2;
+            Real F = (Sval*Re[m-1] - Cval*Im[m-1]) * sqrt2;
+            Real G = (Cval*Re[m-2] + Sval*Im[m-2]) * sqrt2;
+            Real H = (Sval*Re[m-2] - Cval*Im[m-2]) * sqrt2;
+            // Correct for normalization
+            Real Avv00 = An0[m];
+            Real Avv01 = vr01[m] * An0[m+1];
+            Real Avv11 = vr11[m] * An1[m+1];
+            Real Avv02 = vr02[m] * An0[m+2];
+            Real Avv12 = vr12[m] * An1[m+2];
+            Real Avv22 = vr22[m] * An2[m+2];
+            if (GmatMathUtil::IsNaN(Avv02) || GmatMathUtil::IsInf(Avv02))
+               Avv02 = 0.0;  // ************** wcs added ****
+
+            // Pines Equation 36 (Part of)
+            sum11 += m*(m-1) * Avv00 * G;
+            sum12 += m*(m-1) * Avv00 * H;
+            sum13 += m       * Avv01 * E;
+            sum14 += m       * Avv11 * E;
+            sum23 += m       * Avv01 * F;
+            sum24 += m       * Avv11 * F;
+            sum33 +=           Avv02 * D;
+            sum34 +=           Avv12 * D;
+            sum44 +=           Avv22 * D;
+            }
 
-               // Pines Equation 36 (Part of)
-               sum11 += m*(m-1) * Avv00 * G;
-               sum12 += m*(m-1) * Avv00 * H;
-               sum13 += m       * Avv01 * E;
-               sum14 += m       * Avv11 * E;
-               sum23 += m       * Avv01 * F;
-               sum24 += m       * Avv11 * F;
-               sum33 +=           Avv02 * D;
-               sum34 +=           Avv12 * D;
-               sum44 +=           Avv22 * D;
-               }
-            else
-               {
-               if (matrixTruncationWasPosted == false)
-                  {
-                  MessageInterface::ShowMessage("*** WARNING *** Gradient data "
-                        "for the state transition matrix and A-matrix "
-                        "computations are truncated at degree and order "
-                        "<= %d.\n", gradientlimit);
-                  matrixTruncationWasPosted = true;
-                  }
-               }
-            } 
          }
       // Pines Equation 30 and 30b (Part of)
       Real rr = rho_np1/FieldRadius;
@@ -260,26 +355,29 @@ void Harmonic::CalculateField (const Real& jday, const Real pos[3],
 //------------------------------------------------------------------------------
 // protected methods
 //------------------------------------------------------------------------------
+// Allocates the recursion tables and the scratch space for NN and MM.  The
+// coefficient tables CP and SP are supplied by the derived class.
+//------------------------------------------------------------------------------
 void Harmonic::Allocate()
    {
-   AllocateArray(C,NN,0);
-   AllocateArray(S,NN,0);
-   AllocateArray(A,NN,3);
    AllocateArray(V,NN,3);
-   AllocateArray(Re,NN,3);
-   AllocateArray(Im,NN,3);
-   AllocateArray(N1,NN,3);
-   AllocateArray(N2,NN,3);
-   AllocateArray(VR01,NN,0);
-   AllocateArray(VR11,NN,0);
-   AllocateArray(VR02,NN,0);
-   AllocateArray(VR12,NN,0);
-   AllocateArray(VR22,NN,0);
+   AllocatePacked(CEff,PackedIndex(NN+1,0));
+   AllocatePacked(SEff,PackedIndex(NN+1,0));
+   AllocatePacked(A,APackedIndex(NN+4,0));
+   AllocatePacked(ReBuf,NN+6);
+   AllocatePacked(ImBuf,NN+6);
+   AllocatePacked(N1,PackedIndex(NN+3,0));
+   AllocatePacked(N2,PackedIndex(NN+3,0));
+   AllocatePacked(VR01,PackedIndex(NN+1,0));
+   AllocatePacked(VR11,PackedIndex(NN+1,0));
+   AllocatePacked(VR02,PackedIndex(NN+1,0));
+   AllocatePacked(VR12,PackedIndex(NN+1,0));
+   AllocatePacked(VR22,PackedIndex(NN+1,0));
 
    // initialize the diagonal elements (not a function of the input)
-   A[0][0] = 1.0;
+   A[APackedIndex(0,0)] = 1.0;
    for (Integer n=1;  n<=NN+2;  ++n)
-      A[n][n] = sqrt (Real(2*n+1)/Real(2*n)) * A[n-1][n-1];
+      A[APackedIndex(n,n)] = sqrt (Real(2*n+1)/Real(2*n)) * A[APackedIndex(n-1,n-1)];
 
    // Compute normalization coefficients V(n,m)     V(0..degree,0..order)
    //   V(n,0) = sqrt (2n+1)
@@ -299,18 +397,19 @@ void Harmonic::Allocate()
       for (Integer m=0;  m<=n && m<=MM;  ++m)
          {
          Real nn = n;
-         VR01[n][m] = sqrt(Real((nn-m)*(nn+m+1)));
-         VR11[n][m] = sqrt(Real((2*nn+1)*(nn+m+2)*(nn+m+1))/Real((2*nn+3)));
-         VR02[n][m] = sqrt(Real((nn-m)*(nn-m-1)*(nn+m+1)*(nn+m+2))) ;
-         VR12[n][m] = sqrt(Real(2*nn+1)/Real(2*nn+3)*Real((nn-m)*(nn+m+1)*(nn+m+2)*(nn+m+3)));
-         VR22[n][m] = sqrt(Real(2*nn+1)/Real(2*nn+5)*Real((nn+m+1)*(nn+m+2)*(nn+m+3)*(nn+m+4)));
+         Integer k = PackedIndex(n,m);
+         VR01[k] = sqrt(Real((nn-m)*(nn+m+1)));
+         VR11[k] = sqrt(Real((2*nn+1)*(nn+m+2)*(nn+m+1))/Real((2*nn+3)));
+         VR02[k] = sqrt(Real((nn-m)*(nn-m-1)*(nn+m+1)*(nn+m+2))) ;
+         VR12[k] = sqrt(Real(2*nn+1)/Real(2*nn+3)*Real((nn-m)*(nn+m+1)*(nn+m+2)*(nn+m+3)));
+         VR22[k] = sqrt(Real(2*nn+1)/Real(2*nn+5)*Real((nn+m+1)*(nn+m+2)*(nn+m+3)*(nn+m+4)));
          if (m==0) 
             {
-            VR01[n][m] /= sqrt(Real(2));
-            VR11[n][m] /= sqrt(Real(2));
-            VR02[n][m] /= sqrt(Real(2));
-            VR12[n][m] /= sqrt(Real(2));
-            VR22[n][m] /= sqrt(Real(2));
+            VR01[k] /= sqrt(Real(2));
+            VR11[k] /= sqrt(Real(2));
+            VR02[k] /= sqrt(Real(2));
+            VR12[k] /= sqrt(Real(2));
+            VR22[k] /= sqrt(Real(2));
             }
          }
 
@@ -318,28 +417,46 @@ void Harmonic::Allocate()
       {
       for (Integer n=m+2;  n<=NN+2;  ++n)
          {
-         N1[n][m] = sqrt (Real((2*n+1)*(2*n-1)) / Real((n-m)*(n+m)));
-         N2[n][m] = sqrt (Real((2*n+1)*(n-m-1)*(n+m-1)) / 
-                          Real((2*n-3)*(n+m)*(n-m)));
+         Integer k = PackedIndex(n,m);
+         N1[k] = sqrt (Real((2*n+1)*(2*n-1)) / Real((n-m)*(n+m)));
+         N2[k] = sqrt (Real((2*n+1)*(n-m-1)*(n+m-1)) / 
+                       Real((2*n-3)*(n+m)*(n-m)));
          }
       }
    }
 //------------------------------------------------------------------------------
 void Harmonic::Deallocate()
    {
-   DeallocateArray(C,NN,0);
-   DeallocateArray(S,NN,0);
-   DeallocateArray(A,NN,3);
    DeallocateArray(V,NN,3);
-   DeallocateArray(Re,NN,3);
-   DeallocateArray(Im,NN,3);
-   DeallocateArray(N1,NN,3);
-   DeallocateArray(N2,NN,3);
-   DeallocateArray(VR01,NN,0);
-   DeallocateArray(VR11,NN,0);
-   DeallocateArray(VR02,NN,0);
-   DeallocateArray(VR12,NN,0);
-   DeallocateArray(VR22,NN,0);
+   DeallocatePacked(CEff);
+   DeallocatePacked(SEff);
+   DeallocatePacked(A);
+   DeallocatePacked(ReBuf);
+   DeallocatePacked(ImBuf);
+   DeallocatePacked(N1);
+   DeallocatePacked(N2);
+   DeallocatePacked(VR01);
+   DeallocatePacked(VR11);
+   DeallocatePacked(VR02);
+   DeallocatePacked(VR12);
+   DeallocatePacked(VR22);
+   }
+//------------------------------------------------------------------------------
+// Resolves the coefficients used for a field evaluation at jday.  This default
+// gathers Cnm/Snm once into the packed scratch tables; derived classes that
+// know which terms vary with time override it to avoid the virtual calls.
+//------------------------------------------------------------------------------
+void Harmonic::PrepareCoefficients(const Real& jday, const Integer& nn,
+   const Integer& mm, const Real*& cp, const Real*& sp) const
+   {
+   for (Integer n=0;  n<=NN && n<=nn;  ++n)
+      for (Integer m=0;  m<=n && m<=MM && m<=mm;  ++m)
+         {
+         CEff[PackedIndex(n,m)] = Cnm(jday,n,m);
+         SEff[PackedIndex(n,m)] = Snm(jday,n,m);
+         }
+   cp = CEff;
+   sp = SEff;
    }
 //------------------------------------------------------------------------------
 void Harmonic::AllocateArray(Real**& a, const Integer& nn, const Integer& excess)
@@ -393,3 +510,21 @@ void Harmonic::DeallocateArray(Real*& a, const Integer& nn, const Integer& exces
       }
    }
 //------------------------------------------------------------------------------
+void Harmonic::AllocatePacked(Real*& a, const Integer& size)
+   {
+   a = new Real[size];
+   if (!a)
+      throw ODEModelException ("Harmonic::AllocatePacked failed");
+   for (Integer i=0;  i<size;  ++i)
+      a[i] = 0.0;
+   }
+//------------------------------------------------------------------------------
+void Harmonic::DeallocatePacked(Real*& a)
+   {
+   if (a != NULL)
+      {
+      delete[] a;
+      a = NULL;
+      }
+   }
+//------------------------------------------------------------------------------
@@ -84,25 +84,40 @@ public:
    void CalculateField(const Real& jday, const Real pos[3], 
        const Integer& nn, const Integer& mm, const bool& fillgradient, 
        const Integer& gradientlimit, Real acc[3], Rmatrix33& gradient) const;
+
+   Integer GetWorkspaceSize() const;
+   void InitializeWorkspace(Real* workspace) const;
+
+   /// Index of (n,m) in the triangular-packed tables (m <= n)
+   static inline Integer PackedIndex(const Integer& n, const Integer& m)
+      { return n*(n+1)/2 + m; }
 //--------------------------------------------------------------------
 protected:
    Integer     NN;      // Maximum value of n (Jn=J2,J3...)
    Integer     MM;      // Maximum value of m (Jnm=Jn2,Jn3...
    Real        FieldRadius;  // Radius for harmonic coefficients
    Real        Factor;  // Factor = 1 (magnetic) or -mu (gravity)
-   Real**      C;       // Normalized harmonic coefficients
-   Real**      S;       // Normalized harmonic coefficients
-   Real**      A;       // Normalized 'derived' Assoc. Legendre Poly
    Real**      V;       // Normalization factor
-   Real*       Re;      // powers of projection of pos onto x_ecf (re)
-   Real*       Im;      // powers of projection of pos onto y_ecf (im)
-   Real**      N1;      // Temporary
-   Real**      N2;      // Temporary
-   Real**      VR01;    // Temporary
-   Real**      VR11;    // Temporary
-   Real**      VR02;    // Temporary
-   Real**      VR12;    // Temporary
-   Real**      VR22;    // Temporary
+
+   // Contiguous tables used by the field kernel.  Tables indexed by (n,m)
+   // with m <= n are triangular-packed (see PackedIndex); A also needs m up to
+   // n+2, so its rows are padded by two (see APackedIndex).
+   // The coefficient tables are owned by the derived class, which may share
+   // them with other instances (see GravityFileCache).
+   const Real* CP;      // Packed normalized C coefficients
+   const Real* SP;      // Packed normalized S coefficients
+   Real*       CEff;    // Packed C including time-varying terms (temporary)
+   Real*       SEff;    // Packed S including time-varying terms (temporary)
+   Real*       A;       // Normalized 'derived' Assoc. Legendre Poly
+   Real*       ReBuf;   // powers of projection of pos onto x_ecf (re)
+   Real*       ImBuf;   // powers of projection of pos onto y_ecf (im)
+   Real*       N1;      // Column-fill recursion factors
+   Real*       N2;      // Column-fill recursion factors
+   Real*       VR01;    // Normalization corrections
+   Real*       VR11;    // Normalization corrections
+   Real*       VR02;    // Normalization corrections
+   Real*       VR12;    // Normalization corrections
+   Real*       VR22;    // Normalization corrections
    /// Flag used to warn about truncating matrix calculations to 20x20 only once
    static bool matrixTruncationWasPosted;
 
@@ -111,7 +126,19 @@ protected:
 protected:
    void Allocate();
    void Deallocate();
-protected:
+   virtual void PrepareCoefficients(const Real& jday, const Integer& nn,
+      const Integer& mm, const Real*& cp, const Real*& sp) const;
+
+   /// Index of (n,m) in A, whose rows hold m = 0..n+2
+   static inline Integer APackedIndex(const Integer& n, const Integer& m)
+      { return n*(n+5)/2 + m; }
+   void CheckGradientTruncation(const Integer& nn, const bool& fillgradient,
+      const Integer& gradientlimit) const;
+   void EvaluateField(const Real* cp, const Real* sp, const Real pos[3],
+      const Integer& nn, const Integer& mm, const bool& fillgradient,
+      const Integer& gradientlimit, Real acc[3], Rmatrix33& gradient,
+      Real* workspace = NULL) const;
+
    static void AllocateArray (Real**& a,   
       const Integer& nn, const Integer& excess);
    static void AllocateArray (Real*& a,    
@@ -120,6 +147,8 @@ protected:
       const Integer& nn, const Integer& excess);
    static void DeallocateArray (Real*& a,  
       const Integer& nn, const Integer& excess);
+   static void AllocatePacked (Real*& a, const Integer& size);
+   static void DeallocatePacked (Real*& a);
 //--------------------------------------------------------------------
 };
 //====================================================================
@@ -29,6 +29,7 @@
  */
 //------------------------------------------------------------------------------
 #include "HarmonicGravity.hpp"
+#include "GravityFileCache.hpp"
 #include "UtilityException.hpp"
 #include "MessageInterface.hpp"
 #include "GmatConstants.hpp"
@@ -71,7 +72,8 @@ HarmonicGravity::HarmonicGravity
      HaveLoveNumbers (false),
      TideLevel (0),
      ZeroTideMax (0),
-     ZeroTideValues (0)
+     ZeroTideValues (0),
+     LoadData (NULL)
    {
    for (int i=0;  i<=LoveMax;  ++i)
       for (int j=0;  j<=LoveMax;  ++j)
@@ -143,32 +145,56 @@ std::string HarmonicGravity::TideString()
 //------------------------------------------------------------------------------
 Real HarmonicGravity::Cnm (const Real& jday, const Integer& n, const Integer& m) const
    {
+   if (m > n)
+      return 0.0;
    if ((n <= LoveMax) && (m <= LoveMax) && (TideLevel > 0))
       {
-      return C[n][m] + DeltaC[n][m];
+      return CP[PackedIndex(n,m)] + DeltaC[n][m];
       }
    else
       {
-      return C[n][m];
+      return CP[PackedIndex(n,m)];
       }
    }
 //------------------------------------------------------------------------------
 Real HarmonicGravity::Snm (const Real& jday, const Integer& n, const Integer& m) const
    {
+   if (m > n)
+      return 0.0;
    if ((n <= LoveMax) && (m <= LoveMax) && (TideLevel > 0))
       {
-      return S[n][m] + DeltaS[n][m];
+      return SP[PackedIndex(n,m)] + DeltaS[n][m];
       }
    else
       {
-      return S[n][m];
+      return SP[PackedIndex(n,m)];
       }
    }
 //------------------------------------------------------------------------------
 void HarmonicGravity::CalculatePointField (const Real& jday, const Real pos[3],
    const Integer& nn, const Integer& mm,
    const bool& fillgradient, const Integer& gradientlimit,
-   Real  acc[3], Rmatrix33& gradient)
+   Real  acc[3], Rmatrix33& gradient) const
+   {
+   for (Integer i=0;  i<=2;  ++i)
+      acc[i] = 0.0;
+   if (fillgradient)
+      for (Integer i=0;  i<=2;  ++i)
+         for (Integer j=0;  j<=2;  ++j)
+            gradient(i,j) = 0.0;
+   AddPointField(pos,fillgradient,acc,gradient);
+   #ifdef DEBUG_GRADIENT
+      MessageInterface::ShowMessage("In CalPtF, fillgradient = %s\n", (fillgradient? "true" : "false"));
+      MessageInterface::ShowMessage("gradientPoint = %s\n", gradient.ToString().c_str());
+   #endif
+   }
+//------------------------------------------------------------------------------
+// Adds the point mass acceleration (and gradient) to acc (and gradient).  The
+// full field methods add the point terms to the harmonic terms in place, so
+// they need no temporary matrices.
+//------------------------------------------------------------------------------
+void HarmonicGravity::AddPointField (const Real pos[3],
+   const bool& fillgradient, Real acc[3], Rmatrix33& gradient) const
    {
    Real r = sqrt(pos[0]*pos[0] + pos[1]*pos[1] + pos[2]*pos[2]);
    if (r == 0)
@@ -176,22 +202,19 @@ void HarmonicGravity::CalculatePointField (const Real& jday, const Real pos[3],
    Real mu_r_3 = (-Factor) / (r * r * r);   // Factor = -mu
    // Calculate acceleration
    for (Integer i=0;  i<=2;  ++i)
-      acc[i] = -mu_r_3 * pos[i];
+      acc[i] += -mu_r_3 * pos[i];
    // Calculate gradient
    if (fillgradient)
       {
       for (Integer i=0;  i<=2;  ++i)
          for (Integer j=0;  j<=2;  ++j)
             {
-            gradient(i,j) = 3*mu_r_3 * pos[i]/r * pos[j]/r; 
+            Real point = 3*mu_r_3 * pos[i]/r * pos[j]/r; 
             if (i==j)
-               gradient(i,j) += -mu_r_3;
+               point += -mu_r_3;
+            gradient(i,j) += point;
             }
       }
-   #ifdef DEBUG_GRADIENT
-      MessageInterface::ShowMessage("In CalPtF, fillgradient = %s\n", (fillgradient? "true" : "false"));
-      MessageInterface::ShowMessage("gradientPoint = %s\n", gradient.ToString().c_str());
-   #endif
    }
 //------------------------------------------------------------------------------
 void HarmonicGravity::CalculateFullField (const Real& jday, const Real pos[3],
@@ -202,6 +225,50 @@ void HarmonicGravity::CalculateFullField (const Real& jday, const Real pos[3],
    const bool& fillgradient, const Integer& gradientlimit, 
    Real acc[3], Rmatrix33& gradient)
    {
+   SetTides (jday,tidelevel,sunpos,sunmukm,otherpos,othermukm,xp,yp);
+   CalculateField(jday,pos,nn,mm,fillgradient,gradientlimit,acc,gradient);
+   AddPointField(pos,fillgradient,acc,gradient);
+   #ifdef DEBUG_GRADIENT
+      MessageInterface::ShowMessage("In CalFullField, fillgradient = %s\n", (fillgradient? "true" : "false"));
+      MessageInterface::ShowMessage("gradient = %s\n", gradient.ToString().c_str());
+   #endif
+   }
+//------------------------------------------------------------------------------
+// Epoch dependent part of the full field: applies the tides and resolves the
+// coefficients used by EvaluateFullField.  The cp and sp pointers stay valid
+// until the next call that changes the tides.
+//------------------------------------------------------------------------------
+void HarmonicGravity::PrepareFullField (const Real& jday,
+   const Integer& nn, const Integer& mm, const Integer& tidelevel, 
+   const Real sunpos[3], const Real& sunmukm, 
+   const Real otherpos[3], const Real& othermukm,
+   const Real &xp, const Real &yp, 
+   const bool& fillgradient, const Integer& gradientlimit, 
+   const Real*& cp, const Real*& sp)
+   {
+   SetTides (jday,tidelevel,sunpos,sunmukm,otherpos,othermukm,xp,yp);
+   PrepareCoefficients (jday,nn,mm,cp,sp);
+   CheckGradientTruncation (nn,fillgradient,gradientlimit);
+   }
+//------------------------------------------------------------------------------
+// Full field at one position using coefficients from PrepareFullField.  This
+// does not change the model, so several threads may call it at once as long
+// as each passes its own workspace (see Harmonic::InitializeWorkspace).
+//------------------------------------------------------------------------------
+void HarmonicGravity::EvaluateFullField (const Real* cp, const Real* sp,
+   const Real pos[3], const Integer& nn, const Integer& mm,
+   const bool& fillgradient, const Integer& gradientlimit, 
+   Real acc[3], Rmatrix33& gradient, Real* workspace) const
+   {
+   EvaluateField(cp,sp,pos,nn,mm,fillgradient,gradientlimit,acc,gradient,workspace);
+   AddPointField(pos,fillgradient,acc,gradient);
+   }
+//------------------------------------------------------------------------------
+void HarmonicGravity::SetTides (const Real& jday, const Integer& tidelevel,
+   const Real sunpos[3], const Real& sunmukm, 
+   const Real otherpos[3], const Real& othermukm,
+   const Real &xp, const Real &yp)
+   {
    TideLevel = tidelevel;
    ClearDeltaCS ();
    if (tidelevel >= 2 && BodyName == GmatSolarSystemDefaults::EARTH_NAME)
@@ -212,20 +279,37 @@ void HarmonicGravity::CalculateFullField (const Real& jday, const Real pos[3],
       if (othermukm > 0)
          IncrementSolidTide (otherpos,othermukm);
       }
-   Real      accpoint[3];
-   Real      accharmonic[3];
-   Rmatrix33 gradientpoint;
-   Rmatrix33 gradientharmonic;
-   CalculatePointField(jday,pos,nn,mm,fillgradient,gradientlimit,accpoint,gradientpoint);
-   CalculateField(jday,pos,nn,mm,fillgradient,gradientlimit,accharmonic,gradientharmonic);
-   for (Integer i=0;  i<=2;  ++i)
-      acc[i] = accpoint[i] + accharmonic[i];
-   if (fillgradient)
-      gradient = gradientpoint + gradientharmonic;
-   #ifdef DEBUG_GRADIENT
-      MessageInterface::ShowMessage("In CalFullField, fillgradient = %s\n", (fillgradient? "true" : "false"));
-      MessageInterface::ShowMessage("gradient = %s\n", gradient.ToString().c_str());
-   #endif
+   }
+//------------------------------------------------------------------------------
+// Supplies the kernel with the packed coefficients directly; only when tides
+// are active are the low-degree terms copied and corrected (see Cnm/Snm).
+//------------------------------------------------------------------------------
+void HarmonicGravity::PrepareCoefficients(const Real& /*jday*/,
+   const Integer& nn, const Integer& /*mm*/, const Real*& cp,
+   const Real*& sp) const
+   {
+   if (TideLevel <= 0)
+      {
+      cp = CP;
+      sp = SP;
+      return;
+      }
+
+   Integer nmax = (nn < NN ? nn : NN);
+   Integer size = PackedIndex(nmax+1,0);
+   for (Integer i=0;  i<size;  ++i)
+      {
+      CEff[i] = CP[i];
+      SEff[i] = SP[i];
+      }
+   for (Integer n=0;  n<=LoveMax && n<=nmax;  ++n)
+      for (Integer m=0;  m<=n;  ++m)
+         {
+         CEff[PackedIndex(n,m)] += DeltaC[n][m];
+         SEff[PackedIndex(n,m)] += DeltaS[n][m];
+         }
+   cp = CEff;
+   sp = SEff;
    }
 //------------------------------------------------------------------------------
 void HarmonicGravity::AddZeroTide (const Integer& n, const Integer& m, 
@@ -258,9 +342,9 @@ void HarmonicGravity::WriteCofFile (const std::string& filename)
          {
          f << "RECOEF  " << GmatStringUtil::ToString (n,3) << GmatStringUtil::ToString (m,3);
          f << "   ";
-         f << GmatStringUtil::ToString (C[n][m],false,true,true,14,21);
+         f << GmatStringUtil::ToString (CP[PackedIndex(n,m)],false,true,true,14,21);
          if (m != 0)
-            f << GmatStringUtil::ToString (S[n][m],false,true,true,14,21);
+            f << GmatStringUtil::ToString (SP[PackedIndex(n,m)],false,true,true,14,21);
          f << std::endl;
          }
    f.close();
@@ -665,6 +749,7 @@ void HarmonicGravity::LM_SetCoefficients (const StringArray& sa,
    if (!good) LM_Error ("Conversion Error");
    if (n > NN) LM_Error ("n is greater than NN");
    if (m > MM) LM_Error ("m is greater than MM");
+   if (m > n)  LM_Error ("m is greater than n");
    s = 0;
    if (m > 0)
       {
@@ -689,8 +774,8 @@ void HarmonicGravity::LM_SetCoefficients (const StringArray& sa,
       AddZeroTide (n,m,c,s);
    else
       {
-      C[n][m] = c;
-      S[n][m] = s;
+      LoadData->CStorage[PackedIndex(n,m)] = c;
+      LoadData->SStorage[PackedIndex(n,m)] = s;
       }
    }
 //------------------------------------------------------------------------------
@@ -715,14 +800,114 @@ void HarmonicGravity::LM_SetDefaultEarthTide ()
       }
    }
 //------------------------------------------------------------------------------
-void HarmonicGravity::LM_Load (const bool& loadcoefficients)
+// Allocates the tables once NN and MM are known while a file is parsed.  The
+// coefficients are parsed straight into the packed storage of LoadData.
+//------------------------------------------------------------------------------
+void HarmonicGravity::LM_Allocate ()
    {
-   LM_Load (Filename,loadcoefficients);
-   if (TideFilename.find(".tide") != std::string::npos)
+   Allocate ();
+   Integer size = PackedIndex(NN+1,0);
+   LoadData->CStorage.assign(size,0.0);
+   LoadData->SStorage.assign(size,0.0);
+   CP = &LoadData->CStorage[0];
+   SP = &LoadData->SStorage[0];
+   }
+//------------------------------------------------------------------------------
+void HarmonicGravity::LM_UseFieldData (const GravityFieldData& data)
    {
-       LM_LoadTide(TideFilename, loadcoefficients);
+   NN = data.NN;
+   MM = data.MM;
+   FieldRadius = data.FieldRadius;
+   Factor = data.Factor;
+   Normalized = data.Normalized;
+   HaveZeroTide = data.HaveZeroTide;
+   HaveTideFree = data.HaveTideFree;
+   HaveLoveNumbers = data.HaveLoveNumbers;
+   ModelName = data.ModelName;
+   ZeroTideMax = data.ZeroTideMax;
+   ZeroTideValues = data.ZeroTideValues;
+   for (int n=0;  n<=LoveMax;  ++n)
+      {
+      for (int m=0;  m<=LoveMax;  ++m)
+         K[n][m] = data.K[n][m];
+      KPlus[n] = data.KPlus[n];
+      }
+   CP = data.CP;
+   SP = data.SP;
    }
-   LM_SetDefaultEarthTide ();
+//------------------------------------------------------------------------------
+void HarmonicGravity::LM_StoreFieldData (GravityFieldData& data)
+   {
+   data.NN = NN;
+   data.MM = MM;
+   data.FieldRadius = FieldRadius;
+   data.Factor = Factor;
+   data.Normalized = Normalized;
+   data.HaveZeroTide = HaveZeroTide;
+   data.HaveTideFree = HaveTideFree;
+   data.HaveLoveNumbers = HaveLoveNumbers;
+   data.ModelName = ModelName;
+   data.ZeroTideMax = ZeroTideMax;
+   data.ZeroTideValues = ZeroTideValues;
+   for (int n=0;  n<=LoveMax;  ++n)
+      {
+      for (int m=0;  m<=LoveMax;  ++m)
+         data.K[n][m] = K[n][m];
+      data.KPlus[n] = KPlus[n];
+      }
+   }
+//------------------------------------------------------------------------------
+// Loads the gravity and tide files.  A field already loaded in this process
+// is shared; otherwise the binary cache of the gravity file is mapped, and
+// only when that is missing or stale is the text file parsed (and the cache
+// written).  See GravityFileCache.
+//------------------------------------------------------------------------------
+void HarmonicGravity::LM_Load (const bool& loadcoefficients)
+   {
+   Real radius = FieldRadius;
+   Real mukm = -Factor;
+   std::string key = GravityFileCache::MakeKey (Filename, TideFilename,
+      BodyName, radius, mukm);
+   FieldData = GravityFileCache::Find (key, loadcoefficients);
+   if (!FieldData)
+      {
+      std::shared_ptr<GravityFieldData> data (GravityFileCache::ReadCacheFile
+         (Filename, BodyName, radius, mukm));
+      if (data)
+         LM_UseFieldData (*data);
+      else
+         {
+         data.reset (new GravityFieldData ());
+         LoadData = data.get();
+         LM_Load (Filename,loadcoefficients);
+         LoadData = NULL;
+         if (loadcoefficients && !data->CStorage.empty())
+            {
+            data->CP = &data->CStorage[0];
+            data->SP = &data->SStorage[0];
+            }
+         LM_StoreFieldData (*data);
+         if (loadcoefficients)
+            GravityFileCache::WriteCacheFile (Filename, BodyName, radius, mukm,
+               *data);
+         }
+      if (TideFilename.find(".tide") != std::string::npos)
+      {
+          LM_LoadTide(TideFilename, loadcoefficients);
+      }
+      LM_SetDefaultEarthTide ();
+      LM_StoreFieldData (*data);
+      if (data->CP == NULL)
+         {
+         // Header only; the tables were needed just for the checks above
+         RealArray().swap (data->CStorage);
+         RealArray().swap (data->SStorage);
+         }
+      FieldData = GravityFileCache::Add (key, data);
+      }
+   LM_UseFieldData (*FieldData);
+   if (CP != NULL && A == NULL)
+      Allocate ();
    }
 //------------------------------------------------------------------------------
 void HarmonicGravity::LM_Load (std::string& filename, const bool& loadcoefficients)
@@ -779,7 +964,7 @@ void HarmonicGravity::LM_LoadCof (std::ifstream& instream, const bool& loadcoeff
             LM_SetFieldRadius (sa[2]);
             LM_SetNormalized (sa[3]);
             if (loadcoefficients) 
-               Allocate ();
+               LM_Allocate ();
             }
          else if (firstStr == "RECOEF")
             {
@@ -830,8 +1015,8 @@ void HarmonicGravity::LM_LoadGfc (std::ifstream& instream, const bool& loadcoeff
             {
             if (loadcoefficients)
                {
-               if (C == NULL)
-                  Allocate();
+               if (CP == NULL)
+                  LM_Allocate();
                sa.erase(sa.begin());
                LM_SetCoefficients (sa,false);
                }
@@ -875,7 +1060,7 @@ void HarmonicGravity::LM_LoadGrv(std::ifstream& instream, const bool& loadcoeffi
       // If we have information required to allocate do so if not already done.            
       if (!isAllocated && isDegreeSet && isOrderSet)
       {
-         Allocate();
+         LM_Allocate();
          isAllocated = true;
       }
 
@@ -1012,7 +1197,7 @@ void HarmonicGravity::LM_LoadTab (std::ifstream& instream, const bool& loadcoeff
 
    if (loadcoefficients)
       {
-      Allocate();
+      LM_Allocate();
       while (!instream.eof())
          {
          GmatFileUtil::GetLine(&instream, line);
@@ -1114,10 +1299,10 @@ void HarmonicGravity::LM_LoadTide(std::string& filename, const bool& loadcoeffic
 //------------------------------------------------------------------------------
 void HarmonicGravity::CheckEarthCoefficient()
 {
-   if (BodyName == GmatSolarSystemDefaults::EARTH_NAME && C != NULL && NN >= 2)
+   if (BodyName == GmatSolarSystemDefaults::EARTH_NAME && CP != NULL && NN >= 2)
    {
       // Special case for Earth
-      bool tidefreemodel = C[2][0] > -4.84167E-04;
+      bool tidefreemodel = CP[PackedIndex(2,0)] > -4.84167E-04;
       HaveTideFree = tidefreemodel;
       HaveZeroTide = !tidefreemodel;
    }
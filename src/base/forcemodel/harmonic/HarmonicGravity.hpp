@@ -34,8 +34,10 @@
 #include "gmatdefs.hpp"
 #include "Harmonic.hpp"
 #include "Rmatrix33.hpp"
+#include <memory>
 //------------------------------------------------------------------------------
 const Integer LoveMax = 4;
+class GravityFieldData;
 //------------------------------------------------------------------------------
 class GMAT_API HarmonicValue {
 public:
@@ -72,7 +74,7 @@ public:
    void CalculatePointField(const Real& jday, const Real pos[3],
       const Integer& nn, const Integer& mm,
       const bool& fillgradient,  const Integer& gradientlimit,
-      Real  acc[3], Rmatrix33& gradient);
+      Real  acc[3], Rmatrix33& gradient) const;
    void CalculateFullField(const Real& jday, const Real pos[3],
       const Integer& nn, const Integer& mm, const Integer& tidelevel, 
       const Real sunpos[3], const Real& sunmukm, 
@@ -80,6 +82,17 @@ public:
       const Real &xp, const Real &yp,
       const bool& fillgradient,  const Integer& gradientlimit,
       Real acc[3], Rmatrix33& gradient);
+   void PrepareFullField(const Real& jday,
+      const Integer& nn, const Integer& mm, const Integer& tidelevel,
+      const Real sunpos[3], const Real& sunmukm, 
+      const Real otherpos[3], const Real& othermukm,
+      const Real &xp, const Real &yp,
+      const bool& fillgradient,  const Integer& gradientlimit,
+      const Real*& cp, const Real*& sp);
+   void EvaluateFullField(const Real* cp, const Real* sp, const Real pos[3],
+      const Integer& nn, const Integer& mm,
+      const bool& fillgradient,  const Integer& gradientlimit,
+      Real acc[3], Rmatrix33& gradient, Real* workspace = NULL) const;
 
    void AddZeroTide (const Integer& n, const Integer& m, 
       const Real& c, const Real& s);
@@ -109,6 +122,18 @@ private:
    // Variable Coefficients (Temporary)
    Real   DeltaC[LoveMax+1][LoveMax+1];  // Temporary during full field call
    Real   DeltaS[LoveMax+1][LoveMax+1];  // Temporary during full field call
+   // Loaded file contents, shared with other instances; CP and SP point here
+   std::shared_ptr<const GravityFieldData> FieldData;
+   GravityFieldData* LoadData;   // Data being parsed (Temporary during load)
+
+   virtual void PrepareCoefficients(const Real& jday, const Integer& nn,
+      const Integer& mm, const Real*& cp, const Real*& sp) const;
+   void AddPointField (const Real pos[3], const bool& fillgradient,
+      Real acc[3], Rmatrix33& gradient) const;
+   void SetTides (const Real& jday, const Integer& tidelevel,
+      const Real sunpos[3], const Real& sunmukm, 
+      const Real otherpos[3], const Real& othermukm,
+      const Real &xp, const Real &yp);
 
    // Methods useful in Tide computations
    void ClearDeltaCS ();
@@ -130,6 +155,9 @@ private:
    void LM_SetCoefficients (const std::string& line, 
       const bool& zerotidevalue); 
    void LM_SetDefaultEarthTide ();
+   void LM_Allocate ();
+   void LM_UseFieldData (const GravityFieldData& data);
+   void LM_StoreFieldData (GravityFieldData& data);
    void LM_Load (const bool& loadcoefficients);
    void LM_Load (std::string& filename, const bool& loadcoefficients);
    void LM_LoadCof (std::ifstream& instream, const bool& loadcoefficients);
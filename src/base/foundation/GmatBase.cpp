@@ -47,6 +47,7 @@
 
 
 #include "GmatBase.hpp"
+#include "ParameterIndex.hpp"
 #include "GmatGlobal.hpp"  // for GetDataPrecision(), IsWritingGmatKeyword()
 #include "Moderator.hpp"
 #include <sstream>         // for StringStream
@@ -1523,11 +1524,11 @@ std::string GmatBase::GetParameterUnit(const Integer id) const
 //---------------------------------------------------------------------------
 Integer GmatBase::GetParameterID(const std::string &str) const
 {
-   for (Integer i = 0; i < GmatBaseParamCount; ++i)
-      if (str == PARAMETER_LABEL[i])
-      {
-         return i;
-      }
+   static const ParameterIndex parameterIndex("GmatBase", PARAMETER_LABEL, 0,
+         GmatBaseParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
    
    throw GmatBaseException
       ("GmatBase::GetParameterID() The object named \"" + GetName() +
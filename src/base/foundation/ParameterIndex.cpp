@@ -0,0 +1,213 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                               ParameterIndex
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/16
+//
+/**
+ * Implements the ParameterIndex class.
+ */
+//------------------------------------------------------------------------------
+#include "ParameterIndex.hpp"
+#include <algorithm>
+#include <iomanip>
+#include <mutex>
+#include <sstream>
+
+//------------------------------------------------------------------------------
+// static data
+//------------------------------------------------------------------------------
+std::atomic<bool> ParameterIndex::collectStatistics(false);
+
+namespace
+{
+   /// All indices built so far, for the statistics report
+   std::vector<const ParameterIndex*> registeredIndices;
+   std::mutex                         registryMutex;
+
+   /// One line of the statistics report
+   struct LookupCount
+   {
+      std::string    label;
+      unsigned long  count;
+   };
+
+   bool MoreHits(const LookupCount &a, const LookupCount &b)
+   {
+      if (a.count != b.count)
+         return a.count > b.count;
+      return a.label < b.label;
+   }
+}
+
+//------------------------------------------------------------------------------
+// ParameterIndex(const std::string &owner, const std::string *labels,
+//                Integer firstId, Integer endId)
+//------------------------------------------------------------------------------
+/**
+ * Constructor
+ *
+ * Builds the index.  When a label appears twice the first ID is kept, which
+ * matches the linear scan it replaces.
+ *
+ * @param owner   Name of the class that owns the table
+ * @param labels  The PARAMETER_TEXT table; labels[i] has ID firstId + i
+ * @param firstId ID of the first label
+ * @param endId   One past the ID of the last label
+ */
+//------------------------------------------------------------------------------
+ParameterIndex::ParameterIndex(const std::string &owner,
+                               const std::string *labels, Integer firstId,
+                               Integer endId) :
+   owner       (owner),
+   firstId     (firstId),
+   hits        (endId > firstId ? endId - firstId : 0)
+{
+   Integer count = (endId > firstId ? endId - firstId : 0);
+   this->labels.assign(labels, labels + count);
+   ids.reserve(count);
+   for (Integer i = 0; i < count; ++i)
+      ids.insert(std::make_pair(labels[i], firstId + i));
+
+   std::lock_guard<std::mutex> lock(registryMutex);
+   registeredIndices.push_back(this);
+}
+
+//------------------------------------------------------------------------------
+// ~ParameterIndex()
+//------------------------------------------------------------------------------
+ParameterIndex::~ParameterIndex()
+{
+   std::lock_guard<std::mutex> lock(registryMutex);
+   std::vector<const ParameterIndex*>::iterator i =
+         std::find(registeredIndices.begin(), registeredIndices.end(), this);
+   if (i != registeredIndices.end())
+      registeredIndices.erase(i);
+}
+
+//------------------------------------------------------------------------------
+// Integer Find(const std::string &label) const
+//------------------------------------------------------------------------------
+/**
+ * Looks up the ID of a label.
+ *
+ * @param label The parameter label
+ *
+ * @return The parameter ID, or -1 if the label is not in the table
+ */
+//------------------------------------------------------------------------------
+Integer ParameterIndex::Find(const std::string &label) const
+{
+   std::unordered_map<std::string, Integer>::const_iterator i =
+         ids.find(label);
+   if (i == ids.end())
+      return -1;
+
+   if (collectStatistics.load(std::memory_order_relaxed))
+      hits[i->second - firstId].fetch_add(1, std::memory_order_relaxed);
+
+   return i->second;
+}
+
+//------------------------------------------------------------------------------
+// void SetStatisticsEnabled(bool enabled)
+//------------------------------------------------------------------------------
+/**
+ * Turns the counting of successful lookups on or off.
+ *
+ * @param enabled true to count lookups
+ */
+//------------------------------------------------------------------------------
+void ParameterIndex::SetStatisticsEnabled(bool enabled)
+{
+   collectStatistics.store(enabled);
+}
+
+//------------------------------------------------------------------------------
+// bool IsStatisticsEnabled()
+//------------------------------------------------------------------------------
+bool ParameterIndex::IsStatisticsEnabled()
+{
+   return collectStatistics.load();
+}
+
+//------------------------------------------------------------------------------
+// void ResetStatistics()
+//------------------------------------------------------------------------------
+/**
+ * Zeros the lookup counts of every index.
+ */
+//------------------------------------------------------------------------------
+void ParameterIndex::ResetStatistics()
+{
+   std::lock_guard<std::mutex> lock(registryMutex);
+   for (UnsignedInt i = 0; i < registeredIndices.size(); ++i)
+      for (UnsignedInt j = 0; j < registeredIndices[i]->hits.size(); ++j)
+         registeredIndices[i]->hits[j].store(0);
+}
+
+//------------------------------------------------------------------------------
+// std::string GetStatisticsReport(Integer maxEntries)
+//------------------------------------------------------------------------------
+/**
+ * Builds a report of the labels looked up most often by string.
+ *
+ * @param maxEntries The number of labels listed
+ *
+ * @return The report, one "Class.Label  count" line per label
+ */
+//------------------------------------------------------------------------------
+std::string ParameterIndex::GetStatisticsReport(Integer maxEntries)
+{
+   std::vector<LookupCount> counts;
+   unsigned long total = 0;
+   {
+      std::lock_guard<std::mutex> lock(registryMutex);
+      for (UnsignedInt i = 0; i < registeredIndices.size(); ++i)
+      {
+         const ParameterIndex *index = registeredIndices[i];
+         for (UnsignedInt j = 0; j < index->hits.size(); ++j)
+         {
+            unsigned long count = index->hits[j].load();
+            if (count == 0)
+               continue;
+            LookupCount entry;
+            entry.label = index->owner + "." + index->labels[j];
+            entry.count = count;
+            counts.push_back(entry);
+            total += count;
+         }
+      }
+   }
+
+   std::sort(counts.begin(), counts.end(), MoreHits);
+   if ((maxEntries >= 0) && ((Integer)counts.size() > maxEntries))
+      counts.resize(maxEntries);
+
+   std::stringstream report;
+   report << "Parameter lookups by label: " << total << " total\n";
+   for (UnsignedInt i = 0; i < counts.size(); ++i)
+   {
+      report << "   " << std::left << std::setw(48) << counts[i].label
+             << counts[i].count << "\n";
+   }
+
+   return report.str();
+}
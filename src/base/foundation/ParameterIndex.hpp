@@ -0,0 +1,86 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                               ParameterIndex
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/16
+//
+/**
+ * Declares the ParameterIndex class, a hashed label to ID index for the
+ * PARAMETER_TEXT table of a GmatBase subclass.
+ *
+ * GetParameterID() overrides declare the index as a function-local static, so
+ * it is built once per class on the first lookup:
+ *
+ *    static const ParameterIndex parameterIndex("DragForce", PARAMETER_TEXT,
+ *          PhysicalModelParamCount, DragForceParamCount);
+ *    Integer id = parameterIndex.Find(str);
+ *    if (id != -1)
+ *       return id;
+ *
+ * When statistics are enabled each successful lookup is counted, and
+ * GetStatisticsReport() lists the labels looked up most often by string.
+ */
+//------------------------------------------------------------------------------
+#ifndef ParameterIndex_hpp
+#define ParameterIndex_hpp
+
+#include "gmatdefs.hpp"
+#include <atomic>
+#include <unordered_map>
+
+class GMAT_API ParameterIndex
+{
+public:
+   ParameterIndex(const std::string &owner, const std::string *labels,
+                  Integer firstId, Integer endId);
+   ~ParameterIndex();
+
+   Integer              Find(const std::string &label) const;
+
+   static void          SetStatisticsEnabled(bool enabled);
+   static bool          IsStatisticsEnabled();
+   static void          ResetStatistics();
+   static std::string   GetStatisticsReport(Integer maxEntries = 20);
+
+protected:
+   /// Name of the class that owns the table
+   std::string          owner;
+   /// ID of the first label in the table
+   Integer              firstId;
+   /// The labels, by (ID - firstId)
+   StringArray          labels;
+   /// Label to ID map
+   std::unordered_map<std::string, Integer>
+                        ids;
+   /// Successful lookups, by (ID - firstId)
+   mutable std::vector<std::atomic<unsigned long>>
+                        hits;
+
+   /// Set when lookups are counted
+   static std::atomic<bool>
+                        collectStatistics;
+
+private:
+   // Indices are registered by address; copies are not allowed
+   ParameterIndex(const ParameterIndex &pi);
+   ParameterIndex& operator=(const ParameterIndex &pi);
+};
+
+#endif // ParameterIndex_hpp
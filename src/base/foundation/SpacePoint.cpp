@@ -38,6 +38,7 @@
 #include "gmatdefs.hpp"
 #include "GmatBase.hpp"
 #include "SpacePoint.hpp"
+#include "ParameterIndex.hpp"
 #include "A1Mjd.hpp"
 #include "Rvector6.hpp"
 #include "Rvector3.hpp"
@@ -1213,11 +1214,11 @@ std::string SpacePoint::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer SpacePoint::GetParameterID(const std::string &str) const
 {
-   for (Integer i = GmatBaseParamCount; i < SpacePointParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatBaseParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("SpacePoint", PARAMETER_TEXT,
+         GmatBaseParamCount, SpacePointParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
    
    return GmatBase::GetParameterID(str);
 }
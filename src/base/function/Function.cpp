@@ -30,6 +30,7 @@
 //------------------------------------------------------------------------------
 
 #include "Function.hpp"
+#include "ParameterIndex.hpp"
 #include "FunctionException.hpp"    // for exception
 #include "StringUtil.hpp"           // for GmatStringUtil::
 #include "Parameter.hpp"            // for GetOwner()
@@ -388,11 +389,11 @@ std::string Function::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer Function::GetParameterID(const std::string &str) const
 {
-   for (Integer i = FUNCTION_PATH; i < FunctionParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatBaseParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("Function", PARAMETER_TEXT,
+         GmatBaseParamCount, FunctionParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
    
    return GmatBase::GetParameterID(str);
 }
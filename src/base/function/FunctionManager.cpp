@@ -42,6 +42,10 @@
 #include "StringVar.hpp"
 #include "UserDefinedFunction.hpp"
 #include "MessageInterface.hpp"
+#include <chrono>                // for the call statistics
+#include <cstring>               // for memcmp()
+#include <iomanip>
+#include <sstream>
 
 //#define DO_NOT_EXECUTE_NESTED_GMAT_FUNCTIONS
 
@@ -82,6 +86,52 @@
 //---------------------------------
 // static data
 //---------------------------------
+std::atomic<bool> FunctionManager::collectStatistics(false);
+std::map<std::string, FunctionManager::CallStatistics>
+                  FunctionManager::callStatistics;
+std::mutex        FunctionManager::statisticsMutex;
+
+namespace
+{
+   typedef std::chrono::steady_clock StatClock;
+   
+   /// Seconds between two clock readings
+   Real Seconds(const StatClock::time_point &from, const StatClock::time_point &to)
+   {
+      return std::chrono::duration<Real>(to - from).count();
+   }
+   
+   /// Orders report lines by total time, longest first
+   bool MoreTime(const std::pair<std::string, Real> &a,
+                 const std::pair<std::string, Real> &b)
+   {
+      return a.second > b.second;
+   }
+}
+
+//------------------------------------------------------------------------------
+// CallPlan()
+//------------------------------------------------------------------------------
+FunctionManager::CallPlan::CallPlan() :
+   isBuilt             (false),
+   localStore          (NULL)
+{
+}
+
+//------------------------------------------------------------------------------
+// CallStatistics()
+//------------------------------------------------------------------------------
+FunctionManager::CallStatistics::CallStatistics() :
+   calls               (0),
+   setups              (0),
+   pooledObjects       (0),
+   skippedCopies       (0),
+   prepareTime         (0.0),
+   initializeTime      (0.0),
+   executeTime         (0.0),
+   resultTime          (0.0)
+{
+}
 
 //---------------------------------
 // public methods
@@ -147,6 +197,7 @@ FunctionManager::~FunctionManager()
    DeleteObjectMap(functionObjectStore, "FOS in Destructor");
    functionObjectStore = NULL;
    ClearInOutWrappers();
+   ClearCallPlan();
 }
 
 
@@ -231,6 +282,7 @@ FunctionManager& FunctionManager::operator=(const FunctionManager &fm)
       internalCS          = fm.internalCS;  // right?
       fcs                 = NULL;
       callingFunction     = NULL;
+      ClearCallPlan();
    }
    return *this;
 }
@@ -362,6 +414,7 @@ void FunctionManager::SetFunction(Function *theFunction)
    
    currentFunction = (ObjectManagedFunction*)theFunction;
    currentFunction->SetStringParameter("FunctionName", functionName);
+   ClearCallPlan();
    
    // // Now BuiltinGmatFunction should be also allowed (LOJ: 2016.05.04)
    // if (currentFunction->IsOfType("GmatFunction") ||
@@ -402,6 +455,8 @@ void FunctionManager::AddInput(const std::string &withName, Integer atIndex)
        atIndex);
    #endif
    
+   ClearCallPlan();
+   
    // -999 means to put it at the end of the list (default value/behavior)
    if ((atIndex == -999) || (atIndex == (Integer) passedIns.size()))
    {
@@ -447,6 +502,7 @@ void FunctionManager::AddOutput(const std::string &withName, Integer atIndex)
 //------------------------------------------------------------------------------
 void FunctionManager::SetInputs(const StringArray &inputs)
 {
+   ClearCallPlan();
    passedIns = inputs;
 }
 
@@ -850,6 +906,9 @@ bool FunctionManager::Initialize()
    ShowObjectMap(globalObjectStore, "In FunctionManager::Initialize(), GOS to be used in the function");
    #endif
    
+   // The FOS and the input objects are rebuilt, so plan again on the next call
+   ClearCallPlan();
+   
    // clonedObjectStores should not be cleared for recursive call to work
    //clonedObjectStores.clear();
    functionObjectStore = new ObjectMap;
@@ -910,11 +969,21 @@ bool FunctionManager::Execute(FunctionManager *callingFM)
    MessageInterface::ShowMessage("   === firstExecution=%d\n", firstExecution);
    #endif
    
+   bool timeCall = collectStatistics.load(std::memory_order_relaxed);
+   StatClock::time_point tick, tock;
+   if (timeCall)
+      tick = StatClock::now();
+   // Reuse counts are collected by the refresh methods in currentCall
+   CallStatistics call;
+   call.calls = 1;
+   currentCall = CallStatistics();
+   
    PrepareObjectMap();
    PrepareExecution(callingFM);
    
    if (firstExecution)
    {
+      call.setups = 1;
       #ifdef DEBUG_FM_EXECUTE
       MessageInterface::ShowMessage("   First execution, so calling Initialize()\n");
       #endif
@@ -940,6 +1009,15 @@ bool FunctionManager::Execute(FunctionManager *callingFM)
    ShowObjectMap(globalObjectStore, "GOS to pass to function");
    #endif
    
+   if (timeCall)
+   {
+      tock = StatClock::now();
+      call.prepareTime = Seconds(tick, tock);
+      tick = tock;
+   }
+   call.pooledObjects = currentCall.pooledObjects;
+   call.skippedCopies = currentCall.skippedCopies;
+   
    // pass the FOS/GOS and other objects into the function
    currentFunction->SetFunctionObjectMap(functionObjectStore);
    currentFunction->SetGlobalObjectMap(globalObjectStore);
@@ -1057,6 +1135,13 @@ bool FunctionManager::Execute(FunctionManager *callingFM)
       }
    }
    
+   if (timeCall)
+   {
+      tock = StatClock::now();
+      call.initializeTime = Seconds(tick, tock);
+      tick = tock;
+   }
+   
    
    #ifdef DEBUG_FM_EXECUTE
    MessageInterface::ShowMessage
@@ -1085,6 +1170,7 @@ bool FunctionManager::Execute(FunctionManager *callingFM)
             publisher->ClearPublishedData();
          
          Cleanup();
+         RecordCall(call);
          return false;
       }
    }
@@ -1098,9 +1184,17 @@ bool FunctionManager::Execute(FunctionManager *callingFM)
          publisher->ClearPublishedData();
       
       Cleanup();
+      RecordCall(call);
       return false;
    }
    
+   if (timeCall)
+   {
+      tock = StatClock::now();
+      call.executeTime = Seconds(tick, tock);
+      tick = tock;
+   }
+   
    #ifdef DEBUG_FM_EXECUTE
    MessageInterface::ShowMessage
       ("======================================================= currentFunction->Execute() DONE\n");
@@ -1110,7 +1204,12 @@ bool FunctionManager::Execute(FunctionManager *callingFM)
    AssignResult();
    
    // Now deal with the calling function here
-   if (!HandleCallStack())
+   bool handled = HandleCallStack();
+   if (timeCall)
+      call.resultTime = Seconds(tick, StatClock::now());
+   RecordCall(call);
+   
+   if (!handled)
    {
       Cleanup();
       return false;
@@ -1276,6 +1375,95 @@ bool FunctionManager::IsFinalized()
 //    return true;
 }
 
+//------------------------------------------------------------------------------
+// void SetStatisticsEnabled(bool enabled)
+//------------------------------------------------------------------------------
+/**
+ * Turns the timing and counting of function calls on or off.
+ *
+ * @param enabled true to collect call statistics
+ */
+//------------------------------------------------------------------------------
+void FunctionManager::SetStatisticsEnabled(bool enabled)
+{
+   collectStatistics.store(enabled);
+}
+
+//------------------------------------------------------------------------------
+// bool IsStatisticsEnabled()
+//------------------------------------------------------------------------------
+bool FunctionManager::IsStatisticsEnabled()
+{
+   return collectStatistics.load();
+}
+
+//------------------------------------------------------------------------------
+// void ResetStatistics()
+//------------------------------------------------------------------------------
+/**
+ * Discards the statistics collected so far.
+ */
+//------------------------------------------------------------------------------
+void FunctionManager::ResetStatistics()
+{
+   std::lock_guard<std::mutex> lock(statisticsMutex);
+   callStatistics.clear();
+}
+
+//------------------------------------------------------------------------------
+// std::string GetStatisticsReport()
+//------------------------------------------------------------------------------
+/**
+ * Builds a report of the function calls made since the last reset.
+ *
+ * Functions are listed by total time.  Setups are the calls that built the
+ * function object store from scratch; the other calls refreshed it.  Pooled
+ * counts the local objects reset in place instead of cloned, and Skipped the
+ * passed inputs that did not need to be copied.
+ *
+ * @return The report, one line per function
+ */
+//------------------------------------------------------------------------------
+std::string FunctionManager::GetStatisticsReport()
+{
+   std::lock_guard<std::mutex> lock(statisticsMutex);
+   
+   std::vector<std::pair<std::string, Real> > order;
+   std::map<std::string, CallStatistics>::const_iterator i;
+   for (i = callStatistics.begin(); i != callStatistics.end(); ++i)
+   {
+      const CallStatistics &cs = i->second;
+      order.push_back(std::make_pair(i->first, cs.prepareTime +
+            cs.initializeTime + cs.executeTime + cs.resultTime));
+   }
+   std::sort(order.begin(), order.end(), MoreTime);
+   
+   std::stringstream report;
+   report << "Function calls: " << order.size() << " function(s)\n"
+          << "   " << std::left << std::setw(24) << "Function" << std::right
+          << std::setw(9) << "Calls" << std::setw(8) << "Setups"
+          << std::setw(9) << "Pooled" << std::setw(9) << "Skipped"
+          << std::setw(11) << "Total ms" << std::setw(10) << "Prepare"
+          << std::setw(10) << "Init" << std::setw(10) << "Execute"
+          << std::setw(10) << "Result" << "\n";
+   report << std::fixed << std::setprecision(3);
+   for (UnsignedInt j = 0; j < order.size(); ++j)
+   {
+      const CallStatistics &cs = callStatistics[order[j].first];
+      report << "   " << std::left << std::setw(24) << order[j].first
+             << std::right << std::setw(9) << cs.calls
+             << std::setw(8) << cs.setups << std::setw(9) << cs.pooledObjects
+             << std::setw(9) << cs.skippedCopies
+             << std::setw(11) << order[j].second * 1000.0
+             << std::setw(10) << cs.prepareTime * 1000.0
+             << std::setw(10) << cs.initializeTime * 1000.0
+             << std::setw(10) << cs.executeTime * 1000.0
+             << std::setw(10) << cs.resultTime * 1000.0 << "\n";
+   }
+   
+   return report.str();
+}
+
 //---------------------------------
 // protected methods
 //---------------------------------
@@ -1673,52 +1861,47 @@ void FunctionManager::RefreshFOS()
       throw FunctionException
          ("FunctionManager::RefreshFOS() function pointer is NULL");
    
-   // Need to delete all items in the FOS that are not inputs (so that they can 
-   // properly be created again in the FCS 
-   StringArray toDelete;
-   bool        isInput = false;
-   std::map<std::string, GmatBase *>::iterator omi;
-   StringArray formalNames =
-      currentFunction->GetStringArrayParameter(currentFunction->GetParameterID("Input"));
-   StringArray outFormalNames =
-      currentFunction->GetStringArrayParameter(currentFunction->GetParameterID("Output"));
+   // The formal names and the poolable locals do not change between calls
+   if (!callPlan.isBuilt || (callPlan.localStore != localObjectStore))
+      BuildCallPlan();
    
-   // combine the lists of inputs/outputs 
-   for (Integer ii = 0; ii < outFormalNames.size(); ii++)
-      formalNames.push_back(outFormalNames.at(ii));
-
    #ifdef DEBUG_FM_REFRESH
    MessageInterface::ShowMessage
-      ("   Function '%s' has %d inputs and FOS <%p> has %d objects\n",
-       functionName.c_str(), formalNames.size(), functionObjectStore, functionObjectStore->size());
-   MessageInterface::ShowMessage("  inputs are:\n");
-   for (Integer ii = 0; ii < formalNames.size(); ii++)
-      MessageInterface::ShowMessage("   %d  %s\n", ii,
-                                    formalNames.at(ii).c_str());
+      ("   Function '%s' has %d formal arguments and FOS <%p> has %d objects\n",
+       functionName.c_str(), callPlan.formalArguments.size(), functionObjectStore,
+       functionObjectStore->size());
    #endif
-
+   
+   // Need to delete all items in the FOS that are not inputs (so that they can 
+   // properly be created again in the FCS). Locals of the simple Parameter
+   // types are reset to their initial values in place instead; the function
+   // finds them in the FOS and does not clone them again.
+   StringArray toDelete;
+   std::map<std::string, GmatBase *>::iterator omi;
    for (omi = functionObjectStore->begin(); omi != functionObjectStore->end(); ++omi)
    {
-      isInput = false;
-      for (unsigned int qq = 0; qq < formalNames.size(); qq++)
-         if (omi->first == formalNames.at(qq))
-         {
-            isInput = true;
-            break;
-         }
-      if (!isInput) 
-      {  
-         if (omi->second != NULL)
-         {
-            #ifdef DEBUG_MEMORY
-            MemoryTracker::Instance()->Remove
-               (omi->second, (omi->second)->GetName(), "FunctionManager::RefreshFOS()");
-            #endif
-            delete omi->second;
-            omi->second = NULL;
-         }
-         toDelete.push_back(omi->first); 
+      if (callPlan.formalArguments.find(omi->first) !=
+          callPlan.formalArguments.end())
+         continue;
+      
+      ObjectMap::iterator proto = callPlan.localPrototypes.find(omi->first);
+      if ((proto != callPlan.localPrototypes.end()) &&
+          ResetLocalObject(omi->second, proto->second))
+      {
+         ++currentCall.pooledObjects;
+         continue;
+      }
+      
+      if (omi->second != NULL)
+      {
+         #ifdef DEBUG_MEMORY
+         MemoryTracker::Instance()->Remove
+            (omi->second, (omi->second)->GetName(), "FunctionManager::RefreshFOS()");
+         #endif
+         delete omi->second;
+         omi->second = NULL;
       }
+      toDelete.push_back(omi->first); 
    }
    for (unsigned int kk = 0; kk < toDelete.size(); kk++)
    {
@@ -1755,8 +1938,11 @@ void FunctionManager::RefreshFormalInputObjects()
    #endif
    
    std::string formalName, passedName;
+   if (!callPlan.isBuilt || (callPlan.localStore != localObjectStore))
+      BuildCallPlan();
+   
    // Get function formal input argument names (parameters)
-   StringArray inFormalNames = currentFunction->GetStringArrayParameter(currentFunction->GetParameterID("Input"));
+   const StringArray &inFormalNames = callPlan.formalInputs;
    
    // Find and/or evaluate the input objects
    for (unsigned int ii=0; ii<passedIns.size(); ii++)
@@ -1764,6 +1950,7 @@ void FunctionManager::RefreshFormalInputObjects()
       // Get the object from the object store first 
       formalName = inFormalNames.at(ii);
       passedName = passedIns.at(ii);
+      InputPlan &inputPlan = callPlan.inputs.at(ii);
       
       #ifdef DEBUG_FM_EXECUTE
       MessageInterface::ShowMessage
@@ -1808,10 +1995,28 @@ void FunctionManager::RefreshFormalInputObjects()
       MessageInterface::ShowMessage("   gosObjFormal=<%p>\n", gosObjFormal);
       #endif
       
+      // Literals never change, and Real values derived from other objects
+      // (such as array elements) are evaluated into the same object each call.
+      // The object created with the FOS is the formal input itself, so the
+      // first refresh still creates a separate one below.
+      if (inputPlan.source == LITERAL_INPUT)
+      {
+         ObjectMap::iterator lit = createdLiterals.find(passedName);
+         if (lit != createdLiterals.end())
+            objPassed = lit->second;
+      }
+      else if (inputPlan.source == DERIVED_INPUT)
+      {
+         ObjectMap::iterator other = createdOthers.find(passedName);
+         if ((other != createdOthers.end()) && (other->second != fosObjFormal) &&
+             UpdateDerivedInput(inputPlan, passedName, other->second))
+            objPassed = other->second;
+      }
+      
       // Now find the corresponding input object
       // if passed name not found in LOS or GOS, it may be a number, string literal,
       // array element, or automatic object such as sat.X
-      if (!(objPassed = FindObject(passedName)))
+      if (objPassed == NULL && !(objPassed = FindObject(passedName)))
       {
          #ifdef DEBUG_FM_EXECUTE
          ShowObjectMap(&createdLiterals, "createdLiterals map in RefreshFormalInputObjects");
@@ -1899,9 +2104,20 @@ void FunctionManager::RefreshFormalInputObjects()
       
       // Update the object in the function or global object store with the current/reset data
       // If global object use global object store (LOJ: 2015.10.19 for GMT-5336 fix)
+      // The copy is skipped when neither the caller nor the function changed
+      // the value since the last call
       if (fosObjFormal)
       {
-         fosObjFormal->Copy(objPassed);
+         if (fosObjFormal == objPassed)
+            ++currentCall.skippedCopies;
+         else if (HasSameValue(fosObjFormal, objPassed))
+         {
+            // Copy() would also take over the local flag
+            fosObjFormal->SetIsLocal(objPassed->IsLocal());
+            ++currentCall.skippedCopies;
+         }
+         else
+            fosObjFormal->Copy(objPassed);
          (inputWrapperMap[formalName])->SetRefObject(fosObjFormal);  // is this necessary? I think so
       }
       else if (gosObjFormal)
@@ -1916,6 +2132,257 @@ void FunctionManager::RefreshFormalInputObjects()
 }
 
 
+//------------------------------------------------------------------------------
+// void BuildCallPlan()
+//------------------------------------------------------------------------------
+/*
+ * Records what RefreshFOS() and RefreshFormalInputObjects() need on every call
+ * from this call site: the formal argument names, the locals that can be
+ * reset in place, and where each passed input comes from.  The plan is
+ * dropped whenever the FOS is set up again.
+ */
+//------------------------------------------------------------------------------
+void FunctionManager::BuildCallPlan()
+{
+   ClearCallPlan();
+   
+   callPlan.formalInputs =
+      currentFunction->GetStringArrayParameter(currentFunction->GetParameterID("Input"));
+   StringArray outFormalNames =
+      currentFunction->GetStringArrayParameter(currentFunction->GetParameterID("Output"));
+   callPlan.formalArguments.insert(callPlan.formalInputs.begin(),
+                                   callPlan.formalInputs.end());
+   callPlan.formalArguments.insert(outFormalNames.begin(), outFormalNames.end());
+   
+   // Locals that the function clones from its own object map on each call
+   if (currentFunction->IsOfType("UserDefinedFunction"))
+   {
+      ObjectMap *funcObjects =
+         ((UserDefinedFunction*)currentFunction)->GetFunctionObjectMap();
+      std::map<std::string, GmatBase *>::iterator omi;
+      for (omi = funcObjects->begin(); omi != funcObjects->end(); ++omi)
+      {
+         if ((omi->second == NULL) ||
+             (callPlan.formalArguments.find(omi->first) !=
+              callPlan.formalArguments.end()))
+            continue;
+         std::string type = (omi->second)->GetTypeName();
+         if ((type == "Variable") || (type == "Array") || (type == "String"))
+            callPlan.localPrototypes[omi->first] = omi->second;
+      }
+   }
+   
+   for (UnsignedInt ii = 0; ii < passedIns.size(); ii++)
+   {
+      InputPlan inputPlan;
+      inputPlan.source = STORE_INPUT;
+      inputPlan.wrapper = NULL;
+      
+      const std::string &passedName = passedIns[ii];
+      if (FindObject(passedName) == NULL)
+      {
+         if (createdLiterals.find(passedName) != createdLiterals.end())
+            inputPlan.source = LITERAL_INPUT;
+         else if (createdOthers.find(passedName) != createdOthers.end())
+         {
+            inputPlan.source = CREATED_INPUT;
+            
+            // Same wrapper CreateObject() builds, kept for Real values
+            ElementWrapper *ew = NULL;
+            try
+            {
+               validator->SetObjectMap(&combinedObjectStore);
+               validator->SetSolarSystem(solarSys);
+               ew = validator->CreateElementWrapper(passedName, false, 2);
+            }
+            catch (BaseException &)
+            {
+               ew = NULL;
+            }
+            
+            if (ew)
+            {
+               Gmat::WrapperDataType wType = ew->GetWrapperType();
+               if ((wType == Gmat::ARRAY_ELEMENT_WT) || (wType == Gmat::NUMBER_WT) ||
+                   (wType == Gmat::VARIABLE_WT) || (wType == Gmat::INTEGER_WT))
+               {
+                  inputPlan.source = DERIVED_INPUT;
+                  inputPlan.wrapper = ew;
+               }
+               else
+                  delete ew;
+            }
+         }
+      }
+      
+      #ifdef DEBUG_FM_REFRESH
+      MessageInterface::ShowMessage
+         ("   Plan for input '%s': source %d, wrapper <%p>\n", passedName.c_str(),
+          inputPlan.source, inputPlan.wrapper);
+      #endif
+      callPlan.inputs.push_back(inputPlan);
+   }
+   
+   callPlan.localStore = localObjectStore;
+   callPlan.isBuilt = true;
+}
+
+
+//------------------------------------------------------------------------------
+// void ClearCallPlan()
+//------------------------------------------------------------------------------
+void FunctionManager::ClearCallPlan()
+{
+   for (UnsignedInt i = 0; i < callPlan.inputs.size(); ++i)
+      delete callPlan.inputs[i].wrapper;
+   
+   callPlan.inputs.clear();
+   callPlan.formalInputs.clear();
+   callPlan.formalArguments.clear();
+   callPlan.localPrototypes.clear();
+   callPlan.localStore = NULL;
+   callPlan.isBuilt = false;
+}
+
+
+//------------------------------------------------------------------------------
+// bool ResetLocalObject(GmatBase *obj, GmatBase *prototype)
+//------------------------------------------------------------------------------
+/*
+ * Sets a local object left in the FOS by the previous call back to the state
+ * of the clone the function would create for this call.
+ *
+ * @return true if the object was reset, false if it has to be recreated
+ */
+//------------------------------------------------------------------------------
+bool FunctionManager::ResetLocalObject(GmatBase *obj, GmatBase *prototype)
+{
+   if ((obj == NULL) || (obj == prototype) || !obj->IsLocal() || obj->IsGlobal())
+      return false;
+   if (obj->GetTypeName() != prototype->GetTypeName())
+      return false;
+   
+   obj->Copy(prototype);
+   obj->SetIsLocal(true);
+   
+   #ifdef DEBUG_FM_REFRESH
+   MessageInterface::ShowMessage
+      ("   reset local '%s' <%p> in place\n", obj->GetName().c_str(), obj);
+   #endif
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// bool UpdateDerivedInput(InputPlan &plan, const std::string &passedName,
+//                         GmatBase *obj)
+//------------------------------------------------------------------------------
+/*
+ * Evaluates a Real passed input, such as an array element, into the Variable
+ * created for it on an earlier call.
+ *
+ * @return true if the value was updated, false if the object has to be
+ *         created again
+ */
+//------------------------------------------------------------------------------
+bool FunctionManager::UpdateDerivedInput(InputPlan &plan,
+                                         const std::string &passedName,
+                                         GmatBase *obj)
+{
+   if ((plan.wrapper == NULL) || (obj == NULL) || (obj->GetTypeName() != "Variable"))
+      return false;
+   
+   if (plan.wrapper->GetWrapperType() == Gmat::ARRAY_ELEMENT_WT)
+   {
+      // CreateObject() reports the missing array
+      GmatBase *refObj = FindObject(passedName, true);
+      if (refObj == NULL)
+         return false;
+      plan.wrapper->SetRefObject(refObj);
+   }
+   
+   ((Variable*)obj)->SetReal(plan.wrapper->EvaluateReal());
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// bool HasSameValue(GmatBase *obj, GmatBase *source)
+//------------------------------------------------------------------------------
+/*
+ * Checks if copying source to obj would leave obj unchanged.  Only Variables,
+ * Strings and Arrays are compared; other objects are always copied.
+ */
+//------------------------------------------------------------------------------
+bool FunctionManager::HasSameValue(GmatBase *obj, GmatBase *source)
+{
+   if ((obj == NULL) || (source == NULL))
+      return false;
+   
+   std::string type = obj->GetTypeName();
+   if (type != source->GetTypeName())
+      return false;
+   
+   // Compare bits, so that -0.0 and NaN payloads are still copied
+   if (type == "Variable")
+   {
+      Real value = ((Variable*)obj)->GetReal();
+      Real sourceValue = ((Variable*)source)->GetReal();
+      return memcmp(&value, &sourceValue, sizeof(Real)) == 0;
+   }
+   
+   if (type == "String")
+      return ((StringVar*)obj)->GetString() == ((StringVar*)source)->GetString();
+   
+   if (type == "Array")
+   {
+      const Rmatrix &mat = ((Array*)obj)->GetRmatrix();
+      const Rmatrix &sourceMat = ((Array*)source)->GetRmatrix();
+      Integer rows, cols, sourceRows, sourceCols;
+      mat.GetSize(rows, cols);
+      sourceMat.GetSize(sourceRows, sourceCols);
+      if ((rows != sourceRows) || (cols != sourceCols))
+         return false;
+      for (Integer r = 0; r < rows; ++r)
+         for (Integer c = 0; c < cols; ++c)
+         {
+            Real value = mat(r, c);
+            Real sourceValue = sourceMat(r, c);
+            if (memcmp(&value, &sourceValue, sizeof(Real)) != 0)
+               return false;
+         }
+      return true;
+   }
+   
+   return false;
+}
+
+
+//------------------------------------------------------------------------------
+// void RecordCall(const CallStatistics &call)
+//------------------------------------------------------------------------------
+/*
+ * Adds the counts and times of one call to the statistics of the function.
+ */
+//------------------------------------------------------------------------------
+void FunctionManager::RecordCall(const CallStatistics &call)
+{
+   if (!collectStatistics.load(std::memory_order_relaxed))
+      return;
+   
+   std::lock_guard<std::mutex> lock(statisticsMutex);
+   CallStatistics &cs = callStatistics[functionName];
+   cs.calls          += call.calls;
+   cs.setups         += call.setups;
+   cs.pooledObjects  += call.pooledObjects;
+   cs.skippedCopies  += call.skippedCopies;
+   cs.prepareTime    += call.prepareTime;
+   cs.initializeTime += call.initializeTime;
+   cs.executeTime    += call.executeTime;
+   cs.resultTime     += call.resultTime;
+}
+
+
 //------------------------------------------------------------------------------
 // GmatBase* FindObject(const std::string &name, bool arrayElementsAllowed = false)
 //------------------------------------------------------------------------------
@@ -2655,6 +3122,7 @@ void FunctionManager::Cleanup()
       clonedObjectStores[i] = NULL;
    }
    clonedObjectStores.clear();
+   ClearCallPlan();
    
    #ifdef DEBUG_CLEANUP
    MessageInterface::ShowMessage("==> FunctionManager::Cleanup() exiting\n");
@@ -37,6 +37,9 @@
 #include <map>              // for mapping between object names and types
 #include <stack>            // for objectMap and caller stacks
 #include <algorithm>        // for find()
+#include <set>              // for the formal argument names of a call plan
+#include <mutex>            // for the call statistics
+#include <atomic>
 #include "gmatdefs.hpp"
 
 //#include "Function.hpp"
@@ -104,9 +107,83 @@ public:
    ObjectMap*           PushToStack();
    bool                 PopFromStack(ObjectMap* cloned, const StringArray &outNames, 
                                      const StringArray &callingNames);
+   
+   // Per function call statistics
+   static void          SetStatisticsEnabled(bool enabled);
+   static bool          IsStatisticsEnabled();
+   static void          ResetStatistics();
+   static std::string   GetStatisticsReport();
 
 protected:
    
+   /// Where RefreshFormalInputObjects() gets a passed input from
+   enum InputSource
+   {
+      STORE_INPUT,      // object in the LOS or GOS
+      LITERAL_INPUT,    // numeric or string literal in createdLiterals
+      DERIVED_INPUT,    // Real value in createdOthers, updated in place
+      CREATED_INPUT     // other value in createdOthers, created again per call
+   };
+   
+   /// How one passed input is refreshed
+   struct InputPlan
+   {
+      InputSource       source;
+      /// Wrapper evaluating a DERIVED_INPUT, owned by the plan
+      ElementWrapper    *wrapper;
+   };
+   
+   /// Call site data built on the first refresh and reused by later calls
+   struct CallPlan
+   {
+      CallPlan();
+      
+      bool              isBuilt;
+      /// The LOS the plan was built against
+      ObjectMap         *localStore;
+      /// Formal input names, in argument order
+      StringArray       formalInputs;
+      /// Formal input and output names
+      std::set<std::string>
+                        formalArguments;
+      /// Per passed input refresh method
+      std::vector<InputPlan>
+                        inputs;
+      /// Prototypes of locals that are reset in place instead of recreated
+      ObjectMap         localPrototypes;
+   };
+   
+   /// Time and reuse counts of the calls to one function
+   struct CallStatistics
+   {
+      CallStatistics();
+      
+      unsigned long     calls;
+      /// Calls that set up the FOS from scratch
+      unsigned long     setups;
+      /// Local objects reset in place instead of cloned
+      unsigned long     pooledObjects;
+      /// Passed inputs whose copy was already current
+      unsigned long     skippedCopies;
+      /// Seconds spent building or refreshing the FOS
+      Real              prepareTime;
+      /// Seconds spent initializing the function
+      Real              initializeTime;
+      /// Seconds spent running the function control sequence
+      Real              executeTime;
+      /// Seconds spent assigning outputs and restoring the caller
+      Real              resultTime;
+   };
+   
+   /// Set when calls are timed and counted
+   static std::atomic<bool>
+                        collectStatistics;
+   /// Statistics by function name
+   static std::map<std::string, CallStatistics>
+                        callStatistics;
+   /// Guards callStatistics
+   static std::mutex    statisticsMutex;
+   
    /// Publisher for data generation
    Publisher            *publisher;
    /// Object store for the Function 
@@ -177,6 +254,19 @@ protected:
    std::stack<FunctionManager*> callers;
    // pointer to the current calling function
    FunctionManager      *callingFunction;
+   /// Refresh plan for repeated calls from this call site
+   CallPlan             callPlan;
+   /// Reuse counts of the current call, for the statistics
+   CallStatistics       currentCall;
+   
+   void                 BuildCallPlan();
+   void                 ClearCallPlan();
+   bool                 ResetLocalObject(GmatBase *obj, GmatBase *prototype);
+   bool                 UpdateDerivedInput(InputPlan &plan,
+                                           const std::string &passedName,
+                                           GmatBase *obj);
+   bool                 HasSameValue(GmatBase *obj, GmatBase *source);
+   void                 RecordCall(const CallStatistics &call);
    void                 PrepareExecution(FunctionManager *callingFM = NULL);
    bool                 ValidateFunctionArguments();
    bool                 CreatePassingArgWrappers();
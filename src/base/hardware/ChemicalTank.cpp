@@ -28,6 +28,7 @@
 
 
 #include "ChemicalTank.hpp"
+#include "ParameterIndex.hpp"
 #include "StringUtil.hpp"          // for GmatStringUtil
 #include "HardwareException.hpp"
 #include "MessageInterface.hpp"
@@ -261,11 +262,11 @@ std::string ChemicalTank::GetParameterUnit(const Integer id) const
 //------------------------------------------------------------------------------
 Integer ChemicalTank::GetParameterID(const std::string &str) const
 {
-   for (Integer i = FuelTankParamCount; i < ChemicalTankParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - FuelTankParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("ChemicalTank", PARAMETER_TEXT,
+         FuelTankParamCount, ChemicalTankParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
 
    return FuelTank::GetParameterID(str);
 }
@@ -28,6 +28,7 @@
 
 
 #include "ChemicalThruster.hpp"
+#include "ParameterIndex.hpp"
 #include "StringUtil.hpp"
 #include "HardwareException.hpp"
 #include "MessageInterface.hpp"
@@ -311,11 +312,11 @@ std::string ChemicalThruster::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer ChemicalThruster::GetParameterID(const std::string &str) const
 {
-   for (Integer i = ThrusterParamCount; i < ChemicalThrusterParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - ThrusterParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("ChemicalThruster",
+         PARAMETER_TEXT, ThrusterParamCount, ChemicalThrusterParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
 
    return Thruster::GetParameterID(str);
 }
@@ -26,6 +26,7 @@
 //------------------------------------------------------------------------------
 #include "gmatdefs.hpp"
 #include "ConicalFOV.hpp"
+#include "ParameterIndex.hpp"
 #include "GmatConstants.hpp"
 #include "FieldOfViewException.hpp"
 #include "MessageInterface.hpp"
@@ -257,11 +258,11 @@ std::string ConicalFOV::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer ConicalFOV::GetParameterID(const std::string &str) const
 {
-   for (Integer i = FieldOfViewParamCount; i < ConicalFOVParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - FieldOfViewParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("ConicalFOV", PARAMETER_TEXT,
+         FieldOfViewParamCount, ConicalFOVParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
 
    return FieldOfView::GetParameterID(str);
 }
@@ -31,6 +31,7 @@
 #include <sstream>
 #include "utildefs.hpp"
 #include "CustomFOV.hpp"
+#include "ParameterIndex.hpp"
 #include "MessageInterface.hpp"
 #include "FieldOfViewException.hpp"
 #include "GmatConstants.hpp"
@@ -619,11 +620,11 @@ std::string CustomFOV::GetParameterText(const Integer id) const
  //------------------------------------------------------------------------------
 Integer CustomFOV::GetParameterID(const std::string &str) const
 {
-	for (Integer i = FieldOfViewParamCount; i < CustomFOVParamCount; i++)
-	{
-		if (str == PARAMETER_TEXT[i - FieldOfViewParamCount])
-			return i;
-	}
+	static const ParameterIndex parameterIndex("CustomFOV", PARAMETER_TEXT,
+	      FieldOfViewParamCount, CustomFOVParamCount);
+	Integer id = parameterIndex.Find(str);
+	if (id != -1)
+	   return id;
 	return FieldOfView::GetParameterID(str);
 }
 
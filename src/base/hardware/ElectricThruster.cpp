@@ -29,6 +29,7 @@
 
 
 #include "ElectricThruster.hpp"
+#include "ParameterIndex.hpp"
 //#include "ObjectReferencedAxes.hpp"
 #include "Spacecraft.hpp"
 #include "StringUtil.hpp"
@@ -358,11 +359,11 @@ std::string ElectricThruster::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer ElectricThruster::GetParameterID(const std::string &str) const
 {
-   for (Integer i = ThrusterParamCount; i < ElectricThrusterParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - ThrusterParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("ElectricThruster",
+         PARAMETER_TEXT, ThrusterParamCount, ElectricThrusterParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
 
    return Thruster::GetParameterID(str);
 }
@@ -27,6 +27,7 @@
 
 #include "gmatdefs.hpp"
 #include "FieldOfView.hpp"
+#include "ParameterIndex.hpp"
 #include "HardwareException.hpp"
 #include "GmatConstants.hpp"
 #include "RealUtilities.hpp"
@@ -181,11 +182,11 @@ std::string FieldOfView::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer FieldOfView::GetParameterID(const std::string &str) const
 {
-   for (Integer i = GmatBaseParamCount; i < FieldOfViewParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatBaseParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("FieldOfView", PARAMETER_TEXT,
+         GmatBaseParamCount, FieldOfViewParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
    
    return GmatBase::GetParameterID(str);
 }
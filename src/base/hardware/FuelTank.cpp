@@ -31,6 +31,7 @@
 
 
 #include "FuelTank.hpp"
+#include "ParameterIndex.hpp"
 #include "StringUtil.hpp"          // for GmatStringUtil
 #include "HardwareException.hpp"
 #include "MessageInterface.hpp"
@@ -214,11 +215,11 @@ std::string FuelTank::GetParameterUnit(const Integer id) const
 //------------------------------------------------------------------------------
 Integer FuelTank::GetParameterID(const std::string &str) const
 {
-   for (Integer i = HardwareParamCount; i < FuelTankParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - HardwareParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("FuelTank", PARAMETER_TEXT,
+         HardwareParamCount, FuelTankParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
    
    return Hardware::GetParameterID(str);
 }
@@ -31,6 +31,7 @@
 #include "MessageInterface.hpp"
 
 #include "Hardware.hpp"
+#include "ParameterIndex.hpp"
 #include "HardwareException.hpp"
 #include <string.h>
 
@@ -423,11 +424,11 @@ std::string Hardware::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer Hardware::GetParameterID(const std::string &str) const
 {
-   for (Integer i = GmatBaseParamCount; i < HardwareParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatBaseParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("Hardware", PARAMETER_TEXT,
+         GmatBaseParamCount, HardwareParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
    
    return GmatBase::GetParameterID(str);
 }
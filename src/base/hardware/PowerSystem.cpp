@@ -29,6 +29,7 @@
 
 
 #include "PowerSystem.hpp"
+#include "ParameterIndex.hpp"
 #include "StringUtil.hpp"          // for GmatStringUtil
 #include "Spacecraft.hpp"
 #include "HardwareException.hpp"
@@ -471,11 +472,11 @@ std::string PowerSystem::GetParameterUnit(const Integer id) const
 //------------------------------------------------------------------------------
 Integer PowerSystem::GetParameterID(const std::string &str) const
 {
-   for (Integer i = HardwareParamCount; i < PowerSystemParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - HardwareParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("PowerSystem", PARAMETER_TEXT,
+         HardwareParamCount, PowerSystemParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
 
    return Hardware::GetParameterID(str);
 }
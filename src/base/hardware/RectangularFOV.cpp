@@ -25,6 +25,7 @@
  */
  //------------------------------------------------------------------------------
 #include "RectangularFOV.hpp"
+#include "ParameterIndex.hpp"
 #include "RealUtilities.hpp"
 #include "GmatConstants.hpp"
 #include "FieldOfViewException.hpp"
@@ -312,11 +313,11 @@ std::string RectangularFOV::GetParameterText(const Integer id) const
  //------------------------------------------------------------------------------
 Integer RectangularFOV::GetParameterID(const std::string &str) const
 {
-	for (Integer i = FieldOfViewParamCount; i < RectangleFOVParamCount; i++)
-	{
-		if (str == PARAMETER_TEXT[i - FieldOfViewParamCount])
-			return i;
-	}
+	static const ParameterIndex parameterIndex("RectangularFOV", PARAMETER_TEXT,
+	      FieldOfViewParamCount, RectangleFOVParamCount);
+	Integer id = parameterIndex.Find(str);
+	if (id != -1)
+	   return id;
 
 	return FieldOfView::GetParameterID(str);
 }
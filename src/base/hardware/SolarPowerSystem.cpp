@@ -29,6 +29,7 @@
 
 
 #include "SolarPowerSystem.hpp"
+#include "ParameterIndex.hpp"
 #include "StringUtil.hpp"          // for GmatStringUtil
 #include "HardwareException.hpp"
 #include "MessageInterface.hpp"
@@ -600,11 +601,11 @@ std::string SolarPowerSystem::GetParameterUnit(const Integer id) const
 //------------------------------------------------------------------------------
 Integer SolarPowerSystem::GetParameterID(const std::string &str) const
 {
-   for (Integer i = PowerSystemParamCount; i < SolarPowerSystemParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - PowerSystemParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("SolarPowerSystem",
+         PARAMETER_TEXT, PowerSystemParamCount, SolarPowerSystemParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
 
    return PowerSystem::GetParameterID(str);
 }
@@ -31,6 +31,7 @@
 
 
 #include "Thruster.hpp"
+#include "ParameterIndex.hpp"
 #include "ObjectReferencedAxes.hpp"
 #include "Spacecraft.hpp"
 #include "StringUtil.hpp"
@@ -476,11 +477,11 @@ std::string Thruster::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer Thruster::GetParameterID(const std::string &str) const
 {
-   for (Integer i = HardwareParamCount; i < ThrusterParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - HardwareParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("Thruster", PARAMETER_TEXT,
+         HardwareParamCount, ThrusterParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
    
    if (str == "ThrustDirection1")
       return DIRECTION_X;
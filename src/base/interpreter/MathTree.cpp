@@ -31,6 +31,7 @@
 #include "MathTree.hpp"
 #include "MathFunction.hpp"
 #include "MathElement.hpp"
+#include "CompiledExpression.hpp"
 #include "FunctionRunner.hpp"
 #include "StringUtil.hpp"            // for GetArrayIndex()
 #include "InterpreterException.hpp"
@@ -64,7 +65,9 @@ MathTree::MathTree(const std::string &typeStr, const std::string &nomme) :
    theTopNode(NULL),
    theObjectMap(NULL),
    theGlobalObjectMap(NULL),
-   theWrapperMap(NULL)
+   theWrapperMap(NULL),
+   compiledExpression(new CompiledExpression()),
+   compileAttempted(false)
 {
 }
 
@@ -78,6 +81,8 @@ MathTree::MathTree(const std::string &typeStr, const std::string &nomme) :
 //------------------------------------------------------------------------------
 MathTree::~MathTree()
 {
+   delete compiledExpression;
+   
    // Need to delete all math nodes
    if (theTopNode)
    {
@@ -117,7 +122,10 @@ MathTree::MathTree(const MathTree &mt) :
    GmatBase           (mt),
    theTopNode         (mt.theTopNode),
    theObjectMap       (NULL),
-   theGlobalObjectMap (NULL)
+   theGlobalObjectMap (NULL),
+   theWrapperMap      (NULL),
+   compiledExpression (new CompiledExpression()),
+   compileAttempted   (false)
 {
 }
 
@@ -143,6 +151,7 @@ MathTree& MathTree::operator=(const MathTree &mt)
    theTopNode         = mt.theTopNode;
    theObjectMap       = NULL;
    theGlobalObjectMap = NULL;
+   ResetCompiledExpression();
    
    return *this;
 }
@@ -255,6 +264,7 @@ MathNode* MathTree::GetTopNode()
 void MathTree::SetTopNode(MathNode *node)
 {
    theTopNode = node;
+   ResetCompiledExpression();
 }
 
 
@@ -267,6 +277,7 @@ void MathTree::SetMathWrappers(std::map<std::string, ElementWrapper*> *wrapperMa
       return;
    
    theWrapperMap = wrapperMap;
+   ResetCompiledExpression();
    
    #ifdef DEBUG_MATH_WRAPPERS
    MessageInterface::ShowMessage
@@ -365,6 +376,14 @@ bool MathTree::Validate(std::string &msg)
 //------------------------------------------------------------------------------
 // void Evaluate() const
 //------------------------------------------------------------------------------
+/**
+ * Evaluates a Real valued tree.
+ *
+ * The first call after the wrappers are set lowers the tree into a
+ * CompiledExpression; later calls run that instead of walking the tree.
+ * Trees that cannot be compiled are walked as before.
+ */
+//------------------------------------------------------------------------------
 Real MathTree::Evaluate()
 {
    #ifdef DEBUG_MATH_TREE_EVAL
@@ -372,6 +391,15 @@ Real MathTree::Evaluate()
       ("MathTree::Evaluate() theTopNode=%s, %s\n", theTopNode->GetTypeName().c_str(),
        theTopNode->GetName().c_str());
    #endif
+   if (!compileAttempted)
+   {
+      compileAttempted = true;
+      compiledExpression->Compile(theTopNode);
+   }
+   
+   if (compiledExpression->IsCompiled())
+      return compiledExpression->Evaluate();
+   
    return theTopNode->Evaluate();
 }
 
@@ -408,6 +436,7 @@ bool MathTree::Initialize(ObjectMap *objectMap, ObjectMap *globalObjectMap)
       theObjectMap       = objectMap;
    if (globalObjectMap)
       theGlobalObjectMap = globalObjectMap;
+   ResetCompiledExpression();
    
    #ifdef DEBUG_MATH_TREE_INIT
    MessageInterface::ShowMessage
@@ -1283,3 +1312,17 @@ void MathTree::DeleteNode(MathNode *node)
       DeleteNode(right);
 }
 
+
+//------------------------------------------------------------------------------
+// void ResetCompiledExpression()
+//------------------------------------------------------------------------------
+/**
+ * Drops the compiled form, which holds pointers to the current wrappers; the
+ * next Evaluate() compiles the tree again.
+ */
+//------------------------------------------------------------------------------
+void MathTree::ResetCompiledExpression()
+{
+   compiledExpression->Clear();
+   compileAttempted = false;
+}
@@ -44,6 +44,7 @@ class SolarSystem;
 class PhysicalModel;
 class CoordinateSystem;
 class Publisher;
+class CompiledExpression;
 
 class GMAT_API MathTree : public GmatBase
 {
@@ -117,6 +118,11 @@ protected:
    std::vector<Function*> theFunctions;
    std::vector<MathNode*> nodesToDelete;
    
+   /// Flat form of the tree used by Evaluate(), built on first use
+   CompiledExpression *compiledExpression;
+   /// Set once compilation was tried for the current wrappers
+   bool compileAttempted;
+   
    bool InitializeParameter(MathNode *node);
    void FinalizeFunctionRunner(MathNode *node);
    void SetMathElementWrappers(MathNode *node);
@@ -132,6 +138,7 @@ protected:
                         const std::string &oldName, const std::string &newName);
    void CreateParameterNameArray(MathNode *node);
    void DeleteNode(MathNode *node);
+   void ResetCompiledExpression();
    
 };
 
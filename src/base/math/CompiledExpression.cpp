@@ -0,0 +1,468 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                             CompiledExpression
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/16
+//
+/**
+ * Implements the CompiledExpression class.
+ *
+ * Every operation calls the same GmatMathUtil routine as the Evaluate()
+ * method of its node, so the compiled and tree-walked values are identical.
+ */
+//------------------------------------------------------------------------------
+#include "CompiledExpression.hpp"
+#include "MathNode.hpp"
+#include "MathElement.hpp"
+#include "ElementWrapper.hpp"
+#include "RealUtilities.hpp"
+#include "MessageInterface.hpp"
+#include <cmath>
+#include <cstring>
+#include <sstream>
+
+//#define DEBUG_COMPILED_EXPRESSION
+
+namespace
+{
+   // Wrappers for the GmatMathUtil routines that take optional arguments
+   Real AbsFunction(Real x)      { return GmatMathUtil::Abs(x); }
+   Real AcosFunction(Real x)     { return GmatMathUtil::ACos(x); }
+   Real AcoshFunction(Real x)    { return GmatMathUtil::ACosh(x); }
+   Real AsinFunction(Real x)     { return GmatMathUtil::ASin(x); }
+   Real AsinhFunction(Real x)    { return GmatMathUtil::ASinh(x); }
+   Real AtanFunction(Real x)     { return GmatMathUtil::ATan(x); }
+   Real CeilFunction(Real x)     { return GmatMathUtil::Ceiling(x); }
+   Real CosFunction(Real x)      { return GmatMathUtil::Cos(x); }
+   Real CoshFunction(Real x)     { return GmatMathUtil::Cosh(x); }
+   Real DegToRadFunction(Real x) { return GmatMathUtil::DegToRad(x); }
+   Real ExpFunction(Real x)      { return GmatMathUtil::Exp(x); }
+   Real FixFunction(Real x)      { return GmatMathUtil::Fix(x); }
+   Real FloorFunction(Real x)    { return GmatMathUtil::Floor(x); }
+   Real LogFunction(Real x)      { return GmatMathUtil::Log(x); }
+   Real Log10Function(Real x)    { return GmatMathUtil::Log10(x); }
+   Real RadToDegFunction(Real x) { return GmatMathUtil::RadToDeg(x); }
+   Real SinFunction(Real x)      { return GmatMathUtil::Sin(x); }
+   Real SinhFunction(Real x)     { return GmatMathUtil::Sinh(x); }
+   Real SqrtFunction(Real x)     { return GmatMathUtil::Sqrt(x); }
+   Real TanFunction(Real x)      { return GmatMathUtil::Tan(x); }
+   Real TanhFunction(Real x)     { return GmatMathUtil::Tanh(x); }
+
+   Real PowerFunction(Real x, Real y) { return GmatMathUtil::Pow(x, y); }
+   Real Atan2Function(Real y, Real x) { return atan2(y, x); }
+
+   /// The single argument nodes, by type name
+   struct UnaryEntry
+   {
+      const char                       *typeName;
+      CompiledExpression::UnaryFunction function;
+   };
+
+   const UnaryEntry UNARY_FUNCTIONS[] =
+   {
+      { "Abs",      AbsFunction      },
+      { "Acos",     AcosFunction     },
+      { "Acosh",    AcoshFunction    },
+      { "Asin",     AsinFunction     },
+      { "Asinh",    AsinhFunction    },
+      { "Atan",     AtanFunction     },
+      { "Ceil",     CeilFunction     },
+      { "Cos",      CosFunction      },
+      { "Cosh",     CoshFunction     },
+      { "DegToRad", DegToRadFunction },
+      { "Exp",      ExpFunction      },
+      { "Fix",      FixFunction      },
+      { "Floor",    FloorFunction    },
+      { "Log",      LogFunction      },
+      { "Log10",    Log10Function    },
+      { "RadToDeg", RadToDegFunction },
+      { "Sin",      SinFunction      },
+      { "Sinh",     SinhFunction     },
+      { "Sqrt",     SqrtFunction     },
+      { "Tan",      TanFunction      },
+      { "Tanh",     TanhFunction     }
+   };
+
+   CompiledExpression::UnaryFunction FindUnaryFunction(
+         const std::string &typeName)
+   {
+      const Integer count = sizeof(UNARY_FUNCTIONS) / sizeof(UnaryEntry);
+      for (Integer i = 0; i < count; ++i)
+         if (typeName == UNARY_FUNCTIONS[i].typeName)
+            return UNARY_FUNCTIONS[i].function;
+      return NULL;
+   }
+}
+
+//------------------------------------------------------------------------------
+// CompiledExpression()
+//------------------------------------------------------------------------------
+CompiledExpression::CompiledExpression() :
+   resultSlot     (-1),
+   foldedCount    (0),
+   reusedCount    (0)
+{
+}
+
+//------------------------------------------------------------------------------
+// ~CompiledExpression()
+//------------------------------------------------------------------------------
+CompiledExpression::~CompiledExpression()
+{
+}
+
+//------------------------------------------------------------------------------
+// bool Compile(MathNode *topNode)
+//------------------------------------------------------------------------------
+/**
+ * Lowers a tree into the flat form.
+ *
+ * The element wrappers must be set on the tree; the program keeps pointers to
+ * them, so it has to be compiled again when the wrappers are replaced.
+ *
+ * @param topNode The top node of the tree
+ *
+ * @return true if the tree was compiled, false if it has to be evaluated
+ *         by walking the tree
+ */
+//------------------------------------------------------------------------------
+bool CompiledExpression::Compile(MathNode *topNode)
+{
+   Clear();
+   if (topNode == NULL)
+      return false;
+
+   try
+   {
+      resultSlot = Lower(topNode);
+   }
+   catch (BaseException &)
+   {
+      // Let the tree walker report the problem when it is evaluated
+      resultSlot = -1;
+   }
+   subexpressions.clear();
+
+   if (resultSlot < 0)
+   {
+      Clear();
+      return false;
+   }
+
+   #ifdef DEBUG_COMPILED_EXPRESSION
+      MessageInterface::ShowMessage("CompiledExpression: compiled %s into %d "
+            "instructions and %d slots, %d folded, %d reused\n",
+            topNode->GetName().c_str(), (Integer)program.size(),
+            (Integer)slots.size(), foldedCount, reusedCount);
+   #endif
+
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// void Clear()
+//------------------------------------------------------------------------------
+void CompiledExpression::Clear()
+{
+   program.clear();
+   slots.clear();
+   constantSlots.clear();
+   subexpressions.clear();
+   resultSlot  = -1;
+   foldedCount = 0;
+   reusedCount = 0;
+}
+
+//------------------------------------------------------------------------------
+// bool IsCompiled() const
+//------------------------------------------------------------------------------
+bool CompiledExpression::IsCompiled() const
+{
+   return resultSlot >= 0;
+}
+
+//------------------------------------------------------------------------------
+// Real Evaluate()
+//------------------------------------------------------------------------------
+/**
+ * Runs the program.
+ *
+ * @return The value of the expression
+ */
+//------------------------------------------------------------------------------
+Real CompiledExpression::Evaluate()
+{
+   Real *values = &slots[0];
+   for (std::vector<Instruction>::const_iterator i = program.begin();
+        i != program.end(); ++i)
+      values[i->result] = Execute(*i, values);
+   return values[resultSlot];
+}
+
+//------------------------------------------------------------------------------
+// Integer GetInstructionCount() const
+//------------------------------------------------------------------------------
+Integer CompiledExpression::GetInstructionCount() const
+{
+   return (Integer)program.size();
+}
+
+//------------------------------------------------------------------------------
+// Integer GetFoldedCount() const
+//------------------------------------------------------------------------------
+Integer CompiledExpression::GetFoldedCount() const
+{
+   return foldedCount;
+}
+
+//------------------------------------------------------------------------------
+// Integer GetReusedCount() const
+//------------------------------------------------------------------------------
+Integer CompiledExpression::GetReusedCount() const
+{
+   return reusedCount;
+}
+
+//------------------------------------------------------------------------------
+// Integer Lower(MathNode *node)
+//------------------------------------------------------------------------------
+/**
+ * Lowers a subtree, children first.
+ *
+ * Subexpressions are keyed by operation and operand slots.  Leaves and
+ * constants get one slot per wrapper or value, so equal keys mean equal
+ * subtrees.
+ *
+ * @param node The subtree
+ *
+ * @return The slot holding the value of the subtree, or -1 if the subtree
+ *         cannot be compiled
+ */
+//------------------------------------------------------------------------------
+Integer CompiledExpression::Lower(MathNode *node)
+{
+   if (node == NULL)
+      return -1;
+
+   Integer type, rowCount, colCount;
+   node->GetOutputInfo(type, rowCount, colCount);
+   if (type != Gmat::REAL_TYPE)
+      return -1;
+
+   Instruction instruction;
+   instruction.op      = LOAD;
+   instruction.result  = -1;
+   instruction.left    = -1;
+   instruction.right   = -1;
+   instruction.wrapper = NULL;
+   instruction.unary   = NULL;
+   instruction.binary  = NULL;
+
+   std::stringstream key;
+
+   if (!node->IsFunction())
+   {
+      if (node->IsFunctionInput())
+         return -1;
+
+      ElementWrapper *wrapper = ((MathElement*)node)->GetRealWrapper();
+      if (wrapper == NULL)
+         return AddConstant(node->GetRealValue());
+
+      instruction.wrapper = wrapper;
+      key << "W" << (void*)wrapper;
+      return AddInstruction(instruction, key.str());
+   }
+
+   std::string typeName = node->GetTypeName();
+   MathNode *leftNode  = node->GetLeft();
+   MathNode *rightNode = node->GetRight();
+
+   // Unary plus
+   if ((typeName == "Add") && (leftNode == NULL))
+      return Lower(rightNode);
+
+   bool binaryOp = true;
+   if (typeName == "Add")
+      instruction.op = ADD;
+   else if (typeName == "Subtract")
+      instruction.op = SUBTRACT;
+   else if (typeName == "Multiply")
+      instruction.op = MULTIPLY;
+   else if (typeName == "Divide")
+      instruction.op = DIVIDE;
+   else if (typeName == "Power")
+   {
+      instruction.op     = BINARY;
+      instruction.binary = PowerFunction;
+   }
+   else if (typeName == "Atan2")
+   {
+      instruction.op     = BINARY;
+      instruction.binary = Atan2Function;
+   }
+   else
+   {
+      binaryOp = false;
+      if (typeName == "Negate")
+         instruction.op = NEGATE;
+      else
+      {
+         instruction.op    = UNARY;
+         instruction.unary = FindUnaryFunction(typeName);
+         if (instruction.unary == NULL)
+            return -1;
+      }
+   }
+
+   instruction.left = Lower(leftNode);
+   if (instruction.left < 0)
+      return -1;
+   if (binaryOp)
+   {
+      instruction.right = Lower(rightNode);
+      if (instruction.right < 0)
+         return -1;
+   }
+
+   key << typeName << "(" << instruction.left << "," << instruction.right
+       << ")";
+   return AddInstruction(instruction, key.str());
+}
+
+//------------------------------------------------------------------------------
+// Integer AddConstant(Real value)
+//------------------------------------------------------------------------------
+/**
+ * Returns the slot of a constant, adding it if needed.
+ *
+ * @param value The constant
+ *
+ * @return Its slot
+ */
+//------------------------------------------------------------------------------
+Integer CompiledExpression::AddConstant(Real value)
+{
+   // Key on the bit pattern so that -0.0 and NaN payloads are kept apart
+   unsigned char bytes[sizeof(Real)];
+   std::memcpy(bytes, &value, sizeof(Real));
+   std::stringstream key;
+   key << "C" << std::hex;
+   for (UnsignedInt i = 0; i < sizeof(Real); ++i)
+      key << (UnsignedInt)bytes[i] << ".";
+
+   std::map<std::string, Integer>::iterator i =
+         subexpressions.find(key.str());
+   if (i != subexpressions.end())
+      return i->second;
+
+   Integer slot = (Integer)slots.size();
+   slots.push_back(value);
+   constantSlots.push_back(true);
+   subexpressions[key.str()] = slot;
+   return slot;
+}
+
+//------------------------------------------------------------------------------
+// Integer AddInstruction(Instruction &instruction, const std::string &key)
+//------------------------------------------------------------------------------
+/**
+ * Appends an instruction unless an identical one was added already, folding
+ * it into a constant when all of its operands are constants.
+ *
+ * @param instruction The instruction; its result slot is set here
+ * @param key         The subexpression key of the instruction
+ *
+ * @return The slot holding the result
+ */
+//------------------------------------------------------------------------------
+Integer CompiledExpression::AddInstruction(Instruction &instruction,
+                                           const std::string &key)
+{
+   std::map<std::string, Integer>::iterator i = subexpressions.find(key);
+   if (i != subexpressions.end())
+   {
+      ++reusedCount;
+      return i->second;
+   }
+
+   if ((instruction.op != LOAD) && constantSlots[instruction.left] &&
+       ((instruction.right < 0) || constantSlots[instruction.right]))
+   {
+      try
+      {
+         Real value = Execute(instruction, &slots[0]);
+         ++foldedCount;
+         Integer slot = AddConstant(value);
+         subexpressions[key] = slot;
+         return slot;
+      }
+      catch (BaseException &)
+      {
+         // Leave the operation in the program so it fails when evaluated,
+         // as the tree would
+      }
+   }
+
+   instruction.result = (Integer)slots.size();
+   slots.push_back(0.0);
+   constantSlots.push_back(false);
+   program.push_back(instruction);
+   subexpressions[key] = instruction.result;
+   return instruction.result;
+}
+
+//------------------------------------------------------------------------------
+// Real Execute(const Instruction &instruction, const Real *values)
+//------------------------------------------------------------------------------
+/**
+ * Performs one instruction, exactly as the matching node's Evaluate() does.
+ *
+ * @param instruction The instruction
+ * @param values      The slot values
+ *
+ * @return The result
+ */
+//------------------------------------------------------------------------------
+Real CompiledExpression::Execute(const Instruction &instruction,
+                                 const Real *values)
+{
+   switch (instruction.op)
+   {
+   case LOAD:
+      return instruction.wrapper->EvaluateReal();
+   case ADD:
+      return values[instruction.left] + values[instruction.right];
+   case SUBTRACT:
+      return values[instruction.left] - values[instruction.right];
+   case MULTIPLY:
+      return values[instruction.left] * values[instruction.right];
+   case DIVIDE:
+      return values[instruction.left] / values[instruction.right];
+   case NEGATE:
+      return values[instruction.left] * -1;
+   case UNARY:
+      return instruction.unary(values[instruction.left]);
+   case BINARY:
+      return instruction.binary(values[instruction.left],
+                                values[instruction.right]);
+   }
+   return 0.0;
+}
@@ -0,0 +1,125 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                             CompiledExpression
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/16
+//
+/**
+ * Declares the CompiledExpression class, a flat form of a Real valued
+ * MathNode tree.
+ *
+ * Compile() lowers the tree into a list of instructions that read and write
+ * a fixed array of value slots.  The element wrappers of the leaves are
+ * looked up once, constant subtrees are folded, and identical subexpressions
+ * share one slot, so Evaluate() runs without recursion, virtual calls into
+ * the nodes, map lookups or allocation.
+ *
+ * Only scalar trees built from numbers, Real elements and the elementary
+ * operators and functions are compiled.  Compile() returns false for
+ * anything else (matrices, strings, GMAT functions, random numbers, ...),
+ * and the caller keeps evaluating the tree itself.
+ */
+//------------------------------------------------------------------------------
+#ifndef CompiledExpression_hpp
+#define CompiledExpression_hpp
+
+#include "gmatdefs.hpp"
+#include <map>
+
+class MathNode;
+class ElementWrapper;
+
+class GMAT_API CompiledExpression
+{
+public:
+   CompiledExpression();
+   ~CompiledExpression();
+
+   bool                 Compile(MathNode *topNode);
+   void                 Clear();
+   bool                 IsCompiled() const;
+   Real                 Evaluate();
+
+   Integer              GetInstructionCount() const;
+   Integer              GetFoldedCount() const;
+   Integer              GetReusedCount() const;
+
+   typedef Real (*UnaryFunction)(Real);
+   typedef Real (*BinaryFunction)(Real, Real);
+
+protected:
+   enum OpCode
+   {
+      LOAD,
+      ADD,
+      SUBTRACT,
+      MULTIPLY,
+      DIVIDE,
+      NEGATE,
+      UNARY,
+      BINARY
+   };
+
+   /// One step of the program; operands and result are slot indices
+   struct Instruction
+   {
+      OpCode            op;
+      Integer           result;
+      Integer           left;
+      Integer           right;
+      ElementWrapper    *wrapper;
+      UnaryFunction     unary;
+      BinaryFunction    binary;
+   };
+
+   /// The program, in evaluation order
+   std::vector<Instruction>
+                        program;
+   /// Values of the constants and of the instruction results
+   RealArray            slots;
+   /// Set for slots that hold constants
+   std::vector<bool>    constantSlots;
+   /// Slot holding the value of the expression
+   Integer              resultSlot;
+
+   /// Number of operations folded into constants
+   Integer              foldedCount;
+   /// Number of subexpressions reused instead of recomputed
+   Integer              reusedCount;
+
+   /// Slots of the subexpressions lowered so far; used while compiling
+   std::map<std::string, Integer>
+                        subexpressions;
+
+   Integer              Lower(MathNode *node);
+   Integer              AddConstant(Real value);
+   Integer              AddInstruction(Instruction &instruction,
+                                       const std::string &key);
+
+   static Real          Execute(const Instruction &instruction,
+                                const Real *values);
+
+private:
+   // The program points into the tree's wrappers; copies are not allowed
+   CompiledExpression(const CompiledExpression &ce);
+   CompiledExpression& operator=(const CompiledExpression &ce);
+};
+
+#endif // CompiledExpression_hpp
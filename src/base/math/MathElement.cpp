@@ -153,6 +153,30 @@ void MathElement::SetMathWrappers(std::map<std::string, ElementWrapper*> *wrappe
 }
 
 
+//------------------------------------------------------------------------------
+// ElementWrapper* GetRealWrapper()
+//------------------------------------------------------------------------------
+/**
+ * Returns the wrapper Evaluate() reads, so that compiled expressions can
+ * read it directly.
+ *
+ * @return The wrapper, or NULL if this element is a number
+ */
+//------------------------------------------------------------------------------
+ElementWrapper* MathElement::GetRealWrapper()
+{
+   if (refObject == NULL)
+      return NULL;
+
+   if (elementType != Gmat::REAL_TYPE && elementType != Gmat::RMATRIX_TYPE)
+      throw MathException
+         ("MathElement::Evaluate() Cannot Evaluate MathElementType of \"" +
+          refObjectName + "\"");
+
+   return FindWrapper(refObjectName);
+}
+
+
 // Inherited MathElement methods
 //------------------------------------------------------------------------------
 // virtual void SetMatrixValue(const Rmatrix &mat)
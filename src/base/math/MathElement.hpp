@@ -51,6 +51,7 @@ public:
    
    // for math elemement wrappers
    virtual void         SetMathWrappers(WrapperMap *wrapperMap);
+   ElementWrapper*      GetRealWrapper();
    
    // Inherited (MathNode) methods
    virtual void         SetMatrixValue(const Rmatrix &mat);
@@ -31,6 +31,7 @@
 
 #include "gmatdefs.hpp"
 #include "Array.hpp"
+#include "ParameterIndex.hpp"
 #include "ParameterException.hpp"
 #include "StringUtil.hpp"          // for SeparateBy(), GetArrayIndexVar()
 #include "GmatGlobal.hpp"          // for IsWritingGmatKeyword()
@@ -335,11 +336,11 @@ std::string Array::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer Array::GetParameterID(const std::string &str) const
 {
-   for (int i=ParameterParamCount; i<ArrayParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - ParameterParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("Array", PARAMETER_TEXT,
+         ParameterParamCount, ArrayParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
    
    return Parameter::GetParameterID(str);
 }
@@ -30,6 +30,7 @@
 //------------------------------------------------------------------------------
 #include "gmatdefs.hpp"
 #include "Parameter.hpp"
+#include "ParameterIndex.hpp"
 #include "ParameterException.hpp"
 #include "ParameterInfo.hpp"
 #include "MessageInterface.hpp"
@@ -1237,11 +1238,11 @@ std::string Parameter::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer Parameter::GetParameterID(const std::string &str) const
 {
-   for (int i=GmatBaseParamCount; i<ParameterParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatBaseParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("Parameter", PARAMETER_TEXT,
+         GmatBaseParamCount, ParameterParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
    
    return GmatBase::GetParameterID(str);
 }
@@ -31,6 +31,7 @@
 //------------------------------------------------------------------------------
 
 #include "RealVar.hpp"
+#include "ParameterIndex.hpp"
 #include "ParameterException.hpp"
 #include "StringUtil.hpp"          // for GmatStringUtil::ToReal()
 #include "GmatGlobal.hpp"          // for Global settings
@@ -287,11 +288,11 @@ void RealVar::SetReal(Real val)
 //------------------------------------------------------------------------------
 Integer RealVar::GetParameterID(const std::string &str) const
 {
-   for (int i=ParameterParamCount; i<RealVarParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - ParameterParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("RealVar", PARAMETER_TEXT,
+         ParameterParamCount, RealVarParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
    
    return Parameter::GetParameterID(str);
 }
@@ -31,6 +31,7 @@
 
 #include "gmatdefs.hpp"
 #include "RvectorVar.hpp"
+#include "ParameterIndex.hpp"
 #include "ParameterException.hpp"
 #include <sstream>
 
@@ -245,11 +246,11 @@ const Rvector& RvectorVar::EvaluateRvector()
 //------------------------------------------------------------------------------
 Integer RvectorVar::GetParameterID(const std::string &str) const
 {
-   for (int i = ParameterParamCount; i < RvectorVarParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - ParameterParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("RvectorVar", PARAMETER_TEXT,
+         ParameterParamCount, RvectorVarParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
    
    return Parameter::GetParameterID(str);
 }
@@ -31,6 +31,7 @@
 //------------------------------------------------------------------------------
 
 #include "StringVar.hpp"
+#include "ParameterIndex.hpp"
 #include "MessageInterface.hpp"
 
 //#define DEBUG_STRINGVAR
@@ -288,11 +289,11 @@ void StringVar::Copy(const GmatBase* orig)
 //------------------------------------------------------------------------------
 Integer StringVar::GetParameterID(const std::string &str) const
 {
-   for (int i=ParameterParamCount; i<StringVarParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - ParameterParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("StringVar", PARAMETER_TEXT,
+         ParameterParamCount, StringVarParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
    
    return Parameter::GetParameterID(str);
 }
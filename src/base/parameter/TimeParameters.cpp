@@ -33,6 +33,7 @@
  */
 //------------------------------------------------------------------------------
 #include "TimeParameters.hpp"
+#include "ParameterIndex.hpp"
 #include "MessageInterface.hpp"
 
 //#define DEBUG_TIME_EVAL
@@ -1499,11 +1500,11 @@ bool ElapsedDays::IsParameterReadOnly(const Integer id) const
 //------------------------------------------------------------------------------
 Integer ElapsedDays::GetParameterID(const std::string &str) const
 {
-   for (int i = ParameterParamCount; i < ElapsedDaysParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - ParameterParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("ElapsedDays", PARAMETER_TEXT,
+         ParameterParamCount, ElapsedDaysParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
    
    return TimeReal::GetParameterID(str);
 }
@@ -1793,11 +1794,11 @@ bool ElapsedDaysFromStart::IsParameterReadOnly(const Integer id) const
 //------------------------------------------------------------------------------
 Integer ElapsedDaysFromStart::GetParameterID(const std::string &str) const
 {
-   for (int i = ParameterParamCount; i < ElapsedDaysFromStartParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - ParameterParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("ElapsedDaysFromStart",
+         PARAMETER_TEXT, ParameterParamCount, ElapsedDaysFromStartParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
    
    return TimeReal::GetParameterID(str);
 }
@@ -2088,11 +2089,11 @@ bool ElapsedSecs::IsParameterReadOnly(const Integer id) const
 //------------------------------------------------------------------------------
 Integer ElapsedSecs::GetParameterID(const std::string &str) const
 {
-   for (int i = ParameterParamCount; i < ElapsedSecsParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - ParameterParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("ElapsedSecs", PARAMETER_TEXT,
+         ParameterParamCount, ElapsedSecsParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
    
    return TimeReal::GetParameterID(str);
 }
@@ -2382,11 +2383,11 @@ bool ElapsedSecsFromStart::IsParameterReadOnly(const Integer id) const
 //------------------------------------------------------------------------------
 Integer ElapsedSecsFromStart::GetParameterID(const std::string &str) const
 {
-   for (int i = ParameterParamCount; i < ElapsedSecsFromStartParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - ParameterParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("ElapsedSecsFromStart",
+         PARAMETER_TEXT, ParameterParamCount, ElapsedSecsFromStartParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
    
    return TimeReal::GetParameterID(str);
 }
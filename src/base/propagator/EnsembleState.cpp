@@ -0,0 +1,393 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                               EnsembleState
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/16
+//
+/**
+ * Implements the EnsembleState class.
+ */
+//------------------------------------------------------------------------------
+
+#include "EnsembleState.hpp"
+#include <random>
+
+
+//------------------------------------------------------------------------------
+// EnsembleState(Integer members)
+//------------------------------------------------------------------------------
+/**
+ * Constructor
+ *
+ * @param members The number of members
+ */
+//------------------------------------------------------------------------------
+EnsembleState::EnsembleState(Integer members) :
+   memberCount       (0)
+{
+   SetSize(members);
+}
+
+//------------------------------------------------------------------------------
+// ~EnsembleState()
+//------------------------------------------------------------------------------
+/**
+ * Destructor
+ */
+//------------------------------------------------------------------------------
+EnsembleState::~EnsembleState()
+{
+}
+
+//------------------------------------------------------------------------------
+// EnsembleState(const EnsembleState &es)
+//------------------------------------------------------------------------------
+/**
+ * Copy constructor
+ *
+ * @param es The ensemble copied here
+ */
+//------------------------------------------------------------------------------
+EnsembleState::EnsembleState(const EnsembleState &es) :
+   memberCount       (es.memberCount),
+   epochs            (es.epochs),
+   stepCounts        (es.stepCounts),
+   lastSteps         (es.lastSteps),
+   statuses          (es.statuses)
+{
+   for (Integer i = 0; i < 6; ++i)
+      components[i] = es.components[i];
+}
+
+//------------------------------------------------------------------------------
+// EnsembleState& operator=(const EnsembleState &es)
+//------------------------------------------------------------------------------
+/**
+ * Assignment operator
+ *
+ * @param es The ensemble copied here
+ *
+ * @return This ensemble, set to match es
+ */
+//------------------------------------------------------------------------------
+EnsembleState& EnsembleState::operator=(const EnsembleState &es)
+{
+   if (this != &es)
+   {
+      memberCount = es.memberCount;
+      for (Integer i = 0; i < 6; ++i)
+         components[i] = es.components[i];
+      epochs      = es.epochs;
+      stepCounts  = es.stepCounts;
+      lastSteps   = es.lastSteps;
+      statuses    = es.statuses;
+   }
+   return *this;
+}
+
+//------------------------------------------------------------------------------
+// void SetSize(Integer members)
+//------------------------------------------------------------------------------
+/**
+ * Sizes the arrays and resets every member to a pending zero state
+ *
+ * @param members The number of members
+ */
+//------------------------------------------------------------------------------
+void EnsembleState::SetSize(Integer members)
+{
+   memberCount = (members > 0 ? members : 0);
+   for (Integer i = 0; i < 6; ++i)
+      components[i].assign(memberCount, 0.0);
+   epochs.assign(memberCount, 0.0);
+   stepCounts.assign(memberCount, 0);
+   lastSteps.assign(memberCount, 0.0);
+   statuses.assign(memberCount, PENDING);
+}
+
+//------------------------------------------------------------------------------
+// Integer GetSize() const
+//------------------------------------------------------------------------------
+/**
+ * @return The number of members
+ */
+//------------------------------------------------------------------------------
+Integer EnsembleState::GetSize() const
+{
+   return memberCount;
+}
+
+//------------------------------------------------------------------------------
+// void Disperse(GmatEpoch epoch, const Real *nominal, const Real *sigma,
+//               UnsignedInt seed)
+//------------------------------------------------------------------------------
+/**
+ * Fills the ensemble with Gaussian dispersions about a nominal state.
+ *
+ * Member 0 is the undispersed nominal state.  The remaining members are
+ * drawn in member order from a generator seeded with seed, so a given seed
+ * produces the same ensemble however the members are propagated later.
+ *
+ * @param epoch   The epoch of every member
+ * @param nominal The nominal Cartesian state (6 elements)
+ * @param sigma   The 1-sigma dispersion of each component (6 elements)
+ * @param seed    The random number seed
+ */
+//------------------------------------------------------------------------------
+void EnsembleState::Disperse(GmatEpoch epoch, const Real *nominal,
+                             const Real *sigma, UnsignedInt seed)
+{
+   std::mt19937 generator(seed);
+   std::normal_distribution<Real> gauss(0.0, 1.0);
+
+   for (Integer m = 0; m < memberCount; ++m)
+   {
+      for (Integer i = 0; i < 6; ++i)
+      {
+         if ((m == 0) || (sigma[i] == 0.0))
+            components[i][m] = nominal[i];
+         else
+            components[i][m] = nominal[i] + sigma[i] * gauss(generator);
+      }
+      epochs[m]     = epoch;
+      stepCounts[m] = 0;
+      lastSteps[m]  = 0.0;
+      statuses[m]   = PENDING;
+   }
+}
+
+//------------------------------------------------------------------------------
+// void GetMember(Integer member, Real *state) const
+//------------------------------------------------------------------------------
+/**
+ * Gathers the Cartesian state of one member
+ *
+ * @param member The member
+ * @param state  The 6 element array that receives the state
+ */
+//------------------------------------------------------------------------------
+void EnsembleState::GetMember(Integer member, Real *state) const
+{
+   for (Integer i = 0; i < 6; ++i)
+      state[i] = components[i][member];
+}
+
+//------------------------------------------------------------------------------
+// void SetMember(Integer member, const Real *state)
+//------------------------------------------------------------------------------
+/**
+ * Scatters a Cartesian state into one member
+ *
+ * @param member The member
+ * @param state  The 6 element state
+ */
+//------------------------------------------------------------------------------
+void EnsembleState::SetMember(Integer member, const Real *state)
+{
+   for (Integer i = 0; i < 6; ++i)
+      components[i][member] = state[i];
+}
+
+//------------------------------------------------------------------------------
+// const Real* GetComponent(Integer component) const
+//------------------------------------------------------------------------------
+/**
+ * Accesses one Cartesian component of every member
+ *
+ * @param component The component, 0 (X) through 5 (VZ)
+ *
+ * @return The component array, GetSize() elements long
+ */
+//------------------------------------------------------------------------------
+const Real* EnsembleState::GetComponent(Integer component) const
+{
+   return (memberCount > 0 ? &components[component][0] : NULL);
+}
+
+//------------------------------------------------------------------------------
+// GmatEpoch GetEpoch(Integer member) const
+//------------------------------------------------------------------------------
+/**
+ * @return The epoch of a member
+ */
+//------------------------------------------------------------------------------
+GmatEpoch EnsembleState::GetEpoch(Integer member) const
+{
+   return epochs[member];
+}
+
+//------------------------------------------------------------------------------
+// void SetEpoch(Integer member, GmatEpoch epoch)
+//------------------------------------------------------------------------------
+/**
+ * Sets the epoch of a member
+ *
+ * @param member The member
+ * @param epoch  The new epoch
+ */
+//------------------------------------------------------------------------------
+void EnsembleState::SetEpoch(Integer member, GmatEpoch epoch)
+{
+   epochs[member] = epoch;
+}
+
+//------------------------------------------------------------------------------
+// Integer GetStepCount(Integer member) const
+//------------------------------------------------------------------------------
+/**
+ * @return The number of integration steps a member took
+ */
+//------------------------------------------------------------------------------
+Integer EnsembleState::GetStepCount(Integer member) const
+{
+   return stepCounts[member];
+}
+
+//------------------------------------------------------------------------------
+// Real GetLastStep(Integer member) const
+//------------------------------------------------------------------------------
+/**
+ * @return The last full step size a member took, in seconds
+ */
+//------------------------------------------------------------------------------
+Real EnsembleState::GetLastStep(Integer member) const
+{
+   return lastSteps[member];
+}
+
+//------------------------------------------------------------------------------
+// Integer GetStatus(Integer member) const
+//------------------------------------------------------------------------------
+/**
+ * @return The MemberStatus of a member
+ */
+//------------------------------------------------------------------------------
+Integer EnsembleState::GetStatus(Integer member) const
+{
+   return statuses[member];
+}
+
+//------------------------------------------------------------------------------
+// void SetResult(Integer member, Integer status, Integer steps, Real lastStep)
+//------------------------------------------------------------------------------
+/**
+ * Records the outcome of a member's propagation
+ *
+ * @param member   The member
+ * @param status   The MemberStatus
+ * @param steps    The number of integration steps taken
+ * @param lastStep The last full step size taken
+ */
+//------------------------------------------------------------------------------
+void EnsembleState::SetResult(Integer member, Integer status, Integer steps,
+                              Real lastStep)
+{
+   statuses[member]   = status;
+   stepCounts[member] = steps;
+   lastSteps[member]  = lastStep;
+}
+
+//------------------------------------------------------------------------------
+// Integer GetStatusCount(Integer status) const
+//------------------------------------------------------------------------------
+/**
+ * @return The number of members with a given MemberStatus
+ */
+//------------------------------------------------------------------------------
+Integer EnsembleState::GetStatusCount(Integer status) const
+{
+   Integer count = 0;
+   for (Integer m = 0; m < memberCount; ++m)
+      if (statuses[m] == status)
+         ++count;
+   return count;
+}
+
+//------------------------------------------------------------------------------
+// bool GetMean(Real *mean) const
+//------------------------------------------------------------------------------
+/**
+ * Computes the mean state of the propagated members
+ *
+ * @param mean The 6 element array that receives the mean
+ *
+ * @return true if at least one member was propagated
+ */
+//------------------------------------------------------------------------------
+bool EnsembleState::GetMean(Real *mean) const
+{
+   Integer count = 0;
+   for (Integer i = 0; i < 6; ++i)
+      mean[i] = 0.0;
+
+   for (Integer i = 0; i < 6; ++i)
+   {
+      const Real *component = &components[i][0];
+      count = 0;
+      for (Integer m = 0; m < memberCount; ++m)
+      {
+         if (statuses[m] == PROPAGATED)
+         {
+            mean[i] += component[m];
+            ++count;
+         }
+      }
+      if (count == 0)
+         return false;
+      mean[i] /= count;
+   }
+
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// bool GetCovariance(Rmatrix66 &covariance) const
+//------------------------------------------------------------------------------
+/**
+ * Computes the sample covariance of the propagated members
+ *
+ * @param covariance The matrix that receives the covariance
+ *
+ * @return true if at least two members were propagated
+ */
+//------------------------------------------------------------------------------
+bool EnsembleState::GetCovariance(Rmatrix66 &covariance) const
+{
+   Real mean[6];
+   Integer count = GetStatusCount(PROPAGATED);
+   if ((count < 2) || !GetMean(mean))
+      return false;
+
+   for (Integer i = 0; i < 6; ++i)
+   {
+      const Real *ci = &components[i][0];
+      for (Integer j = i; j < 6; ++j)
+      {
+         const Real *cj = &components[j][0];
+         Real sum = 0.0;
+         for (Integer m = 0; m < memberCount; ++m)
+            if (statuses[m] == PROPAGATED)
+               sum += (ci[m] - mean[i]) * (cj[m] - mean[j]);
+         covariance(i, j) = covariance(j, i) = sum / (count - 1);
+      }
+   }
+
+   return true;
+}
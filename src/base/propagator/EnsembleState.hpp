@@ -0,0 +1,94 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                               EnsembleState
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/16
+//
+/**
+ * Declares the EnsembleState class, the Cartesian states of a set of
+ * perturbed copies of one spacecraft, stored component by component.
+ *
+ * Each of the six Cartesian components is a contiguous array over the
+ * members, so the statistics loops (mean, covariance) run down plain arrays
+ * and members can be read or written independently from several threads.
+ * Alongside the states, each member carries its epoch, the number of
+ * integration steps it took, its last step size and a status flag.
+ */
+//------------------------------------------------------------------------------
+#ifndef EnsembleState_hpp
+#define EnsembleState_hpp
+
+#include "gmatdefs.hpp"
+#include "Rmatrix66.hpp"
+
+class GMAT_API EnsembleState
+{
+public:
+   /// Member status values
+   enum MemberStatus
+   {
+      PENDING = 0,
+      PROPAGATED,
+      FAILED
+   };
+
+   EnsembleState(Integer members = 0);
+   virtual ~EnsembleState();
+   EnsembleState(const EnsembleState &es);
+   EnsembleState&       operator=(const EnsembleState &es);
+
+   void                 SetSize(Integer members);
+   Integer              GetSize() const;
+
+   void                 Disperse(GmatEpoch epoch, const Real *nominal,
+                                 const Real *sigma, UnsignedInt seed);
+
+   void                 GetMember(Integer member, Real *state) const;
+   void                 SetMember(Integer member, const Real *state);
+   const Real*          GetComponent(Integer component) const;
+
+   GmatEpoch            GetEpoch(Integer member) const;
+   void                 SetEpoch(Integer member, GmatEpoch epoch);
+   Integer              GetStepCount(Integer member) const;
+   Real                 GetLastStep(Integer member) const;
+   Integer              GetStatus(Integer member) const;
+   void                 SetResult(Integer member, Integer status,
+                                  Integer steps = 0, Real lastStep = 0.0);
+
+   Integer              GetStatusCount(Integer status) const;
+   bool                 GetMean(Real *mean) const;
+   bool                 GetCovariance(Rmatrix66 &covariance) const;
+
+protected:
+   /// Number of members
+   Integer              memberCount;
+   /// The Cartesian components: X, Y, Z, VX, VY, VZ, each over the members
+   RealArray            components[6];
+   /// Member epochs
+   RealArray            epochs;
+   /// Integration steps taken by each member
+   IntegerArray         stepCounts;
+   /// Last step size taken by each member
+   RealArray            lastSteps;
+   /// MemberStatus of each member
+   IntegerArray         statuses;
+};
+
+#endif // EnsembleState_hpp
@@ -0,0 +1,1157 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                                GaussJackson
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/16
+//
+/**
+ * Implementation of the GaussJackson integrator.
+ */
+//------------------------------------------------------------------------------
+
+#include "GaussJackson.hpp"
+#include "PropagatorException.hpp"
+#include "MessageInterface.hpp"
+#include <cstring>
+
+//#define DEBUG_PROPAGATION
+//#define DEBUG_STEP_CONTROL
+
+
+//---------------------------------
+// public
+//---------------------------------
+
+//------------------------------------------------------------------------------
+// GaussJackson(const std::string &nomme)
+//------------------------------------------------------------------------------
+/**
+ * The constructor
+ *
+ * The history holds 2 * GJ_ORDER + 1 derivative sets so that the step can be
+ * doubled without new derivative evaluations.
+ *
+ * @param nomme The name of the new integrator
+ */
+//------------------------------------------------------------------------------
+GaussJackson::GaussJackson(const std::string &nomme) :
+   PredictorCorrector      (2 * GJ_ORDER + 1, GJ_ORDER, "GaussJackson", nomme),
+   positionErrorFactor     (0.0),
+   velocityErrorFactor     (0.0),
+   gridTime                (0.0),
+   validPoints             (0),
+   quietSteps              (0),
+   failedStep              (0.0),
+   retryQuietSteps         (GJ_ORDER),
+   lastOutputTime          (0.0),
+   stepStartTime           (0.0),
+   tableDenseOutput        (false)
+{
+   starter = new RungeKutta89;
+   BuildSeries();
+}
+
+//------------------------------------------------------------------------------
+// ~GaussJackson()
+//------------------------------------------------------------------------------
+/**
+ * The destructor
+ */
+//------------------------------------------------------------------------------
+GaussJackson::~GaussJackson()
+{
+}
+
+//------------------------------------------------------------------------------
+// GaussJackson(const GaussJackson& gj)
+//------------------------------------------------------------------------------
+/**
+ * The copy constructor
+ *
+ * The difference table is not copied; the copy starts up again when it is
+ * initialized.
+ *
+ * @param gj The integrator that supplies data for this one
+ */
+//------------------------------------------------------------------------------
+GaussJackson::GaussJackson(const GaussJackson& gj) :
+   PredictorCorrector      (gj),
+   adamsSeries             (gj.adamsSeries),
+   gjSeries                (gj.gjSeries),
+   positionErrorFactor     (gj.positionErrorFactor),
+   velocityErrorFactor     (gj.velocityErrorFactor),
+   gridTime                (0.0),
+   validPoints             (0),
+   quietSteps              (0),
+   failedStep              (0.0),
+   retryQuietSteps         (GJ_ORDER),
+   lastOutputTime          (0.0),
+   stepStartTime           (0.0),
+   tableDenseOutput        (false)
+{
+}
+
+//------------------------------------------------------------------------------
+// GaussJackson& operator=(const GaussJackson& gj)
+//------------------------------------------------------------------------------
+/**
+ * The assignment operator
+ *
+ * @param gj The integrator that supplies data for this one
+ *
+ * @return This integrator, configured to match gj
+ */
+//------------------------------------------------------------------------------
+GaussJackson& GaussJackson::operator=(const GaussJackson& gj)
+{
+   if (this == &gj)
+      return *this;
+
+   PredictorCorrector::operator=(gj);
+   adamsSeries         = gj.adamsSeries;
+   gjSeries            = gj.gjSeries;
+   positionErrorFactor = gj.positionErrorFactor;
+   velocityErrorFactor = gj.velocityErrorFactor;
+   validPoints         = 0;
+   quietSteps          = 0;
+   failedStep          = 0.0;
+   retryQuietSteps     = GJ_ORDER;
+   tableDenseOutput    = false;
+
+   return *this;
+}
+
+//------------------------------------------------------------------------------
+// GmatBase* Clone() const
+//------------------------------------------------------------------------------
+/**
+ * Method used to create a copy of the object
+ *
+ * @return A clone of this instance
+ */
+//------------------------------------------------------------------------------
+GmatBase* GaussJackson::Clone() const
+{
+   return new GaussJackson(*this);
+}
+
+//------------------------------------------------------------------------------
+// bool Initialize()
+//------------------------------------------------------------------------------
+/**
+ * Sets up the data structures and the component map
+ *
+ * Positions are found from the first order component map of the Cartesian
+ * states; every other component is integrated as a first order equation.
+ *
+ * @return true on success
+ */
+//------------------------------------------------------------------------------
+bool GaussJackson::Initialize()
+{
+   PredictorCorrector::Initialize();
+   if (!isInitialized)
+      return false;
+
+   positionMap.assign(dimension, -1);
+   if (!physicalModel->GetComponentMap(&positionMap[0], 1,
+         Gmat::CARTESIAN_STATE))
+      positionMap.assign(dimension, -1);
+   for (Integer i = 0; i < dimension; ++i)
+      if ((positionMap[i] < 0) || (positionMap[i] >= dimension))
+         positionMap[i] = -1;
+
+   firstSum.assign(dimension, 0.0);
+   secondSum.assign(dimension, 0.0);
+   predictedDerivative.assign(dimension, 0.0);
+   interpolatedState.assign(dimension, 0.0);
+   gridState.assign(dimension, 0.0);
+   lastOutput.assign(dimension, 0.0);
+   stepStartState.assign(dimension, 0.0);
+   positionWeights.assign(GJ_ORDER + 1, 0.0);
+   velocityWeights.assign(GJ_ORDER + 1, 0.0);
+
+   stepSign = (stepSize < 0.0 ? -1.0 : 1.0);
+
+   return isInitialized;
+}
+
+//------------------------------------------------------------------------------
+// bool Step()
+//------------------------------------------------------------------------------
+/**
+ * Advances the state one step
+ *
+ * During startup this is one starter step.  When the model sits behind the
+ * last grid point, as it does after Propagate restores an earlier state, the
+ * step ends at the next grid point, interpolated from the table.
+ *
+ * @return true on success, false if the step failed
+ */
+//------------------------------------------------------------------------------
+bool GaussJackson::Step()
+{
+   #ifdef DEBUG_PROPAGATION
+      MessageInterface::ShowMessage("Called GaussJackson::Step()\n");
+   #endif
+
+   if (!isInitialized)
+      return false;
+
+   InvalidateDenseOutput();
+   tableDenseOutput = false;
+   stepSign = (stepSize < 0.0 ? -1.0 : 1.0);
+   CheckModelState();
+
+   Real startTime = physicalModel->GetTime();
+   stepStartState.assign(inState, inState + dimension);
+   stepStartTime = startTime;
+
+   bool startupStep = !startupComplete;
+   if (startupStep)
+   {
+      if (!FireStartupStep())
+         return false;
+   }
+   else if ((gridTime - startTime) * stepSign > smallestTime)
+   {
+      // Step to the next grid point
+      Integer back = (Integer)ceil((gridTime - startTime) / stepSize - 1.0e-6)
+            - 1;
+      if (back <= 0)
+         PublishState(&gridState[0], gridTime);
+      else
+      {
+         Interpolate(-back, &interpolatedState[0]);
+         PublishState(&interpolatedState[0], gridTime - back * stepSize);
+      }
+   }
+   else if (!TakeGridStep())
+      return false;
+
+   RecordStep(startTime, startupStep);
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// bool Step(Real dt)
+//------------------------------------------------------------------------------
+/**
+ * Advances the state by a fixed interval
+ *
+ * Unlike the other predictor-correctors, the step size is not changed to fit
+ * the interval: the integrator steps past the end of the interval and
+ * interpolates back to it, so repeated requests that end between grid
+ * points, like those made while locating a stopping condition, cost no
+ * restart.  Before the startup has begun the step is reduced so that the
+ * interval is a whole number of steps.
+ *
+ * @param dt The interval
+ *
+ * @return true on success, false if the step failed
+ */
+//------------------------------------------------------------------------------
+bool GaussJackson::Step(Real dt)
+{
+   #ifdef DEBUG_PROPAGATION
+      MessageInterface::ShowMessage("Called GaussJackson::Step(%.12lf)\n", dt);
+   #endif
+
+   if (!isInitialized)
+      return false;
+
+   InvalidateDenseOutput();
+   tableDenseOutput = false;
+   if (dt == 0.0)
+   {
+      stepTaken = 0.0;
+      return true;
+   }
+
+   // The table cannot be used in the other direction
+   if (dt * stepSize < 0.0)
+   {
+      stepSize = -stepSize;
+      Reset();
+   }
+   stepSign = (stepSize < 0.0 ? -1.0 : 1.0);
+   CheckModelState();
+
+   Real startTime = physicalModel->GetTime();
+   stepStartState.assign(inState, inState + dimension);
+   stepStartTime = startTime;
+   Real target = startTime + dt;
+
+   if (!startupComplete && (startupCount == 0))
+   {
+      Real steps = fabs(dt / stepSize);
+      if ((steps > 1.0) &&
+          (fabs(steps - floor(steps + 0.5)) * fabs(stepSize) > smallestTime))
+         stepSize = dt / ceil(steps);
+   }
+
+   while (!startupComplete)
+   {
+      Real remaining = target - physicalModel->GetTime();
+      if (remaining * stepSign <= smallestTime)
+         break;
+
+      if (fabs(remaining) < fabs(stepSize) - smallestTime)
+      {
+         // The starter covers a partial step, and the startup begins again
+         // from the new state
+         if (!starter->Step(remaining))
+            return false;
+         Reset();
+         break;
+      }
+
+      if (!FireStartupStep())
+         return false;
+   }
+
+   if (startupComplete)
+   {
+      while ((target - gridTime) * stepSign > smallestTime)
+         if (!TakeGridStep())
+            return false;
+
+      if (fabs(target - gridTime) <= smallestTime)
+         PublishState(&gridState[0], gridTime);
+      else
+      {
+         Interpolate((target - gridTime) / stepSize, &interpolatedState[0]);
+         PublishState(&interpolatedState[0], target);
+      }
+   }
+
+   RecordStep(startTime, false);
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// bool GetDenseState(Real atTime, Real *state)
+//------------------------------------------------------------------------------
+/**
+ * Interpolates the state inside the last step
+ *
+ * Once the startup is complete the difference table spans the last step, so
+ * the interpolation has the accuracy of the integration and needs no
+ * derivative evaluations.  Startup steps use the cubic Hermite default.
+ *
+ * @param atTime The elapsed time of the requested state
+ * @param state  The interpolated state (output, dimension elements)
+ *
+ * @return true on success, false if there is no dense output
+ */
+//------------------------------------------------------------------------------
+bool GaussJackson::GetDenseState(Real atTime, Real *state)
+{
+   if (!denseOutputValid)
+      return false;
+
+   if (!tableDenseOutput)
+      return Integrator::GetDenseState(atTime, state);
+
+   Interpolate((atTime - gridTime) / stepSize, state);
+   return true;
+}
+
+
+//---------------------------------
+// protected
+//---------------------------------
+
+//------------------------------------------------------------------------------
+// bool SetWeights()
+//------------------------------------------------------------------------------
+/**
+ * Sets the predictor and corrector weights
+ *
+ * pweights and cweights hold the Gauss-Jackson weights for the positions;
+ * the summed Adams weights for the other components are kept alongside.
+ *
+ * @return true on success, false on failure
+ */
+//------------------------------------------------------------------------------
+bool GaussJackson::SetWeights()
+{
+   if ((pweights == NULL) || (cweights == NULL))
+      return false;
+
+   for (Integer k = 0; k < stepCount; ++k)
+   {
+      pweights[k] = 0.0;
+      cweights[k] = 0.0;
+   }
+   velocityPredictor.assign(GJ_ORDER + 1, 0.0);
+   velocityCorrector.assign(GJ_ORDER + 1, 0.0);
+
+   ComputeWeights(1.0, pweights, &velocityPredictor[0]);
+   ComputeWeights(0.0, cweights, &velocityCorrector[0]);
+
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// bool FireStartupStep()
+//------------------------------------------------------------------------------
+/**
+ * Takes one step with the starter and records the derivatives at its end
+ *
+ * After GJ_ORDER steps the table is full and the sums are set from the
+ * state at the last step.
+ *
+ * @return true on success, false on failure
+ */
+//------------------------------------------------------------------------------
+bool GaussJackson::FireStartupStep()
+{
+   #ifdef DEBUG_PROPAGATION
+      MessageInterface::ShowMessage("   Startup step %d, size %.12lf\n",
+            startupCount, stepSize);
+   #endif
+
+   if (starter == NULL)
+      return false;
+
+   if (startupCount == 0)
+   {
+      if (!EvaluateAt(inState, physicalModel->GetTime()))
+         return false;
+      PushDerivative(ddt);
+      validPoints = 1;
+   }
+
+   if (!starter->Step(stepSize))
+      return false;
+
+   if (!EvaluateAt(inState, physicalModel->GetTime()))
+      return false;
+   PushDerivative(ddt);
+   ++validPoints;
+   ++startupCount;
+
+   if (startupCount == GJ_ORDER)
+   {
+      gridState.assign(inState, inState + dimension);
+      gridTime = physicalModel->GetTime();
+      InitializeSums();
+      quietSteps = 0;
+      startupComplete = true;
+   }
+
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// bool Predict()
+//------------------------------------------------------------------------------
+/**
+ * Extrapolates the state to the next grid point
+ *
+ * @return true on success
+ */
+//------------------------------------------------------------------------------
+bool GaussJackson::Predict()
+{
+   Evaluate(1.0, pweights, &velocityPredictor[0], NULL, predictorState);
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// bool Correct()
+//------------------------------------------------------------------------------
+/**
+ * Evaluates the derivatives at the predicted state and corrects it
+ *
+ * @return true on success, false if the derivatives cannot be evaluated
+ */
+//------------------------------------------------------------------------------
+bool GaussJackson::Correct()
+{
+   if (!EvaluateAt(predictorState, gridTime + stepSize))
+      return false;
+   memcpy(&predictedDerivative[0], ddt, dimension * sizeof(Real));
+
+   Evaluate(0.0, cweights, &velocityCorrector[0], &predictedDerivative[0],
+         correctorState);
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// Real EstimateError()
+//------------------------------------------------------------------------------
+/**
+ * Estimates the error in the corrected state
+ *
+ * The predictor and corrector errors are the first neglected terms of their
+ * series, both proportional to the next backward difference, so the
+ * corrector error is
+ *
+ * \f[ EE_i = \left|{{c_9}\over{p_9 - c_9}}\right|
+ *            \left|r_i^{(C)} - r_i^{(P)}\right| \f]
+ *
+ * with separate factors for positions and for the other components.
+ *
+ * @return The maximum error found
+ */
+//------------------------------------------------------------------------------
+Real GaussJackson::EstimateError()
+{
+   for (Integer i = 0; i < dimension; ++i)
+      errorEstimates[i] = (positionMap[i] >= 0 ? positionErrorFactor :
+            velocityErrorFactor) * fabs(correctorState[i] - predictorState[i]);
+
+   maxError = physicalModel->EstimateError(errorEstimates, correctorState);
+
+   return maxError;
+}
+
+//------------------------------------------------------------------------------
+// bool Reset()
+//------------------------------------------------------------------------------
+/**
+ * Discards the difference table so that the next step starts up again
+ *
+ * @return true on success
+ */
+//------------------------------------------------------------------------------
+bool GaussJackson::Reset()
+{
+   #ifdef DEBUG_PROPAGATION
+      MessageInterface::ShowMessage("GaussJackson Resetting\n");
+   #endif
+
+   startupCount = 0;
+   startupComplete = false;
+   ddt = NULL;
+   validPoints = 0;
+   quietSteps = 0;
+   failedStep = 0.0;
+   retryQuietSteps = GJ_ORDER;
+   tableDenseOutput = false;
+
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// bool AdaptStep(Real maxError)
+//------------------------------------------------------------------------------
+/**
+ * Changes the step size after an error estimate
+ *
+ * A rejected step halves the step size.  After GJ_ORDER consecutive steps
+ * with an error below LowerError, and once the history spans 2 * GJ_ORDER
+ * steps, the step size is doubled.  Neither change restarts the integrator.
+ *
+ * Growing back to the size of the last rejected step, or beyond it, takes
+ * 16 * GJ_ORDER quiet steps, and that run doubles each time the same size is
+ * rejected again.  Without this, an Accuracy that lies between the errors of two step
+ * sizes makes the step alternate between them, and the rejected steps cost
+ * both evaluations and accuracy.
+ *
+ * @param maxError The error estimate of the last step
+ *
+ * @return true on success, false on failure
+ */
+//------------------------------------------------------------------------------
+bool GaussJackson::AdaptStep(Real maxError)
+{
+   if (maxError > tolerance)
+   {
+      if (fabs(stepSize) == failedStep)
+         retryQuietSteps *= 2;
+      else
+      {
+         failedStep = fabs(stepSize);
+         retryQuietSteps = 16 * GJ_ORDER;
+      }
+      quietSteps = 0;
+      return HalveStep();
+   }
+
+   if ((maxError != 0.0) && (maxError < lowerError))
+      ++quietSteps;
+   else
+      quietSteps = 0;
+
+   Integer quietNeeded = GJ_ORDER;
+   if ((failedStep > 0.0) && (2.0 * fabs(stepSize) >= failedStep))
+      quietNeeded = retryQuietSteps;
+
+   if ((quietSteps >= quietNeeded) && (validPoints == stepCount) &&
+       (2.0 * fabs(stepSize) <= maximumStep))
+   {
+      quietSteps = 0;
+      return DoubleStep();
+   }
+
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// void BuildSeries()
+//------------------------------------------------------------------------------
+/**
+ * Builds the corrector series and the error estimate factors
+ *
+ * With \f$L(t) = -\ln(1-t)/t\f$, the summed Adams corrector coefficients are
+ * those of \f$(1/L(t) - 1)/t\f$ and the Gauss-Jackson corrector coefficients
+ * those of \f$(1/L^2(t) - 1 + t)/t^2\f$.  Both series are kept one term past
+ * the order for the error estimate.
+ */
+//------------------------------------------------------------------------------
+void GaussJackson::BuildSeries()
+{
+   const Integer terms = GJ_ORDER + 4;
+   RealArray l(terms), r(terms, 0.0), q(terms, 0.0);
+
+   for (Integer k = 0; k < terms; ++k)
+      l[k] = 1.0 / (k + 1);
+
+   r[0] = 1.0;
+   for (Integer k = 1; k < terms; ++k)
+      for (Integer m = 1; m <= k; ++m)
+         r[k] -= l[m] * r[k-m];
+
+   for (Integer k = 0; k < terms; ++k)
+      for (Integer m = 0; m <= k; ++m)
+         q[k] += r[m] * r[k-m];
+
+   adamsSeries.resize(GJ_ORDER + 2);
+   gjSeries.resize(GJ_ORDER + 2);
+   for (Integer i = 0; i < GJ_ORDER + 2; ++i)
+   {
+      adamsSeries[i] = r[i+1];
+      gjSeries[i]    = q[i+2];
+   }
+
+   // The predictor coefficients are partial sums of the corrector series
+   Real pp = 0.0, pv = 1.0;
+   for (Integer i = 0; i < GJ_ORDER + 2; ++i)
+   {
+      pp += gjSeries[i];
+      pv += adamsSeries[i];
+   }
+
+   Real cp = gjSeries[GJ_ORDER + 1], cv = adamsSeries[GJ_ORDER + 1];
+   positionErrorFactor = fabs(cp / (pp - cp));
+   velocityErrorFactor = fabs(cv / (pv - cv));
+}
+
+//------------------------------------------------------------------------------
+// void ComputeWeights(Real j, Real *posWeights, Real *velWeights)
+//------------------------------------------------------------------------------
+/**
+ * Computes the ordinate weights for the state at \f$t_n + jh\f$
+ *
+ * The difference coefficients come from the corrector series multiplied by
+ * \f$B(t) = (1-t)^{-j}\f$; with \f$C = B - 1 - jt\f$,
+ *
+ * \f[ V_j = (B - 1)/t + B\,g, \qquad
+ *     P_j = -j + (C/t^2 - C/t) + B\,d \f]
+ *
+ * The differences are then expanded so that the weights apply directly to
+ * \f$f_n, f_{n-1}, \ldots, f_{n-8}\f$.
+ *
+ * @param j          The step fraction
+ * @param posWeights The position weights (output, GJ_ORDER + 1 elements)
+ * @param velWeights The weights for the other components (output)
+ */
+//------------------------------------------------------------------------------
+void GaussJackson::ComputeWeights(Real j, Real *posWeights, Real *velWeights)
+{
+   Real b[GJ_ORDER + 3];
+   Real pos[GJ_ORDER + 1], vel[GJ_ORDER + 1];
+
+   b[0] = 1.0;
+   for (Integer k = 1; k < GJ_ORDER + 3; ++k)
+      b[k] = b[k-1] * (j + k - 1) / k;
+
+   for (Integer i = 0; i <= GJ_ORDER; ++i)
+   {
+      vel[i] = b[i+1];
+      pos[i] = b[i+2] - (i == 0 ? j : b[i+1]);
+      for (Integer m = 0; m <= i; ++m)
+      {
+         vel[i] += b[m] * adamsSeries[i-m];
+         pos[i] += b[m] * gjSeries[i-m];
+      }
+   }
+
+   for (Integer k = 0; k <= GJ_ORDER; ++k)
+   {
+      Real binomial = 1.0, pw = 0.0, vw = 0.0;
+      for (Integer i = k; i <= GJ_ORDER; ++i)
+      {
+         pw += pos[i] * binomial;
+         vw += vel[i] * binomial;
+         binomial *= (i + 1.0) / (i + 1.0 - k);
+      }
+      posWeights[k] = (k % 2 == 0 ? pw : -pw);
+      velWeights[k] = (k % 2 == 0 ? vw : -vw);
+   }
+}
+
+//------------------------------------------------------------------------------
+// void Evaluate(Real j, const Real *posWeights, const Real *velWeights,
+//               const Real *newest, Real *state)
+//------------------------------------------------------------------------------
+/**
+ * Applies a set of weights to the table
+ *
+ * When newest is set the table is taken one step on, as the corrector needs:
+ * newest is the latest derivative set, followed by the history, and the sums
+ * include it.
+ *
+ * @param j          The step fraction the weights were computed for
+ * @param posWeights The position weights
+ * @param velWeights The weights for the other components
+ * @param newest     The derivatives at the next grid point, or NULL
+ * @param state      The resulting state (output, dimension elements)
+ */
+//------------------------------------------------------------------------------
+void GaussJackson::Evaluate(Real j, const Real *posWeights,
+      const Real *velWeights, const Real *newest, Real *state)
+{
+   const Real *rows[GJ_ORDER + 1];
+   Integer first = 0;
+   if (newest != NULL)
+   {
+      rows[0] = newest;
+      first = 1;
+   }
+   for (Integer k = first; k <= GJ_ORDER; ++k)
+      rows[k] = history[k - first];
+
+   Real h2 = stepSize * stepSize;
+   for (Integer i = 0; i < dimension; ++i)
+   {
+      Integer v = positionMap[i];
+      Real sum = 0.0;
+      if (v >= 0)
+      {
+         for (Integer k = 0; k <= GJ_ORDER; ++k)
+            sum += posWeights[k] * rows[k][v];
+         Real ss = secondSum[i], s = firstSum[v];
+         if (newest != NULL)
+         {
+            ss += s;
+            s += newest[v];
+         }
+         state[i] = h2 * (ss + j * s + sum);
+      }
+      else
+      {
+         for (Integer k = 0; k <= GJ_ORDER; ++k)
+            sum += velWeights[k] * rows[k][i];
+         Real s = firstSum[i];
+         if (newest != NULL)
+            s += newest[i];
+         state[i] = stepSize * (s + sum);
+      }
+   }
+}
+
+//------------------------------------------------------------------------------
+// void Interpolate(Real j, Real *state)
+//------------------------------------------------------------------------------
+/**
+ * Interpolates the state at \f$t_n + jh\f$ from the table
+ *
+ * @param j     The step fraction, normally in [-GJ_ORDER, 0]
+ * @param state The state (output, dimension elements)
+ */
+//------------------------------------------------------------------------------
+void GaussJackson::Interpolate(Real j, Real *state)
+{
+   ComputeWeights(j, &positionWeights[0], &velocityWeights[0]);
+   Evaluate(j, &positionWeights[0], &velocityWeights[0], NULL, state);
+}
+
+//------------------------------------------------------------------------------
+// void PushDerivative(const Real *derivative)
+//------------------------------------------------------------------------------
+/**
+ * Adds a derivative set to the front of the history, dropping the oldest
+ *
+ * @param derivative The derivatives at the new grid point
+ */
+//------------------------------------------------------------------------------
+void GaussJackson::PushDerivative(const Real *derivative)
+{
+   Real *oldest = history[stepCount - 1];
+   for (Integer k = stepCount - 1; k > 0; --k)
+      history[k] = history[k-1];
+   history[0] = oldest;
+   memcpy(history[0], derivative, dimension * sizeof(Real));
+}
+
+//------------------------------------------------------------------------------
+// void InitializeSums()
+//------------------------------------------------------------------------------
+/**
+ * Sets the sums so that the corrector reproduces the grid state
+ *
+ * Called when the table is full after startup and after every step size
+ * change.
+ */
+//------------------------------------------------------------------------------
+void GaussJackson::InitializeSums()
+{
+   Real h2 = stepSize * stepSize;
+   for (Integer i = 0; i < dimension; ++i)
+   {
+      Real sum = 0.0;
+      for (Integer k = 0; k <= GJ_ORDER; ++k)
+         sum += velocityCorrector[k] * history[k][i];
+      firstSum[i] = gridState[i] / stepSize - sum;
+   }
+
+   for (Integer i = 0; i < dimension; ++i)
+   {
+      Integer v = positionMap[i];
+      secondSum[i] = 0.0;
+      if (v >= 0)
+      {
+         Real sum = 0.0;
+         for (Integer k = 0; k <= GJ_ORDER; ++k)
+            sum += cweights[k] * history[k][v];
+         secondSum[i] = gridState[i] / h2 - sum;
+      }
+   }
+}
+
+//------------------------------------------------------------------------------
+// bool TakeGridStep()
+//------------------------------------------------------------------------------
+/**
+ * Takes one accepted PECE step from the last grid point
+ *
+ * @return true on success, false if the step failed
+ */
+//------------------------------------------------------------------------------
+bool GaussJackson::TakeGridStep()
+{
+   MoveModelToGrid();
+
+   while (true)
+   {
+      ++stepAttempts;
+      if (!Predict() || !Correct())
+         return false;
+      if (EstimateError() < 0.0)
+         return false;
+
+      #ifdef DEBUG_STEP_CONTROL
+         MessageInterface::ShowMessage("GJ step %.12lf from %.12lf: error "
+               "%le\n", stepSize, gridTime, maxError);
+      #endif
+
+      if (maxError <= tolerance)
+         break;
+
+      if (fabs(stepSize) * 0.5 < minimumStep)
+      {
+         // Tried and failed at the minimum step size
+         if (stopIfAccuracyViolated)
+            throw PropagatorException(typeSource + ": Accuracy settings will "
+                  "be violated with current step size values.\n");
+         if (!accuracyWarningTriggered)
+         {
+            accuracyWarningTriggered = true;
+            MessageInterface::ShowMessage("**** Warning **** %s: Accuracy "
+                  "settings will be violated with current step size "
+                  "values.\n", typeSource.c_str());
+         }
+         break;
+      }
+
+      if (!AdaptStep(maxError))
+         return false;
+      if (stepAttempts >= maxStepAttempts)
+         return false;
+   }
+
+   // Final evaluation, then take the table and sums one step on
+   if (!EvaluateAt(correctorState, gridTime + stepSize))
+      return false;
+   for (Integer i = 0; i < dimension; ++i)
+      if (positionMap[i] >= 0)
+         secondSum[i] += firstSum[positionMap[i]];
+   for (Integer i = 0; i < dimension; ++i)
+      firstSum[i] += ddt[i];
+   PushDerivative(ddt);
+   if (validPoints < stepCount)
+      ++validPoints;
+
+   gridState.assign(correctorState, correctorState + dimension);
+   memcpy(outState, correctorState, dimension * sizeof(Real));
+   physicalModel->IncrementTime(stepSize);
+   gridTime = physicalModel->GetTime();
+   stepAttempts = 0;
+
+   // A step accepted at the minimum step size with too large an error keeps
+   // that step size; halving it would go below MinStep
+   if (maxError > tolerance)
+   {
+      quietSteps = 0;
+      return true;
+   }
+
+   return AdaptStep(maxError);
+}
+
+//------------------------------------------------------------------------------
+// bool HalveStep()
+//------------------------------------------------------------------------------
+/**
+ * Halves the step size without restarting
+ *
+ * The derivatives at the half points are evaluated at states interpolated
+ * from the table; the other points are already in the history.
+ *
+ * @return true on success, false if a derivative evaluation failed
+ */
+//------------------------------------------------------------------------------
+bool GaussJackson::HalveStep()
+{
+   const Integer half = GJ_ORDER / 2;
+
+   // The history rows past the table are free for the half points
+   for (Integer m = 0; m < half; ++m)
+   {
+      Real j = -(2 * m + 1) * 0.5;
+      Interpolate(j, &interpolatedState[0]);
+      if (!EvaluateAt(&interpolatedState[0], gridTime + j * stepSize))
+         return false;
+      memcpy(history[GJ_ORDER + 1 + m], ddt, dimension * sizeof(Real));
+   }
+
+   std::vector<Real*> rows(stepCount);
+   for (Integer k = 0; k <= GJ_ORDER; ++k)
+      rows[k] = (k % 2 == 0 ? history[k/2] : history[GJ_ORDER + 1 + k/2]);
+   Integer next = GJ_ORDER + 1;
+   for (Integer k = half + 1; k <= GJ_ORDER; ++k)
+      rows[next++] = history[k];
+   for (Integer k = GJ_ORDER + 1 + half; k < stepCount; ++k)
+      rows[next++] = history[k];
+   for (Integer k = 0; k < stepCount; ++k)
+      history[k] = rows[k];
+
+   stepSize *= 0.5;
+   validPoints = GJ_ORDER + 1;
+   InitializeSums();
+
+   #ifdef DEBUG_STEP_CONTROL
+      MessageInterface::ShowMessage("GJ step halved to %.12lf\n", stepSize);
+   #endif
+
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// bool DoubleStep()
+//------------------------------------------------------------------------------
+/**
+ * Doubles the step size from every other point of the history
+ *
+ * @return true on success
+ */
+//------------------------------------------------------------------------------
+bool GaussJackson::DoubleStep()
+{
+   std::vector<Real*> rows(stepCount);
+   for (Integer k = 0; k <= GJ_ORDER; ++k)
+      rows[k] = history[2 * k];
+   for (Integer k = 0; k < GJ_ORDER; ++k)
+      rows[GJ_ORDER + 1 + k] = history[2 * k + 1];
+   for (Integer k = 0; k < stepCount; ++k)
+      history[k] = rows[k];
+
+   stepSize *= 2.0;
+   validPoints = GJ_ORDER + 1;
+   InitializeSums();
+
+   #ifdef DEBUG_STEP_CONTROL
+      MessageInterface::ShowMessage("GJ step doubled to %.12lf\n", stepSize);
+   #endif
+
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// bool EvaluateAt(Real *state, Real atTime)
+//------------------------------------------------------------------------------
+/**
+ * Evaluates the derivatives of a state at an elapsed time
+ *
+ * @param state  The state
+ * @param atTime The elapsed time of the state
+ *
+ * @return true on success; the derivatives are then in ddt
+ */
+//------------------------------------------------------------------------------
+bool GaussJackson::EvaluateAt(Real *state, Real atTime)
+{
+   if (!physicalModel->GetDerivatives(state,
+         atTime - physicalModel->GetTime()))
+      return false;
+   ddt = physicalModel->GetDerivativeArray();
+   return (ddt != NULL);
+}
+
+//------------------------------------------------------------------------------
+// void CheckModelState()
+//------------------------------------------------------------------------------
+/**
+ * Resets the integrator if the model state does not belong to the table
+ *
+ * The state is accepted if it is the last output, the state at the start of
+ * the last step, or matches the table interpolated to the model time to
+ * within the accuracy setting.  Anything else, a maneuver for example,
+ * starts the integrator up again.
+ */
+//------------------------------------------------------------------------------
+void GaussJackson::CheckModelState()
+{
+   if (!startupComplete && (startupCount == 0))
+      return;
+
+   Real now = physicalModel->GetTime();
+   const Real *state = physicalModel->GetState();
+   size_t bytes = dimension * sizeof(Real);
+   bool matches = false;
+
+   if ((now == lastOutputTime) && (memcmp(state, &lastOutput[0], bytes) == 0))
+      matches = true;
+   else if (startupComplete)
+   {
+      Real j = (now - gridTime) / stepSize;
+      if ((j * fabs(stepSize) <= smallestTime) && (j >= -GJ_ORDER))
+      {
+         if ((now == stepStartTime) &&
+             (memcmp(state, &stepStartState[0], bytes) == 0))
+            matches = true;
+         else
+         {
+            Interpolate(j, &interpolatedState[0]);
+            matches = true;
+            for (Integer i = 0; (i < dimension) && matches; ++i)
+            {
+               Real scale = fabs(interpolatedState[i]);
+               if (fabs(state[i] - interpolatedState[i]) >
+                   tolerance * (scale > 1.0 ? scale : 1.0))
+                  matches = false;
+            }
+         }
+      }
+   }
+
+   if (!matches)
+   {
+      #ifdef DEBUG_PROPAGATION
+         MessageInterface::ShowMessage("GaussJackson: the model state changed "
+               "outside of the integrator; restarting\n");
+      #endif
+      Reset();
+   }
+}
+
+//------------------------------------------------------------------------------
+// void MoveModelToGrid()
+//------------------------------------------------------------------------------
+/**
+ * Puts the last grid point state into the physical model
+ *
+ * Grid steps are taken from the grid point, so the model time offsets and
+ * the error control see the same start state whatever was last published.
+ */
+//------------------------------------------------------------------------------
+void GaussJackson::MoveModelToGrid()
+{
+   if ((physicalModel->GetTime() != gridTime) ||
+       (memcmp(outState, &gridState[0], dimension * sizeof(Real)) != 0))
+   {
+      memcpy(outState, &gridState[0], dimension * sizeof(Real));
+      physicalModel->IncrementTime(gridTime - physicalModel->GetTime());
+      gridTime = physicalModel->GetTime();
+   }
+}
+
+//------------------------------------------------------------------------------
+// void PublishState(const Real *state, Real atTime)
+//------------------------------------------------------------------------------
+/**
+ * Writes a state into the physical model
+ *
+ * @param state  The state
+ * @param atTime The elapsed time of the state
+ */
+//------------------------------------------------------------------------------
+void GaussJackson::PublishState(const Real *state, Real atTime)
+{
+   if (state != outState)
+      memcpy(outState, state, dimension * sizeof(Real));
+   if (atTime != physicalModel->GetTime())
+      physicalModel->IncrementTime(atTime - physicalModel->GetTime());
+}
+
+//------------------------------------------------------------------------------
+// void RecordStep(Real startTime, bool startupStep)
+//------------------------------------------------------------------------------
+/**
+ * Records the output of a step and its dense output data
+ *
+ * @param startTime   The elapsed time at the start of the step
+ * @param startupStep true if the step was a single starter step
+ */
+//------------------------------------------------------------------------------
+void GaussJackson::RecordStep(Real startTime, bool startupStep)
+{
+   lastOutputTime = physicalModel->GetTime();
+   lastOutput.assign(outState, outState + dimension);
+   stepTaken = lastOutputTime - startTime;
+
+   denseStartTime = startTime;
+   denseStepSize = stepTaken;
+   if (stepTaken == 0.0)
+      return;
+
+   if (startupComplete)
+   {
+      if ((startTime - gridTime) / stepSize >= -GJ_ORDER)
+      {
+         tableDenseOutput = true;
+         denseOutputValid = true;
+      }
+   }
+   else if (startupStep && (startupCount > 0))
+   {
+      // Both end derivatives of a starter step are in the history
+      denseStartState = stepStartState;
+      denseStartDerivative.assign(history[1], history[1] + dimension);
+      denseEndState = lastOutput;
+      denseEndDerivative.assign(history[0], history[0] + dimension);
+      denseEndDerivativeValid = true;
+      denseOutputValid = true;
+   }
+}
@@ -0,0 +1,166 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                                GaussJackson
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/16
+//
+/**
+ * Definition of the GaussJackson integrator, an 8th order summed multistep
+ * integrator for long orbit propagations.
+ */
+//------------------------------------------------------------------------------
+#ifndef GaussJackson_hpp
+#define GaussJackson_hpp
+
+#include "gmatdefs.hpp"
+#include "PredictorCorrector.hpp"
+
+/**
+ * Implementation of the 8th order Gauss-Jackson predictor-corrector
+ *
+ * Positions, whose derivatives are the velocities, are integrated from the
+ * accelerations with the Gauss-Jackson second sum formulae.  Velocities and
+ * all other components, including the state transition matrix, use the
+ * summed Adams formulae on their own derivatives.  With the backward
+ * differences \f$\nabla^i f_n\f$ of the derivatives on a uniform grid, the
+ * first sum \f$s_n = s_{n-1} + f_n\f$ and the second sum
+ * \f$S_n = S_{n-1} + s_n\f$, the state at \f$t_n + jh\f$ is
+ *
+ * \f[ y_{n+j} = h^2 \left(S_{n-1} + j s_n + \sum_{i=0}^{8} P_{j,i}
+ *              \nabla^i f_n\right) \f]
+ *
+ * for positions, and
+ *
+ * \f[ y_{n+j} = h \left(s_n + \sum_{i=0}^{8} V_{j,i} \nabla^i f_n\right) \f]
+ *
+ * for the other components.  The coefficients are generated from their
+ * generating functions when the integrator is initialized; j = 1 gives the
+ * predictor, j = 0 the corrector, and other values interpolate inside the
+ * table.
+ *
+ * Each step is a PECE cycle: predict, evaluate, correct, evaluate, so a step
+ * costs two force model evaluations regardless of the order.  The sums are
+ * started from 8 steps of the RungeKutta89 starter.  Step size changes do not
+ * restart the integrator: halving interpolates the 4 missing half points
+ * from the current table, and doubling reuses every other point of the 17
+ * points kept in the history.  Requests that end between grid points, and
+ * restarts from states inside the table (as Propagate does when it locates a
+ * stopping condition), are served by interpolation.
+ */
+class GMAT_API GaussJackson : public PredictorCorrector
+{
+public:
+   GaussJackson(const std::string &nomme = "");
+   virtual ~GaussJackson();
+
+   GaussJackson(const GaussJackson& gj);
+   GaussJackson&        operator=(const GaussJackson& gj);
+
+   virtual GmatBase*    Clone() const;
+
+   virtual bool         Initialize();
+   virtual bool         Step();
+   virtual bool         Step(Real dt);
+   virtual bool         GetDenseState(Real atTime, Real *state);
+
+protected:
+   /// Order of the difference table; the formulae use order + 1 points
+   static const Integer GJ_ORDER = 8;
+
+   /// Series coefficients of the summed Adams corrector
+   RealArray            adamsSeries;
+   /// Series coefficients of the Gauss-Jackson corrector
+   RealArray            gjSeries;
+   /// Predictor weights for the components integrated with summed Adams
+   RealArray            velocityPredictor;
+   /// Corrector weights for the components integrated with summed Adams
+   RealArray            velocityCorrector;
+   /// Error estimate factor for positions
+   Real                 positionErrorFactor;
+   /// Error estimate factor for the other components
+   Real                 velocityErrorFactor;
+
+   /// Velocity index for each position component, -1 for other components
+   IntegerArray         positionMap;
+   /// The first sums, for every component's derivative
+   RealArray            firstSum;
+   /// The second sums, used for the position components
+   RealArray            secondSum;
+   /// The derivatives at the predicted state
+   RealArray            predictedDerivative;
+   /// Scratch state for interpolation
+   RealArray            interpolatedState;
+   /// Scratch weights for interpolation
+   RealArray            positionWeights;
+   /// Scratch weights for interpolation
+   RealArray            velocityWeights;
+
+   /// The state at the last grid point
+   RealArray            gridState;
+   /// The elapsed time of the last grid point
+   Real                 gridTime;
+   /// Number of history entries filled at the current step size
+   Integer              validPoints;
+   /// Consecutive steps with an error below LowerError
+   Integer              quietSteps;
+   /// Size of the last rejected step, 0.0 before any rejection
+   Real                 failedStep;
+   /// Quiet steps needed before the step grows back to failedStep
+   Integer              retryQuietSteps;
+
+   /// The state written to the physical model by the last step
+   RealArray            lastOutput;
+   /// The elapsed time of lastOutput
+   Real                 lastOutputTime;
+   /// The model state when the last step started
+   RealArray            stepStartState;
+   /// The elapsed time of stepStartState
+   Real                 stepStartTime;
+   /// True when the dense output comes from the difference table
+   bool                 tableDenseOutput;
+
+   virtual bool         SetWeights();
+   virtual bool         FireStartupStep();
+   virtual bool         Predict();
+   virtual bool         Correct();
+   virtual Real         EstimateError();
+   virtual bool         Reset();
+   virtual bool         AdaptStep(Real maxError);
+
+   void                 BuildSeries();
+   void                 ComputeWeights(Real j, Real *posWeights,
+                                       Real *velWeights);
+   void                 Evaluate(Real j, const Real *posWeights,
+                                 const Real *velWeights, const Real *newest,
+                                 Real *state);
+   void                 Interpolate(Real j, Real *state);
+   void                 PushDerivative(const Real *derivative);
+   void                 InitializeSums();
+   bool                 TakeGridStep();
+   bool                 HalveStep();
+   bool                 DoubleStep();
+   bool                 EvaluateAt(Real *state, Real atTime);
+   void                 CheckModelState();
+   void                 MoveModelToGrid();
+   void                 PublishState(const Real *state, Real atTime);
+   void                 RecordStep(Real startTime, bool startupStep);
+};
+
+#endif // GaussJackson_hpp
@@ -84,6 +84,7 @@
 // **************************************************************************
 
 #include "Integrator.hpp"
+#include "ParameterIndex.hpp"
 #include "MessageInterface.hpp"
 #include "PropagatorException.hpp"
 #include <sstream>
@@ -149,7 +150,11 @@ Integrator::Integrator(const std::string &typeStr, const std::string &nomme)
       errorEstimates          (NULL),
       errorThreshold          (0.10),
       derivativeOrder         (1),
-      hasErrorControl         (true)
+      hasErrorControl         (true),
+      denseOutputValid        (false),
+      denseEndDerivativeValid (false),
+      denseStartTime          (0.0),
+      denseStepSize           (0.0)
 {
    objectTypeNames.push_back("Integrator");
    parameterCount = IntegratorParamCount;
@@ -183,7 +188,11 @@ Integrator::Integrator(const Integrator& i) :
     errorEstimates          (NULL),
     errorThreshold          (i.errorThreshold),
     derivativeOrder         (i.derivativeOrder),
-    hasErrorControl         (i.hasErrorControl)
+    hasErrorControl         (i.hasErrorControl),
+    denseOutputValid        (false),
+    denseEndDerivativeValid (false),
+    denseStartTime          (0.0),
+    denseStepSize           (0.0)
 {
    parameterCount = IntegratorParamCount;
 }
@@ -225,6 +234,8 @@ Integrator& Integrator::operator=(const Integrator& i)
     errorThreshold         = i.errorThreshold;
     hasErrorControl        = i.hasErrorControl;
 
+    InvalidateDenseOutput();
+
     return *this;
 }
 
@@ -265,11 +276,11 @@ std::string Integrator::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer Integrator::GetParameterID(const std::string &str) const
 {
-    for (int i = PropagatorParamCount; i < IntegratorParamCount; i++)
-    {
-        if (str == PARAMETER_TEXT[i - PropagatorParamCount])
-            return i;
-    }
+    static const ParameterIndex parameterIndex("Integrator", PARAMETER_TEXT,
+          PropagatorParamCount, IntegratorParamCount);
+    Integer id = parameterIndex.Find(str);
+    if (id != -1)
+       return id;
     return Propagator::GetParameterID(str);
 }
 
@@ -681,3 +692,165 @@ Integer Integrator::GetPropagatorOrder() const
 {
     return 1;
 }
+
+//------------------------------------------------------------------------------
+// bool HasDenseOutput() const
+//------------------------------------------------------------------------------
+/**
+ * Reports whether the integrator can interpolate across its last step.
+ *
+ * Dense output is valid from the end of an accepted step until the next call
+ * to Step(); it covers only the last accepted step, so a Step(dt) call that
+ * takes several internal steps is covered only over the final one.
+ *
+ * @return true if GetDenseState() can be called
+ */
+//------------------------------------------------------------------------------
+bool Integrator::HasDenseOutput() const
+{
+   return denseOutputValid;
+}
+
+//------------------------------------------------------------------------------
+// Real GetDenseStepStart() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the elapsed time, in the physical model's time system, at the start
+ * of the step covered by the dense output.
+ *
+ * @return The start time of the last accepted step
+ */
+//------------------------------------------------------------------------------
+Real Integrator::GetDenseStepStart() const
+{
+   return denseStartTime;
+}
+
+//------------------------------------------------------------------------------
+// Real GetDenseStepSize() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the signed size of the step covered by the dense output.
+ *
+ * @return The size of the last accepted step
+ */
+//------------------------------------------------------------------------------
+Real Integrator::GetDenseStepSize() const
+{
+   return denseStepSize;
+}
+
+//------------------------------------------------------------------------------
+// bool GetDenseState(Real atTime, Real *state)
+//------------------------------------------------------------------------------
+/**
+ * Interpolates the state inside the last accepted step.
+ *
+ * This default implementation is the cubic Hermite interpolant built from the
+ * states and derivatives at the two ends of the step.  When the end
+ * derivative is not a by-product of the step it is evaluated the first time
+ * the step is queried, so each step costs at most one extra derivative call.
+ * Integrators whose coefficients carry a continuous extension override this
+ * method.
+ *
+ * @param atTime The elapsed time of the requested state; it should lie in
+ *               [GetDenseStepStart(), GetDenseStepStart() + GetDenseStepSize()]
+ * @param state  The interpolated state (output, dimension elements)
+ *
+ * @return true on success, false if there is no dense output
+ */
+//------------------------------------------------------------------------------
+bool Integrator::GetDenseState(Real atTime, Real *state)
+{
+   if (!denseOutputValid || (denseStepSize == 0.0))
+      return false;
+
+   if (!denseEndDerivativeValid)
+      if (!CompleteDenseStep())
+         return false;
+
+   Real theta  = (atTime - denseStartTime) / denseStepSize;
+   Real theta2 = theta * theta;
+   Real theta3 = theta2 * theta;
+
+   Real h00 = 2.0 * theta3 - 3.0 * theta2 + 1.0;
+   Real h10 = (theta3 - 2.0 * theta2 + theta) * denseStepSize;
+   Real h01 = 3.0 * theta2 - 2.0 * theta3;
+   Real h11 = (theta3 - theta2) * denseStepSize;
+
+   for (Integer i = 0; i < dimension; ++i)
+      state[i] = h00 * denseStartState[i] + h10 * denseStartDerivative[i] +
+                 h01 * denseEndState[i]   + h11 * denseEndDerivative[i];
+
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// void InvalidateDenseOutput()
+//------------------------------------------------------------------------------
+/**
+ * Marks the dense output data as stale.
+ */
+//------------------------------------------------------------------------------
+void Integrator::InvalidateDenseOutput()
+{
+   denseOutputValid = false;
+   denseEndDerivativeValid = false;
+}
+
+//------------------------------------------------------------------------------
+// bool CompleteDenseStep()
+//------------------------------------------------------------------------------
+/**
+ * Fills in the dense output data that the step did not produce.
+ *
+ * The default evaluates the derivative at the end of the step.
+ *
+ * @return true on success
+ */
+//------------------------------------------------------------------------------
+bool Integrator::CompleteDenseStep()
+{
+   denseEndDerivative.resize(dimension);
+   if (!EvaluateDenseDerivative(&denseEndState[0],
+         denseStartTime + denseStepSize, &denseEndDerivative[0]))
+      return false;
+
+   denseEndDerivativeValid = true;
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// bool EvaluateDenseDerivative(const Real *state, Real atTime,
+//                              Real *derivative)
+//------------------------------------------------------------------------------
+/**
+ * Evaluates the derivatives at a state inside the last accepted step.
+ *
+ * The physical model may have been moved since the step was taken, so the
+ * time offset is measured from its current elapsed time.
+ *
+ * @param state      The state
+ * @param atTime     The elapsed time of the state
+ * @param derivative The derivatives (output, dimension elements)
+ *
+ * @return true on success
+ */
+//------------------------------------------------------------------------------
+bool Integrator::EvaluateDenseDerivative(const Real *state, Real atTime,
+                                         Real *derivative)
+{
+   if (physicalModel == NULL)
+      return false;
+
+   RealArray work(state, state + dimension);
+   physicalModel->SetDirection(denseStepSize > 0.0 ? 1.0 : -1.0);
+   if (!physicalModel->GetDerivatives(&work[0],
+         atTime - physicalModel->GetTime()))
+      return false;
+
+   const Real *derivatives = physicalModel->GetDerivativeArray();
+   memcpy(derivative, derivatives, dimension * sizeof(Real));
+
+   return true;
+}
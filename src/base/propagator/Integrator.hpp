@@ -179,6 +179,12 @@ public:
     virtual bool RawStep() = 0;
     virtual Integer GetPropagatorOrder(void) const; 
 
+    // Dense output (continuous extension) over the last accepted step
+    virtual bool HasDenseOutput() const;
+    virtual Real GetDenseStepStart() const;
+    virtual Real GetDenseStepSize() const;
+    virtual bool GetDenseState(Real atTime, Real *state);
+
 protected:
 
     //------------------------------------------------------------------------------
@@ -283,6 +289,28 @@ protected:
     Integer derivativeOrder;
     /// Flag indicating whether integrator has error control
     bool hasErrorControl;
+
+    /// Set when the dense output data describes the last accepted step
+    bool denseOutputValid;
+    /// Set when the derivative at the end of the last step is known
+    bool denseEndDerivativeValid;
+    /// Elapsed time at the start of the last accepted step
+    Real denseStartTime;
+    /// Size of the last accepted step
+    Real denseStepSize;
+    /// State at the start of the last accepted step
+    RealArray denseStartState;
+    /// Derivative at the start of the last accepted step
+    RealArray denseStartDerivative;
+    /// State at the end of the last accepted step
+    RealArray denseEndState;
+    /// Derivative at the end of the last accepted step
+    RealArray denseEndDerivative;
+
+    void InvalidateDenseOutput();
+    virtual bool CompleteDenseStep();
+    bool EvaluateDenseDerivative(const Real *state, Real atTime,
+                                 Real *derivative);
 };
 
 #endif
@@ -55,6 +55,7 @@
 
 
 #include "PredictorCorrector.hpp"
+#include "ParameterIndex.hpp"
 #include "MessageInterface.hpp"
 #include <fstream>
 
@@ -764,11 +765,11 @@ std::string PredictorCorrector::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer PredictorCorrector::GetParameterID(const std::string &str) const
 {
-   for (Integer i = STEP_COUNT; i < PredictorCorrectorParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - IntegratorParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("PredictorCorrector",
+         PARAMETER_TEXT, IntegratorParamCount, PredictorCorrectorParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
 
    return Integrator::GetParameterID(str);
 }
@@ -30,6 +30,7 @@
 //------------------------------------------------------------------------------
 
 #include "PropSetup.hpp"
+#include "ParameterIndex.hpp"
 
 #include "ODEModel.hpp"
 #include "Propagator.hpp"
@@ -872,11 +873,11 @@ std::string PropSetup::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer PropSetup::GetParameterID(const std::string &str) const
 {
-   for (int i=GmatBaseParamCount; i<PropSetupParamCount; i++)
-   {
-      if (str == PropSetup::PARAMETER_TEXT[i - GmatBaseParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("PropSetup",
+         PropSetup::PARAMETER_TEXT, GmatBaseParamCount, PropSetupParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
    
    return GmatBase::GetParameterID(str);
 }
@@ -81,6 +81,7 @@
 
 #include <sstream>
 #include "Propagator.hpp"
+#include "ParameterIndex.hpp"
 #include "gmatdefs.hpp"
 #include "GmatBase.hpp"
 #include "PhysicalModel.hpp"
@@ -285,10 +286,11 @@ std::string Propagator::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer Propagator::GetParameterID(const std::string &str) const
 {
-   for (Integer i = GmatBaseParamCount; i < PropagatorParamCount; ++i)
-      if (str == PARAMETER_TEXT[i - GmatBaseParamCount])
-         return i;
-        
+   static const ParameterIndex parameterIndex("Propagator", PARAMETER_TEXT,
+         GmatBaseParamCount, PropagatorParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
    return GmatBase::GetParameterID(str);
 }
 
@@ -96,7 +96,8 @@ RungeKutta::RungeKutta(Integer st, Integer order, const std::string &typeStr,
     incPower        (1.0/order),
     decPower        (1.0/(order-1)),
     stageState      (NULL),
-    candidateState  (NULL)
+    candidateState  (NULL),
+    fsalStage       (-1)
 {
 }
 
@@ -131,7 +132,8 @@ RungeKutta::RungeKutta(const RungeKutta& rk) :
     incPower        (rk.incPower),
     decPower        (rk.decPower),
     stageState      (NULL),
-    candidateState  (NULL)
+    candidateState  (NULL),
+    fsalStage       (-1)
 {
 }
 
@@ -162,6 +164,7 @@ RungeKutta& RungeKutta::operator=(const RungeKutta& rk)
     ee = NULL;
     stageState = NULL;
     candidateState = NULL;
+    fsalStage = -1;
 
     isInitialized = false;
 
@@ -281,6 +284,7 @@ bool RungeKutta::Initialize()
     {
        SetCoefficients();
        SetupAccumulator();
+       FindFsalStage();
     }
 
     isInitialized = true;
@@ -316,6 +320,8 @@ bool RungeKutta::Step()
        return false;
     }
 
+    InvalidateDenseOutput();
+
     if ((fabs(stepSize) < minimumStep) && !finalStep && !followUpStep)
         stepSize = ((stepSize > 0.0) ? minimumStep : -minimumStep);
     if (fabs(stepSize) > maximumStep)
@@ -351,6 +357,12 @@ bool RungeKutta::Step()
     bool goodStepTaken = false;
     Real maxerror;
 
+    // Keep the start of the step for the dense output; the accepted state
+    // overwrites the model state
+    Real stepStartTime = physicalModel->GetTime();
+    denseStartState.assign(physicalModel->GetState(),
+                           physicalModel->GetState() + dimension);
+
     do
     {
         if (!RawStep())
@@ -378,6 +390,8 @@ bool RungeKutta::Step()
         }
     } while (!goodStepTaken);
 
+    StoreDenseStep(stepStartTime);
+
     if (debug)
     {
        MessageInterface::ShowMessage("Propagator's step taken = %.15lf   ", stepTaken);
@@ -819,3 +833,78 @@ bool RungeKutta::SetupAccumulator()
     }
     return false;
 }
+
+//------------------------------------------------------------------------------
+// void FindFsalStage()
+//------------------------------------------------------------------------------
+/**
+ * Looks for a "first same as last" stage in the coefficients.
+ *
+ * A stage evaluated at the end of the step (ai = 1) from the propagated
+ * state (its bij row equals cj, and it does not contribute to the step)
+ * provides the derivative at the end of the step for free.  That derivative
+ * is used by the dense output.
+ */
+//------------------------------------------------------------------------------
+void RungeKutta::FindFsalStage()
+{
+   fsalStage = -1;
+   if ((ai == NULL) || (bij == NULL) || (cj == NULL))
+      return;
+
+   for (Integer i = stages - 1; i > 0; --i)
+   {
+      if (ai[i] != 1.0)
+         continue;
+
+      bool isFsal = true;
+      for (Integer j = 0; j < i; ++j)
+         if (fabs(bij[i][j] - cj[j]) > 1.0e-14)
+            isFsal = false;
+      for (Integer j = i; j < stages; ++j)
+         if (cj[j] != 0.0)
+            isFsal = false;
+
+      if (isFsal)
+      {
+         fsalStage = i;
+         break;
+      }
+   }
+}
+
+//------------------------------------------------------------------------------
+// void StoreDenseStep(Real startTime)
+//------------------------------------------------------------------------------
+/**
+ * Records the data the dense output needs from an accepted step.
+ *
+ * The stage data stay in ki until the next step, so the derivative at the
+ * start of the step, and at its end for tableaux with a FSAL stage, are read
+ * from there.
+ *
+ * @param startTime The elapsed time at the start of the step
+ */
+//------------------------------------------------------------------------------
+void RungeKutta::StoreDenseStep(Real startTime)
+{
+   denseStartTime = startTime;
+   denseStepSize = stepTaken;
+   if ((stepTaken == 0.0) || (derivativeOrder != 1))
+      return;
+
+   denseStartDerivative.resize(dimension);
+   for (Integer j = 0; j < dimension; ++j)
+      denseStartDerivative[j] = ki[0][j] / stepTaken;
+   denseEndState.assign(outState, outState + dimension);
+
+   if (fsalStage >= 0)
+   {
+      denseEndDerivative.resize(dimension);
+      for (Integer j = 0; j < dimension; ++j)
+         denseEndDerivative[j] = ki[fsalStage][j] / stepTaken;
+      denseEndDerivativeValid = true;
+   }
+
+   denseOutputValid = true;
+}
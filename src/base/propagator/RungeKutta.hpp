@@ -187,12 +187,16 @@ protected:
     Real * stageState;
     /// Candidate state for the step (used if the error is acceptable)
     Real * candidateState;
+    /// Stage evaluated at the end of the step with the propagated state, or -1
+    Integer fsalStage;
 
 
     bool SetupAccumulator();
     void ClearArrays();
     virtual Real EstimateError();
     virtual bool AdaptStep(Real maxerror);
+    void FindFsalStage();
+    void StoreDenseStep(Real startTime);
 
     //------------------------------------------------------------------------------
     // virtual void SetCoefficients(void)
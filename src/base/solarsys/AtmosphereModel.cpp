@@ -30,6 +30,7 @@
 //------------------------------------------------------------------------------
 
 #include "AtmosphereModel.hpp"
+#include "ParameterIndex.hpp"
 #include "MessageInterface.hpp"
 #include "CelestialBody.hpp"        // To retrieve radius, flattening factor
 #include "SolarSystemException.hpp"
@@ -118,6 +119,8 @@ AtmosphereModel::AtmosphereModel(const std::string &typeStr, const std::string &
    useGeodetic          (true),
    gha                  (0.0),
    ghaEpoch             (0.0),
+   fixedEpoch           (-1.0),
+   inputEpoch           (-1.0),
    historicStart        (-1.0),
    historicEnd          (-1.0),
    predictStart         (-1.0),
@@ -208,6 +211,8 @@ AtmosphereModel::AtmosphereModel(const AtmosphereModel& am) :
    useGeodetic          (am.useGeodetic),
    gha                  (0.0),
    ghaEpoch             (0.0),
+   fixedEpoch           (-1.0),
+   inputEpoch           (-1.0),
    historicStart        (am.historicStart),
    historicEnd          (am.historicEnd),
    predictStart         (am.predictStart),
@@ -273,6 +278,8 @@ AtmosphereModel& AtmosphereModel::operator=(const AtmosphereModel& am)
    useGeodetic          = am.useGeodetic;
    gha                  = 0.0;
    ghaEpoch             = 0.0;
+   fixedEpoch           = -1.0;
+   inputEpoch           = -1.0;
    historicStart        = am.historicStart;
    historicEnd          = am.historicEnd;
    predictStart         = am.predictStart;
@@ -310,6 +317,8 @@ bool AtmosphereModel::Initialize()
 {
    if (fluxReader == NULL)
       fluxReader = new SolarFluxReader();
+   fixedEpoch = -1.0;
+   inputEpoch = -1.0;
    return true;
 }
 
@@ -373,6 +382,7 @@ void AtmosphereModel::SetUpdateParameters(Real interval, GmatEpoch epoch)
 void AtmosphereModel::SetInternalCoordSystem(CoordinateSystem *cs)
 {
    mInternalCoordSystem = cs;
+   fixedEpoch = -1.0;
 }
 
 //------------------------------------------------------------------------------
@@ -388,6 +398,7 @@ void AtmosphereModel::SetInternalCoordSystem(CoordinateSystem *cs)
 void AtmosphereModel::SetCbJ2000CoordinateSystem(CoordinateSystem *cs)
 {
    cbJ2000 = cs;
+   fixedEpoch = -1.0;
 }
 
 
@@ -421,6 +432,7 @@ void AtmosphereModel::SetFixedCoordinateSystem(CoordinateSystem *cs)
       throw SolarSystemException(
             "AtmosphereModel: coordinate system is not of type BodyFixed.\n");
    cbFixed = cs;
+   fixedEpoch = -1.0;
 }
 
 //------------------------------------------------------------------------------
@@ -551,6 +563,7 @@ void AtmosphereModel::SetKpApConversionMethod(Integer method)
 {
    kpApConversion = method;
    nominalAp = ConvertKpToAp(nominalKp);
+   inputEpoch = -1.0;
 }
 
 
@@ -756,6 +769,8 @@ void AtmosphereModel::SetInputSource(const std::string &historical,
    else
       throw AtmosphereException("Invalid predicted data source " + predicted +
             " selected");
+
+   inputEpoch = -1.0;
 }
 
 //------------------------------------------------------------------------------
@@ -792,6 +807,7 @@ void AtmosphereModel::SetSchattenFlags(const std::string &timing,
 
    if (fluxReader != NULL)
       fluxReader->SetSchattenFlags(schattenTimingModel, schattenErrorModel);
+   inputEpoch = -1.0;
 }
 
 
@@ -809,6 +825,22 @@ bool AtmosphereModel::HasWindModel()
    return false;
 }
 
+//-----------------------------------------------------------------------------
+// bool AtmosphereModel::SupportsConcurrentCopies()
+//-----------------------------------------------------------------------------
+/**
+ * Checks whether separate copies of the model may compute densities on
+ * different threads at the same time.
+ *
+ * @return true if copies can run concurrently; this default returns false,
+ *         since several models call code with process-wide state
+ */
+//-----------------------------------------------------------------------------
+bool AtmosphereModel::SupportsConcurrentCopies()
+{
+   return false;
+}
+
 //-----------------------------------------------------------------------------
 // bool Wind(Real *position, Real* wind, Real ep, Integer count = 1)
 //-----------------------------------------------------------------------------
@@ -929,6 +961,7 @@ void AtmosphereModel::SetCentralBody(CelestialBody *cb)
       mCentralBody = cb;
       cbRadius     = mCentralBody->GetEquatorialRadius();
       cbFlattening = mCentralBody->GetFlattening();
+      fixedEpoch   = -1.0;
 
       #ifdef DEBUG_CB_PROPERTIES
          MessageInterface::ShowMessage("Body set to %s; radius = %.12lf, "
@@ -1004,9 +1037,11 @@ std::string AtmosphereModel::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer AtmosphereModel::GetParameterID(const std::string &str) const
 {
-   for (Integer i = GmatBaseParamCount; i < AtmosphereModelParamCount; ++i)
-      if (str == PARAMETER_TEXT[i - GmatBaseParamCount])
-         return i;
+   static const ParameterIndex parameterIndex("AtmosphereModel", PARAMETER_TEXT,
+         GmatBaseParamCount, AtmosphereModelParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
    return GmatBase::GetParameterID(str);
 }
 
@@ -1088,6 +1123,9 @@ Real AtmosphereModel::GetRealParameter(const Integer id) const
 //------------------------------------------------------------------------------
 Real AtmosphereModel::SetRealParameter(const Integer id, const Real value)
 {
+   // Nominal values feed the flux inputs
+   inputEpoch = -1.0;
+
    if (id == NOMINAL_FLUX)
    {
       if (value > 0.0)
@@ -1173,6 +1211,8 @@ Real AtmosphereModel::SetRealParameter(const Integer id,
 bool AtmosphereModel::SetStringParameter(const Integer id,
       const std::string &value)
 {
+   inputEpoch = -1.0;
+
    if (id == CSSI_WEATHER_FILE)
    {
       if (value != "")
@@ -1414,11 +1454,10 @@ SolarFluxReader::FluxData AtmosphereModel::GetFluxData(GmatEpoch epoch)
 Real AtmosphereModel::CalculateGeodetics(Real *position, GmatEpoch when,
                                          bool includeLatLong)
 {
-   Rvector6 instate(position), state;
-
-   CoordinateSystem *j2000ToUse = (cbJ2000 == NULL ? mInternalCoordSystem : cbJ2000);
+   Real state[3];
 
 #ifdef DEBUG_CALCULATE_GEODETICS
+   CoordinateSystem *j2000ToUse = (cbJ2000 == NULL ? mInternalCoordSystem : cbJ2000);
    MessageInterface::ShowMessage("AtmosphereModel::CalculateGeodetics():   cbJ2000 = <%p>    mInternalCoordSystem = <%p>\n", cbJ2000, mInternalCoordSystem);
    if (cbJ2000 == NULL)
 	   MessageInterface::ShowMessage("cbJ2000 == NULL, mInternalCoordSystem <%p,%s>\n", mInternalCoordSystem, mInternalCoordSystem->GetName().c_str());
@@ -1444,9 +1483,7 @@ Real AtmosphereModel::CalculateGeodetics(Real *position, GmatEpoch when,
       MessageInterface::ShowMessage("Position: %lf, %lf, %lf\n", position[0], position[1], position[2]);
    #endif
 
-   CoordinateConverter mCoordConverter;
-   mCoordConverter.Convert(A1Mjd(when), instate, j2000ToUse,
-                           state, cbFixed);
+   ToBodyFixed(position, when, state);
 
    // Build angular momentum
    if (wUpdateEpoch != when)
@@ -1516,11 +1553,10 @@ Real AtmosphereModel::CalculateGeodetics(Real *position, GmatEpoch when,
 Real AtmosphereModel::CalculateGeocentrics(Real *position, GmatEpoch when,
                                            bool includeLatLong)
 {
-   Rvector6 instate(position), state;
-
-   CoordinateSystem *j2000ToUse = (cbJ2000 == NULL ? mInternalCoordSystem : cbJ2000);
+   Real state[3];
 
 #ifdef DEBUG_CALCULATE_GEOCENTRICS
+   CoordinateSystem *j2000ToUse = (cbJ2000 == NULL ? mInternalCoordSystem : cbJ2000);
    if (cbJ2000 == NULL)
 	   MessageInterface::ShowMessage("cbJ2000 == NULL, mInternalCoordSystem <%p,%s>\n", mInternalCoordSystem, mInternalCoordSystem->GetName().c_str());
    else
@@ -1544,9 +1580,7 @@ Real AtmosphereModel::CalculateGeocentrics(Real *position, GmatEpoch when,
       MessageInterface::ShowMessage("Position: %lf, %lf, %lf\n", position[0], position[1], position[2]);
    #endif
 
-   CoordinateConverter mCoordConverter;
-   mCoordConverter.Convert(A1Mjd(when), instate, j2000ToUse,
-                           state, cbFixed);
+   ToBodyFixed(position, when, state);
 
    // Build angular momentum
    if (wUpdateEpoch != when)
@@ -1602,6 +1636,61 @@ Real AtmosphereModel::CalculateGeocentrics(Real *position, GmatEpoch when,
 }
 
 
+//------------------------------------------------------------------------------
+// void ToBodyFixed(Real *position, GmatEpoch when, Real *fixed)
+//------------------------------------------------------------------------------
+/**
+ * Transforms a cb-centered MJ2000 position into the body fixed system.
+ *
+ * The first position at a new epoch goes through the coordinate converter,
+ * and the resulting rotation is kept.  The other positions at that epoch,
+ * such as the rest of the spacecraft in a Density() call, are rotated
+ * directly.
+ *
+ * @param position The cb-centered MJ2000 position
+ * @param when     Epoch of the transformation
+ * @param fixed    The body fixed position (output, 3 elements)
+ */
+//------------------------------------------------------------------------------
+void AtmosphereModel::ToBodyFixed(Real *position, GmatEpoch when, Real *fixed)
+{
+   // The angular velocity uses the fixed system's last rotation, so convert
+   // again if it was rebuilt for another epoch
+   if ((when != fixedEpoch) || (when != wUpdateEpoch))
+   {
+      CoordinateSystem *j2000ToUse =
+            (cbJ2000 == NULL ? mInternalCoordSystem : cbJ2000);
+
+      Rvector6 instate(position), state;
+      CoordinateConverter mCoordConverter;
+      mCoordConverter.Convert(A1Mjd(when), instate, j2000ToUse,
+                              state, cbFixed);
+
+      Rmatrix33 rotation = mCoordConverter.GetLastRotationMatrix();
+      for (Integer i = 0; i < 3; ++i)
+      {
+         for (Integer j = 0; j < 3; ++j)
+            toFixed[i*3+j] = rotation(i,j);
+         fixed[i] = state[i];
+
+         // Systems that do not share an origin also shift the position
+         if (j2000ToUse->GetOrigin() == cbFixed->GetOrigin())
+            toFixedOffset[i] = 0.0;
+         else
+            toFixedOffset[i] = state[i] - (toFixed[i*3]   * position[0] +
+                                           toFixed[i*3+1] * position[1] +
+                                           toFixed[i*3+2] * position[2]);
+      }
+      fixedEpoch = when;
+      return;
+   }
+
+   for (Integer i = 0; i < 3; ++i)
+      fixed[i] = toFixed[i*3]   * position[0] + toFixed[i*3+1] * position[1] +
+                 toFixed[i*3+2] * position[2] + toFixedOffset[i];
+}
+
+
 //------------------------------------------------------------------------------
 //  void GetInputs(Real epoch)
 //------------------------------------------------------------------------------
@@ -1619,6 +1708,10 @@ void AtmosphereModel::GetInputs(GmatEpoch epoch)
             (fluxReaderLoaded ? "true" : "false"));
    #endif
 
+   // The flux values are already set for this epoch
+   if (fluxReaderLoaded && (epoch == inputEpoch))
+      return;
+
    // Process the epoch information
    Integer iEpoch = (Integer)(epoch);  // Truncate the epoch
    Integer yearOffset = (Integer)((epoch + 5.5) / GmatTimeConstants::DAYS_PER_YEAR);
@@ -1762,6 +1855,8 @@ void AtmosphereModel::GetInputs(GmatEpoch epoch)
          ap[i] = nominalAp;
    }
 
+   inputEpoch = epoch;
+
    #ifdef DUMP_FLUX_DATA
       MessageInterface::ShowMessage("%.12lf   %lf  %lf    [%lf %lf %lf %lf %lf "
             "%lf %lf]\n", epoch, f107, f107a, ap[0], ap[1], ap[2], ap[3], ap[4],
@@ -104,6 +104,7 @@ public:
                                const std::string &magnitude);
 
    // Extra methods some models may support
+   virtual bool SupportsConcurrentCopies();
    virtual bool HasWindModel();
    virtual bool Wind(Real *position, Real* wind, Real ep,
 						   Integer count = 1);
@@ -216,6 +217,14 @@ protected:
    Real                    gha;
    /// GHA epoch
    Real                    ghaEpoch;
+   /// Epoch of the J2000 to body fixed mapping used for geodetics
+   GmatEpoch               fixedEpoch;
+   /// Rotation from the J2000 system to the body fixed system at fixedEpoch
+   Real                    toFixed[9];
+   /// Body fixed position of the J2000 origin at fixedEpoch
+   Real                    toFixedOffset[3];
+   /// Epoch of the flux and geomagnetic values last set in GetInputs
+   GmatEpoch               inputEpoch;
 
    /// Start of the historic data when using file based history data
    GmatEpoch historicStart;
@@ -248,6 +257,8 @@ protected:
 
    // Input method shared by all MSISE models
    void                    GetInputs(GmatEpoch epoch);
+   void                    ToBodyFixed(Real *position, GmatEpoch when,
+                                 Real *fixed);
    
    Real                    CalculateGeodetics(Real *position,
                                  GmatEpoch when = -1.0,
@@ -33,6 +33,7 @@
 #include "gmatdefs.hpp"
 #include "SpacePoint.hpp"
 #include "CalculatedPoint.hpp"
+#include "ParameterIndex.hpp"
 #include "SolarSystem.hpp"
 #include "SolarSystemException.hpp"
 #include "MessageInterface.hpp"
@@ -320,11 +321,11 @@ std::string CalculatedPoint::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer CalculatedPoint::GetParameterID(const std::string &str) const
 {
-   for (Integer i = SpacePointParamCount; i < CalculatedPointParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - SpacePointParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("CalculatedPoint", PARAMETER_TEXT,
+         SpacePointParamCount, CalculatedPointParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
    
    // Special handler for "Add" - per Steve 2005.05.18
    if (str == "Add") return BODY_NAMES;
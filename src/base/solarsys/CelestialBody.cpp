@@ -39,6 +39,7 @@
 #include "gmatdefs.hpp"
 #include "SpacePoint.hpp"
 #include "CelestialBody.hpp"
+#include "ParameterIndex.hpp"
 #include "GravityField.hpp"
 #include "PlanetaryEphem.hpp"
 #include "SolarSystem.hpp"
@@ -51,6 +52,7 @@
 #include "Rmatrix.hpp"
 #include "RealUtilities.hpp"
 #include "AtmosphereModel.hpp"
+#include "EnvironmentContext.hpp"
 #include "MessageInterface.hpp"
 #include "GmatConstants.hpp"
 #include "GmatDefaults.hpp"
@@ -723,6 +725,7 @@ CelestialBody::~CelestialBody()
    #ifdef DEBUG_CB_DESTRUCT
       MessageInterface::ShowMessage(" Entering CelestialBody destructor for body %s .........\n", instanceName.c_str());
    #endif
+   EnvironmentContext::ReleaseBody(this);
    if (atmModel)
    {
       #ifdef DEBUG_MEMORY
@@ -2491,6 +2494,7 @@ bool CelestialBody::SetSource(Gmat::PosVelSource pvSrc)
    #endif
    
    if (pvSrc == posVelSrc) return true;
+   EnvironmentContext::ReleaseBody(this);
 
    if (pvSrc == Gmat::DE405)
    {
@@ -2557,6 +2561,7 @@ bool CelestialBody::SetSource(Gmat::PosVelSource pvSrc)
 bool CelestialBody::SetSourceFile(PlanetaryEphem *src)
 {
    // should I delete the old one here???
+   EnvironmentContext::ReleaseBody(this);
    theSourceFile  = src;
    sourceFilename = theSourceFile->GetName();
    bodyNumber     = theSourceFile->GetBodyID(instanceName);
@@ -3499,11 +3504,11 @@ Integer CelestialBody::GetParameterID(const std::string &str) const
       MessageInterface::ShowMessage("In CB::GetParameterID, str = %s\n",
             str.c_str());
    #endif
-   for (Integer i = SpacePointParamCount; i < CelestialBodyParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - SpacePointParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("CelestialBody", PARAMETER_TEXT,
+         SpacePointParamCount, CelestialBodyParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
    if (str == "PlanetarySpiceKernelName")
       return ATTITUDE_SPICE_KERNEL_NAME;
    else if (str == "AttitudeSpiceKernelName")
@@ -119,7 +119,12 @@ const Real DeFile::TT_OFFSET      = GmatTimeConstants::TT_TAI_OFFSET;
 //------------------------------------------------------------------------------
 DeFile::DeFile(Gmat::DeFileType ofType, std::string fileName,
                Gmat::DeFileFormat fmt) :
-   PlanetaryEphem(fileName)
+   PlanetaryEphem(fileName),
+   mappedFile     (NULL),
+   mappedRecords  (NULL),
+   numRecords     (0),
+   firstRecordBeg (0.0),
+   recordSpan     (0.0)
 {
    defType       = ofType;
    theFileFormat = fmt;
@@ -155,6 +160,11 @@ DeFile::DeFile(const DeFile& def) :
    baseEpoch      (def.baseEpoch),
    mFileBeg       (def.mFileBeg),
    mA1FileBeg     (def.mA1FileBeg),
+   mappedFile     (NULL),
+   mappedRecords  (NULL),
+   numRecords     (0),
+   firstRecordBeg (0.0),
+   recordSpan     (0.0),
    EPHEMERIS      (def.EPHEMERIS)
 {
    /// data from JPL/JSC code (Hoffman) ephem_read.c
@@ -166,6 +176,10 @@ DeFile::DeFile(const DeFile& def) :
 
    int i;
    for (i=0;i<MAX_ARRAY_SIZE;i++)  Coeff_Array[i] = def.Coeff_Array[i];
+
+   // Each copy owns its own view; the OS shares the underlying pages
+   if (def.mappedRecords != NULL)
+      MapEphemerisFile(binaryFileName);
 }
 
 //------------------------------------------------------------------------------
@@ -210,6 +224,17 @@ DeFile& DeFile::operator=(const DeFile& def)
    mA1FileBeg     = def.mA1FileBeg;
 
    EPHEMERIS      = def.EPHEMERIS;
+
+   if (def.mappedRecords != NULL)
+      MapEphemerisFile(binaryFileName);
+   else
+   {
+      if (mappedFile != NULL)
+         mappedFile->Close();
+      mappedRecords = NULL;
+      numRecords    = 0;
+   }
+
    return *this;
 }
 
@@ -231,6 +256,9 @@ DeFile::~DeFile()
       if (Ephemeris_File == g_pef_dcb.fptr)
          g_pef_dcb.fptr = NULL;
    }
+
+   if (mappedFile != NULL)
+      delete mappedFile;
 }
 
 
@@ -330,7 +358,7 @@ Real* DeFile::GetPosVel(Integer forBody, A1Mjd atTime, bool overrideTimeSystem)
 //      throw PlanetaryEphemException("Attempting to read data for an epoch "
 //            "earlier than the beginning of the current DE File; exiting.\n");
    }
-   static Real      result[6];
+   static thread_local Real result[6];
    // if we're asking for the Earth state, return 0.0 (since we're
    // currently assuming Earth-Centered Equatorial
    if (forBody == DeFile::EARTH_ID) // this should check for the J2000Body <<<<
@@ -462,7 +490,7 @@ Real* DeFile::GetPosVel(Integer forBody, GmatTime atTime, bool overrideTimeSyste
       //      throw PlanetaryEphemException("Attempting to read data for an epoch "
       //            "earlier than the beginning of the current DE File; exiting.\n");
    }
-   static Real      result[6];
+   static thread_local Real result[6];
    // if we're asking for the Earth state, return 0.0 (since we're
    // currently assuming Earth-Centered Equatorial
    if (forBody == DeFile::EARTH_ID) // this should check for the J2000Body <<<<
@@ -615,7 +643,7 @@ Real* DeFile::GetPosDelta(Integer forBody,
       //      throw PlanetaryEphemException("Attempting to read data for an epoch "
       //            "earlier than the beginning of the current DE File; exiting.\n");
    }
-   static Real      result[3];
+   static thread_local Real result[3];
    // if we're asking for the Earth state, return 0.0 (since we're
    // currently assuming Earth-Centered Equatorial
    if (forBody == DeFile::EARTH_ID) // this should check for the J2000Body <<<<
@@ -1114,6 +1142,162 @@ void DeFile::Read_Coefficients(GmatTime Time)
 }
 
 
+//------------------------------------------------------------------------------
+// const double* GetRecord(double Time, double &recBeg, double &recSpan)
+//------------------------------------------------------------------------------
+/**
+ * Locates the Chebyshev record that contains the input time.
+ *
+ * When the binary file is memory mapped, the record is indexed directly from
+ * the epoch and returned in place, so no member data is modified and lookups
+ * that jump between epochs do not touch the disk.  Otherwise the single
+ * record buffer is refreshed through Read_Coefficients.
+ *
+ * @param Time    The requested time, relative to baseEpoch
+ * @param recBeg  The start time of the record, relative to baseEpoch
+ * @param recSpan The time span of the record, in days
+ *
+ * @return A pointer to the record's coefficients
+ */
+//------------------------------------------------------------------------------
+const double* DeFile::GetRecord(double Time, double &recBeg, double &recSpan)
+{
+   if (mappedRecords != NULL)
+   {
+      Integer index = (Integer) floor((Time - firstRecordBeg) / recordSpan);
+
+      // The final record also covers its own end time
+      if ((index == numRecords) &&
+          (Time <= firstRecordBeg + numRecords * recordSpan))
+         --index;
+
+      if ((index < 0) || (index >= numRecords))
+      {
+         PlanetaryEphemException ex;
+         ex.SetDetails("Requested epoch %.9f is not on the DE file '%s'.\n",
+                       Time, theFileName.c_str());
+         throw ex;
+      }
+
+      const double *record = mappedRecords + index * arraySize;
+      recBeg  = record[0] - baseEpoch;
+      recSpan = record[1] - record[0];
+      return record;
+   }
+
+   if (Time < T_beg || Time > T_end)  Read_Coefficients(Time);
+   recBeg  = T_beg;
+   recSpan = T_span;
+   return Coeff_Array;
+}
+
+
+//------------------------------------------------------------------------------
+// const double* GetRecord(const GmatTime &Time, double &recBeg,
+//                         double &recSpan)
+//------------------------------------------------------------------------------
+/**
+ * GmatTime version of the record lookup.
+ *
+ * @param Time    The requested time, relative to baseEpoch
+ * @param recBeg  The start time of the record, relative to baseEpoch
+ * @param recSpan The time span of the record, in days
+ *
+ * @return A pointer to the record's coefficients
+ */
+//------------------------------------------------------------------------------
+const double* DeFile::GetRecord(const GmatTime &Time, double &recBeg,
+                                double &recSpan)
+{
+   if (mappedRecords != NULL)
+   {
+      Real elapsed  = (Time - firstRecordBeg).GetMjd();
+      Integer index = (Integer) floor(elapsed / recordSpan);
+
+      // The final record also covers its own end time
+      if ((index == numRecords) && (elapsed <= numRecords * recordSpan))
+         --index;
+
+      if ((index < 0) || (index >= numRecords))
+      {
+         PlanetaryEphemException ex;
+         ex.SetDetails("Requested epoch %.9f is not on the DE file '%s'.\n",
+                       Time.GetMjd(), theFileName.c_str());
+         throw ex;
+      }
+
+      const double *record = mappedRecords + index * arraySize;
+      recBeg  = record[0] - baseEpoch;
+      recSpan = record[1] - record[0];
+      return record;
+   }
+
+   if (Time < T_beg || Time > T_end)  Read_Coefficients(Time);
+   recBeg  = T_beg;
+   recSpan = T_span;
+   return Coeff_Array;
+}
+
+
+//------------------------------------------------------------------------------
+// bool MapEphemerisFile(const std::string &fileName)
+//------------------------------------------------------------------------------
+/**
+ * Maps the binary DE file into memory so records can be indexed by epoch.
+ *
+ * Mapping is an optimization only: if it fails, or the file layout does not
+ * match the header, the FILE-based reader is used unchanged.
+ *
+ * @param fileName The binary DE file
+ *
+ * @return true if the file is mapped and will be used for record lookup
+ */
+//------------------------------------------------------------------------------
+bool DeFile::MapEphemerisFile(const std::string &fileName)
+{
+   mappedRecords = NULL;
+   numRecords    = 0;
+
+   if (mappedFile == NULL)
+      mappedFile = new MemoryMappedFile();
+
+   if (!mappedFile->Open(fileName))
+      return false;
+
+   std::size_t recordBytes = arraySize * sizeof(double);
+   std::size_t fileRecords = mappedFile->GetSize() / recordBytes;
+
+   // Two header records precede the data
+   if (fileRecords < 3)
+   {
+      mappedFile->Close();
+      return false;
+   }
+
+   const double *records = (const double*)mappedFile->GetData() + 2*arraySize;
+   double span = records[1] - records[0];
+
+   if (span <= 0.0)
+   {
+      mappedFile->Close();
+      return false;
+   }
+
+   mappedRecords  = records;
+   numRecords     = (Integer)(fileRecords - 2);
+   firstRecordBeg = records[0] - baseEpoch;
+   recordSpan     = span;
+
+   #ifdef DEBUG_DEFILE_INIT
+   MessageInterface::ShowMessage
+      ("DeFile::MapEphemerisFile() mapped %d records of %.1f days from %s\n",
+       numRecords, recordSpan, fileName.c_str());
+   #endif
+
+   return true;
+}
+
+
 /**==========================================================================**/
 /**  Initialize_Ephemeris                                                    **/
 /**                                                                          **/
@@ -1168,6 +1352,9 @@ int DeFile::Initialize_Ephemeris( char *fileName )
       /*..............................Convert header ephemeris ID to integer */
       headerID = (int) R1.DENUM;
 
+      /*.......................Map the data records for direct, random access */
+      MapEphemerisFile(fileName);
+
       #if defined (__UNIT_TEST__)
          std::ofstream fout;
          fout.open("TestDeFile.txt");
@@ -1234,8 +1421,6 @@ void DeFile::Interpolate_Libration( double Time , int Target ,
    #ifdef DEBUG_DEFILE_LIB
       MessageInterface::ShowMessage
          ("DeFile::Interpolate_Libration(%.9f, %d)\n", Time, Target);
-      MessageInterface::ShowMessage("   addr T_beg=%p\n", &T_beg);
-      MessageInterface::ShowMessage("   addr T_end=%p\n", &T_end);
    #endif
   
    /*--------------------------------------------------------------------------*/
@@ -1258,16 +1443,13 @@ void DeFile::Interpolate_Libration( double Time , int Target ,
    /*--------------------------------------------------------------------------*/
    /* Determine if a new record needs to be input (if so, get it).             */
    /*--------------------------------------------------------------------------*/
-   if ( Time < T_beg || Time > T_end )
-   {
-      #ifdef DEBUG_DEFILE_LIB
-         MessageInterface::ShowMessage
-            ("DeFile::Interpolate_Libration() Calling Read_Coefficients(%.9f)\n",
-             Time);
-      #endif
-     
-      Read_Coefficients(Time);
-   }
+   #ifdef DEBUG_DEFILE_LIB
+   MessageInterface::ShowMessage
+      ("DeFile::Interpolate_Libration() Calling GetRecord(%.9f)\n", Time);
+   #endif
+   
+   double recBeg, recSpan;
+   const double *coeffs = GetRecord(Time, recBeg, recSpan);
   
    /*--------------------------------------------------------------------------*/
    /* Read the coefficients from the binary record.                            */
@@ -1285,16 +1467,16 @@ void DeFile::Interpolate_Libration( double Time , int Target ,
    /*--------------------------------------------------------------------------*/
    if ( G == 1 )
    {
-      Tc = 2.0*(Time - T_beg) / T_span - 1.0;
-      for (i=C ; i<(C+3*N) ; i++)  A[i-C] = Coeff_Array[i];
+      Tc = 2.0*(Time - recBeg) / recSpan - 1.0;
+      for (i=C ; i<(C+3*N) ; i++)  A[i-C] = coeffs[i];
    }
    else if ( G > 1 )
    {
-      T_sub = T_span / ((double) G);          /* Compute subgranule interval */
+      T_sub = recSpan / ((double) G);          /* Compute subgranule interval */
        
       for ( j=G ; j>0 ; j-- )
       {
-         T_break = T_beg + ((double) j-1) * T_sub;
+         T_break = recBeg + ((double) j-1) * T_sub;
          if ( Time > T_break )
          {
             T_seg  = T_break;
@@ -1306,7 +1488,7 @@ void DeFile::Interpolate_Libration( double Time , int Target ,
       Tc = 2.0*(Time - T_seg) / T_sub - 1.0;
       C  = C + 3 * offset * N;
        
-      for (i=C ; i<(C+3*N) ; i++) A[i-C] = Coeff_Array[i];
+      for (i=C ; i<(C+3*N) ; i++) A[i-C] = coeffs[i];
    }
    else                                   /* Something has gone terribly wrong */
    {
@@ -1338,7 +1520,7 @@ void DeFile::Interpolate_Libration( double Time , int Target ,
       for ( j=N-1 ; j>-1 ; j-- )  sum[i]     = sum[i] + A[j+i*N] * Cp[j];
       for ( j=N-1 ; j>0  ; j-- )  rateSum[i] = rateSum[i] + A[j+i*N] * Up[j];
       Libration[i] = sum[i];
-      rates[i]     = rateSum[i] * 2.0 * ((double) G) / (T_span * GmatTimeConstants::SECS_PER_DAY);
+      rates[i]     = rateSum[i] * 2.0 * ((double) G) / (recSpan * GmatTimeConstants::SECS_PER_DAY);
    }
    /*--------------------------------------------------------------------------*/
    /* Compute interpolated the rates.                                          */
@@ -1359,8 +1541,6 @@ void DeFile::Interpolate_Libration( const GmatTime &Time , int Target ,
    #ifdef DEBUG_DEFILE_LIB
       MessageInterface::ShowMessage
          ("DeFile::Interpolate_Libration(%.9f, %d)\n", Time, Target);
-      MessageInterface::ShowMessage("   addr T_beg=%p\n", &T_beg);
-      MessageInterface::ShowMessage("   addr T_end=%p\n", &T_end);
    #endif
   
    /*--------------------------------------------------------------------------*/
@@ -1383,16 +1563,13 @@ void DeFile::Interpolate_Libration( const GmatTime &Time , int Target ,
    /*--------------------------------------------------------------------------*/
    /* Determine if a new record needs to be input (if so, get it).             */
    /*--------------------------------------------------------------------------*/
-   if ( Time < T_beg || Time > T_end )
-   {
-      #ifdef DEBUG_DEFILE_LIB
-         MessageInterface::ShowMessage
-            ("DeFile::Interpolate_Libration() Calling Read_Coefficients(%.9f)\n",
-             Time);
-      #endif
-     
-      Read_Coefficients(Time);
-   }
+   #ifdef DEBUG_DEFILE_LIB
+   MessageInterface::ShowMessage
+      ("DeFile::Interpolate_Libration() Calling GetRecord(%.9f)\n", Time);
+   #endif
+   
+   double recBeg, recSpan;
+   const double *coeffs = GetRecord(Time, recBeg, recSpan);
   
    /*--------------------------------------------------------------------------*/
    /* Read the coefficients from the binary record.                            */
@@ -1410,16 +1587,16 @@ void DeFile::Interpolate_Libration( const GmatTime &Time , int Target ,
    /*--------------------------------------------------------------------------*/
    if ( G == 1 )
    {
-      Tc = 2.0*(Time - T_beg).GetMjd() / T_span - 1.0;
-      for (i=C ; i<(C+3*N) ; i++)  A[i-C] = Coeff_Array[i];
+      Tc = 2.0*(Time - recBeg).GetMjd() / recSpan - 1.0;
+      for (i=C ; i<(C+3*N) ; i++)  A[i-C] = coeffs[i];
    }
    else if ( G > 1 )
    {
-      T_sub = T_span / ((double) G);          /* Compute subgranule interval */
+      T_sub = recSpan / ((double) G);          /* Compute subgranule interval */
        
       for ( j=G ; j>0 ; j-- )
       {
-         T_break = T_beg + ((double) j-1) * T_sub;
+         T_break = recBeg + ((double) j-1) * T_sub;
          if ( Time > T_break )
          {
             T_seg  = T_break;
@@ -1431,7 +1608,7 @@ void DeFile::Interpolate_Libration( const GmatTime &Time , int Target ,
       Tc = 2.0*(Time - T_seg).GetMjd() / T_sub - 1.0;
       C  = C + 3 * offset * N;
        
-      for (i=C ; i<(C+3*N) ; i++) A[i-C] = Coeff_Array[i];
+      for (i=C ; i<(C+3*N) ; i++) A[i-C] = coeffs[i];
    }
    else                                   /* Something has gone terribly wrong */
    {
@@ -1463,7 +1640,7 @@ void DeFile::Interpolate_Libration( const GmatTime &Time , int Target ,
       for ( j=N-1 ; j>-1 ; j-- )  sum[i]     = sum[i] + A[j+i*N] * Cp[j];
       for ( j=N-1 ; j>0  ; j-- )  rateSum[i] = rateSum[i] + A[j+i*N] * Up[j];
       Libration[i] = sum[i];
-      rates[i]     = rateSum[i] * 2.0 * ((double) G) / (T_span * GmatTimeConstants::SECS_PER_DAY);
+      rates[i]     = rateSum[i] * 2.0 * ((double) G) / (recSpan * GmatTimeConstants::SECS_PER_DAY);
    }
    /*--------------------------------------------------------------------------*/
    /* Compute interpolated the rates.                                          */
@@ -1515,7 +1692,8 @@ void DeFile::Interpolate_Nutation( double Time , int Target , double Nutation[2]
    /*--------------------------------------------------------------------------*/
    /* Determine if a new record needs to be input (if so, get it).             */
    /*--------------------------------------------------------------------------*/
-   if (Time < T_beg || Time > T_end)  Read_Coefficients(Time);
+   double recBeg, recSpan;
+   const double *coeffs = GetRecord(Time, recBeg, recSpan);
 
    /*--------------------------------------------------------------------------*/
    /* Read the coefficients from the binary record.                            */
@@ -1533,16 +1711,16 @@ void DeFile::Interpolate_Nutation( double Time , int Target , double Nutation[2]
    /*--------------------------------------------------------------------------*/
    if ( G == 1 )
    {
-      Tc = 2.0*(Time - T_beg) / T_span - 1.0;
-      for (i=C ; i<(C+3*N) ; i++)  A[i-C] = Coeff_Array[i];
+      Tc = 2.0*(Time - recBeg) / recSpan - 1.0;
+      for (i=C ; i<(C+3*N) ; i++)  A[i-C] = coeffs[i];
    }
    else if ( G > 1 )
    {
-      T_sub = T_span / ((double) G);          /* Compute subgranule interval */
+      T_sub = recSpan / ((double) G);          /* Compute subgranule interval */
        
       for ( j=G ; j>0 ; j-- )
       {
-         T_break = T_beg + ((double) j-1) * T_sub;
+         T_break = recBeg + ((double) j-1) * T_sub;
          if ( Time > T_break )
          {
             T_seg  = T_break;
@@ -1554,7 +1732,7 @@ void DeFile::Interpolate_Nutation( double Time , int Target , double Nutation[2]
       Tc = 2.0*(Time - T_seg) / T_sub - 1.0;
       C  = C + 3 * offset * N;
        
-      for (i=C ; i<(C+3*N) ; i++) A[i-C] = Coeff_Array[i];
+      for (i=C ; i<(C+3*N) ; i++) A[i-C] = coeffs[i];
    }
    else                                   /* Something has gone terribly wrong */
    {
@@ -1623,7 +1801,8 @@ void DeFile::Interpolate_Position( double Time , int Target , double Position[3]
    /*--------------------------------------------------------------------------*/
    /* Determine if a new record needs to be input (if so, get it).             */
    /*--------------------------------------------------------------------------*/
-   if (Time < T_beg || Time > T_end)  Read_Coefficients(Time);
+   double recBeg, recSpan;
+   const double *coeffs = GetRecord(Time, recBeg, recSpan);
 
    /*--------------------------------------------------------------------------*/
    /* Read the coefficients from the binary record.                            */
@@ -1641,16 +1820,16 @@ void DeFile::Interpolate_Position( double Time , int Target , double Position[3]
    /*--------------------------------------------------------------------------*/
    if ( G == 1 )
    {
-      Tc = 2.0*(Time - T_beg) / T_span - 1.0;
-      for (i=C ; i<(C+3*N) ; i++)  A[i-C] = Coeff_Array[i];
+      Tc = 2.0*(Time - recBeg) / recSpan - 1.0;
+      for (i=C ; i<(C+3*N) ; i++)  A[i-C] = coeffs[i];
    }
    else if ( G > 1 )
    {
-      T_sub = T_span / ((double) G);          /* Compute subgranule interval */
+      T_sub = recSpan / ((double) G);          /* Compute subgranule interval */
        
       for ( j=G ; j>0 ; j-- )
       {
-         T_break = T_beg + ((double) j-1) * T_sub;
+         T_break = recBeg + ((double) j-1) * T_sub;
          if ( Time > T_break )
          {
             T_seg  = T_break;
@@ -1662,7 +1841,7 @@ void DeFile::Interpolate_Position( double Time , int Target , double Position[3]
       Tc = 2.0*(Time - T_seg) / T_sub - 1.0;
       C  = C + 3 * offset * N;
        
-      for (i=C ; i<(C+3*N) ; i++) A[i-C] = Coeff_Array[i];
+      for (i=C ; i<(C+3*N) ; i++) A[i-C] = coeffs[i];
    }
    else                                   /* Something has gone terribly wrong */
    {
@@ -1734,18 +1913,14 @@ void DeFile::Interpolate_State(double Time , int Target, stateType *p)
    /*--------------------------------------------------------------------------*/
    /* Determine if a new record needs to be input.                             */
    /*--------------------------------------------------------------------------*/
-   #ifdef DEBUG_DEFILE_INTERPOLATE
-   MessageInterface::ShowMessage
-      ("DeFile::Interpolate_State() before Read_Coefficients()\nTime=%f, T_beg=%f, "
-       "T_end=%f T_span=%f\n", Time, T_beg, T_end, T_span);
-   #endif
   
-   if (Time < T_beg || Time > T_end)  Read_Coefficients(Time);
+   double recBeg, recSpan;
+   const double *coeffs = GetRecord(Time, recBeg, recSpan);
   
    #ifdef DEBUG_DEFILE_INTERPOLATE
    MessageInterface::ShowMessage
-      ("DeFile::Interpolate_State() after  Read_Coefficients()\nTime=%f, T_beg=%f, "
-       "T_end=%f T_span=%f\n", Time, T_beg, T_end, T_span);
+      ("DeFile::Interpolate_State() after GetRecord()\nTime=%f, recBeg=%f, "
+       "recSpan=%f\n", Time, recBeg, recSpan);
    #endif
   
    /*--------------------------------------------------------------------------*/
@@ -1765,15 +1940,15 @@ void DeFile::Interpolate_State(double Time , int Target, stateType *p)
    /*--------------------------------------------------------------------------*/
    if ( G == 1 )
    {
-      Tc = 2.0*(Time - T_beg) / T_span - 1.0;
-      for (i=C ; i<(C+3*N) ; i++)  A[i-C] = Coeff_Array[i];
+      Tc = 2.0*(Time - recBeg) / recSpan - 1.0;
+      for (i=C ; i<(C+3*N) ; i++)  A[i-C] = coeffs[i];
    }
    else if ( G > 1 )
    {
-      T_sub = T_span / ((double) G);          /* Compute subgranule interval */
+      T_sub = recSpan / ((double) G);          /* Compute subgranule interval */
       for ( j=G ; j>0 ; j-- )
       {
-         T_break = T_beg + ((double) j-1) * T_sub;
+         T_break = recBeg + ((double) j-1) * T_sub;
          if ( Time > T_break )
          {
             T_seg  = T_break;
@@ -1785,7 +1960,7 @@ void DeFile::Interpolate_State(double Time , int Target, stateType *p)
       Tc = 2.0*(Time - T_seg) / T_sub - 1.0;
       C  = C + 3 * offset * N;
        
-      for (i=C ; i<(C+3*N) ; i++) A[i-C] = Coeff_Array[i];
+      for (i=C ; i<(C+3*N) ; i++) A[i-C] = coeffs[i];
    }
    else                                   /* Something has gone terribly wrong */
    {
@@ -1818,7 +1993,7 @@ void DeFile::Interpolate_State(double Time , int Target, stateType *p)
       for ( j=N-1 ; j>0  ; j-- )  V_Sum[i] = V_Sum[i] + A[j+i*N] * Up[j];
 
       X.Position[i] = P_Sum[i];
-      X.Velocity[i] = V_Sum[i] * 2.0 * ((double) G) / (T_span * GmatTimeConstants::SECS_PER_DAY);
+      X.Velocity[i] = V_Sum[i] * 2.0 * ((double) G) / (recSpan * GmatTimeConstants::SECS_PER_DAY);
    }
 
    /*--------------------------------------------------------------------------*/
@@ -1860,18 +2035,14 @@ void DeFile::Interpolate_State(GmatTime Time, int Target, stateType *p)
    /*--------------------------------------------------------------------------*/
    /* Determine if a new record needs to be input.                             */
    /*--------------------------------------------------------------------------*/
-#ifdef DEBUG_DEFILE_INTERPOLATE
-   MessageInterface::ShowMessage
-      ("DeFile::Interpolate_State() before Read_Coefficients()\nTime=%f, T_beg=%f, "
-      "T_end=%f T_span=%f\n", Time, T_beg, T_end, T_span);
-#endif
 
-   if (Time < T_beg || Time > T_end)  Read_Coefficients(Time);
+   double recBeg, recSpan;
+   const double *coeffs = GetRecord(Time, recBeg, recSpan);
 
 #ifdef DEBUG_DEFILE_INTERPOLATE
    MessageInterface::ShowMessage
-      ("DeFile::Interpolate_State() after  Read_Coefficients()\nTime=%f, T_beg=%f, "
-      "T_end=%f T_span=%f\n", Time, T_beg, T_end, T_span);
+      ("DeFile::Interpolate_State() after GetRecord()\nTime=%f, recBeg=%f, "
+      "recSpan=%f\n", Time, recBeg, recSpan);
 #endif
 
    /*--------------------------------------------------------------------------*/
@@ -1892,20 +2063,20 @@ void DeFile::Interpolate_State(GmatTime Time, int Target, stateType *p)
    Real dTc;
    if (G == 1)
    {
-      //Tc = 2.0*(Time.GetMjd() - T_beg) / T_span - 1.0;
-      //dTc = 2.0*(Time - GmatTime(Time.GetMjd())).GetTimeInSec() / T_span / GmatTimeConstants::SECS_PER_DAY;
+      //Tc = 2.0*(Time.GetMjd() - recBeg) / recSpan - 1.0;
+      //dTc = 2.0*(Time - GmatTime(Time.GetMjd())).GetTimeInSec() / recSpan / GmatTimeConstants::SECS_PER_DAY;
       //Tc = Tc + dTc;
       
-      Tc = 2.0*(Time - T_beg).GetMjd() / T_span - 1.0;
+      Tc = 2.0*(Time - recBeg).GetMjd() / recSpan - 1.0;
 
-      for (i = C; i<(C + 3 * N); i++)  A[i - C] = Coeff_Array[i];
+      for (i = C; i<(C + 3 * N); i++)  A[i - C] = coeffs[i];
    }
    else if (G > 1)
    {
-      T_sub = T_span / ((double)G);          /* Compute subgranule interval */
+      T_sub = recSpan / ((double)G);          /* Compute subgranule interval */
       for (j = G; j>0; j--)
       {
-         T_break = T_beg + ((double)j - 1) * T_sub;
+         T_break = recBeg + ((double)j - 1) * T_sub;
          if (Time > T_break)
          {
             T_seg = T_break;
@@ -1915,13 +2086,13 @@ void DeFile::Interpolate_State(GmatTime Time, int Target, stateType *p)
       }
 
       //Tc = 2.0*(Time.GetMjd() - T_seg) / T_sub - 1.0;
-      //dTc = 2.0*(Time - GmatTime(Time.GetMjd())).GetTimeInSec() / T_span / GmatTimeConstants::SECS_PER_DAY;
+      //dTc = 2.0*(Time - GmatTime(Time.GetMjd())).GetTimeInSec() / recSpan / GmatTimeConstants::SECS_PER_DAY;
       //Tc = Tc + dTc;
 
       Tc = 2.0*(Time - T_seg).GetMjd() / T_sub - 1.0;
       C = C + 3 * offset * N;
 
-      for (i = C; i<(C + 3 * N); i++) A[i - C] = Coeff_Array[i];
+      for (i = C; i<(C + 3 * N); i++) A[i - C] = coeffs[i];
    }
    else                                   /* Something has gone terribly wrong */
    {
@@ -1954,8 +2125,8 @@ void DeFile::Interpolate_State(GmatTime Time, int Target, stateType *p)
       for (j = N - 1; j>0; j--)  V_Sum[i] = V_Sum[i] + A[j + i*N] * Up[j];
 
       X.Position[i] = P_Sum[i];
-      //X.Velocity[i] = V_Sum[i] * 2.0 * ((double)G) / (T_span * GmatTimeConstants::SECS_PER_DAY);
-      X.Velocity[i] = V_Sum[i] * 2.0 * ((double)G) / T_span / GmatTimeConstants::SECS_PER_DAY;
+      //X.Velocity[i] = V_Sum[i] * 2.0 * ((double)G) / (recSpan * GmatTimeConstants::SECS_PER_DAY);
+      X.Velocity[i] = V_Sum[i] * 2.0 * ((double)G) / recSpan / GmatTimeConstants::SECS_PER_DAY;
    }
 
    /*--------------------------------------------------------------------------*/
@@ -2014,18 +2185,14 @@ void DeFile::Interpolate_State_Delta(const GmatTime &Time, const GmatTime &Time2
    /*--------------------------------------------------------------------------*/
    /* Determine if a new record needs to be input.                             */
    /*--------------------------------------------------------------------------*/
-#ifdef DEBUG_DEFILE_INTERPOLATE
-   MessageInterface::ShowMessage
-      ("DeFile::Interpolate_State_Delta() before Read_Coefficients()\nTime=%f, Time2=%f, T_beg=%f, "
-      "T_end=%f T_span=%f\n", Time, Time2, T_beg, T_end, T_span);
-#endif
 
-   if (Time < T_beg || Time > T_end)  Read_Coefficients(Time);
+   double recBeg, recSpan;
+   const double *coeffs = GetRecord(Time, recBeg, recSpan);
 
 #ifdef DEBUG_DEFILE_INTERPOLATE
    MessageInterface::ShowMessage
-      ("DeFile::Interpolate_State_Delta() after  Read_Coefficients()\nTime=%f, Time2=%f, T_beg=%f, "
-      "T_end=%f T_span=%f\n", Time, Time2, T_beg, T_end, T_span);
+      ("DeFile::Interpolate_State_Delta() after GetRecord()\nTime=%f, Time2=%f, recBeg=%f, "
+      "recSpan=%f\n", Time, Time2, recBeg, recSpan);
 #endif
 
    /*--------------------------------------------------------------------------*/
@@ -2046,22 +2213,22 @@ void DeFile::Interpolate_State_Delta(const GmatTime &Time, const GmatTime &Time2
    Real dTc;
    if (G == 1)
    {
-      //Tc = 2.0*(Time.GetMjd() - T_beg) / T_span - 1.0;
-      //dTc = 2.0*(Time - GmatTime(Time.GetMjd())).GetTimeInSec() / T_span / GmatTimeConstants::SECS_PER_DAY;
+      //Tc = 2.0*(Time.GetMjd() - recBeg) / recSpan - 1.0;
+      //dTc = 2.0*(Time - GmatTime(Time.GetMjd())).GetTimeInSec() / recSpan / GmatTimeConstants::SECS_PER_DAY;
       //Tc = Tc + dTc;
       
-      Tc = 2.0*(Time - T_beg).GetMjd() / T_span - 1.0;
-      Tc2 = 2.0*(Time2 - T_beg).GetMjd() / T_span - 1.0;
-      dt = 2.0*(Time2 - Time).GetMjd() / T_span;
+      Tc = 2.0*(Time - recBeg).GetMjd() / recSpan - 1.0;
+      Tc2 = 2.0*(Time2 - recBeg).GetMjd() / recSpan - 1.0;
+      dt = 2.0*(Time2 - Time).GetMjd() / recSpan;
 
-      for (i = C; i<(C + 3 * N); i++)  A[i - C] = Coeff_Array[i];
+      for (i = C; i<(C + 3 * N); i++)  A[i - C] = coeffs[i];
    }
    else if (G > 1)
    {
-      T_sub = T_span / ((double)G);          /* Compute subgranule interval */
+      T_sub = recSpan / ((double)G);          /* Compute subgranule interval */
       for (j = G; j>0; j--)
       {
-         T_break = T_beg + ((double)j - 1) * T_sub;
+         T_break = recBeg + ((double)j - 1) * T_sub;
          if (Time > T_break)
          {
             T_seg = T_break;
@@ -2071,7 +2238,7 @@ void DeFile::Interpolate_State_Delta(const GmatTime &Time, const GmatTime &Time2
       }
 
       //Tc = 2.0*(Time.GetMjd() - T_seg) / T_sub - 1.0;
-      //dTc = 2.0*(Time - GmatTime(Time.GetMjd())).GetTimeInSec() / T_span / GmatTimeConstants::SECS_PER_DAY;
+      //dTc = 2.0*(Time - GmatTime(Time.GetMjd())).GetTimeInSec() / recSpan / GmatTimeConstants::SECS_PER_DAY;
       //Tc = Tc + dTc;
 
       Tc = 2.0*(Time - T_seg).GetMjd() / T_sub - 1.0;
@@ -2079,7 +2246,7 @@ void DeFile::Interpolate_State_Delta(const GmatTime &Time, const GmatTime &Time2
       dt = 2.0*(Time2 - Time).GetMjd() / T_sub;
       C = C + 3 * offset * N;
 
-      for (i = C; i<(C + 3 * N); i++) A[i - C] = Coeff_Array[i];
+      for (i = C; i<(C + 3 * N); i++) A[i - C] = coeffs[i];
    }
    else                                   /* Something has gone terribly wrong */
    {
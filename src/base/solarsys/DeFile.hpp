@@ -37,6 +37,11 @@
  *       as the ASCII file.  The header file should be called header.FMT, where
  *       FMT is the format (e.g. 405, etc.) of the DE file.  NOTE: Conversion
  *       not yet done.
+ *
+ * @note The binary file is memory mapped when the platform allows it.  Records
+ *       are then located directly from the requested epoch and read in place,
+ *       so lookups that jump between epochs do not re-read the file and the
+ *       interpolators do not modify any shared record state.
  */
 //------------------------------------------------------------------------------
 #ifndef DeFile_hpp
@@ -45,6 +50,7 @@
 #include "gmatdefs.hpp"
 #include "A1Mjd.hpp"
 #include "PlanetaryEphem.hpp"
+#include "MemoryMappedFile.hpp"
 
 #include <stdio.h> // for FILE, etc. (for JPL/JSC code (Hoffman))
 
@@ -344,6 +350,17 @@ private:
    /// File beginning in ModJulian format
    double             mA1FileBeg;
 
+   /// Read-only mapping of the whole binary file, when the OS supports it
+   MemoryMappedFile   *mappedFile;
+   /// First data record in the mapping (past the two header records)
+   const double       *mappedRecords;
+   /// Number of data records in the mapping
+   Integer            numRecords;
+   /// Start time of the first data record, relative to baseEpoch
+   double             firstRecordBeg;
+   /// Time span covered by each data record, in days
+   double             recordSpan;
+
 //   #if (USE_64_BIT_LONGS == 1)
 //      int             numConst;   // where is this used?
 //   #else
@@ -366,6 +383,13 @@ private:
 
    void Read_Coefficients(GmatTime Time);
 
+   // Record lookup used by the interpolators; indexes the mapped file directly
+   // when it is available, and falls back to Read_Coefficients otherwise
+   const double* GetRecord(double Time, double &recBeg, double &recSpan);
+   const double* GetRecord(const GmatTime &Time, double &recBeg,
+                           double &recSpan);
+   bool          MapEphemerisFile(const std::string &fileName);
+
    /*-------------------------------------------------------------------------*/
    /*  Initialize_Ephemeris      - from JPL/JSC code (Hoffman)                */
    /*-------------------------------------------------------------------------*/
@@ -0,0 +1,216 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                             EnvironmentContext
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/16
+//
+/**
+ * Implements the EnvironmentContext class.
+ */
+//------------------------------------------------------------------------------
+
+#include "EnvironmentContext.hpp"
+#include "CelestialBody.hpp"
+#include "MessageInterface.hpp"
+#include <cmath>
+#include <map>
+#include <mutex>
+
+//#define DEBUG_ENVIRONMENT_CONTEXT
+
+namespace
+{
+   typedef std::pair<CelestialBody*, CelestialBody*> BodyPair;
+
+   /// The most recent context for each Sun, central body pair
+   std::map<BodyPair, EnvironmentContext> sharedContexts;
+   std::mutex                             sharedContextMutex;
+
+   /// Usage counters
+   Integer                                evaluationCount = 0;
+   Integer                                reuseCount = 0;
+}
+
+//------------------------------------------------------------------------------
+// EnvironmentContext()
+//------------------------------------------------------------------------------
+/**
+ * Constructor; the epoch is set so that no real epoch matches it
+ */
+//------------------------------------------------------------------------------
+EnvironmentContext::EnvironmentContext() :
+   epoch          (-1.0),
+   sunDistance    (0.0)
+{
+   for (Integer i = 0; i < 6; ++i)
+   {
+      sunState[i]  = 0.0;
+      bodyState[i] = 0.0;
+      bodyToSun[i] = 0.0;
+   }
+   sunDirection[0] = sunDirection[1] = sunDirection[2] = 0.0;
+}
+
+//------------------------------------------------------------------------------
+// void Update(CelestialBody *sun, CelestialBody *body, GmatEpoch when)
+//------------------------------------------------------------------------------
+/**
+ * Reads the ephemerides and fills in the geometry for an epoch.
+ *
+ * @param sun  The Sun
+ * @param body The central body
+ * @param when The A.1 modified Julian epoch of the data
+ */
+//------------------------------------------------------------------------------
+void EnvironmentContext::Update(CelestialBody *sun, CelestialBody *body,
+                                GmatEpoch when)
+{
+   const Rvector6 &sunrv = sun->GetState(when);
+   for (Integer i = 0; i < 6; ++i)
+      sunState[i] = sunrv[i];
+
+   if (body == sun)
+   {
+      for (Integer i = 0; i < 6; ++i)
+      {
+         bodyState[i] = sunState[i];
+         bodyToSun[i] = 0.0;
+      }
+   }
+   else
+   {
+      const Rvector6 &cbrv = body->GetState(when);
+      for (Integer i = 0; i < 6; ++i)
+      {
+         bodyState[i] = cbrv[i];
+         bodyToSun[i] = sunState[i] - bodyState[i];
+      }
+   }
+
+   sunDistance = sqrt(bodyToSun[0]*bodyToSun[0] + bodyToSun[1]*bodyToSun[1] +
+                      bodyToSun[2]*bodyToSun[2]);
+   for (Integer i = 0; i < 3; ++i)
+      sunDirection[i] = (sunDistance > 0.0 ? bodyToSun[i] / sunDistance : 0.0);
+
+   epoch = when;
+}
+
+//------------------------------------------------------------------------------
+// void GetContext(CelestialBody *sun, CelestialBody *body, GmatEpoch when,
+//                 EnvironmentContext &context)
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the shared geometry for a body pair at an epoch, reading the
+ * ephemerides only if no model has asked for that epoch yet.
+ *
+ * @param sun     The Sun
+ * @param body    The central body
+ * @param when    The A.1 modified Julian epoch of the data
+ * @param context The context that receives the data
+ */
+//------------------------------------------------------------------------------
+void EnvironmentContext::GetContext(CelestialBody *sun, CelestialBody *body,
+                                    GmatEpoch when,
+                                    EnvironmentContext &context)
+{
+   std::lock_guard<std::mutex> lock(sharedContextMutex);
+
+   EnvironmentContext &shared = sharedContexts[BodyPair(sun, body)];
+   if (shared.epoch != when)
+   {
+      shared.Update(sun, body, when);
+      ++evaluationCount;
+
+      #ifdef DEBUG_ENVIRONMENT_CONTEXT
+         MessageInterface::ShowMessage("EnvironmentContext: %s-%s at "
+               "%.12lf; %d evaluations, %d reuses\n", body->GetName().c_str(),
+               sun->GetName().c_str(), when, evaluationCount, reuseCount);
+      #endif
+   }
+   else
+      ++reuseCount;
+
+   context = shared;
+}
+
+//------------------------------------------------------------------------------
+// void ReleaseBody(CelestialBody *body)
+//------------------------------------------------------------------------------
+/**
+ * Drops the contexts that use a body.  Bodies call this when they are
+ * deleted or their ephemeris source changes.
+ *
+ * @param body The body
+ */
+//------------------------------------------------------------------------------
+void EnvironmentContext::ReleaseBody(CelestialBody *body)
+{
+   std::lock_guard<std::mutex> lock(sharedContextMutex);
+
+   std::map<BodyPair, EnvironmentContext>::iterator i = sharedContexts.begin();
+   while (i != sharedContexts.end())
+   {
+      if ((i->first.first == body) || (i->first.second == body))
+         i = sharedContexts.erase(i);
+      else
+         ++i;
+   }
+}
+
+//------------------------------------------------------------------------------
+// void ClearContexts()
+//------------------------------------------------------------------------------
+/**
+ * Drops all of the shared contexts and resets the usage counters
+ */
+//------------------------------------------------------------------------------
+void EnvironmentContext::ClearContexts()
+{
+   std::lock_guard<std::mutex> lock(sharedContextMutex);
+   sharedContexts.clear();
+   evaluationCount = 0;
+   reuseCount = 0;
+}
+
+//------------------------------------------------------------------------------
+// Integer GetEvaluationCount()
+//------------------------------------------------------------------------------
+/**
+ * @return The number of times the ephemerides were read since the last clear
+ */
+//------------------------------------------------------------------------------
+Integer EnvironmentContext::GetEvaluationCount()
+{
+   std::lock_guard<std::mutex> lock(sharedContextMutex);
+   return evaluationCount;
+}
+
+//------------------------------------------------------------------------------
+// Integer GetReuseCount()
+//------------------------------------------------------------------------------
+/**
+ * @return The number of requests served from a stored context
+ */
+//------------------------------------------------------------------------------
+Integer EnvironmentContext::GetReuseCount()
+{
+   std::lock_guard<std::mutex> lock(sharedContextMutex);
+   return reuseCount;
+}
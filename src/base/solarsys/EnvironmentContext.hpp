@@ -0,0 +1,74 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                             EnvironmentContext
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/16
+//
+/**
+ * Declares the EnvironmentContext class, the Sun and central body geometry
+ * shared by the environment force models at one epoch.
+ *
+ * Drag, solar radiation pressure and the shadow computations all need the
+ * Sun and central body states at the epoch of a derivative evaluation.  The
+ * first model asking for an (epoch, Sun, central body) combination reads the
+ * ephemerides; the others get a copy of the stored result.  The context for
+ * each body pair holds the most recent epoch only, so the storage stays
+ * small and the lookup is a single map search.  Access is serialized, so the
+ * contexts may be used from several threads.
+ */
+//------------------------------------------------------------------------------
+#ifndef EnvironmentContext_hpp
+#define EnvironmentContext_hpp
+
+#include "gmatdefs.hpp"
+
+class CelestialBody;
+
+class GMAT_API EnvironmentContext
+{
+public:
+   EnvironmentContext();
+
+   void                 Update(CelestialBody *sun, CelestialBody *body,
+                              GmatEpoch when);
+
+   /// Epoch of the data
+   GmatEpoch            epoch;
+   /// Sun state in the solar system's J2000 frame
+   Real                 sunState[6];
+   /// Central body state in the solar system's J2000 frame
+   Real                 bodyState[6];
+   /// Sun state relative to the central body
+   Real                 bodyToSun[6];
+   /// Distance from the central body to the Sun
+   Real                 sunDistance;
+   /// Unit vector from the central body to the Sun
+   Real                 sunDirection[3];
+
+   static void          GetContext(CelestialBody *sun, CelestialBody *body,
+                                   GmatEpoch when,
+                                   EnvironmentContext &context);
+   static void          ReleaseBody(CelestialBody *body);
+   static void          ClearContexts();
+   static Integer       GetEvaluationCount();
+   static Integer       GetReuseCount();
+};
+
+#endif // EnvironmentContext_hpp
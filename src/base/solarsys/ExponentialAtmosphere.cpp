@@ -176,6 +176,21 @@ bool ExponentialAtmosphere::Density(Real *position, Real *density, Real epoch,
 }
 
 
+//-----------------------------------------------------------------------------
+// bool ExponentialAtmosphere::SupportsConcurrentCopies()
+//-----------------------------------------------------------------------------
+/**
+ * The exponential model depends only on its own tables.
+ *
+ * @return true
+ */
+//-----------------------------------------------------------------------------
+bool ExponentialAtmosphere::SupportsConcurrentCopies()
+{
+   return true;
+}
+
+
 //------------------------------------------------------------------------------
 // void SetConstants()
 //------------------------------------------------------------------------------
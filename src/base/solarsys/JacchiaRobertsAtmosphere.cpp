@@ -348,6 +348,9 @@ bool JacchiaRobertsAtmosphere::Density(Real *pos, Real *density, Real epoch,
          ("   UTC time = %lf\n", utc_time);
    #endif
 
+   // The flux and Kp values are the same for every spacecraft in the batch
+   PrepareFluxInputs(utc_time);
+
    for (Integer i = 0; i < count; ++i)
    {
       height = CalculateGeodetics(&pos[i*6], epoch, true);
@@ -443,42 +446,17 @@ void JacchiaRobertsAtmosphere::SetCentralBody(CelestialBody *cb)
 
 
 //------------------------------------------------------------------------------
-// Real JacchiaRoberts(Real height, Real space_craft[3], Real sun[3], 
-//                     Real a1_time, bool new_file)
+// void PrepareFluxInputs(Real a1_time)
 //------------------------------------------------------------------------------
 /**
- * Obtain atmospheric density using the Jacchia-Roberts model
- *  
- *  
- * Modifications:
- * Name                Date      Description
- * ------------------  --------  ------------------------------------------
- * D. Ginn             01/26/94  DSPSE OPS:  Added new_file argument, logic
- * W. Waktola          06/08/04  Code 583: Renamed to JacchiaRoberts()
- * W. Waktola          12/28/04  Code 583: Removed FILE* tkptr
- *
- * @param height       Spacecraft height (km)
- * @param space_craft  Spacecraft position (km, TOD GCI)
- * @param sun          Sun unit vector (TOD GCI)
- * @param a1_time      Reduced julian date (days)
- * @param new_file     If true, flush static data for file
+ * Sets the exospheric temperature and Kp used for every spacecraft at an
+ * epoch, reading the flux file when one is in use
  *
- * @return The density
- */  
+ * @param a1_time  Reduced julian date (days)
+ */
 //------------------------------------------------------------------------------
-Real JacchiaRobertsAtmosphere::JacchiaRoberts(Real height, Real space_craft[3], 
-                                              Real sun[3], Real a1_time)
+void JacchiaRobertsAtmosphere::PrepareFluxInputs(Real a1_time)
 {
-   #ifdef DEBUG_JR_DRAG
-      MessageInterface::ShowMessage
-         ("JacchiaRobertsAtmosphere::JacchiaRoberts(%15lf, [%15lf %15lf %15lf],"
-          "\n   [%15lf %15lf %15lf], %15lf\n",
-          height, space_craft[0], space_craft[1], space_craft[2],
-          sun[0], sun[1], sun[2], a1_time);
-   #endif
-
-   Real density, temperature, t_500, sun_dec, geo_lat;
-   
    // Read F10.7 and F10.7a to calculate the geo.xtemp
    if (!fluxReaderLoaded)
    {
@@ -556,8 +534,46 @@ Real JacchiaRobertsAtmosphere::JacchiaRoberts(Real height, Real space_craft[3],
       MessageInterface::ShowMessage("%.12lf  %lf  %lf  [%lf]\n",
          a1_time, nominalF107, nominalF107a, geo.tkp);
    #endif
+}
 
 
+//------------------------------------------------------------------------------
+// Real JacchiaRoberts(Real height, Real space_craft[3], Real sun[3], 
+//                     Real a1_time, bool new_file)
+//------------------------------------------------------------------------------
+/**
+ * Obtain atmospheric density using the Jacchia-Roberts model
+ *  
+ *  
+ * Modifications:
+ * Name                Date      Description
+ * ------------------  --------  ------------------------------------------
+ * D. Ginn             01/26/94  DSPSE OPS:  Added new_file argument, logic
+ * W. Waktola          06/08/04  Code 583: Renamed to JacchiaRoberts()
+ * W. Waktola          12/28/04  Code 583: Removed FILE* tkptr
+ *
+ * @param height       Spacecraft height (km)
+ * @param space_craft  Spacecraft position (km, TOD GCI)
+ * @param sun          Sun unit vector (TOD GCI)
+ * @param a1_time      Reduced julian date (days)
+ * @param new_file     If true, flush static data for file
+ *
+ * @return The density
+ */  
+//------------------------------------------------------------------------------
+Real JacchiaRobertsAtmosphere::JacchiaRoberts(Real height, Real space_craft[3], 
+                                              Real sun[3], Real a1_time)
+{
+   #ifdef DEBUG_JR_DRAG
+      MessageInterface::ShowMessage
+         ("JacchiaRobertsAtmosphere::JacchiaRoberts(%15lf, [%15lf %15lf %15lf],"
+          "\n   [%15lf %15lf %15lf], %15lf\n",
+          height, space_craft[0], space_craft[1], space_craft[2],
+          sun[0], sun[1], sun[2], a1_time);
+   #endif
+
+   Real density, temperature, t_500, sun_dec, geo_lat;
+   
    #ifdef DEBUG_JR_DRAG
       MessageInterface::ShowMessage
          ("   Using constant values\n   F10.7   = %lf\n"
@@ -108,6 +108,7 @@ private:
 
 
 
+   void PrepareFluxInputs(Real a1_time);
    Real JacchiaRoberts(Real height, Real space_craft[3], Real sun[3],
                       Real a1_time);
    Real exotherm(Real space_craft[3], Real sun[3], GEOPARMS *geo,
@@ -33,6 +33,7 @@
 #include "FileManager.hpp"
 #include "Rmatrix.hpp"
 #include "Planet.hpp"
+#include "ParameterIndex.hpp"
 #include "MessageInterface.hpp"
 #include "GmatGlobal.hpp"
 #include "GmatConstants.hpp"
@@ -587,11 +588,11 @@ std::string Planet::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer Planet::GetParameterID(const std::string &str) const
 {
-   for (Integer i = CelestialBodyParamCount; i < PlanetParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - CelestialBodyParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("Planet", PARAMETER_TEXT,
+         CelestialBodyParamCount, PlanetParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
    
    return CelestialBody::GetParameterID(str);
 }
@@ -168,6 +168,21 @@ bool SimpleExponentialAtmosphere::Density(Real *position, Real *density,
 }
 
 
+//-----------------------------------------------------------------------------
+// bool SimpleExponentialAtmosphere::SupportsConcurrentCopies()
+//-----------------------------------------------------------------------------
+/**
+ * The exponential model depends only on its own tables.
+ *
+ * @return true
+ */
+//-----------------------------------------------------------------------------
+bool SimpleExponentialAtmosphere::SupportsConcurrentCopies()
+{
+   return true;
+}
+
+
 //------------------------------------------------------------------------------
 // GmatBase* Clone() const
 //------------------------------------------------------------------------------
@@ -74,6 +74,7 @@ public:
    virtual bool            Density(Real *position, Real *density, 
                                    Real epoch = GmatTimeConstants::MJD_OF_J2000,
                                    Integer count = 1);
+   virtual bool            SupportsConcurrentCopies();
 
 protected: 
    /// Table of scale heights, \f$H\f$.
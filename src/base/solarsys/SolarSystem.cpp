@@ -30,6 +30,7 @@
 #include <list>
 #include <string>
 #include "SolarSystem.hpp"              // class's header file
+#include "ParameterIndex.hpp"
 #include "SolarSystemException.hpp"
 #include "UtilityException.hpp"
 #include "CelestialBody.hpp"
@@ -3118,11 +3119,11 @@ std::string SolarSystem::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer SolarSystem::GetParameterID(const std::string &str) const
 {
-   for (Integer i = GmatBaseParamCount; i < SolarSystemParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatBaseParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("SolarSystem", PARAMETER_TEXT,
+         GmatBaseParamCount, SolarSystemParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
 
    return GmatBase::GetParameterID(str);
 }
@@ -31,6 +31,7 @@
 #include "SolarSystem.hpp"
 #include "CelestialBody.hpp"
 #include "Star.hpp"
+#include "ParameterIndex.hpp"
 #include "GmatConstants.hpp"
 #include "MessageInterface.hpp"
 #include "A1Mjd.hpp"
@@ -312,11 +313,11 @@ std::string Star::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer Star::GetParameterID(const std::string &str) const
 {
-   for (Integer i = CelestialBodyParamCount; i < StarParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - CelestialBodyParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("Star", PARAMETER_TEXT,
+         CelestialBodyParamCount, StarParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
    
    return CelestialBody::GetParameterID(str);
 }
@@ -33,6 +33,7 @@
 
 
 #include "DifferentialCorrector.hpp"
+#include "ParameterIndex.hpp"
 #include "Rmatrix.hpp"
 #include "RealUtilities.hpp"     // for GmatMathUtil::Abs()
 #include "MessageInterface.hpp"
@@ -62,7 +63,8 @@ DifferentialCorrector::PARAMETER_TEXT[DifferentialCorrectorParamCount -
 {
    "Goals",
    "DerivativeMethod",
-   "Algorithm"					// searchTypeID
+   "Algorithm",					// searchTypeID
+   "PerturbationWorkers"
 };
 
 const Gmat::ParameterType
@@ -71,7 +73,8 @@ DifferentialCorrector::PARAMETER_TYPE[DifferentialCorrectorParamCount -
 {
    Gmat::STRINGARRAY_TYPE,
    Gmat::ENUMERATION_TYPE,
-   Gmat::ENUMERATION_TYPE
+   Gmat::ENUMERATION_TYPE,
+   Gmat::INTEGER_TYPE
 };
 
 
@@ -279,11 +282,11 @@ Integer DifferentialCorrector::GetParameterID(const std::string &str) const
    }
 
    // 2. This part is kept for a future build:
-   for (Integer i = SolverParamCount; i < DifferentialCorrectorParamCount; ++i)
-   {
-      if (str == PARAMETER_TEXT[i - SolverParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("DifferentialCorrector",
+         PARAMETER_TEXT, SolverParamCount, DifferentialCorrectorParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
 
    return Solver::GetParameterID(str);
 }
@@ -327,6 +330,44 @@ std::string DifferentialCorrector::GetParameterTypeString(
    return Solver::PARAM_TYPE_STRING[GetParameterType(id)];
 }
 
+
+//------------------------------------------------------------------------------
+//  bool IsParameterReadOnly(const Integer id) const
+//------------------------------------------------------------------------------
+/**
+ * Checks to see if the requested parameter is read only.
+ *
+ * @param <id> Description for the parameter.
+ *
+ * @return true if the parameter is read only, false (the default) if not.
+ */
+//------------------------------------------------------------------------------
+bool DifferentialCorrector::IsParameterReadOnly(const Integer id) const
+{
+   // Only written when concurrent perturbation passes are requested
+   if ((id == perturbationWorkersID) && (perturbationWorkers == 1))
+      return true;
+
+   return Solver::IsParameterReadOnly(id);
+}
+
+
+//------------------------------------------------------------------------------
+//  bool IsParameterReadOnly(const std::string &label) const
+//------------------------------------------------------------------------------
+/**
+ * Checks to see if the requested parameter is read only.
+ *
+ * @param <label> Description for the parameter.
+ *
+ * @return true if the parameter is read only, false (the default) if not.
+ */
+//------------------------------------------------------------------------------
+bool DifferentialCorrector::IsParameterReadOnly(const std::string &label) const
+{
+   return IsParameterReadOnly(GetParameterID(label));
+}
+
 //------------------------------------------------------------------------------
 //  Integer  GetIntegerParameter(const Integer id) const
 //------------------------------------------------------------------------------
@@ -344,6 +385,9 @@ Integer DifferentialCorrector::GetIntegerParameter(const Integer id) const
    //if (id == maxIterationsID)
    //   return maxIterations;
 
+   if (id == perturbationWorkersID)
+      return perturbationWorkers;
+
    return Solver::GetIntegerParameter(id);
 }
 
@@ -375,6 +419,17 @@ Integer DifferentialCorrector::SetIntegerParameter(const Integer id,
    //   return maxIterations;
    //}
 
+   if (id == perturbationWorkersID)
+   {
+      if (value < 1)
+         throw SolverException(
+            "The value entered for the perturbation workers on " +
+            instanceName + " is not an allowed value. The allowed value is: "
+            "[Integer > 0].");
+      perturbationWorkers = value;
+      return perturbationWorkers;
+   }
+
    return Solver::SetIntegerParameter(id, value);
 }
 
@@ -754,6 +809,9 @@ void DifferentialCorrector::SetResultValue(Integer id, Real value,
             " encountered a goal value for " + goalNames[id] + " that is "
             "infinite.  Targeting is terminating.");
 
+   if (RecordResult(id, value, resultType))
+      return;
+
    if (currentState == NOMINAL)
    {
       nominal[id] = value;
@@ -769,6 +827,87 @@ void DifferentialCorrector::SetResultValue(Integer id, Real value,
 }
 
 
+//------------------------------------------------------------------------------
+// Integer GetPerturbationPassCount()
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of perturbation passes used to build the Jacobian.
+ *
+ * The passes are reported only when the first perturbation of a set has just
+ * been applied.  Pass 2i is the forward perturbation of variable i and pass
+ * 2i+1 its backward perturbation when central differencing is used; otherwise
+ * pass i perturbs variable i.
+ *
+ * @return The number of passes, or 0 if the set is not at its start
+ */
+//------------------------------------------------------------------------------
+Integer DifferentialCorrector::GetPerturbationPassCount()
+{
+   if ((currentState != PERTURBING) || (pertNumber != 0) || !firstPert)
+      return 0;
+
+   return (diffMode == 0 ? 2 * variableCount : variableCount);
+}
+
+
+//------------------------------------------------------------------------------
+// bool SetPerturbationPass(Integer pass)
+//------------------------------------------------------------------------------
+/**
+ * Backs out the current perturbation and applies the one for a pass.
+ *
+ * @param pass The pass; see GetPerturbationPassCount()
+ *
+ * @return true if the pass was applied
+ */
+//------------------------------------------------------------------------------
+bool DifferentialCorrector::SetPerturbationPass(Integer pass)
+{
+   Integer passCount = (diffMode == 0 ? 2 * variableCount : variableCount);
+   if ((currentState != PERTURBING) || (pass < 0) || (pass >= passCount))
+      return false;
+
+   if (pertNumber != -1)
+      variable.at(pertNumber) = lastUnperturbedValue;
+
+   if (diffMode == 0)
+   {
+      pertNumber = pass / 2;
+      firstPert = (pass % 2 == 0);
+      incrementPert = !firstPert;
+   }
+   else
+   {
+      pertNumber = pass;
+      firstPert = true;
+      incrementPert = true;
+   }
+
+   ApplyPerturbation();
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// void CompletePerturbationPasses()
+//------------------------------------------------------------------------------
+/**
+ * Backs out the last perturbation and moves the state machine on to the
+ * Jacobian calculation.
+ */
+//------------------------------------------------------------------------------
+void DifferentialCorrector::CompletePerturbationPasses()
+{
+   if (pertNumber != -1)
+      variable.at(pertNumber) = lastUnperturbedValue;
+
+   pertNumber = -1;
+   firstPert = true;
+   incrementPert = true;
+   currentState = CALCULATING;
+}
+
+
 //------------------------------------------------------------------------------
 // bool Initialize()
 //------------------------------------------------------------------------------
@@ -1035,33 +1174,52 @@ void DifferentialCorrector::RunPerturbation()
       return;
    }
 
+   if (diffMode == 0)      // Central difference: forward, then backward
+   {
+      firstPert = incrementPert;
+      incrementPert = !incrementPert;
+   }
+   else
+      firstPert = true;
+
+   ApplyPerturbation();
+   WriteToTextFile();
+}
+
+
+//------------------------------------------------------------------------------
+//  void ApplyPerturbation()
+//------------------------------------------------------------------------------
+/**
+ * Perturbs the variable indexed by pertNumber.
+ *
+ * For central differencing, firstPert selects the forward (true) or backward
+ * (false) perturbation.
+ */
+//------------------------------------------------------------------------------
+void DifferentialCorrector::ApplyPerturbation()
+{
    lastUnperturbedValue = variable.at(pertNumber);
    if (diffMode == 1)      // Forward difference
    {
-      firstPert = true;
       variable.at(pertNumber) += perturbation.at(pertNumber);
       pertDirection.at(pertNumber) = 1.0;
    }
    else if (diffMode == 0) // Central difference
    {
-      if (incrementPert)
+      if (firstPert)
       {
-         firstPert = true;
-         incrementPert = false;
          variable.at(pertNumber) += perturbation.at(pertNumber);
          pertDirection.at(pertNumber) = 1.0;
       }
       else
       {
-         firstPert = false;
-         incrementPert = true;
          variable.at(pertNumber) -= perturbation.at(pertNumber);
          pertDirection.at(pertNumber) = -1.0;
       }
    }
    else                    // Backward difference
    {
-      firstPert = true;
       variable.at(pertNumber) -= perturbation.at(pertNumber);
       pertDirection.at(pertNumber) = -1.0;
    }
@@ -1099,8 +1257,6 @@ void DifferentialCorrector::RunPerturbation()
          variable[pertNumber] -= 2.0 * perturbation[pertNumber];
       }
    }
-
-   WriteToTextFile();
 }
 
 
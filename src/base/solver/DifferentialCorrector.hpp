@@ -69,6 +69,8 @@ public:
    virtual Gmat::ParameterType
                        GetParameterType(const Integer id) const;
    virtual std::string GetParameterTypeString(const Integer id) const;
+   virtual bool        IsParameterReadOnly(const Integer id) const;
+   virtual bool        IsParameterReadOnly(const std::string &label) const;
 
    virtual Integer     GetIntegerParameter(const Integer id) const;
    virtual Integer     SetIntegerParameter(const Integer id,
@@ -96,6 +98,10 @@ public:
    virtual void        SetResultValue(Integer id, Real value,
                                       const std::string &resultType = "");
 
+   virtual Integer     GetPerturbationPassCount();
+   virtual bool        SetPerturbationPass(Integer pass);
+   virtual void        CompletePerturbationPasses();
+
    DEFAULT_TO_NO_CLONES
    DEFAULT_TO_NO_REFOBJECTS
 
@@ -162,6 +168,7 @@ protected:
       goalNamesID = SolverParamCount,
       derivativeMethodID,
       searchTypeID,
+      perturbationWorkersID,
       DifferentialCorrectorParamCount
    };
 
@@ -174,6 +181,7 @@ protected:
    // Methods
    virtual void                RunNominal();
    virtual void                RunPerturbation();
+   void                        ApplyPerturbation();
    virtual void                CalculateParameters();
    virtual void                CheckCompletion();
    virtual void                RunComplete();
@@ -32,6 +32,7 @@
 
 
 #include "ExternalOptimizer.hpp"
+#include "ParameterIndex.hpp"
 #include "FileManager.hpp"
 #include "MessageInterface.hpp"
 
@@ -198,11 +199,11 @@ std::string ExternalOptimizer::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer ExternalOptimizer::GetParameterID(const std::string &str) const
 {
-   for (Integer i = OptimizerParamCount; i < ExternalOptimizerParamCount; ++i)
-   {
-      if (str == PARAMETER_TEXT[i - OptimizerParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("ExternalOptimizer",
+         PARAMETER_TEXT, OptimizerParamCount, ExternalOptimizerParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
 
    return Optimizer::GetParameterID(str);
 }
@@ -33,6 +33,7 @@
 
 #include <sstream>
 #include "Optimizer.hpp"
+#include "ParameterIndex.hpp"
 #include "Rmatrix.hpp"
 #include "RealUtilities.hpp"     // for GmatMathUtil::Abs()
 #include "MessageInterface.hpp"
@@ -580,11 +581,11 @@ std::string Optimizer::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer Optimizer::GetParameterID(const std::string &str) const
 {
-   for (Integer i = SolverParamCount; i < OptimizerParamCount; ++i)
-   {
-      if (str == PARAMETER_TEXT[i - SolverParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("Optimizer", PARAMETER_TEXT,
+         SolverParamCount, OptimizerParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
 
    return Solver::GetParameterID(str);
 }
@@ -32,6 +32,7 @@
 
 #include <sstream>
 #include "Solver.hpp"
+#include "ParameterIndex.hpp"
 #include "MessageInterface.hpp"
 #include "ISolverListener.hpp"
 #include "FileManager.hpp"
@@ -131,6 +132,8 @@ Solver::Solver(const std::string &type, const std::string &name) :
    //variableMaximum         (NULL),
    //variableMaximumStep     (NULL),
    pertNumber              (-999), // is this right?
+   perturbationWorkers     (1),
+   recordResults           (false),
    instanceNumber          (0),    // 0 indicates 1st instance w/ this name
    registeredVariableCount (0),
    registeredComponentCount(0),
@@ -201,6 +204,8 @@ Solver::Solver(const Solver &sol) :
    //variableMaximum         (NULL),
    //variableMaximumStep     (NULL),
    pertNumber              (sol.pertNumber),
+   perturbationWorkers     (sol.perturbationWorkers),
+   recordResults           (false),
    solverTextFile          (sol.solverTextFile),
    solverTextFileFullPath  (sol.solverTextFileFullPath),
    instanceNumber          (sol.instanceNumber),
@@ -276,6 +281,9 @@ Solver& Solver::operator=(const Solver &sol)
    debugString           = sol.debugString;
    instanceNumber        = sol.instanceNumber;
    pertNumber            = sol.pertNumber;
+   perturbationWorkers   = sol.perturbationWorkers;
+   recordResults         = false;
+   recordedResults.clear();
    solverMode            = sol.solverMode;
    currentMode           = sol.currentMode;
    exitMode              = sol.exitMode;
@@ -797,11 +805,11 @@ Integer Solver::GetParameterID(const std::string &str) const
    }
    
    // 2. This part is kept for a future build:
-   for (Integer i = GmatBaseParamCount; i < SolverParamCount; ++i)
-   {
-      if (param_text == PARAMETER_TEXT[i - GmatBaseParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("Solver", PARAMETER_TEXT,
+         GmatBaseParamCount, SolverParamCount);
+   Integer id = parameterIndex.Find(param_text);
+   if (id != -1)
+      return id;
    
    return GmatBase::GetParameterID(str);
 }
@@ -1373,6 +1381,106 @@ void Solver::SetDebugString(const std::string &str)
 
 
 
+//------------------------------------------------------------------------------
+//  Integer GetPerturbationPassCount()
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of perturbation passes that can be run independently.
+ *
+ * Solvers that build finite difference derivatives run the solver control
+ * sequence once for each perturbation.  Those passes differ only in the
+ * variable values, so a solver that supports it reports the full set of
+ * passes here once the first perturbation of a set has been applied.  Each
+ * pass is then selected with SetPerturbationPass() and run, and its results
+ * are passed to SetResultValue() while that pass is selected.
+ *
+ * The default implementation returns 0, so the passes are run serially
+ * through the state machine.
+ *
+ * @return The number of passes, or 0 if they cannot be run independently
+ */
+//------------------------------------------------------------------------------
+Integer Solver::GetPerturbationPassCount()
+{
+   return 0;
+}
+
+
+//------------------------------------------------------------------------------
+//  bool SetPerturbationPass(Integer pass)
+//------------------------------------------------------------------------------
+/**
+ * Backs out the current perturbation and applies the one for a pass.
+ *
+ * @param pass The pass, in the range [0, GetPerturbationPassCount())
+ *
+ * @return true if the pass was applied
+ */
+//------------------------------------------------------------------------------
+bool Solver::SetPerturbationPass(Integer pass)
+{
+   return false;
+}
+
+
+//------------------------------------------------------------------------------
+//  void CompletePerturbationPasses()
+//------------------------------------------------------------------------------
+/**
+ * Backs out the current perturbation after all passes have been run, leaving
+ * the state machine ready to calculate the new variable values.
+ */
+//------------------------------------------------------------------------------
+void Solver::CompletePerturbationPasses()
+{
+}
+
+
+//------------------------------------------------------------------------------
+//  Integer GetPerturbationWorkerCount() const
+//------------------------------------------------------------------------------
+/**
+ * @return The number of perturbation passes run at once
+ */
+//------------------------------------------------------------------------------
+Integer Solver::GetPerturbationWorkerCount() const
+{
+   return perturbationWorkers;
+}
+
+
+//------------------------------------------------------------------------------
+//  void RecordResults(bool record)
+//------------------------------------------------------------------------------
+/**
+ * Turns recording of the results passed to SetResultValue() on or off.
+ *
+ * Turning recording on discards the results recorded earlier.
+ *
+ * @param record true to record the results rather than apply them
+ */
+//------------------------------------------------------------------------------
+void Solver::RecordResults(bool record)
+{
+   recordResults = record;
+   if (record)
+      recordedResults.clear();
+}
+
+
+//------------------------------------------------------------------------------
+//  const std::vector<RecordedResult>& GetRecordedResults() const
+//------------------------------------------------------------------------------
+/**
+ * @return The results recorded since recording was turned on
+ */
+//------------------------------------------------------------------------------
+const std::vector<Solver::RecordedResult>& Solver::GetRecordedResults() const
+{
+   return recordedResults;
+}
+
+
 //------------------------------------------------------------------------------
 //  void CompleteInitialization()
 //------------------------------------------------------------------------------
@@ -1524,6 +1632,37 @@ void Solver::ResetVariables()
 }
 
 
+//------------------------------------------------------------------------------
+//  bool RecordResult(Integer id, Real value, const std::string &resultType)
+//------------------------------------------------------------------------------
+/**
+ * Saves a result when results are being recorded.
+ *
+ * Solvers that support parallel perturbation passes call this method at the
+ * start of SetResultValue(), and return immediately when it returns true.
+ *
+ * @param id         The ID used for the result
+ * @param value      The result
+ * @param resultType The type of the result
+ *
+ * @return true if the result was recorded, false if it should be applied
+ */
+//------------------------------------------------------------------------------
+bool Solver::RecordResult(Integer id, Real value, const std::string &resultType)
+{
+   if (!recordResults)
+      return false;
+
+   RecordedResult result;
+   result.id    = id;
+   result.value = value;
+   result.type  = resultType;
+   recordedResults.push_back(result);
+
+   return true;
+}
+
+
 //------------------------------------------------------------------------------
 //  std::string GetProgressString()
 //------------------------------------------------------------------------------
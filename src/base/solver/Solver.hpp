@@ -228,6 +228,23 @@ public:
    virtual void        SetResultValue(Integer id, Real value,
                                       const std::string &resultType = "") = 0;
 
+   /// A result passed to SetResultValue while results are being recorded
+   struct RecordedResult
+   {
+      Integer     id;
+      Real        value;
+      std::string type;
+   };
+
+   // Support for running the perturbation passes of a solver pass in parallel
+   virtual Integer     GetPerturbationPassCount();
+   virtual bool        SetPerturbationPass(Integer pass);
+   virtual void        CompletePerturbationPasses();
+   Integer             GetPerturbationWorkerCount() const;
+   void                RecordResults(bool record);
+   const std::vector<RecordedResult>&
+                       GetRecordedResults() const;
+
 protected:
    /// Flag indicating if this Solver runs integrated into GMAT, or through
    /// an external controller like MATLAB
@@ -282,6 +299,13 @@ protected:
    Real                 lastUnperturbedValue;
    /// Used to keep Jacobian calculations tracking when we bump into a limit
    std::vector<Real>    pertDirection;
+   /// Number of perturbation passes run at once; 1 runs them serially
+   Integer              perturbationWorkers;
+   /// Flag set when SetResultValue calls are recorded rather than applied
+   bool                 recordResults;
+   /// The results recorded while recordResults is set
+   std::vector<RecordedResult>
+                        recordedResults;
 
    // Reporting parameters
    /// Name of the targeter text file.  An empty string turns the file off.
@@ -371,6 +395,8 @@ protected:
    virtual void        RunComplete();
    
    void                ResetVariables();
+   bool                RecordResult(Integer id, Real value,
+                                    const std::string &resultType);
    
    virtual std::string GetProgressString();
    virtual void        FreeArrays();
@@ -31,6 +31,7 @@
 
 
 #include "Plate.hpp"
+#include "ParameterIndex.hpp"
 #include "MessageInterface.hpp"
 #include "Rmatrix.hpp"
 #include "Rmatrix33.hpp"
@@ -329,11 +330,11 @@ bool Plate::Initialize()
 //------------------------------------------------------------------------------
 Integer Plate::GetParameterID(const std::string &str) const
 {
-   for (Integer i = GmatBaseParamCount; i < PlateParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatBaseParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("Plate", PARAMETER_TEXT,
+         GmatBaseParamCount, PlateParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
 
    return GmatBase::GetParameterID(str);
 }
@@ -37,6 +37,7 @@
 
 #include <sstream>
 #include "Spacecraft.hpp"
+#include "ParameterIndex.hpp"
 #include "MessageInterface.hpp"
 #include "ConfigManager.hpp" // FIXME: Temporary workaround until GMT-7066 is fixed
 #include "SpaceObjectException.hpp"
@@ -3353,32 +3354,31 @@ Integer Spacecraft::GetParameterID(const std::string &strInput) const
          return ADD_HARDWARE;
 
       // first check the multiple reps
-      Integer sz = EndMultipleReps - CART_X;
-      for (Integer ii = 0; ii < sz; ii++)
+      static const ParameterIndex multipleRepIndex("Spacecraft",
+            MULT_REP_STRINGS, CART_X, EndMultipleReps);
+      Integer id = multipleRepIndex.Find(str);
+      if (id != -1)
       {
-         if (str == MULT_REP_STRINGS[ii])
-         {
-            #ifdef DEBUG_GET_REAL
-            MessageInterface::ShowMessage(
-            "In SC::GetParameterID, multiple reps found!! - str = %s and id = %d\n ",
-            str.c_str(), (ii + CART_X));
-            #endif
-            return ii + CART_X;
-         }
+         #ifdef DEBUG_GET_REAL
+         MessageInterface::ShowMessage(
+         "In SC::GetParameterID, multiple reps found!! - str = %s and id = %d\n ",
+         str.c_str(), id);
+         #endif
+         return id;
       }
 
       // Check for element label
-      for (Integer i = SpaceObjectParamCount; i < SpacecraftParamCount; ++i)
+      static const ParameterIndex parameterIndex("Spacecraft", PARAMETER_LABEL,
+            SpaceObjectParamCount, SpacecraftParamCount);
+      id = parameterIndex.Find(str);
+      if (id != -1)
       {
-         if (str == PARAMETER_LABEL[i - SpaceObjectParamCount])
-         {
-            #ifdef DEBUG_GET_REAL
-            MessageInterface::ShowMessage(
-            "In SC::GetParameterID, getting id %d for str = %s\n ",
-            i, str.c_str());
-            #endif
-            return i;
-         }
+         #ifdef DEBUG_GET_REAL
+         MessageInterface::ShowMessage(
+         "In SC::GetParameterID, getting id %d for str = %s\n ",
+         id, str.c_str());
+         #endif
+         return id;
       }
       if ((str == "STM") || (str == "OrbitSTM"))
          return FULL_STM;
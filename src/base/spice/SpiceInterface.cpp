@@ -32,6 +32,7 @@
 
 
 #include "SpiceInterface.hpp"
+#include "SpkSegmentEvaluator.hpp"
 #include "A1Mjd.hpp"
 #include "StringUtil.hpp"
 #include "MessageInterface.hpp"
@@ -387,6 +388,7 @@ bool SpiceInterface::LoadKernel(const std::string &fileName)
 
    // Add the pair to the map of kernels
    loadedKernels.insert(std::make_pair(fileName, fName));
+   SpkSegmentEvaluator::Instance()->AddKernel(fName);
    
    return true;
 }
@@ -479,6 +481,7 @@ bool SpiceInterface::UnloadKernel(const std::string &fileName)
       MessageInterface::ShowMessage("Successfully UNloaded kernel %s (%s)\n",
             fileName.c_str(), kernelToUnload.c_str());
    #endif
+   SpkSegmentEvaluator::Instance()->RemoveKernel(kernelToUnload);
    // erase the unloaded file from the map (by key)
    loadedKernels.erase(fileName);
    return true; 
@@ -552,6 +555,7 @@ bool SpiceInterface::UnloadAllKernels()
       #endif
    }
    loadedKernels.clear();
+   SpkSegmentEvaluator::Instance()->Clear();
    return true;
 }
 
@@ -776,6 +780,7 @@ void SpiceInterface::InitializeInterface()
    {
       loadedKernels.clear();
       kclear_c();  // clear all kernels from the pool
+      SpkSegmentEvaluator::Instance()->Clear();
       // Get path for output
       FileManager *fm = FileManager::Instance();
       std::string outPath = fm->GetAbsPathname(FileManager::OUTPUT_PATH) + "GMATSpiceKernelError.txt";
@@ -31,6 +31,7 @@
  */
 //------------------------------------------------------------------------------
 #include "SpiceOrbitKernelReader.hpp"
+#include "SpkSegmentEvaluator.hpp"
 #include "gmatdefs.hpp"
 #include "Rvector6.hpp"
 #include "Rmatrix33.hpp"
@@ -418,6 +419,21 @@ Rvector6 SpiceOrbitKernelReader::GetTargetState(const std::string &targetName,
    #endif
    SpiceDouble state[6];
    SpiceDouble oneWayLightTime;
+   // Geometric J2000 states of the common SPK types are evaluated natively;
+   // everything else goes through CSPICE
+   if ((aberration == "NONE") && (referenceFrame == "J2000") &&
+       SpkSegmentEvaluator::Instance()->GetState(targetNAIFId,
+             observingBodyNAIFId, etSPICE, state))
+   {
+      Rvector6 nativeState(state[0], state[1], state[2], state[3], state[4],
+                           state[5]);
+      #ifdef DEBUG_SPK_READING
+         MessageInterface::ShowMessage(
+               "In SPKReader:: returning native state: %s\n",
+               nativeState.ToString().c_str());
+      #endif
+      return nativeState;
+   }
    if (aberration == "NONE")
    {
       spkgeo_c(naifIDSPICE, etSPICE, referenceFrameSPICE, observerNaifIDSPICE, state, &oneWayLightTime);
@@ -524,6 +540,21 @@ Rvector6 SpiceOrbitKernelReader::GetTargetState(const std::string &targetName,
 #endif
    SpiceDouble state[6];
    SpiceDouble oneWayLightTime;
+   // Geometric J2000 states of the common SPK types are evaluated natively;
+   // everything else goes through CSPICE
+   if ((aberration == "NONE") && (referenceFrame == "J2000") &&
+      SpkSegmentEvaluator::Instance()->GetState(targetNAIFId,
+         observingBodyNAIFId, etSPICE, state))
+   {
+      Rvector6 nativeState(state[0], state[1], state[2], state[3], state[4],
+         state[5]);
+#ifdef DEBUG_SPK_READING
+      MessageInterface::ShowMessage(
+         "In SPKReader:: returning native state: %s\n",
+         nativeState.ToString().c_str());
+#endif
+      return nativeState;
+   }
    if (aberration == "NONE")
    {
       spkgeo_c(naifIDSPICE, etSPICE, referenceFrameSPICE, observerNaifIDSPICE, state, &oneWayLightTime);
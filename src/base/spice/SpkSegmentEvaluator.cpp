@@ -0,0 +1,841 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                            SpkSegmentEvaluator
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/16
+//
+/**
+ * Implements the SpkSegmentEvaluator class.
+ *
+ * The file layout and the evaluation formulas follow the NAIF DAF and SPK
+ * Required Reading, and the interpolation routines mirror the CSPICE ones
+ * (CHBINT, CHBVAL, LGRINT and HRMINT) operation for operation so that the
+ * states match the ones spkgeo_c returns.
+ */
+//------------------------------------------------------------------------------
+#include "SpkSegmentEvaluator.hpp"
+#include "MemoryMappedFile.hpp"
+#include "MessageInterface.hpp"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+//#define DEBUG_SPK_SEGMENT_EVALUATOR
+
+namespace
+{
+   /// Size of a DAF record, in bytes
+   const std::size_t DAF_RECORD_SIZE = 1024;
+   /// Number of double and integer components in an SPK segment summary
+   const Integer     SPK_ND          = 2;
+   const Integer     SPK_NI          = 6;
+   /// SPICE frame code of J2000
+   const Integer     J2000_FRAME     = 1;
+   /// Longest center chain followed, as in spkgeo_c
+   const Integer     MAX_CHAIN       = 20;
+   /// Largest interpolation window handled natively
+   const Integer     MAX_WINDOW      = 32;
+
+   //---------------------------------------------------------------------------
+   // Byte order helpers
+   //---------------------------------------------------------------------------
+   Integer ReadInt(const char *bytes, bool swap)
+   {
+      char buf[4];
+      std::memcpy(buf, bytes, 4);
+      if (swap)
+      {
+         std::swap(buf[0], buf[3]);
+         std::swap(buf[1], buf[2]);
+      }
+      int value;
+      std::memcpy(&value, buf, 4);
+      return (Integer)value;
+   }
+
+   Real ReadReal(const char *bytes, bool swap)
+   {
+      char buf[8];
+      std::memcpy(buf, bytes, 8);
+      if (swap)
+         std::reverse(buf, buf + 8);
+      Real value;
+      std::memcpy(&value, buf, 8);
+      return value;
+   }
+
+   //---------------------------------------------------------------------------
+   // Interpolation, following the CSPICE routines
+   //---------------------------------------------------------------------------
+   /// Chebyshev expansion value and derivative (CHBINT)
+   void ChebyshevWithDerivative(const Real *cp, Integer ncoef, Real mid,
+                                Real radius, Real x, Real &p, Real &dpdx)
+   {
+      Real s  = (x - mid) / radius;
+      Real s2 = 2.0 * s;
+      Real w[3]  = {0.0, 0.0, 0.0};
+      Real dw[3] = {0.0, 0.0, 0.0};
+      for (Integer j = ncoef - 1; j > 0; --j)
+      {
+         w[2]  = w[1];
+         w[1]  = w[0];
+         w[0]  = cp[j] + (s2 * w[1] - w[2]);
+         dw[2] = dw[1];
+         dw[1] = dw[0];
+         dw[0] = w[1] * 2.0 + dw[1] * s2 - dw[2];
+      }
+      p    = cp[0] + (s * w[0] - w[1]);
+      dpdx = (w[0] + s * dw[0] - dw[1]) / radius;
+   }
+
+   /// Chebyshev expansion value (CHBVAL)
+   Real Chebyshev(const Real *cp, Integer ncoef, Real mid, Real radius, Real x)
+   {
+      Real s  = (x - mid) / radius;
+      Real s2 = 2.0 * s;
+      Real w[3] = {0.0, 0.0, 0.0};
+      for (Integer j = ncoef - 1; j > 0; --j)
+      {
+         w[2] = w[1];
+         w[1] = w[0];
+         w[0] = cp[j] + (s2 * w[1] - w[2]);
+      }
+      return (s * w[0] - w[1]) + cp[0];
+   }
+
+   /// Lagrange interpolation (LGRINT)
+   Real Lagrange(Integer n, const Real *xvals, const Real *yvals, Real *work,
+                 Real x)
+   {
+      for (Integer i = 0; i < n; ++i)
+         work[i] = yvals[i];
+      for (Integer j = 1; j < n; ++j)
+      {
+         for (Integer i = 0; i < n - j; ++i)
+         {
+            Real c1    = xvals[i + j] - x;
+            Real c2    = x - xvals[i];
+            Real denom = xvals[i + j] - xvals[i];
+            work[i] = (c1 * work[i] + c2 * work[i + 1]) / denom;
+         }
+      }
+      return work[0];
+   }
+
+   /// Hermite interpolation of values and first derivatives (HRMINT); yvals
+   /// holds value, derivative pairs
+   void Hermite(Integer n, const Real *xvals, const Real *yvals, Real *work,
+                Real x, Real &f, Real &df)
+   {
+      Integer n2 = 2 * n;
+      for (Integer i = 0; i < n2; ++i)
+         work[i] = yvals[i];
+
+      // Second column of the table: first degree interpolants, derivatives
+      // first because the values overwrite the previous column
+      for (Integer i = 1; i < n; ++i)
+      {
+         Real c1    = xvals[i] - x;
+         Real c2    = x - xvals[i - 1];
+         Real denom = xvals[i] - xvals[i - 1];
+         Integer prev = 2 * i - 2;
+         Integer curr = prev + 1;
+         Integer next = curr + 1;
+         work[prev + n2] = work[curr];
+         work[curr + n2] = (work[next] - work[prev]) / denom;
+         Real temp  = work[curr] * (x - xvals[i - 1]) + work[prev];
+         work[curr] = (c1 * work[prev] + c2 * work[next]) / denom;
+         work[prev] = temp;
+      }
+      work[2 * n2 - 2] = work[n2 - 1];
+      work[n2 - 2]     = work[n2 - 1] * (x - xvals[n - 1]) + work[n2 - 2];
+
+      // Remaining columns; every abscissa appears twice
+      for (Integer j = 2; j < n2; ++j)
+      {
+         for (Integer i = 1; i <= n2 - j; ++i)
+         {
+            Integer xi  = (i + 1) / 2 - 1;
+            Integer xij = (i + j + 1) / 2 - 1;
+            Real c1    = xvals[xij] - x;
+            Real c2    = x - xvals[xi];
+            Real denom = xvals[xij] - xvals[xi];
+            work[i - 1 + n2] = (c1 * work[i - 1 + n2] + c2 * work[i + n2] +
+                                (work[i] - work[i - 1])) / denom;
+            work[i - 1] = (c1 * work[i - 1] + c2 * work[i]) / denom;
+         }
+      }
+      f  = work[0];
+      df = work[n2];
+   }
+}
+
+//------------------------------------------------------------------------------
+// SpkSegmentEvaluator* Instance()
+//------------------------------------------------------------------------------
+/**
+ * Returns the evaluator shared by all SPK readers.
+ */
+//------------------------------------------------------------------------------
+SpkSegmentEvaluator* SpkSegmentEvaluator::Instance()
+{
+   static SpkSegmentEvaluator *theEvaluator = new SpkSegmentEvaluator();
+   return theEvaluator;
+}
+
+//------------------------------------------------------------------------------
+// bool AddKernel(const std::string &fileName)
+//------------------------------------------------------------------------------
+/**
+ * Registers a kernel that was loaded into CSPICE.
+ *
+ * Kernels of any type can be passed in.  Text kernels other than
+ * meta-kernels and binary kernels other than SPKs carry no ephemeris data and
+ * are ignored; meta-kernels and files that cannot be identified turn the
+ * evaluator off until they are removed, because they may load SPK data the
+ * evaluator does not see.
+ *
+ * @param fileName Full path of the kernel, as passed to furnsh_c
+ *
+ * @return true if the kernel was added, false if it was already registered
+ */
+//------------------------------------------------------------------------------
+bool SpkSegmentEvaluator::AddKernel(const std::string &fileName)
+{
+   {
+      std::lock_guard<std::mutex> lock(catalogMutex);
+      for (UnsignedInt i = 0; i < kernels.size(); ++i)
+         if (kernels[i]->fileName == fileName)
+            return false;
+   }
+
+   std::shared_ptr<Kernel> kernel(new Kernel());
+   kernel->fileName = fileName;
+   kernel->transparent = ReadKernel(*kernel);
+
+   #ifdef DEBUG_SPK_SEGMENT_EVALUATOR
+      MessageInterface::ShowMessage("SpkSegmentEvaluator: added %s, %d "
+            "segments%s\n", fileName.c_str(), (Integer)kernel->segments.size(),
+            (kernel->transparent ? "" : " (opaque)"));
+   #endif
+
+   std::lock_guard<std::mutex> lock(catalogMutex);
+   kernels.push_back(kernel);
+   RebuildCatalog();
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// bool RemoveKernel(const std::string &fileName)
+//------------------------------------------------------------------------------
+/**
+ * Removes a kernel that was unloaded from CSPICE.
+ *
+ * @param fileName Full path of the kernel, as passed to AddKernel()
+ *
+ * @return true if the kernel was registered
+ */
+//------------------------------------------------------------------------------
+bool SpkSegmentEvaluator::RemoveKernel(const std::string &fileName)
+{
+   std::lock_guard<std::mutex> lock(catalogMutex);
+   for (UnsignedInt i = 0; i < kernels.size(); ++i)
+   {
+      if (kernels[i]->fileName == fileName)
+      {
+         kernels.erase(kernels.begin() + i);
+         RebuildCatalog();
+         return true;
+      }
+   }
+   return false;
+}
+
+//------------------------------------------------------------------------------
+// void Clear()
+//------------------------------------------------------------------------------
+/**
+ * Removes all kernels, matching kclear_c or an unload of every kernel.
+ */
+//------------------------------------------------------------------------------
+void SpkSegmentEvaluator::Clear()
+{
+   std::lock_guard<std::mutex> lock(catalogMutex);
+   kernels.clear();
+   RebuildCatalog();
+}
+
+//------------------------------------------------------------------------------
+// void SetEnabled(bool enable)
+//------------------------------------------------------------------------------
+/**
+ * Turns the native evaluation on or off.  When it is off GetState() always
+ * returns false, so every request goes through CSPICE.
+ *
+ * @param enable true to evaluate natively
+ */
+//------------------------------------------------------------------------------
+void SpkSegmentEvaluator::SetEnabled(bool enable)
+{
+   enabled.store(enable);
+}
+
+//------------------------------------------------------------------------------
+// bool IsEnabled() const
+//------------------------------------------------------------------------------
+bool SpkSegmentEvaluator::IsEnabled() const
+{
+   return enabled.load();
+}
+
+//------------------------------------------------------------------------------
+// bool GetState(Integer target, Integer observer, Real et, Real *state) const
+//------------------------------------------------------------------------------
+/**
+ * Computes the geometric state of a body relative to an observer in the J2000
+ * frame, the way spkgeo_c does: the target chain of centers is followed until
+ * it reaches the observer or runs out of data, then the observer chain is
+ * followed until it meets the target chain.
+ *
+ * @param target   NAIF ID of the target
+ * @param observer NAIF ID of the observer
+ * @param et       TDB seconds past J2000
+ * @param state    The state, km and km/s (output, 6 elements)
+ *
+ * @return true if the state was computed; false if it has to come from CSPICE
+ */
+//------------------------------------------------------------------------------
+bool SpkSegmentEvaluator::GetState(Integer target, Integer observer, Real et,
+                                   Real *state) const
+{
+   if (!enabled.load(std::memory_order_relaxed))
+      return false;
+
+   std::shared_ptr<const Catalog> cat = GetCatalog();
+   if (!cat || cat->opaque || cat->targets.empty())
+      return false;
+
+   if (target == observer)
+   {
+      for (Integer i = 0; i < 6; ++i)
+         state[i] = 0.0;
+      return true;
+   }
+
+   Integer ctarg[MAX_CHAIN];
+   Real    starg[MAX_CHAIN][6];
+   Real    legState[6];
+
+   ctarg[0] = target;
+   for (Integer i = 0; i < 6; ++i)
+      starg[0][i] = 0.0;
+   Integer nct = 1;
+
+   while (nct < MAX_CHAIN)
+   {
+      if (ctarg[nct-1] == observer)
+      {
+         for (Integer i = 0; i < 6; ++i)
+            state[i] = starg[nct-1][i];
+         return true;
+      }
+
+      const Segment *segment = FindSegment(*cat, ctarg[nct-1], et);
+      if (segment == NULL)
+         break;
+      if (!segment->IsSupported() || !segment->Evaluate(et, legState))
+         return false;
+
+      ctarg[nct] = segment->center;
+      for (Integer i = 0; i < 6; ++i)
+         starg[nct][i] = starg[nct-1][i] + legState[i];
+      ++nct;
+   }
+
+   Integer cobs = observer;
+   Real    sobs[6] = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+   for (Integer legs = 0; legs < MAX_CHAIN; ++legs)
+   {
+      for (Integer k = 0; k < nct; ++k)
+      {
+         if (ctarg[k] == cobs)
+         {
+            for (Integer i = 0; i < 6; ++i)
+               state[i] = starg[k][i] - sobs[i];
+            return true;
+         }
+      }
+
+      const Segment *segment = FindSegment(*cat, cobs, et);
+      if ((segment == NULL) || !segment->IsSupported() ||
+          !segment->Evaluate(et, legState))
+         return false;
+
+      cobs = segment->center;
+      for (Integer i = 0; i < 6; ++i)
+         sobs[i] += legState[i];
+   }
+
+   return false;
+}
+
+//------------------------------------------------------------------------------
+// Segment()
+//------------------------------------------------------------------------------
+SpkSegmentEvaluator::Segment::Segment() :
+   target      (0),
+   center      (0),
+   frame       (0),
+   type        (0),
+   startTime   (0.0),
+   endTime     (0.0),
+   data        (NULL),
+   length      (0),
+   lastEpoch   (0)
+{
+}
+
+//------------------------------------------------------------------------------
+// bool IsSupported() const
+//------------------------------------------------------------------------------
+/**
+ * @return true for J2000 segments of a data type evaluated natively
+ */
+//------------------------------------------------------------------------------
+bool SpkSegmentEvaluator::Segment::IsSupported() const
+{
+   if ((frame != J2000_FRAME) || (data == NULL))
+      return false;
+   return (type == 2) || (type == 3) || (type == 9) || (type == 13);
+}
+
+//------------------------------------------------------------------------------
+// bool Evaluate(Real et, Real *state) const
+//------------------------------------------------------------------------------
+/**
+ * Evaluates the segment.
+ *
+ * @param et    TDB seconds past J2000, inside the segment coverage
+ * @param state The state relative to the segment center (output)
+ *
+ * @return false if the segment data is not laid out as its type requires
+ */
+//------------------------------------------------------------------------------
+bool SpkSegmentEvaluator::Segment::Evaluate(Real et, Real *state) const
+{
+   if ((type == 2) || (type == 3))
+   {
+      // Directory: INIT, INTLEN, RSIZE, N
+      if (length < 4)
+         return false;
+      const Real *directory = data + length - 4;
+      Real    init     = directory[0];
+      Real    intlen   = directory[1];
+      Integer rsize    = (Integer)directory[2];
+      Integer nrec     = (Integer)directory[3];
+      Integer ncoef    = (rsize - 2) / (type == 2 ? 3 : 6);
+      if ((intlen <= 0.0) || (nrec < 1) || (ncoef < 1) ||
+          (rsize * nrec > length - 4))
+         return false;
+
+      Integer recno = (Integer)((et - init) / intlen);
+      if (recno >= nrec)
+         recno = nrec - 1;
+      if (recno < 0)
+         recno = 0;
+
+      const Real *record = data + recno * rsize;
+      Real mid    = record[0];
+      Real radius = record[1];
+      if (type == 2)
+      {
+         for (Integer i = 0; i < 3; ++i)
+            ChebyshevWithDerivative(record + 2 + i * ncoef, ncoef, mid, radius,
+                                    et, state[i], state[i+3]);
+      }
+      else
+      {
+         for (Integer i = 0; i < 6; ++i)
+            state[i] = Chebyshev(record + 2 + i * ncoef, ncoef, mid, radius,
+                                 et);
+      }
+      return true;
+   }
+
+   // Types 9 and 13: states, epochs, epoch directory, degree, count
+   if (length < 2)
+      return false;
+   Integer count  = (Integer)data[length - 1];
+   Integer degree = (Integer)data[length - 2];
+   if ((count < 1) || (7 * count + (count - 1) / 100 + 2 != length))
+      return false;
+
+   const Real *states = data;
+   const Real *epochs = data + 6 * count;
+
+   Integer window = (type == 9 ? degree + 1 : (degree + 1) / 2);
+   if (window > count)
+      window = count;
+   if ((window < 1) || (window > MAX_WINDOW))
+      return false;
+
+   if (count == 1)
+   {
+      for (Integer i = 0; i < 6; ++i)
+         state[i] = states[i];
+      return true;
+   }
+
+   // Last epoch before et, limited so that low + 1 is an epoch
+   Integer low = lastEpoch.load(std::memory_order_relaxed);
+   if ((low < 0) || (low > count - 2) ||
+       !((epochs[low] < et) && (et <= epochs[low + 1])))
+   {
+      low = (Integer)(std::lower_bound(epochs, epochs + count, et) - epochs)
+            - 1;
+      if (low > count - 2)
+         low = count - 2;
+      if (low < 0)
+         low = 0;
+      lastEpoch.store(low, std::memory_order_relaxed);
+   }
+
+   Integer first;
+   if (window % 2 == 1)
+   {
+      Integer nearest = ((et - epochs[low]) <= (epochs[low + 1] - et) ?
+                         low : low + 1);
+      first = nearest - (window - 1) / 2;
+   }
+   else
+      first = low - window / 2 + 1;
+   first = std::min(std::max(first, 0), count - window);
+
+   Real values[2 * MAX_WINDOW];
+   Real work[4 * MAX_WINDOW];
+   const Real *stateWindow = states + 6 * first;
+   const Real *epochWindow = epochs + first;
+
+   if (type == 9)
+   {
+      for (Integer i = 0; i < 6; ++i)
+      {
+         for (Integer k = 0; k < window; ++k)
+            values[k] = stateWindow[6 * k + i];
+         state[i] = Lagrange(window, epochWindow, values, work, et);
+      }
+   }
+   else
+   {
+      for (Integer i = 0; i < 3; ++i)
+      {
+         for (Integer k = 0; k < window; ++k)
+         {
+            values[2 * k]     = stateWindow[6 * k + i];
+            values[2 * k + 1] = stateWindow[6 * k + i + 3];
+         }
+         Hermite(window, epochWindow, values, work, et, state[i], state[i+3]);
+      }
+   }
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// TargetSegments()
+//------------------------------------------------------------------------------
+SpkSegmentEvaluator::TargetSegments::TargetSegments() :
+   active      (0)
+{
+}
+
+//------------------------------------------------------------------------------
+// Kernel()
+//------------------------------------------------------------------------------
+SpkSegmentEvaluator::Kernel::Kernel() :
+   fileName    (""),
+   transparent (true),
+   mappedFile  (NULL)
+{
+}
+
+//------------------------------------------------------------------------------
+// ~Kernel()
+//------------------------------------------------------------------------------
+SpkSegmentEvaluator::Kernel::~Kernel()
+{
+   for (UnsignedInt i = 0; i < segments.size(); ++i)
+      delete segments[i];
+   if (mappedFile != NULL)
+      delete mappedFile;
+}
+
+//------------------------------------------------------------------------------
+// SpkSegmentEvaluator()
+//------------------------------------------------------------------------------
+SpkSegmentEvaluator::SpkSegmentEvaluator() :
+   catalog     (new Catalog()),
+   enabled     (true)
+{
+}
+
+//------------------------------------------------------------------------------
+// ~SpkSegmentEvaluator()
+//------------------------------------------------------------------------------
+SpkSegmentEvaluator::~SpkSegmentEvaluator()
+{
+}
+
+//------------------------------------------------------------------------------
+// std::shared_ptr<const Catalog> GetCatalog() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the current catalog.  The caller's reference keeps it, and the
+ * kernel data it points into, alive while kernels are loaded or unloaded.
+ */
+//------------------------------------------------------------------------------
+std::shared_ptr<const SpkSegmentEvaluator::Catalog>
+      SpkSegmentEvaluator::GetCatalog() const
+{
+   std::lock_guard<std::mutex> lock(catalogMutex);
+   return catalog;
+}
+
+//------------------------------------------------------------------------------
+// void RebuildCatalog()
+//------------------------------------------------------------------------------
+/**
+ * Indexes the segments of the registered kernels by target, highest priority
+ * first, and publishes the result.  Called with catalogMutex locked.
+ */
+//------------------------------------------------------------------------------
+void SpkSegmentEvaluator::RebuildCatalog()
+{
+   Catalog *cat = new Catalog();
+   cat->kernels = kernels;
+   cat->opaque = false;
+
+   for (Integer k = (Integer)kernels.size() - 1; k >= 0; --k)
+   {
+      const Kernel &kernel = *kernels[k];
+      if (!kernel.transparent)
+         cat->opaque = true;
+      for (Integer s = (Integer)kernel.segments.size() - 1; s >= 0; --s)
+         cat->targets[kernel.segments[s]->target].segments.push_back(
+               kernel.segments[s]);
+   }
+
+   // A segment with no overlapping higher priority segment is the answer
+   // whenever it covers the requested time
+   for (std::map<Integer, TargetSegments>::iterator i = cat->targets.begin();
+        i != cat->targets.end(); ++i)
+   {
+      std::vector<const Segment*> &segments = i->second.segments;
+      i->second.shadowed.assign(segments.size(), false);
+      for (UnsignedInt s = 0; s < segments.size(); ++s)
+         for (UnsignedInt h = 0; h < s; ++h)
+            if ((segments[h]->startTime <= segments[s]->endTime) &&
+                (segments[s]->startTime <= segments[h]->endTime))
+               i->second.shadowed[s] = true;
+   }
+
+   catalog.reset(cat);
+}
+
+//------------------------------------------------------------------------------
+// const Segment* FindSegment(const Catalog &cat, Integer body, Real et) const
+//------------------------------------------------------------------------------
+/**
+ * Finds the segment CSPICE would use for a body at a time.
+ *
+ * @param cat  The catalog searched
+ * @param body NAIF ID of the body
+ * @param et   TDB seconds past J2000
+ *
+ * @return The highest priority segment covering et, or NULL if there is none
+ */
+//------------------------------------------------------------------------------
+const SpkSegmentEvaluator::Segment* SpkSegmentEvaluator::FindSegment(
+      const Catalog &cat, Integer body, Real et) const
+{
+   std::map<Integer, TargetSegments>::const_iterator i =
+         cat.targets.find(body);
+   if (i == cat.targets.end())
+      return NULL;
+
+   const TargetSegments &entry = i->second;
+   Integer count = (Integer)entry.segments.size();
+
+   Integer active = entry.active.load(std::memory_order_relaxed);
+   if ((active < count) && !entry.shadowed[active])
+   {
+      const Segment *segment = entry.segments[active];
+      if ((segment->startTime <= et) && (et <= segment->endTime))
+         return segment;
+   }
+
+   for (Integer s = 0; s < count; ++s)
+   {
+      const Segment *segment = entry.segments[s];
+      if ((segment->startTime <= et) && (et <= segment->endTime))
+      {
+         entry.active.store(s, std::memory_order_relaxed);
+         return segment;
+      }
+   }
+   return NULL;
+}
+
+//------------------------------------------------------------------------------
+// bool ReadKernel(Kernel &kernel)
+//------------------------------------------------------------------------------
+/**
+ * Identifies a kernel and, for an SPK, reads its segment summaries.
+ *
+ * SPK files stay mapped (or buffered) so that the segments can point into
+ * them; files written on a machine of the other byte order have their
+ * segments copied and swapped once here.
+ *
+ * @param kernel The kernel; fileName is set on input
+ *
+ * @return false if the kernel may hide SPK data from the evaluator
+ */
+//------------------------------------------------------------------------------
+bool SpkSegmentEvaluator::ReadKernel(Kernel &kernel)
+{
+   const char *bytes = NULL;
+   std::size_t size = 0;
+
+   kernel.mappedFile = new MemoryMappedFile();
+   if (kernel.mappedFile->Open(kernel.fileName))
+   {
+      bytes = kernel.mappedFile->GetData();
+      size  = kernel.mappedFile->GetSize();
+   }
+   else
+   {
+      delete kernel.mappedFile;
+      kernel.mappedFile = NULL;
+
+      std::ifstream file(kernel.fileName.c_str(), std::ios::binary);
+      if (!file)
+         return false;
+      kernel.buffer.assign(std::istreambuf_iterator<char>(file),
+                           std::istreambuf_iterator<char>());
+      bytes = (kernel.buffer.empty() ? NULL : &kernel.buffer[0]);
+      size  = kernel.buffer.size();
+   }
+
+   std::string idWord = (size >= 8 ? std::string(bytes, 8) : "");
+   bool isSpk = (idWord == "DAF/SPK ");
+
+   if (!isSpk)
+   {
+      // Nothing to evaluate in this file; release it
+      if (kernel.mappedFile != NULL)
+         kernel.mappedFile->Close();
+      kernel.buffer.clear();
+
+      // Meta-kernels load files the evaluator is not told about
+      if (idWord.compare(0, 6, "KPL/MK") == 0)
+         return false;
+      return (idWord.compare(0, 4, "KPL/") == 0) ||
+             (idWord.compare(0, 4, "DAF/") == 0) ||
+             (idWord.compare(0, 4, "DAS/") == 0);
+   }
+   if (size < DAF_RECORD_SIZE)
+      return false;
+
+   // The summary format fixes ND; use it to detect the file byte order
+   bool swap = false;
+   if (ReadInt(bytes + 8, false) != SPK_ND)
+   {
+      swap = true;
+      if (ReadInt(bytes + 8, true) != SPK_ND)
+         return false;
+   }
+   if (ReadInt(bytes + 12, swap) != SPK_NI)
+      return false;
+
+   const std::size_t summarySize = 8 * (SPK_ND + (SPK_NI + 1) / 2);
+   std::size_t recordCount = size / DAF_RECORD_SIZE;
+
+   Integer recordNumber = ReadInt(bytes + 76, swap);
+   for (std::size_t visited = 0; (recordNumber > 0) && (visited < recordCount);
+        ++visited)
+   {
+      std::size_t offset = (std::size_t)(recordNumber - 1) * DAF_RECORD_SIZE;
+      if (offset + DAF_RECORD_SIZE > size)
+         return false;
+
+      const char *record = bytes + offset;
+      Integer next = (Integer)ReadReal(record, swap);
+      Integer nsum = (Integer)ReadReal(record + 16, swap);
+      if ((nsum < 0) || (24 + nsum * summarySize > DAF_RECORD_SIZE))
+         return false;
+
+      for (Integer i = 0; i < nsum; ++i)
+      {
+         const char *summary = record + 24 + i * summarySize;
+         Integer ic[SPK_NI];
+         for (Integer j = 0; j < SPK_NI; ++j)
+            ic[j] = ReadInt(summary + 8 * SPK_ND + 4 * j, swap);
+
+         Integer begin = ic[4], end = ic[5];
+         if ((begin < 1) || (end < begin) || ((std::size_t)end * 8 > size))
+            return false;
+
+         Segment *segment   = new Segment();
+         segment->target    = ic[0];
+         segment->center    = ic[1];
+         segment->frame     = ic[2];
+         segment->type      = ic[3];
+         segment->startTime = ReadReal(summary, swap);
+         segment->endTime   = ReadReal(summary + 8, swap);
+         segment->length    = end - begin + 1;
+
+         const char *segmentData = bytes + (std::size_t)(begin - 1) * 8;
+         if (swap)
+         {
+            segment->swapped.resize(segment->length);
+            for (Integer j = 0; j < segment->length; ++j)
+               segment->swapped[j] = ReadReal(segmentData + 8 * j, true);
+            segment->data = &segment->swapped[0];
+         }
+         else
+            segment->data = reinterpret_cast<const Real*>(segmentData);
+
+         kernel.segments.push_back(segment);
+      }
+
+      recordNumber = next;
+   }
+
+   #ifdef DEBUG_SPK_SEGMENT_EVALUATOR
+      for (UnsignedInt i = 0; i < kernel.segments.size(); ++i)
+         MessageInterface::ShowMessage("   segment %d: target %d center %d "
+               "frame %d type %d, %.3lf to %.3lf\n", i,
+               kernel.segments[i]->target, kernel.segments[i]->center,
+               kernel.segments[i]->frame, kernel.segments[i]->type,
+               kernel.segments[i]->startTime, kernel.segments[i]->endTime);
+   #endif
+
+   return true;
+}
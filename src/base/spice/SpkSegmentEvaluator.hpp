@@ -0,0 +1,171 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                            SpkSegmentEvaluator
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/16
+//
+/**
+ * Declares the SpkSegmentEvaluator class, a native reader for the SPK data
+ * types 2, 3, 9 and 13.
+ *
+ * SpiceInterface registers every kernel it loads.  SPK files are mapped into
+ * memory once and their segment summaries are indexed by target, in the
+ * priority order CSPICE uses (last loaded file first, last segment in a file
+ * first).  GetState() then computes geometric J2000 states without calling
+ * CSPICE, so it can be used from several threads at once.
+ *
+ * The evaluator only answers requests it can answer exactly as spkgeo_c
+ * would.  It returns false, and the caller falls back to CSPICE, when the
+ * highest priority segment for a body in the chain has another data type or
+ * frame, when a meta-kernel or a kernel of unknown type has been loaded, or
+ * when the chain cannot be closed.
+ */
+//------------------------------------------------------------------------------
+#ifndef SpkSegmentEvaluator_hpp
+#define SpkSegmentEvaluator_hpp
+
+#include "gmatdefs.hpp"
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+
+class MemoryMappedFile;
+
+class GMAT_API SpkSegmentEvaluator
+{
+public:
+   static SpkSegmentEvaluator* Instance();
+
+   bool           AddKernel(const std::string &fileName);
+   bool           RemoveKernel(const std::string &fileName);
+   void           Clear();
+
+   void           SetEnabled(bool enable);
+   bool           IsEnabled() const;
+
+   bool           GetState(Integer target, Integer observer, Real et,
+                           Real *state) const;
+
+   /// One SPK segment
+   struct Segment
+   {
+      Segment();
+
+      /// NAIF ID of the body
+      Integer     target;
+      /// NAIF ID of the center of motion
+      Integer     center;
+      /// SPICE frame code
+      Integer     frame;
+      /// SPK data type
+      Integer     type;
+      /// Coverage, TDB seconds past J2000
+      Real        startTime;
+      Real        endTime;
+      /// The segment data, in native byte order
+      const Real  *data;
+      /// Number of doubles in the segment
+      Integer     length;
+      /// Copy of the data when the file byte order is not native
+      RealArray   swapped;
+      /// Index of the epoch preceding the last request (types 9 and 13)
+      mutable std::atomic<Integer>
+                  lastEpoch;
+
+      bool        IsSupported() const;
+      bool        Evaluate(Real et, Real *state) const;
+   };
+
+protected:
+   /// The segments of one body, highest priority first
+   struct TargetSegments
+   {
+      TargetSegments();
+
+      std::vector<const Segment*>
+                  segments;
+      /// Set for segments that overlap a higher priority segment
+      std::vector<bool>
+                  shadowed;
+      /// Index of the segment used last
+      mutable std::atomic<Integer>
+                  active;
+   };
+
+   /// One registered kernel
+   struct Kernel
+   {
+      Kernel();
+      ~Kernel();
+
+      std::string fileName;
+      /// false for kernels the evaluator cannot see into (meta-kernels,
+      /// unknown formats)
+      bool        transparent;
+      MemoryMappedFile
+                  *mappedFile;
+      /// File contents when mapping is not available
+      std::vector<char>
+                  buffer;
+      std::vector<Segment*>
+                  segments;
+   };
+
+   /// The segment index built from the loaded kernels
+   struct Catalog
+   {
+      /// Keeps the kernels alive while a reader uses the catalog
+      std::vector<std::shared_ptr<Kernel> >
+                  kernels;
+      std::map<Integer, TargetSegments>
+                  targets;
+      bool        opaque;
+   };
+
+   /// Loaded kernels, in load order
+   std::vector<std::shared_ptr<Kernel> >
+                  kernels;
+   /// The current catalog; readers take a reference under catalogMutex
+   std::shared_ptr<const Catalog>
+                  catalog;
+   /// Guards kernels and the catalog pointer
+   mutable std::mutex
+                  catalogMutex;
+   std::atomic<bool>
+                  enabled;
+
+   SpkSegmentEvaluator();
+   ~SpkSegmentEvaluator();
+
+   std::shared_ptr<const Catalog>
+                  GetCatalog() const;
+   void           RebuildCatalog();
+   const Segment* FindSegment(const Catalog &cat, Integer body,
+                              Real et) const;
+
+   static bool    ReadKernel(Kernel &kernel);
+
+private:
+   SpkSegmentEvaluator(const SpkSegmentEvaluator &sse);
+   SpkSegmentEvaluator& operator=(const SpkSegmentEvaluator &sse);
+};
+
+#endif // SpkSegmentEvaluator_hpp
@@ -30,6 +30,7 @@
 //------------------------------------------------------------------------------
 
 #include "StopCondition.hpp"
+#include "ParameterIndex.hpp"
 #include "StopConditionException.hpp"
 #include "NotAKnotInterpolator.hpp"
 #include "RealUtilities.hpp"           // for Abs()
@@ -2133,11 +2134,11 @@ Integer StopCondition::GetParameterID(const std::string &str) const
       ("StopCondition::GetParameterID() str = %s\n", str.c_str());
    #endif
    
-   for (int i=GmatBaseParamCount; i<StopConditionParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatBaseParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("StopCondition", PARAMETER_TEXT,
+         GmatBaseParamCount, StopConditionParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
    
    return GmatBase::GetParameterID(str);
 }
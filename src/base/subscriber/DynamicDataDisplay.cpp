@@ -28,6 +28,7 @@
 */
 //------------------------------------------------------------------------------
 #include "DynamicDataDisplay.hpp"
+#include "ParameterIndex.hpp"
 
 const std::string
 DynamicDataDisplay::PARAMETER_TEXT[DynamicDataDisplayParamCount - SubscriberParamCount] =
@@ -442,11 +443,11 @@ bool DynamicDataDisplay::RenameRefObject(const UnsignedInt type,
 //------------------------------------------------------------------------------
 Integer DynamicDataDisplay::GetParameterID(const std::string &str) const
 {
-   for (Integer i = SubscriberParamCount; i < DynamicDataDisplayParamCount; ++i)
-   {
-      if (str == PARAMETER_TEXT[i - SubscriberParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("DynamicDataDisplay",
+         PARAMETER_TEXT, SubscriberParamCount, DynamicDataDisplayParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
 
    return Subscriber::GetParameterID(str);
 }
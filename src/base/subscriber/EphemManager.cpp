@@ -33,6 +33,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <sstream>
+#include <limits>
 #include "EphemManager.hpp"
 #include "GmatBase.hpp"
 #include "CoordinateSystem.hpp"
@@ -721,6 +722,62 @@ bool EphemManager::GetContactIntervals(const std::string &observerID,
                                        Integer           &numIntervals,
                                        RealArray         &starts,
                                        RealArray         &ends)
+{
+   RealArray noSearchStarts, noSearchEnds;
+   return GetContactIntervals(observerID, minElevation, obsFrameName,
+         occultingBodyNames, abCorrection, s, e, useEntireIntvl, useLightTime,
+         transmit, stepSize, noSearchStarts, noSearchEnds, numIntervals,
+         starts, ends);
+}
+
+//------------------------------------------------------------------------------
+//    bool    GetContactIntervals(const std::string &observerID,
+//                                Real              minElevation,
+//                                const std::string &obsFrameName,
+//                                StringArray       &occultingBodyNames,
+//                                const std::string &abCorrection,
+//                                Real              s,
+//                                Real              e,
+//                                bool              useEntireIntvl,
+//                                bool              useLightTime,
+//                                bool              transmit,
+//                                Real              stepSize,
+//                                const RealArray   &searchStarts,
+//                                const RealArray   &searchEnds,
+//                                Integer           &numIntervals,
+//                                RealArray         &starts,
+//                                RealArray         &ends)
+//------------------------------------------------------------------------------
+/**
+ * This method determines the contact intervals, searching only inside the
+ * supplied candidate intervals.
+ *
+ * The candidate intervals (A1Mjd) are typically produced by a coarse
+ * visibility screen; the search window is the intersection of the coverage
+ * window and the candidates.  If searchStarts is empty, the full coverage
+ * window is searched.  The remaining parameters are those of the overload
+ * above.
+ *
+ * @param searchStarts       start times of the candidate intervals
+ * @param searchEnds         end times of the candidate intervals
+ */
+//------------------------------------------------------------------------------
+bool EphemManager::GetContactIntervals(const std::string &observerID,
+                                       Real              minElevation,
+                                       const std::string &obsFrameName,
+                                       StringArray       &occultingBodyNames,
+                                       const std::string &abCorrection,
+                                       Real              s,
+                                       Real              e,
+                                       bool              useEntireIntvl,
+                                       bool              useLightTime,
+                                       bool              transmit,
+                                       Real              stepSize,
+                                       const RealArray   &searchStarts,
+                                       const RealArray   &searchEnds,
+                                       Integer           &numIntervals,
+                                       RealArray         &starts,
+                                       RealArray         &ends)
 {
    Spacecraft  *theSc       = (Spacecraft*) theObj;
 
@@ -766,6 +823,47 @@ bool EphemManager::GetContactIntervals(const std::string &observerID,
                              true, useLightTime,
                              transmit, stepSize, obsID);
 
+   // Restrict the search to the candidate intervals, if there are any
+   if (!searchStarts.empty())
+   {
+      if (!spice)
+         spice = new SpiceInterface();
+
+      SPICEDOUBLE_CELL(candidates, 200000);
+      scard_c(0, &candidates);
+      SPICEDOUBLE_CELL(restricted, 200000);
+      scard_c(0, &restricted);
+
+      for (UnsignedInt ii = 0; ii < searchStarts.size(); ii++)
+         wninsd_c(spice->A1ToSpiceTime(searchStarts[ii]),
+                  spice->A1ToSpiceTime(searchEnds[ii]), &candidates);
+      if (failed_c())
+      {
+         ConstSpiceChar option[] = "LONG";
+         SpiceInt       numChar  = MAX_LONG_MESSAGE_VALUE;
+         SpiceChar      err[MAX_LONG_MESSAGE_VALUE];
+         getmsg_c(option, numChar, err);
+         std::string errStr(err);
+         std::string errmsg = "Error building the contact search window!!!  ";
+         errmsg += "Message received from CSPICE is: ";
+         errmsg += errStr + "\n";
+         reset_c();
+         throw SubscriberException(errmsg);
+      }
+
+      wnintd_c(&window, &candidates, &restricted);
+      copy_c(&restricted, &window);
+
+      scard_c(0, &candidates);
+      scard_c(0, &restricted);
+
+      #ifdef DEBUG_CONTACT
+         MessageInterface::ShowMessage("   search restricted to %d of %d "
+               "candidate intervals\n", (Integer) wncard_c(&window),
+               (Integer) searchStarts.size());
+      #endif
+   }
+
    std::string    theCrdSys   = "LATITUDINAL";
    std::string    theCoord    = "LATITUDE";
    std::string    theRelate   = ">";
@@ -966,6 +1064,164 @@ bool EphemManager::GetContactIntervals(const std::string &observerID,
 
 
 
+//------------------------------------------------------------------------------
+// bool GetBodyFixedPositions(const std::string &bodyName, Real s, Real e,
+//                            Real stepSize, RealArray &epochs,
+//                            RealArray &positions)
+//------------------------------------------------------------------------------
+/**
+ * Samples the geometric position of the object relative to a body, in the
+ * body's fixed frame, at a fixed step.
+ *
+ * This is the data for the coarse visibility screens of the contact
+ * locator.  Epochs where the loaded kernels have no data are returned with
+ * NaN positions so that callers can treat them conservatively.
+ *
+ * @param bodyName   name of the central body
+ * @param s          start time (A1Mjd)
+ * @param e          end time (A1Mjd)
+ * @param stepSize   step between samples, in seconds
+ * @param epochs     sample epochs, A1Mjd (output)
+ * @param positions  x, y, z of each sample, km (output)
+ *
+ * @return true if the positions were computed
+ */
+//------------------------------------------------------------------------------
+bool EphemManager::GetBodyFixedPositions(const std::string &bodyName,
+                                         Real s, Real e, Real stepSize,
+                                         RealArray &epochs,
+                                         RealArray &positions)
+{
+   epochs.clear();
+   positions.clear();
+
+   #ifndef __USE_SPICE__
+      Spacecraft *theSc = (Spacecraft*) theObj;
+      std::string errmsg = "ERROR - cannot compute positions for spacecraft ";
+      errmsg += theSc->GetName() + " without SPICE included in build!\n";
+      throw SubscriberException(errmsg);
+   #else
+      CelestialBody *body = solarSys->GetBody(bodyName);
+      if ((body == NULL) || (stepSize <= 0.0) || (e < s))
+         return false;
+
+      if (!spice)
+         spice = new SpiceInterface();
+
+      std::string theTarget = GmatStringUtil::ToString(
+            ((Spacecraft*) theObj)->GetIntegerParameter("NAIFId"));
+      std::string theCenter = GmatStringUtil::Trim(GmatStringUtil::ToString(
+            body->GetIntegerParameter(body->GetParameterID("NAIFId"))));
+      std::string theFrame  = body->GetStringParameter(
+            body->GetParameterID("SpiceFrameId"));
+
+      ConstSpiceChar *target = theTarget.c_str();
+      ConstSpiceChar *center = theCenter.c_str();
+      ConstSpiceChar *frame  = theFrame.c_str();
+      SpiceDouble     pos[3];
+      SpiceDouble     lt;
+
+      Integer count = (Integer)((e - s) * GmatTimeConstants::SECS_PER_DAY /
+                                stepSize) + 2;
+      epochs.reserve(count);
+      positions.reserve(3 * count);
+
+      SpiceDouble etStart = spice->A1ToSpiceTime(s);
+      SpiceDouble etEnd   = spice->A1ToSpiceTime(e);
+      for (Integer ii = 0; ii < count; ii++)
+      {
+         SpiceDouble et = etStart + ii * stepSize;
+         if (et > etEnd)
+            et = etEnd;
+
+         spkpos_c(target, et, frame, "NONE", center, pos, &lt);
+         if (failed_c())
+         {
+            // No data at this epoch; flag the sample rather than fail
+            reset_c();
+            pos[0] = pos[1] = pos[2] = std::numeric_limits<Real>::quiet_NaN();
+         }
+
+         epochs.push_back(spice->SpiceTimeToA1(et));
+         positions.push_back(pos[0]);
+         positions.push_back(pos[1]);
+         positions.push_back(pos[2]);
+
+         if (et >= etEnd)
+            break;
+      }
+
+      return true;
+   #endif
+}
+
+//------------------------------------------------------------------------------
+// bool GetObserverGeometry(const std::string &observerID,
+//                          const std::string &obsFrameName,
+//                          const std::string &bodyName, Real epoch,
+//                          Rvector3 &location, Rvector3 &zenith)
+//------------------------------------------------------------------------------
+/**
+ * Returns the location of an observer fixed to a body, and the +Z axis of
+ * its topocentric frame, both in the body's fixed frame.
+ *
+ * Elevation measured from these agrees with the latitude in the observer's
+ * frame used by GetContactIntervals().
+ *
+ * @param observerID   NAIF ID of the observer
+ * @param obsFrameName SPICE frame name of the observer's topocentric frame
+ * @param bodyName     name of the body the observer is fixed to
+ * @param epoch        epoch of the evaluation (A1Mjd)
+ * @param location     observer location, km (output)
+ * @param zenith       unit +Z axis of the observer frame (output)
+ *
+ * @return true if the geometry was computed
+ */
+//------------------------------------------------------------------------------
+bool EphemManager::GetObserverGeometry(const std::string &observerID,
+                                       const std::string &obsFrameName,
+                                       const std::string &bodyName,
+                                       Real epoch, Rvector3 &location,
+                                       Rvector3 &zenith)
+{
+   #ifndef __USE_SPICE__
+      return false;
+   #else
+      CelestialBody *body = solarSys->GetBody(bodyName);
+      if (body == NULL)
+         return false;
+
+      if (!spice)
+         spice = new SpiceInterface();
+
+      std::string theCenter = GmatStringUtil::Trim(GmatStringUtil::ToString(
+            body->GetIntegerParameter(body->GetParameterID("NAIFId"))));
+      std::string theFrame  = body->GetStringParameter(
+            body->GetParameterID("SpiceFrameId"));
+
+      SpiceDouble et = spice->A1ToSpiceTime(epoch);
+      SpiceDouble pos[3];
+      SpiceDouble lt;
+      SpiceDouble rot[3][3];
+
+      spkpos_c(observerID.c_str(), et, theFrame.c_str(), "NONE",
+               theCenter.c_str(), pos, &lt);
+      if (!failed_c())
+         pxform_c(obsFrameName.c_str(), theFrame.c_str(), et, rot);
+      if (failed_c())
+      {
+         reset_c();
+         return false;
+      }
+
+      location.Set(pos[0], pos[1], pos[2]);
+      // Third column of the rotation is the observer +Z axis
+      zenith.Set(rot[0][2], rot[1][2], rot[2][2]);
+      return true;
+   #endif
+}
+
+
 bool EphemManager::GetCoverage(Real s, Real e,
                                bool useEntireIntvl,
                                bool includeAll,
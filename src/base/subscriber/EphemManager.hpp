@@ -110,6 +110,34 @@ public:
                                             RealArray         &starts,
                                             RealArray         &ends);
 
+   bool                 GetContactIntervals(const std::string &observerID,
+                                            Real              minElevation,
+                                            const std::string &obsFrameName,
+                                            StringArray       &occultingBodyNames,
+                                            const std::string &abCorrection,
+                                            Real              s,
+                                            Real              e,
+                                            bool              useEntireIntvl,
+                                            bool              useLightTime,
+                                            bool              transmit,
+                                            Real              stepSize,
+                                            const RealArray   &searchStarts,
+                                            const RealArray   &searchEnds,
+                                            Integer           &numIntervals,
+                                            RealArray         &starts,
+                                            RealArray         &ends);
+
+   /// Sampled positions and observer geometry for coarse visibility screens
+   bool                 GetBodyFixedPositions(const std::string &bodyName,
+                                              Real s, Real e, Real stepSize,
+                                              RealArray &epochs,
+                                              RealArray &positions);
+   bool                 GetObserverGeometry(const std::string &observerID,
+                                            const std::string &obsFrameName,
+                                            const std::string &bodyName,
+                                            Real epoch, Rvector3 &location,
+                                            Rvector3 &zenith);
+
    bool                 GetCoverage(Real s, Real e,
                                     bool useEntireIntvl,
                                     bool includeAll,
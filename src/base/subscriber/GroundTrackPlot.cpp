@@ -30,6 +30,7 @@
 //------------------------------------------------------------------------------
 
 #include "GroundTrackPlot.hpp"
+#include "ParameterIndex.hpp"
 #include "PlotInterface.hpp"       // for UpdateGlPlot()
 #include "SubscriberException.hpp" // for SubscriberException()
 #include "FileManager.hpp"         // for GetFullPathname()
@@ -586,11 +587,11 @@ std::string GroundTrackPlot::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer GroundTrackPlot::GetParameterID(const std::string &str) const
 {
-   for (int i=OrbitPlotParamCount; i<GroundTrackPlotParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - OrbitPlotParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("GroundTrackPlot", PARAMETER_TEXT,
+         OrbitPlotParamCount, GroundTrackPlotParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
    
    return OrbitPlot::GetParameterID(str);
 }
@@ -30,6 +30,7 @@
 //------------------------------------------------------------------------------
 #include <iomanip>
 #include "MessageWindow.hpp"
+#include "ParameterIndex.hpp"
 #include "MessageInterface.hpp" // for ShowMessage()
 
 //---------------------------------
@@ -160,11 +161,11 @@ std::string MessageWindow::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer MessageWindow::GetParameterID(const std::string &str) const
 {
-   for (int i=SubscriberParamCount; i<MessageWindowParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - SubscriberParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("MessageWindow", PARAMETER_TEXT,
+         SubscriberParamCount, MessageWindowParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
    
    return Subscriber::GetParameterID(str);
 }
@@ -30,6 +30,7 @@
 //------------------------------------------------------------------------------
 
 #include "OrbitPlot.hpp"
+#include "ParameterIndex.hpp"
 #include "PlotInterface.hpp"       // for UpdateGlPlot()
 #include "SubscriberException.hpp" // for SubscriberException()
 #include "MessageInterface.hpp"    // for ShowMessage()
@@ -814,11 +815,11 @@ Integer OrbitPlot::GetParameterID(const std::string &str) const
    if (str == "OrbitColor" || str == "TargetColor")
       return Gmat::PARAMETER_REMOVED;
    
-   for (int i=SubscriberParamCount; i<OrbitPlotParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - SubscriberParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("OrbitPlot", PARAMETER_TEXT,
+         SubscriberParamCount, OrbitPlotParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
    
    return Subscriber::GetParameterID(str);
 }
@@ -30,6 +30,7 @@
 //------------------------------------------------------------------------------
 
 #include "OrbitView.hpp"
+#include "ParameterIndex.hpp"
 #include "PlotInterface.hpp"       // for UpdateGlPlot()
 #include "ColorTypes.hpp"          // for namespace GmatColor::
 #include "SubscriberException.hpp" // for SubscriberException()
@@ -747,11 +748,11 @@ Integer OrbitView::GetParameterID(const std::string &str) const
        str == "MinFOV" || str == "MaxFOV" || str == "InitialFOV")
       return Gmat::PARAMETER_REMOVED;
    
-   for (int i=OrbitPlotParamCount; i<OrbitViewParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - OrbitPlotParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("OrbitView", PARAMETER_TEXT,
+         OrbitPlotParamCount, OrbitViewParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
    
    return OrbitPlot::GetParameterID(str);
 }
@@ -31,6 +31,7 @@
 //------------------------------------------------------------------------------
 
 #include "OwnedPlot.hpp"
+#include "ParameterIndex.hpp"
 #include "PlotInterface.hpp"     // for XY plot
 #include "SubscriberException.hpp"
 #include "MessageInterface.hpp"  // for ShowMessage()
@@ -553,11 +554,11 @@ std::string OwnedPlot::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer OwnedPlot::GetParameterID(const std::string &str) const
 {
-   for (int i=GmatBaseParamCount; i<OwnedPlotParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatBaseParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("OwnedPlot", PARAMETER_TEXT,
+         GmatBaseParamCount, OwnedPlotParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
    
    return Subscriber::GetParameterID(str);
 }
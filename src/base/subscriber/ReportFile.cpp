@@ -32,9 +32,17 @@
 //------------------------------------------------------------------------------
 
 #include <stdio.h>
+#include <algorithm>
 #include <iomanip>
 #include <sstream>
+#include <cstring>
+#if defined(__has_include)
+   #if __has_include(<charconv>)
+      #include <charconv>
+   #endif
+#endif
 #include "ReportFile.hpp"
+#include "ParameterIndex.hpp"
 #include "MessageInterface.hpp"
 #include "Publisher.hpp"           // for Instance()
 #include "FileManager.hpp"         // for GetPathname()
@@ -57,6 +65,7 @@
 //#define DEBUG_REAL_DATA
 //#define DEBUG_WRITE_HEADERS
 //#define DEBUG_FILE_PATH
+//#define DEBUG_BINARY_OUTPUT
 
 //---------------------------------
 // static data
@@ -75,6 +84,8 @@ ReportFile::PARAMETER_TEXT[ReportFileParamCount - SubscriberParamCount] =
    "Delimiter",
    "ColumnWidth",
    "WriteReport",
+   "OutputFormat",
+   "BufferSize",
 };
 
 const Gmat::ParameterType
@@ -91,8 +102,42 @@ ReportFile::PARAMETER_TYPE[ReportFileParamCount - SubscriberParamCount] =
    Gmat::STRING_TYPE,        //"Delimiter",
    Gmat::INTEGER_TYPE,       //"ColumnWidth",
    Gmat::BOOLEAN_TYPE,       //"WriteReport",
+   Gmat::ENUMERATION_TYPE,   //"OutputFormat",
+   Gmat::INTEGER_TYPE,       //"BufferSize",
 };
 
+StringArray ReportFile::outputFormatOptions;
+
+/// Identifies binary report files; followed by the format version
+static const char BINARY_REPORT_MAGIC[8] = {'G','M','A','T','R','P','T','B'};
+static const UnsignedInt BINARY_REPORT_VERSION = 1;
+
+
+//------------------------------------------------------------------------------
+// void AppendLittleEndian(std::vector<char> &buffer, const void *value,
+//                         std::size_t size)
+//------------------------------------------------------------------------------
+/**
+ * Appends the bytes of a value to a buffer, least significant byte first.
+ *
+ * @param  buffer  The buffer receiving the bytes
+ * @param  value   The value
+ * @param  size    The size of the value in bytes
+ */
+//------------------------------------------------------------------------------
+static void AppendLittleEndian(std::vector<char> &buffer, const void *value,
+                               std::size_t size)
+{
+   const UnsignedInt one = 1;
+   const char *bytes = (const char*)value;
+   
+   if (*((const char*)&one) == 1)
+      buffer.insert(buffer.end(), bytes, bytes + size);
+   else
+      for (std::size_t i = size; i > 0; --i)
+         buffer.push_back(bytes[i-1]);
+}
+
 
 //------------------------------------------------------------------------------
 // ReportFile(const std::string &type, const std::string &name,
@@ -120,6 +165,10 @@ ReportFile::ReportFile(const std::string &type, const std::string &name,
    writeFinalSolverData (false),
    finalSolverDataPosition (0),
    delimiter       (' '),
+   outputFormat    ("Text"),
+   binaryOutput    (false),
+   binaryHeaderWritten (false),
+   bufferSize      (0),
    lastUsedProvider(-1),
    mLastReportTime (0.0),
    usedByReport    (false),
@@ -139,6 +188,12 @@ ReportFile::ReportFile(const std::string &type, const std::string &name,
    initial = true;
    initialFromReport = true;
    
+   if (outputFormatOptions.empty())
+   {
+      outputFormatOptions.push_back("Text");
+      outputFormatOptions.push_back("Binary");
+   }
+   
    // If fileName is blank, give default name
    if (fileName == "")
    {
@@ -197,6 +252,10 @@ ReportFile::ReportFile(const ReportFile &rf) :
    writeFinalSolverData (rf.writeFinalSolverData),
    finalSolverDataPosition (0),
    delimiter       (rf.delimiter),
+   outputFormat    (rf.outputFormat),
+   binaryOutput    (rf.binaryOutput),
+   binaryHeaderWritten (false),
+   bufferSize      (rf.bufferSize),
    lastUsedProvider(-1),
    mLastReportTime (rf.mLastReportTime),
    usedByReport    (rf.usedByReport),
@@ -248,6 +307,9 @@ ReportFile& ReportFile::operator=(const ReportFile& rf)
    writeFinalSolverData = rf.writeFinalSolverData;
    finalSolverDataPosition = 0;
    delimiter = rf.delimiter;
+   outputFormat = rf.outputFormat;
+   binaryOutput = rf.binaryOutput;
+   bufferSize = rf.bufferSize;
    mParams = rf.mParams; 
    mNumParams = rf.mNumParams;
    mParamNames = rf.mParamNames;
@@ -451,7 +513,7 @@ bool ReportFile::WriteData(WrapperArray wrapperArray, bool parsable)
                if (IsNotANumber(rval))
                   output[i].push_back("NaN");
                else
-                  output[i].push_back(GmatStringUtil::ToString(rval, precision, zeroFill));
+                  output[i].push_back(FormatReal(rval));
             }
    #ifdef DEBUG_REAL_DATA
             MessageInterface::ShowMessage
@@ -466,7 +528,7 @@ bool ReportFile::WriteData(WrapperArray wrapperArray, bool parsable)
             if (IsNotANumber(rval))
                output[i].push_back("NaN");
             else
-               output[i].push_back(GmatStringUtil::ToString(rval, precision, zeroFill));
+               output[i].push_back(FormatReal(rval));
             #ifdef DEBUG_REAL_DATA
             MessageInterface::ShowMessage
                ("   resulting string for value of %12.10f = %s\n", rval, output[i].back().c_str());
@@ -488,7 +550,7 @@ bool ReportFile::WriteData(WrapperArray wrapperArray, bool parsable)
                   if (IsNotANumber(rval))
                      output[i].push_back("NaN");
                   else
-                     output[i].push_back(GmatStringUtil::ToString(rval, precision, zeroFill));
+                     output[i].push_back(FormatReal(rval));
                   #ifdef DEBUG_REAL_DATA
                   MessageInterface::ShowMessage
                      ("   resulting string for value of %12.10f = %s\n", rval, output[i].back().c_str());
@@ -623,10 +685,14 @@ bool ReportFile::WriteData(WrapperArray wrapperArray, bool parsable)
                dstream << delimiter;
          }
       }
-      dstream << std::endl;
+      // Rows are buffered; the stream is flushed at the end of each data
+      // block, when the run ends, and when the file is closed
+      dstream << '\n';
       
-      // Save current data position for use in writing final solver solution
-      if (!writeFinalSolverData)
+      // Save current data position for use in writing final solver solution.
+      // Only SolverIterations = None rewrites data, so other settings skip the
+      // position query.
+      if (!writeFinalSolverData && (mSolverIterOption == SI_NONE))
       {
          finalSolverDataPosition = dstream.tellp();
          #if DBGLVL_WRITE_DATA > 0
@@ -822,6 +888,10 @@ bool ReportFile::TakeAction(const std::string &action,
    else if (action == "ActivateForReport")
    {
       calledByReport = ((actionData == "On") ? true : false);
+      if (calledByReport && binaryOutput)
+         throw SubscriberException("The ReportFile named \"" + GetName() +
+               "\" uses Binary output, so the Report and Write commands "
+               "cannot write to it");
       if (calledByReport)
       {
          if (!dstream.is_open())
@@ -863,6 +933,11 @@ bool ReportFile::TakeAction(const std::string &action,
       if (dstream.is_open())
          dstream.close();
    }
+   else if (action == "Flush")
+   {
+      FlushReportFile();
+      return true;
+   }
    
    #ifdef DEBUG_REPORTFILE_ACTION
    MessageInterface::ShowMessage
@@ -945,11 +1020,11 @@ std::string ReportFile::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer ReportFile::GetParameterID(const std::string &str) const
 {
-   for (Integer i = SubscriberParamCount; i < ReportFileParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - SubscriberParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("ReportFile", PARAMETER_TEXT,
+         SubscriberParamCount, ReportFileParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
    
    return Subscriber::GetParameterID(str);
 }
@@ -996,6 +1071,12 @@ bool ReportFile::IsParameterReadOnly(const Integer id) const
    if (id == FULLPATH_FILENAME)
       return true;
    
+   // Only write the output options when they differ from the defaults
+   if ((id == OUTPUT_FORMAT) && !binaryOutput)
+      return true;
+   if ((id == BUFFER_SIZE) && (bufferSize == 0))
+      return true;
+   
    return Subscriber::IsParameterReadOnly(id);
 }
 
@@ -1017,7 +1098,7 @@ bool ReportFile::IsParameterCommandModeSettable(const Integer id) const
       return true;
 
    // Turn these off
-   if (id == ADD)
+   if ((id == ADD) || (id == OUTPUT_FORMAT) || (id == BUFFER_SIZE))
       return false;
 
    // Turn on the rest that are ReportFile specific (FILENAME, PRECISION, ADD,
@@ -1125,6 +1206,8 @@ Integer ReportFile::GetIntegerParameter(const Integer id) const
       return precision;
    else if (id == COL_WIDTH)
       return columnWidth;
+   else if (id == BUFFER_SIZE)
+      return bufferSize;
    return Subscriber::GetIntegerParameter(id);
 }
 
@@ -1168,6 +1251,22 @@ Integer ReportFile::SetIntegerParameter(const Integer id, const Integer value)
       columnWidth = value;
       return columnWidth;
    }
+   else if (id == BUFFER_SIZE)
+   {
+      if (value < 0)
+      {
+         SubscriberException se;
+         se.SetDetails(errorMessageFormat.c_str(),
+                       GmatStringUtil::ToString(value, 1).c_str(),
+                       GetParameterText(BUFFER_SIZE).c_str(),
+                       "Integer Number >= 0 ");
+         throw se;
+      }
+      
+      // Takes effect the next time the file is opened
+      bufferSize = value;
+      return bufferSize;
+   }
    
    return Subscriber::SetIntegerParameter(id, value);
 }
@@ -1190,6 +1289,10 @@ std::string ReportFile::GetStringParameter(const Integer id) const
    {
       return std::string(1,delimiter);
    }
+   else if (id == OUTPUT_FORMAT)
+   {
+      return outputFormat;
+   }
    
    return Subscriber::GetStringParameter(id);
 }
@@ -1246,12 +1349,9 @@ bool ReportFile::SetStringParameter(const Integer id, const std::string &value)
          throw SubscriberException(lastErrorMessage);
       }
       
-      // Close the stream if it is open
+      // Reopen the stream under the new name if it is open
       if (dstream.is_open())
-      {
-         dstream.close();
-         dstream.open(fullPathFileName.c_str());
-      }
+         OpenReportFile();
       
       return true;
    }
@@ -1277,6 +1377,21 @@ bool ReportFile::SetStringParameter(const Integer id, const std::string &value)
 		delimiter = ' ';
       return true;
    }
+   else if (id == OUTPUT_FORMAT)
+   {
+      if ((value != "Text") && (value != "Binary"))
+      {
+         SubscriberException se;
+         se.SetDetails(errorMessageFormat.c_str(), value.c_str(),
+                       GetParameterText(OUTPUT_FORMAT).c_str(),
+                       "Text, Binary");
+         throw se;
+      }
+      
+      outputFormat = value;
+      binaryOutput = (value == "Binary");
+      return true;
+   }
    
    return Subscriber::SetStringParameter(id, value);
 }
@@ -1412,6 +1527,27 @@ bool ReportFile::SetOnOffParameter(const std::string &label,
 }
 
 
+//------------------------------------------------------------------------------
+// const StringArray& GetPropertyEnumStrings(const Integer id) const
+//------------------------------------------------------------------------------
+const StringArray& ReportFile::GetPropertyEnumStrings(const Integer id) const
+{
+   if (id == OUTPUT_FORMAT)
+      return outputFormatOptions;
+   
+   return Subscriber::GetPropertyEnumStrings(id);
+}
+
+
+//------------------------------------------------------------------------------
+// const StringArray& GetPropertyEnumStrings(const std::string &label) const
+//------------------------------------------------------------------------------
+const StringArray& ReportFile::GetPropertyEnumStrings(const std::string &label) const
+{
+   return GetPropertyEnumStrings(GetParameterID(label));
+}
+
+
 //------------------------------------------------------------------------------
 // virtual GmatBase* GetRefObject(const UnsignedInt type,
 //                                const std::string &name)
@@ -1593,7 +1729,19 @@ bool ReportFile::OpenReportFile()
    if (dstream.is_open())
       dstream.close();
    
-   dstream.open(fullPathFileName.c_str());
+   // The buffer has to be installed before the file is opened
+   if (bufferSize > 0)
+   {
+      streamBuffer.resize(bufferSize);
+      dstream.rdbuf()->pubsetbuf(&streamBuffer[0], bufferSize);
+   }
+   
+   binaryHeaderWritten = false;
+   if (binaryOutput)
+      dstream.open(fullPathFileName.c_str(),
+                   std::ios_base::out | std::ios_base::binary);
+   else
+      dstream.open(fullPathFileName.c_str());
    if (!dstream.is_open())
    {
       #ifdef DEBUG_REPORTFILE_OPEN
@@ -1645,7 +1793,12 @@ void ReportFile::WriteHeaders()
        mNumParams, columnWidth);
    #endif
    
-   if (writeHeaders || headerReset)
+   if (binaryOutput)
+   {
+      // The binary header is part of the format, so it is always written
+      WriteBinaryHeader();
+   }
+   else if (writeHeaders || headerReset)
    {
       if (!dstream.is_open())
          return;
@@ -1908,9 +2061,12 @@ bool ReportFile::Distribute(const Real * dat, Integer len)
          writeData = true;
    }
    
-   // Reset writeFinalSolverData
+   // Reset writeFinalSolverData, and write out what is buffered
    if (isEndOfReceive)
+   {
       writeFinalSolverData = false;
+      FlushReportFile();
+   }
    
    
    #if DBGLVL_REPORTFILE_DATA > 0
@@ -1996,7 +2152,10 @@ bool ReportFile::Distribute(const Real * dat, Integer len)
       
       // Write to report file using ReportFile::WriateData().
       // This method takes ElementWrapper array to write data to stream
-      WriteData(yParamWrappers);
+      if (binaryOutput)
+         WriteBinaryData(yParamWrappers);
+      else
+         WriteData(yParamWrappers);
       mLastReportTime = dat[0];
       
       if (isEndOfRun)  // close file
@@ -2004,6 +2163,8 @@ bool ReportFile::Distribute(const Real * dat, Integer len)
          if (dstream.is_open())
             dstream.close();
       }
+      else if (isEndOfReceive || isEndOfDataBlock)
+         FlushReportFile();
       
       #if DBGLVL_REPORTFILE_DATA > 1
       MessageInterface::ShowMessage
@@ -2015,6 +2176,176 @@ bool ReportFile::Distribute(const Real * dat, Integer len)
    return true;
 }
 
+//------------------------------------------------------------------------------
+// void WriteBinaryHeader()
+//------------------------------------------------------------------------------
+/**
+ * Writes the header of a binary report file.
+ *
+ * All values are little-endian.  The header is
+ *
+ *    8 bytes    "GMATRPTB"
+ *    uint32     format version (1)
+ *    uint32     number of columns, N
+ *    uint64     byte offset of the first row (a multiple of 8)
+ *    N times:   uint32 name length, followed by the name characters
+ *
+ * padded with zeros to the first row.  Each row is N IEEE-754 doubles, so the
+ * data can be memory mapped as an array once the offset is known.
+ */
+//------------------------------------------------------------------------------
+void ReportFile::WriteBinaryHeader()
+{
+   if (!dstream.is_open() || binaryHeaderWritten)
+      return;
+   
+   std::vector<char> header(BINARY_REPORT_MAGIC, BINARY_REPORT_MAGIC + 8);
+   UnsignedInt version = BINARY_REPORT_VERSION;
+   UnsignedInt columns = mNumParams;
+   AppendLittleEndian(header, &version, sizeof(version));
+   AppendLittleEndian(header, &columns, sizeof(columns));
+   
+   // Offset to the data is filled in once the names are in place
+   std::size_t offsetLocation = header.size();
+   header.resize(header.size() + 8, 0);
+   
+   for (Integer i = 0; i < mNumParams; ++i)
+   {
+      UnsignedInt length = mParamNames[i].length();
+      AppendLittleEndian(header, &length, sizeof(length));
+      header.insert(header.end(), mParamNames[i].begin(), mParamNames[i].end());
+   }
+   
+   header.resize((header.size() + 7) / 8 * 8, 0);
+   
+   std::vector<char> offset;
+   unsigned long long dataOffset = header.size();
+   AppendLittleEndian(offset, &dataOffset, sizeof(dataOffset));
+   std::copy(offset.begin(), offset.end(), header.begin() + offsetLocation);
+   
+   #ifdef DEBUG_BINARY_OUTPUT
+   MessageInterface::ShowMessage
+      ("ReportFile::WriteBinaryHeader() '%s' has %d columns, data starts at "
+       "byte %d\n", GetName().c_str(), mNumParams, (Integer)dataOffset);
+   #endif
+   
+   dstream.write(&header[0], header.size());
+   binaryHeaderWritten = true;
+   finalSolverDataPosition = dstream.tellp();
+}
+
+
+//------------------------------------------------------------------------------
+// bool WriteBinaryData(WrapperArray &wrapperArray)
+//------------------------------------------------------------------------------
+/**
+ * Writes one row of real values to a binary report file.
+ *
+ * @param  wrapperArray  data wrapper array; every element must evaluate to a
+ *                       real number
+ *
+ * @return true on success
+ */
+//------------------------------------------------------------------------------
+bool ReportFile::WriteBinaryData(WrapperArray &wrapperArray)
+{
+   if (wrapperArray.empty())
+      return true;
+   
+   std::vector<char> row;
+   row.reserve(wrapperArray.size() * sizeof(Real));
+   
+   for (UnsignedInt i = 0; i < wrapperArray.size(); ++i)
+   {
+      Real rval = GmatRealConstants::REAL_UNDEFINED;
+      bool isReal = false;
+      
+      if (wrapperArray[i] != NULL)
+      {
+         switch (wrapperArray[i]->GetWrapperType())
+         {
+         case Gmat::VARIABLE_WT:
+         case Gmat::ARRAY_ELEMENT_WT:
+         case Gmat::OBJECT_PROPERTY_WT:
+            isReal = true;
+            break;
+         case Gmat::PARAMETER_WT:
+            isReal = (wrapperArray[i]->GetDataType() == Gmat::REAL_TYPE);
+            break;
+         default:
+            break;
+         }
+         
+         if (!isReal)
+            throw SubscriberException
+               ("ReportFile \"" + GetName() + "\" cannot write \"" +
+                wrapperArray[i]->GetDescription() + "\" in Binary format; "
+                "only real scalar values are supported");
+         
+         rval = wrapperArray[i]->EvaluateReal();
+      }
+      
+      AppendLittleEndian(row, &rval, sizeof(rval));
+   }
+   
+   if (writeFinalSolverData)
+      dstream.seekp(finalSolverDataPosition, std::ios_base::beg);
+   
+   dstream.write(&row[0], row.size());
+   
+   if (!writeFinalSolverData && (mSolverIterOption == SI_NONE))
+      finalSolverDataPosition = dstream.tellp();
+   
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// void FlushReportFile()
+//------------------------------------------------------------------------------
+/**
+ * Writes buffered data to the file.
+ */
+//------------------------------------------------------------------------------
+void ReportFile::FlushReportFile()
+{
+   if (dstream.is_open())
+      dstream.flush();
+}
+
+
+//------------------------------------------------------------------------------
+// std::string FormatReal(Real rval)
+//------------------------------------------------------------------------------
+/**
+ * Formats a real value for the text report.
+ *
+ * The output matches GmatStringUtil::ToString(rval, precision, zeroFill).
+ * When the library supports it, std::to_chars is used for values that are
+ * not zero filled, which avoids building a stringstream for every value.
+ *
+ * @param  rval  The value
+ *
+ * @return The formatted value
+ */
+//------------------------------------------------------------------------------
+std::string ReportFile::FormatReal(Real rval)
+{
+   #ifdef __cpp_lib_to_chars
+      if (!zeroFill)
+      {
+         char buffer[64];
+         std::to_chars_result result = std::to_chars(buffer, buffer + 64, rval,
+               std::chars_format::general, precision);
+         if (result.ec == std::errc())
+            return std::string(buffer, result.ptr);
+      }
+   #endif
+   
+   return GmatStringUtil::ToString(rval, precision, zeroFill);
+}
+
+
 //------------------------------------------------------------------------------
 // bool IsNotANumber(Real rval)
 //------------------------------------------------------------------------------
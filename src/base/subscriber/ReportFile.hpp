@@ -41,6 +41,7 @@
 
 #include "Parameter.hpp"
 #include <map>
+#include <vector>
 #include <iostream>
 #include <iomanip>
 
@@ -118,6 +119,10 @@ public:
    virtual std::string  GetOnOffParameter(const std::string &label) const;
    virtual bool         SetOnOffParameter(const std::string &label, 
                                           const std::string &value);
+   virtual const StringArray&
+                        GetPropertyEnumStrings(const Integer id) const;
+   virtual const StringArray&
+                        GetPropertyEnumStrings(const std::string &label) const;
 
    virtual GmatBase*    GetRefObject(const UnsignedInt type,
                                      const std::string &name);
@@ -164,6 +169,16 @@ protected:
    std::ofstream::pos_type finalSolverDataPosition;
    /// delimiter
    char                 delimiter;
+   /// Output format: "Text", or "Binary" for raw little-endian doubles
+   std::string          outputFormat;
+   /// Flag indicating binary output
+   bool                 binaryOutput;
+   /// Flag indicating the binary header is in the open file
+   bool                 binaryHeaderWritten;
+   /// Size of the stream write buffer, in bytes; 0 uses the library default
+   Integer              bufferSize;
+   /// Storage for the stream write buffer
+   std::vector<char>    streamBuffer;
    
    /// output data stream
    std::ofstream        dstream;
@@ -182,6 +197,10 @@ protected:
    virtual bool         OpenReportFile();
    void                 ClearParameters();
    void                 WriteHeaders();
+   void                 WriteBinaryHeader();
+   bool                 WriteBinaryData(WrapperArray &wrapperArray);
+   void                 FlushReportFile();
+   std::string          FormatReal(Real rval);
    Integer              WriteMatrix(StringArray *output, Integer param,
                                     const Rmatrix &rmat, UnsignedInt &maxRow,
                                     Integer defWidth);
@@ -205,9 +224,14 @@ protected:
       DELIMITER,
       COL_WIDTH,
       WRITE_REPORT,
+      OUTPUT_FORMAT,
+      BUFFER_SIZE,
       ReportFileParamCount  ///< Count of the parameters for this class
    };
 
+   /// Available output formats
+   static StringArray   outputFormatOptions;
+
 private:
       
    static const std::string
@@ -45,6 +45,7 @@
 //------------------------------------------------------------------------------
 
 #include "Subscriber.hpp"
+#include "ParameterIndex.hpp"
 #include "SubscriberException.hpp"
 #include "Parameter.hpp"
 #include "StringUtil.hpp"          // for Replace()
@@ -1243,11 +1244,11 @@ std::string Subscriber::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer Subscriber::GetParameterID(const std::string &str) const
 {
-   for (int i=GmatBaseParamCount; i<SubscriberParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatBaseParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("Subscriber", PARAMETER_TEXT,
+         GmatBaseParamCount, SubscriberParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
    
    return GmatBase::GetParameterID(str);
 }
@@ -30,6 +30,7 @@
 //------------------------------------------------------------------------------
 
 #include "TextEphemFile.hpp"
+#include "ParameterIndex.hpp"
 #include "CubicSplineInterpolator.hpp"
 #include "Moderator.hpp"
 #include "MessageInterface.hpp"
@@ -238,11 +239,11 @@ GmatBase* TextEphemFile::Clone(void) const
 //------------------------------------------------------------------------------
 Integer TextEphemFile::GetParameterID(const std::string &str) const
 {
-   for (Integer i = ReportFileParamCount; i < TextEphemFileParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - ReportFileParamCount])
-         return i;
-   }
+   static const ParameterIndex parameterIndex("TextEphemFile", PARAMETER_TEXT,
+         ReportFileParamCount, TextEphemFileParamCount);
+   Integer id = parameterIndex.Find(str);
+   if (id != -1)
+      return id;
 
    return ReportFile::GetParameterID(str);
 }
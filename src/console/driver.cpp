@@ -44,6 +44,21 @@
 #include "CommandFactory.hpp"
 #include "PointMassForce.hpp"
 #include "PrintUtility.hpp"
+#include "WorkerPool.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <map>
+#include <sstream>
+
+#ifndef _WIN32
+#include <cerrno>
+#include <cstdio>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#endif
 
 //#define DEBUG_CONSOLE
 //#define DEBUG_CONSOLE_STARTUP
@@ -76,6 +91,7 @@ void ShowHelp()
              << "   --help, -h                    Shows available options\n"
              << "   --version, -v                 Show version and build information\n"
              << "   --batch, -b <filename>        Runs multiple scripts listed in specified file\n"
+             << "   --jobs, -j <count>            Number of batch scripts run at once (0 = one per core)\n"
              << "   --run, -r <filename>          Runs the input script once, then exits\n"
              << "   --logfile, -l <filename>      Specify the log file (ignored in Console interactive mode)\n"
              << "   --startup_file, -s <filename> Specify the startup file (ignored in Console interactive mode)\n"
@@ -187,18 +203,23 @@ void RunScriptInterpreter(std::string script, int verbosity, bool batchmode)
 
 
 //------------------------------------------------------------------------------
-// Integer RunBatch(std::string& batchfilename)
+// Integer RunBatch(std::string& batchfilename, Integer jobs)
 //------------------------------------------------------------------------------
 /**
  * Executes a collection of scripts.
  * 
  * @param <batchfilename> The file containing the list of script files to run.
+ * @param <jobs>          The number of scripts to run at once; values other
+ *                        than 1 use RunParallelBatch().
  * 
  * @return The number of lines parsed from the batch file.
  */
 //------------------------------------------------------------------------------
-Integer RunBatch(std::string& batchfilename)
+Integer RunBatch(std::string& batchfilename, Integer jobs)
 {
+   if (jobs != 1)
+      return RunParallelBatch(batchfilename, jobs);
+
    Integer count = 0, successful = 0, failed = 0, skipped = 0;
    std::string script;
    StringArray failedScripts;
@@ -301,6 +322,283 @@ Integer RunBatch(std::string& batchfilename)
 }
 
 
+#ifndef _WIN32
+//------------------------------------------------------------------------------
+// void RunBatchJob(const std::string &script, const std::string &jobLog)
+//------------------------------------------------------------------------------
+/**
+ * Runs one batch script in a forked child process and exits the child.
+ *
+ * Console output for the script goes to its own log file so that output from
+ * concurrent jobs is not interleaved.  The exit code is 0 for success, 1 for
+ * a GMAT exception, and 2 for any other exception.
+ *
+ * @param <script> The script file that is run.
+ * @param <jobLog> The file that receives the console output of the script.
+ */
+//------------------------------------------------------------------------------
+void RunBatchJob(const std::string &script, const std::string &jobLog)
+{
+   int fd = open(jobLog.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+   if (fd >= 0)
+   {
+      dup2(fd, STDOUT_FILENO);
+      dup2(fd, STDERR_FILENO);
+      close(fd);
+   }
+
+   // The shared GMAT log file belongs to the parent process
+   MessageInterface::SetLogEnable(false);
+
+   int exitCode = 0;
+   try
+   {
+      RunScriptInterpreter(script, 0, true);
+   }
+   catch (BaseException &ex)
+   {
+      std::cout << "\n!!! Exception in script \"" << script << "\"\n!!!    \""
+                << ex.GetFullMessage() << "\"\n" << std::endl;
+      exitCode = 1;
+   }
+   catch (...)
+   {
+      std::cout << "\n!!! Unhandled Exception in script \"" << script << "\"\n"
+                << std::endl;
+      exitCode = 2;
+   }
+
+   std::cout.flush();
+   fflush(NULL);
+   // Skip static destructors; they belong to the parent's objects
+   _exit(exitCode);
+}
+#endif
+
+
+//------------------------------------------------------------------------------
+// Integer RunParallelBatch(std::string& batchfilename, Integer jobs)
+//------------------------------------------------------------------------------
+/**
+ * Executes a collection of scripts, several at a time.
+ *
+ * Each script runs in a child process forked from the initialized console, so
+ * the startup data already loaded by the Moderator (startup file, leap
+ * seconds, EOP data, and the memory mapped DE files) is shared copy-on-write
+ * instead of being read again for every script.  Each job writes its console
+ * output to <batchfilename>.job<n>.log, and a per-script summary (status,
+ * exit code, wall time and peak resident memory) is written to
+ * <batchfilename>.summary.csv.
+ *
+ * Platforms without fork() run the batch serially.
+ *
+ * @param <batchfilename> The file containing the list of script files to run.
+ * @param <jobs>          The number of scripts to run at once; 0 or less uses
+ *                        one job per hardware thread.
+ *
+ * @return The number of lines parsed from the batch file.
+ */
+//------------------------------------------------------------------------------
+Integer RunParallelBatch(std::string& batchfilename, Integer jobs)
+{
+   #ifdef _WIN32
+      std::cout << "--jobs is not supported on this platform; running the "
+                << "batch serially" << std::endl;
+      return RunBatch(batchfilename, 1);
+   #else
+   if (jobs <= 0)
+      jobs = WorkerPool::GetHardwareThreadCount();
+
+   std::cout << "Running batch file \"" << batchfilename << "\" with " << jobs
+             << " jobs" << std::endl;
+   std::ifstream batchfile(batchfilename.c_str());
+
+   if (!(batchfile))
+   {
+      std::string errstr = "Batch file ";
+      errstr += batchfilename;
+      errstr += " does not exist";
+      std::cout << errstr << std::endl;
+      return 0;
+   }
+
+   StringArray scripts;
+   std::string script;
+   batchfile >> script;
+   while (!batchfile.eof())
+   {
+      if (script == "--summary")
+         std::cout << "*** --summary is ignored when running with --jobs\n";
+      else
+         scripts.push_back(script);
+      batchfile >> script;
+   }
+   batchfile.close();
+
+   Integer count = (Integer)scripts.size();
+   Integer successful = 0, failed = 0, skipped = 0;
+   StringArray failedScripts;
+   StringArray skippedScripts;
+
+   // Per-script results, indexed like scripts
+   StringArray status(count, "skipped");
+   std::vector<int> exitCodes(count, 0);
+   std::vector<Real> wallTimes(count, 0.0);
+   std::vector<long> peakRss(count, 0);
+   std::vector<std::chrono::steady_clock::time_point> startTimes(count);
+
+   std::map<pid_t, Integer> running;
+   Integer next = 0;
+
+   while ((next < count) || !running.empty())
+   {
+      // Keep the pool full
+      while ((next < count) && ((Integer)running.size() < jobs))
+      {
+         Integer index = next++;
+         const std::string &name = scripts[index];
+
+         if (name[0] == '%')
+         {
+            std::cout << "*** " << index + 1 << ": Skipping script \""
+                      << name.substr(1) << "\"" << std::endl;
+            skippedScripts.push_back(name.substr(1));
+            ++skipped;
+            continue;
+         }
+
+         std::stringstream jobLog;
+         jobLog << batchfilename << ".job" << index + 1 << ".log";
+
+         std::cout << "*** " << index + 1 << ": Starting \"" << name
+                   << "\" (output in " << jobLog.str() << ")" << std::endl;
+
+         // Don't let the child inherit unwritten output
+         std::cout.flush();
+         fflush(NULL);
+
+         startTimes[index] = std::chrono::steady_clock::now();
+         pid_t pid = fork();
+         if (pid == 0)
+            RunBatchJob(name, jobLog.str());
+
+         if (pid < 0)
+         {
+            std::cout << "!!! Unable to start a job for \"" << name << "\": "
+                      << strerror(errno) << std::endl;
+            status[index] = "failed";
+            exitCodes[index] = -1;
+            ++failed;
+            failedScripts.push_back(name);
+            continue;
+         }
+
+         running[pid] = index;
+      }
+
+      if (running.empty())
+         continue;
+
+      int waitStatus = 0;
+      struct rusage usage;
+      pid_t pid = wait4(-1, &waitStatus, 0, &usage);
+      if (pid < 0)
+      {
+         if (errno == EINTR)
+            continue;
+         std::cout << "!!! Lost track of running jobs: " << strerror(errno)
+                   << std::endl;
+         break;
+      }
+
+      std::map<pid_t, Integer>::iterator job = running.find(pid);
+      if (job == running.end())
+         continue;
+      Integer index = job->second;
+      running.erase(job);
+
+      wallTimes[index] = std::chrono::duration<Real>(
+            std::chrono::steady_clock::now() - startTimes[index]).count();
+      #ifdef __APPLE__
+         peakRss[index] = usage.ru_maxrss / 1024;   // bytes on macOS
+      #else
+         peakRss[index] = usage.ru_maxrss;          // kilobytes
+      #endif
+
+      if (WIFEXITED(waitStatus))
+      {
+         exitCodes[index] = WEXITSTATUS(waitStatus);
+         status[index] = (exitCodes[index] == 0 ? "success" : "failed");
+      }
+      else
+      {
+         exitCodes[index] = (WIFSIGNALED(waitStatus) ?
+               -WTERMSIG(waitStatus) : -1);
+         status[index] = "crashed";
+      }
+
+      if (exitCodes[index] == 0)
+         ++successful;
+      else
+      {
+         ++failed;
+         failedScripts.push_back(scripts[index]);
+      }
+
+      std::cout << "*** " << index + 1 << ": \"" << scripts[index] << "\" "
+                << status[index] << " in " << wallTimes[index] << " s"
+                << std::endl;
+   }
+
+   // Machine readable summary
+   std::string summaryName = batchfilename + ".summary.csv";
+   std::ofstream summary(summaryName.c_str());
+   if (summary)
+   {
+      summary << "index,script,status,exit_code,wall_time_s,peak_rss_kb\n";
+      for (Integer i = 0; i < count; ++i)
+      {
+         std::string name = (scripts[i][0] == '%' ? scripts[i].substr(1) :
+               scripts[i]);
+         summary << i + 1 << ",\"" << name << "\"," << status[i] << ","
+                 << exitCodes[i] << "," << wallTimes[i] << "," << peakRss[i]
+                 << "\n";
+      }
+      summary.close();
+      std::cout << "Batch summary written to " << summaryName << std::endl;
+   }
+   else
+      std::cout << "Unable to write the batch summary " << summaryName
+                << std::endl;
+
+   std::cout << "\n\n**************************************\n*** "
+             << "Batch Run Statistics:"
+             <<               "\n***   Successful scripts:  "
+             << successful << "\n***   Failed Scripts:      "
+             << failed     << "\n***   Skipped Scripts:     "
+             << skipped    << "\n**************************************\n";
+
+   if (failed > 0) {
+      std::cout << "\n**************************************\n"
+                << "***   Scripts that failed:\n";
+      for (StringArray::iterator i = failedScripts.begin();
+           i != failedScripts.end(); ++i)
+         std::cout << "***      " << *i << "\n";
+      std::cout << "**************************************\n";
+   }
+   if (skipped > 0) {
+      std::cout << "\n**************************************\n"<< "***   Scripts that were skipped:\n";
+      for (StringArray::iterator i = skippedScripts.begin();
+           i != skippedScripts.end(); ++i)
+         std::cout << "***      " << *i << "\n";
+      std::cout << "**************************************\n\n";
+   }
+
+   return count;
+   #endif
+}
+
+
 //------------------------------------------------------------------------------
 // void SaveScript(std::string filename)
 //------------------------------------------------------------------------------
@@ -526,6 +824,49 @@ StringArray CheckForStartupAndLogFile(int argc, char *argv[])
 }
 
 
+//------------------------------------------------------------------------------
+// Integer CheckForJobCount(int argc, char *argv[])
+//------------------------------------------------------------------------------
+/**
+ * Check the input arguments specifically and only for the number of batch
+ * jobs, so that --jobs can appear before or after --batch.
+ *
+ * @param <argc> The count of the input arguments.
+ * @param <argv> The input arguments.
+ *
+ * @return the number of batch jobs; 1 if --jobs is not used
+ */
+//------------------------------------------------------------------------------
+Integer CheckForJobCount(int argc, char *argv[])
+{
+   Integer jobs = 1;
+
+   if (argc > 2)
+   {
+      std::string arg("");
+      for (int i = 1; i < argc; ++i)
+      {
+         arg = argv[i];
+         if ((arg == "--jobs") || (arg == "-j"))
+         {
+            Integer value;
+            if ((argc >= i + 2) && GmatStringUtil::ToInteger(argv[i+1], value))
+            {
+               jobs = (value > 0 ? value : 0);
+               ++i;
+            }
+            else
+            {
+               MessageInterface::ShowMessage("*** Missing or invalid job count\n");
+            }
+         }
+      }
+   }
+
+   return jobs;
+}
+
+
 //------------------------------------------------------------------------------
 // int main(int argc, char *argv[])
 //------------------------------------------------------------------------------
@@ -580,6 +921,7 @@ int main(int argc, char *argv[])
       StringArray filesSpecified = CheckForStartupAndLogFile(argc, argv);
       std::string startUpFile    = filesSpecified.at(0);
       std::string logFile        = filesSpecified.at(1);
+      Integer     batchJobs      = CheckForJobCount(argc, argv);
       
       if (logFile != "")
       {
@@ -782,6 +1124,12 @@ int main(int argc, char *argv[])
                         skipNext = true; // skip startup file name - handled previously
                   }
                }
+               else if ((arg == "--jobs") || (arg == "-j"))
+               {
+                  Integer value;
+                  if ((argc >= i + 2) && GmatStringUtil::ToInteger(argv[i+1], value))
+                     skipNext = true; // skip job count - handled previously
+               }
                else if ((arg == "--minimize") || (arg == "-m"))
                {
                   std::cout << "\n--minimize option ignored by GmatConsole\n ";
@@ -853,7 +1201,7 @@ int main(int argc, char *argv[])
                      // Replace single quotes
                      GmatStringUtil::Replace(batchToRun, "'", "");
                      ++i;
-                     RunBatch(batchToRun);
+                     RunBatch(batchToRun, batchJobs);
                   }
                }
                else if ((arg == "--exit") || (arg == "-x"))
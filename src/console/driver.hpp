@@ -50,13 +50,18 @@ enum {
 void ShowHelp();
 void RunScriptInterpreter(std::string script, int verbosity, 
                           bool batchmode = false);
-Integer RunBatch(std::string& batchfilename);
+Integer RunBatch(std::string& batchfilename, Integer jobs = 1);
+Integer RunParallelBatch(std::string& batchfilename, Integer jobs);
+#ifndef _WIN32
+void RunBatchJob(const std::string &script, const std::string &jobLog);
+#endif
 void SaveScript(std::string filename = "");
 void ShowVersionInfo();
 void ShowCommandSummary(std::string filename = "");
 void DumpDEData(double secsToStep, double spanInSecs = 86400.0);
 
 StringArray CheckForStartupAndLogFile(int argc, char *argv[]);
+Integer CheckForJobCount(int argc, char *argv[]);
 
 int main(int argc, char *argv[]);
 
@@ -1761,3 +1761,189 @@ void NLPFuncUtilRadau::FillDynamicCostFuncMatrices(
       }
    }
 }
+
+//------------------------------------------------------------------------------
+// void AssembleDynamicDefectConMatrices(
+//                 const std::vector<FunctionOutputData*> &ptrFuncDataArray,
+//                 Rvector &QVector, SparseAssembler &parQMatrix)
+//------------------------------------------------------------------------------
+/**
+ * Computes Q and partial Q Matrix for defect constraints, writing the partial
+ * Q values directly into the preallocated pattern of the D matrix.  This
+ * matches FillDynamicDefectConMatrices() without building a sparse matrix.
+ *
+ * @param <ptrFuncDataArray> input:  user defect function data array
+ * @param <QVector>          output: the defect Q vector
+ * @param <parQMatrix>       output: the partial Q matrix values
+ */
+//------------------------------------------------------------------------------
+void NLPFuncUtilRadau::AssembleDynamicDefectConMatrices(
+                       const std::vector<FunctionOutputData*> &ptrFuncDataArray,
+                       Rvector &QVector, SparseAssembler &parQMatrix)
+{
+   #ifdef DEBUG_RADAU
+      MessageInterface::ShowMessage(
+                        "Entering Radau::AssembleDynamicDefectConMatrices\n");
+   #endif
+   Integer idxUB = ptrFuncDataArray.size() - 1;
+   Integer numStateVars = ptrConfig->GetNumStateVars();
+   Real dtBy2 = 0.5*(deltaTime);
+   Real dCurrentTimedTI, dCurrentTimedTF;
+
+   if (!QVector.IsSized() ||
+       (QVector.GetSize() != ptrConfig->GetNumDefectConNLP()))
+      QVector.SetSize(ptrConfig->GetNumDefectConNLP());
+   parQMatrix.Zero();
+
+   bool hasStateVars   = ptrConfig->HasStateVars();
+   bool hasControlVars = ptrConfig->HasControlVars();
+   bool hasStaticVars  = ptrConfig->HasStaticVars();
+
+   for (Integer funcIdx = 0; funcIdx < idxUB; ++funcIdx)
+   {
+      FunctionOutputData *funcData = ptrFuncDataArray.at(funcIdx);
+      Integer meshIdx     = funcData->GetMeshIdx();
+      Integer conStartIdx = meshIdx * numStateVars;
+
+      dCurrentTimedTI = GetdCurrentTimedTI(meshIdx);
+      dCurrentTimedTF = GetdCurrentTimedTF(meshIdx);
+
+      const Rvector &funcValueVec = funcData->GetFunctionValues();
+      const Rmatrix &timeJac = funcData->GetJacobian(UserFunction::TIME);
+
+      for (Integer idx = 0; idx < numStateVars; ++idx)
+      {
+         Integer conIdx = conStartIdx + idx;
+         QVector(conIdx) = -dtBy2*funcValueVec(idx);
+
+         //  Initial and final time terms
+         parQMatrix.SetValue(conIdx, 0, 0.5*funcValueVec(idx) -
+                             dtBy2*dCurrentTimedTI*timeJac(idx, 0));
+         parQMatrix.SetValue(conIdx, 1, -0.5*funcValueVec(idx) -
+                             dtBy2*dCurrentTimedTF*timeJac(idx, 0));
+      }
+
+      if (hasStateVars)
+      {
+         const Rmatrix &stateJac =
+                              funcData->GetJacobian(UserFunction::STATE);
+         const IntegerArray &stateIdxs = funcData->GetStateIdxs();
+         for (Integer idx = 0; idx < numStateVars; ++idx)
+            for (UnsignedInt colIdx = 0; colIdx < stateIdxs.size(); ++colIdx)
+               if (stateJac(idx, colIdx) != 0.0)
+                  parQMatrix.SetValue(conStartIdx + idx, stateIdxs[colIdx],
+                                      -dtBy2*stateJac(idx, colIdx));
+      }
+
+      if (hasControlVars)
+      {
+         const Rmatrix &controlJac =
+                              funcData->GetJacobian(UserFunction::CONTROL);
+         const IntegerArray &controlIdxs = funcData->GetControlIdxs();
+         for (Integer idx = 0; idx < numStateVars; ++idx)
+            for (UnsignedInt colIdx = 0; colIdx < controlIdxs.size(); ++colIdx)
+               if (controlJac(idx, colIdx) != 0.0)
+                  parQMatrix.SetValue(conStartIdx + idx, controlIdxs[colIdx],
+                                      -dtBy2*controlJac(idx, colIdx));
+      }
+
+      if (hasStaticVars)
+      {
+         // static data idxs is same for all points
+         const Rmatrix &staticJac =
+                              funcData->GetJacobian(UserFunction::STATIC);
+         const IntegerArray &staticIdxs = ptrFuncDataArray.at(0)->GetStaticIdxs();
+         for (Integer idx = 0; idx < numStateVars; ++idx)
+            for (UnsignedInt colIdx = 0; colIdx < staticIdxs.size(); ++colIdx)
+               if (staticJac(idx, colIdx) != 0.0)
+                  parQMatrix.SetValue(conStartIdx + idx, staticIdxs[colIdx],
+                                      -dtBy2*staticJac(idx, colIdx));
+      }
+   }
+   #ifdef DEBUG_RADAU
+      MessageInterface::ShowMessage(
+                        "LEAVING Radau::AssembleDynamicDefectConMatrices\n");
+   #endif
+}
+
+//------------------------------------------------------------------------------
+// void AssembleDynamicCostFuncMatrices(
+//                 const std::vector<FunctionOutputData*> &ptrFuncDataArray,
+//                 Rvector &QVector, SparseAssembler &parQMatrix)
+//------------------------------------------------------------------------------
+/**
+ * Computes Q and partial Q Matrix for integral cost, writing the partial Q
+ * values directly into the preallocated pattern of the D matrix.  This
+ * matches FillDynamicCostFuncMatrices() without building a sparse matrix.
+ *
+ * @param <ptrFuncDataArray> input:  user cost function data array
+ * @param <QVector>          output: the cost Q vector
+ * @param <parQMatrix>       output: the partial Q matrix values
+ */
+//------------------------------------------------------------------------------
+void NLPFuncUtilRadau::AssembleDynamicCostFuncMatrices(
+                       const std::vector<FunctionOutputData*> &ptrFuncDataArray,
+                       Rvector &QVector, SparseAssembler &parQMatrix)
+{
+   Integer idxUB = ptrFuncDataArray.size() - 1;
+   Real dtBy2 = 0.5*(deltaTime);
+   Real dCurrentTimedTI, dCurrentTimedTF;
+
+   if (!QVector.IsSized() || (QVector.GetSize() != numMeshPoints))
+      QVector.SetSize(numMeshPoints);
+   parQMatrix.Zero();
+
+   for (Integer funcIdx = 0; funcIdx < idxUB; ++funcIdx)
+   {
+      FunctionOutputData *funcData = ptrFuncDataArray.at(funcIdx);
+      Integer meshIdx = funcData->GetMeshIdx();
+
+      dCurrentTimedTI = GetdCurrentTimedTI(meshIdx);
+      dCurrentTimedTF = GetdCurrentTimedTF(meshIdx);
+
+      const Rvector &funcValueVec = funcData->GetFunctionValues();
+      const Rmatrix &timeJac = funcData->GetJacobian(UserFunction::TIME);
+
+      QVector(funcIdx) = -dtBy2*funcValueVec(0);
+
+      //  Initial and final time terms
+      parQMatrix.SetValue(funcIdx, 0,
+                  0.5*funcValueVec(0) - dtBy2*dCurrentTimedTI*timeJac(0, 0));
+      parQMatrix.SetValue(funcIdx, 1,
+                  -0.5*funcValueVec(0) - dtBy2*dCurrentTimedTF*timeJac(0, 0));
+
+      if (ptrConfig->HasStateVars())
+      {
+         const Rmatrix &stateJac =
+                              funcData->GetJacobian(UserFunction::STATE);
+         const IntegerArray &stateIdxs = funcData->GetStateIdxs();
+         for (UnsignedInt colIdx = 0; colIdx < stateIdxs.size(); ++colIdx)
+            if (stateJac(0, colIdx) != 0.0)
+               parQMatrix.SetValue(funcIdx, stateIdxs[colIdx],
+                                   -dtBy2*stateJac(0, colIdx));
+      }
+
+      if (ptrConfig->HasControlVars())
+      {
+         const Rmatrix &controlJac =
+                              funcData->GetJacobian(UserFunction::CONTROL);
+         const IntegerArray &controlIdxs = funcData->GetControlIdxs();
+         for (UnsignedInt colIdx = 0; colIdx < controlIdxs.size(); ++colIdx)
+            if (controlJac(0, colIdx) != 0.0)
+               parQMatrix.SetValue(funcIdx, controlIdxs[colIdx],
+                                   -dtBy2*controlJac(0, colIdx));
+      }
+
+      if (ptrConfig->HasStaticVars())
+      {
+         // static data idxs is same for all points
+         const Rmatrix &staticJac =
+                              funcData->GetJacobian(UserFunction::STATIC);
+         const IntegerArray &staticIdxs = ptrFuncDataArray.at(0)->GetStaticIdxs();
+         for (UnsignedInt colIdx = 0; colIdx < staticIdxs.size(); ++colIdx)
+            if (staticJac(0, colIdx) != 0.0)
+               parQMatrix.SetValue(funcIdx, staticIdxs[colIdx],
+                                   -dtBy2*staticJac(0, colIdx));
+      }
+   }
+}
@@ -148,6 +148,14 @@ protected:
    void FillDynamicCostFuncMatrices(
                   const std::vector<FunctionOutputData*> &ptrFuncDataArray,
                   Rvector &valueVec, RSMatrix &jacobian);
+
+   /// compute Q vector and partial Q matrix on the preallocated pattern
+   void AssembleDynamicDefectConMatrices(
+                  const std::vector<FunctionOutputData*> &ptrFuncDataArray,
+                  Rvector &valueVec, SparseAssembler &jacobian);
+   void AssembleDynamicCostFuncMatrices(
+                  const std::vector<FunctionOutputData*> &ptrFuncDataArray,
+                  Rvector &valueVec, SparseAssembler &jacobian);
 };
 
 #endif // NLPFuncUtilRadau_hpp
@@ -447,34 +447,35 @@ void NLPFuncUtil_Coll::ComputeDefectFunAndJac(
          MessageInterface::ShowMessage(
                         "In NLPColl::ComputeDefectFunAndJac, hasDefectCons\n");
       #endif
-      Rvector QVector;
       const Rvector *ptrDecVectorData;
       
       ptrDecVectorData = DecVector->GetDecisionVectorPointer();
-      RSMatrix parQMatrix;
+
+      // parQ and the Jacobian are assembled on patterns that are set up
+      // once per mesh
+      SparseAssembler *parQAssembler = DefectNLPData.GetParQAssembler();
       #ifdef DEBUG_COLL
          MessageInterface::ShowMessage(
                   "In NLPColl::ComputeDefectFunAndJac, calling FillDynamic\n");
       #endif
-      FillDynamicDefectConMatrices(ptrFuncDataArray, QVector, parQMatrix);
+      AssembleDynamicDefectConMatrices(ptrFuncDataArray, defectQVector,
+                                       *parQAssembler);
 
 
       #ifdef DEBUG
-         MessageInterface::ShowMessage(
-                        "the parQMatrix of defect constraints is given as \n");
-         SparseMatrixUtil::PrintNonZeroElements(&parQMatrix);
          Rvector decisionVector = DecVector->GetDecisionVector();
          MessageInterface::ShowMessage("DecisionVector is given as \n%s\n",
                            decisionVector.ToString(12).c_str());
 
          MessageInterface::ShowMessage(
                            "the QVector of defect constraints is given as \n");
-            for (Integer idx = 0; idx < QVector.GetSize(); ++idx)
-               MessageInterface::ShowMessage("%le\n", QVector(idx));
+            for (Integer idx = 0; idx < defectQVector.GetSize(); ++idx)
+               MessageInterface::ShowMessage("%le\n", defectQVector(idx));
       #endif
 
-      DefectNLPData.ComputeFunctions(&QVector, ptrDecVectorData, funcValues);
-      DefectNLPData.ComputeJacobian(&parQMatrix, jacArray);
+      DefectNLPData.ComputeFunctions(&defectQVector, ptrDecVectorData,
+                                     funcValues);
+      DefectNLPData.AssembleJacobian(jacArray);
    }
    #ifdef DEBUG_COLL
       MessageInterface::ShowMessage(
@@ -508,27 +509,78 @@ void NLPFuncUtil_Coll::ComputeCostFunAndJac(
 
    if (ptrConfig->HasIntegralCost())
    {
-      Rvector QVector;
       //const Rvector *ptrDecVectorData;
       //ptrDecVectorData = DecVector->GetDecisionVectorPointer();
-      RSMatrix parQMatrix;
-      FillDynamicCostFuncMatrices(ptrFuncDataArray, QVector, parQMatrix);
+      SparseAssembler *parQAssembler = CostNLPData.GetParQAssembler();
+      AssembleDynamicCostFuncMatrices(ptrFuncDataArray, costQVector,
+                                      *parQAssembler);
 
 
       #ifdef DEBUG
-         MessageInterface::ShowMessage("the parQMatrix of cost is given as \n");
-         SparseMatrixUtil::PrintNonZeroElements(&parQMatrix);
-   
          MessageInterface::ShowMessage("the QVector of cost is given as \n");
-         for (Integer idx = 0; idx < QVector.GetSize(); ++idx)
-            MessageInterface::ShowMessage("%le\n", QVector(idx));
+         for (Integer idx = 0; idx < costQVector.GetSize(); ++idx)
+            MessageInterface::ShowMessage("%le\n", costQVector(idx));
       #endif
 
-      CostNLPData.ComputeFunctions(&QVector, costValue);
-      CostNLPData.ComputeJacobian(&parQMatrix, jacArray);
+      CostNLPData.ComputeFunctions(&costQVector, costValue);
+      CostNLPData.AssembleJacobian(jacArray);
    }
 }
 
+//------------------------------------------------------------------------------
+// void AssembleDynamicCostFuncMatrices(
+//                 const std::vector<FunctionOutputData*> &ptrFuncDataArray,
+//                 Rvector                                &QVector,
+//                 SparseAssembler                        &parQMatrix)
+//------------------------------------------------------------------------------
+/**
+ * Computes the Q vector and partial Q matrix for the integral cost on the
+ * preallocated partial Q pattern.  This default fills a sparse matrix with
+ * FillDynamicCostFuncMatrices() and loads it; transcriptions override it to
+ * write into the pattern directly.
+ *
+ * @param <ptrFuncDataArray> input:  user cost function data array
+ * @param <QVector>          output: the cost Q vector
+ * @param <parQMatrix>       output: the partial Q matrix values
+ */
+//------------------------------------------------------------------------------
+void NLPFuncUtil_Coll::AssembleDynamicCostFuncMatrices(
+                     const std::vector<FunctionOutputData*> &ptrFuncDataArray,
+                     Rvector                                &QVector,
+                     SparseAssembler                        &parQMatrix)
+{
+   RSMatrix parQ;
+   FillDynamicCostFuncMatrices(ptrFuncDataArray, QVector, parQ);
+   parQMatrix.SetValues(&parQ);
+}
+
+//------------------------------------------------------------------------------
+// void AssembleDynamicDefectConMatrices(
+//                 const std::vector<FunctionOutputData*> &ptrFuncDataArray,
+//                 Rvector                                &QVector,
+//                 SparseAssembler                        &parQMatrix)
+//------------------------------------------------------------------------------
+/**
+ * Computes the Q vector and partial Q matrix for the defect constraints on
+ * the preallocated partial Q pattern.  This default fills a sparse matrix
+ * with FillDynamicDefectConMatrices() and loads it; transcriptions override
+ * it to write into the pattern directly.
+ *
+ * @param <ptrFuncDataArray> input:  user defect function data array
+ * @param <QVector>          output: the defect Q vector
+ * @param <parQMatrix>       output: the partial Q matrix values
+ */
+//------------------------------------------------------------------------------
+void NLPFuncUtil_Coll::AssembleDynamicDefectConMatrices(
+                     const std::vector<FunctionOutputData*> &ptrFuncDataArray,
+                     Rvector                                &QVector,
+                     SparseAssembler                        &parQMatrix)
+{
+   RSMatrix parQ;
+   FillDynamicDefectConMatrices(ptrFuncDataArray, QVector, parQ);
+   parQMatrix.SetValues(&parQ);
+}
+
 //------------------------------------------------------------------------------
 // void SetPhaseNum(Integer inputNum)
 //------------------------------------------------------------------------------
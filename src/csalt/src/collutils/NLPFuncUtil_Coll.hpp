@@ -193,6 +193,17 @@ public:
                      Rvector                                &valueVec,
                      RSMatrix                               &jacobian) = 0;
 
+   ///  fill defect and cost matrices (Q vector and partial Q matrix) on the
+   ///  preallocated partial Q pattern
+   virtual void AssembleDynamicCostFuncMatrices(
+                     const std::vector<FunctionOutputData*> &ptrFuncDataArray,
+                     Rvector                                &valueVec,
+                     SparseAssembler                        &jacobian);
+   virtual void AssembleDynamicDefectConMatrices(
+                     const std::vector<FunctionOutputData*> &ptrFuncDataArray,
+                     Rvector                                &valueVec,
+                     SparseAssembler                        &jacobian);
+
    virtual void GetStateAndControlInMesh(
                      Integer                       meshIntvIdx,
                      DecVecTypeBetts               *ptrDecVector,
@@ -268,5 +279,10 @@ protected:
    bool                    isConMatInitialized;
    ///  Indicates if cost matrices have been initialized
    bool                    isCostMatInitialized;
+
+   /// Q vector of the defect constraints, reused across iterations
+   Rvector                 defectQVector;
+   /// Q vector of the integral cost, reused across iterations
+   Rvector                 costQVector;
 };
 #endif // NLPFuncUtil_Coll_hpp
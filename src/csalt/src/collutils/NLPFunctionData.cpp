@@ -36,7 +36,8 @@
 // default constructor
 //------------------------------------------------------------------------------
 NLPFunctionData::NLPFunctionData() :
-   isJacSparsityPatternComputed (false)
+   isJacSparsityPatternComputed (false),
+   isAssemblyPrepared           (false)
 {
    SparseMatrixUtil::SetSize(AMatrix, 1, 1);
    SparseMatrixUtil::SetSize(BMatrix, 1, 1);
@@ -55,6 +56,10 @@ NLPFunctionData::NLPFunctionData(const NLPFunctionData &nlpFuncData)
    jacSparsityPattern = SparseMatrixUtil::CopySparseMatrix(&jacSparsityPattern);
 
    isJacSparsityPatternComputed = nlpFuncData.isJacSparsityPatternComputed;
+
+   parQAssembler      = nlpFuncData.parQAssembler;
+   jacAssembler       = nlpFuncData.jacAssembler;
+   isAssemblyPrepared = nlpFuncData.isAssemblyPrepared;
 }
 
 //------------------------------------------------------------------------------
@@ -72,6 +77,10 @@ NLPFunctionData& NLPFunctionData::operator = (const NLPFunctionData &nlpFuncData
 
    isJacSparsityPatternComputed = nlpFuncData.isJacSparsityPatternComputed;
 
+   parQAssembler      = nlpFuncData.parQAssembler;
+   jacAssembler       = nlpFuncData.jacAssembler;
+   isAssemblyPrepared = nlpFuncData.isAssemblyPrepared;
+
    return *this;
 }
 
@@ -107,6 +116,9 @@ void NLPFunctionData::Initialize(Integer numFuncs, Integer numVars,
 {
    //Integer numCols = numFuncDependencies*numFuncs;
    isJacSparsityPatternComputed = false;
+   isAssemblyPrepared = false;
+   parQAssembler.Clear();
+   jacAssembler.Clear();
 
    SparseMatrixUtil::SetSize(AMatrix,numFuncs, numVars);
    SparseMatrixUtil::SetSize(BMatrix,numFuncs, numFuncDependencies);
@@ -581,6 +593,52 @@ void NLPFunctionData::ComputeJacobian(RSMatrix *parQMat,
    #endif
 }
 
+//------------------------------------------------------------------------------
+// SparseAssembler* GetParQAssembler()
+//------------------------------------------------------------------------------
+/**
+ * Returns the assembler for the parQ matrix, set up on the pattern of the
+ * DMatrix.  Values written to it are used by AssembleJacobian().
+ *
+ * The patterns are built on the first call after Initialize(), so the A, B,
+ * and D matrices must be complete by then.
+ *
+ * @return the parQ assembler
+ */
+//------------------------------------------------------------------------------
+SparseAssembler* NLPFunctionData::GetParQAssembler()
+{
+   if (!isAssemblyPrepared)
+      PrepareAssembly();
+
+   return &parQAssembler;
+}
+
+//------------------------------------------------------------------------------
+// void AssembleJacobian(RSMatrix &funcJacobianMatrix)
+//------------------------------------------------------------------------------
+/**
+ * Computes the function Jacobian A + B*parQ from the values in the parQ
+ * assembler.  The product is evaluated on the precomputed sparsity pattern,
+ * and once the output matrix has that pattern only its values are written.
+ *
+ * @param <funcJacobianMatrix> output Jacobian matrix
+ */
+//------------------------------------------------------------------------------
+void NLPFunctionData::AssembleJacobian(RSMatrix &funcJacobianMatrix)
+{
+   if (!isAssemblyPrepared)
+      PrepareAssembly();
+
+   jacAssembler.ComputeProduct(parQAssembler);
+   jacAssembler.CopyToMatrix(funcJacobianMatrix);
+
+   #ifdef DEBUG_NLP_FUNCTION_DATA
+      MessageInterface::ShowMessage("jacobian matrix is given as follows:\n");
+      SparseMatrixUtil::PrintNonZeroElements(&funcJacobianMatrix);
+   #endif
+}
+
 //------------------------------------------------------------------------------
 // void ComputeJacSparsityPattern()
 //------------------------------------------------------------------------------
@@ -663,3 +721,29 @@ void NLPFunctionData::SumBMatPartition(Integer rowOffSet, Integer colOffSet,
                                           colIdxVec, valueVec, false);
 }
 
+//------------------------------------------------------------------------------
+// protected methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// void PrepareAssembly()
+//------------------------------------------------------------------------------
+/**
+ * Sets up the parQ assembler on the pattern of the DMatrix and the Jacobian
+ * assembler on the pattern of A + B*D, which is the Jacobian sparsity
+ * pattern.
+ */
+//------------------------------------------------------------------------------
+void NLPFunctionData::PrepareAssembly()
+{
+   parQAssembler.SetPattern(&DMatrix);
+   jacAssembler.SetProductPattern(&AMatrix, &BMatrix, parQAssembler);
+   isAssemblyPrepared = true;
+
+   #ifdef DEBUG_NLP_FUNCTION_DATA
+      MessageInterface::ShowMessage(
+            "NLPFunctionData::PrepareAssembly: %d parQ nonzeros, "
+            "%d Jacobian nonzeros\n", parQAssembler.GetNumNonZeros(),
+            jacAssembler.GetNumNonZeros());
+   #endif
+}
@@ -23,6 +23,7 @@
 
 #include "csaltdefs.hpp"
 #include "SparseMatrixUtil.hpp"
+#include "SparseAssembler.hpp"
 
 /**
  * NLPFunctionData class
@@ -113,6 +114,10 @@ public:
 
    void            ComputeJacSparsityPattern();
    void            ComputeJacobian(RSMatrix *parQMat, RSMatrix &jacobian);
+
+   /// methods for assembling the Jacobian on the fixed sparsity pattern
+   SparseAssembler* GetParQAssembler();
+   void            AssembleJacobian(RSMatrix &jacobian);
                                                           
    /// other methods
    IntegerArray    GetMatrixNumNonZeros();
@@ -136,6 +141,15 @@ protected:
    /// has the jacobian sparsity pattern has been computed?
    bool     isJacSparsityPatternComputed;
 
+   /// parQ values on the pattern of the D matrix
+   SparseAssembler parQAssembler;
+   /// Jacobian values on the pattern of A + B*D, with the product terms
+   SparseAssembler jacAssembler;
+   /// have the assemblers been set up from the current matrices?
+   bool     isAssemblyPrepared;
+
+   void     PrepareAssembly();
+
 };
 
 #endif // NLPFunctionData_hpp
@@ -827,6 +827,22 @@ void Phase::SetRelativeErrorTol(Real toNum)
    relativeErrorTol = toNum;
 }
 
+//------------------------------------------------------------------------------
+// void SetPathFunctionWorkers(Integer toNum)
+//------------------------------------------------------------------------------
+/**
+ * Sets the number of threads used to evaluate the path functions at the mesh
+ * points.  More than one thread is only used if the path function implements
+ * UserPathFunction::Clone().
+ *
+ * @param <toNum>  the number of threads; 0 selects the hardware thread count
+ */
+//------------------------------------------------------------------------------
+void Phase::SetPathFunctionWorkers(Integer toNum)
+{
+   pathFunctionManager->SetNumWorkers(toNum);
+}
+
 //------------------------------------------------------------------------------
 // Integer GetNumStateVars()
 //------------------------------------------------------------------------------
@@ -1825,21 +1841,20 @@ void Phase::ComputeDefectConstraints()
    if (!isInitialized)
       return;
    Rvector  fData;
-   RSMatrix  jac;
    
    #ifdef DEBUG_PHASE
       MessageInterface::ShowMessage("In Phase::ComputeDefectConstraints, calling ComputeDefectFunAnfJac ...\n");
    #endif
    transUtil->ComputeDefectFunAndJac(userDynFunctionData,
                                      (DecVecTypeBetts*) decVector,
-                                     fData, jac);
+                                     fData, defectConJacobian);
    // resize defectConVec for MR; YK mod
    defectConVec.SetSize(fData.GetSize());
    defectConVec = fData;
    IntegerArray idxs;
    idxs.push_back(defectConStartIdx);
    idxs.push_back(defectConEndIdx);
-   InsertJacobianRowChunk(jac,idxs);  
+   InsertJacobianRowChunk(defectConJacobian,idxs);  
    #ifdef DEBUG_PHASE
       MessageInterface::ShowMessage(
                               "LEAVING Phase::ComputeDefectConstraints ...\n");
@@ -3184,18 +3199,42 @@ void Phase::ComputePathFunctions()
    //YK mod static vars: save static idxs vector, here, and use it for loop
    IntegerArray stcIdxs = decVector->GetStaticIdxs();
 
+   IntegerArray meshIdxs, stageIdxs;
+   for (Integer pt = 0; pt < numTimePts; pt++)
+   {
+      meshIdxs.push_back(transUtil->GetMeshIndex(pt));
+      stageIdxs.push_back(transUtil->GetStageIndex(pt));
+
+      // CREATING NEW ONE HERE????  Is that what we want to do?
+      funcData.push_back(new PathFunctionContainer());
+      #ifdef DEBUG_PHASE_INIT
+         MessageInterface::ShowMessage(
+                                 "INITIALIZING PathFunctionContainer ... \n");
+      #endif
+      funcData.back()->Initialize();
+   }
+
+   // Evaluate user functions and Jacobians at all of the points.  The points
+   // may be spread over several threads, each preparing its own input data;
+   // the results are collected below in point order.
+   pathFunctionManager->EvaluatePoints(numTimePts, pathFunctionInputData,
+         [&](Integer pt, FunctionInputData *inputData)
+         {
+            PreparePathFunction(meshIdxs[pt], stageIdxs[pt], tvTypes.at(pt),
+                                pt, inputData);
+         }, funcData);
+
    for (Integer pt = 0; pt < numTimePts; pt++)
    {
       // Extract info on the current mesh/stage point
-      Integer pointType   = tvTypes.at(pt);
-      Integer meshIdx     = transUtil->GetMeshIndex(pt); 
-      Integer stageIdx    = transUtil->GetStageIndex(pt);
+      Integer meshIdx     = meshIdxs[pt];
+      Integer stageIdx    = stageIdxs[pt];
       #ifdef DEBUG_PHASE_INIT
          MessageInterface::ShowMessage(
-                           "Before PreparePathFunction, meshIdx  = %d  ...\n",
+                           "Collecting results, meshIdx  = %d  ...\n",
                            meshIdx);
          MessageInterface::ShowMessage(
-                           "                            stageIdx = %d  ...\n",
+                           "                    stageIdx = %d  ...\n",
                            stageIdx);
       #endif
       IntegerArray tIdxs  = decVector->GetTimeIdxs();
@@ -3203,8 +3242,6 @@ void Phase::ComputePathFunctions()
                                                                stageIdx);
       IntegerArray clIdxs = decVector->GetControlIdxsAtMeshPoint(meshIdx,
                                                                  stageIdx);
-      // Prepare the user function data structures then call the
-      // user function
       #ifdef DEBUG_PHASE_INIT
          MessageInterface::ShowMessage("tIdxs  size = %d  ...\n",
                                        (Integer) tIdxs.size());
@@ -3212,27 +3249,6 @@ void Phase::ComputePathFunctions()
                                        (Integer) stIdxs.size());
          MessageInterface::ShowMessage("clIdxs size = %d  ...\n",
                                        (Integer) clIdxs.size());
-      #endif
-      PreparePathFunction(meshIdx,stageIdx,pointType,pt);
-      
-      // CREATING NEW ONE HERE????  Is that what we want to do?
-      funcData.push_back(new PathFunctionContainer());
-      #ifdef DEBUG_PHASE_INIT
-         MessageInterface::ShowMessage(
-                                 "INITIALIZING PathFunctionContainer ... \n");
-      #endif
-      funcData.back()->Initialize();
-
-      #ifdef DEBUG_PHASE_INIT
-         MessageInterface::ShowMessage("Calling EvaluateUserFunction with phaseNum = %d, pathFunctionInputData = <%p> ... \n",
-                                       pathFunctionInputData->GetPhaseNum(), pathFunctionInputData);
-      #endif
-      // Evaluate user functions and Jacobians
-      funcData.back() = pathFunctionManager->EvaluateUserFunction(
-                                      pathFunctionInputData,funcData.back());
-      funcData.back() = pathFunctionManager->EvaluateUserJacobian(
-                                      pathFunctionInputData,funcData.back()); 
-      #ifdef DEBUG_PHASE_INIT
          MessageInterface::ShowMessage(
                               "AFTER calling EvalUserF and EvaluUserJ ... \n");
          MessageInterface::ShowMessage("   dyn?  %s\n",
@@ -3252,7 +3268,7 @@ void Phase::ComputePathFunctions()
       #endif
       if (pathFunctionManager->HasDynFunctions())
       {
-         FunctionOutputData *dyn = funcData.back()->GetDynData();
+         FunctionOutputData *dyn = funcData.at(pt)->GetDynData();
          userDynFunctionData.push_back(dyn);
          dyn->SetNLPData(meshIdx, stageIdx, stIdxs, clIdxs, stcIdxs);
       }
@@ -3263,7 +3279,7 @@ void Phase::ComputePathFunctions()
       #endif
       if (pathFunctionManager->HasCostFunction())
       {
-         FunctionOutputData *cost = funcData.back()->GetCostData();
+         FunctionOutputData *cost = funcData.at(pt)->GetCostData();
          costIntFunctionData.push_back(cost);
          cost->SetNLPData(meshIdx, stageIdx, stIdxs, clIdxs, stcIdxs);
       }
@@ -3274,7 +3290,7 @@ void Phase::ComputePathFunctions()
       #endif
       if (pathFunctionManager->HasAlgFunctions())
       {
-         FunctionOutputData *alg = funcData.back()->GetAlgData();
+         FunctionOutputData *alg = funcData.at(pt)->GetAlgData();
          userAlgFunctionData.push_back(alg);
          alg->SetNLPData(meshIdx, stageIdx, stIdxs, clIdxs, stcIdxs);
       }
@@ -3863,6 +3879,32 @@ void Phase::SetInitialGuessFromGuessGen()
 //------------------------------------------------------------------------------
 void Phase::PreparePathFunction(Integer meshIdx,   Integer stageIdx,
                                 Integer pointType, Integer pointIdx)
+{
+   PreparePathFunction(meshIdx, stageIdx, pointType, pointIdx,
+                       pathFunctionInputData);
+}
+
+//------------------------------------------------------------------------------
+// void PreparePathFunction(Integer meshIdx,   Integer stageIdx,
+//                          Integer pointType, Integer pointIdx,
+//                          FunctionInputData *inputData)
+//------------------------------------------------------------------------------
+/**
+ * Prepares the input data for a user path function evaluation at a point.
+ * Only reads the phase data, so can be called for different input data
+ * objects at the same time.
+ *
+ * @param <meshIdx>    the mesh index
+ * @param <stageIdx>   the stage index
+ * @param <pointType>  the point type
+ * @param <pointIdx>   the point index
+ * @param <inputData>  the input data to fill
+ *
+ */
+//------------------------------------------------------------------------------
+void Phase::PreparePathFunction(Integer meshIdx,   Integer stageIdx,
+                                Integer pointType, Integer pointIdx,
+                                FunctionInputData *inputData)
 {
    #ifdef DEBUG_PHASE_PATH_INIT
       MessageInterface::ShowMessage("ENTERING PreparePathFunction\n");
@@ -3873,21 +3915,21 @@ void Phase::PreparePathFunction(Integer meshIdx,   Integer stageIdx,
    // Prepares user path function evaluation at a specific point
 
    // This function extracts the state, control, and time from decision vector
-   pathFunctionInputData->SetPhaseNum(phaseNum);
+   inputData->SetPhaseNum(phaseNum);
    if (pointType == 1 || pointType == 2)
    {
-      pathFunctionInputData->SetStateVector(
+      inputData->SetStateVector(
                              decVector->GetStateAtMeshPoint(meshIdx,stageIdx));
    }
    else
    {
       Rvector ones(GetNumStateVars());
       ones = ones * GmatMathConstants::QUIET_NAN;
-      pathFunctionInputData->SetStateVector(ones);
+      inputData->SetStateVector(ones);
    }
    if (pointType == 1 || pointType == 3)
    {
-      pathFunctionInputData->SetControlVector(
+      inputData->SetControlVector(
                              decVector->GetControlAtMeshPoint(meshIdx,
                                                               stageIdx));
    }
@@ -3895,12 +3937,12 @@ void Phase::PreparePathFunction(Integer meshIdx,   Integer stageIdx,
    {
       Rvector ones(GetNumControlVars());
       ones = ones * GmatMathConstants::QUIET_NAN;
-      pathFunctionInputData->SetControlVector(ones); 
+      inputData->SetControlVector(ones); 
    }
-   pathFunctionInputData->SetTime(transUtil->GetTimeAtMeshPoint(pointIdx));
+   inputData->SetTime(transUtil->GetTimeAtMeshPoint(pointIdx));
 
    // YK mod static params; is it right to place this line here?
-   pathFunctionInputData->SetStaticVector(decVector->GetStaticVector());
+   inputData->SetStaticVector(decVector->GetStaticVector());
 
    #ifdef DEBUG_PHASE_PATH_INIT
          MessageInterface::ShowMessage("LEAVING PreparePathFunction\n");
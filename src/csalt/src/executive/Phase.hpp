@@ -81,6 +81,8 @@ public:
    virtual void            SetNumControlVars(Integer toNum);
    
    virtual void            SetRelativeErrorTol(Real toNum);
+   /// Set the number of threads used to evaluate the path functions
+   virtual void            SetPathFunctionWorkers(Integer toNum);
 
 
    /// Get the number of state variables
@@ -283,6 +285,9 @@ protected:
 
    /// Sparse matrix: the Jacbian of the NLP cost (algebraic + quadrature)
    RSMatrix               nlpCostJacobian;
+   /// Sparse matrix: the Jacobian of the defect constraints, kept across
+   /// iterations so that its structure is only built once per mesh
+   RSMatrix               defectConJacobian;
    /// Sparse matrix: the sparsity pattern for the phase NLP contraints
    RSMatrix               conSparsityPattern;
    /// Sparse matrix: sparsity pattern for the cost function
@@ -398,6 +403,9 @@ protected:
    void     SetInitialGuessFromGuessGen();
    void     PreparePathFunction(Integer meshIdx,Integer stageIdx,
                                 Integer pointType, Integer pointIdx);
+   void     PreparePathFunction(Integer meshIdx,Integer stageIdx,
+                                Integer pointType, Integer pointIdx,
+                                FunctionInputData *inputData);
    
    void     InsertJacobianRowChunk(const RSMatrix &jacChunk,
                                    const IntegerArray &idxs);
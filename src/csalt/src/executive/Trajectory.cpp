@@ -17,6 +17,8 @@
 #include "SnoptOptimizer.hpp"
 #include "Trajectory.hpp"
 #include "MessageInterface.hpp"
+#include "WorkerPool.hpp"
+#include <algorithm>
 
 //#define DEBUG_BOUNDS
 //#define DEBUG_TRAJECTORY
@@ -74,7 +76,11 @@ Trajectory::Trajectory() :
    bestSolCostFunction    (std::numeric_limits<Real>::infinity()),
    csaltExecInterface     (NULL),
    csaltState             ("Initializing"),
-   applicationType        ("Console")
+   applicationType        ("Console"),
+   numPhaseWorkers        (1),
+   phasePool              (NULL),
+   phaseCopiesUnavailable (false),
+   hasIndependentPhases   (false)
 {
    pointFunctionManager = new UserPointFunctionManager();
    trajOptimizer        = new SnoptOptimizer(this);}
@@ -116,7 +122,11 @@ Trajectory::Trajectory(const Trajectory &copy) :
    bestSolCostFunction    (copy.bestSolCostFunction),
    csaltExecInterface     (copy.csaltExecInterface),
    csaltState             (copy.csaltState),
-   applicationType        (copy.applicationType)
+   applicationType        (copy.applicationType),
+   numPhaseWorkers        (copy.numPhaseWorkers),
+   phasePool              (NULL),
+   phaseCopiesUnavailable (false),
+   hasIndependentPhases   (false)
 {
    pointFunctionManager = new UserPointFunctionManager();
    trajOptimizer        = new SnoptOptimizer(this);
@@ -166,6 +176,14 @@ Trajectory& Trajectory::operator=(const Trajectory &copy)
    csaltState             = copy.csaltState;
    applicationType        = copy.applicationType;
 
+   // The copies of the path function belong to this object's phases
+   DeletePhasePathFunctions();
+   if (phasePool)
+      delete phasePool;
+   phasePool              = NULL;
+   numPhaseWorkers        = copy.numPhaseWorkers;
+   phaseCopiesUnavailable = false;
+
    // Need new ones of these
    if (pointFunctionManager)
       delete pointFunctionManager;
@@ -209,6 +227,9 @@ Trajectory::~Trajectory()
       delete pointFunction;
    }
    */
+   if (phasePool)
+      delete phasePool;
+   DeletePhasePathFunctions();
    if (trajOptimizer)
    {
       #ifdef DEBUG_DECONSTRUCT
@@ -1061,6 +1082,9 @@ RSMatrix Trajectory::GetJacobian()
    Integer funcIdxHigh = 0;
    RSMatrix jac = SparseMatrixUtil::GetSparsityPattern(&sparsityPattern, true);
    
+   // Bring the phase Jacobians up to date; the blocks are then inserted in
+   // phase order
+   EvaluatePhases();
 
    for (Integer phaseIdx = 0; phaseIdx < numPhases; phaseIdx++)
    {
@@ -1731,6 +1755,11 @@ void Trajectory::SetCostUpperBound(Real costUpper)
 //------------------------------------------------------------------------------
 void Trajectory::SetUserPathFunction(UserPathFunction *func)
 {
+   if (func != pathFunction)
+   {
+      DeletePhasePathFunctions();
+      phaseCopiesUnavailable = false;
+   }
    pathFunction = func;
 }
 
@@ -1877,6 +1906,50 @@ void Trajectory::SetInitialGuess()
    RealArray testBestDecVec = bestDecVec.GetRealArray();
 }
 
+//------------------------------------------------------------------------------
+// void SetNumPhaseWorkers(Integer toNum)
+//------------------------------------------------------------------------------
+/**
+ * Sets the number of threads used to evaluate the phases.  The default is 1;
+ * 0 or less selects the number of hardware threads.  Phases are evaluated
+ * concurrently only if the user path function implements
+ * UserPathFunction::Clone(), and the setting takes effect at the next
+ * initialization.  A phase evaluated on a pool thread evaluates its mesh
+ * points serially, so the threads of Phase::SetPathFunctionWorkers() are only
+ * used when the phases run on one thread; the settings do not multiply.
+ *
+ * @param <toNum>   the number of threads
+ *
+ */
+//------------------------------------------------------------------------------
+void Trajectory::SetNumPhaseWorkers(Integer toNum)
+{
+   if (toNum <= 0)
+      toNum = WorkerPool::GetHardwareThreadCount();
+   if (toNum == numPhaseWorkers)
+      return;
+
+   if (phasePool)
+      delete phasePool;
+   phasePool       = NULL;
+   numPhaseWorkers = toNum;
+}
+
+//------------------------------------------------------------------------------
+// Integer GetNumPhaseWorkers()
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of threads used to evaluate the phases
+ *
+ * @return   the number of threads
+ *
+ */
+//------------------------------------------------------------------------------
+Integer Trajectory::GetNumPhaseWorkers()
+{
+   return numPhaseWorkers;
+}
+
 //------------------------------------------------------------------------------
 // bool GetIfScaling()
 //------------------------------------------------------------------------------
@@ -2405,6 +2478,16 @@ void    Trajectory::InitializePhases()
    pathFunction->SetPhaseScaleUtilList(phaseScaleUtils);
    pointFunction->SetPhaseScaleUtilList(phaseScaleUtils);
 
+   // Give every phase after the first its own copy of the path function so
+   // that the phases can be evaluated concurrently.  The copies are remade
+   // so that they carry the current settings of the path function, and are
+   // configured like the path function itself.
+   DeletePhasePathFunctions();
+   hasIndependentPhases = (numPhaseWorkers > 1) && (numPhases > 1) &&
+                          CreatePhasePathFunctions();
+   for (UnsignedInt ii = 0; ii < phasePathFunctions.size(); ++ii)
+      phasePathFunctions[ii]->SetPhaseScaleUtilList(phaseScaleUtils);
+
    // Define an index to track location in the constraint vector
    Integer constraintStartIdx = 0;
    if (ifScaling)                  // ??
@@ -2435,7 +2518,10 @@ void    Trajectory::InitializePhases()
        currentPhase->Initialize();
        */
       //   currentPhase->SetGuessFunctionName(guessFunctionName);
-      currentPhase->SetPathFunction(pathFunction);
+      if (hasIndependentPhases && (phaseIdx > 0))
+         currentPhase->SetPathFunction(phasePathFunctions.at(phaseIdx - 1));
+      else
+         currentPhase->SetPathFunction(pathFunction);
 #ifdef DEBUG_TRAJECTORY_INIT
       MessageInterface::ShowMessage("------- now calling initialize on phase\n");
       std::cout << "------- now calling initialize on phase\n";
@@ -2525,11 +2611,13 @@ void    Trajectory::InitializePhases()
 //------------------------------------------------------------------------------
 Rvector Trajectory::GetConstraintVector()
 {
+   EvaluatePhases();
+
    // Loop over the phases and concatenate the constraint vectors
    RealArray conVec;
    for (Integer phaseIdx = 0; phaseIdx < numPhases; phaseIdx++)
    {
-      Rvector rv = phaseList.at(phaseIdx)->GetConstraintVector();
+      const Rvector &rv = phaseConVectors.at(phaseIdx);
       Integer sz = rv.GetSize();
       for (Integer ii = 0; ii < sz; ii++)
          conVec.push_back(rv[ii]);
@@ -2560,9 +2648,10 @@ Real Trajectory::GetCostFunction()
       Rvector cnlpf = pointFunctionManager->ComputeCostNLPFunctions();
       cf = cnlpf[0];
    }
+   EvaluatePhases();
    for (Integer phaseIdx = 0; phaseIdx < numPhases; phaseIdx++)
    {
-      cf += phaseList.at(phaseIdx)->GetCostFunction();
+      cf += phaseCostFunctions.at(phaseIdx);
    }
    
    // Set the cost function for use in partials
@@ -2570,6 +2659,103 @@ Real Trajectory::GetCostFunction()
    return costFunction;
 }
 
+//------------------------------------------------------------------------------
+// void EvaluatePhases()
+//------------------------------------------------------------------------------
+/**
+ * Brings the functions and Jacobians of every phase up to date for the
+ * current decision vector, and stores the constraint vector and cost function
+ * of each phase.
+ *
+ * When each phase has its own copy of the path function, the phases are
+ * spread over the thread pool.  A phase only touches its own data, so the
+ * results are written to per-phase slots and merged by the callers in phase
+ * order; the trajectory level arrays are the same for any number of threads.
+ * Point functions and linkage constraints couple the phases and are evaluated
+ * afterwards on the calling thread.  If a phase throws, the exception of the
+ * lowest numbered phase is rethrown once all phases have finished.
+ *
+ */
+//------------------------------------------------------------------------------
+void Trajectory::EvaluatePhases()
+{
+   phaseConVectors.resize(numPhases);
+   phaseCostFunctions.resize(numPhases);
+
+   if (!hasIndependentPhases || (numPhaseWorkers <= 1) || (numPhases <= 1))
+   {
+      for (Integer phaseIdx = 0; phaseIdx < numPhases; phaseIdx++)
+      {
+         Phase *phase = phaseList.at(phaseIdx);
+         phaseConVectors[phaseIdx]    = phase->GetConstraintVector();
+         phaseCostFunctions[phaseIdx] = phase->GetCostFunction();
+      }
+      return;
+   }
+
+   if (!phasePool)
+      phasePool = new WorkerPool(std::min(numPhaseWorkers, numPhases));
+
+   phasePool->Run(numPhases, [&](Integer phaseIdx, Integer)
+   {
+      Phase *phase = phaseList[phaseIdx];
+      phaseConVectors[phaseIdx]    = phase->GetConstraintVector();
+      phaseCostFunctions[phaseIdx] = phase->GetCostFunction();
+   });
+}
+
+//------------------------------------------------------------------------------
+// bool CreatePhasePathFunctions()
+//------------------------------------------------------------------------------
+/**
+ * Creates the copies of the path function used by phases 1 ... numPhases-1;
+ * phase 0 uses the path function itself.  The copies are made when the
+ * phases are initialized and kept across mesh refinements, and each is
+ * initialized by its phase.
+ *
+ * @return true if every phase has a path function of its own; false if the
+ *         path function cannot be copied
+ */
+//------------------------------------------------------------------------------
+bool Trajectory::CreatePhasePathFunctions()
+{
+   if (phaseCopiesUnavailable || (!pathFunction))
+      return false;
+
+   while ((Integer) phasePathFunctions.size() < numPhases - 1)
+   {
+      UserPathFunction *func = pathFunction->Clone();
+      if (!func)
+      {
+         DeletePhasePathFunctions();
+         phaseCopiesUnavailable = true;
+         MessageInterface::ShowMessage("*** WARNING *** The user path "
+               "function does not implement Clone(); phases will be "
+               "evaluated on one thread\n");
+         return false;
+      }
+      phasePathFunctions.push_back(func);
+   }
+
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// void DeletePhasePathFunctions()
+//------------------------------------------------------------------------------
+/**
+ * Deletes the copies of the path function made for the phases.  The phases
+ * are given their path functions again by InitializePhases().
+ */
+//------------------------------------------------------------------------------
+void Trajectory::DeletePhasePathFunctions()
+{
+   for (UnsignedInt ii = 0; ii < phasePathFunctions.size(); ii++)
+      delete phasePathFunctions[ii];
+   phasePathFunctions.clear();
+   hasIndependentPhases = false;
+}
+
 //------------------------------------------------------------------------------
 // void SetChunkIndexes()
 //------------------------------------------------------------------------------
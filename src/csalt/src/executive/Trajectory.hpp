@@ -43,6 +43,7 @@
 #include "ExecutionInterface.hpp"
 
 class SnoptOptimizer;
+class WorkerPool;
 class CSALT_API Trajectory
 {
 public:
@@ -121,6 +122,8 @@ public:
                                                bool toAllowance);
    virtual void                SetCostScaling(Real toScaling);
    virtual void                SetInitialGuess();
+   virtual void                SetNumPhaseWorkers(Integer toNum);
+   virtual Integer             GetNumPhaseWorkers();
    
    /// Methods to set SNOPT inputs
    virtual void                SetFeasibilityTolerances(const Rvector &tol);
@@ -300,6 +303,23 @@ protected:
    /// Note that SNOPT7 only uses jacobian
    RSMatrix             jacobian;
 
+   /// === data for concurrent phase evaluation
+
+   /// Number of threads used to evaluate the phases
+   Integer              numPhaseWorkers;
+   /// The thread pool, created on first use
+   WorkerPool           *phasePool;
+   /// Copies of the path function used by phases 1 ... numPhases-1
+   std::vector<UserPathFunction*> phasePathFunctions;
+   /// Set when the path function could not be copied for the phases
+   bool                 phaseCopiesUnavailable;
+   /// True when every phase evaluates its own path function
+   bool                 hasIndependentPhases;
+   /// Constraint vector of each phase, from the last EvaluatePhases() call
+   std::vector<Rvector> phaseConVectors;
+   /// Cost function of each phase, from the last EvaluatePhases() call
+   RealArray            phaseCostFunctions;
+
    /// Compute methods newly implemented by YK 2018.02.01
    //virtual Real                ComputeCostFunction();
    //virtual Rvector             ComputeAllConstraintFunctions();
@@ -311,6 +331,9 @@ protected:
    virtual void             CopyArrays(const Trajectory &copy);
    
    virtual void             InitializePhases();
+   virtual void             EvaluatePhases();
+   virtual bool             CreatePhasePathFunctions();
+   virtual void             DeletePhasePathFunctions();
    virtual Rvector          GetConstraintVector();
    virtual Real             GetCostFunction();
    virtual void             SetChunkIndexes();
@@ -35,6 +35,7 @@
 #include "LowThrustException.hpp"
 #include "StringUtil.hpp"
 #include <iostream>
+#include <typeinfo>
 
 //------------------------------------------------------------------------------
 // OrbitPathFunction()
@@ -57,7 +58,12 @@ OrbitPathFunction::OrbitPathFunction() :
  */
  //------------------------------------------------------------------------------
 OrbitPathFunction::OrbitPathFunction(const OrbitPathFunction &copy) :
-   UserPathFunction(copy)
+   UserPathFunction(copy),
+   phaseStateReps    (copy.phaseStateReps),
+   phaseControlReps  (copy.phaseControlReps),
+   phaseThrustModes  (copy.phaseThrustModes),
+   phaseIspVals      (copy.phaseIspVals),
+   phaseThrustVals   (copy.phaseThrustVals)
 {
 
 }
@@ -76,6 +82,12 @@ OrbitPathFunction& OrbitPathFunction::operator=(const OrbitPathFunction &copy)
 
    UserPathFunction::operator=(copy);
 
+   phaseStateReps   = copy.phaseStateReps;
+   phaseControlReps = copy.phaseControlReps;
+   phaseThrustModes = copy.phaseThrustModes;
+   phaseIspVals     = copy.phaseIspVals;
+   phaseThrustVals  = copy.phaseThrustVals;
+
    return *this;
 }
 
@@ -91,6 +103,53 @@ OrbitPathFunction::~OrbitPathFunction()
 
 }
 
+//------------------------------------------------------------------------------
+// UserPathFunction* Clone() const
+//------------------------------------------------------------------------------
+/**
+ * Returns a copy of this path function for evaluation on another thread.
+ * The copy shares only the phase scaling utilities, which it reads.
+ *
+ * Derived classes must override this method to be copied; for them it
+ * returns NULL, so that they are evaluated on one thread rather than as a
+ * sliced OrbitPathFunction.
+ *
+ * @return A new copy of this object, or NULL for derived classes
+ */
+//------------------------------------------------------------------------------
+UserPathFunction* OrbitPathFunction::Clone() const
+{
+   if (typeid(*this) != typeid(OrbitPathFunction))
+      return NULL;
+   return new OrbitPathFunction(*this);
+}
+
+//------------------------------------------------------------------------------
+// void EvaluateFunctions()
+//------------------------------------------------------------------------------
+/**
+ * Evaluates the orbit dynamics and the control magnitude constraint.
+ * Derived classes that add functions of their own call these from their
+ * override.
+ */
+//------------------------------------------------------------------------------
+void OrbitPathFunction::EvaluateFunctions()
+{
+   SetDynamics();
+   SetControlPathConstraint();
+}
+
+//------------------------------------------------------------------------------
+// void EvaluateJacobians()
+//------------------------------------------------------------------------------
+/**
+ * No analytic Jacobians are provided; they are finite differenced.
+ */
+//------------------------------------------------------------------------------
+void OrbitPathFunction::EvaluateJacobians()
+{
+}
+
 //------------------------------------------------------------------------------
 // void SetPhaseStateReps(StringArray stateReps)
 //------------------------------------------------------------------------------
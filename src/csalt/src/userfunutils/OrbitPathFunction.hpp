@@ -43,6 +43,11 @@ public:
    OrbitPathFunction& operator=(const OrbitPathFunction &copy);
    virtual ~OrbitPathFunction();
 
+   virtual UserPathFunction* Clone() const;
+
+   virtual void EvaluateFunctions();
+   virtual void EvaluateJacobians();
+
    virtual void SetPhaseStateReps(StringArray stateReps);
    virtual void SetPhaseControlReps(StringArray controlReps);
    virtual void SetPhaseThrustModes(StringArray thrustModes);
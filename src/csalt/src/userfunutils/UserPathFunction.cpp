@@ -79,6 +79,23 @@ UserPathFunction::~UserPathFunction()
 //   if (pfContainer)  delete pfContainer;
 }
 
+//------------------------------------------------------------------------------
+//  UserPathFunction* Clone() const
+//------------------------------------------------------------------------------
+/**
+ * This method returns a copy of the user path function for evaluation on
+ * another thread.  The copy must not share mutable state with this object.
+ * The default implementation returns NULL, meaning the function is not safe
+ * to evaluate concurrently; path functions are then evaluated on one thread.
+ *
+ * @return a new copy of this object, or NULL if copies are not supported
+ */
+//------------------------------------------------------------------------------
+UserPathFunction* UserPathFunction::Clone() const
+{
+   return NULL;
+}
+
 //------------------------------------------------------------------------------
 //  void Initialize(FunctionInputData     *pd,
 //                  PathFunctionContainer *pfc)
@@ -34,6 +34,8 @@ public:
    UserPathFunction& operator=(const UserPathFunction &copy);
    virtual ~UserPathFunction();
    
+   virtual UserPathFunction* Clone() const;
+   
    virtual void           Initialize(FunctionInputData     *pd,
                                      PathFunctionContainer *pfc);
    virtual PathFunctionContainer*
@@ -16,15 +16,18 @@
  */
 //------------------------------------------------------------------------------
 #include <cstdlib>   // for rand
+#include <algorithm> // for stable_sort
 #include "UserPathFunctionManager.hpp"
 #include "MessageInterface.hpp"
 #include "LowThrustException.hpp"
 #include "UserFunctionProperties.hpp"
+#include "WorkerPool.hpp"
 
 //#define DEBUG_MANAGER
 //#define DEBUG_MANAGER_VALUES
 //#define DEBUG_MANAGER_FUNCTIONS
 //#define DEBUG_WRITE_DATA
+//#define DEBUG_COLORING
 
 //------------------------------------------------------------------------------
 // public methods
@@ -36,7 +39,10 @@
 UserPathFunctionManager::UserPathFunctionManager() :
    UserFunctionManager(),
    paramData                      (NULL),
-   pfContainer                    (NULL)
+   pfContainer                    (NULL),
+   numWorkers                     (1),
+   workerPool                     (NULL),
+   workersUnavailable             (false)
 {
    
    for (Integer idx1 = UserFunction::DYNAMICS; 
@@ -85,7 +91,12 @@ UserPathFunctionManager::UserPathFunctionManager() :
 UserPathFunctionManager::UserPathFunctionManager(const UserPathFunctionManager &copy) :
    UserFunctionManager(copy),
    paramData                      (NULL),
-   pfContainer                    (NULL)
+   pfContainer                    (NULL),
+   columnGroups                   (copy.columnGroups),
+   patternRows                    (copy.patternRows),
+   numWorkers                     (copy.numWorkers),
+   workerPool                     (NULL),
+   workersUnavailable             (false)
 {
    hasFunctions.clear();
    numFunctions.clear();
@@ -100,10 +111,7 @@ UserPathFunctionManager::UserPathFunctionManager(const UserPathFunctionManager &
    jacPattern.clear();
    needsJacobianFiniteDiff.resize(UserFunction::ALLFUNCTIONS, UserFunction::ALLJACOBIANS, isPreserving);
 
-   for (Integer idx2 = UserFunction::STATE; idx2 < UserFunction::ALLJACOBIANS; idx2++)
-   {
-      numVars[idx2] = copy.numVars[idx2];
-   }
+   numVars = copy.numVars;
 
    for (Integer idx1 = UserFunction::DYNAMICS; idx1 < UserFunction::ALLFUNCTIONS; idx1++)
    {
@@ -141,8 +149,13 @@ UserPathFunctionManager& UserPathFunctionManager::operator=(
    
    UserFunctionManager::operator=(copy);
    
+   DeleteWorkers();
    paramData                      = NULL;
    pfContainer                    = NULL;
+   columnGroups                   = copy.columnGroups;
+   patternRows                    = copy.patternRows;
+   numWorkers                     = copy.numWorkers;
+   workersUnavailable             = false;
 
    hasFunctions.clear();
    numFunctions.clear();
@@ -157,10 +170,7 @@ UserPathFunctionManager& UserPathFunctionManager::operator=(
    jacPattern.clear();
    needsJacobianFiniteDiff.resize(UserFunction::ALLFUNCTIONS, UserFunction::ALLJACOBIANS, isPreserving);
 
-   for (Integer idx2 = UserFunction::STATE; idx2 < UserFunction::ALLJACOBIANS; idx2++)
-   {
-      numVars[idx2] = copy.numVars[idx2];
-   }
+   numVars = copy.numVars;
 
    for (Integer idx1 = UserFunction::DYNAMICS; idx1 < UserFunction::ALLFUNCTIONS; idx1++)
    {
@@ -204,6 +214,7 @@ UserPathFunctionManager::~UserPathFunctionManager()
 {
    // do I need to delete the functionData and the pfContainer here?
    // (probably not as they are passed in)
+   DeleteWorkers();
 }
 
 //------------------------------------------------------------------------------
@@ -228,6 +239,12 @@ void UserPathFunctionManager::Initialize(UserPathFunction          *uData,
 {
 
    isInitializing =true;
+   // The worker copies belong to the previous user function and problem size
+   DeleteWorkers();
+   workersUnavailable = false;
+   columnGroups.clear();
+   patternRows.clear();
+
    #ifdef DEBUG_MANAGER
       MessageInterface::ShowMessage("Entering UPFM::Initialize\n");
       MessageInterface::ShowMessage(
@@ -327,6 +344,9 @@ void UserPathFunctionManager::Initialize(UserPathFunction          *uData,
    #endif
    CheckIfNeedsFiniteDiffJacobian();
    
+   // Group the columns that can be perturbed together
+   ColorJacobianColumns();
+
    #ifdef DEBUG_MANAGER
       if (jacobian[DYNAMICS][STATE].IsSized())
       {
@@ -482,11 +502,8 @@ PathFunctionContainer* UserPathFunctionManager::EvaluateUserJacobian(
          MessageInterface::ShowMessage("   calling ComputeJacobian\n");
       #endif
       //TBD: compute only required jacobian based on fType
-         for (Integer idx1 = UserFunction::DYNAMICS; idx1< UserFunction::ALLFUNCTIONS; idx1++)
-      {
-         auto funcType = static_cast<UserFunction::FunctionType> (idx1);
-         ComputeAll(funcType, pData, fData);
-      }      
+      // One set of perturbations serves all of the function types
+      ComputeAll(UserFunction::ALLFUNCTIONS, pData, fData);
       
       #ifdef DEBUG_MANAGER
          MessageInterface::ShowMessage(
@@ -684,6 +701,108 @@ void UserPathFunctionManager::SetFunctionData(PathFunctionContainer *fData)
    pfContainer = fData;
 }
 
+//------------------------------------------------------------------------------
+// void EvaluatePoints(Integer numPoints, FunctionInputData *pData,
+//                     const PointSetup &setup,
+//                     std::vector<PathFunctionContainer*> &fData)
+//------------------------------------------------------------------------------
+/**
+ * This method evaluates the user functions and Jacobians at a set of points.
+ * For each point, setup fills the input data and the results are written to
+ * the point's container.  With more than one worker, the points are spread
+ * over the thread pool; the extra workers use copies of the user function
+ * made with UserPathFunction::Clone().  If the user function cannot be
+ * copied, or the call is made from a task of another WorkerPool (such as a
+ * phase evaluated by Trajectory), the points are evaluated in order on the
+ * calling thread.  Each point only writes its own container, so the results
+ * are the same either way.
+ *
+ * @param <numPoints>  the number of points
+ * @param <pData>      the input data used on the calling thread
+ * @param <setup>      fills the input data for a point; it is called from
+ *                     several threads at once, so may only read shared data
+ * @param <fData>      the containers, one per point
+ *
+ */
+//------------------------------------------------------------------------------
+void UserPathFunctionManager::EvaluatePoints(Integer numPoints,
+                                   FunctionInputData *pData,
+                                   const PointSetup &setup,
+                                   std::vector<PathFunctionContainer*> &fData)
+{
+   if ((Integer) fData.size() < numPoints)
+      throw LowThrustException("ERROR evaluating user path functions: "
+            "there are fewer function containers than points\n");
+
+   bool isParallel = (numWorkers > 1) && (numPoints > 1) &&
+                     (!isInitializing) && (!WorkerPool::IsInTask()) &&
+                     CreateWorkers(pData);
+
+   if (!isParallel)
+   {
+      for (Integer pt = 0; pt < numPoints; pt++)
+      {
+         setup(pt, pData);
+         fData[pt] = EvaluateUserFunction(pData, fData[pt]);
+         fData[pt] = EvaluateUserJacobian(pData, fData[pt]);
+      }
+      return;
+   }
+
+   // Worker 0 is the calling thread, and uses this manager
+   workerPool->Run(numPoints, [&](Integer pt, Integer worker)
+   {
+      UserPathFunctionManager *manager = this;
+      FunctionInputData       *input   = pData;
+      if (worker > 0)
+      {
+         manager = workerManagers[worker - 1];
+         input   = workerInputs[worker - 1];
+      }
+      setup(pt, input);
+      manager->EvaluateUserFunction(input, fData[pt]);
+      manager->EvaluateUserJacobian(input, fData[pt]);
+   });
+}
+
+//------------------------------------------------------------------------------
+// void SetNumWorkers(Integer workers)
+//------------------------------------------------------------------------------
+/**
+ * This method sets the number of threads EvaluatePoints() uses.  The default
+ * is 1; 0 or less selects the number of hardware threads.
+ *
+ * @param <workers>   the number of threads
+ *
+ */
+//------------------------------------------------------------------------------
+void UserPathFunctionManager::SetNumWorkers(Integer workers)
+{
+   if (workers <= 0)
+      workers = WorkerPool::GetHardwareThreadCount();
+   if (workers == numWorkers)
+      return;
+
+   DeleteWorkers();
+   workersUnavailable = false;
+   numWorkers = workers;
+}
+
+//------------------------------------------------------------------------------
+// Integer GetNumWorkers()
+//------------------------------------------------------------------------------
+/**
+ * This method returns the number of threads EvaluatePoints() uses
+ *
+ * @return   the number of threads
+ *
+ */
+//------------------------------------------------------------------------------
+Integer UserPathFunctionManager::GetNumWorkers()
+{
+   return numWorkers;
+}
+
 //------------------------------------------------------------------------------
 // protected methods
 //------------------------------------------------------------------------------
@@ -830,12 +949,22 @@ void UserPathFunctionManager::InitFunctionsData(UserFunction::FunctionType fType
    
 
 //------------------------------------------------------------------------------
-// void ComputeAll(FunctionInputData      *pData,
+// void ComputeAll(UserFunction::FunctionType fType,
+//                 FunctionInputData      *pData,
 //                 PathFunctionContainer  *fData, bool isComputingHess)
 //------------------------------------------------------------------------------
 /**
  * This method computes the first and second derivatives given the input data
  *
+ * Finite differenced Jacobians perturb the columns of each group built by
+ * ColorJacobianColumns() together, so a pass costs one function evaluation
+ * per group rather than one per variable.  With fType ALLFUNCTIONS, the
+ * evaluations are shared by all of the function types, unless perturbing for
+ * each type on its own takes fewer.  Entries outside the sparsity pattern
+ * are set to zero.  While initializing, or when no groups have been
+ * built, each variable is perturbed on its own and all entries are computed.
+ *
+ * @param <fType> the function type, or ALLFUNCTIONS for all of them
  * @param <pData> the input function data
  * @param <fData> the input path function container
  * @param <isComputingHess> do we need to handle hessian?
@@ -849,112 +978,189 @@ void UserPathFunctionManager::ComputeAll(UserFunction::FunctionType fType,
 {
    #ifdef DEBUG_MANAGER
       MessageInterface::ShowMessage(
-            "Entering UPFM::ComputeJacobian for %s with pData <%p>, fData <%p>\n",
-            FunctionTypeNames[fType].c_str(), pData, fData);
-      MessageInterface::ShowMessage(
-            "   and isInitializing = %s, needsJacobianFiniteDiff: %s = %s, %s = %s, %s = %s\n",
-            (isInitializing?  "true" : "false"),
-            JacobianTypeNames[STATE].c_str(),
-            (needsJacobianFiniteDiff(fType,STATE)?  "true" : "false"),
-            JacobianTypeNames[CONTROL].c_str(),
-            (needsJacobianFiniteDiff(fType, CONTROL) ? "true" : "false"),
-            JacobianTypeNames[TIME].c_str(),
-            (needsJacobianFiniteDiff(fType, TIME) ? "true" : "false"));
+            "Entering UPFM::ComputeAll for %d with pData <%p>, fData <%p>\n",
+            fType, pData, fData);
    #endif
    if ((!pData) || (!fData))
       throw LowThrustException(
-         "ERROR!  fData or pData passed into ComputeStateJacobian is NULL!\n");
+         "ERROR!  fData or pData passed into ComputeAll is NULL!\n");
+
+   // Collect the function types handled by this pass
+   std::vector<Integer> fTypes;
+   bool needsFiniteDiff = isInitializing;
+   for (Integer idx1 = UserFunction::DYNAMICS;
+        idx1 < UserFunction::ALLFUNCTIONS; idx1++)
+   {
+      if ((fType != UserFunction::ALLFUNCTIONS) && (idx1 != fType))
+         continue;
+      if (!hasFunctions[idx1])
+         continue;
+      fTypes.push_back(idx1);
+      for (Integer idx2 = UserFunction::STATE;
+           idx2 < UserFunction::ALLJACOBIANS; idx2++)
+         if (needsJacobianFiniteDiff(idx1, idx2))
+            needsFiniteDiff = true;
+   }
    // If not initializing and all Jacobians are provided, nothing to do
-   if ((!isInitializing) && (!needsJacobianFiniteDiff(fType, UserFunction::STATE))
-      && (!needsJacobianFiniteDiff(fType, UserFunction::CONTROL))
-      && (!needsJacobianFiniteDiff(fType, UserFunction::TIME))
-      && (!needsJacobianFiniteDiff(fType, UserFunction::STATIC)))
+   if (fTypes.empty() || !needsFiniteDiff)
       return;
-   // Save nominal values for later use
-   FunctionOutputData *funcPt;
-   std::vector<bool> hasUserJacobian;
-   hasUserJacobian = fData->GetData(fType)->HasUserJacobian();
-   funcPt = fData->GetData(fType);
 
-   Rvector nomValues = funcPt->GetFunctionValues();
+   // Save nominal values for later use
+   std::vector<FunctionOutputData*> funcPts;
+   std::vector<Rvector> nomValues;
+   for (UnsignedInt kk = 0; kk < fTypes.size(); kk++)
+   {
+      funcPts.push_back(fData->GetData(
+                        static_cast<UserFunction::FunctionType>(fTypes[kk])));
+      nomValues.push_back(funcPts[kk]->GetFunctionValues());
+   }
 
    Real nomTime = pData->GetTime();
    Rvector nomStateVector  = pData->GetStateVector();
    Rvector nomControlVector = pData->GetControlVector();
    Rvector nomStaticVector  = pData->GetStaticVector();
 
-   #ifdef DEBUG_MANAGER_VALUES
-      if (hasFunctions[COST])
-      MessageInterface::ShowMessage(
-                        "In ComputeJacobian, nominal %s Value = %s\n",
-                        FunctionTypeNames[fType].c_str(),
-                        nomValues.ToString(12).c_str());      
-   #endif
+   // The perturbation size; the user function perturbations are not used yet
+   Real pertSize = 1.0e-07;
 
    // loop-over through jacobian types
    for (Integer idx1 = UserFunction::STATE; idx1 < UserFunction::ALLJACOBIANS; idx1++)
    {
-      if (hasUserJacobian[idx1] && !isInitializing)
+      auto jacType = static_cast<UserFunction::JacobianType>(idx1);
+
+      // Find the function types that need this Jacobian finite differenced,
+      // and whether the column groups were built for all of them
+      std::vector<UnsignedInt> active;
+      bool isColored = (!isInitializing) &&
+                       ((Integer) columnGroups.size() > fType);
+      for (UnsignedInt kk = 0; kk < fTypes.size(); kk++)
       {
          // if there exists the user-provided jacobian, do nothing
-         continue;
+         if (funcPts[kk]->HasUserJacobian(jacType) && !isInitializing)
+            continue;
+         active.push_back(kk);
+         if (!needsJacobianFiniteDiff(fTypes[kk], idx1))
+            isColored = false;
       }
-      Integer numVars;
-      Real pertSize;
+      if (active.empty())
+         continue;
+
+      Integer numCols = numVars[idx1];
+      Rvector nomVars;
       if (idx1 == UserFunction::STATE)
-      {
-         numVars = numStateVars;
-         pertSize = userData->GetStatePerturbation();
-      }
+         nomVars = nomStateVector;
       if (idx1 == UserFunction::CONTROL)
+         nomVars = nomControlVector;
+      if (idx1 == UserFunction::TIME)
       {
-         numVars = numControlVars;
-         pertSize = userData->GetControlPerturbation();
+         nomVars.SetSize(1);
+         nomVars(0) = nomTime;
       }
-      if (idx1 == UserFunction::TIME)
+      if ((idx1 == UserFunction::STATIC) && (numCols > 0))
+         nomVars = nomStaticVector;
+
+      // The perturbation passes: the column groups, and the function types
+      // that each pass serves
+      std::vector<const std::vector<IntegerArray>*> passGroups;
+      std::vector<std::vector<UnsignedInt>> passTypes;
+      std::vector<IntegerArray> singleColumns;
+      if (isColored)
       {
-         numVars = 1;
-         pertSize = userData->GetTimePerturbation();
+         // Share the groups among the function types unless perturbing for
+         // each type on its own takes fewer evaluations
+         UnsignedInt separateCount = 0;
+         for (UnsignedInt kk = 0; kk < active.size(); kk++)
+            separateCount += columnGroups[fTypes[active[kk]]][idx1].size();
+         if ((active.size() > 1) &&
+             (separateCount < columnGroups[fType][idx1].size()))
+         {
+            for (UnsignedInt kk = 0; kk < active.size(); kk++)
+            {
+               passGroups.push_back(&columnGroups[fTypes[active[kk]]][idx1]);
+               passTypes.push_back(std::vector<UnsignedInt>(1, active[kk]));
+            }
+         }
+         else
+         {
+            passGroups.push_back(&columnGroups[fType][idx1]);
+            passTypes.push_back(active);
+         }
+
+         // Entries outside the pattern are not computed
+         for (UnsignedInt kk = 0; kk < active.size(); kk++)
+         {
+            Rmatrix &jac = jacobian[fTypes[active[kk]]][idx1];
+            Integer r, c;
+            jac.GetSize(r, c);
+            for (Integer rr = 0; rr < r; rr++)
+               for (Integer cc = 0; cc < c; cc++)
+                  jac(rr, cc) = 0.0;
+         }
       }
-      if (idx1 == UserFunction::STATIC)
+      else
       {
-         numVars = numStaticVars;
-         pertSize = userData->GetStaticPerturbation();
+         // Without groups, perturb one variable at a time
+         singleColumns.resize(numCols);
+         for (Integer ss = 0; ss < numCols; ss++)
+            singleColumns[ss].push_back(ss);
+         passGroups.push_back(&singleColumns);
+         passTypes.push_back(active);
       }
 
-      Rvector pertVector(numVars);
-      for (Integer ii = 0; ii < numVars; ii++)
-         pertVector(ii) = 1.0e-07;
-
-      // Loop over state values and perturb them
-
-
-      for (Integer ss = 0; ss < numVars; ss++)
+      for (UnsignedInt pp = 0; pp < passGroups.size(); pp++)
       {
-         // Perturb the state and recompute user functions
-         Rvector deltaVector(numVars);  // values are zeros by default
-         deltaVector(ss) = pertVector(ss);
-         if (idx1 == UserFunction::STATE)
-            pData->SetStateVector(nomStateVector + deltaVector);
-         if (idx1 == UserFunction::CONTROL)
-            pData->SetControlVector(nomControlVector + deltaVector);
-         if (idx1 == UserFunction::TIME)
-            pData->SetTime(nomTime + deltaVector[0]);
-         if (idx1 == UserFunction::STATIC)
-            pData->SetStaticVector(nomStaticVector + deltaVector);
-         
-         EvaluateUserFunction(pData, fData);
-
-         // Compute and save current row of Jacobian
-         Rvector pertValues = funcPt->GetFunctionValues();
-         Rvector jacValue = (pertValues - nomValues) / pertVector(ss);
-         for (Integer dd = 0; dd < numFunctions[fType]; dd++)
-            jacobian[fType][idx1](dd, ss) = jacValue(dd);
-         
-         if (isComputingHess == true)
+         const std::vector<IntegerArray> &groups = *passGroups[pp];
+         const std::vector<UnsignedInt>  &types  = passTypes[pp];
+         for (UnsignedInt gg = 0; gg < groups.size(); gg++)
          {
-            // do something for hessian here
-            // saving pertValues??
+            const IntegerArray &group = groups[gg];
+
+            // Perturb the variables of the group and recompute user functions
+            Rvector pertVars = nomVars;
+            for (UnsignedInt ii = 0; ii < group.size(); ii++)
+               pertVars(group[ii]) += pertSize;
+            if (idx1 == UserFunction::STATE)
+               pData->SetStateVector(pertVars);
+            if (idx1 == UserFunction::CONTROL)
+               pData->SetControlVector(pertVars);
+            if (idx1 == UserFunction::TIME)
+               pData->SetTime(pertVars(0));
+            if (idx1 == UserFunction::STATIC)
+               pData->SetStaticVector(pertVars);
+
+            EvaluateUserFunction(pData, fData);
+
+            // Compute and save the columns of the Jacobians; in a group, each
+            // function depends on at most one of the perturbed variables
+            for (UnsignedInt kk = 0; kk < types.size(); kk++)
+            {
+               Integer ff = fTypes[types[kk]];
+               const Rvector &nomVals = nomValues[types[kk]];
+               Rvector pertValues = funcPts[types[kk]]->GetFunctionValues();
+               Rmatrix &jac = jacobian[ff][idx1];
+               for (UnsignedInt ii = 0; ii < group.size(); ii++)
+               {
+                  Integer ss = group[ii];
+                  if (isColored)
+                  {
+                     const IntegerArray &rows = patternRows[ff][idx1][ss];
+                     for (UnsignedInt dd = 0; dd < rows.size(); dd++)
+                        jac(rows[dd], ss) = (pertValues(rows[dd]) -
+                                             nomVals(rows[dd])) / pertSize;
+                  }
+                  else
+                  {
+                     for (Integer dd = 0; dd < numFunctions[ff]; dd++)
+                        jac(dd, ss) = (pertValues(dd) - nomVals(dd)) / pertSize;
+                  }
+               }
+            }
+            
+            if (isComputingHess == true)
+            {
+               // do something for hessian here
+               // saving pertValues??
+            }
          }
       }
       
@@ -963,32 +1169,252 @@ void UserPathFunctionManager::ComputeAll(UserFunction::FunctionType fType,
       // analytic partials (for those provided) and avoids noise due to finite ??
       // of constratins that required it.
       if (idx1 == UserFunction::STATE)
-      {
          pData->SetStateVector(nomStateVector);
-         funcPt->SetJacobian(UserFunction::STATE, jacobian[fType][idx1]);
-      }
       if (idx1 == UserFunction::CONTROL)
-      {
          pData->SetControlVector(nomControlVector);
-         funcPt->SetJacobian(UserFunction::CONTROL, jacobian[fType][idx1]);
-      }
       if (idx1 == UserFunction::TIME)
-      {
          pData->SetTime(nomTime);
-         funcPt->SetJacobian(UserFunction::TIME, jacobian[fType][idx1]);
-      }
       if (idx1 == UserFunction::STATIC)
-      {
          pData->SetStaticVector(nomStaticVector);
-         funcPt->SetJacobian(UserFunction::STATIC, jacobian[fType][idx1]);
-      }
+      for (UnsignedInt kk = 0; kk < active.size(); kk++)
+         funcPts[active[kk]]->SetJacobian(jacType,
+                                          jacobian[fTypes[active[kk]]][idx1]);
    }  
 #ifdef DEBUG_MANAGER
-      MessageInterface::ShowMessage("EXITING UPFM::ComputeControlJacobian\n");
+      MessageInterface::ShowMessage("EXITING UPFM::ComputeAll\n");
 #endif
 }
 
 
+//------------------------------------------------------------------------------
+// void ColorJacobianColumns()
+//------------------------------------------------------------------------------
+/**
+ * This method groups the columns of the finite differenced Jacobians so that
+ * no two columns in a group have a nonzero in the same row of the sparsity
+ * pattern (Curtis, Powell and Reid).  The columns in a group can then be
+ * perturbed at the same time.  Groups are built for each function type on
+ * its own and, under ALLFUNCTIONS, for the rows of all of the function types
+ * stacked together.  Columns with no nonzeros are left out of every group.
+ */
+//------------------------------------------------------------------------------
+void UserPathFunctionManager::ColorJacobianColumns()
+{
+   columnGroups.clear();
+   patternRows.clear();
+   patternRows.resize(UserFunction::ALLFUNCTIONS);
+   columnGroups.resize(UserFunction::ALLFUNCTIONS + 1);
+
+   // Save the nonzero rows of each column of the patterns
+   for (Integer idx1 = UserFunction::DYNAMICS;
+        idx1 < UserFunction::ALLFUNCTIONS; idx1++)
+   {
+      patternRows[idx1].resize(UserFunction::ALLJACOBIANS);
+      if (!hasFunctions[idx1])
+         continue;
+      for (Integer idx2 = UserFunction::STATE;
+           idx2 < UserFunction::ALLJACOBIANS; idx2++)
+      {
+         patternRows[idx1][idx2].resize(numVars[idx2]);
+         for (Integer cc = 0; cc < numVars[idx2]; cc++)
+            for (Integer rr = 0; rr < numFunctions[idx1]; rr++)
+               if (jacPattern[idx1][idx2](rr, cc) != 0.0)
+                  patternRows[idx1][idx2][cc].push_back(rr);
+      }
+   }
+
+   for (Integer idx1 = UserFunction::DYNAMICS;
+        idx1 <= UserFunction::ALLFUNCTIONS; idx1++)
+   {
+      columnGroups[idx1].resize(UserFunction::ALLJACOBIANS);
+      for (Integer idx2 = UserFunction::STATE;
+           idx2 < UserFunction::ALLJACOBIANS; idx2++)
+      {
+         std::vector<Integer> fTypes;
+         for (Integer ff = UserFunction::DYNAMICS;
+              ff < UserFunction::ALLFUNCTIONS; ff++)
+         {
+            if ((idx1 != UserFunction::ALLFUNCTIONS) && (ff != idx1))
+               continue;
+            if (hasFunctions[ff] && needsJacobianFiniteDiff(ff, idx2))
+               fTypes.push_back(ff);
+         }
+         ColorColumns(fTypes, static_cast<UserFunction::JacobianType>(idx2),
+                      columnGroups[idx1][idx2]);
+
+         #ifdef DEBUG_COLORING
+            MessageInterface::ShowMessage("Function type %d, variable type "
+                  "%d: %d variables in %d groups\n", idx1, idx2,
+                  numVars[idx2], (Integer) columnGroups[idx1][idx2].size());
+         #endif
+      }
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void ColorColumns(const std::vector<Integer> &fTypes,
+//                   UserFunction::JacobianType jType,
+//                   std::vector<IntegerArray> &groups)
+//------------------------------------------------------------------------------
+/**
+ * This method builds the column groups for the stacked sparsity patterns of
+ * the input function types.  Columns are taken in order of decreasing number
+ * of nonzeros and placed in the first group that has none of their rows.
+ *
+ * @param <fTypes> the function types whose rows are stacked
+ * @param <jType>  the variable type of the columns
+ * @param <groups> the groups of column indexes, filled here
+ */
+//------------------------------------------------------------------------------
+void UserPathFunctionManager::ColorColumns(const std::vector<Integer> &fTypes,
+                                           UserFunction::JacobianType jType,
+                                           std::vector<IntegerArray> &groups)
+{
+   groups.clear();
+   Integer numCols = numVars[jType];
+   if (fTypes.empty() || (numCols <= 0))
+      return;
+
+   // Offsets of the function types in the stacked rows
+   IntegerArray offsets;
+   Integer numRows = 0;
+   for (UnsignedInt kk = 0; kk < fTypes.size(); kk++)
+   {
+      offsets.push_back(numRows);
+      numRows += numFunctions[fTypes[kk]];
+   }
+
+   IntegerArray counts(numCols, 0);
+   IntegerArray order;
+   for (Integer cc = 0; cc < numCols; cc++)
+   {
+      for (UnsignedInt kk = 0; kk < fTypes.size(); kk++)
+         counts[cc] += patternRows[fTypes[kk]][jType][cc].size();
+      if (counts[cc] > 0)
+         order.push_back(cc);
+   }
+   std::stable_sort(order.begin(), order.end(),
+                    [&counts](Integer a, Integer b)
+                    { return counts[a] > counts[b]; });
+
+   // Rows already used by each group
+   std::vector<std::vector<bool>> usedRows;
+   for (UnsignedInt ii = 0; ii < order.size(); ii++)
+   {
+      Integer cc = order[ii];
+      UnsignedInt gg = 0;
+      for (; gg < groups.size(); gg++)
+      {
+         bool fits = true;
+         for (UnsignedInt kk = 0; (kk < fTypes.size()) && fits; kk++)
+         {
+            const IntegerArray &rows = patternRows[fTypes[kk]][jType][cc];
+            for (UnsignedInt rr = 0; rr < rows.size(); rr++)
+            {
+               if (usedRows[gg][offsets[kk] + rows[rr]])
+               {
+                  fits = false;
+                  break;
+               }
+            }
+         }
+         if (fits)
+            break;
+      }
+
+      if (gg == groups.size())
+      {
+         groups.push_back(IntegerArray());
+         usedRows.push_back(std::vector<bool>(numRows, false));
+      }
+      groups[gg].push_back(cc);
+      for (UnsignedInt kk = 0; kk < fTypes.size(); kk++)
+      {
+         const IntegerArray &rows = patternRows[fTypes[kk]][jType][cc];
+         for (UnsignedInt rr = 0; rr < rows.size(); rr++)
+            usedRows[gg][offsets[kk] + rows[rr]] = true;
+      }
+   }
+
+   for (UnsignedInt gg = 0; gg < groups.size(); gg++)
+      std::sort(groups[gg].begin(), groups[gg].end());
+}
+
+
+//------------------------------------------------------------------------------
+// bool CreateWorkers(FunctionInputData *pData)
+//------------------------------------------------------------------------------
+/**
+ * This method creates the copies of the user function, the managers and the
+ * input data used by the extra workers of EvaluatePoints(), and the thread
+ * pool.  The copies are made once, after initialization.
+ *
+ * @param <pData> the input data copied for each worker
+ *
+ * @return true if the workers are ready; false if the user function cannot
+ *         be copied
+ */
+//------------------------------------------------------------------------------
+bool UserPathFunctionManager::CreateWorkers(FunctionInputData *pData)
+{
+   if (workerPool)
+      return true;
+   if (workersUnavailable || (!userData) || (!pData))
+      return false;
+
+   for (Integer ii = 1; ii < numWorkers; ii++)
+   {
+      UserPathFunction *func = userData->Clone();
+      if (!func)
+      {
+         DeleteWorkers();
+         workersUnavailable = true;
+         MessageInterface::ShowMessage("*** WARNING *** The user path "
+               "function does not implement Clone(); path functions will be "
+               "evaluated on one thread\n");
+         return false;
+      }
+      workerFunctions.push_back(func);
+
+      UserPathFunctionManager *manager = new UserPathFunctionManager(*this);
+      manager->userData   = func;
+      manager->numWorkers = 1;
+      workerManagers.push_back(manager);
+
+      workerInputs.push_back(new FunctionInputData(*pData));
+   }
+   workerPool = new WorkerPool(numWorkers);
+
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// void DeleteWorkers()
+//------------------------------------------------------------------------------
+/**
+ * This method deletes the thread pool and the worker copies.
+ */
+//------------------------------------------------------------------------------
+void UserPathFunctionManager::DeleteWorkers()
+{
+   if (workerPool)
+      delete workerPool;
+   workerPool = NULL;
+
+   for (UnsignedInt ii = 0; ii < workerManagers.size(); ii++)
+      delete workerManagers[ii];
+   for (UnsignedInt ii = 0; ii < workerFunctions.size(); ii++)
+      delete workerFunctions[ii];
+   for (UnsignedInt ii = 0; ii < workerInputs.size(); ii++)
+      delete workerInputs[ii];
+   workerManagers.clear();
+   workerFunctions.clear();
+   workerInputs.clear();
+}
+
+
 //------------------------------------------------------------------------------
 // void ComputeSparsityPatterns(FunctionInputData     *pData,
 //                              PathFunctionContainer *fData,
@@ -29,13 +29,18 @@
 #include "FunctionOutputData.hpp"
 // YK mod for hessian
 #include <boost/numeric/ublas/symmetric.hpp>
+#include <functional>
 
+class WorkerPool;
 
 class UserPathFunctionManager : public UserFunctionManager
 {
 public:
    // YK mod for hessian
 
+   /// Fills the input data for one point: the point index and the input data
+   typedef std::function<void(Integer, FunctionInputData*)> PointSetup;
+
    UserPathFunctionManager();
    UserPathFunctionManager(const UserPathFunctionManager &copy);
    UserPathFunctionManager& operator=(const UserPathFunctionManager &copy);
@@ -74,6 +79,13 @@ public:
    virtual void           SetParamData(FunctionInputData *pData);
    virtual void           SetFunctionData(PathFunctionContainer *fData);
    
+   virtual void           EvaluatePoints(Integer numPoints,
+                                   FunctionInputData *pData,
+                                   const PointSetup &setup,
+                                   std::vector<PathFunctionContainer*> &fData);
+   virtual void           SetNumWorkers(Integer workers);
+   virtual Integer        GetNumWorkers();
+   
 protected:
    
    /*
@@ -171,6 +183,26 @@ protected:
    */
    boost::numeric::ublas::matrix<bool> needsJacobianFiniteDiff;
 
+   /// Columns perturbed together when finite differencing,
+   /// columnGroups[fType][jType][group]; fType ALLFUNCTIONS holds the groups
+   /// shared by all function types that are finite differenced
+   std::vector<std::vector<std::vector<IntegerArray>>> columnGroups;
+   /// Rows of the nonzero Jacobian entries, patternRows[fType][jType][column]
+   std::vector<std::vector<std::vector<IntegerArray>>> patternRows;
+
+   /// Number of threads used to evaluate the points in EvaluatePoints()
+   Integer              numWorkers;
+   /// The thread pool, created on first use
+   WorkerPool           *workerPool;
+   /// Copies of the user function, one per extra worker
+   std::vector<UserPathFunction*>        workerFunctions;
+   /// Managers of the extra workers, evaluating the copies
+   std::vector<UserPathFunctionManager*> workerManagers;
+   /// Input data of the extra workers
+   std::vector<FunctionInputData*>       workerInputs;
+   /// Set when the user function could not be copied for the workers
+   bool                 workersUnavailable;
+
 
    /// protected methods
    /// Initialize member data
@@ -197,6 +229,16 @@ protected:
                            FunctionInputData        *pData,
                            PathFunctionContainer    *fData, bool isComputingHess = false);
 
+   /// Group the Jacobian columns for finite differencing
+   virtual void ColorJacobianColumns();
+   virtual void ColorColumns(const std::vector<Integer> &fTypes,
+                             UserFunction::JacobianType jType,
+                             std::vector<IntegerArray> &groups);
+
+   /// Manage the worker copies used by EvaluatePoints()
+   virtual bool CreateWorkers(FunctionInputData *pData);
+   virtual void DeleteWorkers();
+
    /// Compute sparsity patterns
    virtual void ComputeSparsityPatterns(FunctionInputData     *pData,
                                         PathFunctionContainer *fData,
@@ -0,0 +1,628 @@
+//------------------------------------------------------------------------------
+//                              SparseAssembler
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool.
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of The National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/16
+//
+/**
+ * Implementation of SparseAssembler, a sparse matrix with a fixed,
+ * preallocated nonzero pattern.
+ */
+//------------------------------------------------------------------------------
+#include <sstream>
+#include "SparseAssembler.hpp"
+#include "LowThrustException.hpp"
+#include "MessageInterface.hpp"
+
+//#define DEBUG_SPARSE_ASSEMBLER
+
+//------------------------------------------------------------------------------
+// public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// SparseAssembler()
+//------------------------------------------------------------------------------
+/**
+ * Default constructor; the assembler has no pattern until one is set
+ */
+//------------------------------------------------------------------------------
+SparseAssembler::SparseAssembler() :
+   numRows        (0),
+   numCols        (0),
+   isInitialized  (false),
+   qNonZeros      (0)
+{
+}
+
+//------------------------------------------------------------------------------
+// SparseAssembler(const SparseAssembler &copy)
+//------------------------------------------------------------------------------
+/**
+ * Copy constructor
+ *
+ * @param <copy> the assembler to copy
+ */
+//------------------------------------------------------------------------------
+SparseAssembler::SparseAssembler(const SparseAssembler &copy) :
+   numRows        (copy.numRows),
+   numCols        (copy.numCols),
+   rowStart       (copy.rowStart),
+   colIndex       (copy.colIndex),
+   values         (copy.values),
+   isInitialized  (copy.isInitialized),
+   constSlots     (copy.constSlots),
+   constValues    (copy.constValues),
+   termSlots      (copy.termSlots),
+   termQSlots     (copy.termQSlots),
+   termCoefs      (copy.termCoefs),
+   qNonZeros      (copy.qNonZeros)
+{
+}
+
+//------------------------------------------------------------------------------
+// SparseAssembler& operator=(const SparseAssembler &copy)
+//------------------------------------------------------------------------------
+/**
+ * Assignment operator
+ *
+ * @param <copy> the assembler to copy
+ *
+ * @return this assembler
+ */
+//------------------------------------------------------------------------------
+SparseAssembler& SparseAssembler::operator=(const SparseAssembler &copy)
+{
+   if (&copy == this)
+      return *this;
+
+   numRows       = copy.numRows;
+   numCols       = copy.numCols;
+   rowStart      = copy.rowStart;
+   colIndex      = copy.colIndex;
+   values        = copy.values;
+   isInitialized = copy.isInitialized;
+   constSlots    = copy.constSlots;
+   constValues   = copy.constValues;
+   termSlots     = copy.termSlots;
+   termQSlots    = copy.termQSlots;
+   termCoefs     = copy.termCoefs;
+   qNonZeros     = copy.qNonZeros;
+
+   return *this;
+}
+
+//------------------------------------------------------------------------------
+// ~SparseAssembler()
+//------------------------------------------------------------------------------
+/**
+ * Destructor
+ */
+//------------------------------------------------------------------------------
+SparseAssembler::~SparseAssembler()
+{
+}
+
+//------------------------------------------------------------------------------
+// void SetPattern(const RSMatrix *pattern)
+//------------------------------------------------------------------------------
+/**
+ * Sets the pattern to the stored elements of a sparse matrix.  Stored zeros
+ * are part of the pattern.
+ *
+ * @param <pattern> the matrix whose structure is used
+ */
+//------------------------------------------------------------------------------
+void SparseAssembler::SetPattern(const RSMatrix *pattern)
+{
+   Integer rows = (Integer) pattern->size1();
+   std::vector<IntegerArray> rowCols(rows);
+
+   for (RSMatrix::const_iterator1 i1 = pattern->begin1();
+        i1 != pattern->end1(); ++i1)
+   {
+      for (RSMatrix::const_iterator2 i2 = i1.begin(); i2 != i1.end(); ++i2)
+         rowCols[i2.index1()].push_back((Integer) i2.index2());
+   }
+
+   BuildPattern(rows, (Integer) pattern->size2(), rowCols);
+}
+
+//------------------------------------------------------------------------------
+// void SetPattern(Integer rows, Integer cols,
+//                 const IntegerArray &rowIdxVec,
+//                 const IntegerArray &colIdxVec)
+//------------------------------------------------------------------------------
+/**
+ * Sets the pattern from (row, column) triplet indices.  Repeated entries
+ * share one slot.
+ *
+ * @param <rows>      the number of rows
+ * @param <cols>      the number of columns
+ * @param <rowIdxVec> row index of each entry
+ * @param <colIdxVec> column index of each entry
+ */
+//------------------------------------------------------------------------------
+void SparseAssembler::SetPattern(Integer rows, Integer cols,
+                                 const IntegerArray &rowIdxVec,
+                                 const IntegerArray &colIdxVec)
+{
+   if (rowIdxVec.size() != colIdxVec.size())
+   {
+      std::stringstream errmsg("");
+      errmsg << "SparseAssembler::SetPattern: the row and column index ";
+      errmsg << "arrays do not have the same size";
+      throw LowThrustException(errmsg.str());
+   }
+
+   std::vector<IntegerArray> rowCols(rows);
+   for (UnsignedInt idx = 0; idx < rowIdxVec.size(); ++idx)
+   {
+      if ((rowIdxVec[idx] < 0) || (rowIdxVec[idx] >= rows) ||
+          (colIdxVec[idx] < 0) || (colIdxVec[idx] >= cols))
+      {
+         std::stringstream errmsg("");
+         errmsg << "SparseAssembler::SetPattern: entry (" << rowIdxVec[idx];
+         errmsg << ", " << colIdxVec[idx] << ") is outside of a " << rows;
+         errmsg << " x " << cols << " matrix";
+         throw LowThrustException(errmsg.str());
+      }
+      rowCols[rowIdxVec[idx]].push_back(colIdxVec[idx]);
+   }
+
+   BuildPattern(rows, cols, rowCols);
+}
+
+//------------------------------------------------------------------------------
+// void SetProductPattern(const RSMatrix *aMat, const RSMatrix *bMat,
+//                        const SparseAssembler &qPattern)
+//------------------------------------------------------------------------------
+/**
+ * Sets the pattern to that of A + B*Q and records the terms of the product,
+ * so that ComputeProduct() can evaluate it for new values of Q.  The values
+ * of A and B are captured here; the plan must be rebuilt if they change.
+ *
+ * @param <aMat>     the constant A matrix
+ * @param <bMat>     the constant B matrix
+ * @param <qPattern> an assembler holding the pattern of Q
+ */
+//------------------------------------------------------------------------------
+void SparseAssembler::SetProductPattern(const RSMatrix *aMat,
+                                        const RSMatrix *bMat,
+                                        const SparseAssembler &qPattern)
+{
+   Integer rows = (Integer) aMat->size1();
+   Integer cols = (Integer) aMat->size2();
+
+   if (((Integer) bMat->size1() != rows) ||
+       ((Integer) bMat->size2() != qPattern.numRows) ||
+       (qPattern.numCols != cols))
+   {
+      std::stringstream errmsg("");
+      errmsg << "SparseAssembler::SetProductPattern: dimension mismatch ";
+      errmsg << "between the A, B, and Q matrices";
+      throw LowThrustException(errmsg.str());
+   }
+
+   // Pattern of A, then the columns each B(i,k) pulls in from row k of Q
+   std::vector<IntegerArray> rowCols(rows);
+   for (RSMatrix::const_iterator1 i1 = aMat->begin1();
+        i1 != aMat->end1(); ++i1)
+   {
+      for (RSMatrix::const_iterator2 i2 = i1.begin(); i2 != i1.end(); ++i2)
+         rowCols[i2.index1()].push_back((Integer) i2.index2());
+   }
+   for (RSMatrix::const_iterator1 i1 = bMat->begin1();
+        i1 != bMat->end1(); ++i1)
+   {
+      for (RSMatrix::const_iterator2 i2 = i1.begin(); i2 != i1.end(); ++i2)
+      {
+         Integer k = (Integer) i2.index2();
+         IntegerArray &rowColumns = rowCols[i2.index1()];
+         rowColumns.insert(rowColumns.end(),
+                           qPattern.colIndex.begin() + qPattern.rowStart[k],
+                           qPattern.colIndex.begin() + qPattern.rowStart[k+1]);
+      }
+   }
+
+   BuildPattern(rows, cols, rowCols);
+
+   // Record the product terms in row order
+   for (RSMatrix::const_iterator1 i1 = aMat->begin1();
+        i1 != aMat->end1(); ++i1)
+   {
+      for (RSMatrix::const_iterator2 i2 = i1.begin(); i2 != i1.end(); ++i2)
+      {
+         constSlots.push_back(GetSlot((Integer) i2.index1(),
+                                      (Integer) i2.index2()));
+         constValues.push_back(*i2);
+      }
+   }
+   for (RSMatrix::const_iterator1 i1 = bMat->begin1();
+        i1 != bMat->end1(); ++i1)
+   {
+      for (RSMatrix::const_iterator2 i2 = i1.begin(); i2 != i1.end(); ++i2)
+      {
+         Integer rowIdx = (Integer) i2.index1();
+         Integer k      = (Integer) i2.index2();
+         for (Integer qSlot = qPattern.rowStart[k];
+              qSlot < qPattern.rowStart[k + 1]; ++qSlot)
+         {
+            termSlots.push_back(GetSlot(rowIdx, qPattern.colIndex[qSlot]));
+            termQSlots.push_back(qSlot);
+            termCoefs.push_back(*i2);
+         }
+      }
+   }
+   qNonZeros = qPattern.GetNumNonZeros();
+
+   #ifdef DEBUG_SPARSE_ASSEMBLER
+      MessageInterface::ShowMessage(
+            "SparseAssembler::SetProductPattern: %d x %d, %d nonzeros, "
+            "%d constant terms, %d product terms\n", numRows, numCols,
+            GetNumNonZeros(), (Integer) constSlots.size(),
+            (Integer) termSlots.size());
+   #endif
+}
+
+//------------------------------------------------------------------------------
+// void Clear()
+//------------------------------------------------------------------------------
+/**
+ * Removes the pattern and any product plan
+ */
+//------------------------------------------------------------------------------
+void SparseAssembler::Clear()
+{
+   numRows = 0;
+   numCols = 0;
+   rowStart.clear();
+   colIndex.clear();
+   values.clear();
+   constSlots.clear();
+   constValues.clear();
+   termSlots.clear();
+   termQSlots.clear();
+   termCoefs.clear();
+   qNonZeros = 0;
+   isInitialized = false;
+}
+
+//------------------------------------------------------------------------------
+// bool IsInitialized() const
+//------------------------------------------------------------------------------
+/**
+ * Returns true once a pattern has been set
+ *
+ * @return true if the pattern is set
+ */
+//------------------------------------------------------------------------------
+bool SparseAssembler::IsInitialized() const
+{
+   return isInitialized;
+}
+
+//------------------------------------------------------------------------------
+// Integer GetNumRows() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of rows
+ *
+ * @return the number of rows
+ */
+//------------------------------------------------------------------------------
+Integer SparseAssembler::GetNumRows() const
+{
+   return numRows;
+}
+
+//------------------------------------------------------------------------------
+// Integer GetNumColumns() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of columns
+ *
+ * @return the number of columns
+ */
+//------------------------------------------------------------------------------
+Integer SparseAssembler::GetNumColumns() const
+{
+   return numCols;
+}
+
+//------------------------------------------------------------------------------
+// Integer GetNumNonZeros() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of entries in the pattern
+ *
+ * @return the number of nonzeros
+ */
+//------------------------------------------------------------------------------
+Integer SparseAssembler::GetNumNonZeros() const
+{
+   return (Integer) colIndex.size();
+}
+
+//------------------------------------------------------------------------------
+// Integer GetSlot(Integer rowIdx, Integer colIdx) const
+//------------------------------------------------------------------------------
+/**
+ * Returns the position of an element in the value array
+ *
+ * @param <rowIdx> the row index
+ * @param <colIdx> the column index
+ *
+ * @return the slot, or -1 if the element is not in the pattern
+ */
+//------------------------------------------------------------------------------
+Integer SparseAssembler::GetSlot(Integer rowIdx, Integer colIdx) const
+{
+   if ((rowIdx < 0) || (rowIdx >= numRows))
+      return -1;
+
+   IntegerArray::const_iterator first = colIndex.begin() + rowStart[rowIdx];
+   IntegerArray::const_iterator last  = colIndex.begin() + rowStart[rowIdx+1];
+   IntegerArray::const_iterator found = std::lower_bound(first, last, colIdx);
+
+   if ((found == last) || (*found != colIdx))
+      return -1;
+   return (Integer) (found - colIndex.begin());
+}
+
+//------------------------------------------------------------------------------
+// void Zero()
+//------------------------------------------------------------------------------
+/**
+ * Sets every value in the pattern to zero
+ */
+//------------------------------------------------------------------------------
+void SparseAssembler::Zero()
+{
+   std::fill(values.begin(), values.end(), 0.0);
+}
+
+//------------------------------------------------------------------------------
+// bool SetValue(Integer rowIdx, Integer colIdx, Real value)
+//------------------------------------------------------------------------------
+/**
+ * Sets the value of an element in the pattern
+ *
+ * @param <rowIdx> the row index
+ * @param <colIdx> the column index
+ * @param <value>  the value
+ *
+ * @return true if the element is in the pattern; otherwise the value is
+ *         dropped
+ */
+//------------------------------------------------------------------------------
+bool SparseAssembler::SetValue(Integer rowIdx, Integer colIdx, Real value)
+{
+   Integer slot = GetSlot(rowIdx, colIdx);
+   if (slot < 0)
+      return false;
+   values[slot] = value;
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// bool AddValue(Integer rowIdx, Integer colIdx, Real value)
+//------------------------------------------------------------------------------
+/**
+ * Adds to the value of an element in the pattern
+ *
+ * @param <rowIdx> the row index
+ * @param <colIdx> the column index
+ * @param <value>  the value to add
+ *
+ * @return true if the element is in the pattern; otherwise the value is
+ *         dropped
+ */
+//------------------------------------------------------------------------------
+bool SparseAssembler::AddValue(Integer rowIdx, Integer colIdx, Real value)
+{
+   Integer slot = GetSlot(rowIdx, colIdx);
+   if (slot < 0)
+      return false;
+   values[slot] += value;
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// void SetValues(const RSMatrix *mat)
+//------------------------------------------------------------------------------
+/**
+ * Loads the values of a sparse matrix.  Elements of the pattern that are not
+ * stored in the matrix are set to zero, and stored elements outside of the
+ * pattern are dropped.
+ *
+ * @param <mat> the matrix to load; it must have the dimensions of the pattern
+ */
+//------------------------------------------------------------------------------
+void SparseAssembler::SetValues(const RSMatrix *mat)
+{
+   if (((Integer) mat->size1() != numRows) ||
+       ((Integer) mat->size2() != numCols))
+   {
+      std::stringstream errmsg("");
+      errmsg << "SparseAssembler::SetValues: the matrix is ";
+      errmsg << mat->size1() << " x " << mat->size2();
+      errmsg << ", but the pattern is " << numRows << " x " << numCols;
+      throw LowThrustException(errmsg.str());
+   }
+
+   Zero();
+   for (RSMatrix::const_iterator1 i1 = mat->begin1(); i1 != mat->end1(); ++i1)
+   {
+      for (RSMatrix::const_iterator2 i2 = i1.begin(); i2 != i1.end(); ++i2)
+         SetValue((Integer) i2.index1(), (Integer) i2.index2(), *i2);
+   }
+}
+
+//------------------------------------------------------------------------------
+// Real* GetValues()
+//------------------------------------------------------------------------------
+/**
+ * Returns the value array, in pattern order
+ *
+ * @return pointer to the first value
+ */
+//------------------------------------------------------------------------------
+Real* SparseAssembler::GetValues()
+{
+   return values.empty() ? NULL : &values[0];
+}
+
+//------------------------------------------------------------------------------
+// const Real* GetValues() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the value array, in pattern order
+ *
+ * @return pointer to the first value
+ */
+//------------------------------------------------------------------------------
+const Real* SparseAssembler::GetValues() const
+{
+   return values.empty() ? NULL : &values[0];
+}
+
+//------------------------------------------------------------------------------
+// void ComputeProduct(const SparseAssembler &qMat)
+//------------------------------------------------------------------------------
+/**
+ * Evaluates A + B*Q with the plan built by SetProductPattern()
+ *
+ * @param <qMat> Q, with the pattern passed to SetProductPattern()
+ */
+//------------------------------------------------------------------------------
+void SparseAssembler::ComputeProduct(const SparseAssembler &qMat)
+{
+   if (!isInitialized || (qMat.GetNumNonZeros() != qNonZeros))
+   {
+      std::stringstream errmsg("");
+      errmsg << "SparseAssembler::ComputeProduct: the product pattern has ";
+      errmsg << "not been set for this Q matrix";
+      throw LowThrustException(errmsg.str());
+   }
+
+   Zero();
+   for (UnsignedInt idx = 0; idx < constSlots.size(); ++idx)
+      values[constSlots[idx]] += constValues[idx];
+   for (UnsignedInt idx = 0; idx < termSlots.size(); ++idx)
+      values[termSlots[idx]] += termCoefs[idx] * qMat.values[termQSlots[idx]];
+}
+
+//------------------------------------------------------------------------------
+// void CopyToMatrix(RSMatrix &mat) const
+//------------------------------------------------------------------------------
+/**
+ * Writes the pattern and values into a sparse matrix.  When the matrix
+ * already has the structure of the pattern only the values are copied;
+ * otherwise its contents are replaced.
+ *
+ * @param <mat> the matrix to fill
+ */
+//------------------------------------------------------------------------------
+void SparseAssembler::CopyToMatrix(RSMatrix &mat) const
+{
+   if (!MatchesMatrix(mat))
+   {
+      #ifdef DEBUG_SPARSE_ASSEMBLER
+         MessageInterface::ShowMessage(
+               "SparseAssembler::CopyToMatrix: building %d x %d structure\n",
+               numRows, numCols);
+      #endif
+      mat.resize(numRows, numCols, false);
+      mat.clear();
+      mat.reserve(colIndex.size(), false);
+      for (Integer rowIdx = 0; rowIdx < numRows; ++rowIdx)
+      {
+         for (Integer slot = rowStart[rowIdx]; slot < rowStart[rowIdx + 1];
+              ++slot)
+            mat.push_back(rowIdx, colIndex[slot], values[slot]);
+      }
+      mat.complete_index1_data();
+      return;
+   }
+
+   std::copy(values.begin(), values.end(), mat.value_data().begin());
+}
+
+//------------------------------------------------------------------------------
+// protected methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// void BuildPattern(Integer rows, Integer cols,
+//                   std::vector<IntegerArray> &rowCols)
+//------------------------------------------------------------------------------
+/**
+ * Builds the compressed row pattern and clears any product plan
+ *
+ * @param <rows>    the number of rows
+ * @param <cols>    the number of columns
+ * @param <rowCols> the columns in each row, in any order; sorted on return
+ */
+//------------------------------------------------------------------------------
+void SparseAssembler::BuildPattern(Integer rows, Integer cols,
+                                   std::vector<IntegerArray> &rowCols)
+{
+   Clear();
+   numRows = rows;
+   numCols = cols;
+
+   rowStart.resize(rows + 1);
+   rowStart[0] = 0;
+   for (Integer rowIdx = 0; rowIdx < rows; ++rowIdx)
+   {
+      IntegerArray &rc = rowCols[rowIdx];
+      std::sort(rc.begin(), rc.end());
+      rc.erase(std::unique(rc.begin(), rc.end()), rc.end());
+      rowStart[rowIdx + 1] = rowStart[rowIdx] + (Integer) rc.size();
+   }
+
+   colIndex.reserve(rowStart[rows]);
+   for (Integer rowIdx = 0; rowIdx < rows; ++rowIdx)
+      colIndex.insert(colIndex.end(), rowCols[rowIdx].begin(),
+                      rowCols[rowIdx].end());
+   values.assign(colIndex.size(), 0.0);
+
+   isInitialized = true;
+}
+
+//------------------------------------------------------------------------------
+// bool MatchesMatrix(const RSMatrix &mat) const
+//------------------------------------------------------------------------------
+/**
+ * Checks if a sparse matrix stores exactly the elements of the pattern, in
+ * pattern order
+ *
+ * @param <mat> the matrix to check
+ *
+ * @return true if the structures are the same
+ */
+//------------------------------------------------------------------------------
+bool SparseAssembler::MatchesMatrix(const RSMatrix &mat) const
+{
+   if (((Integer) mat.size1() != numRows) ||
+       ((Integer) mat.size2() != numCols) ||
+       ((Integer) mat.filled1() != numRows + 1) ||
+       (mat.filled2() != colIndex.size()))
+      return false;
+
+   for (Integer rowIdx = 0; rowIdx <= numRows; ++rowIdx)
+      if ((Integer) mat.index1_data()[rowIdx] != rowStart[rowIdx])
+         return false;
+   for (UnsignedInt slot = 0; slot < colIndex.size(); ++slot)
+      if ((Integer) mat.index2_data()[slot] != colIndex[slot])
+         return false;
+
+   return true;
+}
@@ -0,0 +1,108 @@
+//------------------------------------------------------------------------------
+//                              SparseAssembler
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool.
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of The National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/16
+//
+/**
+ * Declares SparseAssembler, a sparse matrix with a fixed, preallocated
+ * nonzero pattern.
+ */
+//------------------------------------------------------------------------------
+#ifndef SparseAssembler_hpp
+#define SparseAssembler_hpp
+
+#include "csaltdefs.hpp"
+#include "SparseMatrixUtil.hpp"
+
+/**
+ * Sparse matrix whose nonzero pattern is set once and whose values live in a
+ * single contiguous array
+ *
+ * The pattern is stored in compressed row form, the layout of RSMatrix, and
+ * is built from an RSMatrix, from (row, column) triplets, or as the pattern
+ * of A + B*Q for fixed A and B.  After that, values are written in place by
+ * (row, column) or by slot, and nothing is allocated until the pattern is
+ * set again.  Writes outside the pattern are ignored; the NLP sparsity
+ * pattern is fixed for a mesh, so such values never reach the optimizer.
+ *
+ * For a product pattern, SetProductPattern() also records every term of
+ * A + B*Q, so ComputeProduct() evaluates the product with one pass over a
+ * flat list instead of a sparse matrix multiply.  CopyToMatrix() writes the
+ * values into an RSMatrix, and only rebuilds the matrix structure when it
+ * does not already match the pattern.
+ */
+class CSALT_API SparseAssembler
+{
+public:
+   SparseAssembler();
+   SparseAssembler(const SparseAssembler &copy);
+   SparseAssembler& operator=(const SparseAssembler &copy);
+   virtual ~SparseAssembler();
+
+   /// Pattern setup
+   void           SetPattern(const RSMatrix *pattern);
+   void           SetPattern(Integer rows, Integer cols,
+                             const IntegerArray &rowIdxVec,
+                             const IntegerArray &colIdxVec);
+   void           SetProductPattern(const RSMatrix *aMat,
+                                    const RSMatrix *bMat,
+                                    const SparseAssembler &qPattern);
+   void           Clear();
+
+   bool           IsInitialized() const;
+   Integer        GetNumRows() const;
+   Integer        GetNumColumns() const;
+   Integer        GetNumNonZeros() const;
+   Integer        GetSlot(Integer rowIdx, Integer colIdx) const;
+
+   /// Value access
+   void           Zero();
+   bool           SetValue(Integer rowIdx, Integer colIdx, Real value);
+   bool           AddValue(Integer rowIdx, Integer colIdx, Real value);
+   void           SetValues(const RSMatrix *mat);
+   Real*          GetValues();
+   const Real*    GetValues() const;
+
+   void           ComputeProduct(const SparseAssembler &qMat);
+   void           CopyToMatrix(RSMatrix &mat) const;
+
+protected:
+   /// Number of rows
+   Integer        numRows;
+   /// Number of columns
+   Integer        numCols;
+   /// Start of each row in colIndex and values; numRows + 1 entries
+   IntegerArray   rowStart;
+   /// Column of each nonzero, sorted within each row
+   IntegerArray   colIndex;
+   /// Nonzero values, in the same order as colIndex
+   RealArray      values;
+   /// True once a pattern has been set
+   bool           isInitialized;
+
+   /// Slots filled by the A term of a product pattern
+   IntegerArray   constSlots;
+   /// Values of the A term, one per entry of constSlots
+   RealArray      constValues;
+   /// Target slot of each B*Q term
+   IntegerArray   termSlots;
+   /// Slot in Q of each B*Q term
+   IntegerArray   termQSlots;
+   /// B value of each B*Q term
+   RealArray      termCoefs;
+   /// Number of nonzeros the Q pattern had when the product plan was built
+   Integer        qNonZeros;
+
+   void           BuildPattern(Integer rows, Integer cols,
+                               std::vector<IntegerArray> &rowCols);
+   bool           MatchesMatrix(const RSMatrix &mat) const;
+};
+
+#endif // SparseAssembler_hpp
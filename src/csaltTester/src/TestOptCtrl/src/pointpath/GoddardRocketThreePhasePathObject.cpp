@@ -78,6 +78,19 @@ GoddardRocketThreePhasePathObject& GoddardRocketThreePhasePathObject::operator=(
    return *this;
 }
 
+//------------------------------------------------------------------------------
+// UserPathFunction* Clone() const
+//------------------------------------------------------------------------------
+/**
+ * The object has no state of its own, so a copy can be evaluated on another
+ * thread.
+ */
+//------------------------------------------------------------------------------
+UserPathFunction* GoddardRocketThreePhasePathObject::Clone() const
+{
+   return new GoddardRocketThreePhasePathObject(*this);
+}
+
 //------------------------------------------------------------------------------
 // void EvaluateFunctions()
 //-----------------------------------------------------------------------------
@@ -43,6 +43,7 @@ public:
    GoddardRocketThreePhasePathObject(const GoddardRocketThreePhasePathObject &copy);
    GoddardRocketThreePhasePathObject& operator=(const GoddardRocketThreePhasePathObject &copy);
    
+   UserPathFunction* Clone() const;
    void EvaluateFunctions();
    void EvaluateJacobians();
 };
@@ -1239,6 +1239,22 @@ void FileManager::ReadStartupFile(const std::string &fileName)
             GmatGlobal::Instance()->SetWriteParameterInfo(true);
          }
       }
+      else if (type == "DEBUG_PARAMETER_LOOKUP")
+      {
+         if (name == "ON")
+         {
+            mWriteParameterLookupStats = name;
+            GmatGlobal::Instance()->SetWriteParameterLookupStats(true);
+         }
+      }
+      else if (type == "DEBUG_FUNCTION_CALLS")
+      {
+         if (name == "ON")
+         {
+            mWriteFunctionCallStats = name;
+            GmatGlobal::Instance()->SetWriteFunctionCallStats(true);
+         }
+      }
       else if (type == "DEBUG_FILE_PATH")
       {
          if (name == "ON")
@@ -1481,6 +1497,10 @@ void FileManager::WriteStartupFile(const std::string &fileName)
       #endif
       outStream << std::setw(22) << "DEBUG_PARAMETERS" << " = " << mWriteParameterInfo << "\n";
    }
+   if (mWriteParameterLookupStats != "")
+      outStream << std::setw(22) << "DEBUG_PARAMETER_LOOKUP" << " = " << mWriteParameterLookupStats << "\n";
+   if (mWriteFunctionCallStats != "")
+      outStream << std::setw(22) << "DEBUG_FUNCTION_CALLS" << " = " << mWriteFunctionCallStats << "\n";
    
    if (mRunMode != "" || mPlotMode != "" || mMatlabMode != "" ||
        mDebugMatlab != "" || mDebugMissionTree != "" || mWriteParameterInfo != "")
@@ -3602,6 +3622,8 @@ void FileManager::RefreshFiles()
    mDebugMatlab = "";
    mDebugMissionTree = "";
    mWriteParameterInfo = "";
+   mWriteParameterLookupStats = "";
+   mWriteFunctionCallStats = "";
    mWriteFilePathInfo = "";
    mWriteGmatKeyword = "";
    mLastFilePathMessage = "";
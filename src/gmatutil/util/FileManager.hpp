@@ -276,6 +276,8 @@ private:
    std::string mDebugMatlab;
    std::string mDebugMissionTree;
    std::string mWriteParameterInfo;
+   std::string mWriteParameterLookupStats;
+   std::string mWriteFunctionCallStats;
    std::string mWriteFilePathInfo;
    std::string mWriteGmatKeyword;
    std::string mLastFilePathMessage;
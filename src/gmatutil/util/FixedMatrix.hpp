@@ -0,0 +1,213 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                                FixedMatrix
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/16
+//
+/**
+ * Declares the FixedMatrix template, a square Real matrix whose size is fixed
+ * at compile time; the stack-stored counterpart of Rmatrix33 and Rmatrix66
+ * (see FixedVector for the rationale).
+ *
+ * Elements are stored row by row, matching the Rmatrix data vector, so
+ * GetDataVector() can be used wherever code reads an Rmatrix data vector.
+ */
+//------------------------------------------------------------------------------
+#ifndef FixedMatrix_hpp
+#define FixedMatrix_hpp
+
+#include "utildefs.hpp"
+#include "Rmatrix.hpp"
+#include "FixedVector.hpp"
+
+template <Integer N>
+class FixedMatrix
+{
+public:
+   /// Identity matrix, or the zero matrix when isIdentity is false
+   explicit FixedMatrix(bool isIdentity = true)
+   {
+      for (Integer i = 0; i < N*N; ++i)
+         elementD[i] = 0.0;
+      if (isIdentity)
+         for (Integer i = 0; i < N; ++i)
+            elementD[i*N+i] = 1.0;
+   }
+
+   /// Copies N*N elements, row by row, from an array
+   explicit FixedMatrix(const Real *data)
+   {
+      for (Integer i = 0; i < N*N; ++i)
+         elementD[i] = data[i];
+   }
+
+   /// 3x3 matrix from its elements
+   FixedMatrix(Real a00, Real a01, Real a02,
+               Real a10, Real a11, Real a12,
+               Real a20, Real a21, Real a22)
+   {
+      static_assert(N == 3, "FixedMatrix: nine elements given for a matrix "
+            "that is not 3x3");
+      elementD[0] = a00;  elementD[1] = a01;  elementD[2] = a02;
+      elementD[3] = a10;  elementD[4] = a11;  elementD[5] = a12;
+      elementD[6] = a20;  elementD[7] = a21;  elementD[8] = a22;
+   }
+
+   /// Copies an N x N Rmatrix
+   explicit FixedMatrix(const Rmatrix &m)
+   {
+      CheckSize(m);
+      for (Integer i = 0; i < N; ++i)
+         for (Integer j = 0; j < N; ++j)
+            elementD[i*N+j] = m(i,j);
+   }
+
+   /// Copies this matrix into an N x N Rmatrix
+   void CopyTo(Rmatrix &m) const
+   {
+      CheckSize(m);
+      for (Integer i = 0; i < N; ++i)
+         for (Integer j = 0; j < N; ++j)
+            m(i,j) = elementD[i*N+j];
+   }
+
+   Integer     GetNumRows() const                       { return N; }
+   Integer     GetNumColumns() const                    { return N; }
+   Real*       GetDataVector()                          { return elementD; }
+   const Real* GetDataVector() const                    { return elementD; }
+   Real&       operator()(Integer r, Integer c)         { return elementD[r*N+c]; }
+   Real        operator()(Integer r, Integer c) const   { return elementD[r*N+c]; }
+
+   FixedMatrix Transpose() const
+   {
+      FixedMatrix t(false);
+      for (Integer i = 0; i < N; ++i)
+         for (Integer j = 0; j < N; ++j)
+            t.elementD[j*N+i] = elementD[i*N+j];
+      return t;
+   }
+
+   FixedMatrix operator+(const FixedMatrix &m) const
+   {
+      FixedMatrix r(false);
+      for (Integer i = 0; i < N*N; ++i)
+         r.elementD[i] = elementD[i] + m.elementD[i];
+      return r;
+   }
+
+   FixedMatrix operator-(const FixedMatrix &m) const
+   {
+      FixedMatrix r(false);
+      for (Integer i = 0; i < N*N; ++i)
+         r.elementD[i] = elementD[i] - m.elementD[i];
+      return r;
+   }
+
+   FixedMatrix operator*(Real s) const
+   {
+      FixedMatrix r(false);
+      for (Integer i = 0; i < N*N; ++i)
+         r.elementD[i] = elementD[i] * s;
+      return r;
+   }
+
+   FixedMatrix operator*(const FixedMatrix &m) const
+   {
+      FixedMatrix r(false);
+      for (Integer i = 0; i < N; ++i)
+         for (Integer k = 0; k < N; ++k)
+         {
+            Real a = elementD[i*N+k];
+            for (Integer j = 0; j < N; ++j)
+               r.elementD[i*N+j] += a * m.elementD[k*N+j];
+         }
+      return r;
+   }
+
+   FixedVector<N> operator*(const FixedVector<N> &v) const
+   {
+      FixedVector<N> r;
+      for (Integer i = 0; i < N; ++i)
+      {
+         Real sum = 0.0;
+         for (Integer j = 0; j < N; ++j)
+            sum += elementD[i*N+j] * v[j];
+         r[i] = sum;
+      }
+      return r;
+   }
+
+   /// Transpose of this matrix times a vector, without forming the transpose
+   FixedVector<N> TransposeTimes(const FixedVector<N> &v) const
+   {
+      FixedVector<N> r;
+      for (Integer j = 0; j < N; ++j)
+      {
+         Real vj = v[j];
+         for (Integer i = 0; i < N; ++i)
+            r[i] += elementD[j*N+i] * vj;
+      }
+      return r;
+   }
+
+   const FixedMatrix& operator+=(const FixedMatrix &m)
+   {
+      for (Integer i = 0; i < N*N; ++i)
+         elementD[i] += m.elementD[i];
+      return *this;
+   }
+
+   const FixedMatrix& operator-=(const FixedMatrix &m)
+   {
+      for (Integer i = 0; i < N*N; ++i)
+         elementD[i] -= m.elementD[i];
+      return *this;
+   }
+
+   const FixedMatrix& operator*=(Real s)
+   {
+      for (Integer i = 0; i < N*N; ++i)
+         elementD[i] *= s;
+      return *this;
+   }
+
+protected:
+   /// The elements, row by row
+   Real elementD[N*N];
+
+   void CheckSize(const Rmatrix &m) const
+   {
+      if ((m.GetNumRows() != N) || (m.GetNumColumns() != N))
+         throw TableTemplateExceptions::DimensionError(
+               "FixedMatrix: the Rmatrix size does not match");
+   }
+};
+
+/// Scalar times matrix
+template <Integer N>
+inline FixedMatrix<N> operator*(Real s, const FixedMatrix<N> &m)
+{
+   return m * s;
+}
+
+typedef FixedMatrix<3> FixedMatrix33;
+typedef FixedMatrix<6> FixedMatrix66;
+
+#endif // FixedMatrix_hpp
@@ -0,0 +1,234 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                                FixedVector
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/16
+//
+/**
+ * Declares the FixedVector template, a Real vector whose size is fixed at
+ * compile time.
+ *
+ * Rvector3 and Rvector6 keep their elements on the heap, so each temporary
+ * in an expression costs an allocation.  A FixedVector keeps its elements
+ * inside the object, has no virtual methods, and every operation is an
+ * inline loop of constant length, so it can be used for temporaries in
+ * force models and frame conversions without touching the heap.
+ *
+ * The element semantics follow Rvector3: operator* between two vectors is
+ * the dot product, and GetUnitVector() throws Rvector::ZeroVector for a zero
+ * vector.  Conversions to and from Rvector copy the elements and check the
+ * size.
+ */
+//------------------------------------------------------------------------------
+#ifndef FixedVector_hpp
+#define FixedVector_hpp
+
+#include "utildefs.hpp"
+#include "Rvector.hpp"
+#include "RealUtilities.hpp"
+#include <cmath>
+
+template <Integer N>
+class FixedVector
+{
+public:
+   /// Zero vector
+   FixedVector()
+   {
+      for (Integer i = 0; i < N; ++i)
+         elementD[i] = 0.0;
+   }
+
+   /// Copies N elements from an array
+   explicit FixedVector(const Real *data)
+   {
+      for (Integer i = 0; i < N; ++i)
+         elementD[i] = data[i];
+   }
+
+   /// 3-vector from its elements
+   FixedVector(Real e1, Real e2, Real e3)
+   {
+      static_assert(N == 3, "FixedVector: three elements given for a vector "
+            "that is not of size 3");
+      elementD[0] = e1;  elementD[1] = e2;  elementD[2] = e3;
+   }
+
+   /// 6-vector from its elements
+   FixedVector(Real e1, Real e2, Real e3, Real e4, Real e5, Real e6)
+   {
+      static_assert(N == 6, "FixedVector: six elements given for a vector "
+            "that is not of size 6");
+      elementD[0] = e1;  elementD[1] = e2;  elementD[2] = e3;
+      elementD[3] = e4;  elementD[4] = e5;  elementD[5] = e6;
+   }
+
+   /// Copies an Rvector of size N
+   explicit FixedVector(const Rvector &v)
+   {
+      CheckSize(v.GetSize());
+      for (Integer i = 0; i < N; ++i)
+         elementD[i] = v[i];
+   }
+
+   /// Copies this vector into an Rvector of size N
+   void CopyTo(Rvector &v) const
+   {
+      CheckSize(v.GetSize());
+      for (Integer i = 0; i < N; ++i)
+         v[i] = elementD[i];
+   }
+
+   Integer     GetSize() const             { return N; }
+   Real*       GetDataVector()             { return elementD; }
+   const Real* GetDataVector() const       { return elementD; }
+   Real&       operator[](Integer i)       { return elementD[i]; }
+   Real        operator[](Integer i) const { return elementD[i]; }
+
+   /// Euclidean norm
+   Real GetMagnitude() const
+   {
+      return sqrt((*this) * (*this));
+   }
+
+   /// Unit vector in the direction of this vector
+   FixedVector GetUnitVector() const
+   {
+      Real mag = GetMagnitude();
+      if (GmatMathUtil::IsZero(mag))
+         throw Rvector::ZeroVector(" from FixedVector::GetUnitVector()\n");
+      return (*this) / mag;
+   }
+
+   /// Scales this vector to unit length
+   const FixedVector& Normalize()
+   {
+      *this = GetUnitVector();
+      return *this;
+   }
+
+   FixedVector operator-() const
+   {
+      FixedVector r;
+      for (Integer i = 0; i < N; ++i)
+         r.elementD[i] = -elementD[i];
+      return r;
+   }
+
+   FixedVector operator+(const FixedVector &v) const
+   {
+      FixedVector r;
+      for (Integer i = 0; i < N; ++i)
+         r.elementD[i] = elementD[i] + v.elementD[i];
+      return r;
+   }
+
+   FixedVector operator-(const FixedVector &v) const
+   {
+      FixedVector r;
+      for (Integer i = 0; i < N; ++i)
+         r.elementD[i] = elementD[i] - v.elementD[i];
+      return r;
+   }
+
+   FixedVector operator*(Real s) const
+   {
+      FixedVector r;
+      for (Integer i = 0; i < N; ++i)
+         r.elementD[i] = elementD[i] * s;
+      return r;
+   }
+
+   FixedVector operator/(Real s) const
+   {
+      FixedVector r;
+      for (Integer i = 0; i < N; ++i)
+         r.elementD[i] = elementD[i] / s;
+      return r;
+   }
+
+   /// Dot product
+   Real operator*(const FixedVector &v) const
+   {
+      Real sum = 0.0;
+      for (Integer i = 0; i < N; ++i)
+         sum += elementD[i] * v.elementD[i];
+      return sum;
+   }
+
+   const FixedVector& operator+=(const FixedVector &v)
+   {
+      for (Integer i = 0; i < N; ++i)
+         elementD[i] += v.elementD[i];
+      return *this;
+   }
+
+   const FixedVector& operator-=(const FixedVector &v)
+   {
+      for (Integer i = 0; i < N; ++i)
+         elementD[i] -= v.elementD[i];
+      return *this;
+   }
+
+   const FixedVector& operator*=(Real s)
+   {
+      for (Integer i = 0; i < N; ++i)
+         elementD[i] *= s;
+      return *this;
+   }
+
+   const FixedVector& operator/=(Real s)
+   {
+      for (Integer i = 0; i < N; ++i)
+         elementD[i] /= s;
+      return *this;
+   }
+
+protected:
+   /// The elements
+   Real elementD[N];
+
+   void CheckSize(Integer size) const
+   {
+      if (size != N)
+         throw ArrayTemplateExceptions::DimensionError(
+               "FixedVector: the Rvector size does not match");
+   }
+};
+
+/// Scalar times vector
+template <Integer N>
+inline FixedVector<N> operator*(Real s, const FixedVector<N> &v)
+{
+   return v * s;
+}
+
+/// Cross product of 3-vectors
+inline FixedVector<3> Cross(const FixedVector<3> &v1, const FixedVector<3> &v2)
+{
+   return FixedVector<3>(v1[1]*v2[2] - v1[2]*v2[1],
+                         v1[2]*v2[0] - v1[0]*v2[2],
+                         v1[0]*v2[1] - v1[1]*v2[0]);
+}
+
+typedef FixedVector<3> FixedVector3;
+typedef FixedVector<6> FixedVector6;
+
+#endif // FixedVector_hpp
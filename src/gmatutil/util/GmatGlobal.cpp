@@ -601,6 +601,48 @@ void GmatGlobal::SetWriteParameterInfo(bool flag)
    isWritingParameterInfo = flag;
 }
 
+//------------------------------------------------------------------------------
+// bool IsWritingParameterLookupStats()
+//------------------------------------------------------------------------------
+/**
+ * Returns true when string parameter lookups are counted and reported at the
+ * end of each run.
+ */
+//------------------------------------------------------------------------------
+bool GmatGlobal::IsWritingParameterLookupStats()
+{
+   return isWritingParameterLookupStats;
+}
+
+//------------------------------------------------------------------------------
+// void SetWriteParameterLookupStats(bool flag)
+//------------------------------------------------------------------------------
+void GmatGlobal::SetWriteParameterLookupStats(bool flag)
+{
+   isWritingParameterLookupStats = flag;
+}
+
+//------------------------------------------------------------------------------
+// bool IsWritingFunctionCallStats()
+//------------------------------------------------------------------------------
+/**
+ * Returns true when GMAT function calls are timed and reported at the end of
+ * each run.
+ */
+//------------------------------------------------------------------------------
+bool GmatGlobal::IsWritingFunctionCallStats()
+{
+   return isWritingFunctionCallStats;
+}
+
+//------------------------------------------------------------------------------
+// void SetWriteFunctionCallStats(bool flag)
+//------------------------------------------------------------------------------
+void GmatGlobal::SetWriteFunctionCallStats(bool flag)
+{
+   isWritingFunctionCallStats = flag;
+}
+
 //------------------------------------------------------------------------------
 // bool IsWritingFilePathInfo()
 //------------------------------------------------------------------------------
@@ -1145,6 +1187,8 @@ GmatGlobal::GmatGlobal()
    isMissionTreeDebugOn         = false;
    isWritingParameterInfo       = false;
    isWritingFilePathInfo        = false;
+   isWritingParameterLookupStats = false;
+   isWritingFunctionCallStats   = false;
    isWritingGmatKeyword         = true;
    commandEchoMode              = false;
    runMode = NORMAL;
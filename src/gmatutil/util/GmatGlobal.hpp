@@ -162,6 +162,10 @@ public:
    void SetWriteParameterInfo(bool flag);
    bool IsWritingFilePathInfo();
    void SetWriteFilePathInfo(bool flag);
+   bool IsWritingParameterLookupStats();
+   void SetWriteParameterLookupStats(bool flag);
+   bool IsWritingFunctionCallStats();
+   void SetWriteFunctionCallStats(bool flag);
    
    // Write GMAT keyword when saving to script or showing script
    bool IsWritingGmatKeyword();
@@ -315,6 +319,8 @@ private:
    bool isMissionTreeDebugOn;
    bool isWritingParameterInfo;
    bool isWritingFilePathInfo;
+   bool isWritingParameterLookupStats;
+   bool isWritingFunctionCallStats;
    bool isWritingGmatKeyword;
    bool commandEchoMode;
    bool skipSplash;
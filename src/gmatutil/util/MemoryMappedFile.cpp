@@ -0,0 +1,238 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                              MemoryMappedFile
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/16
+//
+/**
+ * Implements the MemoryMappedFile class.
+ */
+//------------------------------------------------------------------------------
+#include "MemoryMappedFile.hpp"
+#include "MessageInterface.hpp"
+
+#ifdef _WIN32
+   #ifndef WIN32_LEAN_AND_MEAN
+      #define WIN32_LEAN_AND_MEAN
+   #endif
+   #include <windows.h>
+#else
+   #include <sys/mman.h>
+   #include <sys/stat.h>
+   #include <fcntl.h>
+   #include <unistd.h>
+#endif
+
+//#define DEBUG_MEMORY_MAPPED_FILE
+
+//------------------------------------------------------------------------------
+// MemoryMappedFile()
+//------------------------------------------------------------------------------
+/**
+ * Default constructor; nothing is mapped until Open() is called.
+ */
+//------------------------------------------------------------------------------
+MemoryMappedFile::MemoryMappedFile() :
+   theFileName    (""),
+   mappedData     (NULL),
+   mappedSize     (0)
+   #ifdef _WIN32
+   ,
+   fileHandle     (NULL),
+   mapHandle      (NULL)
+   #endif
+{
+}
+
+//------------------------------------------------------------------------------
+// MemoryMappedFile(const std::string &fileName)
+//------------------------------------------------------------------------------
+/**
+ * Constructor that maps the named file.  Use IsOpen() to check for success.
+ *
+ * @param fileName The file to map
+ */
+//------------------------------------------------------------------------------
+MemoryMappedFile::MemoryMappedFile(const std::string &fileName) :
+   theFileName    (""),
+   mappedData     (NULL),
+   mappedSize     (0)
+   #ifdef _WIN32
+   ,
+   fileHandle     (NULL),
+   mapHandle      (NULL)
+   #endif
+{
+   Open(fileName);
+}
+
+//------------------------------------------------------------------------------
+// ~MemoryMappedFile()
+//------------------------------------------------------------------------------
+MemoryMappedFile::~MemoryMappedFile()
+{
+   Close();
+}
+
+//------------------------------------------------------------------------------
+// bool Open(const std::string &fileName)
+//------------------------------------------------------------------------------
+/**
+ * Maps the named file read-only.  Any previous mapping is released first.
+ *
+ * @param fileName The file to map
+ *
+ * @return true if the file was mapped, false if it could not be opened or
+ *         mapped (callers are expected to fall back to stream I/O).
+ */
+//------------------------------------------------------------------------------
+bool MemoryMappedFile::Open(const std::string &fileName)
+{
+   Close();
+
+   #ifdef _WIN32
+      HANDLE hFile = CreateFileA(fileName.c_str(), GENERIC_READ,
+            FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+      if (hFile == INVALID_HANDLE_VALUE)
+         return false;
+
+      LARGE_INTEGER fileSize;
+      if (!GetFileSizeEx(hFile, &fileSize) || (fileSize.QuadPart == 0))
+      {
+         CloseHandle(hFile);
+         return false;
+      }
+
+      HANDLE hMap = CreateFileMappingA(hFile, NULL, PAGE_READONLY, 0, 0, NULL);
+      if (hMap == NULL)
+      {
+         CloseHandle(hFile);
+         return false;
+      }
+
+      void *view = MapViewOfFile(hMap, FILE_MAP_READ, 0, 0, 0);
+      if (view == NULL)
+      {
+         CloseHandle(hMap);
+         CloseHandle(hFile);
+         return false;
+      }
+
+      fileHandle = hFile;
+      mapHandle  = hMap;
+      mappedData = (const char*)view;
+      mappedSize = (std::size_t)fileSize.QuadPart;
+   #else
+      int fd = open(fileName.c_str(), O_RDONLY);
+      if (fd < 0)
+         return false;
+
+      struct stat fileStat;
+      if ((fstat(fd, &fileStat) != 0) || (fileStat.st_size == 0))
+      {
+         close(fd);
+         return false;
+      }
+
+      void *view = mmap(NULL, (std::size_t)fileStat.st_size, PROT_READ,
+            MAP_SHARED, fd, 0);
+      // The mapping stays valid after the descriptor is closed
+      close(fd);
+
+      if (view == MAP_FAILED)
+         return false;
+
+      mappedData = (const char*)view;
+      mappedSize = (std::size_t)fileStat.st_size;
+   #endif
+
+   theFileName = fileName;
+
+   #ifdef DEBUG_MEMORY_MAPPED_FILE
+   MessageInterface::ShowMessage
+      ("MemoryMappedFile::Open() mapped %llu bytes of '%s' at <%p>\n",
+       (unsigned long long)mappedSize, theFileName.c_str(), mappedData);
+   #endif
+
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// void Close()
+//------------------------------------------------------------------------------
+/**
+ * Releases the mapping, if there is one.
+ */
+//------------------------------------------------------------------------------
+void MemoryMappedFile::Close()
+{
+   if (mappedData != NULL)
+   {
+      #ifdef _WIN32
+         UnmapViewOfFile((LPCVOID)mappedData);
+         CloseHandle((HANDLE)mapHandle);
+         CloseHandle((HANDLE)fileHandle);
+         mapHandle  = NULL;
+         fileHandle = NULL;
+      #else
+         munmap((void*)mappedData, mappedSize);
+      #endif
+   }
+
+   mappedData  = NULL;
+   mappedSize  = 0;
+   theFileName = "";
+}
+
+//------------------------------------------------------------------------------
+// bool IsOpen() const
+//------------------------------------------------------------------------------
+bool MemoryMappedFile::IsOpen() const
+{
+   return (mappedData != NULL);
+}
+
+//------------------------------------------------------------------------------
+// const char* GetData() const
+//------------------------------------------------------------------------------
+/**
+ * @return The start of the mapped bytes, or NULL if nothing is mapped
+ */
+//------------------------------------------------------------------------------
+const char* MemoryMappedFile::GetData() const
+{
+   return mappedData;
+}
+
+//------------------------------------------------------------------------------
+// std::size_t GetSize() const
+//------------------------------------------------------------------------------
+std::size_t MemoryMappedFile::GetSize() const
+{
+   return mappedSize;
+}
+
+//------------------------------------------------------------------------------
+// const std::string& GetFileName() const
+//------------------------------------------------------------------------------
+const std::string& MemoryMappedFile::GetFileName() const
+{
+   return theFileName;
+}
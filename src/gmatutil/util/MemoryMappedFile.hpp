@@ -0,0 +1,75 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                              MemoryMappedFile
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/16
+//
+/**
+ * Declares the MemoryMappedFile class, a read-only view of a whole file
+ * mapped into the process address space.
+ *
+ * The mapped bytes are never modified, so any number of readers (including
+ * readers on different threads) can access the data without locking.  Pages
+ * are shared through the operating system page cache, so mapping the same
+ * file from several objects does not duplicate the file contents in memory.
+ */
+//------------------------------------------------------------------------------
+#ifndef MemoryMappedFile_hpp
+#define MemoryMappedFile_hpp
+
+#include "utildefs.hpp"
+
+class GMATUTIL_API MemoryMappedFile
+{
+public:
+   MemoryMappedFile();
+   MemoryMappedFile(const std::string &fileName);
+   virtual ~MemoryMappedFile();
+
+   bool                 Open(const std::string &fileName);
+   void                 Close();
+
+   bool                 IsOpen() const;
+   const char*          GetData() const;
+   std::size_t          GetSize() const;
+   const std::string&   GetFileName() const;
+
+protected:
+   /// Name of the mapped file
+   std::string          theFileName;
+   /// Start of the mapped region; NULL when nothing is mapped
+   const char           *mappedData;
+   /// Size of the mapped region, in bytes
+   std::size_t          mappedSize;
+
+   #ifdef _WIN32
+   /// File handle (Windows)
+   void                 *fileHandle;
+   /// File mapping handle (Windows)
+   void                 *mapHandle;
+   #endif
+
+private:
+   // A mapping owns OS resources; copies are not allowed
+   MemoryMappedFile(const MemoryMappedFile &mmf);
+   MemoryMappedFile& operator=(const MemoryMappedFile &mmf);
+};
+
+#endif // MemoryMappedFile_hpp
@@ -40,6 +40,7 @@
 #include "MessageInterface.hpp"
 #include "UtilityException.hpp"
 #include "StringUtil.hpp"
+#include "FixedMatrix.hpp"
 
 //#define DEBUG_EQUINOCTIAL
 //#define DEBUG_MODEQUINOCTIAL
@@ -1286,7 +1287,6 @@ Rvector6 StateConversionUtil::CartesianToKeplerian(Real mu, const Rvector3 &pos,
    MessageInterface::ShowMessage("                   pos = %s and  vel = %s\n", pos.ToString().c_str(), vel.ToString().c_str());
    #endif
 
-   Real tfp, ma;
    Real p[3], v[3];
    for (unsigned int ii = 0; ii < 3; ii++)
    {
@@ -1294,6 +1294,31 @@ Rvector6 StateConversionUtil::CartesianToKeplerian(Real mu, const Rvector3 &pos,
       v[ii] = vel[ii];
    }
 
+   return CartesianArrayToKeplerian(mu, p, v, anomalyType);
+}
+
+
+//------------------------------------------------------------------------------
+// Rvector6 CartesianArrayToKeplerian(Real mu, Real p[3], Real v[3],
+//                                    AnomalyType anomalyType)
+//------------------------------------------------------------------------------
+/**
+ * Converts from Cartesian to Keplerian, working from plain arrays so that
+ * callers holding a 6-vector need no Rvector3 temporaries.
+ *
+ * @param <mu>            Gravitational constant for the central body
+ * @param <p>             Cartesian position
+ * @param <v>             Cartesian velocity
+ * @param <anomalyType>   Anomaly type
+ *
+ * @return Spacecraft orbit state converted from Cartesian to Keplerian
+ */
+//---------------------------------------------------------------------------
+Rvector6 StateConversionUtil::CartesianArrayToKeplerian(Real mu, Real p[3],
+                                                        Real v[3],
+                                                        AnomalyType anomalyType)
+{
+   Real tfp, ma;
    Real     kepOut[6];
    kepOut[0] = kepOut[1] = kepOut[2] = kepOut[3] = kepOut[4] = kepOut[5] = 0.0;
    Integer retval = ComputeCartToKepl(mu, p, v, &tfp, kepOut, &ma);                    // It return keplerian state in TA form
@@ -1363,9 +1388,9 @@ Rvector6 StateConversionUtil::CartesianToKeplerian(Real mu, const Rvector3 &pos,
 Rvector6 StateConversionUtil::CartesianToKeplerian(Real mu, const Rvector6 &state,
                                                    AnomalyType anomalyType)
 {
-   Rvector3 pos(state[0], state[1], state[2]);
-   Rvector3 vel(state[3], state[4], state[5]);
-   return CartesianToKeplerian(mu, pos, vel, anomalyType);
+   Real pos[3] = {state[0], state[1], state[2]};
+   Real vel[3] = {state[3], state[4], state[5]};
+   return CartesianArrayToKeplerian(mu, pos, vel, anomalyType);
 }
 
 
@@ -1386,9 +1411,9 @@ Rvector6 StateConversionUtil::CartesianToKeplerian(Real mu, const Rvector6 &stat
 Rvector6 StateConversionUtil::CartesianToKeplerian(Real mu, const Rvector6 &state,
                                                    const std::string &anomalyType)
 {
-   Rvector3 pos(state[0], state[1], state[2]);
-   Rvector3 vel(state[3], state[4], state[5]);
-   return CartesianToKeplerian(mu, pos, vel, anomalyType);
+   Real pos[3] = {state[0], state[1], state[2]};
+   Real vel[3] = {state[3], state[4], state[5]};
+   return CartesianArrayToKeplerian(mu, pos, vel, GetAnomalyType(anomalyType));
 }
 
 //------------------------------------------------------------------------------
@@ -2076,8 +2101,8 @@ Rvector6 StateConversionUtil::CartesianToEquinoctial(const Rvector6& cartesian,
    #endif
    Real sma, h, k, p, q, lambda; // equinoctial elements
 
-   Rvector3 pos(cartesian[0], cartesian[1], cartesian[2]);
-   Rvector3 vel(cartesian[3], cartesian[4], cartesian[5]);
+   FixedVector3 pos(cartesian[0], cartesian[1], cartesian[2]);
+   FixedVector3 vel(cartesian[3], cartesian[4], cartesian[5]);
    Real r = pos.GetMagnitude();
    Real v = vel.GetMagnitude();
 
@@ -2090,7 +2115,7 @@ Rvector6 StateConversionUtil::CartesianToEquinoctial(const Rvector6& cartesian,
       throw UtilityException("Cannot convert from Cartesian to Equinoctial - gravitational constant is zero.\n");
    }
 
-   Rvector3 eVec = ( ((v*v - mu/r) * pos) - ((pos * vel) * vel) ) / mu;
+   FixedVector3 eVec = ( ((v*v - mu/r) * pos) - ((pos * vel) * vel) ) / mu;
    Real e = eVec.GetMagnitude();
 
    // Check for a near parabolic or hyperbolic orbit.
@@ -2117,7 +2142,7 @@ Rvector6 StateConversionUtil::CartesianToEquinoctial(const Rvector6& cartesian,
       throw UtilityException(errmsg);
    }
 
-   Rvector3 am = Cross(pos, vel).GetUnitVector();
+   FixedVector3 am = Cross(pos, vel).GetUnitVector();
    Real inc = ACos((am[2]), GmatOrbitConstants::KEP_TOL);
    if (inc >= PI - GmatOrbitConstants::KEP_TOL)
    {
@@ -2129,13 +2154,13 @@ Rvector6 StateConversionUtil::CartesianToEquinoctial(const Rvector6& cartesian,
    Integer j = 1;  // always 1, unless inclination is exactly 180 degrees
 
    // Define equinoctial coordinate system
-   Rvector3 f;
+   FixedVector3 f;
    f[0]      =   1.0 - ((am[0] * am[0]) / (1.0 + Pow(am[2], j)));
    f[1]      = - (am[0] * am[1]) / (1.0 + Pow(am[2], j));
    f[2]      = - Pow(am[0], j);
    f         = f.GetUnitVector();
 
-   Rvector3 g = Cross(am,f).GetUnitVector();
+   FixedVector3 g = Cross(am,f).GetUnitVector();
 
    h =   eVec * g;
    k =   eVec * f;
@@ -2260,20 +2285,20 @@ Rvector6 StateConversionUtil::EquinoctialToCartesian(const Rvector6& equinoctial
    Integer j = 1;  // always 1, unless inclination is exactly 180 degrees
 
    // Compute Q matrix
-   Rmatrix33 Q(1.0 - (p * p) + (q * q),   2.0 * p * q * j,                2.0 * p,
-               2.0 * p * q,               (1.0 + (p * p) - (q * q)) * j, -2.0 * q,
-              -2.0 * p * j,               2.0 * q,                       (1.0 - (p * p) - (q * q)) * j);
+   FixedMatrix33 Q(1.0 - (p * p) + (q * q),   2.0 * p * q * j,                2.0 * p,
+                   2.0 * p * q,               (1.0 + (p * p) - (q * q)) * j, -2.0 * q,
+                  -2.0 * p * j,               2.0 * q,                       (1.0 - (p * p) - (q * q)) * j);
 
-   Rmatrix33 Q2 = (1.0 / (1.0 + (p * p) + (q * q))) * Q;
-   Rvector3  f(Q2(0,0), Q2(1,0), Q2(2,0));
-   Rvector3  g(Q2(0,1), Q2(1,1), Q2(2,1));
+   FixedMatrix33 Q2 = (1.0 / (1.0 + (p * p) + (q * q))) * Q;
+   FixedVector3 f(Q2(0,0), Q2(1,0), Q2(2,0));
+   FixedVector3 g(Q2(0,1), Q2(1,1), Q2(2,1));
    f = f.GetUnitVector();
    g = g.GetUnitVector();
 
-   Rvector3 pos = (X1 * f) + (Y1 * g);
-   Rvector3 vel = (X1Dot * f) + (Y1Dot * g);
+   FixedVector3 pos = (X1 * f) + (Y1 * g);
+   FixedVector3 vel = (X1Dot * f) + (Y1Dot * g);
 
-   return Rvector6(pos, vel);
+   return Rvector6(pos[0], pos[1], pos[2], vel[0], vel[1], vel[2]);
 }
 
 // Modified by M.H.
@@ -7636,11 +7661,11 @@ Integer StateConversionUtil::ComputeCartToKepl(Real grav,    Real r[3], Real v[3
    if (Abs(grav) < 1E-30)
       return(2);
 
-   Rvector3 pos(r[0], r[1], r[2]);
-   Rvector3 vel(v[0], v[1], v[2]);
+   FixedVector<3> pos(r[0], r[1], r[2]);
+   FixedVector<3> vel(v[0], v[1], v[2]);
 
    // eqn 4.1
-   Rvector3 angMomentum = Cross(pos, vel);
+   FixedVector<3> angMomentum = Cross(pos, vel);
 
    // eqn 4.2
    Real h = angMomentum.GetMagnitude();
@@ -7657,8 +7682,8 @@ Integer StateConversionUtil::ComputeCartToKepl(Real grav,    Real r[3], Real v[3
    #endif
 
    // eqn 4.3
-   Rvector3 v3(0.0,0.0,1.0);
-   Rvector3 nodeVec = Cross(v3, angMomentum);
+   FixedVector<3> v3(0.0,0.0,1.0);
+   FixedVector<3> nodeVec = Cross(v3, angMomentum);
 
    // eqn 4.4
    Real n = nodeVec.GetMagnitude();
@@ -7676,7 +7701,7 @@ Integer StateConversionUtil::ComputeCartToKepl(Real grav,    Real r[3], Real v[3
    }
 
    // eqn 4.7 - 4.8
-   Rvector3 eccVec = (1/grav)*((velMag*velMag - grav/posMag)*pos - (pos * vel) * vel);
+   FixedVector<3> eccVec = (1/grav)*((velMag*velMag - grav/posMag)*pos - (pos * vel) * vel);
    Real e = eccVec.GetMagnitude();
 
    // eqn 4.9
@@ -7733,7 +7758,7 @@ Integer StateConversionUtil::ComputeCartToKepl(Real grav,    Real r[3], Real v[3
    {
       throw UtilityException("Cannot convert from Cartesian to Keplerian - angular momentum is zero.\n");
    }
-   Real i = ACos( angMomentum.Get(2)/h );
+   Real i = ACos( angMomentum[2]/h );
    
    // For GMT-4169 fix (LOJ: 2014.03.18)
    #if 0
@@ -7757,12 +7782,12 @@ Integer StateConversionUtil::ComputeCartToKepl(Real grav,    Real r[3], Real v[3
       {
          throw UtilityException("Cannot convert from Cartesian to Keplerian - line-of-nodes vector is a zero vector.\n");
       }
-      raan = ACos( nodeVec.Get(0)/n );
-      if (nodeVec.Get(1) < 0)
+      raan = ACos( nodeVec[0]/n );
+      if (nodeVec[1] < 0)
          raan = TWO_PI - raan;
 
       argPeriapsis = ACos( (nodeVec*eccVec)/(n*e) );
-      if (eccVec.Get(2) < 0)
+      if (eccVec[2] < 0)
          argPeriapsis = TWO_PI - argPeriapsis;
 
       trueAnom = ACos( (eccVec*pos)/(e*posMag) );
@@ -7778,8 +7803,8 @@ Integer StateConversionUtil::ComputeCartToKepl(Real grav,    Real r[3], Real v[3
          throw UtilityException("Cannot convert from Cartesian to Keplerian - eccentricity is zero.\n");
       }
       raan = 0;
-      argPeriapsis = ACos(eccVec.Get(0)/e);
-      if (eccVec.Get(1) < 0)
+      argPeriapsis = ACos(eccVec[0]/e);
+      if (eccVec[1] < 0)
          argPeriapsis = TWO_PI - argPeriapsis;
       
       // For GMT-4446 fix (LOJ: 2014.03.21)
@@ -7800,14 +7825,14 @@ Integer StateConversionUtil::ComputeCartToKepl(Real grav,    Real r[3], Real v[3
       {
          throw UtilityException("Cannot convert from Cartesian to Keplerian - line-of-nodes vector is a zero vector.\n");
       }
-      raan = ACos( nodeVec.Get(0)/n );
-      if (nodeVec.Get(1) < 0)
+      raan = ACos( nodeVec[0]/n );
+      if (nodeVec[1] < 0)
          raan = TWO_PI - raan;
 
       argPeriapsis = 0;
 
       trueAnom = ACos( (nodeVec*pos)/(n*posMag) );
-      if (pos.Get(2) < 0)
+      if (pos[2] < 0)
          trueAnom = TWO_PI - trueAnom;
    }
    // For GMT-4169 fix (LOJ: 2014.03.18)
@@ -7816,8 +7841,8 @@ Integer StateConversionUtil::ComputeCartToKepl(Real grav,    Real r[3], Real v[3
    {
       raan = 0;
       argPeriapsis = 0;
-      trueAnom = ACos(pos.Get(0)/posMag);
-      if (pos.Get(1) < 0)
+      trueAnom = ACos(pos[0]/posMag);
+      if (pos[1] < 0)
          trueAnom = TWO_PI - trueAnom;
       
       // For GMT-4446 fix (LOJ: 2014.03.21)
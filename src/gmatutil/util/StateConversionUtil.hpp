@@ -363,6 +363,8 @@ private:
 //------------------------------------------------------------------------------
 // private static methods
 //------------------------------------------------------------------------------
+static Rvector6 CartesianArrayToKeplerian(Real mu, Real p[3], Real v[3],
+                                          AnomalyType anomalyType);
 static Integer ComputeCartToKepl(Real grav, Real r[3], Real v[3], Real *tfp,
                                  Real elem[6], Real *ma);
 static Integer ComputeKeplToCart(Real grav, Real elem[6], Real r[3],
@@ -0,0 +1,356 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                                 WorkerPool
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/16
+//
+/**
+ * Implements the WorkerPool class.
+ */
+//------------------------------------------------------------------------------
+#include "WorkerPool.hpp"
+#include "MessageInterface.hpp"
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <exception>
+
+#ifdef _WIN32
+   #include <process.h>
+#else
+   #include <unistd.h>
+#endif
+
+//#define DEBUG_WORKER_POOL
+
+namespace
+{
+   /// Worker index of the calling thread inside Run(); -1 outside of a pool
+   thread_local Integer currentWorker = -1;
+
+   //---------------------------------------------------------------------------
+   // Integer CurrentProcess()
+   //---------------------------------------------------------------------------
+   /**
+    * @return The id of the running process
+    */
+   //---------------------------------------------------------------------------
+   Integer CurrentProcess()
+   {
+      #ifdef _WIN32
+         return (Integer)_getpid();
+      #else
+         return (Integer)getpid();
+      #endif
+   }
+}
+
+//------------------------------------------------------------------------------
+// WorkerPoolState
+//------------------------------------------------------------------------------
+/**
+ * Threads and synchronization members of a WorkerPool.
+ */
+//------------------------------------------------------------------------------
+class WorkerPoolState
+{
+public:
+   WorkerPoolState() :
+      generation     (0),
+      shuttingDown   (false),
+      task           (NULL),
+      taskCount      (0),
+      nextTask       (0),
+      activeWorkers  (0),
+      errorTask      (0),
+      ownerProcess   (CurrentProcess())
+   {
+   }
+
+   std::vector<std::thread>   threads;
+   std::mutex                 mutex;
+   std::condition_variable    startSignal;
+   std::condition_variable    doneSignal;
+   /// Incremented for each Run() so idle workers know there is new work
+   Integer                    generation;
+   bool                       shuttingDown;
+   const WorkerPool::Task     *task;
+   Integer                    taskCount;
+   std::atomic<Integer>       nextTask;
+   /// Pool threads that have not finished the current Run()
+   Integer                    activeWorkers;
+   /// Lowest task index that threw, and its exception
+   Integer                    errorTask;
+   std::exception_ptr         error;
+   /// Process that started the threads; a forked child has none of them
+   Integer                    ownerProcess;
+};
+
+
+//------------------------------------------------------------------------------
+// WorkerPool(Integer threadCount)
+//------------------------------------------------------------------------------
+/**
+ * Constructor
+ *
+ * @param threadCount Number of workers, counting the calling thread; 0 (or
+ *                    less) uses the number of hardware threads
+ */
+//------------------------------------------------------------------------------
+WorkerPool::WorkerPool(Integer threadCount) :
+   threadCount    (threadCount > 0 ? threadCount : GetHardwareThreadCount()),
+   poolState      (new WorkerPoolState)
+{
+   for (Integer i = 1; i < this->threadCount; ++i)
+      poolState->threads.push_back(std::thread(&WorkerPool::WorkerLoop, this,
+            i));
+
+   #ifdef DEBUG_WORKER_POOL
+      MessageInterface::ShowMessage("WorkerPool <%p> started %d workers\n",
+            this, this->threadCount);
+   #endif
+}
+
+//------------------------------------------------------------------------------
+// ~WorkerPool()
+//------------------------------------------------------------------------------
+/**
+ * Destructor
+ *
+ * In a forked child the pool threads do not exist and cannot be joined, and
+ * the mutex may have been copied in a locked state, so the state is left
+ * alone there; the child is about to exit anyway.
+ */
+//------------------------------------------------------------------------------
+WorkerPool::~WorkerPool()
+{
+   if (poolState->ownerProcess != CurrentProcess())
+      return;
+
+   {
+      std::lock_guard<std::mutex> lock(poolState->mutex);
+      poolState->shuttingDown = true;
+   }
+   poolState->startSignal.notify_all();
+
+   for (UnsignedInt i = 0; i < poolState->threads.size(); ++i)
+      poolState->threads[i].join();
+
+   delete poolState;
+}
+
+//------------------------------------------------------------------------------
+// Integer GetThreadCount() const
+//------------------------------------------------------------------------------
+/**
+ * @return The number of workers, including the calling thread
+ */
+//------------------------------------------------------------------------------
+Integer WorkerPool::GetThreadCount() const
+{
+   return threadCount;
+}
+
+//------------------------------------------------------------------------------
+// void Run(Integer taskCount, const Task &task)
+//------------------------------------------------------------------------------
+/**
+ * Runs task(i, worker) for i = 0 ... taskCount-1 and waits for completion.
+ *
+ * Calls made from inside a running task execute serially on the calling
+ * thread, so nested use does not deadlock.  The tasks of a nested call are
+ * given worker 0: the index of the outer worker means nothing to this pool,
+ * and may be larger than its thread count.
+ *
+ * A forked child process inherits the pool but not its threads, so calls
+ * made there also run serially, as worker 0.
+ *
+ * @param taskCount Number of tasks
+ * @param task      The work to do
+ */
+//------------------------------------------------------------------------------
+void WorkerPool::Run(Integer taskCount, const Task &task)
+{
+   if (taskCount <= 0)
+      return;
+
+   if ((threadCount == 1) || (taskCount == 1) || (currentWorker >= 0) ||
+       (poolState->ownerProcess != CurrentProcess()))
+   {
+      for (Integer i = 0; i < taskCount; ++i)
+         task(i, 0);
+      return;
+   }
+
+   {
+      std::lock_guard<std::mutex> lock(poolState->mutex);
+      poolState->task          = &task;
+      poolState->taskCount     = taskCount;
+      poolState->nextTask      = 0;
+      poolState->activeWorkers = (Integer)poolState->threads.size();
+      poolState->errorTask     = taskCount;
+      poolState->error         = NULL;
+      ++poolState->generation;
+   }
+   poolState->startSignal.notify_all();
+
+   RunTasks(0);
+
+   std::exception_ptr error;
+   {
+      std::unique_lock<std::mutex> lock(poolState->mutex);
+      poolState->doneSignal.wait(lock,
+            [this]{ return poolState->activeWorkers == 0; });
+      poolState->task = NULL;
+      error = poolState->error;
+      poolState->error = NULL;
+   }
+
+   if (error)
+      std::rethrow_exception(error);
+}
+
+//------------------------------------------------------------------------------
+// Integer GetHardwareThreadCount()
+//------------------------------------------------------------------------------
+/**
+ * @return The number of hardware threads, or 1 if it cannot be determined
+ */
+//------------------------------------------------------------------------------
+Integer WorkerPool::GetHardwareThreadCount()
+{
+   Integer count = (Integer)std::thread::hardware_concurrency();
+   return (count > 0 ? count : 1);
+}
+
+//------------------------------------------------------------------------------
+// bool IsInTask()
+//------------------------------------------------------------------------------
+/**
+ * Reports if the calling thread is running a task of a pool.  Run() calls
+ * made from such a thread execute serially.
+ *
+ * @return true inside a task
+ */
+//------------------------------------------------------------------------------
+bool WorkerPool::IsInTask()
+{
+   return currentWorker >= 0;
+}
+
+//------------------------------------------------------------------------------
+// void Partition(Integer itemCount, Integer partCount, Integer part,
+//                Integer &first, Integer &last)
+//------------------------------------------------------------------------------
+/**
+ * Splits itemCount items into partCount contiguous blocks of nearly equal
+ * size, and returns the range [first, last) of block part.
+ *
+ * @param itemCount Number of items
+ * @param partCount Number of blocks
+ * @param part      The block requested
+ * @param first     First item in the block
+ * @param last      One past the last item in the block
+ */
+//------------------------------------------------------------------------------
+void WorkerPool::Partition(Integer itemCount, Integer partCount, Integer part,
+                           Integer &first, Integer &last)
+{
+   Integer base  = itemCount / partCount;
+   Integer extra = itemCount % partCount;
+
+   first = part * base + (part < extra ? part : extra);
+   last  = first + base + (part < extra ? 1 : 0);
+}
+
+//------------------------------------------------------------------------------
+// void WorkerLoop(Integer worker)
+//------------------------------------------------------------------------------
+/**
+ * Body of the pool threads: waits for a Run() call, works on its tasks, and
+ * reports back.
+ *
+ * @param worker Index of this worker
+ */
+//------------------------------------------------------------------------------
+void WorkerPool::WorkerLoop(Integer worker)
+{
+   Integer seen = 0;
+
+   while (true)
+   {
+      {
+         std::unique_lock<std::mutex> lock(poolState->mutex);
+         poolState->startSignal.wait(lock, [this, seen]{
+               return poolState->shuttingDown ||
+                      (poolState->generation != seen); });
+         if (poolState->shuttingDown)
+            return;
+         seen = poolState->generation;
+      }
+
+      RunTasks(worker);
+
+      {
+         std::lock_guard<std::mutex> lock(poolState->mutex);
+         if (--poolState->activeWorkers == 0)
+            poolState->doneSignal.notify_all();
+      }
+   }
+}
+
+//------------------------------------------------------------------------------
+// void RunTasks(Integer worker)
+//------------------------------------------------------------------------------
+/**
+ * Takes tasks from the current Run() until none are left.
+ *
+ * @param worker Index of the worker doing the work
+ */
+//------------------------------------------------------------------------------
+void WorkerPool::RunTasks(Integer worker)
+{
+   currentWorker = worker;
+
+   while (true)
+   {
+      Integer i = poolState->nextTask++;
+      if (i >= poolState->taskCount)
+         break;
+
+      try
+      {
+         (*poolState->task)(i, worker);
+      }
+      catch (...)
+      {
+         std::lock_guard<std::mutex> lock(poolState->mutex);
+         if (i < poolState->errorTask)
+         {
+            poolState->errorTask = i;
+            poolState->error     = std::current_exception();
+         }
+      }
+   }
+
+   currentWorker = -1;
+}
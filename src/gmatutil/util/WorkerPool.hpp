@@ -0,0 +1,84 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                                 WorkerPool
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/16
+//
+/**
+ * Declares the WorkerPool class, a fixed set of threads that run numbered
+ * tasks in parallel.
+ *
+ * Run() blocks until every task has finished.  Each task is told which worker
+ * executes it (0 ... GetThreadCount()-1) so callers can keep per-worker
+ * scratch data.  Tasks must write disjoint outputs; the pool makes no promise
+ * about which worker runs a given task, so results are deterministic only if
+ * they do not depend on that choice.  The calling thread acts as worker 0.
+ *
+ * A Run() call made from inside a task of any pool executes serially on the
+ * calling thread, as worker 0 of the pool it was called on, so worker
+ * indices are always local to the pool.  A pool serves one caller at a time.
+ * The threads are not inherited by a child made with fork(); Run() calls in
+ * the child execute serially on the calling thread.
+ *
+ * The first exception thrown by a task (lowest task index) is rethrown from
+ * Run() after all tasks have finished.
+ */
+//------------------------------------------------------------------------------
+#ifndef WorkerPool_hpp
+#define WorkerPool_hpp
+
+#include "utildefs.hpp"
+#include <functional>
+
+class WorkerPoolState;
+
+class GMATUTIL_API WorkerPool
+{
+public:
+   /// Task signature: task index, worker index
+   typedef std::function<void(Integer, Integer)> Task;
+
+   WorkerPool(Integer threadCount = 0);
+   virtual ~WorkerPool();
+
+   Integer              GetThreadCount() const;
+   void                 Run(Integer taskCount, const Task &task);
+
+   static Integer       GetHardwareThreadCount();
+   static bool          IsInTask();
+   static void          Partition(Integer itemCount, Integer partCount,
+                                  Integer part, Integer &first, Integer &last);
+
+protected:
+   /// Number of workers, including the calling thread
+   Integer              threadCount;
+   /// Threads and synchronization data (kept out of the header)
+   WorkerPoolState      *poolState;
+
+   void                 WorkerLoop(Integer worker);
+   void                 RunTasks(Integer worker);
+
+private:
+   // A pool owns running threads; copies are not allowed
+   WorkerPool(const WorkerPool &wp);
+   WorkerPool& operator=(const WorkerPool &wp);
+};
+
+#endif // WorkerPool_hpp
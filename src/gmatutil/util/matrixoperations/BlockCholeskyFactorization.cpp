@@ -0,0 +1,306 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                          BlockCholeskyFactorization
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/16
+//
+/**
+ * Implements the BlockCholeskyFactorization class.
+ */
+//------------------------------------------------------------------------------
+#include "BlockCholeskyFactorization.hpp"
+#include "RealUtilities.hpp"
+#include "UtilityException.hpp"
+#include "MessageInterface.hpp"
+
+//------------------------------------------------------------------------------
+// BlockCholeskyFactorization(Integer blockSize)
+//------------------------------------------------------------------------------
+/**
+ * Constructor
+ *
+ * @param blockSize Number of rows factored before the trailing update
+ */
+//------------------------------------------------------------------------------
+BlockCholeskyFactorization::BlockCholeskyFactorization(Integer blockSize) :
+   MatrixFactorization(),
+   blockSize      (blockSize > 0 ? blockSize : 1),
+   rowCount       (0)
+{
+}
+
+//------------------------------------------------------------------------------
+// BlockCholeskyFactorization(const BlockCholeskyFactorization &bcf)
+//------------------------------------------------------------------------------
+/**
+ * Copy constructor; the work arrays are not copied
+ */
+//------------------------------------------------------------------------------
+BlockCholeskyFactorization::BlockCholeskyFactorization(
+      const BlockCholeskyFactorization &bcf) :
+   MatrixFactorization(bcf),
+   blockSize      (bcf.blockSize),
+   rowCount       (0)
+{
+}
+
+//------------------------------------------------------------------------------
+// ~BlockCholeskyFactorization()
+//------------------------------------------------------------------------------
+BlockCholeskyFactorization::~BlockCholeskyFactorization()
+{
+}
+
+//------------------------------------------------------------------------------
+// BlockCholeskyFactorization& operator=(const BlockCholeskyFactorization &bcf)
+//------------------------------------------------------------------------------
+BlockCholeskyFactorization& BlockCholeskyFactorization::operator=(
+      const BlockCholeskyFactorization &bcf)
+{
+   if (this != &bcf)
+   {
+      MatrixFactorization::operator=(bcf);
+      blockSize = bcf.blockSize;
+   }
+
+   return *this;
+}
+
+//------------------------------------------------------------------------------
+// void Factor(const Rmatrix &inputMatrix, Rmatrix &R, Rmatrix &blankMatrix)
+//------------------------------------------------------------------------------
+/**
+ * Matrix factorization routine using Cholesky decomposition
+ *
+ * @param inputMatrix The symmetric matrix to be factored
+ * @param R The upper triangular factor, with A = R^T R
+ * @param blankMatrix Unused; present to match the MatrixFactorization
+ *        interface
+ */
+//------------------------------------------------------------------------------
+void BlockCholeskyFactorization::Factor(const Rmatrix &inputMatrix, Rmatrix &R,
+                                        Rmatrix &blankMatrix)
+{
+   Factor(inputMatrix, R);
+}
+
+//------------------------------------------------------------------------------
+// void Factor(const Rmatrix &inputMatrix, Rmatrix &R)
+//------------------------------------------------------------------------------
+/**
+ * Matrix factorization routine using Cholesky decomposition
+ *
+ * @param inputMatrix The symmetric matrix to be factored; only the upper
+ *        triangle is used
+ * @param R The upper triangular factor, with A = R^T R
+ */
+//------------------------------------------------------------------------------
+void BlockCholeskyFactorization::Factor(const Rmatrix &inputMatrix, Rmatrix &R)
+{
+   LoadMatrix(inputMatrix);
+   FactorInPlace();
+
+   if ((R.GetNumRows() != rowCount) || (R.GetNumColumns() != rowCount))
+      R.SetSize(rowCount, rowCount);
+
+   for (Integer i = 0; i < rowCount; ++i)
+   {
+      const Real *ri = &work[i * rowCount];
+      for (Integer j = 0; j < i; ++j)
+         R(i, j) = 0.0;
+      for (Integer j = i; j < rowCount; ++j)
+         R(i, j) = ri[j];
+   }
+}
+
+//------------------------------------------------------------------------------
+// void Invert(Rmatrix &inputMatrix)
+//------------------------------------------------------------------------------
+/**
+ * Matrix inversion routine using Cholesky decomposition
+ *
+ * The matrix is factored as A = R^T R, R is inverted by back substitution,
+ * and the inverse is formed as R^-1 R^-T.
+ *
+ * @param inputMatrix The matrix to be inverted; it holds the inverse on
+ *        return
+ */
+//------------------------------------------------------------------------------
+void BlockCholeskyFactorization::Invert(Rmatrix &inputMatrix)
+{
+   LoadMatrix(inputMatrix);
+   FactorInPlace();
+
+   Integer n = rowCount;
+   rInverse.assign(n * n, 0.0);
+
+   // Rows of R^-1 from the bottom up:
+   //    X(i,j) = -(1/R(i,i)) sum_{k=i+1..j} R(i,k) X(k,j)
+   for (Integer i = n - 1; i >= 0; --i)
+   {
+      const Real *ri = &work[i * n];
+      Real *xi = &rInverse[i * n];
+      Real din = 1.0 / ri[i];
+
+      for (Integer k = i + 1; k < n; ++k)
+      {
+         Real rik = ri[k];
+         if (rik == 0.0)
+            continue;
+         const Real *xk = &rInverse[k * n];
+         for (Integer j = k; j < n; ++j)
+            xi[j] += rik * xk[j];
+      }
+
+      for (Integer j = i + 1; j < n; ++j)
+         xi[j] *= -din;
+      xi[i] = din;
+   }
+
+   // Inverse(A) = R^-1 * TRN(R^-1); both rows are read along their length
+   for (Integer i = 0; i < n; ++i)
+   {
+      const Real *xi = &rInverse[i * n];
+      for (Integer j = i; j < n; ++j)
+      {
+         const Real *xj = &rInverse[j * n];
+         Real sum = 0.0;
+         for (Integer k = j; k < n; ++k)
+            sum += xi[k] * xj[k];
+         inputMatrix(i, j) = sum;
+         inputMatrix(j, i) = sum;
+      }
+   }
+}
+
+//------------------------------------------------------------------------------
+// void LoadMatrix(const Rmatrix &inputMatrix)
+//------------------------------------------------------------------------------
+/**
+ * Copies the upper triangle of a square matrix into the work array.
+ *
+ * @param inputMatrix The matrix that is copied
+ */
+//------------------------------------------------------------------------------
+void BlockCholeskyFactorization::LoadMatrix(const Rmatrix &inputMatrix)
+{
+   rowCount = inputMatrix.GetNumRows();
+
+   if (rowCount != inputMatrix.GetNumColumns())
+   {
+      std::string errMessage =
+         "Matrix must be square for Cholesky decomposition.";
+      throw UtilityException(errMessage);
+   }
+
+   work.assign(rowCount * rowCount, 0.0);
+   for (Integer i = 0; i < rowCount; ++i)
+   {
+      Real *wi = &work[i * rowCount];
+      for (Integer j = i; j < rowCount; ++j)
+         wi[j] = inputMatrix(i, j);
+   }
+}
+
+//------------------------------------------------------------------------------
+// void FactorInPlace()
+//------------------------------------------------------------------------------
+/**
+ * Replaces the upper triangle of the work array with its Cholesky factor R.
+ *
+ * Each block of rows is factored against itself, then its contribution is
+ * removed from the rows below it in one pass over those rows.  A pivot below
+ * 1e-10 times the original diagonal element produces the same warning as
+ * CholeskyFactorization, and a non-positive pivot throws.
+ */
+//------------------------------------------------------------------------------
+void BlockCholeskyFactorization::FactorInPlace()
+{
+   const Real epsilon = 1.0e-10;
+   Integer n = rowCount;
+   bool reportWarning = false;
+   Real tolerance = 0.0;
+
+   RealArray diagonal(n);
+   for (Integer i = 0; i < n; ++i)
+      diagonal[i] = work[i * n + i];
+
+   for (Integer kb = 0; kb < n; kb += blockSize)
+   {
+      Integer ke = (kb + blockSize < n ? kb + blockSize : n);
+
+      // Factor the rows of this block, updating only rows inside the block
+      for (Integer k = kb; k < ke; ++k)
+      {
+         Real *rk = &work[k * n];
+         Real dsum = rk[k];
+         tolerance = GmatMathUtil::Abs(epsilon * diagonal[k]);
+
+         if (dsum <= 0.0)
+         {
+            std::string errMessage =
+               "Matrix must be positive definite for Cholesky decomposition.";
+            throw UtilityException(errMessage);
+         }
+         if (dsum <= tolerance)
+            reportWarning = true;
+
+         Real dPivot = GmatMathUtil::Sqrt(dsum);
+         rk[k] = dPivot;
+         dPivot = 1.0 / dPivot;
+         for (Integer j = k + 1; j < n; ++j)
+            rk[j] *= dPivot;
+
+         for (Integer i = k + 1; i < ke; ++i)
+         {
+            Real rki = rk[i];
+            if (rki == 0.0)
+               continue;
+            Real *wi = &work[i * n];
+            for (Integer j = i; j < n; ++j)
+               wi[j] -= rki * rk[j];
+         }
+      }
+
+      // Trailing update: A22 -= R12^T R12, one row of A22 at a time
+      for (Integer i = ke; i < n; ++i)
+      {
+         Real *wi = &work[i * n];
+         for (Integer k = kb; k < ke; ++k)
+         {
+            const Real *rk = &work[k * n];
+            Real rki = rk[i];
+            if (rki == 0.0)
+               continue;
+            for (Integer j = i; j < n; ++j)
+               wi[j] -= rki * rk[j];
+         }
+      }
+   }
+
+   if (reportWarning)
+   {
+      MessageInterface::ShowMessage("**** WARNING **** Cholesky "
+         "factorization calculated one or more squared diagonal elements "
+         "of the factored matrix below the tolerance %.2e.  Diagonal "
+         "elements were still calculated normally by square roots, but "
+         "may have become very small in magnitude.\n", tolerance);
+   }
+}
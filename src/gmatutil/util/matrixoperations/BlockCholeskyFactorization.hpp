@@ -0,0 +1,68 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                          BlockCholeskyFactorization
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/16
+//
+/**
+ * Declares the BlockCholeskyFactorization class, a blocked Cholesky
+ * factorization and inversion for symmetric positive definite matrices.
+ *
+ * The results match CholeskyFactorization (A = R^T R with R upper
+ * triangular, and the same positive definite checks), but the work is done
+ * on a contiguous row-major copy of the matrix.  The trailing update after
+ * each block of rows is applied one block at a time, and every inner loop
+ * runs along a row, so large estimation problems stay in cache.
+ */
+//------------------------------------------------------------------------------
+#ifndef BlockCholeskyFactorization_hpp
+#define BlockCholeskyFactorization_hpp
+
+#include "utildefs.hpp"
+#include "MatrixFactorization.hpp"
+
+class GMATUTIL_API BlockCholeskyFactorization : public MatrixFactorization
+{
+public:
+   BlockCholeskyFactorization(Integer blockSize = 64);
+   BlockCholeskyFactorization(const BlockCholeskyFactorization &bcf);
+   virtual ~BlockCholeskyFactorization();
+   BlockCholeskyFactorization& operator=(const BlockCholeskyFactorization &bcf);
+
+   virtual void Factor(const Rmatrix &inputMatrix, Rmatrix &R,
+                       Rmatrix &blankMatrix);
+   virtual void Factor(const Rmatrix &inputMatrix, Rmatrix &R);
+   virtual void Invert(Rmatrix &inputMatrix);
+
+protected:
+   /// Number of rows factored in each block
+   Integer     blockSize;
+   /// Number of rows in the current matrix
+   Integer     rowCount;
+   /// Row-major working copy of the matrix; holds R after FactorInPlace()
+   RealArray   work;
+   /// Row-major inverse of R, used by Invert()
+   RealArray   rInverse;
+
+   void        LoadMatrix(const Rmatrix &inputMatrix);
+   void        FactorInPlace();
+};
+
+#endif // BlockCholeskyFactorization_hpp
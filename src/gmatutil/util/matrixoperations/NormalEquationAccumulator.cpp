@@ -0,0 +1,322 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                          NormalEquationAccumulator
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/16
+//
+/**
+ * Implements the NormalEquationAccumulator class.
+ */
+//------------------------------------------------------------------------------
+#include "NormalEquationAccumulator.hpp"
+#include "MatrixFactorization.hpp"
+#include "UtilityException.hpp"
+
+//------------------------------------------------------------------------------
+// NormalEquationAccumulator(Integer size, Integer blockRows)
+//------------------------------------------------------------------------------
+/**
+ * Constructor
+ *
+ * @param size      Number of state elements
+ * @param blockRows Number of observations added in each block update
+ */
+//------------------------------------------------------------------------------
+NormalEquationAccumulator::NormalEquationAccumulator(Integer size,
+                                                     Integer blockRows) :
+   stateSize      (0),
+   blockRows      (blockRows > 0 ? blockRows : 1),
+   pendingRows    (0)
+{
+   SetSize(size);
+}
+
+//------------------------------------------------------------------------------
+// NormalEquationAccumulator(const NormalEquationAccumulator &nea)
+//------------------------------------------------------------------------------
+NormalEquationAccumulator::NormalEquationAccumulator(
+      const NormalEquationAccumulator &nea) :
+   stateSize      (nea.stateSize),
+   blockRows      (nea.blockRows),
+   pendingRows    (nea.pendingRows),
+   packed         (nea.packed),
+   rhs            (nea.rhs),
+   pending        (nea.pending),
+   pendingWeight  (nea.pendingWeight),
+   pendingResidual(nea.pendingResidual)
+{
+}
+
+//------------------------------------------------------------------------------
+// ~NormalEquationAccumulator()
+//------------------------------------------------------------------------------
+NormalEquationAccumulator::~NormalEquationAccumulator()
+{
+}
+
+//------------------------------------------------------------------------------
+// NormalEquationAccumulator& operator=(const NormalEquationAccumulator &nea)
+//------------------------------------------------------------------------------
+NormalEquationAccumulator& NormalEquationAccumulator::operator=(
+      const NormalEquationAccumulator &nea)
+{
+   if (this != &nea)
+   {
+      stateSize       = nea.stateSize;
+      blockRows       = nea.blockRows;
+      pendingRows     = nea.pendingRows;
+      packed          = nea.packed;
+      rhs             = nea.rhs;
+      pending         = nea.pending;
+      pendingWeight   = nea.pendingWeight;
+      pendingResidual = nea.pendingResidual;
+   }
+
+   return *this;
+}
+
+//------------------------------------------------------------------------------
+// void SetSize(Integer size)
+//------------------------------------------------------------------------------
+/**
+ * Sets the number of state elements and clears the sums.
+ *
+ * @param size Number of state elements
+ */
+//------------------------------------------------------------------------------
+void NormalEquationAccumulator::SetSize(Integer size)
+{
+   if (size < 0)
+      throw UtilityException("NormalEquationAccumulator: the state size cannot "
+            "be negative");
+
+   stateSize = size;
+   pending.assign(stateSize * blockRows, 0.0);
+   pendingWeight.assign(blockRows, 0.0);
+   pendingResidual.assign(blockRows, 0.0);
+   activeIndex.reserve(stateSize);
+   Reset();
+}
+
+//------------------------------------------------------------------------------
+// Integer GetSize() const
+//------------------------------------------------------------------------------
+Integer NormalEquationAccumulator::GetSize() const
+{
+   return stateSize;
+}
+
+//------------------------------------------------------------------------------
+// void Reset()
+//------------------------------------------------------------------------------
+/**
+ * Zeros the sums and drops any staged observations.
+ */
+//------------------------------------------------------------------------------
+void NormalEquationAccumulator::Reset()
+{
+   packed.assign(stateSize * (stateSize + 1) / 2, 0.0);
+   rhs.assign(stateSize, 0.0);
+   pendingRows = 0;
+}
+
+//------------------------------------------------------------------------------
+// void AddObservation(const Real *partials, Real weight, Real residual)
+//------------------------------------------------------------------------------
+/**
+ * Stages one observation; the sums are updated when the block is full or
+ * when Flush() is called.
+ *
+ * @param partials The partials of the observation with respect to the state
+ *                 (stateSize values)
+ * @param weight   The observation weight
+ * @param residual The observation residual (O-C)
+ */
+//------------------------------------------------------------------------------
+void NormalEquationAccumulator::AddObservation(const Real *partials,
+                                               Real weight, Real residual)
+{
+   for (Integer i = 0; i < stateSize; ++i)
+      pending[i*blockRows + pendingRows] = partials[i];
+   pendingWeight[pendingRows]   = weight;
+   pendingResidual[pendingRows] = residual;
+
+   if (++pendingRows == blockRows)
+      Flush();
+}
+
+//------------------------------------------------------------------------------
+// void AddObservation(const RealArray &partials, Real weight, Real residual)
+//------------------------------------------------------------------------------
+void NormalEquationAccumulator::AddObservation(const RealArray &partials,
+                                               Real weight, Real residual)
+{
+   if ((Integer)partials.size() < stateSize)
+      throw UtilityException("NormalEquationAccumulator: the observation "
+            "partials are shorter than the state");
+
+   AddObservation(&partials[0], weight, residual);
+}
+
+//------------------------------------------------------------------------------
+// void Merge(NormalEquationAccumulator &other)
+//------------------------------------------------------------------------------
+/**
+ * Adds the sums of another accumulator of the same size to this one.
+ *
+ * This is used to reduce per-thread accumulators; both accumulators are
+ * flushed first.
+ *
+ * @param other The accumulator that is added
+ */
+//------------------------------------------------------------------------------
+void NormalEquationAccumulator::Merge(NormalEquationAccumulator &other)
+{
+   if (other.stateSize != stateSize)
+      throw UtilityException("NormalEquationAccumulator: cannot merge "
+            "accumulators of different sizes");
+
+   Flush();
+   other.Flush();
+
+   for (UnsignedInt i = 0; i < packed.size(); ++i)
+      packed[i] += other.packed[i];
+   for (Integer i = 0; i < stateSize; ++i)
+      rhs[i] += other.rhs[i];
+}
+
+//------------------------------------------------------------------------------
+// void Flush()
+//------------------------------------------------------------------------------
+/**
+ * Adds the staged observations to the sums.
+ *
+ * Each element of the block is summed over the staged observations before it
+ * is added to the packed triangle, so the inner loop runs over contiguous
+ * memory.  State elements whose staged partials are all zero are skipped.
+ */
+//------------------------------------------------------------------------------
+void NormalEquationAccumulator::Flush()
+{
+   if (pendingRows == 0)
+      return;
+
+   activeIndex.clear();
+   for (Integer i = 0; i < stateSize; ++i)
+   {
+      const Real *hi = &pending[i*blockRows];
+      for (Integer k = 0; k < pendingRows; ++k)
+      {
+         if (hi[k] != 0.0)
+         {
+            activeIndex.push_back(i);
+            break;
+         }
+      }
+   }
+
+   const Real *w = &pendingWeight[0];
+   const Real *r = &pendingResidual[0];
+   Integer activeCount = activeIndex.size();
+
+   for (Integer a = 0; a < activeCount; ++a)
+   {
+      Integer i = activeIndex[a];
+      const Real *hi = &pending[i*blockRows];
+      Integer rowStart = MatrixFactorization::PackedArrayIndex(stateSize, i, i)
+                         - i;
+
+      for (Integer b = a; b < activeCount; ++b)
+      {
+         Integer j = activeIndex[b];
+         const Real *hj = &pending[j*blockRows];
+         Real sum = 0.0;
+         for (Integer k = 0; k < pendingRows; ++k)
+            sum += hi[k] * hj[k] * w[k];
+         packed[rowStart + j] += sum;
+      }
+
+      Real sum = 0.0;
+      for (Integer k = 0; k < pendingRows; ++k)
+         sum += hi[k] * w[k] * r[k];
+      rhs[i] += sum;
+   }
+
+   pendingRows = 0;
+}
+
+//------------------------------------------------------------------------------
+// const RealArray& GetPackedInformation()
+//------------------------------------------------------------------------------
+/**
+ * @return The upper triangle of H^T W H, packed by rows
+ */
+//------------------------------------------------------------------------------
+const RealArray& NormalEquationAccumulator::GetPackedInformation()
+{
+   Flush();
+   return packed;
+}
+
+//------------------------------------------------------------------------------
+// const RealArray& GetResiduals()
+//------------------------------------------------------------------------------
+/**
+ * @return H^T W r
+ */
+//------------------------------------------------------------------------------
+const RealArray& NormalEquationAccumulator::GetResiduals()
+{
+   Flush();
+   return rhs;
+}
+
+//------------------------------------------------------------------------------
+// void AddTo(Rmatrix &information, Rvector &residuals)
+//------------------------------------------------------------------------------
+/**
+ * Adds the sums to a full information matrix and residual vector.
+ *
+ * @param information The stateSize x stateSize information matrix
+ * @param residuals   The residual vector
+ */
+//------------------------------------------------------------------------------
+void NormalEquationAccumulator::AddTo(Rmatrix &information, Rvector &residuals)
+{
+   if ((information.GetNumRows() != stateSize) ||
+       (information.GetNumColumns() != stateSize) ||
+       (residuals.GetSize() != stateSize))
+      throw UtilityException("NormalEquationAccumulator: the information "
+            "matrix or residual vector does not match the state size");
+
+   Flush();
+
+   Integer index = 0;
+   for (Integer i = 0; i < stateSize; ++i)
+   {
+      information(i, i) += packed[index++];
+      for (Integer j = i + 1; j < stateSize; ++j, ++index)
+      {
+         information(i, j) += packed[index];
+         information(j, i) += packed[index];
+      }
+      residuals[i] += rhs[i];
+   }
+}
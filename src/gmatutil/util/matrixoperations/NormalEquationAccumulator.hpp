@@ -0,0 +1,87 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                          NormalEquationAccumulator
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2020 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+// Author: GMAT Development Team
+// Created: 2026/10/16
+//
+/**
+ * Declares the NormalEquationAccumulator class, which sums the weighted
+ * normal equations H^T W H and H^T W r of a least squares problem.
+ *
+ * The information matrix is kept as the upper triangle of the symmetric
+ * matrix, packed by rows in the layout used by
+ * MatrixFactorization::PackedArrayIndex().  Observations are staged and
+ * added as a block (a rank-k update), and state elements that have zero
+ * partials for every staged observation are skipped, so sparse partials such
+ * as station and measurement biases cost little.
+ */
+//------------------------------------------------------------------------------
+#ifndef NormalEquationAccumulator_hpp
+#define NormalEquationAccumulator_hpp
+
+#include "utildefs.hpp"
+#include "Rmatrix.hpp"
+#include "Rvector.hpp"
+
+class GMATUTIL_API NormalEquationAccumulator
+{
+public:
+   NormalEquationAccumulator(Integer size = 0, Integer blockRows = 32);
+   NormalEquationAccumulator(const NormalEquationAccumulator &nea);
+   virtual ~NormalEquationAccumulator();
+   NormalEquationAccumulator& operator=(const NormalEquationAccumulator &nea);
+
+   void                 SetSize(Integer size);
+   Integer              GetSize() const;
+   void                 Reset();
+
+   void                 AddObservation(const Real *partials, Real weight,
+                                       Real residual);
+   void                 AddObservation(const RealArray &partials, Real weight,
+                                       Real residual);
+   void                 Merge(NormalEquationAccumulator &other);
+   void                 Flush();
+
+   const RealArray&     GetPackedInformation();
+   const RealArray&     GetResiduals();
+   void                 AddTo(Rmatrix &information, Rvector &residuals);
+
+protected:
+   /// Number of state elements
+   Integer              stateSize;
+   /// Number of observations staged before a block update
+   Integer              blockRows;
+   /// Number of observations currently staged
+   Integer              pendingRows;
+   /// Upper triangle of H^T W H, packed by rows
+   RealArray            packed;
+   /// H^T W r
+   RealArray            rhs;
+   /// Staged partials; element i of observation k is at [i*blockRows + k]
+   RealArray            pending;
+   /// Staged weights
+   RealArray            pendingWeight;
+   /// Staged residuals
+   RealArray            pendingResidual;
+   /// Scratch list of the state elements with nonzero staged partials
+   IntegerArray         activeIndex;
+};
+
+#endif // NormalEquationAccumulator_hpp